@@ -4,6 +4,11 @@
 //  A C64 emulator for the terminal, using the Kitty graphics protocol:
 //
 //  https://sw.kovidgoyal.net/kitty/graphics-protocol/
+//
+//  The first frame is transmitted as a complete image, after that only
+//  the tiles which changed since the previous frame are sent as edits
+//  of the image's root frame (nothing at all if the frame is identical).
+//  Pixel data is zlib-compressed and sent in chunks of 4 KB.
 //------------------------------------------------------------------------------
 #include <stdio.h>
 #include <stdint.h>
@@ -12,6 +17,8 @@
 #include <curses.h>     // curses is only used for non-blocking keyboard input
 #include <unistd.h>
 #include <signal.h>
+#include <string.h>
+#include <zlib.h>
 #define SOKOL_IMPL
 #include "sokol_time.h"
 #define CHIPS_IMPL
@@ -29,11 +36,19 @@
 #include "systems/c1541.h"
 #include "systems/c64.h"
 #include "c64-roms.h"
+#include "base64.h"
 
 #define FRAME_USEC (16666)
 #define MAX_WIDTH (512)
 #define MAX_HEIGHT (512)
 #define BYTES_PER_PIXEL (3)
+#define RGB_SIZE (MAX_WIDTH * MAX_HEIGHT * BYTES_PER_PIXEL)
+// worst-case zlib output size, see compressBound()
+#define ZBUF_SIZE (RGB_SIZE + (RGB_SIZE >> 12) + (RGB_SIZE >> 14) + 64)
+#define B64_SIZE (((ZBUF_SIZE + 2) / 3) * 4)
+#define TILE_SIZE (16)
+#define KITTY_IMAGE_ID (1)
+#define KITTY_CHUNK_SIZE (4096)
 
 static struct {
     c64_t c64;
@@ -45,13 +60,19 @@ static struct {
         size_t index;
         size_t frame_count;
     } keybuf;
-    uint8_t rgb[MAX_WIDTH * MAX_HEIGHT * BYTES_PER_PIXEL];
-    uint8_t b64_buf[MAX_WIDTH * MAX_HEIGHT * BYTES_PER_PIXEL * 2];
+    struct {
+        bool valid;
+        int width;
+        int height;
+    } image;
+    uint8_t rgb[RGB_SIZE];
+    uint8_t prev_rgb[RGB_SIZE];
+    uint8_t rect_rgb[RGB_SIZE];
+    uint8_t zbuf[ZBUF_SIZE];
+    char b64_buf[B64_SIZE];
     uint8_t io_buf[(1<<16)];
 } state;
 
-unsigned char* base64_encode(const uint8_t *src, size_t len, chips_range_t dst, size_t* out_len);
-
 // a signal handler for Ctrl-C, for proper cleanup
 static int quit_requested = 0;
 static void catch_sigint(int signo) {
@@ -87,15 +108,98 @@ static void term_home(void) {
     printf("\033[0;0H");
 }
 
-// dump converted framebuffer pixels
+// send a graphics command with zlib-compressed pixels, keys is the control data
+static void term_kitty_send(const char* keys, const uint8_t* pixels, size_t num_bytes) {
+    assert(compressBound(num_bytes) <= sizeof(state.zbuf));
+    uLongf z_num_bytes = sizeof(state.zbuf);
+    int res = compress2(state.zbuf, &z_num_bytes, pixels, num_bytes, Z_BEST_SPEED);
+    assert(res == Z_OK); (void)res;
+    const size_t b64_num_bytes = base64_encode(state.zbuf, z_num_bytes, state.b64_buf);
+    // the payload is split into chunks, only the first chunk has the control data
+    for (size_t pos = 0; pos < b64_num_bytes; pos += KITTY_CHUNK_SIZE) {
+        const size_t num = ((b64_num_bytes - pos) < KITTY_CHUNK_SIZE) ? (b64_num_bytes - pos) : KITTY_CHUNK_SIZE;
+        const int more = (pos + num) < b64_num_bytes;
+        if (pos == 0) {
+            printf("\033_G%s,o=z,q=2,m=%d;", keys, more);
+        } else {
+            printf("\033_Gm=%d;", more);
+        }
+        fwrite(state.b64_buf + pos, 1, num, stdout);
+        printf("\033\\");
+    }
+}
+
+static void term_kitty_delete_image(void) {
+    if (state.image.valid) {
+        printf("\033_Ga=d,d=I,i=%d,q=2\033\\", KITTY_IMAGE_ID);
+        state.image.valid = false;
+    }
+}
+
+// check if any pixel in a tile changed since the previous frame
+static bool tile_dirty(int tx, int ty) {
+    const int x0 = tx * TILE_SIZE;
+    const int y0 = ty * TILE_SIZE;
+    const int w = ((state.width - x0) < TILE_SIZE) ? (state.width - x0) : TILE_SIZE;
+    const int h = ((state.height - y0) < TILE_SIZE) ? (state.height - y0) : TILE_SIZE;
+    for (int y = y0; y < (y0 + h); y++) {
+        const size_t offset = (size_t)((y * state.width + x0) * BYTES_PER_PIXEL);
+        if (0 != memcmp(&state.rgb[offset], &state.prev_rgb[offset], (size_t)(w * BYTES_PER_PIXEL))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// send a rectangle of converted framebuffer pixels as an edit of the image's root frame
+static void term_kitty_rect(int x, int y, int w, int h) {
+    uint8_t* dst = state.rect_rgb;
+    for (int i = 0; i < h; i++) {
+        memcpy(dst, &state.rgb[((y + i) * state.width + x) * BYTES_PER_PIXEL], (size_t)(w * BYTES_PER_PIXEL));
+        dst += w * BYTES_PER_PIXEL;
+    }
+    char keys[128];
+    snprintf(keys, sizeof(keys), "a=f,i=%d,r=1,x=%d,y=%d,s=%d,v=%d,f=24", KITTY_IMAGE_ID, x, y, w, h);
+    term_kitty_send(keys, state.rect_rgb, (size_t)(w * h * BYTES_PER_PIXEL));
+}
+
+// send the converted framebuffer pixels which changed since the previous frame
 static void term_kitty_pixels(void) {
-    printf("\033_Ga=T,f=24,s=%d,v=%d,c=80,r=30;", state.width, state.height);
-    const int num_bytes = state.width * state.height * BYTES_PER_PIXEL;
-    size_t b64_num_bytes = 0;
-    chips_range_t out_buf = { .ptr = state.b64_buf, .size = sizeof(state.b64_buf) };
-    const unsigned char* b64 = base64_encode(state.rgb, num_bytes, out_buf, &b64_num_bytes);
-    fwrite(b64, 1, b64_num_bytes, stdout);
-    printf("\033\\");
+    const size_t num_bytes = (size_t)(state.width * state.height * BYTES_PER_PIXEL);
+    if (!state.image.valid || (state.image.width != state.width) || (state.image.height != state.height)) {
+        term_kitty_delete_image();
+        term_home();
+        char keys[128];
+        snprintf(keys, sizeof(keys), "a=T,i=%d,f=24,s=%d,v=%d,c=80,r=30", KITTY_IMAGE_ID, state.width, state.height);
+        term_kitty_send(keys, state.rgb, num_bytes);
+        state.image.valid = true;
+        state.image.width = state.width;
+        state.image.height = state.height;
+    } else {
+        // send horizontal runs of dirty tiles as one rectangle
+        const int num_tiles_x = (state.width + TILE_SIZE - 1) / TILE_SIZE;
+        const int num_tiles_y = (state.height + TILE_SIZE - 1) / TILE_SIZE;
+        for (int ty = 0; ty < num_tiles_y; ty++) {
+            int tx = 0;
+            while (tx < num_tiles_x) {
+                if (!tile_dirty(tx, ty)) {
+                    tx++;
+                    continue;
+                }
+                int tx_end = tx + 1;
+                while ((tx_end < num_tiles_x) && tile_dirty(tx_end, ty)) {
+                    tx_end++;
+                }
+                const int x = tx * TILE_SIZE;
+                const int y = ty * TILE_SIZE;
+                const int x_end = ((tx_end * TILE_SIZE) < state.width) ? (tx_end * TILE_SIZE) : state.width;
+                const int y_end = ((y + TILE_SIZE) < state.height) ? (y + TILE_SIZE) : state.height;
+                term_kitty_rect(x, y, x_end - x, y_end - y);
+                tx = tx_end;
+            }
+        }
+    }
+    memcpy(state.prev_rgb, state.rgb, num_bytes);
 }
 
 int main(int argc, char* argv[]) {
@@ -189,7 +293,6 @@ int main(int argc, char* argv[]) {
 
         // render the frame in the terminal
         convert_framebuffer();
-        term_home();
         term_kitty_pixels();
         fflush(stdout);
 
@@ -199,68 +302,8 @@ int main(int argc, char* argv[]) {
             usleep(FRAME_USEC - dur_usec);
         }
     }
+    term_kitty_delete_image();
+    fflush(stdout);
     endwin();
     return 0;
 }
-
-// from: https://web.mit.edu/freebsd/head/contrib/wpa/src/utils/base64.c
-static const unsigned char base64_table[65] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-
-unsigned char* base64_encode(const uint8_t *src, size_t len, chips_range_t dst, size_t* out_len) {
-	unsigned char *out, *pos;
-	const unsigned char *end, *in;
-	size_t olen;
-	int line_len;
-
-	olen = len * 4 / 3 + 4; /* 3-byte blocks to 4-byte */
-	olen += olen / 72; /* line feeds */
-	olen++; /* nul termination */
-	if (olen < len) {
-		return NULL; /* integer overflow */
-    }
-	out = dst.ptr;
-	if (out == NULL) {
-		return NULL;
-    }
-
-	end = src + len;
-	in = src;
-	pos = out;
-	line_len = 0;
-	while (end - in >= 3) {
-		*pos++ = base64_table[in[0] >> 2];
-		*pos++ = base64_table[((in[0] & 0x03) << 4) | (in[1] >> 4)];
-		*pos++ = base64_table[((in[1] & 0x0f) << 2) | (in[2] >> 6)];
-		*pos++ = base64_table[in[2] & 0x3f];
-		in += 3;
-		line_len += 4;
-		if (line_len >= 72) {
-			*pos++ = '\n';
-			line_len = 0;
-		}
-	}
-
-	if (end - in) {
-		*pos++ = base64_table[in[0] >> 2];
-		if (end - in == 1) {
-			*pos++ = base64_table[(in[0] & 0x03) << 4];
-			*pos++ = '=';
-		} else {
-			*pos++ = base64_table[((in[0] & 0x03) << 4) |
-					      (in[1] >> 4)];
-			*pos++ = base64_table[(in[1] & 0x0f) << 2];
-		}
-		*pos++ = '=';
-		line_len += 4;
-	}
-
-	if (line_len)
-		*pos++ = '\n';
-
-	*pos = '\0';
-	if (out_len) {
-		*out_len = pos - out;
-    }
-    assert(*out_len <= dst.size);
-	return out;
-}
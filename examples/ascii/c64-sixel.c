@@ -6,10 +6,19 @@
 //
 //  https://en.wikipedia.org/wiki/Sixel
 //
+//  The frame is scaled by 2 and encoded with the 16 VIC-II colors, each
+//  band of 6 sixel rows (3 emulator pixel rows) is sent as one run-length
+//  encoded line per color that's used in the band. Frames which are
+//  identical to the previous frame are not sent. Changed frames are always
+//  sent complete, since most terminals replace the cell contents under an
+//  image instead of compositing transparent sixels over the old image.
+//
 //  Tested with iTerm2 3.x+ on macOS.
 //------------------------------------------------------------------------------
 #include <stdio.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
 #include <curses.h>     // curses is only used for non-blocking keyboard input
 #include <unistd.h>
@@ -32,13 +41,24 @@
 #include "systems/c64.h"
 #include "c64-roms.h"
 
+#define FRAME_USEC (33333)
+#define MAX_WIDTH (512)
+#define NUM_COLORS (16)
+
 static struct {
     c64_t c64;
-    char chrs[256*1024];        // the video output converted to Sixel ASCII characters
+    // the video output converted to Sixel ASCII characters, allocated once for the worst case
+    struct {
+        char* buf;
+        size_t size;
+        size_t pos;
+    } out;
+    // the color indices of the previous frame, and of the current band
+    uint8_t* prev_pixels;
+    bool prev_valid;
+    uint8_t band[3][MAX_WIDTH];
 } state;
 
-#define FRAME_USEC (33333)
-
 // a signal handler for Ctrl-C, for proper cleanup
 static int quit_requested = 0;
 static void catch_sigint(int signo) {
@@ -51,50 +71,176 @@ static void term_home(void) {
     printf("\033[0;0H");
 }
 
-// Esc sequence to switch terminal into Sixel mode
-static void term_sixel_begin(void) {
+static void out_chr(char c) {
+    assert(state.out.pos < state.out.size);
+    state.out.buf[state.out.pos++] = c;
+}
+
+static void out_int(int val) {
+    char buf[16];
+    int len = snprintf(buf, sizeof(buf), "%d", val);
+    assert((state.out.pos + (size_t)len) <= state.out.size);
+    memcpy(&state.out.buf[state.out.pos], buf, (size_t)len);
+    state.out.pos += (size_t)len;
+}
+
+// a run of the same sixel, with repeat compression for more than 3 sixels
+static void out_run(char chr, int num) {
+    if (num > 3) {
+        out_chr('!');
+        out_int(num);
+        out_chr(chr);
+    }
+    else {
+        for (int i = 0; i < num; i++) {
+            out_chr(chr);
+        }
+    }
+}
+
+// allocate the output arena for the worst case, and the previous frame's pixels
+static void sixel_init(void) {
     const chips_display_info_t info = c64_display_info(&state.c64);
-    const int w = 2 * info.screen.width;
-    const int h = 2 * info.screen.height;
-    printf("\033Pq\"1;1;%d;%d", w, h);
+    const size_t w = (size_t)info.screen.width;
+    const size_t h = (size_t)info.screen.height;
+    const size_t num_bands = (h + 2) / 3;
+    // each pixel is 2 sixels wide, and a run of 2 sixels is sent uncompressed
+    const size_t band_size = NUM_COLORS * (4 + 2 * w + 1) + 1;
+    state.out.size = 64 + NUM_COLORS * 24 + num_bands * band_size;
+    state.out.buf = malloc(state.out.size);
+    state.prev_pixels = malloc(w * h);
+    assert(state.out.buf && state.prev_pixels);
+}
+
+static void sixel_shutdown(void) {
+    free(state.out.buf);
+    free(state.prev_pixels);
 }
 
-// TODO: define the Sixel color palette
-static void term_sixel_colors(void) {
-    printf("#0;2;0;0;0"         // black
-           "#1;2;100;100;100");   // white
+// Esc sequence to switch terminal into Sixel mode, with an opaque background and 2x scaled raster
+static void sixel_begin(int w, int h) {
+    const char* dcs = "\033P0;0;0q\"1;1;";
+    while (*dcs) {
+        out_chr(*dcs++);
+    }
+    out_int(2 * w);
+    out_chr(';');
+    out_int(2 * h);
+}
+
+// define the Sixel color palette from the VIC-II colors
+static void sixel_colors(const uint32_t* pal) {
+    for (int i = 0; i < NUM_COLORS; i++) {
+        // palette entries are ABGR, Sixel colors are RGB percentages
+        const uint32_t c = pal[i];
+        out_chr('#');
+        out_int(i);
+        out_chr(';');
+        out_int(2);
+        for (int shift = 0; shift < 24; shift += 8) {
+            out_chr(';');
+            out_int((int)((((c >> shift) & 0xFF) * 100 + 127) / 255));
+        }
+    }
 }
 
-// flush terminal output for current frame
-static void term_flush(void) {
-    printf("\e\\\n");
+// encode one band of 3 pixel rows (6 sixel rows at 2x scale)
+static void sixel_band(int w) {
+    const uint8_t (*rows)[MAX_WIDTH] = state.band;
+    uint32_t used = 0;
+    for (int x = 0; x < w; x++) {
+        used |= (1u << rows[0][x]) | (1u << rows[1][x]) | (1u << rows[2][x]);
+    }
+    bool first = true;
+    for (int c = 0; c < NUM_COLORS; c++) {
+        if (0 == (used & (1u << c))) {
+            continue;
+        }
+        // carriage return to the start of the band between colors
+        if (!first) {
+            out_chr('$');
+        }
+        first = false;
+        out_chr('#');
+        out_int(c);
+        char run_chr = 0;
+        int run_len = 0;
+        int empty_len = 0;
+        for (int x = 0; x < w; x++) {
+            const int bits = ((rows[0][x] == c) ? 3 : 0) | ((rows[1][x] == c) ? 12 : 0) | ((rows[2][x] == c) ? 48 : 0);
+            const char chr = (char)(0x3F + bits);
+            if (chr == run_chr) {
+                run_len += 2;
+                continue;
+            }
+            // trailing empty sixels don't need to be sent
+            if (run_chr == 0x3F) {
+                empty_len = run_len;
+            }
+            else {
+                out_run(0x3F, empty_len);
+                empty_len = 0;
+                out_run(run_chr, run_len);
+            }
+            run_chr = chr;
+            run_len = 2;
+        }
+        if (run_chr != 0x3F) {
+            out_run(0x3F, empty_len);
+            out_run(run_chr, run_len);
+        }
+    }
+    out_chr('-');
 }
 
-// decode the pixel buffer into a sixel character sequence and send to terminal
-static void term_sixel_pixels(void) {
+// encode the frame into Sixel ASCII characters and send it to the terminal
+static void term_sixel_frame(void) {
     const chips_display_info_t info = c64_display_info(&state.c64);
+    assert(info.palette.ptr && (info.palette.size >= NUM_COLORS * 4));
+    assert(info.frame.bytes_per_pixel == 1);
     const int w = info.screen.width;
     const int h = info.screen.height;
     const int row_pitch = info.frame.dim.width;
-    int chr_pos = 0;
-    for (int y = 0; y < h; y += 3) {
+    const uint8_t* fb = (const uint8_t*)info.frame.buffer.ptr + info.screen.y * row_pitch + info.screen.x;
+    assert(w <= MAX_WIDTH);
+
+    // identical frames are not sent at all
+    bool changed = !state.prev_valid;
+    for (int y = 0; y < h; y++) {
+        const uint8_t* src = fb + y * row_pitch;
+        uint8_t* prev = &state.prev_pixels[y * w];
         for (int x = 0; x < w; x++) {
-            char chr = 0;
-            for (int i = 0; i < 3; i++) {
-                uint8_t p = state.c64.vic.crt.fb[(y + i) * row_pitch + x] & 0xF;
-                // FIXME: convert pixel color back to terminal color
-                if (p == 6) {
-                    chr |= (3<<(i*2));
-                }
+            const uint8_t p = src[x] & (NUM_COLORS - 1);
+            changed |= (p != prev[x]);
+            prev[x] = p;
+        }
+    }
+    state.prev_valid = true;
+    if (!changed) {
+        return;
+    }
+
+    state.out.pos = 0;
+    sixel_begin(w, h);
+    sixel_colors(info.palette.ptr);
+    for (int y = 0; y < h; y += 3) {
+        // the last band may be incomplete, the missing rows use a color which doesn't exist
+        for (int i = 0; i < 3; i++) {
+            if ((y + i) < h) {
+                memcpy(state.band[i], &state.prev_pixels[(y + i) * w], (size_t)w);
+            }
+            else {
+                memset(state.band[i], NUM_COLORS, (size_t)w);
             }
-            state.chrs[chr_pos++] = chr + 0x3F;
-            state.chrs[chr_pos++] = chr + 0x3F;
         }
-        state.chrs[chr_pos++] = '$';
-        state.chrs[chr_pos++] = '-';
+        sixel_band(w);
     }
-    state.chrs[chr_pos++] = 0;
-    printf("%s", state.chrs);
+    out_chr('\033');
+    out_chr('\\');
+    out_chr('\n');
+    term_home();
+    fwrite(state.out.buf, 1, state.out.pos, stdout);
+    fflush(stdout);
 }
 
 int main() {
@@ -121,6 +267,7 @@ int main() {
             .kernal = { .ptr=dump_c64_kernalv3_bin, .size=sizeof(dump_c64_kernalv3_bin) }
         }
     });
+    sixel_init();
 
     while (!quit_requested) {
         uint64_t start = stm_now();
@@ -155,11 +302,7 @@ int main() {
         }
 
         // render the frame in the terminal
-        term_home();
-        term_sixel_begin();
-        term_sixel_colors();
-        term_sixel_pixels();
-        term_flush();
+        term_sixel_frame();
 
         // sleep until next frame
         double dur_usec = stm_us(stm_since(start));
@@ -167,6 +310,7 @@ int main() {
             usleep(FRAME_USEC - dur_usec);
         }
     }
+    sixel_shutdown();
     endwin();
     return 0;
 }
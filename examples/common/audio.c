@@ -0,0 +1,237 @@
+#include "sokol_audio.h"
+#include "sokol_log.h"
+#include "audio.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h> // malloc/free
+#include <string.h>
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+#define AUDIO_DEF(v,def) (v?v:def)
+#define AUDIO_WAV_HEADER_SIZE (44)
+#define AUDIO_WAV_CHUNK_SIZE (1024)
+
+typedef struct {
+    bool valid;
+    // the ring buffer, read_pos and write_pos are free-running sample counters,
+    // write_pos is only written by the emulator, read_pos only by the audio thread
+    float* ring;
+    uint32_t ring_mask;
+    volatile uint32_t write_pos;
+    volatile uint32_t read_pos;
+    // producer side
+    uint32_t pending;           // samples written behind write_pos, but not yet published
+    uint32_t batch_frames;
+    volatile uint32_t suspended;    // also read by the audio thread
+    volatile uint32_t num_overruns;
+    // consumer side
+    uint32_t prefill_frames;
+    bool prefilling;
+    volatile uint32_t num_underruns;
+    // optional WAV sink
+    struct {
+        FILE* fp;
+        int sample_rate;
+        uint32_t num_samples;
+        int16_t chunk[AUDIO_WAV_CHUNK_SIZE];
+    } wav;
+} audio_state_t;
+static audio_state_t state;
+
+#if defined(_WIN32)
+static uint32_t audio_load_acquire(volatile uint32_t* ptr) {
+    return (uint32_t)InterlockedCompareExchange((volatile LONG*)ptr, 0, 0);
+}
+static void audio_store_release(volatile uint32_t* ptr, uint32_t val) {
+    InterlockedExchange((volatile LONG*)ptr, (LONG)val);
+}
+static void audio_increment(volatile uint32_t* ptr) {
+    InterlockedIncrement((volatile LONG*)ptr);
+}
+#else
+static uint32_t audio_load_acquire(volatile uint32_t* ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+static void audio_store_release(volatile uint32_t* ptr, uint32_t val) {
+    __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+}
+static void audio_increment(volatile uint32_t* ptr) {
+    __atomic_fetch_add(ptr, 1, __ATOMIC_RELAXED);
+}
+#endif
+
+// called on the audio thread
+static void audio_stream_cb(float* buffer, int num_frames, int num_channels) {
+    const uint32_t write_pos = audio_load_acquire(&state.write_pos);
+    if (audio_load_acquire(&state.suspended)) {
+        // no samples are coming while suspended, so this isn't an underrun,
+        // drop what's left and prefill again when the samples come back
+        memset(buffer, 0, (size_t)(num_frames * num_channels) * sizeof(float));
+        state.prefilling = true;
+        audio_store_release(&state.read_pos, write_pos);
+        return;
+    }
+    const uint32_t read_pos = state.read_pos;
+    const uint32_t avail = write_pos - read_pos;
+    if (state.prefilling) {
+        if (avail < state.prefill_frames) {
+            memset(buffer, 0, (size_t)(num_frames * num_channels) * sizeof(float));
+            return;
+        }
+        state.prefilling = false;
+    }
+    const uint32_t num = ((uint32_t)num_frames < avail) ? (uint32_t)num_frames : avail;
+    for (uint32_t i = 0; i < num; i++) {
+        const float s = state.ring[(read_pos + i) & state.ring_mask];
+        for (int c = 0; c < num_channels; c++) {
+            *buffer++ = s;
+        }
+    }
+    if (num < (uint32_t)num_frames) {
+        memset(buffer, 0, (size_t)(((uint32_t)num_frames - num) * (uint32_t)num_channels) * sizeof(float));
+        audio_increment(&state.num_underruns);
+        state.prefilling = true;
+    }
+    audio_store_release(&state.read_pos, read_pos + num);
+}
+
+static void audio_wav_write_header(uint32_t num_samples) {
+    const int sample_rate = state.wav.sample_rate;
+    const uint32_t data_size = num_samples * 2;
+    uint8_t hdr[AUDIO_WAV_HEADER_SIZE];
+    const uint32_t vals[] = {
+        0x46464952, data_size + 36, 0x45564157,     // 'RIFF', size, 'WAVE'
+        0x20746D66, 16, 0x00010001,                 // 'fmt ', size, PCM, mono
+        (uint32_t)sample_rate, (uint32_t)sample_rate * 2, 0x00100002, // rate, bytes/sec, block align, bits
+        0x61746164, data_size,                      // 'data', size
+    };
+    // WAV files are little endian
+    for (size_t i = 0; i < (sizeof(vals) / sizeof(vals[0])); i++) {
+        hdr[i*4 + 0] = (uint8_t)vals[i];
+        hdr[i*4 + 1] = (uint8_t)(vals[i] >> 8);
+        hdr[i*4 + 2] = (uint8_t)(vals[i] >> 16);
+        hdr[i*4 + 3] = (uint8_t)(vals[i] >> 24);
+    }
+    fseek(state.wav.fp, 0, SEEK_SET);
+    fwrite(hdr, sizeof(hdr), 1, state.wav.fp);
+    fseek(state.wav.fp, 0, SEEK_END);
+}
+
+static void audio_wav_write(const float* samples, int num_samples) {
+    while (num_samples > 0) {
+        const int num = (num_samples < AUDIO_WAV_CHUNK_SIZE) ? num_samples : AUDIO_WAV_CHUNK_SIZE;
+        for (int i = 0; i < num; i++) {
+            float s = samples[i];
+            s = (s > 1.0f) ? 1.0f : ((s < -1.0f) ? -1.0f : s);
+            state.wav.chunk[i] = (int16_t)(s * 32767.0f);
+        }
+        fwrite(state.wav.chunk, sizeof(int16_t), (size_t)num, state.wav.fp);
+        state.wav.num_samples += (uint32_t)num;
+        samples += num;
+        num_samples -= num;
+    }
+}
+
+void audio_init(const audio_desc_t* desc) {
+    assert(desc);
+    assert(!state.valid);
+    memset(&state, 0, sizeof(state));
+    state.valid = true;
+    uint32_t ring_frames = 1;
+    while (ring_frames < (uint32_t)AUDIO_DEF(desc->ring_frames, 8192)) {
+        ring_frames <<= 1;
+    }
+    state.ring = calloc(ring_frames, sizeof(float));
+    assert(state.ring);
+    state.ring_mask = ring_frames - 1;
+    state.batch_frames = (uint32_t)AUDIO_DEF(desc->batch_frames, 256);
+    if (state.batch_frames > (ring_frames / 4)) {
+        state.batch_frames = ring_frames / 4;
+    }
+    state.prefill_frames = (uint32_t)AUDIO_DEF(desc->prefill_frames, 2048);
+    if (state.prefill_frames > ring_frames) {
+        state.prefill_frames = ring_frames;
+    }
+    state.prefilling = true;
+    saudio_setup(&(saudio_desc){
+        .stream_cb = audio_stream_cb,
+        .logger.func = slog_func,
+    });
+    if (desc->wav_path && desc->wav_path[0]) {
+        state.wav.fp = fopen(desc->wav_path, "wb");
+        if (state.wav.fp) {
+            state.wav.sample_rate = saudio_sample_rate();
+            audio_wav_write_header(0);
+        } else {
+            fprintf(stderr, "audio: failed to open '%s'\n", desc->wav_path);
+        }
+    }
+}
+
+void audio_shutdown(void) {
+    if (!state.valid) {
+        return;
+    }
+    // stops the audio thread before the ring is freed
+    saudio_shutdown();
+    if (state.wav.fp) {
+        audio_wav_write_header(state.wav.num_samples);
+        fclose(state.wav.fp);
+    }
+    free(state.ring);
+    memset(&state, 0, sizeof(state));
+}
+
+void audio_push(const float* samples, int num_samples) {
+    assert(state.valid && samples && (num_samples >= 0));
+    // the WAV file gets all samples, also in warp mode
+    if (state.wav.fp) {
+        audio_wav_write(samples, num_samples);
+    }
+    if (state.suspended) {
+        return;
+    }
+    if (!saudio_isvalid()) {
+        // no audio device, the ring would never be drained
+        return;
+    }
+    const uint32_t write_pos = state.write_pos;
+    const uint32_t used = write_pos - audio_load_acquire(&state.read_pos);
+    const uint32_t free_frames = (state.ring_mask + 1) - used - state.pending;
+    uint32_t num = (uint32_t)num_samples;
+    if (num > free_frames) {
+        num = free_frames;
+        audio_increment(&state.num_overruns);
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        state.ring[(write_pos + state.pending + i) & state.ring_mask] = samples[i];
+    }
+    state.pending += num;
+    if (state.pending >= state.batch_frames) {
+        audio_store_release(&state.write_pos, write_pos + state.pending);
+        state.pending = 0;
+    }
+}
+
+void audio_suspend(bool suspend) {
+    // NOTE: systems without audio don't call audio_init()
+    if (state.valid && (suspend != (state.suspended != 0))) {
+        // samples which haven't been handed to the audio thread yet are dropped
+        state.pending = 0;
+        audio_store_release(&state.suspended, suspend ? 1 : 0);
+    }
+}
+
+audio_stats_t audio_stats(void) {
+    audio_stats_t stats;
+    memset(&stats, 0, sizeof(stats));
+    if (state.valid) {
+        stats.num_underruns = audio_load_acquire(&state.num_underruns);
+        stats.num_overruns = audio_load_acquire(&state.num_overruns);
+        stats.fill_frames = (int)(audio_load_acquire(&state.write_pos) - audio_load_acquire(&state.read_pos));
+    }
+    return stats;
+}
@@ -0,0 +1,60 @@
+#pragma once
+/*
+    Audio output for the example emulators.
+
+    The emulated systems call their audio callback from inside the tick
+    loop in small chunks. Instead of passing each chunk to saudio_push()
+    (which takes a lock shared with the audio thread for every call),
+    audio_push() writes the samples into a lock-free single-producer /
+    single-consumer ring buffer. The written samples are only handed
+    over to the audio thread in batches (one atomic store per batch),
+    and sokol-audio's stream callback on the audio thread reads them
+    from the ring.
+
+    The ring also measures audio glitches:
+
+    - an underrun happens when the audio thread needs more samples than
+      are in the ring (the missing samples are played as silence, and
+      playback restarts once desc.prefill_frames are buffered again)
+    - an overrun happens when the emulator pushes more samples than fit
+      into the ring (the samples which don't fit are dropped)
+
+    Optionally all pushed samples are also written to a WAV file (16-bit
+    mono), this also works when there's no audio device (e.g. headless
+    runs on a build machine).
+*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+typedef struct {
+    int ring_frames;        // ring buffer capacity in samples, rounded up to pow2 (default: 8192)
+    int batch_frames;       // samples collected before they are handed to the audio thread (default: 256)
+    int prefill_frames;     // samples buffered before playback (re-)starts (default: 2048)
+    const char* wav_path;   // optionally write all samples to a WAV file (0 or empty string: don't)
+} audio_desc_t;
+
+typedef struct {
+    uint32_t num_underruns;     // number of times the audio thread found the ring empty
+    uint32_t num_overruns;      // number of times the ring was full when pushing samples
+    int fill_frames;            // current number of samples in the ring
+} audio_stats_t;
+
+// setup sokol-audio and the ring buffer
+void audio_init(const audio_desc_t* desc);
+// shutdown sokol-audio, and finish the WAV file
+void audio_shutdown(void);
+// push mono samples, call from the emulator's audio callback
+void audio_push(const float* samples, int num_samples);
+// while suspended, pushed samples only go into the WAV file, and the audio thread plays silence
+// without counting underruns (e.g. in warp mode, or while fast-forwarding through the system boot)
+void audio_suspend(bool suspend);
+// get the underrun/overrun counters
+audio_stats_t audio_stats(void);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
@@ -0,0 +1,462 @@
+#include "base64.h"
+#include <assert.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define BASE64_X86 (1)
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+    #if defined(__GNUC__) || defined(__clang__)
+        #define BASE64_TARGET(t) __attribute__((target(t)))
+    #else
+        #define BASE64_TARGET(t)
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    // vqtbl4q_u8() is only available on ARM64
+    #define BASE64_NEON (1)
+    #include <arm_neon.h>
+#endif
+
+// marks a character which is not in the alphabet in the decoder table
+#define BASE64_INVALID (0x80)
+
+typedef struct {
+    base64_impl_t impl;
+} base64_state_t;
+static base64_state_t state;
+
+static const char base64_enc_table[65] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// BASE64_INVALID for '=' and characters outside the alphabet
+static const uint8_t base64_dec_table[256] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3E, 0x80, 0x80, 0x80, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+#if defined(BASE64_X86)
+static bool base64_cpu_supports(base64_impl_t impl) {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        const int num_ids = info[0];
+        __cpuid(info, 1);
+        const bool ssse3 = 0 != (info[2] & (1<<9));
+        if (impl == BASE64_IMPL_SSSE3) {
+            return ssse3;
+        }
+        // AVX2 also needs the OS to save the YMM registers
+        const bool osxsave = 0 != (info[2] & (1<<27));
+        if (!osxsave || (num_ids < 7) || ((_xgetbv(0) & 6) != 6)) {
+            return false;
+        }
+        __cpuidex(info, 7, 0);
+        return 0 != (info[1] & (1<<5));
+    #else
+        __builtin_cpu_init();
+        if (impl == BASE64_IMPL_SSSE3) {
+            return __builtin_cpu_supports("ssse3");
+        }
+        return __builtin_cpu_supports("avx2");
+    #endif
+}
+#endif
+
+static bool base64_supported(base64_impl_t impl) {
+    switch (impl) {
+        case BASE64_IMPL_SCALAR:
+            return true;
+        #if defined(BASE64_X86)
+        case BASE64_IMPL_SSSE3:
+        case BASE64_IMPL_AVX2:
+            return base64_cpu_supports(impl);
+        #endif
+        #if defined(BASE64_NEON)
+        case BASE64_IMPL_NEON:
+            return true;
+        #endif
+        default:
+            return false;
+    }
+}
+
+bool base64_select_impl(base64_impl_t impl) {
+    assert((impl >= 0) && (impl < BASE64_IMPL_NUM));
+    if (impl == BASE64_IMPL_AUTO) {
+        const base64_impl_t prefs[] = { BASE64_IMPL_AVX2, BASE64_IMPL_NEON, BASE64_IMPL_SSSE3 };
+        impl = BASE64_IMPL_SCALAR;
+        for (size_t i = 0; i < (sizeof(prefs) / sizeof(prefs[0])); i++) {
+            if (base64_supported(prefs[i])) {
+                impl = prefs[i];
+                break;
+            }
+        }
+    }
+    else if (!base64_supported(impl)) {
+        return false;
+    }
+    state.impl = impl;
+    return true;
+}
+
+base64_impl_t base64_impl(void) {
+    if (state.impl == BASE64_IMPL_AUTO) {
+        base64_select_impl(BASE64_IMPL_AUTO);
+    }
+    return state.impl;
+}
+
+const char* base64_impl_name(base64_impl_t impl) {
+    switch (impl) {
+        case BASE64_IMPL_AUTO:      return "auto";
+        case BASE64_IMPL_SCALAR:    return "scalar";
+        case BASE64_IMPL_SSSE3:     return "ssse3";
+        case BASE64_IMPL_AVX2:      return "avx2";
+        case BASE64_IMPL_NEON:      return "neon";
+        default:                    return "invalid";
+    }
+}
+
+size_t base64_encoded_size(size_t num_bytes) {
+    return ((num_bytes + 2) / 3) * 4;
+}
+
+size_t base64_decoded_size(size_t num_chars) {
+    return (num_chars / 4) * 3;
+}
+
+//== ENCODER ===================================================================
+
+// the SIMD encoders advance src, dst and num_bytes, and leave a tail for the scalar encoder
+
+static char* base64_enc_scalar(const uint8_t* src, size_t num_bytes, char* dst) {
+    const char* t = base64_enc_table;
+    while (num_bytes >= 3) {
+        const uint32_t v = ((uint32_t)src[0] << 16) | ((uint32_t)src[1] << 8) | src[2];
+        dst[0] = t[(v >> 18) & 63];
+        dst[1] = t[(v >> 12) & 63];
+        dst[2] = t[(v >> 6) & 63];
+        dst[3] = t[v & 63];
+        src += 3;
+        dst += 4;
+        num_bytes -= 3;
+    }
+    if (num_bytes > 0) {
+        const uint32_t v = ((uint32_t)src[0] << 16) | ((num_bytes > 1) ? ((uint32_t)src[1] << 8) : 0);
+        dst[0] = t[(v >> 18) & 63];
+        dst[1] = t[(v >> 12) & 63];
+        dst[2] = (num_bytes > 1) ? t[(v >> 6) & 63] : '=';
+        dst[3] = '=';
+        dst += 4;
+    }
+    return dst;
+}
+
+#if defined(BASE64_X86)
+// The x86 encoders split 12 bytes per 16-byte lane into 16 6-bit indices, and map
+// the indices to ASCII by adding a per-range offset (Wojciech Muła's method).
+#define BASE64_ENC_SHUF 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+#define BASE64_ENC_LUT 'a'-26, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '+'-62, '/'-63, 'A', 0, 0
+
+BASE64_TARGET("ssse3")
+static void base64_enc_ssse3(const uint8_t** src, char** dst, size_t* num_bytes) {
+    const __m128i shuf = _mm_setr_epi8(BASE64_ENC_SHUF);
+    const __m128i lut = _mm_setr_epi8(BASE64_ENC_LUT);
+    const uint8_t* s = *src;
+    char* d = *dst;
+    size_t n = *num_bytes;
+    // 16-byte loads for 12 bytes of input
+    while (n >= 16) {
+        __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)s), shuf);
+        const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(v, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+        const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+        v = _mm_or_si128(t0, t1);
+        __m128i off = _mm_subs_epu8(v, _mm_set1_epi8(51));
+        off = _mm_or_si128(off, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), v), _mm_set1_epi8(13)));
+        v = _mm_add_epi8(v, _mm_shuffle_epi8(lut, off));
+        _mm_storeu_si128((__m128i*)d, v);
+        s += 12;
+        d += 16;
+        n -= 12;
+    }
+    *src = s;
+    *dst = d;
+    *num_bytes = n;
+}
+
+BASE64_TARGET("avx2")
+static void base64_enc_avx2(const uint8_t** src, char** dst, size_t* num_bytes) {
+    const __m256i shuf = _mm256_setr_epi8(BASE64_ENC_SHUF, BASE64_ENC_SHUF);
+    const __m256i lut = _mm256_setr_epi8(BASE64_ENC_LUT, BASE64_ENC_LUT);
+    const uint8_t* s = *src;
+    char* d = *dst;
+    size_t n = *num_bytes;
+    // two 16-byte loads for 2x12 bytes of input
+    while (n >= 28) {
+        __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)s)), _mm_loadu_si128((const __m128i*)(s + 12)), 1);
+        v = _mm256_shuffle_epi8(v, shuf);
+        const __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(v, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        const __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(v, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        v = _mm256_or_si256(t0, t1);
+        __m256i off = _mm256_subs_epu8(v, _mm256_set1_epi8(51));
+        off = _mm256_or_si256(off, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), v), _mm256_set1_epi8(13)));
+        v = _mm256_add_epi8(v, _mm256_shuffle_epi8(lut, off));
+        _mm256_storeu_si256((__m256i*)d, v);
+        s += 24;
+        d += 32;
+        n -= 24;
+    }
+    *src = s;
+    *dst = d;
+    *num_bytes = n;
+}
+#endif
+
+#if defined(BASE64_NEON)
+static void base64_enc_neon(const uint8_t** src, char** dst, size_t* num_bytes) {
+    const uint8_t* t = (const uint8_t*)base64_enc_table;
+    const uint8x16x4_t lut = {{ vld1q_u8(t), vld1q_u8(t + 16), vld1q_u8(t + 32), vld1q_u8(t + 48) }};
+    const uint8x16_t mask = vdupq_n_u8(63);
+    const uint8_t* s = *src;
+    char* d = *dst;
+    size_t n = *num_bytes;
+    // deinterleave 16 3-byte blocks, and interleave 16 4-char blocks
+    while (n >= 48) {
+        const uint8x16x3_t in = vld3q_u8(s);
+        uint8x16x4_t out;
+        out.val[0] = vshrq_n_u8(in.val[0], 2);
+        out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+        out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+        out.val[3] = vandq_u8(in.val[2], mask);
+        for (int i = 0; i < 4; i++) {
+            out.val[i] = vqtbl4q_u8(lut, out.val[i]);
+        }
+        vst4q_u8((uint8_t*)d, out);
+        s += 48;
+        d += 64;
+        n -= 48;
+    }
+    *src = s;
+    *dst = d;
+    *num_bytes = n;
+}
+#endif
+
+size_t base64_encode(const uint8_t* src, size_t num_bytes, char* dst) {
+    assert((src || (num_bytes == 0)) && dst);
+    const base64_impl_t impl = base64_impl();
+    char* d = dst;
+    #if defined(BASE64_X86)
+        if (impl == BASE64_IMPL_AVX2) {
+            base64_enc_avx2(&src, &d, &num_bytes);
+        }
+        if ((impl == BASE64_IMPL_AVX2) || (impl == BASE64_IMPL_SSSE3)) {
+            base64_enc_ssse3(&src, &d, &num_bytes);
+        }
+    #elif defined(BASE64_NEON)
+        if (impl == BASE64_IMPL_NEON) {
+            base64_enc_neon(&src, &d, &num_bytes);
+        }
+    #else
+        (void)impl;
+    #endif
+    d = base64_enc_scalar(src, num_bytes, d);
+    return (size_t)(d - dst);
+}
+
+//== DECODER ===================================================================
+
+// The SIMD decoders only handle blocks without padding and characters outside
+// the alphabet, and stop before the first such block. They advance src, dst and
+// num_chars, the scalar decoder takes it from there.
+
+typedef struct {
+    const char* src;
+    size_t num_chars;
+    uint8_t* dst;
+} base64_dec_t;
+
+static bool base64_dec_scalar(base64_dec_t* dec) {
+    const uint8_t* t = base64_dec_table;
+    const uint8_t* s = (const uint8_t*)dec->src;
+    const uint8_t* end = s + dec->num_chars;
+    uint8_t* d = dec->dst;
+    uint8_t block[4];
+    int count = 0;
+    int pad = 0;
+    for (; s < end; s++) {
+        uint8_t c = *s;
+        uint8_t v = t[c];
+        if (c == '=') {
+            v = 0;
+            pad++;
+        }
+        else if (v == BASE64_INVALID) {
+            continue;
+        }
+        block[count++] = v;
+        if (count == 4) {
+            count = 0;
+            d[0] = (uint8_t)((block[0] << 2) | (block[1] >> 4));
+            d[1] = (uint8_t)((block[1] << 4) | (block[2] >> 2));
+            d[2] = (uint8_t)((block[2] << 6) | block[3]);
+            d += 3;
+            if (pad > 0) {
+                if (pad > 2) {
+                    return false;
+                }
+                d -= pad;
+                s++;
+                break;
+            }
+        }
+    }
+    // the padded block must be followed by a multiple of 4 valid characters
+    for (; s < end; s++) {
+        if ((*s == '=') || (t[*s] != BASE64_INVALID)) {
+            count++;
+        }
+    }
+    dec->src = (const char*)s;
+    dec->num_chars = 0;
+    dec->dst = d;
+    return 0 == (count & 3);
+}
+
+#if defined(BASE64_X86)
+// The x86 decoders validate and translate the characters with lookup tables indexed
+// by the high and low nibbles, and pack 4 6-bit values into 3 bytes, 12 bytes per
+// 16-byte lane (Wojciech Muła's method).
+#define BASE64_DEC_LUT_LO 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A
+#define BASE64_DEC_LUT_HI 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+#define BASE64_DEC_LUT_ROLL 0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0
+#define BASE64_DEC_PACK 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+
+BASE64_TARGET("ssse3")
+static void base64_dec_ssse3(base64_dec_t* dec) {
+    const __m128i lut_lo = _mm_setr_epi8(BASE64_DEC_LUT_LO);
+    const __m128i lut_hi = _mm_setr_epi8(BASE64_DEC_LUT_HI);
+    const __m128i lut_roll = _mm_setr_epi8(BASE64_DEC_LUT_ROLL);
+    const __m128i pack = _mm_setr_epi8(BASE64_DEC_PACK);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    // 16-byte stores for 12 bytes of output, stay within base64_decoded_size()
+    while (dec->num_chars >= 24) {
+        __m128i v = _mm_loadu_si128((const __m128i*)dec->src);
+        const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(v, 4), nibble_mask);
+        const __m128i lo_nibbles = _mm_and_si128(v, nibble_mask);
+        const __m128i err = _mm_and_si128(_mm_shuffle_epi8(lut_lo, lo_nibbles), _mm_shuffle_epi8(lut_hi, hi_nibbles));
+        if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(err, _mm_setzero_si128()))) {
+            break;
+        }
+        const __m128i eq_slash = _mm_cmpeq_epi8(v, _mm_set1_epi8('/'));
+        v = _mm_add_epi8(v, _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_slash, hi_nibbles)));
+        v = _mm_madd_epi16(_mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+        v = _mm_shuffle_epi8(v, pack);
+        _mm_storeu_si128((__m128i*)dec->dst, v);
+        dec->src += 16;
+        dec->num_chars -= 16;
+        dec->dst += 12;
+    }
+}
+
+BASE64_TARGET("avx2")
+static void base64_dec_avx2(base64_dec_t* dec) {
+    const __m256i lut_lo = _mm256_setr_epi8(BASE64_DEC_LUT_LO, BASE64_DEC_LUT_LO);
+    const __m256i lut_hi = _mm256_setr_epi8(BASE64_DEC_LUT_HI, BASE64_DEC_LUT_HI);
+    const __m256i lut_roll = _mm256_setr_epi8(BASE64_DEC_LUT_ROLL, BASE64_DEC_LUT_ROLL);
+    const __m256i pack = _mm256_setr_epi8(BASE64_DEC_PACK, BASE64_DEC_PACK);
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    // 32-byte stores for 24 bytes of output, stay within base64_decoded_size()
+    while (dec->num_chars >= 44) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)dec->src);
+        const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(v, 4), nibble_mask);
+        const __m256i lo_nibbles = _mm256_and_si256(v, nibble_mask);
+        const __m256i err = _mm256_and_si256(_mm256_shuffle_epi8(lut_lo, lo_nibbles), _mm256_shuffle_epi8(lut_hi, hi_nibbles));
+        if (-1 != _mm256_movemask_epi8(_mm256_cmpeq_epi8(err, _mm256_setzero_si256()))) {
+            break;
+        }
+        const __m256i eq_slash = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('/'));
+        v = _mm256_add_epi8(v, _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_slash, hi_nibbles)));
+        v = _mm256_madd_epi16(_mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+        v = _mm256_shuffle_epi8(v, pack);
+        // move the 12 bytes of the upper lane next to the lower lane
+        v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm256_storeu_si256((__m256i*)dec->dst, v);
+        dec->src += 32;
+        dec->num_chars -= 32;
+        dec->dst += 24;
+    }
+}
+#endif
+
+#if defined(BASE64_NEON)
+static void base64_dec_neon(base64_dec_t* dec) {
+    // the decoder table for the characters 0..127
+    const uint8_t* t = base64_dec_table;
+    const uint8x16x4_t lut_lo = {{ vld1q_u8(t), vld1q_u8(t + 16), vld1q_u8(t + 32), vld1q_u8(t + 48) }};
+    const uint8x16x4_t lut_hi = {{ vld1q_u8(t + 64), vld1q_u8(t + 80), vld1q_u8(t + 96), vld1q_u8(t + 112) }};
+    const uint8x16_t offset = vdupq_n_u8(64);
+    // deinterleave 16 4-char blocks, and interleave 16 3-byte blocks
+    while (dec->num_chars >= 64) {
+        uint8x16x4_t in = vld4q_u8((const uint8_t*)dec->src);
+        uint8x16_t err = vdupq_n_u8(0);
+        for (int i = 0; i < 4; i++) {
+            const uint8x16_t c = in.val[i];
+            // characters >= 128 are out of range for both lookups and would map to 0
+            uint8x16_t v = vqtbx4q_u8(vqtbl4q_u8(lut_lo, c), lut_hi, vsubq_u8(c, offset));
+            err = vorrq_u8(err, vorrq_u8(v, c));
+            in.val[i] = v;
+        }
+        // both BASE64_INVALID and characters >= 128 have bit 7 set
+        if (vmaxvq_u8(err) & 0x80) {
+            break;
+        }
+        uint8x16x3_t out;
+        out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+        vst3q_u8(dec->dst, out);
+        dec->src += 64;
+        dec->num_chars -= 64;
+        dec->dst += 48;
+    }
+}
+#endif
+
+bool base64_decode(const char* src, size_t num_chars, uint8_t* dst, size_t* out_num_bytes) {
+    assert((src || (num_chars == 0)) && dst && out_num_bytes);
+    const base64_impl_t impl = base64_impl();
+    base64_dec_t dec = { .src = src, .num_chars = num_chars, .dst = dst };
+    #if defined(BASE64_X86)
+        if (impl == BASE64_IMPL_AVX2) {
+            base64_dec_avx2(&dec);
+        }
+        if ((impl == BASE64_IMPL_AVX2) || (impl == BASE64_IMPL_SSSE3)) {
+            base64_dec_ssse3(&dec);
+        }
+    #elif defined(BASE64_NEON)
+        if (impl == BASE64_IMPL_NEON) {
+            base64_dec_neon(&dec);
+        }
+    #else
+        (void)impl;
+    #endif
+    const bool ok = base64_dec_scalar(&dec);
+    *out_num_bytes = (size_t)(dec.dst - dst);
+    // empty input is an error
+    return ok && (*out_num_bytes > 0);
+}
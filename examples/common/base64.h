@@ -0,0 +1,55 @@
+#pragma once
+/*
+    Base64 encoder and decoder (standard alphabet with '=' padding).
+
+    Used for the prg= URL arg payloads in fs.c and for the pixel data
+    sent by the Kitty terminal frontend (examples/ascii/c64-kitty.c).
+
+    There are SIMD paths for SSSE3 and AVX2 (selected at runtime by CPU
+    feature detection) and for NEON on ARM64, and a scalar fallback which
+    is also used for the tail of the data. All implementations produce
+    the same output.
+
+    The encoder doesn't insert line breaks and doesn't zero-terminate
+    the output. The decoder skips characters which are not in the base64
+    alphabet (e.g. whitespace and line breaks), decoding stops after the
+    first padded 4-character block.
+
+    For testing and benchmarking a specific implementation can be selected
+    with base64_select_impl(), see tests/base64-bench.c.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+typedef enum {
+    BASE64_IMPL_AUTO,       // the fastest supported implementation
+    BASE64_IMPL_SCALAR,
+    BASE64_IMPL_SSSE3,
+    BASE64_IMPL_AVX2,
+    BASE64_IMPL_NEON,
+    BASE64_IMPL_NUM,
+} base64_impl_t;
+
+// number of characters written by base64_encode() for num_bytes of input
+size_t base64_encoded_size(size_t num_bytes);
+// max number of bytes written by base64_decode() for num_chars of input
+size_t base64_decoded_size(size_t num_chars);
+// encode num_bytes into dst (with room for base64_encoded_size() chars), returns number of chars written
+size_t base64_encode(const uint8_t* src, size_t num_bytes, char* dst);
+// decode num_chars into dst (with room for base64_decoded_size() bytes), returns false on invalid input
+bool base64_decode(const char* src, size_t num_chars, uint8_t* dst, size_t* out_num_bytes);
+// select the implementation, returns false if it isn't supported on this CPU
+bool base64_select_impl(base64_impl_t impl);
+// get the currently selected implementation (never BASE64_IMPL_AUTO)
+base64_impl_t base64_impl(void);
+// get a human-readable implementation name
+const char* base64_impl_name(base64_impl_t impl);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
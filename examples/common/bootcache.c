@@ -0,0 +1,83 @@
+#include "chips/chips_common.h"
+#include "bootcache.h"
+#include "audio.h"
+#include "clock.h"
+#include "fs.h"
+#include "snapfile.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h> // malloc/free
+
+// emulated time per exec call while booting
+#define BOOTCACHE_SLICE_US (16667)
+
+// FNV-1a
+static uint64_t bootcache_hash(uint64_t hash, const void* ptr, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)ptr;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+static bool bootcache_load(const bootcache_desc_t* desc, const char* name, chips_range_t snapshot) {
+    chips_range_t data = fs_load_cache(name);
+    if (0 == data.ptr) {
+        return false;
+    }
+    snapfile_info_t info;
+    bool ok = snapfile_read_info(data, desc->system_name, &info)
+        && (info.snapshot_version == desc->snapshot_version)
+        && (info.snapshot_size == snapshot.size)
+        && snapfile_decode(data, snapshot)
+        && desc->load_snapshot(snapshot.ptr);
+    fs_free_cache(data);
+    if (!ok) {
+        fprintf(stderr, "bootcache: ignoring invalid cache file '%s'\n", name);
+    }
+    return ok;
+}
+
+static void bootcache_save(const bootcache_desc_t* desc, const char* name, chips_range_t snapshot) {
+    desc->save_snapshot(snapshot.ptr);
+    chips_range_t data = snapfile_encode(&(snapfile_desc_t){
+        .system_name = desc->system_name,
+        .snapshot_version = desc->snapshot_version,
+        .snapshot = snapshot,
+    });
+    // NOTE: failing is expected on the web
+    fs_save_cache(name, data);
+    snapfile_free(data);
+}
+
+bool bootcache_boot(const bootcache_desc_t* desc) {
+    assert(desc && desc->system_name);
+    assert(desc->snapshot_size > 0);
+    assert(desc->save_snapshot && desc->load_snapshot && desc->exec);
+
+    // scratch buffer for saving, hashing and decoding snapshots
+    const chips_range_t snapshot = { .ptr = malloc(desc->snapshot_size), .size = desc->snapshot_size };
+    assert(snapshot.ptr);
+
+    // the cache key is the initial system state, this includes the ROM images
+    desc->save_snapshot(snapshot.ptr);
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    hash = bootcache_hash(hash, &desc->snapshot_version, sizeof(desc->snapshot_version));
+    hash = bootcache_hash(hash, &desc->boot_frames, sizeof(desc->boot_frames));
+    hash = bootcache_hash(hash, snapshot.ptr, snapshot.size);
+    char name[64];
+    snprintf(name, sizeof(name), "%s_boot_%016llx", desc->system_name, (unsigned long long)hash);
+
+    const bool cached = bootcache_load(desc, name, snapshot);
+    if (!cached) {
+        audio_suspend(true);
+        for (uint32_t i = 0; i < desc->boot_frames; i++) {
+            desc->exec(BOOTCACHE_SLICE_US);
+        }
+        audio_suspend(false);
+        bootcache_save(desc, name, snapshot);
+    }
+    free(snapshot.ptr);
+    clock_advance((uint64_t)desc->boot_frames * BOOTCACHE_SLICE_US);
+    return cached;
+}
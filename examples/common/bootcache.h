@@ -0,0 +1,53 @@
+#pragma once
+/*
+    Skip the ROM boot sequence of the example emulators.
+
+    After a cold start, the emulators run the system's ROM boot code in
+    real time, and files are only loaded into the system once it had
+    enough time to reach the BASIC or OS prompt (the load delay, a few
+    seconds on some systems).
+
+    bootcache_boot() is called once after the system has been initialized
+    and brings it into the booted state right away:
+
+    - a snapshot of the freshly initialized system is hashed, so that
+      the hash covers the ROM images, the system model and configuration
+      and the snapshot version
+    - if a cached snapshot file for this hash exists, it is loaded
+      into the system
+    - otherwise the system is run headless at full speed for the boot
+      duration (with audio output suspended), and a snapshot of the
+      booted system is written to the cache
+
+    Either way the boot duration is added to the emulator clock (see
+    clock_advance()), so that the load delay has already passed and
+    files are loaded in the first frame.
+
+    Cache files are stored in the temp directory with the snapfile.h
+    format. On the web there's no synchronous storage, so the system is
+    always booted at full speed.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+typedef struct {
+    const char* system_name;            // e.g. "c64"
+    uint32_t snapshot_version;          // e.g. C64_SNAPSHOT_VERSION
+    size_t snapshot_size;               // size of a system snapshot in bytes
+    uint32_t boot_frames;               // boot duration in 60 Hz frames
+    void (*save_snapshot)(void* dst);   // save a system snapshot into dst
+    bool (*load_snapshot)(void* src);   // load a system snapshot from src
+    void (*exec)(uint32_t micro_seconds);   // run the system
+} bootcache_desc_t;
+
+// bring the system into the booted state, returns true if the booted state was loaded from the cache
+bool bootcache_boot(const bootcache_desc_t* desc);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
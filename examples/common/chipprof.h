@@ -0,0 +1,389 @@
+#pragma once
+/*
+    chipprof.h -- opt-in per-chip cost breakdown for system tick loops.
+
+    Wraps the tick functions of individual chips and attributes host time
+    and call counts to each chip. Since the system tick loops live in the
+    chips headers, the wrapping is done by renaming the chip tick functions
+    with a macro after the chip headers have been included, but before the
+    system header implementation is included:
+
+        #define CHIPS_IMPL
+        #include "chips/m6502.h"
+        #include "chips/m6569.h"
+        ...
+        #include "systems/c1541.h"
+        #define CHIPPROF_IMPL   // in exactly one source file
+        #define CHIPPROF_WRAP_M6502
+        #define CHIPPROF_WRAP_M6569
+        #define CHIPPROF_WRAP_C1541
+        #include "chipprof.h"
+        #include "systems/c64.h"
+
+    Only tick calls *after* the include are counted, so if chipprof.h is
+    included after c1541.h, the 1541's own CPU and VIAs show up as a
+    single inclusive C1541 entry instead of being mixed into the C64's
+    M6502 and M6522 counts.
+
+    Call chipprof_begin_frame() and chipprof_end_frame() around each
+    *_exec() call, time spent in the system tick outside of wrapped chips
+    (memory mapping, glue logic, ...) is reported as 'other'.
+
+    Results can be printed as a table (chipprof_print_table()) or written
+    as Chrome trace event JSON which can be loaded into
+    chrome://tracing or https://ui.perfetto.dev (chipprof_write_trace()).
+    Each traced frame has a 'frame' slice with the chip costs of that
+    frame laid out back-to-back as child slices.
+
+    NOTE: the timing overhead per tick is significant (a TSC read on x86,
+    otherwise a clock query), so absolute numbers are inflated, use the
+    relative cost between chips.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include "sokol_time.h"
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define CHIPPROF_HAS_TSC (1)
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <x86intrin.h>
+    #define CHIPPROF_HAS_TSC (1)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CHIPPROF_MAX_TRACE_FRAMES (60 * 60 * 2)
+
+typedef enum {
+    CHIPPROF_CHIP_M6502,
+    CHIPPROF_CHIP_Z80,
+    CHIPPROF_CHIP_M6569,
+    CHIPPROF_CHIP_M6561,
+    CHIPPROF_CHIP_M6581,
+    CHIPPROF_CHIP_AY38910,
+    CHIPPROF_CHIP_M6526,
+    CHIPPROF_CHIP_M6522,
+    CHIPPROF_CHIP_C1541,
+    CHIPPROF_CHIP_NUM,
+} chipprof_chip_t;
+
+typedef struct {
+    uint64_t calls;
+    uint64_t counts;    // raw timer counts, see chipprof_counts_to_ns()
+} chipprof_counter_t;
+
+typedef struct {
+    uint64_t start;     // raw timer counts
+    uint64_t counts;    // raw timer counts, total frame time
+    uint64_t chip_counts[CHIPPROF_CHIP_NUM];
+} chipprof_frame_t;
+
+typedef struct {
+    bool valid;
+    uint64_t calib_stm_start;
+    uint64_t calib_raw_start;
+    uint64_t frame_start;
+    uint64_t total_counts;
+    uint64_t num_frames;
+    chipprof_counter_t chips[CHIPPROF_CHIP_NUM];
+    chipprof_counter_t frame_begin_chips[CHIPPROF_CHIP_NUM];
+    chipprof_frame_t last_frame;
+    int num_trace_frames;
+    chipprof_frame_t* trace_frames;
+} chipprof_state_t;
+extern chipprof_state_t chipprof_state;
+
+// initialize and allocate the trace buffer, call once at startup
+void chipprof_init(void);
+// free the trace buffer
+void chipprof_shutdown(void);
+// clear all counters and the trace buffer
+void chipprof_reset(void);
+// call before and after each *_exec() call
+void chipprof_begin_frame(void);
+void chipprof_end_frame(void);
+// name of a chip
+const char* chipprof_chip_name(chipprof_chip_t chip);
+// convert raw timer counts to nanoseconds
+double chipprof_counts_to_ns(uint64_t counts);
+// cost of a chip in the last completed frame in milliseconds
+double chipprof_last_frame_ms(chipprof_chip_t chip);
+// format per-chip cost of the last frame as one line of text (e.g. for status bars)
+void chipprof_format_last_frame(char* buf, size_t buf_size);
+// print accumulated per-chip cost as table
+void chipprof_print_table(FILE* fp, const char* title);
+// write traced frames as Chrome trace event JSON
+bool chipprof_write_trace(const char* path, const char* process_name);
+
+static inline uint64_t chipprof_now(void) {
+    #if defined(CHIPPROF_HAS_TSC)
+        return __rdtsc();
+    #else
+        return stm_now();
+    #endif
+}
+
+static inline void chipprof_add(chipprof_chip_t chip, uint64_t start) {
+    chipprof_counter_t* c = &chipprof_state.chips[chip];
+    c->counts += chipprof_now() - start;
+    c->calls++;
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/*-- tick function wrappers --------------------------------------------------*/
+#if defined(CHIPPROF_WRAP_M6502)
+static inline uint64_t chipprof_m6502_tick(m6502_t* cpu, uint64_t pins) {
+    const uint64_t t0 = chipprof_now();
+    pins = m6502_tick(cpu, pins);
+    chipprof_add(CHIPPROF_CHIP_M6502, t0);
+    return pins;
+}
+#define m6502_tick chipprof_m6502_tick
+#endif
+
+#if defined(CHIPPROF_WRAP_Z80)
+static inline uint64_t chipprof_z80_tick(z80_t* cpu, uint64_t pins) {
+    const uint64_t t0 = chipprof_now();
+    pins = z80_tick(cpu, pins);
+    chipprof_add(CHIPPROF_CHIP_Z80, t0);
+    return pins;
+}
+#define z80_tick chipprof_z80_tick
+#endif
+
+#if defined(CHIPPROF_WRAP_M6569)
+static inline uint64_t chipprof_m6569_tick(m6569_t* vic, uint64_t pins) {
+    const uint64_t t0 = chipprof_now();
+    pins = m6569_tick(vic, pins);
+    chipprof_add(CHIPPROF_CHIP_M6569, t0);
+    return pins;
+}
+#define m6569_tick chipprof_m6569_tick
+#endif
+
+#if defined(CHIPPROF_WRAP_M6561)
+static inline uint64_t chipprof_m6561_tick(m6561_t* vic, uint64_t pins) {
+    const uint64_t t0 = chipprof_now();
+    pins = m6561_tick(vic, pins);
+    chipprof_add(CHIPPROF_CHIP_M6561, t0);
+    return pins;
+}
+#define m6561_tick chipprof_m6561_tick
+#endif
+
+#if defined(CHIPPROF_WRAP_M6581)
+static inline uint64_t chipprof_m6581_tick(m6581_t* sid, uint64_t pins) {
+    const uint64_t t0 = chipprof_now();
+    pins = m6581_tick(sid, pins);
+    chipprof_add(CHIPPROF_CHIP_M6581, t0);
+    return pins;
+}
+#define m6581_tick chipprof_m6581_tick
+#endif
+
+#if defined(CHIPPROF_WRAP_AY38910)
+static inline uint64_t chipprof_ay38910_tick(ay38910_t* ay, uint64_t pins) {
+    const uint64_t t0 = chipprof_now();
+    pins = ay38910_tick(ay, pins);
+    chipprof_add(CHIPPROF_CHIP_AY38910, t0);
+    return pins;
+}
+#define ay38910_tick chipprof_ay38910_tick
+#endif
+
+#if defined(CHIPPROF_WRAP_M6526)
+static inline uint64_t chipprof_m6526_tick(m6526_t* cia, uint64_t pins) {
+    const uint64_t t0 = chipprof_now();
+    pins = m6526_tick(cia, pins);
+    chipprof_add(CHIPPROF_CHIP_M6526, t0);
+    return pins;
+}
+#define m6526_tick chipprof_m6526_tick
+#endif
+
+#if defined(CHIPPROF_WRAP_M6522)
+static inline uint64_t chipprof_m6522_tick(m6522_t* via, uint64_t pins) {
+    const uint64_t t0 = chipprof_now();
+    pins = m6522_tick(via, pins);
+    chipprof_add(CHIPPROF_CHIP_M6522, t0);
+    return pins;
+}
+#define m6522_tick chipprof_m6522_tick
+#endif
+
+#if defined(CHIPPROF_WRAP_C1541)
+static inline void chipprof_c1541_tick(c1541_t* sys) {
+    const uint64_t t0 = chipprof_now();
+    c1541_tick(sys);
+    chipprof_add(CHIPPROF_CHIP_C1541, t0);
+}
+#define c1541_tick chipprof_c1541_tick
+#endif
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#if defined(CHIPPROF_IMPL)
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+chipprof_state_t chipprof_state;
+
+void chipprof_init(void) {
+    memset(&chipprof_state, 0, sizeof(chipprof_state));
+    stm_setup();
+    chipprof_state.valid = true;
+    chipprof_state.trace_frames = (chipprof_frame_t*) calloc(CHIPPROF_MAX_TRACE_FRAMES, sizeof(chipprof_frame_t));
+    chipprof_reset();
+}
+
+void chipprof_shutdown(void) {
+    assert(chipprof_state.valid);
+    free(chipprof_state.trace_frames);
+    memset(&chipprof_state, 0, sizeof(chipprof_state));
+}
+
+void chipprof_reset(void) {
+    assert(chipprof_state.valid);
+    memset(chipprof_state.chips, 0, sizeof(chipprof_state.chips));
+    memset(&chipprof_state.last_frame, 0, sizeof(chipprof_state.last_frame));
+    chipprof_state.total_counts = 0;
+    chipprof_state.num_frames = 0;
+    chipprof_state.num_trace_frames = 0;
+    chipprof_state.calib_stm_start = stm_now();
+    chipprof_state.calib_raw_start = chipprof_now();
+}
+
+void chipprof_begin_frame(void) {
+    assert(chipprof_state.valid);
+    memcpy(chipprof_state.frame_begin_chips, chipprof_state.chips, sizeof(chipprof_state.chips));
+    chipprof_state.frame_start = chipprof_now();
+}
+
+void chipprof_end_frame(void) {
+    assert(chipprof_state.valid);
+    chipprof_frame_t* frame = &chipprof_state.last_frame;
+    frame->start = chipprof_state.frame_start;
+    frame->counts = chipprof_now() - chipprof_state.frame_start;
+    for (int i = 0; i < CHIPPROF_CHIP_NUM; i++) {
+        frame->chip_counts[i] = chipprof_state.chips[i].counts - chipprof_state.frame_begin_chips[i].counts;
+    }
+    chipprof_state.total_counts += frame->counts;
+    chipprof_state.num_frames++;
+    if (chipprof_state.trace_frames && (chipprof_state.num_trace_frames < CHIPPROF_MAX_TRACE_FRAMES)) {
+        chipprof_state.trace_frames[chipprof_state.num_trace_frames++] = *frame;
+    }
+}
+
+const char* chipprof_chip_name(chipprof_chip_t chip) {
+    switch (chip) {
+        case CHIPPROF_CHIP_M6502:   return "m6502";
+        case CHIPPROF_CHIP_Z80:     return "z80";
+        case CHIPPROF_CHIP_M6569:   return "m6569";
+        case CHIPPROF_CHIP_M6561:   return "m6561";
+        case CHIPPROF_CHIP_M6581:   return "m6581";
+        case CHIPPROF_CHIP_AY38910: return "ay38910";
+        case CHIPPROF_CHIP_M6526:   return "m6526";
+        case CHIPPROF_CHIP_M6522:   return "m6522";
+        case CHIPPROF_CHIP_C1541:   return "c1541";
+        default:                    return "???";
+    }
+}
+
+double chipprof_counts_to_ns(uint64_t counts) {
+    assert(chipprof_state.valid);
+    #if defined(CHIPPROF_HAS_TSC)
+        // calibrate the TSC against sokol-time over the whole profiling session
+        const double elapsed_ns = stm_ns(stm_since(chipprof_state.calib_stm_start));
+        const uint64_t elapsed_raw = chipprof_now() - chipprof_state.calib_raw_start;
+        if (elapsed_raw == 0) {
+            return 0.0;
+        }
+        return (double)counts * (elapsed_ns / (double)elapsed_raw);
+    #else
+        return stm_ns(counts);
+    #endif
+}
+
+double chipprof_last_frame_ms(chipprof_chip_t chip) {
+    assert(chipprof_state.valid);
+    assert((chip >= 0) && (chip < CHIPPROF_CHIP_NUM));
+    return chipprof_counts_to_ns(chipprof_state.last_frame.chip_counts[chip]) / 1000000.0;
+}
+
+void chipprof_format_last_frame(char* buf, size_t buf_size) {
+    assert(chipprof_state.valid && buf && (buf_size > 0));
+    buf[0] = 0;
+    size_t pos = 0;
+    for (int i = 0; (i < CHIPPROF_CHIP_NUM) && (pos < buf_size); i++) {
+        if (chipprof_state.chips[i].calls == 0) {
+            continue;
+        }
+        int res = snprintf(buf + pos, buf_size - pos, "%s%s:%.2fms", (pos > 0) ? " " : "",
+            chipprof_chip_name((chipprof_chip_t)i), chipprof_last_frame_ms((chipprof_chip_t)i));
+        if (res < 0) {
+            break;
+        }
+        pos += (size_t)res;
+    }
+}
+
+void chipprof_print_table(FILE* fp, const char* title) {
+    assert(chipprof_state.valid && fp);
+    const double total_ns = chipprof_counts_to_ns(chipprof_state.total_counts);
+    fprintf(fp, "== chip cost breakdown: %s (%"PRIu64" frames, %.3f ms)\n", title, chipprof_state.num_frames, total_ns / 1000000.0);
+    fprintf(fp, "  %-8s %14s %12s %10s %8s\n", "chip", "calls", "total ms", "ns/call", "%");
+    uint64_t chip_counts = 0;
+    for (int i = 0; i < CHIPPROF_CHIP_NUM; i++) {
+        const chipprof_counter_t* c = &chipprof_state.chips[i];
+        if (c->calls == 0) {
+            continue;
+        }
+        chip_counts += c->counts;
+        const double ns = chipprof_counts_to_ns(c->counts);
+        fprintf(fp, "  %-8s %14"PRIu64" %12.3f %10.2f %7.1f%%\n",
+            chipprof_chip_name((chipprof_chip_t)i), c->calls, ns / 1000000.0, ns / (double)c->calls,
+            (total_ns > 0.0) ? (ns * 100.0) / total_ns : 0.0);
+    }
+    const uint64_t other_counts = (chipprof_state.total_counts > chip_counts) ? chipprof_state.total_counts - chip_counts : 0;
+    const double other_ns = chipprof_counts_to_ns(other_counts);
+    fprintf(fp, "  %-8s %14s %12.3f %10s %7.1f%%\n", "other", "-", other_ns / 1000000.0, "-", (total_ns > 0.0) ? (other_ns * 100.0) / total_ns : 0.0);
+}
+
+bool chipprof_write_trace(const char* path, const char* process_name) {
+    assert(chipprof_state.valid && path && process_name);
+    FILE* fp = fopen(path, "w");
+    if (!fp) {
+        return false;
+    }
+    fprintf(fp, "{\"traceEvents\":[\n");
+    fprintf(fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"%s\"}}", process_name);
+    // timestamps and durations are in micro-seconds, relative to the first traced frame
+    const uint64_t base = (chipprof_state.num_trace_frames > 0) ? chipprof_state.trace_frames[0].start : 0;
+    for (int frame_index = 0; frame_index < chipprof_state.num_trace_frames; frame_index++) {
+        const chipprof_frame_t* frame = &chipprof_state.trace_frames[frame_index];
+        double ts = chipprof_counts_to_ns(frame->start - base) / 1000.0;
+        fprintf(fp, ",\n{\"name\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%d}}",
+            ts, chipprof_counts_to_ns(frame->counts) / 1000.0, frame_index);
+        for (int i = 0; i < CHIPPROF_CHIP_NUM; i++) {
+            if (frame->chip_counts[i] == 0) {
+                continue;
+            }
+            const double dur = chipprof_counts_to_ns(frame->chip_counts[i]) / 1000.0;
+            fprintf(fp, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+                chipprof_chip_name((chipprof_chip_t)i), ts, dur);
+            ts += dur;
+        }
+    }
+    fprintf(fp, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    fclose(fp);
+    return true;
+}
+#endif // CHIPPROF_IMPL
@@ -1,23 +1,72 @@
 #include "sokol_app.h"
+#include "sokol_time.h"
 #include "clock.h"
+#include "movie.h"
 #include <assert.h>
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
 
 typedef struct {
     bool valid;
     uint64_t cur_time;
+    uint64_t offset_time;       // emulated time outside the frame loop, see clock_advance()
+    struct {
+        volatile uint32_t mode;     // a clock_warp_t, clock_warp() is also called from the main thread
+        uint64_t frame_start;       // host time at start of current frame
+        uint32_t frame_emu_us;      // emulated time in current frame
+        uint32_t idle_us;           // accumulated emulated idle time
+        bool loading;               // last loading state passed into clock_auto_warp()
+        float speed;
+    } warp;
 } clock_state_t;
 static clock_state_t state;
 
+#if defined(_WIN32)
+static uint32_t clock_load_acquire(volatile uint32_t* ptr) {
+    return (uint32_t)InterlockedCompareExchange((volatile LONG*)ptr, 0, 0);
+}
+static void clock_store_release(volatile uint32_t* ptr, uint32_t val) {
+    InterlockedExchange((volatile LONG*)ptr, (LONG)val);
+}
+#else
+static uint32_t clock_load_acquire(volatile uint32_t* ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+static void clock_store_release(volatile uint32_t* ptr, uint32_t val) {
+    __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+}
+#endif
+
 void clock_init(void) {
     state = (clock_state_t) {
         .valid = true,
         .cur_time = 0,
+        .warp.speed = 1.0f,
     };
 }
 
+uint32_t clock_host_frame_time(void) {
+    return (uint32_t) (sapp_frame_duration() * 1000000.0);
+}
+
 uint32_t clock_frame_time(void) {
+    return clock_frame_time_host(clock_host_frame_time());
+}
+
+uint32_t clock_frame_time_host(uint32_t host_frame_us) {
     assert(state.valid);
-    uint32_t frame_time_us = (uint32_t) (sapp_frame_duration() * 1000000.0);
+    uint32_t frame_time_us = host_frame_us;
+    if (state.warp.mode != CLOCK_WARP_OFF) {
+        // emulated time of the previous frame vs real frame duration
+        if ((frame_time_us > 0) && (state.warp.frame_emu_us > 0)) {
+            state.warp.speed = (float)state.warp.frame_emu_us / (float)frame_time_us;
+        }
+        state.warp.frame_start = stm_now();
+        state.warp.frame_emu_us = CLOCK_WARP_SLICE_US;
+        frame_time_us = CLOCK_WARP_SLICE_US;
+    }
     // prevent death-spiral on host systems that are too slow to emulate
     // in real time, or during long frames (e.g. debugging)
     if (frame_time_us > 24000) {
@@ -29,5 +78,65 @@ uint32_t clock_frame_time(void) {
 
 uint32_t clock_frame_count_60hz(void) {
     assert(state.valid);
-    return (uint32_t) (state.cur_time / 16667);
+    // during movie replay the emulated time comes from the movie, so that
+    // delayed actions (like loading files) happen at the same tick
+    const uint64_t cur_time = state.offset_time + (movie_replaying() ? movie_time_us() : state.cur_time);
+    return (uint32_t) (cur_time / 16667);
+}
+
+void clock_advance(uint64_t micro_seconds) {
+    assert(state.valid);
+    state.offset_time += micro_seconds;
+}
+
+void clock_set_warp(clock_warp_t mode) {
+    assert(state.valid);
+    clock_store_release(&state.warp.mode, (uint32_t)mode);
+    state.warp.frame_emu_us = 0;
+    state.warp.idle_us = 0;
+    state.warp.speed = 1.0f;
+}
+
+void clock_toggle_warp(void) {
+    clock_set_warp((state.warp.mode == CLOCK_WARP_OFF) ? CLOCK_WARP_ON : CLOCK_WARP_OFF);
+}
+
+bool clock_warp(void) {
+    // NOTE: don't assert on valid here, gfx.c also calls this
+    return clock_load_acquire(&state.warp.mode) != CLOCK_WARP_OFF;
+}
+
+void clock_auto_warp(bool loading) {
+    assert(state.valid);
+    // only start on the rising edge, so that the user can switch
+    // warp mode off in the middle of a load
+    if (loading && !state.warp.loading && (state.warp.mode == CLOCK_WARP_OFF)) {
+        clock_set_warp(CLOCK_WARP_AUTO);
+    }
+    state.warp.loading = loading;
+}
+
+bool clock_warp_next(bool idle) {
+    assert(state.valid);
+    if (state.warp.mode == CLOCK_WARP_OFF) {
+        return false;
+    }
+    if (state.warp.mode == CLOCK_WARP_AUTO) {
+        state.warp.idle_us = idle ? (state.warp.idle_us + CLOCK_WARP_SLICE_US) : 0;
+        if (state.warp.idle_us >= CLOCK_WARP_IDLE_US) {
+            clock_set_warp(CLOCK_WARP_OFF);
+            return false;
+        }
+    }
+    if (stm_us(stm_since(state.warp.frame_start)) >= (double)CLOCK_WARP_BUDGET_US) {
+        return false;
+    }
+    state.cur_time += CLOCK_WARP_SLICE_US;
+    state.warp.frame_emu_us += CLOCK_WARP_SLICE_US;
+    return true;
+}
+
+float clock_warp_speed(void) {
+    assert(state.valid);
+    return state.warp.speed;
 }
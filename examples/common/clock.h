@@ -1,6 +1,68 @@
 #pragma once
+/*
+    Frame timing for the example emulators.
+
+    Warp mode:
+
+    In warp mode the emulator runs unthrottled: instead of once per
+    frame with the real frame duration, the emulator's exec function is
+    called repeatedly with a fixed 60 Hz slice of emulated time until a
+    host time budget for the current frame is used up:
+
+        state.frame_time_us = clock_frame_time();
+        do {
+            state.ticks = xxx_exec(&state.sys, state.frame_time_us);
+            handle_file_loading();
+            send_keybuf_input();
+        } while (clock_warp_next(is_idle()));
+
+    Outside warp mode clock_warp_next() always returns false, so the
+    loop body runs exactly once per frame.
+
+    Warp mode is either toggled by the user (CLOCK_WARP_ON), or started
+    with the 'warp' command line arg (CLOCK_WARP_AUTO), in which case the
+    emulator switches back to real time once it has been idle (e.g. no
+    more keyboard input and tape motor off) for a short while.
+
+    Emulators with tape or disk drives also call clock_auto_warp() once
+    per frame, this starts CLOCK_WARP_AUTO whenever the drive starts
+    loading, so that long tape loads run at warp speed too.
+*/
 #include <stdint.h>
+#include <stdbool.h>
+
+typedef enum {
+    CLOCK_WARP_OFF,
+    CLOCK_WARP_ON,      // fast-forward until switched off
+    CLOCK_WARP_AUTO,    // fast-forward until the emulator is idle
+} clock_warp_t;
+
+// emulated time per exec call in warp mode
+#define CLOCK_WARP_SLICE_US (16667)
+// host time budget per frame in warp mode
+#define CLOCK_WARP_BUDGET_US (12000)
+// emulated idle time until CLOCK_WARP_AUTO switches back to real time
+#define CLOCK_WARP_IDLE_US (1000000)
 
 void clock_init(void);
+// emulated time for the current frame, derived from the host frame duration
 uint32_t clock_frame_time(void);
+// same, but with an explicit host frame duration (e.g. on the emulation thread, see emuthread.h)
+uint32_t clock_frame_time_host(uint32_t host_frame_us);
+// the host frame duration in microseconds
+uint32_t clock_host_frame_time(void);
 uint32_t clock_frame_count_60hz(void);
+// account for emulated time which passed outside the frame loop (e.g. a fast-forwarded system boot)
+void clock_advance(uint64_t micro_seconds);
+// set the warp mode
+void clock_set_warp(clock_warp_t mode);
+// toggle warp mode on/off (bound to a key in the emulators)
+void clock_toggle_warp(void);
+// return true if currently in warp mode
+bool clock_warp(void);
+// call once per frame before clock_frame_time(), starts auto-warp when loading starts
+void clock_auto_warp(bool loading);
+// call after each exec, returns true if another slice should be run in this frame
+bool clock_warp_next(bool idle);
+// ratio of emulated to host time in the last frame (1.0 when not in warp mode)
+float clock_warp_speed(void);
@@ -6,10 +6,17 @@
 #include "sokol_time.h"
 #include "sokol_debugtext.h"
 #include "sokol_log.h"
+#include "audio.h"
+#include "bootcache.h"
 #include "clock.h"
+#include "emuthread.h"
 #include "prof.h"
 #include "fs.h"
 #include "gfx.h"
 #include "keybuf.h"
 #include "webapi.h"
+#include "rewind.h"
+#include "snapfile.h"
+#include "movie.h"
 #include <ctype.h> // isupper, islower, toupper, tolower
+#include <stdlib.h> // atoi
@@ -0,0 +1,375 @@
+#include "sokol_time.h"
+#include "emuthread.h"
+#include "clock.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h> // malloc/free
+#include <string.h>
+#if defined(__EMSCRIPTEN__)
+#define EMUTHREAD_NO_THREADS (1)
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+#define EMUTHREAD_DEF(v,def) (v?v:def)
+#define EMUTHREAD_INPUT_QUEUE_SIZE (256)    // must be pow2
+#define EMUTHREAD_NUM_SLOTS (3)
+#define EMUTHREAD_SLOT_MASK (3)
+#define EMUTHREAD_FRESH (4)                 // set in the middle index when it holds an unseen frame
+// when the scheduler is this many frames behind it doesn't try to catch up anymore
+#define EMUTHREAD_MAX_LAG_FRAMES (4)
+// the last stretch before a frame deadline is spent yielding instead of sleeping
+#define EMUTHREAD_SPIN_US (1000.0)
+
+typedef struct {
+    chips_display_info_t info;      // the frame buffer and palette pointers point to the copies below
+    uint8_t* pixels;
+    size_t pixels_size;
+    uint8_t* palette;
+    size_t palette_size;
+} emuthread_slot_t;
+
+typedef struct {
+    bool valid;
+    bool running;
+    int frame_hz;
+    void (*frame_cb)(uint32_t host_frame_us);
+    void (*input_cb)(const sapp_event* event);
+    chips_display_info_t (*display_info_cb)(void);
+    volatile uint32_t stop;
+    volatile uint32_t lock_requests;
+    // input queue, head is only written by the main thread, tail only by the emulation thread
+    struct {
+        volatile uint32_t head;
+        volatile uint32_t tail;
+        sapp_event events[EMUTHREAD_INPUT_QUEUE_SIZE];
+    } input;
+    // triple buffer, back is owned by the emulation thread, front by the main thread
+    struct {
+        emuthread_slot_t slots[EMUTHREAD_NUM_SLOTS];
+        uint32_t back;
+        uint32_t front;
+        volatile uint32_t middle;
+    } frames;
+    volatile uint32_t num_frames;
+    volatile uint32_t num_resyncs;
+    volatile uint32_t num_dropped_events;
+    #if defined(_WIN32)
+    HANDLE thread;
+    HANDLE timer;
+    SRWLOCK lock;
+    #elif !defined(EMUTHREAD_NO_THREADS)
+    pthread_t thread;
+    pthread_mutex_t lock;
+    #endif
+} emuthread_state_t;
+static emuthread_state_t state;
+
+#if defined(_WIN32)
+static uint32_t emuthread_load_acquire(volatile uint32_t* ptr) {
+    return (uint32_t)InterlockedCompareExchange((volatile LONG*)ptr, 0, 0);
+}
+static void emuthread_store_release(volatile uint32_t* ptr, uint32_t val) {
+    InterlockedExchange((volatile LONG*)ptr, (LONG)val);
+}
+static uint32_t emuthread_exchange(volatile uint32_t* ptr, uint32_t val) {
+    return (uint32_t)InterlockedExchange((volatile LONG*)ptr, (LONG)val);
+}
+static void emuthread_add(volatile uint32_t* ptr, int32_t val) {
+    InterlockedExchangeAdd((volatile LONG*)ptr, (LONG)val);
+}
+#else
+static uint32_t emuthread_load_acquire(volatile uint32_t* ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+static void emuthread_store_release(volatile uint32_t* ptr, uint32_t val) {
+    __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+}
+static uint32_t emuthread_exchange(volatile uint32_t* ptr, uint32_t val) {
+    return __atomic_exchange_n(ptr, val, __ATOMIC_ACQ_REL);
+}
+static void emuthread_add(volatile uint32_t* ptr, int32_t val) {
+    __atomic_fetch_add(ptr, (uint32_t)val, __ATOMIC_ACQ_REL);
+}
+#endif
+
+#if !defined(EMUTHREAD_NO_THREADS)
+
+static void emuthread_slot_copy(emuthread_slot_t* slot, const chips_display_info_t* info) {
+    slot->info = *info;
+    if (info->frame.buffer.ptr) {
+        assert(info->frame.buffer.size <= slot->pixels_size);
+        memcpy(slot->pixels, info->frame.buffer.ptr, info->frame.buffer.size);
+        slot->info.frame.buffer.ptr = slot->pixels;
+    }
+    if (info->palette.ptr) {
+        assert(info->palette.size <= slot->palette_size);
+        memcpy(slot->palette, info->palette.ptr, info->palette.size);
+        slot->info.palette.ptr = slot->palette;
+    }
+}
+
+static void emuthread_yield(void) {
+    #if defined(_WIN32)
+        SwitchToThread();
+    #else
+        sched_yield();
+    #endif
+}
+
+static void emuthread_sleep_us(double us) {
+    #if defined(_WIN32)
+        // a high-resolution waitable timer, Sleep() has a granularity of up to 16ms
+        LARGE_INTEGER due;
+        due.QuadPart = -(LONGLONG)(us * 10.0);
+        if (state.timer && SetWaitableTimer(state.timer, &due, 0, 0, 0, FALSE)) {
+            WaitForSingleObject(state.timer, INFINITE);
+        } else {
+            Sleep((DWORD)(us / 1000.0));
+        }
+    #else
+        const uint64_t ns = (uint64_t)(us * 1000.0);
+        const struct timespec ts = {
+            .tv_sec = (time_t)(ns / 1000000000),
+            .tv_nsec = (long)(ns % 1000000000),
+        };
+        nanosleep(&ts, 0);
+    #endif
+}
+
+static void emuthread_wait_until(double deadline_us) {
+    while (true) {
+        const double remaining_us = deadline_us - stm_us(stm_now());
+        if (remaining_us <= 0.0) {
+            return;
+        }
+        if (remaining_us > EMUTHREAD_SPIN_US) {
+            emuthread_sleep_us(remaining_us - EMUTHREAD_SPIN_US);
+        } else {
+            emuthread_yield();
+        }
+    }
+}
+
+static void emuthread_mutex_lock(void) {
+    #if defined(_WIN32)
+        AcquireSRWLockExclusive(&state.lock);
+    #else
+        pthread_mutex_lock(&state.lock);
+    #endif
+}
+
+static void emuthread_mutex_unlock(void) {
+    #if defined(_WIN32)
+        ReleaseSRWLockExclusive(&state.lock);
+    #else
+        pthread_mutex_unlock(&state.lock);
+    #endif
+}
+
+static void emuthread_drain_input(void) {
+    const uint32_t head = emuthread_load_acquire(&state.input.head);
+    uint32_t tail = state.input.tail;
+    while (tail != head) {
+        state.input_cb(&state.input.events[tail & (EMUTHREAD_INPUT_QUEUE_SIZE - 1)]);
+        tail++;
+    }
+    emuthread_store_release(&state.input.tail, tail);
+}
+
+static void emuthread_publish(void) {
+    const chips_display_info_t info = state.display_info_cb();
+    emuthread_slot_copy(&state.frames.slots[state.frames.back], &info);
+    // hand the back buffer to the main thread, and continue with the previous middle buffer
+    state.frames.back = emuthread_exchange(&state.frames.middle, state.frames.back | EMUTHREAD_FRESH) & EMUTHREAD_SLOT_MASK;
+}
+
+static void emuthread_run(void) {
+    const double period_us = 1000000.0 / (double)state.frame_hz;
+    double deadline_us = stm_us(stm_now());
+    double host_accum_us = 0.0;
+    uint64_t frame_start = stm_now();
+    while (0 == emuthread_load_acquire(&state.stop)) {
+        uint32_t host_frame_us;
+        if (clock_warp()) {
+            // run unthrottled, the host frame duration is only used for the warp speed display
+            host_frame_us = (uint32_t)stm_us(stm_diff(stm_now(), frame_start));
+            deadline_us = stm_us(stm_now());
+        } else {
+            emuthread_wait_until(deadline_us);
+            const double now_us = stm_us(stm_now());
+            if ((now_us - deadline_us) > (EMUTHREAD_MAX_LAG_FRAMES * period_us)) {
+                // the host was busy or suspended, don't try to catch up
+                deadline_us = now_us;
+                emuthread_add(&state.num_resyncs, 1);
+            }
+            deadline_us += period_us;
+            // carry the fractional microseconds over so that e.g. 60 Hz doesn't drift
+            host_accum_us += period_us;
+            host_frame_us = (uint32_t)host_accum_us;
+            host_accum_us -= host_frame_us;
+        }
+        frame_start = stm_now();
+        // give a waiting emuthread_lock() priority, the mutex isn't fair
+        while (emuthread_load_acquire(&state.lock_requests) > 0) {
+            emuthread_yield();
+        }
+        emuthread_mutex_lock();
+        emuthread_drain_input();
+        state.frame_cb(host_frame_us);
+        emuthread_publish();
+        emuthread_mutex_unlock();
+        emuthread_add(&state.num_frames, 1);
+    }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI emuthread_func(LPVOID arg) {
+    (void)arg;
+    emuthread_run();
+    return 0;
+}
+#else
+static void* emuthread_func(void* arg) {
+    (void)arg;
+    emuthread_run();
+    return 0;
+}
+#endif
+
+#endif // !EMUTHREAD_NO_THREADS
+
+void emuthread_init(const emuthread_desc_t* desc) {
+    assert(desc && desc->frame_cb && desc->input_cb && desc->display_info_cb);
+    assert(!state.valid);
+    memset(&state, 0, sizeof(state));
+    #if defined(EMUTHREAD_NO_THREADS)
+        fprintf(stderr, "emuthread: threads not supported, running on the main thread\n");
+        return;
+    #else
+        state.valid = true;
+        state.frame_hz = EMUTHREAD_DEF(desc->frame_hz, 50);
+        state.frame_cb = desc->frame_cb;
+        state.input_cb = desc->input_cb;
+        state.display_info_cb = desc->display_info_cb;
+        // all three buffers start out with the current frame
+        const chips_display_info_t info = state.display_info_cb();
+        for (int i = 0; i < EMUTHREAD_NUM_SLOTS; i++) {
+            emuthread_slot_t* slot = &state.frames.slots[i];
+            slot->pixels_size = info.frame.buffer.size;
+            slot->pixels = calloc(1, slot->pixels_size + 1);
+            slot->palette_size = info.palette.size;
+            slot->palette = calloc(1, slot->palette_size + 1);
+            assert(slot->pixels && slot->palette);
+            emuthread_slot_copy(slot, &info);
+        }
+        state.frames.back = 0;
+        state.frames.middle = 1;
+        state.frames.front = 2;
+        #if defined(_WIN32)
+            InitializeSRWLock(&state.lock);
+            #if !defined(CREATE_WAITABLE_TIMER_HIGH_RESOLUTION)
+            #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION (0x00000002)
+            #endif
+            state.timer = CreateWaitableTimerExW(0, 0, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+            if (!state.timer) {
+                // not supported before Windows 10 1803
+                state.timer = CreateWaitableTimerExW(0, 0, 0, TIMER_ALL_ACCESS);
+            }
+            state.thread = CreateThread(0, 0, emuthread_func, 0, 0, 0);
+            state.running = (0 != state.thread);
+        #else
+            pthread_mutex_init(&state.lock, 0);
+            state.running = (0 == pthread_create(&state.thread, 0, emuthread_func, 0));
+        #endif
+        if (!state.running) {
+            fprintf(stderr, "emuthread: failed to start the emulation thread, running on the main thread\n");
+        }
+    #endif
+}
+
+void emuthread_shutdown(void) {
+    if (!state.valid) {
+        return;
+    }
+    #if !defined(EMUTHREAD_NO_THREADS)
+        if (state.running) {
+            emuthread_store_release(&state.stop, 1);
+            #if defined(_WIN32)
+                WaitForSingleObject(state.thread, INFINITE);
+                CloseHandle(state.thread);
+            #else
+                pthread_join(state.thread, 0);
+            #endif
+        }
+        #if defined(_WIN32)
+            if (state.timer) {
+                CloseHandle(state.timer);
+            }
+        #else
+            pthread_mutex_destroy(&state.lock);
+        #endif
+    #endif
+    for (int i = 0; i < EMUTHREAD_NUM_SLOTS; i++) {
+        free(state.frames.slots[i].pixels);
+        free(state.frames.slots[i].palette);
+    }
+    memset(&state, 0, sizeof(state));
+}
+
+bool emuthread_running(void) {
+    return state.running;
+}
+
+void emuthread_push_input(const sapp_event* event) {
+    assert(state.running && event);
+    const uint32_t head = state.input.head;
+    if ((head - emuthread_load_acquire(&state.input.tail)) >= EMUTHREAD_INPUT_QUEUE_SIZE) {
+        emuthread_add(&state.num_dropped_events, 1);
+        return;
+    }
+    state.input.events[head & (EMUTHREAD_INPUT_QUEUE_SIZE - 1)] = *event;
+    emuthread_store_release(&state.input.head, head + 1);
+}
+
+chips_display_info_t emuthread_display_info(void) {
+    assert(state.running);
+    if (emuthread_load_acquire(&state.frames.middle) & EMUTHREAD_FRESH) {
+        state.frames.front = emuthread_exchange(&state.frames.middle, state.frames.front) & EMUTHREAD_SLOT_MASK;
+    }
+    return state.frames.slots[state.frames.front].info;
+}
+
+void emuthread_lock(void) {
+    #if !defined(EMUTHREAD_NO_THREADS)
+    if (state.running) {
+        emuthread_add(&state.lock_requests, 1);
+        emuthread_mutex_lock();
+    }
+    #endif
+}
+
+void emuthread_unlock(void) {
+    #if !defined(EMUTHREAD_NO_THREADS)
+    if (state.running) {
+        emuthread_mutex_unlock();
+        emuthread_add(&state.lock_requests, -1);
+    }
+    #endif
+}
+
+emuthread_stats_t emuthread_stats(void) {
+    emuthread_stats_t stats;
+    memset(&stats, 0, sizeof(stats));
+    if (state.running) {
+        stats.num_frames = emuthread_load_acquire(&state.num_frames);
+        stats.num_resyncs = emuthread_load_acquire(&state.num_resyncs);
+        stats.num_dropped_events = emuthread_load_acquire(&state.num_dropped_events);
+    }
+    return stats;
+}
@@ -0,0 +1,115 @@
+#pragma once
+/*
+    Optional emulation thread for the example emulators.
+
+    Normally the emulated system runs inside the sokol-app frame callback,
+    so the emulation is paced by the host's display refresh rate: a slow
+    vsync or a compositor hiccup stalls the emulation, and on a 144 Hz
+    display a 50 Hz system is run in uneven slices.
+
+    When started with the 'thread' command line arg, the emulator runs on
+    its own thread instead, with a fixed-rate scheduler (desc.frame_hz
+    emulated frames per second, independent from the display refresh
+    rate). The threads only share the following:
+
+    - input events are passed from the main thread to the emulation thread
+      through a lock-free single-producer/single-consumer queue, the
+      emulation thread calls desc.input_cb with them before the next frame
+    - finished frames are passed from the emulation thread to the main
+      thread through a lock-free triple buffer: after each frame the
+      emulation thread copies the system's framebuffer and palette into
+      the back buffer and swaps it with the middle buffer, the main thread
+      swaps the middle buffer with its front buffer when there's a new
+      frame, and draws the front buffer, neither thread ever waits
+    - emuthread_lock() / emuthread_unlock() on the main thread wait until
+      the emulation thread is between frames, and keep it there, this is
+      for inspecting the emulated system (e.g. in the status bar)
+    - gfx_draw() on the main thread reads the warp mode with clock_warp()
+      and picks up gfx_flash_success() / gfx_flash_error() requests, both
+      are atomics and may be changed by the emulation thread at any time
+
+    The emulator splits its frame callback into the emulation part which
+    runs on either thread, and the drawing part which stays on the main
+    thread:
+
+        static void emu_frame(uint32_t host_frame_us) {
+            state.frame_time_us = clock_frame_time_host(host_frame_us);
+            do {
+                ...xxx_exec()...
+            } while (clock_warp_next(...));
+        }
+
+        void app_frame(void) {
+            if (emuthread_running()) {
+                emuthread_lock();
+                fs_dowork();
+                draw_status_bar();
+                emuthread_unlock();
+                gfx_draw(emuthread_display_info());
+            } else {
+                fs_dowork();
+                emu_frame(clock_host_frame_time());
+                draw_status_bar();
+                gfx_draw(xxx_display_info(&state.sys));
+            }
+        }
+
+    ...and the input callback passes all events to the emulation thread
+    with emuthread_push_input() while the thread is running, except for
+    SAPP_EVENTTYPE_FILES_DROPPED (the dropped file path can only be
+    queried inside the event callback).
+
+    Everything the emulated system touches (keybuf, rewind, movie
+    recording, audio_push(), picking up loaded files) then happens on
+    the emulation thread. sokol-fetch is not thread-safe and must stay
+    on the thread which called fs_init(), so fs_dowork() and starting
+    new loads happen on the main thread inside emuthread_lock() /
+    emuthread_unlock().
+    The UI debugger inspects the emulated system from the main thread all
+    the time, so the emulation thread isn't available in UI builds, also
+    not on the web (no threads).
+
+    In warp mode the scheduler doesn't sleep between frames.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sokol_app.h"
+#include "chips/chips_common.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+typedef struct {
+    int frame_hz;                               // emulated frames per second (default: 50)
+    void (*frame_cb)(uint32_t host_frame_us);   // run one frame of emulation
+    void (*input_cb)(const sapp_event* event);  // handle an input event
+    chips_display_info_t (*display_info_cb)(void);  // get the emulator's current display info
+} emuthread_desc_t;
+
+typedef struct {
+    uint32_t num_frames;        // number of emulated frames
+    uint32_t num_resyncs;       // number of times the scheduler fell too far behind and skipped ahead
+    uint32_t num_dropped_events;    // number of input events dropped because the queue was full
+} emuthread_stats_t;
+
+// start the emulation thread (does nothing when threads are not supported)
+void emuthread_init(const emuthread_desc_t* desc);
+// stop and join the emulation thread
+void emuthread_shutdown(void);
+// return true if the emulation thread is running
+bool emuthread_running(void);
+// pass an input event to the emulation thread
+void emuthread_push_input(const sapp_event* event);
+// get the latest finished frame, valid until the next call
+chips_display_info_t emuthread_display_info(void);
+// wait until the emulation thread is between frames and keep it there
+void emuthread_lock(void);
+// let the emulation thread continue
+void emuthread_unlock(void);
+// get the scheduler statistics
+emuthread_stats_t emuthread_stats(void);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
@@ -3,23 +3,29 @@
 #include "sokol_log.h"
 #include "chips/chips_common.h"
 #include "fs.h"
+#include "base64.h"
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 #include <ctype.h>
 #include <stdio.h>
-#include <stdalign.h>
 #include <stdarg.h>
 #if defined(__EMSCRIPTEN__)
 #include <emscripten/emscripten.h>
 #endif
 #if defined(WIN32)
 #include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 #define FS_EXT_SIZE (16)
 #define FS_PATH_SIZE (2048)
-#define FS_MAX_SIZE (2024 * 1024)
+// max size of files fetched via HTTP on the web (native platforms have no limit)
+#define FS_WEB_MAX_SIZE (2024 * 1024)
 
 typedef struct {
     char cstr[FS_PATH_SIZE];
@@ -28,15 +34,28 @@ typedef struct {
 
 typedef struct {
     size_t snapshot_index;
+    bool header_only;
     fs_snapshot_load_callback_t callback;
+    uint8_t* buf;   // native: the fetch buffer, freed when the request is finished
 } fs_snapshot_load_context_t;
 
+// a memory-mapped file (native platforms only)
+typedef struct {
+    void* ptr;
+    size_t size;
+    #if defined(WIN32)
+    HANDLE mapping;
+    #endif
+} fs_mapping_t;
+
 typedef struct {
     fs_path_t path;
     fs_result_t result;
+    // the loaded data, a view into either the heap buffer or the file mapping
     uint8_t* ptr;
     size_t size;
-    alignas(64) uint8_t buf[FS_MAX_SIZE + 1];
+    uint8_t* heap;
+    fs_mapping_t mapping;
 } fs_channel_state_t;
 
 typedef struct {
@@ -113,6 +132,33 @@ static void fs_path_extract_extension(fs_path_t* path, char* buf, size_t buf_siz
     }
 }
 
+#if !defined(__EMSCRIPTEN__)
+static void fs_win32_posix_unmap_file(fs_mapping_t* mapping);
+#endif
+
+// allocate the channel's heap buffer with room for a terminating zero
+static uint8_t* fs_channel_alloc(fs_channel_state_t* channel, size_t size) {
+    assert(0 == channel->heap);
+    channel->heap = calloc(1, size + 1);
+    assert(channel->heap);
+    return channel->heap;
+}
+
+// free the channel's heap buffer or file mapping
+static void fs_channel_release(fs_channel_state_t* channel) {
+    if (channel->heap) {
+        free(channel->heap);
+        channel->heap = 0;
+    }
+    #if !defined(__EMSCRIPTEN__)
+    if (channel->mapping.ptr) {
+        fs_win32_posix_unmap_file(&channel->mapping);
+    }
+    #endif
+    channel->ptr = 0;
+    channel->size = 0;
+}
+
 fs_result_t fs_result(fs_channel_t chn) {
     assert(state.valid);
     assert(chn < FS_CHANNEL_NUM);
@@ -143,70 +189,6 @@ chips_range_t fs_data(fs_channel_t chn) {
     }
 }
 
-// http://web.mit.edu/freebsd/head/contrib/wpa/src/utils/base64.c
-static const unsigned char fs_base64_table[65] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-static bool fs_base64_decode(fs_channel_state_t* channel, const char* src) {
-    int len = (int)strlen(src);
-
-    uint8_t dtable[256];
-    memset(dtable, 0x80, sizeof(dtable));
-    for (int i = 0; i < (int)sizeof(fs_base64_table)-1; i++) {
-        dtable[fs_base64_table[i]] = (uint8_t)i;
-    }
-    dtable['='] = 0;
-
-    int count = 0;
-    for (int i = 0; i < len; i++) {
-        if (dtable[(int)src[i]] != 0x80) {
-            count++;
-        }
-    }
-
-    // input length must be multiple of 4
-    if ((count == 0) || (count & 3)) {
-        return false;
-    }
-
-    // output length
-    int olen = (count / 4) * 3;
-    if (olen >= (int)sizeof(channel->buf)) {
-        return false;
-    }
-
-    // decode loop
-    count = 0;
-    int pad = 0;
-    uint8_t block[4];
-    for (int i = 0; i < len; i++) {
-        uint8_t tmp = dtable[(int)src[i]];
-        if (tmp == 0x80) {
-            continue;
-        }
-        if (src[i] == '=') {
-            pad++;
-        }
-        block[count] = tmp;
-        count++;
-        if (count == 4) {
-            count = 0;
-            channel->buf[channel->size++] = (block[0] << 2) | (block[1] >> 4);
-            channel->buf[channel->size++] = (block[1] << 4) | (block[2] >> 2);
-            channel->buf[channel->size++] = (block[2] << 6) | block[3];
-            if (pad > 0) {
-                if (pad <= 2) {
-                    channel->size -= pad;
-                }
-                else {
-                    // invalid padding
-                    return false;
-                }
-                break;
-            }
-        }
-    }
-    return true;
-}
-
 bool fs_ext(fs_channel_t chn, const char* ext) {
     assert(state.valid);
     assert(chn < FS_CHANNEL_NUM);
@@ -227,8 +209,7 @@ void fs_reset(fs_channel_t chn) {
     fs_channel_state_t* channel = &state.channels[chn];
     fs_path_reset(&channel->path);
     channel->result = FS_RESULT_IDLE;
-    channel->ptr = 0;
-    channel->size = 0;
+    fs_channel_release(channel);
 }
 
 bool fs_load_base64(fs_channel_t chn, const char* name, const char* payload) {
@@ -237,17 +218,22 @@ bool fs_load_base64(fs_channel_t chn, const char* name, const char* payload) {
     fs_reset(chn);
     fs_channel_state_t* channel = &state.channels[chn];
     channel->path = fs_path_printf("%s", name);
-    if (fs_base64_decode(channel, payload)) {
+    const size_t num_chars = strlen(payload);
+    uint8_t* dst = fs_channel_alloc(channel, base64_decoded_size(num_chars));
+    if (base64_decode(payload, num_chars, dst, &channel->size)) {
         channel->result = FS_RESULT_SUCCESS;
-        channel->ptr = channel->buf;
+        channel->ptr = dst;
         return true;
     }
     else {
         channel->result = FS_RESULT_FAILED;
+        fs_channel_release(channel);
         return false;
     }
 }
 
+#if defined(__EMSCRIPTEN__)
+
 static void fs_fetch_callback(const sfetch_response_t* response) {
     assert(state.valid);
     fs_channel_t chn = *(fs_channel_t*)response->user_data;
@@ -257,17 +243,15 @@ static void fs_fetch_callback(const sfetch_response_t* response) {
         channel->result = FS_RESULT_SUCCESS;
         channel->ptr = (uint8_t*)response->data.ptr;
         channel->size = response->data.size;
-        assert(channel->size < sizeof(channel->buf));
-        // in case it's a text file, zero-terminate the data
-        channel->buf[channel->size] = 0;
+        // in case it's a text file, zero-terminate the data (the heap buffer has room for it)
+        channel->ptr[channel->size] = 0;
     }
     else if (response->failed) {
         channel->result = FS_RESULT_FAILED;
+        fs_channel_release(channel);
     }
 }
 
-#if defined(__EMSCRIPTEN__)
-
 EM_JS_DEPS(chips_ini, "$UTF8ToString,$stringToNewUTF8");
 
 EM_JS(void, emsc_js_save_ini, (const char* c_key, const char* c_payload), {
@@ -300,12 +284,12 @@ static void fs_emsc_dropped_file_callback(const sapp_html5_fetch_response* respo
         channel->result = FS_RESULT_SUCCESS;
         channel->ptr = (uint8_t*)response->data.ptr;
         channel->size = response->data.size;
-        assert(channel->size < sizeof(channel->buf));
-        // in case it's a text file, zero-terminate the data
-        channel->buf[channel->size] = 0;
+        // in case it's a text file, zero-terminate the data (the heap buffer has room for it)
+        channel->ptr[channel->size] = 0;
     }
     else {
         channel->result = FS_RESULT_FAILED;
+        fs_channel_release(channel);
     }
 }
 
@@ -314,6 +298,8 @@ EM_JS(void, fs_js_save_snapshot, (const char* system_name_cstr, int snapshot_ind
     const db_store_name = 'store';
     const system_name = UTF8ToString(system_name_cstr);
     console.log('fs_js_save_snapshot: called with', system_name, snapshot_index);
+    // copy the data right away, the caller may free it before the store request runs
+    const blob = HEAPU8.slice(bytes, bytes + num_bytes);
     let open_request;
     try {
         open_request = window.indexedDB.open(db_name, 1);
@@ -332,7 +318,6 @@ EM_JS(void, fs_js_save_snapshot, (const char* system_name_cstr, int snapshot_ind
         const transaction = db.transaction([db_store_name], 'readwrite');
         const file = transaction.objectStore(db_store_name);
         const key = system_name + '_' + snapshot_index;
-        const blob = HEAPU8.subarray(bytes, bytes + num_bytes);
         const put_request = file.put(blob, key);
         put_request.onsuccess = () => {
             console.log('fs_js_save_snapshot:', key, 'successfully stored')
@@ -458,13 +443,20 @@ static void fs_win32_posix_snapshot_fetch_callback(const sfetch_response_t* resp
                 .size = response->data.size
             }
         });
+        // header-only requests are streamed in chunks, stop after the first chunk
+        if (ctx->header_only && !response->finished) {
+            sfetch_cancel(response->handle);
+        }
     }
-    else if (response->failed) {
+    else if (response->failed && !response->cancelled) {
         callback(&(fs_snapshot_response_t){
             .snapshot_index = snapshot_index,
             .result = FS_RESULT_FAILED,
         });
     }
+    if (response->finished) {
+        free(ctx->buf);
+    }
 }
 
 static bool fs_win32_posix_write_file(fs_path_t path, chips_range_t data) {
@@ -564,6 +556,11 @@ fs_path_t fs_win32_posix_make_snapshot_path(const char* system_name, size_t snap
     return fs_path_printf("%s/chips_%s_snapshot_%zu", tmp_dir.cstr, system_name, snapshot_index);
 }
 
+fs_path_t fs_win32_posix_make_cache_path(const char* name) {
+    fs_path_t tmp_dir = fs_win32_posix_tmp_dir();
+    return fs_path_printf("%s/chips_%s", tmp_dir.cstr, name);
+}
+
 fs_path_t fs_win32_posix_make_ini_path(const char* key) {
     fs_path_t tmp_dir = fs_win32_posix_tmp_dir();
     return fs_path_printf("%s/%s_imgui.ini", tmp_dir.cstr, key);
@@ -574,23 +571,135 @@ bool fs_win32_posix_save_snapshot(const char* system_name, size_t snapshot_index
     return fs_win32_posix_write_file(path, data);
 }
 
-bool fs_win32_posix_load_snapshot_async(const char* system_name, size_t snapshot_index, fs_snapshot_load_callback_t callback) {
+// returns 0 if the file doesn't exist
+static size_t fs_win32_posix_file_size(fs_path_t path) {
+    if (path.clamped) {
+        return 0;
+    }
+    #if defined(WIN32)
+        WCHAR wc_path[FS_PATH_SIZE];
+        WIN32_FILE_ATTRIBUTE_DATA attrs;
+        if (!fs_win32_path_to_wide(&path, wc_path, sizeof(wc_path)) || !GetFileAttributesExW(wc_path, GetFileExInfoStandard, &attrs)) {
+            return 0;
+        }
+        return (size_t)(((uint64_t)attrs.nFileSizeHigh << 32) | attrs.nFileSizeLow);
+    #else
+        struct stat st;
+        if ((0 != stat(path.cstr, &st)) || !S_ISREG(st.st_mode)) {
+            return 0;
+        }
+        return (size_t)st.st_size;
+    #endif
+}
+
+static size_t fs_win32_posix_page_size(void) {
+    #if defined(WIN32)
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return (size_t)info.dwPageSize;
+    #else
+        return (size_t)sysconf(_SC_PAGESIZE);
+    #endif
+}
+
+// Map a file copy-on-write into memory. The bytes after the end of the file up to the
+// end of the last page are zero, so this fails for empty files and files with a size
+// that's a multiple of the page size (which wouldn't be zero-terminated).
+static bool fs_win32_posix_map_file(fs_path_t path, fs_mapping_t* mapping) {
+    assert(mapping && (0 == mapping->ptr));
+    if (path.clamped) {
+        return false;
+    }
+    #if defined(WIN32)
+        WCHAR wc_path[FS_PATH_SIZE];
+        if (!fs_win32_path_to_wide(&path, wc_path, sizeof(wc_path))) {
+            return false;
+        }
+        HANDLE fp = CreateFileW(wc_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (fp == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(fp, &file_size) || (file_size.QuadPart == 0) || ((file_size.QuadPart % fs_win32_posix_page_size()) == 0)) {
+            CloseHandle(fp);
+            return false;
+        }
+        // the mapping object keeps the file open
+        HANDLE map = CreateFileMappingW(fp, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+        CloseHandle(fp);
+        if (NULL == map) {
+            return false;
+        }
+        void* ptr = MapViewOfFile(map, FILE_MAP_COPY, 0, 0, 0);
+        if (NULL == ptr) {
+            CloseHandle(map);
+            return false;
+        }
+        mapping->mapping = map;
+        mapping->ptr = ptr;
+        mapping->size = (size_t)file_size.QuadPart;
+    #else
+        int fd = open(path.cstr, O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if ((0 != fstat(fd, &st)) || !S_ISREG(st.st_mode) || (st.st_size == 0) || (((size_t)st.st_size % fs_win32_posix_page_size()) == 0)) {
+            close(fd);
+            return false;
+        }
+        // the mapping keeps the file open
+        void* ptr = mmap(0, (size_t)st.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (MAP_FAILED == ptr) {
+            return false;
+        }
+        mapping->ptr = ptr;
+        mapping->size = (size_t)st.st_size;
+    #endif
+    return true;
+}
+
+static void fs_win32_posix_unmap_file(fs_mapping_t* mapping) {
+    assert(mapping && mapping->ptr);
+    #if defined(WIN32)
+        UnmapViewOfFile(mapping->ptr);
+        CloseHandle(mapping->mapping);
+    #else
+        munmap(mapping->ptr, mapping->size);
+    #endif
+    memset(mapping, 0, sizeof(fs_mapping_t));
+}
+
+// NOTE: num_bytes == 0 means load the whole snapshot
+bool fs_win32_posix_load_snapshot_async(const char* system_name, size_t snapshot_index, size_t num_bytes, fs_snapshot_load_callback_t callback) {
     assert(system_name && callback);
     fs_path_t path = fs_win32_posix_make_snapshot_path(system_name, snapshot_index);
     if (path.clamped) {
         return false;
     }
+    // the fetch buffer is sized for the request and freed in the response callback,
+    // for a missing file it's never filled, the request fails in the callback
+    size_t buf_size = fs_win32_posix_file_size(path);
+    if ((num_bytes > 0) && (num_bytes < buf_size)) {
+        buf_size = num_bytes;
+    }
+    if (0 == buf_size) {
+        buf_size = 1;
+    }
     fs_snapshot_load_context_t context = {
         .snapshot_index = snapshot_index,
-        .callback = callback
+        .header_only = num_bytes > 0,
+        .callback = callback,
+        .buf = malloc(buf_size),
     };
-    const fs_channel_t chn = FS_CHANNEL_SNAPSHOTS;
-    fs_channel_state_t* channel = &state.channels[chn];
+    assert(context.buf);
     sfetch_send(&(sfetch_request_t){
         .path = path.cstr,
-        .channel = (int)chn,
+        .channel = (int)FS_CHANNEL_SNAPSHOTS,
         .callback = fs_win32_posix_snapshot_fetch_callback,
-        .buffer = { .ptr = channel->buf, .size = FS_MAX_SIZE },
+        .chunk_size = (uint32_t)num_bytes,
+        .buffer = { .ptr = context.buf, .size = buf_size },
         .user_data = { .ptr = &context, .size = sizeof(context) }
     });
     return true;
@@ -603,14 +712,30 @@ void fs_load_file_async(fs_channel_t chn, const char* path) {
     fs_reset(chn);
     fs_channel_state_t* channel = &state.channels[chn];
     channel->path = fs_path_printf("%s", path);
-    channel->result = FS_RESULT_PENDING;
-    sfetch_send(&(sfetch_request_t){
-        .path = path,
-        .channel = chn,
-        .callback = fs_fetch_callback,
-        .buffer = { .ptr = channel->buf, .size = FS_MAX_SIZE },
-        .user_data = { .ptr = &chn, .size = sizeof(chn) },
-    });
+    #if defined(__EMSCRIPTEN__)
+        channel->result = FS_RESULT_PENDING;
+        sfetch_send(&(sfetch_request_t){
+            .path = path,
+            .channel = chn,
+            .callback = fs_fetch_callback,
+            .buffer = { .ptr = fs_channel_alloc(channel, FS_WEB_MAX_SIZE), .size = FS_WEB_MAX_SIZE },
+            .user_data = { .ptr = &chn, .size = sizeof(chn) },
+        });
+    #else
+        // map the file into memory and hand out a view, fall back to reading
+        // it if it can't be mapped zero-terminated
+        if (fs_win32_posix_map_file(channel->path, &channel->mapping)) {
+            channel->ptr = channel->mapping.ptr;
+            channel->size = channel->mapping.size;
+        }
+        else {
+            chips_range_t data = fs_win32_posix_read_file(channel->path, true);
+            channel->heap = data.ptr;
+            channel->ptr = data.ptr;
+            channel->size = data.ptr ? (data.size - 1) : 0;
+        }
+        channel->result = channel->ptr ? FS_RESULT_SUCCESS : FS_RESULT_FAILED;
+    #endif
 }
 
 void fs_load_dropped_file_async(fs_channel_t chn) {
@@ -622,10 +747,11 @@ void fs_load_dropped_file_async(fs_channel_t chn) {
     channel->path = fs_path_printf("%s", path);
     channel->result = FS_RESULT_PENDING;
     #if defined(__EMSCRIPTEN__)
+        const size_t size = (size_t)sapp_html5_get_dropped_file_size(0);
         sapp_html5_fetch_dropped_file(&(sapp_html5_fetch_request){
             .dropped_file_index = 0,
             .callback = fs_emsc_dropped_file_callback,
-            .buffer = { .ptr = channel->buf, .size = FS_MAX_SIZE },
+            .buffer = { .ptr = fs_channel_alloc(channel, size), .size = size },
             .user_data = (void*)(intptr_t)chn,
         });
     #else
@@ -645,7 +771,17 @@ bool fs_load_snapshot_async(const char* system_name, size_t snapshot_index, fs_s
     #if defined(__EMSCRIPTEN__)
     return fs_emsc_load_snapshot_async(system_name, snapshot_index, callback);
     #else
-    return fs_win32_posix_load_snapshot_async(system_name, snapshot_index, callback);
+    return fs_win32_posix_load_snapshot_async(system_name, snapshot_index, 0, callback);
+    #endif
+}
+
+bool fs_load_snapshot_header_async(const char* system_name, size_t snapshot_index, size_t num_bytes, fs_snapshot_load_callback_t callback) {
+    #if defined(__EMSCRIPTEN__)
+    // IndexedDB can't do partial reads
+    (void)num_bytes;
+    return fs_emsc_load_snapshot_async(system_name, snapshot_index, callback);
+    #else
+    return fs_win32_posix_load_snapshot_async(system_name, snapshot_index, num_bytes, callback);
     #endif
 }
 
@@ -676,4 +812,32 @@ void fs_free_ini(const char* payload_or_null) {
         void* payload = (void*)payload_or_null;
         free(payload);
     }
-}
\ No newline at end of file
+}
+
+bool fs_save_cache(const char* name, chips_range_t data) {
+    assert(name && data.ptr);
+    #if defined(__EMSCRIPTEN__)
+    (void)name; (void)data;
+    return false;
+    #else
+    fs_path_t path = fs_win32_posix_make_cache_path(name);
+    return fs_win32_posix_write_file(path, data);
+    #endif
+}
+
+chips_range_t fs_load_cache(const char* name) {
+    assert(name);
+    #if defined(__EMSCRIPTEN__)
+    (void)name;
+    return (chips_range_t){0};
+    #else
+    fs_path_t path = fs_win32_posix_make_cache_path(name);
+    return fs_win32_posix_read_file(path, false);
+    #endif
+}
+
+void fs_free_cache(chips_range_t data) {
+    if (data.ptr) {
+        free(data.ptr);
+    }
+}
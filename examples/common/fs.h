@@ -32,20 +32,28 @@ typedef void (*fs_snapshot_load_callback_t)(const fs_snapshot_response_t* respon
 void fs_init(void);
 void fs_dowork(void);
 void fs_reset(fs_channel_t chn);
+// native platforms map the file into memory (no size limit), the web fetches it via HTTP
 void fs_load_file_async(fs_channel_t chn, const char* path);
 void fs_load_dropped_file_async(fs_channel_t chn);
 bool fs_load_base64(fs_channel_t chn, const char* name, const char* payload);
 bool fs_save_snapshot(const char* system_name, size_t snapshot_index, chips_range_t data);
 bool fs_load_snapshot_async(const char* system_name, size_t snapshot_index, fs_snapshot_load_callback_t callback);
+// only load the first num_bytes of a snapshot (e.g. a header with thumbnail), reads the whole snapshot on the web
+bool fs_load_snapshot_header_async(const char* system_name, size_t snapshot_index, size_t num_bytes, fs_snapshot_load_callback_t callback);
 fs_result_t fs_result(fs_channel_t chn);
 bool fs_success(fs_channel_t chn);
 bool fs_failed(fs_channel_t chn);
 bool fs_pending(fs_channel_t chn);
+// a zero-terminated view of the loaded data, valid until the next fs_reset() or load on the channel
 chips_range_t fs_data(fs_channel_t chn);
 bool fs_ext(fs_channel_t chn, const char* str);
 void fs_save_ini(const char* key, const char* payload);
 const char* fs_load_ini(const char* key);
 void fs_free_ini(const char* payload_or_null);
+// synchronously save and load files in the cache directory (not supported on the web)
+bool fs_save_cache(const char* name, chips_range_t data);
+chips_range_t fs_load_cache(const char* name);
+void fs_free_cache(chips_range_t data);
 
 #if defined(__cplusplus)
 } // extern "C"
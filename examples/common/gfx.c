@@ -10,11 +10,21 @@
 #include "sokol_glue.h"
 #include "chips/chips_common.h"
 #include "gfx.h"
+#include "clock.h"
 #include <assert.h>
 #include <stdlib.h> // malloc/free
 #include <string.h>
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
 
 #define GFX_DEF(v,def) (v?v:def)
+// in warp mode, only upload the emulator framebuffer every Nth display frame
+#define GFX_WARP_UPLOAD_INTERVAL (4)
+// bits in gfx_state_t.flash_requests
+#define GFX_FLASH_SUCCESS (1<<0)
+#define GFX_FLASH_ERROR (1<<1)
 
 typedef struct {
     bool valid;
@@ -30,6 +40,9 @@ typedef struct {
         sgl_pipeline pip;
         chips_dim_t dim;
     } speaker_icon;
+    // gfx_flash_success() and gfx_flash_error() may be called on the emulation
+    // thread (see emuthread.h), gfx_draw() turns the requests into flash counters
+    volatile uint32_t flash_requests;
     int flash_success_count;
     int flash_error_count;
     gfx_draw_extra_t draw_extra_cb;
@@ -37,6 +50,22 @@ typedef struct {
 } gfx_state_t;
 static gfx_state_t state;
 
+#if defined(_WIN32)
+static uint32_t gfx_exchange(volatile uint32_t* ptr, uint32_t val) {
+    return (uint32_t)InterlockedExchange((volatile LONG*)ptr, (LONG)val);
+}
+static void gfx_or(volatile uint32_t* ptr, uint32_t val) {
+    InterlockedOr((volatile LONG*)ptr, (LONG)val);
+}
+#else
+static uint32_t gfx_exchange(volatile uint32_t* ptr, uint32_t val) {
+    return __atomic_exchange_n(ptr, val, __ATOMIC_ACQ_REL);
+}
+static void gfx_or(volatile uint32_t* ptr, uint32_t val) {
+    __atomic_fetch_or(ptr, val, __ATOMIC_ACQ_REL);
+}
+#endif
+
 // a bit-packed speaker-off icon
 static const struct {
     int width;
@@ -103,12 +132,12 @@ static const struct {
 
 void gfx_flash_success(void) {
     assert(state.valid);
-    state.flash_success_count = 20;
+    gfx_or(&state.flash_requests, GFX_FLASH_SUCCESS);
 }
 
 void gfx_flash_error(void) {
     assert(state.valid);
-    state.flash_error_count = 20;
+    gfx_or(&state.flash_requests, GFX_FLASH_ERROR);
 }
 
 void gfx_disable_speaker_icon(void) {
@@ -298,32 +327,44 @@ void gfx_draw(chips_display_info_t display_info) {
         sgl_end();
     }
 
-    // NOTE: resize is lazy, if nothing changed this call is a no-op
-    sfb_resize(state.fb, &(sfb_resize_desc){
-        .width = display_info.frame.dim.width,
-        .height = display_info.frame.dim.height,
-        .prescale = 2,
-        .cliprect = {
-            .x = display_info.screen.x,
-            .y = display_info.screen.y,
-            .width = display_info.screen.width,
-            .height = display_info.screen.height,
-        },
-    });
+    // in warp mode the emulator frame rate is much higher than the display
+    // refresh rate anyway, so don't bother to upload each frame
+    const bool skip_upload = clock_warp() && ((sapp_frame_count() % GFX_WARP_UPLOAD_INTERVAL) != 0);
+    if (!skip_upload) {
+        // NOTE: resize is lazy, if nothing changed this call is a no-op
+        sfb_resize(state.fb, &(sfb_resize_desc){
+            .width = display_info.frame.dim.width,
+            .height = display_info.frame.dim.height,
+            .prescale = 2,
+            .cliprect = {
+                .x = display_info.screen.x,
+                .y = display_info.screen.y,
+                .width = display_info.screen.width,
+                .height = display_info.screen.height,
+            },
+        });
 
-    // update framebuffer pixel, palette and cliprect
-    sfb_update(state.fb, &(sfb_update_desc){
-        .pixels = {
-            .ptr = display_info.frame.buffer.ptr,
-            .size = display_info.frame.buffer.size,
-        },
-        .palette = {
-            .ptr = state.palette,
-            .size = sizeof(state.palette),
-        },
-    });
+        // update framebuffer pixel, palette and cliprect
+        sfb_update(state.fb, &(sfb_update_desc){
+            .pixels = {
+                .ptr = display_info.frame.buffer.ptr,
+                .size = display_info.frame.buffer.size,
+            },
+            .palette = {
+                .ptr = state.palette,
+                .size = sizeof(state.palette),
+            },
+        });
+    }
 
     // tint the clear color red or green if flash feedback is requested
+    const uint32_t flash_requests = gfx_exchange(&state.flash_requests, 0);
+    if (flash_requests & GFX_FLASH_SUCCESS) {
+        state.flash_success_count = 20;
+    }
+    if (flash_requests & GFX_FLASH_ERROR) {
+        state.flash_error_count = 20;
+    }
     if (state.flash_error_count > 0) {
         state.flash_error_count--;
         state.pass_action.colors[0].clear_value.r = 0.7f;
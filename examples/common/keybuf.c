@@ -113,3 +113,8 @@ uint8_t keybuf_get(uint32_t frame_time_us) {
     }
     return c;
 }
+
+bool keybuf_empty(void) {
+    assert(state.valid);
+    return 0 == _keybuf_peek();
+}
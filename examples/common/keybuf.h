@@ -7,6 +7,7 @@
     ${wait:20} - wait 20 frames before continuing
 */
 #include <stdint.h>
+#include <stdbool.h>
 
 typedef struct {
     int key_delay_frames;
@@ -18,3 +19,5 @@ void keybuf_init(const keybuf_desc_t* desc);
 void keybuf_put(const char* text);
 // get next key to feed into emulator, call once per frame, returns 0 if no key to feed
 uint8_t keybuf_get(uint32_t frame_time_us);
+// return true if all keys have been fed into the emulator
+bool keybuf_empty(void);
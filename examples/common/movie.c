@@ -0,0 +1,315 @@
+#include "movie.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h> // malloc/free
+#include <string.h>
+
+#define MOVIE_MAGIC (0x564D4843)    // 'CHMV'
+#define MOVIE_FORMAT_VERSION (1)
+#define MOVIE_NAME_SIZE (16)
+#define MOVIE_INITIAL_CAPACITY (64 * 1024)
+// a varint is at most 10 bytes, an event record at most 1 + 1 + 3 * 10 bytes
+#define MOVIE_MAX_RECORD_SIZE (64)
+
+typedef enum {
+    MOVIE_REC_SLICE = 0,
+    MOVIE_REC_REPEAT = 1,
+    MOVIE_REC_EVENT = 2,
+} movie_rec_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t format_version;
+    char system_name[MOVIE_NAME_SIZE];
+    uint32_t stream_size;
+    uint32_t reserved;
+} movie_header_t;
+
+typedef struct {
+    bool valid;
+    bool recording;
+    bool replaying;
+    char system_name[MOVIE_NAME_SIZE];
+    char record_path[1024];
+    void (*input_cb)(const sapp_event* event);
+    uint64_t tick;              // emulated ticks since start
+    uint64_t time_us;           // emulated time since start
+    uint64_t event_tick;        // tick of the previous event
+    uint32_t slice_us;          // emulated time of the previous exec call
+    uint32_t repeat;            // recording: pending repeats of slice_us, replay: remaining repeats
+    struct {
+        uint8_t* ptr;
+        size_t size;
+        size_t pos;
+    } stream;
+} movie_state_t;
+static movie_state_t state;
+
+static void movie_reserve(size_t num_bytes) {
+    if ((state.stream.pos + num_bytes) > state.stream.size) {
+        state.stream.size = (state.stream.size > 0) ? (state.stream.size * 2) : MOVIE_INITIAL_CAPACITY;
+        state.stream.ptr = realloc(state.stream.ptr, state.stream.size);
+        assert(state.stream.ptr);
+    }
+}
+
+static void movie_put_varint(uint64_t val) {
+    do {
+        uint8_t b = val & 0x7F;
+        val >>= 7;
+        if (val) {
+            b |= 0x80;
+        }
+        state.stream.ptr[state.stream.pos++] = b;
+    } while (val);
+}
+
+static bool movie_get_varint(uint64_t* out_val) {
+    uint64_t val = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (state.stream.pos >= state.stream.size) {
+            return false;
+        }
+        const uint8_t b = state.stream.ptr[state.stream.pos++];
+        val |= (uint64_t)(b & 0x7F) << shift;
+        if (0 == (b & 0x80)) {
+            *out_val = val;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void movie_put_tag(movie_rec_t rec, uint64_t val) {
+    movie_put_varint((val << 2) | rec);
+}
+
+static void movie_flush_repeat(void) {
+    if (state.repeat > 0) {
+        movie_reserve(MOVIE_MAX_RECORD_SIZE);
+        movie_put_tag(MOVIE_REC_REPEAT, state.repeat);
+        state.repeat = 0;
+    }
+}
+
+static bool movie_load(const char* path) {
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        fprintf(stderr, "movie: failed to open '%s'\n", path);
+        return false;
+    }
+    movie_header_t hdr;
+    bool ok = (fread(&hdr, sizeof(hdr), 1, fp) == 1);
+    if (ok && ((hdr.magic != MOVIE_MAGIC) || (hdr.format_version != MOVIE_FORMAT_VERSION))) {
+        fprintf(stderr, "movie: '%s' is not a movie file, or has the wrong version\n", path);
+        ok = false;
+    } else if (ok && (0 != strncmp(hdr.system_name, state.system_name, MOVIE_NAME_SIZE))) {
+        fprintf(stderr, "movie: '%s' was recorded on '%.*s'\n", path, MOVIE_NAME_SIZE, hdr.system_name);
+        ok = false;
+    } else if (ok) {
+        state.stream.size = hdr.stream_size;
+        // +1 so that an empty stream isn't a zero-size allocation
+        state.stream.ptr = malloc(state.stream.size + 1);
+        assert(state.stream.ptr);
+        ok = (fread(state.stream.ptr, 1, state.stream.size, fp) == state.stream.size);
+    }
+    if (!ok) {
+        fprintf(stderr, "movie: failed to load '%s'\n", path);
+    }
+    fclose(fp);
+    return ok;
+}
+
+static void movie_save(const char* path) {
+    movie_flush_repeat();
+    movie_header_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = MOVIE_MAGIC;
+    hdr.format_version = MOVIE_FORMAT_VERSION;
+    memcpy(hdr.system_name, state.system_name, MOVIE_NAME_SIZE);
+    hdr.stream_size = (uint32_t)state.stream.pos;
+    FILE* fp = fopen(path, "wb");
+    bool ok = false;
+    if (fp) {
+        ok = (fwrite(&hdr, sizeof(hdr), 1, fp) == 1);
+        if (ok && (state.stream.pos > 0)) {
+            ok = (fwrite(state.stream.ptr, 1, state.stream.pos, fp) == state.stream.pos);
+        }
+        ok &= (0 == fclose(fp));
+    }
+    if (!ok) {
+        fprintf(stderr, "movie: failed to write '%s'\n", path);
+    }
+}
+
+static void movie_stop_replay(const char* reason) {
+    fprintf(stderr, "movie: %s at tick %llu, live input enabled\n", reason, (unsigned long long)state.tick);
+    state.replaying = false;
+}
+
+void movie_init(const movie_desc_t* desc) {
+    assert(desc && desc->system_name);
+    assert(!state.valid);
+    const bool record = desc->record_path && desc->record_path[0];
+    const bool replay = desc->replay_path && desc->replay_path[0];
+    if (!record && !replay) {
+        return;
+    }
+    memset(&state, 0, sizeof(state));
+    state.valid = true;
+    state.input_cb = desc->input_cb;
+    strncpy(state.system_name, desc->system_name, MOVIE_NAME_SIZE - 1);
+    if (replay) {
+        // a replayed session isn't recorded again
+        assert(desc->input_cb);
+        state.replaying = movie_load(desc->replay_path);
+    } else {
+        strncpy(state.record_path, desc->record_path, sizeof(state.record_path) - 1);
+        state.recording = true;
+    }
+}
+
+void movie_shutdown(void) {
+    if (state.valid) {
+        if (state.recording) {
+            movie_save(state.record_path);
+        }
+        free(state.stream.ptr);
+    }
+    memset(&state, 0, sizeof(state));
+}
+
+bool movie_recording(void) {
+    return state.recording;
+}
+
+bool movie_replaying(void) {
+    return state.replaying;
+}
+
+bool movie_input(const sapp_event* event) {
+    assert(event);
+    if (state.replaying) {
+        return false;
+    }
+    if (state.recording) {
+        uint8_t type = (uint8_t)event->type;
+        switch (event->type) {
+            case SAPP_EVENTTYPE_KEY_DOWN:
+            case SAPP_EVENTTYPE_KEY_UP:
+            case SAPP_EVENTTYPE_CHAR:
+                break;
+            default:
+                // nothing else is passed into the emulated systems
+                return true;
+        }
+        if (event->key_repeat) {
+            type |= 0x80;
+        }
+        movie_flush_repeat();
+        movie_reserve(MOVIE_MAX_RECORD_SIZE);
+        movie_put_tag(MOVIE_REC_EVENT, state.tick - state.event_tick);
+        state.event_tick = state.tick;
+        state.stream.ptr[state.stream.pos++] = type;
+        if (event->type == SAPP_EVENTTYPE_CHAR) {
+            movie_put_varint(event->char_code);
+        } else {
+            movie_put_varint((uint64_t)event->key_code);
+        }
+        movie_put_varint(event->modifiers);
+    }
+    return true;
+}
+
+// replay all events due before the next exec call, and return the exec call's emulated time
+static bool movie_replay_next(uint32_t* out_slice_us) {
+    while (true) {
+        if (state.repeat > 0) {
+            state.repeat--;
+            *out_slice_us = state.slice_us;
+            return true;
+        }
+        if (state.stream.pos >= state.stream.size) {
+            movie_stop_replay("end of movie");
+            return false;
+        }
+        uint64_t tag;
+        if (!movie_get_varint(&tag)) {
+            movie_stop_replay("corrupt movie");
+            return false;
+        }
+        const uint64_t val = tag >> 2;
+        switch (tag & 3) {
+            case MOVIE_REC_SLICE:
+                // zigzag-decode the difference to the previous exec call
+                state.slice_us += (uint32_t)((val >> 1) ^ (0 - (val & 1)));
+                *out_slice_us = state.slice_us;
+                return true;
+            case MOVIE_REC_REPEAT:
+                state.repeat = (uint32_t)val;
+                break;
+            case MOVIE_REC_EVENT: {
+                state.event_tick += val;
+                if (state.event_tick != state.tick) {
+                    movie_stop_replay("out of sync");
+                    return false;
+                }
+                sapp_event event;
+                memset(&event, 0, sizeof(event));
+                uint64_t code = 0;
+                uint64_t modifiers = 0;
+                if (state.stream.pos >= state.stream.size) {
+                    movie_stop_replay("corrupt movie");
+                    return false;
+                }
+                const uint8_t type = state.stream.ptr[state.stream.pos++];
+                event.type = (sapp_event_type)(type & 0x7F);
+                event.key_repeat = 0 != (type & 0x80);
+                if (!movie_get_varint(&code) || !movie_get_varint(&modifiers)) {
+                    movie_stop_replay("corrupt movie");
+                    return false;
+                }
+                if (event.type == SAPP_EVENTTYPE_CHAR) {
+                    event.char_code = (uint32_t)code;
+                } else {
+                    event.key_code = (sapp_keycode)code;
+                }
+                event.modifiers = (uint32_t)modifiers;
+                state.input_cb(&event);
+            } break;
+            default:
+                movie_stop_replay("corrupt movie");
+                return false;
+        }
+    }
+}
+
+uint32_t movie_exec_begin(uint32_t frame_time_us) {
+    uint32_t slice_us = frame_time_us;
+    if (state.replaying) {
+        if (!movie_replay_next(&slice_us)) {
+            slice_us = frame_time_us;
+        }
+    } else if (state.recording) {
+        if (slice_us == state.slice_us) {
+            state.repeat++;
+        } else {
+            movie_flush_repeat();
+            movie_reserve(MOVIE_MAX_RECORD_SIZE);
+            // zigzag-encode the difference to the previous exec call
+            const int64_t diff = (int64_t)slice_us - (int64_t)state.slice_us;
+            movie_put_tag(MOVIE_REC_SLICE, (uint64_t)((diff << 1) ^ (diff >> 63)));
+            state.slice_us = slice_us;
+        }
+    }
+    state.time_us += slice_us;
+    return slice_us;
+}
+
+void movie_exec_end(uint32_t ticks) {
+    state.tick += ticks;
+}
+
+uint64_t movie_time_us(void) {
+    return state.time_us;
+}
@@ -0,0 +1,93 @@
+#pragma once
+/*
+    Deterministic input recording and replay ("movie files") for the
+    example emulators.
+
+    Started with the 'record=path' command line arg, every input event
+    which reaches the emulated system is logged together with the
+    emulated tick it was applied at, and written to a movie file when
+    the emulator shuts down. With 'replay=path' the events are fed back
+    into the emulated system at exactly the same ticks, live input is
+    ignored until the end of the movie is reached.
+
+    To make the replay bit-exact, the emulated time of each exec call is
+    recorded too (the frame time depends on the host's display refresh
+    rate, and in warp mode an unpredictable number of exec calls happen
+    per frame). Exec calls are replayed with the recorded time, so the
+    emulated system runs through the same sequence of exec calls and
+    ticks, independent from the host's frame rate or warp mode. This
+    means a movie can be replayed unthrottled with the 'warp' arg, for
+    instance for throughput benchmarks with a realistic workload.
+
+    The emulator's frame loop calls movie_exec_begin() before and
+    movie_exec_end() after each exec call:
+
+        state.frame_time_us = clock_frame_time();
+        do {
+            state.frame_time_us = movie_exec_begin(state.frame_time_us);
+            const uint32_t ticks = xxx_exec(&state.sys, state.frame_time_us);
+            movie_exec_end(ticks);
+            ...
+        } while (clock_warp_next(...));
+
+    ...and the input handler only forwards events to the emulated system
+    when movie_input() returns true. During replay, the recorded events
+    are passed to the desc.input_cb callback from inside movie_exec_begin().
+
+    File layout (all values in host byte order):
+
+    - a fixed-size header (magic, format version, system name, stream size)
+    - a byte stream of records, each starting with a varint tag,
+      the lower 2 bits of the tag are the record type, the upper bits
+      a value:
+        MOVIE_REC_SLICE:    one exec call, the value is the zigzag-encoded
+                            difference of its emulated time in microseconds
+                            to the previous exec call
+        MOVIE_REC_REPEAT:   the value is a number of exec calls with the
+                            same emulated time as the previous exec call
+        MOVIE_REC_EVENT:    the value is the number of ticks since the
+                            previous event, followed by the event type
+                            (one byte, bit 7 is the key-repeat flag), the
+                            char code or key code, and the modifiers as
+                            varints
+
+    The movie doesn't contain the system's start state, a movie must be
+    replayed with the same command line args (e.g. 'file=' or 'input=')
+    as it was recorded with. Rewinding, loading snapshots, dropping files
+    and the UI debugger during recording will break the replay.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sokol_app.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+typedef struct {
+    const char* system_name;    // e.g. "c64", stored in the movie file and checked on replay
+    const char* record_path;    // record a movie to this path (0 or empty string: don't record)
+    const char* replay_path;    // replay a movie from this path (0 or empty string: don't replay)
+    void (*input_cb)(const sapp_event* event);  // called with replayed events
+} movie_desc_t;
+
+// initialize the movie recorder or player, does nothing if neither a record nor replay path is provided
+void movie_init(const movie_desc_t* desc);
+// write the recorded movie file (if recording) and shutdown
+void movie_shutdown(void);
+// return true if a movie is being recorded
+bool movie_recording(void);
+// return true while a movie is being replayed
+bool movie_replaying(void);
+// call for each input event before passing it to the emulated system, returns false if the event must be ignored
+bool movie_input(const sapp_event* event);
+// call before each exec call, replays due events and returns the emulated time for the exec call
+uint32_t movie_exec_begin(uint32_t frame_time_us);
+// call after each exec call with the number of executed ticks
+void movie_exec_end(uint32_t ticks);
+// emulated time in microseconds since start of the movie
+uint64_t movie_time_us(void);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
@@ -0,0 +1,282 @@
+#include "rewind.h"
+#include <assert.h>
+#include <stdlib.h> // malloc/free
+#include <string.h>
+
+#define REWIND_DEF(v,def) (v?v:def)
+#define REWIND_MAX_ENTRIES (16 * 1024)
+// minimal zero-run length which terminates a literal run
+#define REWIND_MIN_ZERO_RUN (4)
+
+typedef struct {
+    size_t offset;      // offset of the encoded snapshot in arena
+    size_t size;        // size of the encoded snapshot
+    bool keyframe;
+} rewind_entry_t;
+
+typedef struct {
+    bool valid;
+    size_t snapshot_size;
+    int capture_interval_us;
+    int keyframe_interval;
+    int capture_time_us;
+    // encoded snapshots, the entries are a ring buffer in push order
+    struct {
+        uint8_t* ptr;
+        size_t size;
+    } arena;
+    int head;           // index of oldest entry
+    int count;          // number of valid entries
+    int num_deltas;     // number of delta entries since the newest keyframe
+    bool force_keyframe;
+    uint8_t* ref;       // decoded content of the newest keyframe
+    uint8_t* scratch;   // encoding buffer
+    size_t scratch_size;
+    rewind_entry_t entries[REWIND_MAX_ENTRIES];
+} rewind_state_t;
+static rewind_state_t* state;
+
+void rewind_init(const rewind_desc_t* desc) {
+    assert(desc && (desc->snapshot_size > 0) && (desc->arena_size > 0));
+    assert(0 == state);
+    state = calloc(1, sizeof(rewind_state_t));
+    assert(state);
+    state->valid = true;
+    state->snapshot_size = desc->snapshot_size;
+    state->capture_interval_us = REWIND_DEF(desc->capture_interval_frames, 10) * 16667;
+    state->keyframe_interval = REWIND_DEF(desc->keyframe_interval, 30);
+    state->force_keyframe = true;
+    state->arena.size = desc->arena_size;
+    state->arena.ptr = malloc(state->arena.size);
+    state->ref = malloc(state->snapshot_size);
+    // worst case encoding size is the snapshot size plus a few bytes
+    state->scratch_size = state->snapshot_size + 64;
+    state->scratch = malloc(state->scratch_size);
+    assert(state->arena.ptr && state->ref && state->scratch);
+}
+
+void rewind_shutdown(void) {
+    if (state) {
+        free(state->arena.ptr);
+        free(state->ref);
+        free(state->scratch);
+        free(state);
+        state = 0;
+    }
+}
+
+bool rewind_enabled(void) {
+    return (0 != state) && state->valid;
+}
+
+bool rewind_capture_due(uint32_t frame_time_us) {
+    assert(rewind_enabled());
+    state->capture_time_us += (int)frame_time_us;
+    if (state->capture_time_us >= state->capture_interval_us) {
+        state->capture_time_us = 0;
+        return true;
+    }
+    return false;
+}
+
+static uint8_t* rewind_put_varint(uint8_t* dst, size_t val) {
+    while (val >= 0x80) {
+        *dst++ = (uint8_t)(val | 0x80);
+        val >>= 7;
+    }
+    *dst++ = (uint8_t)val;
+    return dst;
+}
+
+static const uint8_t* rewind_get_varint(const uint8_t* src, size_t* out_val) {
+    size_t val = 0;
+    int shift = 0;
+    uint8_t b;
+    do {
+        b = *src++;
+        val |= (size_t)(b & 0x7F) << shift;
+        shift += 7;
+    } while (b & 0x80);
+    *out_val = val;
+    return src;
+}
+
+// encode (src XOR ref) as a sequence of [zero-run-length, literal-length, literal bytes...],
+// with ref == 0 the src bytes are run-length-encoded as is (for keyframes)
+static size_t rewind_encode(const uint8_t* src, const uint8_t* ref, size_t size, uint8_t* dst) {
+    uint8_t* out = dst;
+    size_t pos = 0;
+    #define REWIND_XOR(i) (ref ? (src[i] ^ ref[i]) : src[i])
+    while (pos < size) {
+        // skip zero bytes, the bulk of unchanged bytes is skipped 8 bytes at a time
+        const size_t zero_start = pos;
+        while ((pos + 8) <= size) {
+            uint64_t s, r = 0;
+            memcpy(&s, src + pos, 8);
+            if (ref) {
+                memcpy(&r, ref + pos, 8);
+            }
+            if (s != r) {
+                break;
+            }
+            pos += 8;
+        }
+        while ((pos < size) && (0 == REWIND_XOR(pos))) {
+            pos++;
+        }
+        const size_t zero_run = pos - zero_start;
+        // gather literal bytes until a long enough zero-run is found
+        const size_t lit_start = pos;
+        size_t num_zeros = 0;
+        while (pos < size) {
+            if (0 == REWIND_XOR(pos)) {
+                if (++num_zeros == REWIND_MIN_ZERO_RUN) {
+                    pos -= REWIND_MIN_ZERO_RUN - 1;
+                    break;
+                }
+            } else {
+                num_zeros = 0;
+            }
+            pos++;
+        }
+        const size_t lit_len = pos - lit_start;
+        out = rewind_put_varint(out, zero_run);
+        out = rewind_put_varint(out, lit_len);
+        for (size_t i = 0; i < lit_len; i++) {
+            *out++ = REWIND_XOR(lit_start + i);
+        }
+    }
+    #undef REWIND_XOR
+    return (size_t)(out - dst);
+}
+
+// decode an encoded snapshot, with ref == 0 the zero-runs are written as zeroes,
+// otherwise the zero-runs are copied from ref, and literals are XOR'ed with ref
+static void rewind_decode(const uint8_t* src, size_t src_size, const uint8_t* ref, uint8_t* dst, size_t size) {
+    const uint8_t* end = src + src_size;
+    size_t pos = 0;
+    while (src < end) {
+        size_t zero_run, lit_len;
+        src = rewind_get_varint(src, &zero_run);
+        src = rewind_get_varint(src, &lit_len);
+        assert((pos + zero_run + lit_len) <= size);
+        if (ref) {
+            memcpy(dst + pos, ref + pos, zero_run);
+        } else {
+            memset(dst + pos, 0, zero_run);
+        }
+        pos += zero_run;
+        for (size_t i = 0; i < lit_len; i++, pos++) {
+            dst[pos] = ref ? (*src++ ^ ref[pos]) : *src++;
+        }
+    }
+    assert(pos == size); (void)size;
+}
+
+static int rewind_entry_idx(int i) {
+    return (state->head + i) % REWIND_MAX_ENTRIES;
+}
+
+static rewind_entry_t* rewind_oldest(void) {
+    return &state->entries[state->head];
+}
+
+static rewind_entry_t* rewind_newest(void) {
+    return &state->entries[rewind_entry_idx(state->count - 1)];
+}
+
+static void rewind_drop_oldest(void) {
+    assert(state->count > 0);
+    state->head = rewind_entry_idx(1);
+    state->count--;
+    // delta entries without their keyframe are useless
+    while ((state->count > 0) && !rewind_oldest()->keyframe) {
+        state->head = rewind_entry_idx(1);
+        state->count--;
+    }
+}
+
+// find a place for an encoded snapshot in the arena, dropping old snapshots as needed
+static size_t rewind_alloc(size_t size) {
+    assert(size <= state->arena.size);
+    if (state->count == REWIND_MAX_ENTRIES) {
+        rewind_drop_oldest();
+    }
+    size_t offset = 0;
+    if (state->count > 0) {
+        offset = rewind_newest()->offset + rewind_newest()->size;
+        if ((offset + size) > state->arena.size) {
+            // wrap around, this abandons the end of the arena, which
+            // only contains the oldest snapshots
+            while ((state->count > 0) && (rewind_oldest()->offset >= offset)) {
+                rewind_drop_oldest();
+            }
+            offset = 0;
+        }
+    }
+    // drop the oldest snapshots which overlap the new snapshot
+    while ((state->count > 0) && (rewind_oldest()->offset >= offset) && (rewind_oldest()->offset < (offset + size))) {
+        rewind_drop_oldest();
+    }
+    return offset;
+}
+
+void rewind_push(const void* snapshot) {
+    assert(rewind_enabled() && snapshot);
+    bool keyframe = state->force_keyframe || (state->count == 0) || (state->num_deltas >= (state->keyframe_interval - 1));
+    size_t size = rewind_encode(snapshot, keyframe ? 0 : state->ref, state->snapshot_size, state->scratch);
+    assert(size <= state->scratch_size);
+    if (size > state->arena.size) {
+        // arena is too small for even a single snapshot
+        state->force_keyframe = true;
+        return;
+    }
+    size_t offset = rewind_alloc(size);
+    if (!keyframe && (state->count == 0)) {
+        // the newest keyframe has been dropped to make room, need to start over with a keyframe
+        keyframe = true;
+        size = rewind_encode(snapshot, 0, state->snapshot_size, state->scratch);
+        if (size > state->arena.size) {
+            state->force_keyframe = true;
+            return;
+        }
+        offset = rewind_alloc(size);
+    }
+    memcpy(state->arena.ptr + offset, state->scratch, size);
+    state->count++;
+    *rewind_newest() = (rewind_entry_t){ .offset = offset, .size = size, .keyframe = keyframe };
+    if (keyframe) {
+        memcpy(state->ref, snapshot, state->snapshot_size);
+        state->num_deltas = 0;
+        state->force_keyframe = false;
+    } else {
+        state->num_deltas++;
+    }
+}
+
+bool rewind_pop(void* dst) {
+    assert(rewind_enabled() && dst);
+    if (state->count == 0) {
+        return false;
+    }
+    // find the keyframe of the newest snapshot (the oldest entry is always a keyframe)
+    int key_idx = state->count - 1;
+    while (!state->entries[rewind_entry_idx(key_idx)].keyframe) {
+        assert(key_idx > 0);
+        key_idx--;
+    }
+    const rewind_entry_t* key = &state->entries[rewind_entry_idx(key_idx)];
+    rewind_decode(state->arena.ptr + key->offset, key->size, 0, state->ref, state->snapshot_size);
+    const rewind_entry_t* entry = rewind_newest();
+    if (entry->keyframe) {
+        memcpy(dst, state->ref, state->snapshot_size);
+        // the next snapshot must be a keyframe since the ref keyframe is gone
+        state->force_keyframe = true;
+    } else {
+        rewind_decode(state->arena.ptr + entry->offset, entry->size, state->ref, dst, state->snapshot_size);
+    }
+    state->count--;
+    state->num_deltas = state->count - 1 - key_idx;
+    state->capture_time_us = 0;
+    return true;
+}
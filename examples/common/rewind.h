@@ -0,0 +1,51 @@
+#pragma once
+/*
+    A rewind buffer for the example emulators.
+
+    Every few frames the emulator pushes a system snapshot into the
+    rewind buffer, and pops snapshots off again to step back in time.
+
+    Snapshots are stored in a fixed-size memory arena which is used as
+    ring buffer, when the arena is full the oldest snapshots are dropped.
+    To fit minutes of emulation into a few dozen MBytes, snapshots are
+    delta-compressed: every Nth snapshot is a keyframe, the snapshots in
+    between are stored as XOR against their keyframe, and both are
+    run-length-encoded (since most bytes don't change between snapshots,
+    the XOR-result is mostly zero).
+
+    The rewind buffer doesn't know anything about the emulated system,
+    snapshots are just blobs of a fixed size (usually created with
+    xxx_save_snapshot(), and restored with xxx_load_snapshot()).
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+typedef struct {
+    size_t snapshot_size;           // size of a system snapshot in bytes
+    size_t arena_size;              // memory budget in bytes
+    int capture_interval_frames;    // push a snapshot every N 60Hz frames (default: 10)
+    int keyframe_interval;          // every Nth snapshot is a keyframe (default: 30)
+} rewind_desc_t;
+
+// initialize the rewind buffer
+void rewind_init(const rewind_desc_t* desc);
+// free the rewind buffer
+void rewind_shutdown(void);
+// return true if the rewind buffer has been initialized
+bool rewind_enabled(void);
+// call after each emulated frame (in warp mode after each slice) with its emulated time,
+// returns true if a snapshot should be pushed
+bool rewind_capture_due(uint32_t frame_time_us);
+// push a new snapshot
+void rewind_push(const void* snapshot);
+// copy the newest snapshot into dst and remove it, returns false if buffer is empty
+bool rewind_pop(void* dst);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
@@ -0,0 +1,320 @@
+#include "chips/chips_common.h"
+#include "snapfile.h"
+#include <assert.h>
+#include <stdlib.h> // malloc/free
+#include <string.h>
+
+#define SNAPFILE_MAGIC (0x50534E43)     // 'CNSP'
+#define SNAPFILE_FORMAT_VERSION (1)
+#define SNAPFILE_NAME_SIZE (16)
+#define SNAPFILE_PAGE_SIZE (4096)
+#define SNAPFILE_PAGE_RAW (1u<<31)
+#define SNAPFILE_MAX_THUMBNAIL_SIZE (64 * 1024)
+#define SNAPFILE_MAX_PALETTE_SIZE (256 * sizeof(uint32_t))
+
+typedef struct {
+    uint32_t magic;
+    uint32_t format_version;
+    char system_name[SNAPFILE_NAME_SIZE];
+    uint32_t snapshot_version;
+    uint32_t snapshot_size;
+    uint32_t num_pages;
+    uint32_t thumb_width;
+    uint32_t thumb_height;
+    uint32_t thumb_bytes_per_pixel;
+    uint32_t thumb_portrait;
+    uint32_t thumb_palette_size;    // in bytes, palette follows header
+    uint32_t thumb_encoded_size;    // encoded thumbnail pixels follow palette
+} snapfile_header_t;
+
+static struct {
+    uint32_t palette[256];
+    uint8_t pixels[SNAPFILE_MAX_THUMBNAIL_SIZE];
+} thumbnail;
+
+// PackBits-style run-length encoding: a control byte < 128 is followed
+// by (c+1) literal bytes, a control byte >= 128 is followed by one byte
+// which is repeated (c-126) times
+static size_t snapfile_max_rle_size(size_t size) {
+    return size + (size / 128) + 1;
+}
+
+static size_t snapfile_rle_encode(const uint8_t* src, size_t size, uint8_t* dst) {
+    uint8_t* out = dst;
+    size_t pos = 0;
+    while (pos < size) {
+        size_t run = 1;
+        while (((pos + run) < size) && (run < 129) && (src[pos + run] == src[pos])) {
+            run++;
+        }
+        if (run >= 2) {
+            *out++ = (uint8_t)(128 + run - 2);
+            *out++ = src[pos];
+            pos += run;
+        } else {
+            // gather literals until the next run of at least 3 bytes
+            size_t lit_start = pos;
+            while ((pos < size) && ((pos - lit_start) < 128)) {
+                if (((pos + 2) < size) && (src[pos] == src[pos + 1]) && (src[pos] == src[pos + 2])) {
+                    break;
+                }
+                pos++;
+            }
+            const size_t lit_len = pos - lit_start;
+            *out++ = (uint8_t)(lit_len - 1);
+            memcpy(out, src + lit_start, lit_len);
+            out += lit_len;
+        }
+    }
+    return (size_t)(out - dst);
+}
+
+static bool snapfile_rle_decode(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size) {
+    const uint8_t* end = src + src_size;
+    size_t pos = 0;
+    while (src < end) {
+        const uint8_t c = *src++;
+        if (c < 128) {
+            const size_t len = c + 1;
+            if (((src + len) > end) || ((pos + len) > dst_size)) {
+                return false;
+            }
+            memcpy(dst + pos, src, len);
+            src += len;
+            pos += len;
+        } else {
+            const size_t len = c - 126;
+            if ((src >= end) || ((pos + len) > dst_size)) {
+                return false;
+            }
+            memset(dst + pos, *src++, len);
+            pos += len;
+        }
+    }
+    return pos == dst_size;
+}
+
+static bool snapfile_is_zero(const uint8_t* ptr, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        if (ptr[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// subsample the visible area of the emulator display into the thumbnail buffer
+static bool snapfile_make_thumbnail(const chips_display_info_t* info, snapfile_header_t* hdr) {
+    if ((0 == info->frame.buffer.ptr) || (info->screen.width <= 0) || (info->screen.height <= 0)) {
+        return false;
+    }
+    const size_t bpp = (size_t)info->frame.bytes_per_pixel;
+    if ((bpp != 1) && (bpp != 4)) {
+        return false;
+    }
+    if ((bpp == 1) && ((0 == info->palette.ptr) || (info->palette.size > SNAPFILE_MAX_PALETTE_SIZE))) {
+        return false;
+    }
+    int step = 2;
+    while (((size_t)(info->screen.width / step) * (size_t)(info->screen.height / step) * bpp) > SNAPFILE_MAX_THUMBNAIL_SIZE) {
+        step++;
+    }
+    const int w = info->screen.width / step;
+    const int h = info->screen.height / step;
+    const uint8_t* src = (const uint8_t*) info->frame.buffer.ptr;
+    uint8_t* dst = thumbnail.pixels;
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            const size_t src_x = (size_t)(info->screen.x + x * step);
+            const size_t src_y = (size_t)(info->screen.y + y * step);
+            memcpy(dst, src + (src_y * (size_t)info->frame.dim.width + src_x) * bpp, bpp);
+            dst += bpp;
+        }
+    }
+    hdr->thumb_width = (uint32_t)w;
+    hdr->thumb_height = (uint32_t)h;
+    hdr->thumb_bytes_per_pixel = (uint32_t)bpp;
+    hdr->thumb_portrait = info->portrait ? 1 : 0;
+    hdr->thumb_palette_size = (bpp == 1) ? (uint32_t)info->palette.size : 0;
+    return true;
+}
+
+chips_range_t snapfile_encode(const snapfile_desc_t* desc) {
+    assert(desc && desc->system_name && desc->snapshot.ptr && (desc->snapshot.size > 0));
+    snapfile_header_t hdr = {
+        .magic = SNAPFILE_MAGIC,
+        .format_version = SNAPFILE_FORMAT_VERSION,
+        .snapshot_version = desc->snapshot_version,
+        .snapshot_size = (uint32_t)desc->snapshot.size,
+        .num_pages = (uint32_t)((desc->snapshot.size + SNAPFILE_PAGE_SIZE - 1) / SNAPFILE_PAGE_SIZE),
+    };
+    strncpy(hdr.system_name, desc->system_name, SNAPFILE_NAME_SIZE - 1);
+    const bool has_thumbnail = snapfile_make_thumbnail(&desc->display_info, &hdr);
+    const size_t thumb_size = hdr.thumb_width * hdr.thumb_height * hdr.thumb_bytes_per_pixel;
+
+    // zero the omitted region in a copy of the snapshot, this turns it into empty pages
+    uint8_t* snapshot = malloc(desc->snapshot.size);
+    assert(snapshot);
+    memcpy(snapshot, desc->snapshot.ptr, desc->snapshot.size);
+    const uint8_t* omit_ptr = (const uint8_t*) desc->omit.ptr;
+    const uint8_t* snapshot_ptr = (const uint8_t*) desc->snapshot.ptr;
+    if (omit_ptr && (omit_ptr >= snapshot_ptr) && ((omit_ptr + desc->omit.size) <= (snapshot_ptr + desc->snapshot.size))) {
+        memset(snapshot + (omit_ptr - snapshot_ptr), 0, desc->omit.size);
+    }
+
+    const size_t max_size = sizeof(hdr)
+        + hdr.thumb_palette_size
+        + snapfile_max_rle_size(thumb_size)
+        + hdr.num_pages * sizeof(uint32_t)
+        + hdr.num_pages * SNAPFILE_PAGE_SIZE;
+    uint8_t* buf = malloc(max_size);
+    assert(buf);
+    uint8_t* ptr = buf + sizeof(hdr);
+    if (has_thumbnail) {
+        memcpy(ptr, desc->display_info.palette.ptr, hdr.thumb_palette_size);
+        ptr += hdr.thumb_palette_size;
+        hdr.thumb_encoded_size = (uint32_t)snapfile_rle_encode(thumbnail.pixels, thumb_size, ptr);
+        ptr += hdr.thumb_encoded_size;
+    }
+    assert((size_t)(ptr - buf) <= SNAPFILE_MAX_HEADER_SIZE);
+    memcpy(buf, &hdr, sizeof(hdr));
+
+    uint32_t* page_table = (uint32_t*) ptr;
+    ptr += hdr.num_pages * sizeof(uint32_t);
+    uint8_t* page_buf = malloc(snapfile_max_rle_size(SNAPFILE_PAGE_SIZE));
+    assert(page_buf);
+    for (uint32_t page = 0; page < hdr.num_pages; page++) {
+        const size_t offset = page * SNAPFILE_PAGE_SIZE;
+        const size_t page_size = ((offset + SNAPFILE_PAGE_SIZE) <= desc->snapshot.size) ? SNAPFILE_PAGE_SIZE : (desc->snapshot.size - offset);
+        const uint8_t* src = snapshot + offset;
+        uint32_t entry = 0;
+        if (!snapfile_is_zero(src, page_size)) {
+            const size_t rle_size = snapfile_rle_encode(src, page_size, page_buf);
+            if (rle_size < page_size) {
+                memcpy(ptr, page_buf, rle_size);
+                entry = (uint32_t)rle_size;
+            } else {
+                memcpy(ptr, src, page_size);
+                entry = (uint32_t)page_size | SNAPFILE_PAGE_RAW;
+            }
+            ptr += entry & ~SNAPFILE_PAGE_RAW;
+        }
+        memcpy(&page_table[page], &entry, sizeof(entry));
+    }
+    free(page_buf);
+    free(snapshot);
+    assert((size_t)(ptr - buf) <= max_size);
+    return (chips_range_t){ .ptr = buf, .size = (size_t)(ptr - buf) };
+}
+
+void snapfile_free(chips_range_t data) {
+    free(data.ptr);
+}
+
+// the thumbnail dimensions come from the file, multiply in 64 bits so the product can't wrap
+static uint64_t snapfile_thumb_size(const snapfile_header_t* hdr) {
+    return (uint64_t)hdr->thumb_width * hdr->thumb_height * hdr->thumb_bytes_per_pixel;
+}
+
+static bool snapfile_read_header(chips_range_t data, snapfile_header_t* hdr) {
+    if (!data.ptr || (data.size < sizeof(snapfile_header_t))) {
+        return false;
+    }
+    memcpy(hdr, data.ptr, sizeof(snapfile_header_t));
+    if ((hdr->magic != SNAPFILE_MAGIC) || (hdr->format_version != SNAPFILE_FORMAT_VERSION)) {
+        return false;
+    }
+    if ((hdr->thumb_palette_size > SNAPFILE_MAX_PALETTE_SIZE) ||
+        (snapfile_thumb_size(hdr) > SNAPFILE_MAX_THUMBNAIL_SIZE) ||
+        (hdr->thumb_encoded_size > snapfile_max_rle_size(SNAPFILE_MAX_THUMBNAIL_SIZE)))
+    {
+        return false;
+    }
+    return true;
+}
+
+bool snapfile_read_info(chips_range_t data, const char* system_name, snapfile_info_t* out_info) {
+    assert(system_name && out_info);
+    memset(out_info, 0, sizeof(snapfile_info_t));
+    snapfile_header_t hdr;
+    if (!snapfile_read_header(data, &hdr)) {
+        return false;
+    }
+    if (0 != strncmp(hdr.system_name, system_name, SNAPFILE_NAME_SIZE)) {
+        return false;
+    }
+    out_info->snapshot_version = hdr.snapshot_version;
+    out_info->snapshot_size = hdr.snapshot_size;
+    if (hdr.thumb_encoded_size > 0) {
+        const uint8_t* ptr = (const uint8_t*)data.ptr + sizeof(hdr);
+        if ((sizeof(hdr) + hdr.thumb_palette_size + hdr.thumb_encoded_size) > data.size) {
+            return false;
+        }
+        const size_t thumb_size = (size_t)snapfile_thumb_size(&hdr);
+        memcpy(thumbnail.palette, ptr, hdr.thumb_palette_size);
+        ptr += hdr.thumb_palette_size;
+        if (!snapfile_rle_decode(ptr, hdr.thumb_encoded_size, thumbnail.pixels, thumb_size)) {
+            return false;
+        }
+        chips_display_info_t* thumb = &out_info->thumbnail;
+        thumb->frame.dim.width = (int)hdr.thumb_width;
+        thumb->frame.dim.height = (int)hdr.thumb_height;
+        thumb->frame.bytes_per_pixel = (int)hdr.thumb_bytes_per_pixel;
+        thumb->frame.buffer.ptr = thumbnail.pixels;
+        thumb->frame.buffer.size = thumb_size;
+        thumb->screen.width = (int)hdr.thumb_width;
+        thumb->screen.height = (int)hdr.thumb_height;
+        if (hdr.thumb_palette_size > 0) {
+            thumb->palette.ptr = thumbnail.palette;
+            thumb->palette.size = hdr.thumb_palette_size;
+        }
+        thumb->portrait = hdr.thumb_portrait != 0;
+    }
+    return true;
+}
+
+bool snapfile_decode(chips_range_t data, chips_range_t dst) {
+    assert(dst.ptr);
+    snapfile_header_t hdr;
+    if (!snapfile_read_header(data, &hdr) || (hdr.snapshot_size != dst.size)) {
+        return false;
+    }
+    // every page of the snapshot must have a page table entry
+    const size_t num_pages = (dst.size + SNAPFILE_PAGE_SIZE - 1) / SNAPFILE_PAGE_SIZE;
+    if (hdr.num_pages != num_pages) {
+        return false;
+    }
+    // all bounds checks compare sizes against the remaining data, the header
+    // and thumbnail sizes are already limited by snapfile_read_header()
+    const uint8_t* src = (const uint8_t*) data.ptr;
+    size_t pos = sizeof(hdr) + hdr.thumb_palette_size + hdr.thumb_encoded_size;
+    const size_t page_table_size = num_pages * sizeof(uint32_t);
+    if ((pos > data.size) || (page_table_size > (data.size - pos))) {
+        return false;
+    }
+    const uint8_t* page_table = src + pos;
+    pos += page_table_size;
+    uint8_t* dst_ptr = (uint8_t*) dst.ptr;
+    for (size_t page = 0; page < num_pages; page++) {
+        uint32_t entry;
+        memcpy(&entry, page_table + page * sizeof(uint32_t), sizeof(entry));
+        const size_t offset = page * SNAPFILE_PAGE_SIZE;
+        const size_t page_size = ((dst.size - offset) < SNAPFILE_PAGE_SIZE) ? (dst.size - offset) : SNAPFILE_PAGE_SIZE;
+        const size_t src_size = entry & ~SNAPFILE_PAGE_RAW;
+        if (src_size > (data.size - pos)) {
+            return false;
+        }
+        if (0 == entry) {
+            memset(dst_ptr + offset, 0, page_size);
+        } else if (entry & SNAPFILE_PAGE_RAW) {
+            if (src_size != page_size) {
+                return false;
+            }
+            memcpy(dst_ptr + offset, src + pos, page_size);
+        } else if (!snapfile_rle_decode(src + pos, src_size, dst_ptr + offset, page_size)) {
+            return false;
+        }
+        pos += src_size;
+    }
+    return true;
+}
@@ -0,0 +1,62 @@
+#pragma once
+/*
+    A versioned and compressed on-disk format for emulator snapshots.
+
+    File layout (all values in host byte order):
+
+    - a fixed-size header (magic, format version, system name, snapshot
+      version, sizes)
+    - an optional thumbnail: palette and pixels of the emulator display,
+      subsampled and run-length-encoded
+    - a page table with one entry per 4 KByte page of the snapshot
+    - the page data, each page is either omitted (all zero), stored
+      run-length-encoded, or stored as is
+
+    Most of a system snapshot are RAM banks, which are often zero or
+    filled with a repeating pattern. An optional region can be excluded
+    (usually the framebuffer, which is regenerated after one frame).
+
+    Everything needed to show a snapshot slot in the UI (the header and
+    thumbnail) is at the start of the file and is smaller than
+    SNAPFILE_MAX_HEADER_SIZE, so that only this part needs to be read
+    when populating the snapshot slots at startup.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "chips/chips_common.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// the header and thumbnail are guaranteed to fit into this many bytes
+#define SNAPFILE_MAX_HEADER_SIZE (128 * 1024)
+
+typedef struct {
+    const char* system_name;            // e.g. "c64"
+    uint32_t snapshot_version;          // e.g. C64_SNAPSHOT_VERSION
+    chips_range_t snapshot;             // the system snapshot (e.g. a c64_t)
+    chips_range_t omit;                 // optional region inside the snapshot which isn't stored
+    chips_display_info_t display_info;  // optional display info to create a thumbnail from
+} snapfile_desc_t;
+
+typedef struct {
+    uint32_t snapshot_version;
+    size_t snapshot_size;
+    chips_display_info_t thumbnail;     // thumbnail.frame.buffer.ptr is 0 if there's no thumbnail
+} snapfile_info_t;
+
+// encode a snapshot file, release the returned data with snapfile_free()
+chips_range_t snapfile_encode(const snapfile_desc_t* desc);
+// free data returned by snapfile_encode()
+void snapfile_free(chips_range_t data);
+// read header and thumbnail, data can be the whole file or only the first SNAPFILE_MAX_HEADER_SIZE bytes,
+// the thumbnail pixels are valid until the next call
+bool snapfile_read_info(chips_range_t data, const char* system_name, snapfile_info_t* out_info);
+// decode the snapshot into dst (which must have the size of the snapshot), omitted regions are zero-filled
+bool snapfile_decode(chips_range_t data, chips_range_t dst);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
@@ -32,6 +32,7 @@
 
 typedef struct {
     uint32_t version;
+    bool loaded;    // false if only the header has been loaded from storage
     bombjack_t sys;
 } bombjack_snapshot_t;
 
@@ -40,6 +41,7 @@ static struct {
     uint32_t frame_time_us;
     uint32_t ticks;
     double emu_time_ms;
+    bombjack_t rewind_snapshot;
     #ifdef CHIPS_USE_UI
         ui_bombjack_t ui;
         bombjack_snapshot_t snapshots[UI_SNAPSHOT_MAX_SLOTS];
@@ -62,12 +64,17 @@ static void ui_load_snapshots_from_storage(void);
 
 static void push_audio(const float* samples, int num_samples, void* user_data) {
     (void)user_data;
-    saudio_push(samples, num_samples);
+    audio_push(samples, num_samples);
 }
 
+static void handle_input(const sapp_event* event);
+static void emu_frame(uint32_t host_frame_us);
+static void emu_input(const sapp_event* event);
+static chips_display_info_t emu_display_info(void);
+
 static void app_init(void) {
-    saudio_setup(&(saudio_desc){
-        .logger.func = slog_func,
+    audio_init(&(audio_desc_t){
+        .wav_path = sargs_value("wav"),
     });
     bombjack_init(&state.sys, &(bombjack_desc_t){
         .audio = {
@@ -153,28 +160,115 @@ static void app_init(void) {
         ui_bombjack_load_settings(&state.ui, ui_settings());
         ui_load_snapshots_from_storage();
     #endif
+    if (sargs_exists("rewind")) {
+        // optional rewind buffer size in MBytes
+        const int rewind_mb = atoi(sargs_value("rewind"));
+        rewind_init(&(rewind_desc_t){
+            .snapshot_size = sizeof(state.rewind_snapshot),
+            .arena_size = (size_t)((rewind_mb > 0) ? rewind_mb : 32) * 1024 * 1024,
+        });
+    }
+    // optional input recording and replay
+    movie_init(&(movie_desc_t){
+        .system_name = "bombjack",
+        .record_path = sargs_value("record"),
+        .replay_path = sargs_value("replay"),
+        .input_cb = handle_input,
+    });
+    #if !defined(CHIPS_USE_UI)
+    // optionally run the emulation on its own thread, the UI debugger needs it on the main thread
+    if (sargs_exists("thread")) {
+        emuthread_init(&(emuthread_desc_t){
+            .frame_hz = 60,
+            .frame_cb = emu_frame,
+            .input_cb = emu_input,
+            .display_info_cb = emu_display_info,
+        });
+    }
+    #endif
 }
 
 static void draw_status_bar(void);
 
-static void app_frame(void) {
-    state.frame_time_us = clock_frame_time();
+// one frame of emulation, called from app_frame() or on the emulation thread (see emuthread.h)
+static void emu_frame(uint32_t host_frame_us) {
+    state.frame_time_us = clock_frame_time_host(host_frame_us);
+    // in warp mode the audio would only overflow the stream, so drop it
+    audio_suspend(clock_warp());
     const uint64_t emu_start_time = stm_now();
-    state.ticks = bombjack_exec(&state.sys, state.frame_time_us);
+    // in warp mode, run in multiple slices until the frame's time budget is used up
+    state.ticks = 0;
+    do {
+        state.frame_time_us = movie_exec_begin(state.frame_time_us);
+        const uint32_t ticks = bombjack_exec(&state.sys, state.frame_time_us);
+        movie_exec_end(ticks);
+        state.ticks += ticks;
+        if (rewind_enabled() && rewind_capture_due(state.frame_time_us)) {
+            bombjack_save_snapshot(&state.sys, &state.rewind_snapshot);
+            rewind_push(&state.rewind_snapshot);
+        }
+    } while (clock_warp_next(true));
     state.emu_time_ms = stm_ms(stm_since(emu_start_time));
-    draw_status_bar();
-    gfx_draw(bombjack_display_info(&state.sys));
-    fs_dowork();
+}
+
+static chips_display_info_t emu_display_info(void) {
+    return bombjack_display_info(&state.sys);
+}
+
+static void app_frame(void) {
+    if (emuthread_running()) {
+        // sokol-fetch must be pumped on the main thread, finished loads are
+        // picked up by the emulation thread, so keep it between frames
+        emuthread_lock();
+        fs_dowork();
+        draw_status_bar();
+        emuthread_unlock();
+        gfx_draw(emuthread_display_info());
+    } else {
+        fs_dowork();
+        emu_frame(clock_host_frame_time());
+        draw_status_bar();
+        gfx_draw(emu_display_info());
+    }
 }
 
 // input handling
 static void app_input(const sapp_event* event) {
+    if (emuthread_running()) {
+        // the emulation thread owns the emulated system
+        emuthread_push_input(event);
+    } else {
+        emu_input(event);
+    }
+}
+
+static void emu_input(const sapp_event* event) {
     #ifdef CHIPS_USE_UI
     if (ui_input(event)) {
         // input was handled by UI
         return;
     }
     #endif
+    if ((event->type == SAPP_EVENTTYPE_KEY_DOWN) && (event->key_code == SAPP_KEYCODE_PAGE_DOWN) && !event->key_repeat) {
+        clock_toggle_warp();
+        return;
+    }
+    if ((event->type == SAPP_EVENTTYPE_KEY_DOWN) && (event->key_code == SAPP_KEYCODE_PAGE_UP) && rewind_enabled()) {
+        // step back in time, keep the key pressed to continuously rewind
+        if (rewind_pop(&state.rewind_snapshot)) {
+            bombjack_load_snapshot(&state.sys, BOMBJACK_SNAPSHOT_VERSION, &state.rewind_snapshot);
+        } else {
+            gfx_flash_error();
+        }
+        return;
+    }
+    if (movie_input(event)) {
+        handle_input(event);
+    }
+}
+
+// input events which reach the emulated system, these are recorded and replayed by movie.h
+static void handle_input(const sapp_event* event) {
     switch (event->type) {
         case SAPP_EVENTTYPE_KEY_DOWN:
             switch (event->key_code) {
@@ -211,11 +305,14 @@ static void app_input(const sapp_event* event) {
 }
 
 static void app_cleanup(void) {
+    emuthread_shutdown();
     bombjack_discard(&state.sys);
+    rewind_shutdown();
+    movie_shutdown();
     #ifdef CHIPS_USE_UI
         ui_bombjack_discard(&state.ui);
     #endif
-    saudio_shutdown();
+    audio_shutdown();
     gfx_shutdown();
 }
 
@@ -228,6 +325,13 @@ static void draw_status_bar(void) {
     sdtx_color3b(255, 255, 255);
     sdtx_pos(1.0f, (h / 8.0f) - 1.5f);
     sdtx_printf("frame:%.2fms emu:%.2fms (min:%.2fms max:%.2fms) ticks:%d", (float)state.frame_time_us * 0.001f, emu_stats.avg_val, emu_stats.min_val, emu_stats.max_val, state.ticks);
+    if (clock_warp()) {
+        sdtx_printf(" WARP x%.1f", clock_warp_speed());
+    }
+    const audio_stats_t audio_st = audio_stats();
+    if ((audio_st.num_underruns > 0) || (audio_st.num_overruns > 0)) {
+        sdtx_printf(" audio underruns:%u overruns:%u", audio_st.num_underruns, audio_st.num_overruns);
+    }
 }
 
 #if defined(CHIPS_USE_UI)
@@ -242,9 +346,9 @@ static void ui_save_settings_cb(ui_settings_t* settings) {
     ui_bombjack_save_settings(&state.ui, settings);
 }
 
-static void ui_update_snapshot_screenshot(size_t slot) {
+static void ui_update_snapshot_screenshot(size_t slot, chips_display_info_t display_info) {
     const ui_snapshot_screenshot_t screenshot = {
-        .texture = ui_create_screenshot_texture(bombjack_display_info(&state.snapshots[slot].sys)),
+        .texture = ui_create_screenshot_texture(display_info),
         .portrait = true,
     };
     ui_snapshot_screenshot_t prev_screenshot = ui_snapshot_set_screenshot(&state.ui.snapshot, slot, screenshot);
@@ -256,39 +360,83 @@ static void ui_update_snapshot_screenshot(size_t slot) {
 static void ui_save_snapshot(size_t slot) {
     if (slot < UI_SNAPSHOT_MAX_SLOTS) {
         state.snapshots[slot].version = bombjack_save_snapshot(&state.sys, &state.snapshots[slot].sys);
-        ui_update_snapshot_screenshot(slot);
-        fs_save_snapshot("bombjack", slot, (chips_range_t){ .ptr = &state.snapshots[slot], sizeof(bombjack_snapshot_t) });
+        state.snapshots[slot].loaded = true;
+        const chips_display_info_t display_info = bombjack_display_info(&state.snapshots[slot].sys);
+        ui_update_snapshot_screenshot(slot, display_info);
+        const chips_range_t data = snapfile_encode(&(snapfile_desc_t){
+            .system_name = "bombjack",
+            .snapshot_version = state.snapshots[slot].version,
+            .snapshot = { .ptr = &state.snapshots[slot].sys, .size = sizeof(bombjack_t) },
+            .omit = display_info.frame.buffer,
+            .display_info = display_info,
+        });
+        fs_save_snapshot("bombjack", slot, data);
+        snapfile_free(data);
     }
 }
 
+static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response);
+
 static bool ui_load_snapshot(size_t slot) {
     bool success = false;
     if ((slot < UI_SNAPSHOT_MAX_SLOTS) && (state.ui.snapshot.slots[slot].valid)) {
-        success = bombjack_load_snapshot(&state.sys, state.snapshots[slot].version, &state.snapshots[slot].sys);
+        if (state.snapshots[slot].loaded) {
+            success = bombjack_load_snapshot(&state.sys, state.snapshots[slot].version, &state.snapshots[slot].sys);
+        } else {
+            // only the header is in memory, load the whole snapshot file and apply it in the callback
+            success = fs_load_snapshot_async("bombjack", slot, ui_fetch_snapshot_callback);
+        }
     }
     return success;
 }
 
-static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response) {
-    assert(response);
+static bool ui_read_snapshot_info(const fs_snapshot_response_t* response, snapfile_info_t* out_info) {
+    assert(response && out_info);
     if (response->result != FS_RESULT_SUCCESS) {
+        return false;
+    }
+    if (!snapfile_read_info(response->data, "bombjack", out_info)) {
+        return false;
+    }
+    if (out_info->snapshot_version != BOMBJACK_SNAPSHOT_VERSION) {
+        return false;
+    }
+    if (out_info->snapshot_size != sizeof(bombjack_t)) {
+        return false;
+    }
+    return true;
+}
+
+static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response) {
+    snapfile_info_t info;
+    if (!ui_read_snapshot_info(response, &info)) {
         return;
     }
-    if (response->data.size != sizeof(bombjack_snapshot_t)) {
+    size_t snapshot_slot = response->snapshot_index;
+    assert(snapshot_slot < UI_SNAPSHOT_MAX_SLOTS);
+    if (!snapfile_decode(response->data, (chips_range_t){ .ptr = &state.snapshots[snapshot_slot].sys, .size = sizeof(bombjack_t) })) {
         return;
     }
-    if (((bombjack_snapshot_t*)response->data.ptr)->version != BOMBJACK_SNAPSHOT_VERSION) {
+    state.snapshots[snapshot_slot].version = info.snapshot_version;
+    state.snapshots[snapshot_slot].loaded = true;
+    bombjack_load_snapshot(&state.sys, state.snapshots[snapshot_slot].version, &state.snapshots[snapshot_slot].sys);
+}
+
+static void ui_fetch_snapshot_header_callback(const fs_snapshot_response_t* response) {
+    snapfile_info_t info;
+    if (!ui_read_snapshot_info(response, &info)) {
         return;
     }
     size_t snapshot_slot = response->snapshot_index;
     assert(snapshot_slot < UI_SNAPSHOT_MAX_SLOTS);
-    memcpy(&state.snapshots[snapshot_slot], response->data.ptr, response->data.size);
-    ui_update_snapshot_screenshot(snapshot_slot);
+    state.snapshots[snapshot_slot].version = info.snapshot_version;
+    state.snapshots[snapshot_slot].loaded = false;
+    ui_update_snapshot_screenshot(snapshot_slot, info.thumbnail);
 }
 
 static void ui_load_snapshots_from_storage(void) {
     for (size_t snapshot_slot = 0; snapshot_slot < UI_SNAPSHOT_MAX_SLOTS; snapshot_slot++) {
-        fs_load_snapshot_async("bombjack", snapshot_slot, ui_fetch_snapshot_callback);
+        fs_load_snapshot_header_async("bombjack", snapshot_slot, SNAPFILE_MAX_HEADER_SIZE, ui_fetch_snapshot_header_callback);
     }
 }
 
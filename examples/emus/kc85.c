@@ -37,6 +37,7 @@
 
 typedef struct {
     uint32_t version;
+    bool loaded;    // false if only the header has been loaded from storage
     kc85_t kc85;
 } kc85_snapshot_t;
 
@@ -45,6 +46,7 @@ static struct {
     uint32_t frame_time_us;
     uint32_t ticks;
     double emu_time_ms;
+    kc85_t rewind_snapshot;
     kc85_module_type_t delay_insert_module; // module to insert after ROM module image has been loaded
     #ifdef CHIPS_USE_UI
         ui_kc85_t ui;
@@ -108,7 +110,7 @@ static void web_dbg_read_memory(uint16_t addr, int num_bytes, uint8_t* dst_ptr);
 // audio-streaming callback
 static void push_audio(const float* samples, int num_samples, void* user_data) {
     (void)user_data;
-    saudio_push(samples, num_samples);
+    audio_push(samples, num_samples);
 }
 
 // a callback to patch some known problems in game snapshot files
@@ -159,9 +161,29 @@ kc85_desc_t kc85_desc(void) {
     };
 }
 
+#if !defined(CHIPS_USE_UI)
+// callbacks for bootcache.h
+static void boot_save_snapshot(void* dst) {
+    kc85_save_snapshot(&state.kc85, (kc85_t*)dst);
+}
+
+static bool boot_load_snapshot(void* src) {
+    return kc85_load_snapshot(&state.kc85, KC85_SNAPSHOT_VERSION, (kc85_t*)src);
+}
+
+static void boot_exec(uint32_t micro_seconds) {
+    kc85_exec(&state.kc85, micro_seconds);
+}
+#endif
+
+static void handle_input(const sapp_event* event);
+static void emu_frame(uint32_t host_frame_us);
+static void emu_input(const sapp_event* event);
+static chips_display_info_t emu_display_info(void);
+
 void app_init(void) {
-    saudio_setup(&(saudio_desc){
-        .logger.func = slog_func,
+    audio_init(&(audio_desc_t){
+        .wav_path = sargs_value("wav"),
     });
     gfx_init(&(gfx_desc_t) {
         .disable_speaker_icon = sargs_exists("disable-speaker-icon"),
@@ -290,34 +312,145 @@ void app_init(void) {
             keybuf_put(sargs_value("input"));
         }
     }
+    if (sargs_exists("warp")) {
+        clock_set_warp(CLOCK_WARP_AUTO);
+    }
+    #if !defined(CHIPS_USE_UI)
+    // skip the ROM boot (not in UI builds, the debugger should see the boot code)
+    if (!sargs_exists("cold-boot")) {
+        bootcache_boot(&(bootcache_desc_t){
+            .system_name = KC85_SYSTEM_NAME,
+            .snapshot_version = KC85_SNAPSHOT_VERSION,
+            .snapshot_size = sizeof(kc85_t),
+            .boot_frames = LOAD_DELAY_FRAMES,
+            .save_snapshot = boot_save_snapshot,
+            .load_snapshot = boot_load_snapshot,
+            .exec = boot_exec,
+        });
+    }
+    #endif
+    if (sargs_exists("rewind")) {
+        // optional rewind buffer size in MBytes
+        const int rewind_mb = atoi(sargs_value("rewind"));
+        rewind_init(&(rewind_desc_t){
+            .snapshot_size = sizeof(state.rewind_snapshot),
+            .arena_size = (size_t)((rewind_mb > 0) ? rewind_mb : 32) * 1024 * 1024,
+        });
+    }
+    // optional input recording and replay
+    movie_init(&(movie_desc_t){
+        .system_name = "kc85",
+        .record_path = sargs_value("record"),
+        .replay_path = sargs_value("replay"),
+        .input_cb = handle_input,
+    });
+    #if !defined(CHIPS_USE_UI)
+    // optionally run the emulation on its own thread, the UI debugger needs it on the main thread
+    if (sargs_exists("thread")) {
+        emuthread_init(&(emuthread_desc_t){
+            .frame_hz = 50,
+            .frame_cb = emu_frame,
+            .input_cb = emu_input,
+            .display_info_cb = emu_display_info,
+        });
+    }
+    #endif
 }
 
 static void handle_file_loading(void);
 static void send_keybuf_input(void);
 static void draw_status_bar(void);
+static bool warp_idle(void);
 
-void app_frame(void) {
-    state.frame_time_us = clock_frame_time();
+// one frame of emulation, called from app_frame() or on the emulation thread (see emuthread.h)
+static void emu_frame(uint32_t host_frame_us) {
+    state.frame_time_us = clock_frame_time_host(host_frame_us);
+    // in warp mode the audio would only overflow the stream, so drop it
+    audio_suspend(clock_warp());
     const uint64_t emu_start_time = stm_now();
-    state.ticks = kc85_exec(&state.kc85, state.frame_time_us);
+    // in warp mode, run in multiple slices until the frame's time budget is used up
+    state.ticks = 0;
+    do {
+        state.frame_time_us = movie_exec_begin(state.frame_time_us);
+        const uint32_t ticks = kc85_exec(&state.kc85, state.frame_time_us);
+        movie_exec_end(ticks);
+        state.ticks += ticks;
+        send_keybuf_input();
+        handle_file_loading();
+        if (rewind_enabled() && rewind_capture_due(state.frame_time_us)) {
+            kc85_save_snapshot(&state.kc85, &state.rewind_snapshot);
+            rewind_push(&state.rewind_snapshot);
+        }
+    } while (clock_warp_next(warp_idle()));
     state.emu_time_ms = stm_ms(stm_since(emu_start_time));
-    draw_status_bar();
-    gfx_draw(kc85_display_info(&state.kc85));
-    send_keybuf_input();
-    handle_file_loading();
+}
+
+static chips_display_info_t emu_display_info(void) {
+    return kc85_display_info(&state.kc85);
+}
+
+void app_frame(void) {
+    if (emuthread_running()) {
+        // sokol-fetch must be pumped on the main thread, finished loads are
+        // picked up by the emulation thread, so keep it between frames
+        emuthread_lock();
+        fs_dowork();
+        draw_status_bar();
+        emuthread_unlock();
+        gfx_draw(emuthread_display_info());
+    } else {
+        fs_dowork();
+        emu_frame(clock_host_frame_time());
+        draw_status_bar();
+        gfx_draw(emu_display_info());
+    }
 }
 
 void app_input(const sapp_event* event) {
-    // accept dropped files also when ImGui grabs input
+    // accept dropped files also when ImGui grabs input, the dropped file
+    // path is only valid inside the event callback on the main thread
     if (event->type == SAPP_EVENTTYPE_FILES_DROPPED) {
+        emuthread_lock();
         fs_load_dropped_file_async(FS_CHANNEL_IMAGES);
+        emuthread_unlock();
+    }
+    if (emuthread_running()) {
+        // the emulation thread owns the emulated system
+        if (event->type != SAPP_EVENTTYPE_FILES_DROPPED) {
+            emuthread_push_input(event);
+        }
+    } else {
+        emu_input(event);
     }
+}
+
+static void emu_input(const sapp_event* event) {
     #ifdef CHIPS_USE_UI
     if (ui_input(event)) {
         // input was handled by UI
         return;
     }
     #endif
+    if ((event->type == SAPP_EVENTTYPE_KEY_DOWN) && (event->key_code == SAPP_KEYCODE_PAGE_DOWN) && !event->key_repeat) {
+        clock_toggle_warp();
+        return;
+    }
+    if ((event->type == SAPP_EVENTTYPE_KEY_DOWN) && (event->key_code == SAPP_KEYCODE_PAGE_UP) && rewind_enabled()) {
+        // step back in time, keep the key pressed to continuously rewind
+        if (rewind_pop(&state.rewind_snapshot)) {
+            kc85_load_snapshot(&state.kc85, KC85_SNAPSHOT_VERSION, &state.rewind_snapshot);
+        } else {
+            gfx_flash_error();
+        }
+        return;
+    }
+    if (movie_input(event)) {
+        handle_input(event);
+    }
+}
+
+// input events which reach the emulated system, these are recorded and replayed by movie.h
+static void handle_input(const sapp_event* event) {
     const bool shift = event->modifiers & SAPP_MODIFIER_SHIFT;
     switch (event->type) {
         case SAPP_EVENTTYPE_CHAR:
@@ -389,12 +522,15 @@ void app_input(const sapp_event* event) {
 }
 
 void app_cleanup(void) {
+    emuthread_shutdown();
     kc85_discard(&state.kc85);
+    rewind_shutdown();
+    movie_shutdown();
     #ifdef CHIPS_USE_UI
         ui_kc85_discard(&state.ui);
         ui_discard();
     #endif
-    saudio_shutdown();
+    audio_shutdown();
     gfx_shutdown();
     sargs_shutdown();
 }
@@ -408,7 +544,6 @@ static void send_keybuf_input(void) {
 }
 
 static void handle_file_loading(void) {
-    fs_dowork();
     const uint32_t load_delay_frames = LOAD_DELAY_FRAMES;
     if (fs_success(FS_CHANNEL_IMAGES) && clock_frame_count_60hz() > load_delay_frames) {
         const chips_range_t file_data = fs_data(FS_CHANNEL_IMAGES);
@@ -441,6 +576,11 @@ static void handle_file_loading(void) {
     }
 }
 
+// the 'warp' command line arg fast-forwards until this returns true for a while
+static bool warp_idle(void) {
+    return keybuf_empty() && !fs_pending(FS_CHANNEL_IMAGES) && !fs_success(FS_CHANNEL_IMAGES);
+}
+
 static void draw_status_bar(void) {
     prof_push(PROF_EMU, (float)state.emu_time_ms);
     prof_stats_t emu_stats = prof_stats(PROF_EMU);
@@ -481,6 +621,13 @@ static void draw_status_bar(void) {
     sdtx_pos(0.0f, 1.5f);
     sdtx_color1i(text_color);
     sdtx_printf("frame:%.2fms emu:%.2fms (min:%.2fms max:%.2fms) ticks:%d", (float)state.frame_time_us * 0.001f, emu_stats.avg_val, emu_stats.min_val, emu_stats.max_val, state.ticks);
+    if (clock_warp()) {
+        sdtx_printf(" WARP x%.1f", clock_warp_speed());
+    }
+    const audio_stats_t audio_st = audio_stats();
+    if ((audio_st.num_underruns > 0) || (audio_st.num_overruns > 0)) {
+        sdtx_printf(" audio underruns:%u overruns:%u", audio_st.num_underruns, audio_st.num_overruns);
+    }
 }
 
 #if defined(CHIPS_USE_UI)
@@ -500,9 +647,9 @@ static void ui_boot_cb(kc85_t* sys) {
     kc85_init(sys, &desc);
 }
 
-static void ui_update_snapshot_screenshot(size_t slot) {
+static void ui_update_snapshot_screenshot(size_t slot, chips_display_info_t display_info) {
     ui_snapshot_screenshot_t screenshot = {
-        .texture = ui_create_screenshot_texture(kc85_display_info(&state.snapshots[slot].kc85))
+        .texture = ui_create_screenshot_texture(display_info)
     };
     ui_snapshot_screenshot_t prev_screenshot = ui_snapshot_set_screenshot(&state.ui.snapshot, slot, screenshot);
     if (prev_screenshot.texture) {
@@ -513,39 +660,83 @@ static void ui_update_snapshot_screenshot(size_t slot) {
 static void ui_save_snapshot(size_t slot) {
     if (slot < UI_SNAPSHOT_MAX_SLOTS) {
         state.snapshots[slot].version = kc85_save_snapshot(&state.kc85, &state.snapshots[slot].kc85);
-        ui_update_snapshot_screenshot(slot);
-        fs_save_snapshot(KC85_SYSTEM_NAME, slot, (chips_range_t){ .ptr = &state.snapshots[slot], sizeof(kc85_snapshot_t) });
+        state.snapshots[slot].loaded = true;
+        const chips_display_info_t display_info = kc85_display_info(&state.snapshots[slot].kc85);
+        ui_update_snapshot_screenshot(slot, display_info);
+        const chips_range_t data = snapfile_encode(&(snapfile_desc_t){
+            .system_name = KC85_SYSTEM_NAME,
+            .snapshot_version = state.snapshots[slot].version,
+            .snapshot = { .ptr = &state.snapshots[slot].kc85, .size = sizeof(kc85_t) },
+            .omit = display_info.frame.buffer,
+            .display_info = display_info,
+        });
+        fs_save_snapshot(KC85_SYSTEM_NAME, slot, data);
+        snapfile_free(data);
     }
 }
 
+static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response);
+
 static bool ui_load_snapshot(size_t slot) {
     bool success = false;
     if ((slot < UI_SNAPSHOT_MAX_SLOTS) && (state.ui.snapshot.slots[slot].valid)) {
-        success = kc85_load_snapshot(&state.kc85, state.snapshots[slot].version, &state.snapshots[slot].kc85);
+        if (state.snapshots[slot].loaded) {
+            success = kc85_load_snapshot(&state.kc85, state.snapshots[slot].version, &state.snapshots[slot].kc85);
+        } else {
+            // only the header is in memory, load the whole snapshot file and apply it in the callback
+            success = fs_load_snapshot_async(KC85_SYSTEM_NAME, slot, ui_fetch_snapshot_callback);
+        }
     }
     return success;
 }
 
-static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response) {
-    assert(response);
+static bool ui_read_snapshot_info(const fs_snapshot_response_t* response, snapfile_info_t* out_info) {
+    assert(response && out_info);
     if (response->result != FS_RESULT_SUCCESS) {
+        return false;
+    }
+    if (!snapfile_read_info(response->data, KC85_SYSTEM_NAME, out_info)) {
+        return false;
+    }
+    if (out_info->snapshot_version != KC85_SNAPSHOT_VERSION) {
+        return false;
+    }
+    if (out_info->snapshot_size != sizeof(kc85_t)) {
+        return false;
+    }
+    return true;
+}
+
+static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response) {
+    snapfile_info_t info;
+    if (!ui_read_snapshot_info(response, &info)) {
         return;
     }
-    if (response->data.size != sizeof(kc85_snapshot_t)) {
+    size_t snapshot_slot = response->snapshot_index;
+    assert(snapshot_slot < UI_SNAPSHOT_MAX_SLOTS);
+    if (!snapfile_decode(response->data, (chips_range_t){ .ptr = &state.snapshots[snapshot_slot].kc85, .size = sizeof(kc85_t) })) {
         return;
     }
-    if (((kc85_snapshot_t*)response->data.ptr)->version != KC85_SNAPSHOT_VERSION) {
+    state.snapshots[snapshot_slot].version = info.snapshot_version;
+    state.snapshots[snapshot_slot].loaded = true;
+    kc85_load_snapshot(&state.kc85, state.snapshots[snapshot_slot].version, &state.snapshots[snapshot_slot].kc85);
+}
+
+static void ui_fetch_snapshot_header_callback(const fs_snapshot_response_t* response) {
+    snapfile_info_t info;
+    if (!ui_read_snapshot_info(response, &info)) {
         return;
     }
     size_t snapshot_slot = response->snapshot_index;
     assert(snapshot_slot < UI_SNAPSHOT_MAX_SLOTS);
-    memcpy(&state.snapshots[snapshot_slot], response->data.ptr, response->data.size);
-    ui_update_snapshot_screenshot(snapshot_slot);
+    state.snapshots[snapshot_slot].version = info.snapshot_version;
+    state.snapshots[snapshot_slot].loaded = false;
+    ui_update_snapshot_screenshot(snapshot_slot, info.thumbnail);
 }
 
 static void ui_load_snapshots_from_storage(void) {
     for (size_t snapshot_slot = 0; snapshot_slot < UI_SNAPSHOT_MAX_SLOTS; snapshot_slot++) {
-        fs_load_snapshot_async(KC85_SYSTEM_NAME, snapshot_slot, ui_fetch_snapshot_callback);
+        fs_load_snapshot_header_async(KC85_SYSTEM_NAME, snapshot_slot, SNAPFILE_MAX_HEADER_SIZE, ui_fetch_snapshot_header_callback);
     }
 }
 
@@ -37,6 +37,7 @@
 
 typedef struct {
     uint32_t version;
+    bool loaded;    // false if only the header has been loaded from storage
     lc80_t lc80;
 } lc80_snapshot_t;
 
@@ -58,7 +59,7 @@ static void ui_load_snapshots_from_storage(void);
 
 static void push_audio(const float* samples, int num_samples, void* user_data) {
     (void)user_data;
-    saudio_push(samples, num_samples);
+    audio_push(samples, num_samples);
 }
 
 static lc80_desc_t lc80_desc(void) {
@@ -73,8 +74,8 @@ static lc80_desc_t lc80_desc(void) {
 }
 
 void app_init(void) {
-    saudio_setup(&(saudio_desc){
-        .logger.func = slog_func,
+    audio_init(&(audio_desc_t){
+        .wav_path = sargs_value("wav"),
     });
     sg_setup(&(sg_desc){
         .environment = sglue_environment(),
@@ -149,7 +150,7 @@ void app_input(const sapp_event* event) {
 void app_cleanup(void) {
     lc80_discard(&state.lc80);
     ui_lc80_discard(&state.ui);
-    saudio_shutdown();
+    audio_shutdown();
     sdtx_shutdown();
     sg_shutdown();
     sargs_shutdown();
@@ -164,6 +165,10 @@ static void draw_status_bar(void) {
     sdtx_color3b(255, 255, 255);
     sdtx_pos(1.0f, (h / 8.0f) - 1.5f);
     sdtx_printf("frame:%.2fms emu:%.2fms (min:%.2fms max:%.2fms) ticks:%d", (float)state.frame_time_us * 0.001f, emu_stats.avg_val, emu_stats.min_val, emu_stats.max_val, state.ticks);
+    const audio_stats_t audio_st = audio_stats();
+    if ((audio_st.num_underruns > 0) || (audio_st.num_overruns > 0)) {
+        sdtx_printf(" audio underruns:%u overruns:%u", audio_st.num_underruns, audio_st.num_overruns);
+    }
 }
 
 static void ui_boot_cb(lc80_t* sys) {
@@ -183,39 +188,80 @@ static void ui_save_settings_cb(ui_settings_t* settings) {
 static void ui_save_snapshot(size_t slot) {
     if (slot < UI_SNAPSHOT_MAX_SLOTS) {
         state.snapshots[slot].version = lc80_save_snapshot(&state.lc80, &state.snapshots[slot].lc80);
+        state.snapshots[slot].loaded = true;
         state.ui.win.snapshot.slots[slot].valid = true;
-        fs_save_snapshot("lc80", slot, (chips_range_t){ .ptr = &state.snapshots[slot], sizeof(lc80_snapshot_t) });
+        const chips_range_t data = snapfile_encode(&(snapfile_desc_t){
+            .system_name = "lc80",
+            .snapshot_version = state.snapshots[slot].version,
+            .snapshot = { .ptr = &state.snapshots[slot].lc80, .size = sizeof(lc80_t) },
+        });
+        fs_save_snapshot("lc80", slot, data);
+        snapfile_free(data);
     }
 }
 
+static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response);
+
 static bool ui_load_snapshot(size_t slot) {
     bool success = false;
     if ((slot < UI_SNAPSHOT_MAX_SLOTS) && (state.ui.win.snapshot.slots[slot].valid)) {
-        success = lc80_load_snapshot(&state.lc80, state.snapshots[slot].version, &state.snapshots[slot].lc80);
+        if (state.snapshots[slot].loaded) {
+            success = lc80_load_snapshot(&state.lc80, state.snapshots[slot].version, &state.snapshots[slot].lc80);
+        } else {
+            // only the header is in memory, load the whole snapshot file and apply it in the callback
+            success = fs_load_snapshot_async("lc80", slot, ui_fetch_snapshot_callback);
+        }
     }
     return success;
 }
 
-static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response) {
-    assert(response);
+static bool ui_read_snapshot_info(const fs_snapshot_response_t* response, snapfile_info_t* out_info) {
+    assert(response && out_info);
     if (response->result != FS_RESULT_SUCCESS) {
+        return false;
+    }
+    if (!snapfile_read_info(response->data, "lc80", out_info)) {
+        return false;
+    }
+    if (out_info->snapshot_version != LC80_SNAPSHOT_VERSION) {
+        return false;
+    }
+    if (out_info->snapshot_size != sizeof(lc80_t)) {
+        return false;
+    }
+    return true;
+}
+
+static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response) {
+    snapfile_info_t info;
+    if (!ui_read_snapshot_info(response, &info)) {
         return;
     }
-    if (response->data.size != sizeof(lc80_snapshot_t)) {
+    size_t snapshot_slot = response->snapshot_index;
+    assert(snapshot_slot < UI_SNAPSHOT_MAX_SLOTS);
+    if (!snapfile_decode(response->data, (chips_range_t){ .ptr = &state.snapshots[snapshot_slot].lc80, .size = sizeof(lc80_t) })) {
         return;
     }
-    if (((lc80_snapshot_t*)response->data.ptr)->version != LC80_SNAPSHOT_VERSION) {
+    state.snapshots[snapshot_slot].version = info.snapshot_version;
+    state.snapshots[snapshot_slot].loaded = true;
+    lc80_load_snapshot(&state.lc80, state.snapshots[snapshot_slot].version, &state.snapshots[snapshot_slot].lc80);
+}
+
+static void ui_fetch_snapshot_header_callback(const fs_snapshot_response_t* response) {
+    snapfile_info_t info;
+    if (!ui_read_snapshot_info(response, &info)) {
         return;
     }
     size_t snapshot_slot = response->snapshot_index;
     assert(snapshot_slot < UI_SNAPSHOT_MAX_SLOTS);
-    memcpy(&state.snapshots[snapshot_slot], response->data.ptr, response->data.size);
+    state.snapshots[snapshot_slot].version = info.snapshot_version;
+    state.snapshots[snapshot_slot].loaded = false;
     state.ui.win.snapshot.slots[snapshot_slot].valid = true;
 }
 
 static void ui_load_snapshots_from_storage(void) {
     for (size_t snapshot_slot = 0; snapshot_slot < UI_SNAPSHOT_MAX_SLOTS; snapshot_slot++) {
-        fs_load_snapshot_async("lc80", snapshot_slot, ui_fetch_snapshot_callback);
+        fs_load_snapshot_header_async("lc80", snapshot_slot, SNAPFILE_MAX_HEADER_SIZE, ui_fetch_snapshot_header_callback);
     }
 }
 
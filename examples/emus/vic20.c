@@ -11,6 +11,13 @@
 #include "chips/mem.h"
 #include "chips/clk.h"
 #include "systems/c1530.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_IMPL
+    #define CHIPPROF_WRAP_M6502
+    #define CHIPPROF_WRAP_M6522
+    #define CHIPPROF_WRAP_M6561
+    #include "chipprof.h"
+#endif
 #include "systems/vic20.h"
 #include "vic20-roms.h"
 #if defined(CHIPS_USE_UI)
@@ -35,6 +42,7 @@
 
 typedef struct {
     uint32_t version;
+    bool loaded;    // false if only the header has been loaded from storage
     vic20_t vic20;
 } vic20_snapshot_t;
 
@@ -43,6 +51,8 @@ static struct {
     uint32_t frame_time_us;
     uint32_t ticks;
     double emu_time_ms;
+    bool auto_warp;
+    vic20_t rewind_snapshot;
     #ifdef CHIPS_USE_UI
         ui_vic20_t ui;
         vic20_snapshot_t snapshots[UI_SNAPSHOT_MAX_SLOTS];
@@ -63,11 +73,12 @@ static void ui_load_snapshots_from_storage(void);
 #define BORDER_LEFT (8)
 #define BORDER_RIGHT (8)
 #define BORDER_BOTTOM (16)
+#define LOAD_DELAY_FRAMES (180)
 
 // audio-streaming callback
 static void push_audio(const float* samples, int num_samples, void* user_data) {
     (void)user_data;
-    saudio_push(samples, num_samples);
+    audio_push(samples, num_samples);
 }
 
 // get vic20_desc_t struct based on joystick type
@@ -92,9 +103,29 @@ vic20_desc_t vic20_desc(vic20_joystick_type_t joy_type, vic20_memory_config_t me
     };
 }
 
+#if !defined(CHIPS_USE_UI)
+// callbacks for bootcache.h
+static void boot_save_snapshot(void* dst) {
+    vic20_save_snapshot(&state.vic20, (vic20_t*)dst);
+}
+
+static bool boot_load_snapshot(void* src) {
+    return vic20_load_snapshot(&state.vic20, VIC20_SNAPSHOT_VERSION, (vic20_t*)src);
+}
+
+static void boot_exec(uint32_t micro_seconds) {
+    vic20_exec(&state.vic20, micro_seconds);
+}
+#endif
+
+static void handle_input(const sapp_event* event);
+static void emu_frame(uint32_t host_frame_us);
+static void emu_input(const sapp_event* event);
+static chips_display_info_t emu_display_info(void);
+
 void app_init(void) {
-    saudio_setup(&(saudio_desc){
-        .logger.func = slog_func,
+    audio_init(&(audio_desc_t){
+        .wav_path = sargs_value("wav"),
     });
     vic20_joystick_type_t joy_type = VIC20_JOYSTICKTYPE_NONE;
     if (sargs_exists("joystick")) {
@@ -142,6 +173,9 @@ void app_init(void) {
     keybuf_init(&(keybuf_desc_t){ .key_delay_frames=5 });
     clock_init();
     prof_init();
+    #if defined(CHIPS_USE_CHIPPROF)
+    chipprof_init();
+    #endif
     fs_init();
     #ifdef CHIPS_USE_UI
         ui_init(&(ui_desc_t){
@@ -197,35 +231,157 @@ void app_init(void) {
             keybuf_put(sargs_value("input"));
         }
     }
+    if (sargs_exists("warp")) {
+        clock_set_warp(CLOCK_WARP_AUTO);
+    }
+    state.auto_warp = !sargs_exists("disable-auto-warp");
+    #if !defined(CHIPS_USE_UI)
+    // skip the ROM boot (not in UI builds, the debugger should see the boot code)
+    if (!sargs_exists("cold-boot")) {
+        bootcache_boot(&(bootcache_desc_t){
+            .system_name = "vic20",
+            .snapshot_version = VIC20_SNAPSHOT_VERSION,
+            .snapshot_size = sizeof(vic20_t),
+            .boot_frames = LOAD_DELAY_FRAMES,
+            .save_snapshot = boot_save_snapshot,
+            .load_snapshot = boot_load_snapshot,
+            .exec = boot_exec,
+        });
+    }
+    #endif
+    if (sargs_exists("rewind")) {
+        // optional rewind buffer size in MBytes
+        const int rewind_mb = atoi(sargs_value("rewind"));
+        rewind_init(&(rewind_desc_t){
+            .snapshot_size = sizeof(state.rewind_snapshot),
+            .arena_size = (size_t)((rewind_mb > 0) ? rewind_mb : 32) * 1024 * 1024,
+        });
+    }
+    // optional input recording and replay
+    movie_init(&(movie_desc_t){
+        .system_name = "vic20",
+        .record_path = sargs_value("record"),
+        .replay_path = sargs_value("replay"),
+        .input_cb = handle_input,
+    });
+    #if !defined(CHIPS_USE_UI)
+    // optionally run the emulation on its own thread, the UI debugger needs it on the main thread
+    if (sargs_exists("thread")) {
+        emuthread_init(&(emuthread_desc_t){
+            .frame_hz = 50,
+            .frame_cb = emu_frame,
+            .input_cb = emu_input,
+            .display_info_cb = emu_display_info,
+        });
+    }
+    #endif
 }
 
 static void handle_file_loading(void);
 static void send_keybuf_input(void);
 static void draw_status_bar(void);
+static bool warp_idle(void);
+static bool drive_busy(void);
 
 // per frame stuff, tick the emulator, handle input, decode and draw emulator display
-void app_frame(void) {
-    state.frame_time_us = clock_frame_time();
+// one frame of emulation, called from app_frame() or on the emulation thread (see emuthread.h)
+static void emu_frame(uint32_t host_frame_us) {
+    if (state.auto_warp) {
+        clock_auto_warp(drive_busy());
+    }
+    state.frame_time_us = clock_frame_time_host(host_frame_us);
+    // in warp mode the audio would only overflow the stream, so drop it
+    audio_suspend(clock_warp());
     const uint64_t emu_start_time = stm_now();
-    state.ticks = vic20_exec(&state.vic20, state.frame_time_us);
+    // in warp mode, run in multiple slices until the frame's time budget is used up
+    state.ticks = 0;
+    do {
+        state.frame_time_us = movie_exec_begin(state.frame_time_us);
+        #if defined(CHIPS_USE_CHIPPROF)
+        chipprof_begin_frame();
+        #endif
+        const uint32_t ticks = vic20_exec(&state.vic20, state.frame_time_us);
+        movie_exec_end(ticks);
+        state.ticks += ticks;
+        #if defined(CHIPS_USE_CHIPPROF)
+        chipprof_end_frame();
+        #endif
+        handle_file_loading();
+        send_keybuf_input();
+        if (rewind_enabled() && rewind_capture_due(state.frame_time_us)) {
+            vic20_save_snapshot(&state.vic20, &state.rewind_snapshot);
+            rewind_push(&state.rewind_snapshot);
+        }
+    } while (clock_warp_next(warp_idle()));
     state.emu_time_ms = stm_ms(stm_since(emu_start_time));
-    draw_status_bar();
-    gfx_draw(vic20_display_info(&state.vic20));
-    handle_file_loading();
-    send_keybuf_input();
+}
+
+static chips_display_info_t emu_display_info(void) {
+    return vic20_display_info(&state.vic20);
+}
+
+void app_frame(void) {
+    if (emuthread_running()) {
+        // sokol-fetch must be pumped on the main thread, finished loads are
+        // picked up by the emulation thread, so keep it between frames
+        emuthread_lock();
+        fs_dowork();
+        draw_status_bar();
+        emuthread_unlock();
+        gfx_draw(emuthread_display_info());
+    } else {
+        fs_dowork();
+        emu_frame(clock_host_frame_time());
+        draw_status_bar();
+        gfx_draw(emu_display_info());
+    }
 }
 
 void app_input(const sapp_event* event) {
-    // accept dropped files also when ImGui grabs input
+    // accept dropped files also when ImGui grabs input, the dropped file
+    // path is only valid inside the event callback on the main thread
     if (event->type == SAPP_EVENTTYPE_FILES_DROPPED) {
+        emuthread_lock();
         fs_load_dropped_file_async(FS_CHANNEL_IMAGES);
+        emuthread_unlock();
+    }
+    if (emuthread_running()) {
+        // the emulation thread owns the emulated system
+        if (event->type != SAPP_EVENTTYPE_FILES_DROPPED) {
+            emuthread_push_input(event);
+        }
+    } else {
+        emu_input(event);
     }
+}
+
+static void emu_input(const sapp_event* event) {
     #ifdef CHIPS_USE_UI
     if (ui_input(event)) {
         // input was handled by UI
         return;
     }
     #endif
+    if ((event->type == SAPP_EVENTTYPE_KEY_DOWN) && (event->key_code == SAPP_KEYCODE_PAGE_DOWN) && !event->key_repeat) {
+        clock_toggle_warp();
+        return;
+    }
+    if ((event->type == SAPP_EVENTTYPE_KEY_DOWN) && (event->key_code == SAPP_KEYCODE_PAGE_UP) && rewind_enabled()) {
+        // step back in time, keep the key pressed to continuously rewind
+        if (rewind_pop(&state.rewind_snapshot)) {
+            vic20_load_snapshot(&state.vic20, VIC20_SNAPSHOT_VERSION, &state.rewind_snapshot);
+        } else {
+            gfx_flash_error();
+        }
+        return;
+    }
+    if (movie_input(event)) {
+        handle_input(event);
+    }
+}
+
+// input events which reach the emulated system, these are recorded and replayed by movie.h
+static void handle_input(const sapp_event* event) {
     const bool shift = event->modifiers & SAPP_MODIFIER_SHIFT;
     switch (event->type) {
         int c;
@@ -279,12 +435,22 @@ void app_input(const sapp_event* event) {
 }
 
 void app_cleanup(void) {
+    emuthread_shutdown();
     vic20_discard(&state.vic20);
+    rewind_shutdown();
+    movie_shutdown();
+    #if defined(CHIPS_USE_CHIPPROF)
+        chipprof_print_table(stdout, "vic20");
+        if (sargs_exists("chipprof-trace")) {
+            chipprof_write_trace(sargs_value("chipprof-trace"), "vic20");
+        }
+        chipprof_shutdown();
+    #endif
     #ifdef CHIPS_USE_UI
         ui_vic20_discard(&state.ui);
         ui_discard();
     #endif
-    saudio_shutdown();
+    audio_shutdown();
     gfx_shutdown();
     sargs_shutdown();
 }
@@ -302,8 +468,7 @@ static void send_keybuf_input(void) {
 }
 
 static void handle_file_loading(void) {
-    fs_dowork();
-    const uint32_t load_delay_frames = 180;
+    const uint32_t load_delay_frames = LOAD_DELAY_FRAMES;
     if (fs_success(FS_CHANNEL_IMAGES) && clock_frame_count_60hz() > load_delay_frames) {
         bool load_success = false;
         if (fs_ext(FS_CHANNEL_IMAGES, "txt") || fs_ext(FS_CHANNEL_IMAGES, "bas")) {
@@ -347,6 +512,16 @@ static void handle_file_loading(void) {
     }
 }
 
+// true while the tape drive is loading
+static bool drive_busy(void) {
+    return vic20_is_tape_motor_on(&state.vic20);
+}
+
+// the 'warp' command line arg fast-forwards until this returns true for a while
+static bool warp_idle(void) {
+    return keybuf_empty() && !fs_pending(FS_CHANNEL_IMAGES) && !fs_success(FS_CHANNEL_IMAGES) && !drive_busy();
+}
+
 static void draw_status_bar(void) {
     prof_push(PROF_EMU, (float)state.emu_time_ms);
     prof_stats_t emu_stats = prof_stats(PROF_EMU);
@@ -356,6 +531,20 @@ static void draw_status_bar(void) {
     sdtx_color3b(255, 255, 255);
     sdtx_pos(1.0f, (h / 8.0f) - 1.5f);
     sdtx_printf("frame:%.2fms emu:%.2fms (min:%.2fms max:%.2fms) ticks:%d", (float)state.frame_time_us * 0.001f, emu_stats.avg_val, emu_stats.min_val, emu_stats.max_val, state.ticks);
+    if (clock_warp()) {
+        sdtx_printf(" WARP x%.1f", clock_warp_speed());
+    }
+    const audio_stats_t audio_st = audio_stats();
+    if ((audio_st.num_underruns > 0) || (audio_st.num_overruns > 0)) {
+        sdtx_printf(" audio underruns:%u overruns:%u", audio_st.num_underruns, audio_st.num_overruns);
+    }
+    #if defined(CHIPS_USE_CHIPPROF)
+        char chip_stats[256];
+        chipprof_format_last_frame(chip_stats, sizeof(chip_stats));
+        sdtx_origin(0.0f, 0.0f);
+        sdtx_pos(1.0f, 0.0f);
+        sdtx_puts(chip_stats);
+    #endif
 }
 
 #if defined(CHIPS_USE_UI)
@@ -374,9 +563,9 @@ static void ui_boot_cb(vic20_t* sys) {
     vic20_init(sys, &desc);
 }
 
-static void ui_update_snapshot_screenshot(size_t slot) {
+static void ui_update_snapshot_screenshot(size_t slot, chips_display_info_t display_info) {
     ui_snapshot_screenshot_t screenshot = {
-        .texture = ui_create_screenshot_texture(vic20_display_info(&state.snapshots[slot].vic20))
+        .texture = ui_create_screenshot_texture(display_info)
     };
     ui_snapshot_screenshot_t prev_screenshot = ui_snapshot_set_screenshot(&state.ui.snapshot, slot, screenshot);
     if (prev_screenshot.texture) {
@@ -387,39 +576,83 @@ static void ui_update_snapshot_screenshot(size_t slot) {
 static void ui_save_snapshot(size_t slot) {
     if (slot < UI_SNAPSHOT_MAX_SLOTS) {
         state.snapshots[slot].version = vic20_save_snapshot(&state.vic20, &state.snapshots[slot].vic20);
-        ui_update_snapshot_screenshot(slot);
-        fs_save_snapshot("vic20", slot, (chips_range_t){ .ptr = &state.snapshots[slot], sizeof(vic20_snapshot_t) });
+        state.snapshots[slot].loaded = true;
+        const chips_display_info_t display_info = vic20_display_info(&state.snapshots[slot].vic20);
+        ui_update_snapshot_screenshot(slot, display_info);
+        const chips_range_t data = snapfile_encode(&(snapfile_desc_t){
+            .system_name = "vic20",
+            .snapshot_version = state.snapshots[slot].version,
+            .snapshot = { .ptr = &state.snapshots[slot].vic20, .size = sizeof(vic20_t) },
+            .omit = display_info.frame.buffer,
+            .display_info = display_info,
+        });
+        fs_save_snapshot("vic20", slot, data);
+        snapfile_free(data);
     }
 }
 
+static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response);
+
 static bool ui_load_snapshot(size_t slot) {
     bool success = false;
     if ((slot < UI_SNAPSHOT_MAX_SLOTS) && (state.ui.snapshot.slots[slot].valid)) {
-        success = vic20_load_snapshot(&state.vic20, state.snapshots[slot].version, &state.snapshots[slot].vic20);
+        if (state.snapshots[slot].loaded) {
+            success = vic20_load_snapshot(&state.vic20, state.snapshots[slot].version, &state.snapshots[slot].vic20);
+        } else {
+            // only the header is in memory, load the whole snapshot file and apply it in the callback
+            success = fs_load_snapshot_async("vic20", slot, ui_fetch_snapshot_callback);
+        }
     }
     return success;
 }
 
-static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response) {
-    assert(response);
+static bool ui_read_snapshot_info(const fs_snapshot_response_t* response, snapfile_info_t* out_info) {
+    assert(response && out_info);
     if (response->result != FS_RESULT_SUCCESS) {
+        return false;
+    }
+    if (!snapfile_read_info(response->data, "vic20", out_info)) {
+        return false;
+    }
+    if (out_info->snapshot_version != VIC20_SNAPSHOT_VERSION) {
+        return false;
+    }
+    if (out_info->snapshot_size != sizeof(vic20_t)) {
+        return false;
+    }
+    return true;
+}
+
+static void ui_fetch_snapshot_callback(const fs_snapshot_response_t* response) {
+    snapfile_info_t info;
+    if (!ui_read_snapshot_info(response, &info)) {
         return;
     }
-    if (response->data.size != sizeof(vic20_snapshot_t)) {
+    size_t snapshot_slot = response->snapshot_index;
+    assert(snapshot_slot < UI_SNAPSHOT_MAX_SLOTS);
+    if (!snapfile_decode(response->data, (chips_range_t){ .ptr = &state.snapshots[snapshot_slot].vic20, .size = sizeof(vic20_t) })) {
         return;
     }
-    if (((vic20_snapshot_t*)response->data.ptr)->version != VIC20_SNAPSHOT_VERSION) {
+    state.snapshots[snapshot_slot].version = info.snapshot_version;
+    state.snapshots[snapshot_slot].loaded = true;
+    vic20_load_snapshot(&state.vic20, state.snapshots[snapshot_slot].version, &state.snapshots[snapshot_slot].vic20);
+}
+
+static void ui_fetch_snapshot_header_callback(const fs_snapshot_response_t* response) {
+    snapfile_info_t info;
+    if (!ui_read_snapshot_info(response, &info)) {
         return;
     }
     size_t snapshot_slot = response->snapshot_index;
     assert(snapshot_slot < UI_SNAPSHOT_MAX_SLOTS);
-    memcpy(&state.snapshots[snapshot_slot], response->data.ptr, response->data.size);
-    ui_update_snapshot_screenshot(snapshot_slot);
+    state.snapshots[snapshot_slot].version = info.snapshot_version;
+    state.snapshots[snapshot_slot].loaded = false;
+    ui_update_snapshot_screenshot(snapshot_slot, info.thumbnail);
 }
 
 static void ui_load_snapshots_from_storage(void) {
     for (size_t snapshot_slot = 0; snapshot_slot < UI_SNAPSHOT_MAX_SLOTS; snapshot_slot++) {
-        fs_load_snapshot_async("vic20", snapshot_slot, ui_fetch_snapshot_callback);
+        fs_load_snapshot_header_async("vic20", snapshot_slot, SNAPFILE_MAX_HEADER_SIZE, ui_fetch_snapshot_header_callback);
     }
 }
 #endif
@@ -1,6 +1,7 @@
-// a fibs code generator to turn fuse test files into a C header
+// a fibs code generator to turn fuse test files into binary test vector files (see tests/testvec.h)
 import { Configurer, Project, Config, Target, Schema, log, util } from 'jsr:@floooh/fibs@^1';
 import { dirname } from 'jsr:@std/path@^1';
+import { TestVecWriter } from './testvec.ts';
 
 export function addFuseJob(c: Configurer) {
     c.addJob({ name: 'fuse', help, validate, build });
@@ -10,18 +11,20 @@ type Args = {
     dir?: string,
     fuse_input_file: string,
     fuse_expected_file: string,
-    outHeader: string,
+    outInput: string,
+    outExpected: string,
 };
 
 const schema: Schema = {
     dir: { type: 'string', optional: true, desc: 'base dir of files to embed (default: target source dir)' },
     fuse_input_file: { type: 'string', optional: false, desc: 'the fuse tests.in file path' },
     fuse_expected_file: { type: 'string', optional: false, desc: 'the fuse tests.expected file path' },
-    outHeader: { type: 'string', optional: false, desc: 'path of generated header file' },
+    outInput: { type: 'string', optional: false, desc: 'path of generated binary file for tests.in' },
+    outExpected: { type: 'string', optional: false, desc: 'path of generated binary file for tests.expected' },
 };
 
 function help() {
-    log.helpJob('fuse', 'generate C header from fuse test files', schema);
+    log.helpJob('fuse', 'generate binary test vector files from fuse test files', schema);
 }
 
 function validate(args: unknown) {
@@ -32,99 +35,135 @@ function tokenize(s: string): string[] {
     return s.trim().split(/\s+/).filter((t) => t.length > 0);
 }
 
+const hex = (s: string) => parseInt(s, 16);
+
+// must match the structs in tests/z80-fuse.c
+const RECORD_SIZE = 52;
+const MAX_BYTES = 32;
+const EVENT_TYPES: Record<string, number> = { MR: 1, MW: 2, PR: 3, PW: 4 };
+
+type FuseEvent = { tick: number, type: number, addr: number, data: number };
+type FuseChunk = { addr: number, bytes: number[] };
+type FuseTest = {
+    desc: string,
+    events: FuseEvent[],
+    regs: number[],     // af bc de hl af_ bc_ de_ hl_ ix iy sp pc
+    regs2: number[],    // i r iff1 iff2 im halted ticks
+    chunks: FuseChunk[],
+};
+
+function parse(data: string): FuseTest[] {
+    const lines = data.split(/\r?\n/);
+    const tests: FuseTest[] = [];
+    let tok: string[];
+    for (let li = 0; li < lines.length;) {
+        const nextLine = (): string => lines[li++] ?? '';
+        let line = nextLine();
+        if (line === '') {
+            continue;
+        }
+        const test: FuseTest = { desc: line, events: [], regs: [], regs2: [], chunks: [] };
+        // optional events start with spaces
+        line = nextLine();
+        while (line[0] === ' ') {
+            tok = tokenize(line);
+            if (tok.length === 4) {
+                const type = EVENT_TYPES[tok[1]];
+                if (type === undefined) {
+                    throw new Error(`fuse: unknown event type '${tok[1]}' in test '${test.desc}'`);
+                }
+                test.events.push({ tick: parseInt(tok[0], 10), type, addr: hex(tok[2]), data: hex(tok[3]) });
+            }
+            line = nextLine();
+        }
+        // 16-bit registers
+        tok = tokenize(line);
+        if (tok.length === 12) {
+            test.regs = tok.map(hex);
+        }
+        // additional registers and flags
+        tok = tokenize(nextLine());
+        if (tok.length === 7) {
+            test.regs2 = [hex(tok[0]), hex(tok[1]), ...tok.slice(2).map((t) => parseInt(t, 10))];
+        }
+        // optional memory chunks
+        tok = tokenize(nextLine());
+        if (tok.length > 1) {
+            while (tok.length > 0) {
+                if (tok[0] !== '-1') {
+                    const chunk: FuseChunk = { addr: hex(tok[0]), bytes: [] };
+                    for (let i = 1; tok[i] !== '-1'; i++) {
+                        chunk.bytes.push(hex(tok[i]));
+                    }
+                    if (chunk.bytes.length > MAX_BYTES) {
+                        throw new Error(`fuse: memory chunk too big in test '${test.desc}'`);
+                    }
+                    test.chunks.push(chunk);
+                }
+                tok = tokenize(nextLine());
+            }
+        }
+        if ((test.regs.length !== 12) || (test.regs2.length !== 7)) {
+            throw new Error(`fuse: malformed register state in test '${test.desc}'`);
+        }
+        tests.push(test);
+    }
+    return tests;
+}
+
+function write(tests: FuseTest[]): Uint8Array {
+    const w = new TestVecWriter('FUSE', RECORD_SIZE, tests.length);
+    for (const test of tests) {
+        const descOffset = w.extraOffset();
+        w.extra.cString(test.desc);
+        const eventsOffset = w.extraOffset();
+        for (const ev of test.events) {
+            w.extra.i32(ev.tick);
+            w.extra.u16(ev.addr);
+            w.extra.u8(ev.type);
+            w.extra.u8(ev.data);
+        }
+        const chunksOffset = w.extraOffset();
+        for (const chunk of test.chunks) {
+            w.extra.u16(chunk.addr);
+            w.extra.u16(chunk.bytes.length);
+            for (let i = 0; i < MAX_BYTES; i++) {
+                w.extra.u8(chunk.bytes[i] ?? 0);
+            }
+        }
+        const r = w.records;
+        r.u32(descOffset);
+        r.u32(eventsOffset);
+        r.u32(chunksOffset);
+        r.u16(test.events.length);
+        r.u16(test.chunks.length);
+        test.regs.forEach((v) => r.u16(v));
+        test.regs2.slice(0, 6).forEach((v) => r.u8(v));
+        r.u16(0);
+        r.i32(test.regs2[6]);
+        w.endRecord();
+    }
+    return w.finish();
+}
+
 function build(_p: Project, _c: Config, t: Target, args: unknown) {
-    const { dir = t.dir, fuse_input_file, fuse_expected_file, outHeader } = util.safeCast<Args>(args, schema);
+    const { dir = t.dir, fuse_input_file, fuse_expected_file, outInput, outExpected } = util.safeCast<Args>(args, schema);
     return {
         name: 'fuse',
         inputs: [`${dir}/${fuse_input_file}`, `${dir}/${fuse_expected_file}`],
-        outputs: [`${dir}/${outHeader}`],
-        addOutputsToTargetSources: true,
-        args: { dir, fuse_input_file, fuse_expected_file, outHeader },
+        outputs: [`${dir}/${outInput}`, `${dir}/${outExpected}`],
+        addOutputsToTargetSources: false,
+        args: { dir, fuse_input_file, fuse_expected_file, outInput, outExpected },
         func: async (inputs: string[], outputs: string[], _args: Args): Promise<void> => {
             if (!util.dirty(inputs, outputs)) {
                 return;
             }
-            util.ensureDir(dirname(outputs[0]));
-            let str = '// machine generated, do not edit!\n';
-            const items = [
-                { file: inputs[0], cname: 'fuse_input' },
-                { file: inputs[1], cname: 'fuse_expected' },
-            ];
-            const l = (s: string) => str += s;
-            for (const item of items) {
-                log.info(`# fuse ${item.file} => ${outputs[0]}`);
-                const data = await Deno.readTextFile(item.file);
-                const lines = data.split(/\r?\n/);
-                let num_tests = 0;
-                let tok: string[];
-                l(`fuse_test_t ${item.cname}[] = {\n`);
-                for (let li = 0; li < lines.length;) {
-                    const nextLine = (): string => lines[li++] ?? '';
-                    let line = nextLine();
-                    if (line === '') {
-                        continue;
-                    }
-                    l('  {\n');
-                    num_tests += 1;
-                    // description
-                    str += `    .desc = "${line}",\n`
-                    // optional events start with spaces
-                    line = nextLine();
-                    if (line[0] === ' ') {
-                        let num_events = 0;
-                        l('    .events = {\n');
-                        while (line[0] === ' ') {
-                            tok = tokenize(line);
-                            if (tok.length === 4) {
-                                l(`      { .tick=${tok[0]}, .type=EVENT_${tok[1]}, .addr=0x${tok[2]}, .data=0x${tok[3]} },\n`);
-                                num_events += 1;
-                            }
-                            line = nextLine();
-                        }
-                        l('    },\n');
-                        l(`    .num_events = ${num_events},\n`);
-                    }
-                    // 16-bit registers
-                    tok = tokenize(line);
-                    l(`    .state = {\n`);
-                    if (tok.length === 12) {
-                        l(`      .af=0x${tok[0]}, .bc=0x${tok[1]}, .de=0x${tok[2]}, .hl=0x${tok[3]},\n`);
-                        l(`      .af_=0x${tok[4]}, .bc_=0x${tok[5]}, .de_=0x${tok[6]}, .hl_=0x${tok[7]},\n`);
-                        l(`      .ix=0x${tok[8]}, .iy=0x${tok[9]}, .sp=0x${tok[10]}, .pc=0x${tok[11]},\n`);
-                    }
-                    // additional registers and flags
-                    tok = tokenize(nextLine());
-                    if (tok.length === 7) {
-                        l(`      .i=0x${tok[0]}, .r=0x${tok[1]}, .iff1=${tok[2]}, .iff2=${tok[3]}, .im=${tok[4]}, .halted=${tok[5]}, .ticks=${tok[6]}\n`);
-                    }
-                    l('    },\n');
-                    // optional memory chunks
-                    let num_chunks = 0;
-                    tok = tokenize(nextLine());
-                    if (tok.length > 1) {
-                        l(`    .chunks = {\n`);
-                        while (tok.length > 0) {
-                            if (tok[0] !== '-1') {
-                                l(`      { .addr=0x${tok[0]}, .bytes = { `);
-                                let i = 1;
-                                while (tok[i] !== '-1') {
-                                    l(`0x${tok[i]},`);
-                                    i += 1;
-                                }
-                                l(`}, .num_bytes=${i-1}, },\n`);
-                                num_chunks += 1;
-                            }
-                            tok = tokenize(nextLine());
-                        }
-                        l('    },\n');
-                    }
-                    l(`    .num_chunks = ${num_chunks},\n`);
-                    l(`  },\n`);
-                }
-                l(`};\n`);
-                l(`const int ${item.cname}_num = ${num_tests};\n`);
+            for (let i = 0; i < inputs.length; i++) {
+                log.info(`# fuse ${inputs[i]} => ${outputs[i]}`);
+                util.ensureDir(dirname(outputs[i]));
+                const tests = parse(await Deno.readTextFile(inputs[i]));
+                await Deno.writeFile(outputs[i], write(tests));
             }
-            await Deno.writeTextFile(outputs[0], str);
         }
     }
 }
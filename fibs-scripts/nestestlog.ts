@@ -1,6 +1,7 @@
-// a fibs code generator to turn a NESTest log file into a C header
+// a fibs code generator to turn a NESTest log file into a binary test vector file (see tests/testvec.h)
 import { Configurer, Project, Config, Target, Schema, log, util } from 'jsr:@floooh/fibs@^1';
 import { dirname } from 'jsr:@std/path@^1';
+import { TestVecWriter } from './testvec.ts';
 
 export function addNesTestLogJob(c: Configurer) {
     c.addJob({ name: 'nestestlog', help, validate, build });
@@ -9,62 +10,57 @@ export function addNesTestLogJob(c: Configurer) {
 type Args = {
     dir?: string;
     input: string;
-    outHeader: string;
+    outFile: string;
 };
 
 const schema: Schema = {
     dir: { type: 'string', optional: true, desc: 'base dir of files to embed (default: target source dir)' },
     input: { type: 'string', optional: false, desc: 'the input nestestlog.txt file' },
-    outHeader: { type: 'string', optional: false, desc: 'path of generated header file' },
+    outFile: { type: 'string', optional: false, desc: 'path of generated binary file' },
 };
 
 function help() {
-    log.helpJob('nestestlog', 'generate C header from nestest log file', schema);
+    log.helpJob('nestestlog', 'generate binary test vector file from nestest log file', schema);
 }
 
 function validate(args: unknown) {
     return util.validate(args, schema);
 }
 
+// must match cpu_state_t in tests/m6502-nestest.c
+const DESC_SIZE = 36;
+const RECORD_SIZE = 44;
+
 function build(_p: Project, _c: Config, t: Target, args: unknown) {
-    const { dir = t.dir, input, outHeader } = util.safeCast<Args>(args, schema);
+    const { dir = t.dir, input, outFile } = util.safeCast<Args>(args, schema);
     return {
         name: 'nestestlog',
         inputs: [`${dir}/${input}`],
-        outputs: [`${dir}/${outHeader}`],
-        addOutputsToTargetSources: true,
-        args: { dir, input, outHeader },
+        outputs: [`${dir}/${outFile}`],
+        addOutputsToTargetSources: false,
+        args: { dir, input, outFile },
         func: async (inputs: string[], outputs: string[], _args: Args): Promise<void> => {
             if (!util.dirty(inputs, outputs)) {
                 return;
             }
             log.info(`# nestestlog ${inputs[0]} => ${outputs[0]}`);
             const data = await Deno.readTextFile(inputs[0])
-            const lines = data.split(/\r?\n/);
+            const lines = data.split(/\r?\n/).filter((line) => line.trim().length > 0);
             util.ensureDir(dirname(outputs[0]));
-            let str = '';
-            str += '// machine generated, do not edit!\n';
-            str += '#include <stdint.h>\n';
-            str += 'typedef struct {\n';
-            str += '    const char* desc;\n';
-            str += '    uint16_t PC;\n';
-            str += '    uint8_t A,X,Y,P,S;\n';
-            str += '} cpu_state;\n';
-            str += 'cpu_state state_table[] = {\n';
+            const w = new TestVecWriter('NEST', RECORD_SIZE, lines.length);
+            const hex = (s: string) => parseInt(s, 16);
             for (const line of lines) {
-                if (line.trim().length > 0) {
-                    const desc = line.slice(16, 48);
-                    const pc = line.slice(0, 4);
-                    const a = line.slice(50, 52);
-                    const x = line.slice(55, 57);
-                    const y = line.slice(60, 62);
-                    const p = line.slice(65, 67);
-                    const s = line.slice(71, 73);
-                    str += `  { "${desc}", 0x${pc}, 0x${a}, 0x${x}, 0x${y}, 0x${p}, 0x${s} },\n`;
-                }
+                w.records.fixedString(line.slice(16, 48), DESC_SIZE);
+                w.records.u16(hex(line.slice(0, 4)));         // PC
+                w.records.u8(hex(line.slice(50, 52)));        // A
+                w.records.u8(hex(line.slice(55, 57)));        // X
+                w.records.u8(hex(line.slice(60, 62)));        // Y
+                w.records.u8(hex(line.slice(65, 67)));        // P
+                w.records.u8(hex(line.slice(71, 73)));        // S
+                w.records.u8(0);
+                w.endRecord();
             }
-            str += '};\n';
-            await Deno.writeTextFile(outputs[0], str);
+            await Deno.writeFile(outputs[0], w.finish());
         },
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,119 @@
+// helper for fibs code generators which write binary test vector files,
+// the file layout must match tests/testvec.h
+export const TESTVEC_VERSION = 1;
+export const HEADER_SIZE = 32;
+
+export function fourcc(s: string): number {
+    return (s.charCodeAt(0) | (s.charCodeAt(1) << 8) | (s.charCodeAt(2) << 16) | (s.charCodeAt(3) << 24)) >>> 0;
+}
+
+// a growable little-endian byte buffer
+export class ByteWriter {
+    bytes = new Uint8Array(1 << 16);
+    view = new DataView(this.bytes.buffer);
+    pos = 0;
+
+    reserve(num: number) {
+        if (this.pos + num > this.bytes.length) {
+            let size = this.bytes.length * 2;
+            while (this.pos + num > size) {
+                size *= 2;
+            }
+            const bytes = new Uint8Array(size);
+            bytes.set(this.bytes);
+            this.bytes = bytes;
+            this.view = new DataView(this.bytes.buffer);
+        }
+    }
+    align(alignment: number) {
+        while ((this.pos % alignment) !== 0) {
+            this.u8(0);
+        }
+    }
+    u8(val: number) {
+        this.reserve(1);
+        this.view.setUint8(this.pos, val);
+        this.pos += 1;
+    }
+    u16(val: number) {
+        this.reserve(2);
+        this.view.setUint16(this.pos, val, true);
+        this.pos += 2;
+    }
+    u32(val: number) {
+        this.reserve(4);
+        this.view.setUint32(this.pos, val, true);
+        this.pos += 4;
+    }
+    i32(val: number) {
+        this.reserve(4);
+        this.view.setInt32(this.pos, val, true);
+        this.pos += 4;
+    }
+    // fixed size, zero-padded string
+    fixedString(str: string, size: number) {
+        const enc = new TextEncoder().encode(str);
+        this.reserve(size);
+        this.bytes.fill(0, this.pos, this.pos + size);
+        this.bytes.set(enc.subarray(0, size - 1), this.pos);
+        this.pos += size;
+    }
+    // zero-terminated string
+    cString(str: string) {
+        const enc = new TextEncoder().encode(str);
+        this.reserve(enc.length + 1);
+        this.bytes.set(enc, this.pos);
+        this.pos += enc.length;
+        this.u8(0);
+    }
+    data(): Uint8Array {
+        return this.bytes.subarray(0, this.pos);
+    }
+}
+
+// Build a complete test vector file. The number of records must be known
+// upfront: each record is written into 'records' (exactly recordSize bytes),
+// variable size data goes into 'extra', and extraOffset() returns the
+// file offset of the next extra item, to be referenced from the record.
+export class TestVecWriter {
+    records = new ByteWriter();
+    extra = new ByteWriter();
+    recordIndex = 0;
+
+    constructor(public kind: string, public recordSize: number, public numRecords: number) {}
+
+    // file offset of the next item written to extra (which is 4-byte aligned)
+    extraOffset(): number {
+        this.extra.align(4);
+        return HEADER_SIZE + this.numRecords * this.recordSize + this.extra.pos;
+    }
+
+    endRecord() {
+        this.recordIndex += 1;
+        if (this.records.pos !== this.recordIndex * this.recordSize) {
+            throw new Error(`testvec: record ${this.recordIndex - 1} has wrong size`);
+        }
+    }
+
+    finish(): Uint8Array {
+        if (this.recordIndex !== this.numRecords) {
+            throw new Error(`testvec: ${this.recordIndex} records written, expected ${this.numRecords}`);
+        }
+        this.extra.align(4);
+        const out = new ByteWriter();
+        out.u32(fourcc('CHTV'));
+        out.u32(TESTVEC_VERSION);
+        out.u32(fourcc(this.kind));
+        out.u32(this.numRecords);
+        out.u32(this.recordSize);
+        out.u32(HEADER_SIZE);
+        out.u32(HEADER_SIZE + this.records.pos + this.extra.pos);
+        out.u32(0);
+        for (const part of [this.records.data(), this.extra.data()]) {
+            out.reserve(part.length);
+            out.bytes.set(part, out.pos);
+            out.pos += part.length;
+        }
+        return out.data();
+    }
+}
@@ -98,6 +98,18 @@ function addEmulators(b: Builder) {
         });
     }
 
+    // emulators with per-chip profiling (see examples/common/chipprof.h)
+    const profEmus = ['c64', 'vic20', 'atom', 'cpc', 'zx'];
+    for (const emu of profEmus) {
+        b.addTarget(`${emu}-prof`, 'windowed-exe', (t) => {
+            t.setDir(dir);
+            t.setIdeFolder(ideFolder);
+            t.addSources([`${emu}.c`]);
+            t.addCompileDefinitions({ CHIPS_USE_CHIPPROF: '1' });
+            t.addDependencies(['common', 'chipprof', 'roms']);
+        });
+    }
+
     // special cases
     const kc85Models = [
         { name: 'kc852', def: 'CHIPS_KC85_TYPE_2' },
@@ -138,7 +150,7 @@ function addAsciiEmulators(b: Builder) {
     const ideFolder = 'emus-ascii';
     const dir = 'examples/ascii';
     const libs = ['curses'];
-    const deps = ['chips', 'keybuf', 'roms'];
+    const deps = ['chips', 'keybuf', 'base64', 'roms'];
     const incl = [b.importDir('sokol')];
     const emus = ['kc85-ascii', 'c64-ascii', 'c64-sixel', 'c64-kitty'];
     for (const emu of emus) {
@@ -146,7 +158,8 @@ function addAsciiEmulators(b: Builder) {
             t.setDir(dir);
             t.setIdeFolder(ideFolder);
             t.addSources([`${emu}.c`]);
-            t.addLibraries(libs);
+            // c64-kitty sends zlib-compressed pixel data
+            t.addLibraries((emu === 'c64-kitty') ? [...libs, 'z'] : libs);
             t.addDependencies(deps);
             t.addIncludeDirectories(incl);
         })
@@ -162,6 +175,12 @@ function addCommon(b: Builder) {
         t.addSources(['keybuf.c', 'keybuf.h']);
         t.addIncludeDirectories({ dirs: ['.'], scope: 'interface'});
     });
+    b.addTarget('base64', 'lib', (t) => {
+        t.setDir(dir);
+        t.setIdeFolder(ideFolder);
+        t.addSources(['base64.c', 'base64.h']);
+        t.addIncludeDirectories({ dirs: ['.'], scope: 'interface'});
+    });
     b.addTarget('webapi', 'lib', (t) => {
         t.setDir(dir);
         t.setIdeFolder(ideFolder);
@@ -175,14 +194,25 @@ function addCommon(b: Builder) {
         t.addSources([
             'common.h',
             'sokol.c',
+            'audio.c', 'audio.h',
+            'bootcache.c', 'bootcache.h',
             'clock.c', 'clock.h',
+            'emuthread.c', 'emuthread.h',
             'fs.c', 'fs.h',
             'gfx.c', 'gfx.h',
+            'movie.c', 'movie.h',
             'prof.c', 'prof.h',
+            'rewind.c', 'rewind.h',
+            'snapfile.c', 'snapfile.h',
 
         ]);
         t.addIncludeDirectories({ dirs: [t.buildDir()], scope: 'private'});
-        t.addDependencies(['keybuf', 'webapi', 'sokol']);
+        t.addDependencies(['keybuf', 'base64', 'webapi', 'sokol']);
+    });
+    // header-only per-chip profiler, also used by the benchmarks in tests
+    b.addTarget('chipprof', 'interface', (t) => {
+        t.setDir(dir);
+        t.addIncludeDirectories(['.']);
     });
     b.addTarget('ui', 'lib', (t) => {
         t.setDir(dir);
@@ -377,25 +407,98 @@ function addTests(b: Builder) {
     b.addTarget('z80-zex', type, (t) => {
         t.setDir(dir);
         t.setIdeFolder(ideFolder);
-        t.addSources(['z80-zex.c']);
-        t.addJob({
-            job: 'embedfiles',
-            args: {
-                dir: 'roms',
-                outHeader: 'zex-dump.h',
-                prefix: 'dump_',
-                asConst: false,
-                asStatic: false,
-                files: ['zexall.com', 'zexdoc.com'],
-            }
+        t.addSources(['z80-zex.c', 'parallel.h', 'testvec.h']);
+        t.addIncludeDirectories([b.importDir('sokol')]);
+        t.addDependencies(['chips']);
+    });
+    // the -prof variants have a per-chip cost breakdown, see examples/common/chipprof.h
+    for (const prof of [false, true]) {
+        const suffix = prof ? '-prof' : '';
+        const defs: Record<string, string> = prof ? { CHIPS_USE_CHIPPROF: '1' } : {};
+        b.addTarget(`c64-bench${suffix}`, type, (t) => {
+            t.setDir(dir);
+            t.setIdeFolder(ideFolder);
+            t.addSources(['c64-bench.c']);
+            t.addIncludeDirectories([b.importDir('sokol')]);
+            t.addCompileDefinitions(defs);
+            t.addDependencies(['chips', 'chipprof', 'roms']);
+        });
+        b.addTarget(`chips-bench${suffix}`, type, (t) => {
+            t.setDir(dir);
+            t.setIdeFolder(ideFolder);
+            t.addSources([
+                'chips-bench.c',
+                'bench/bench.h',
+                'bench/bench-args.h',
+                'bench/bench-chips.c',
+                'bench/bench-c64.c',
+                'bench/bench-vic20.c',
+                'bench/bench-cpc.c',
+                'bench/bench-zx.c',
+                'bench/bench-kc85.c',
+                'bench/bench-atom.c',
+                'bench/bench-z1013.c',
+                'bench/bench-z9001.c',
+                'bench/bench-bombjack.c',
+                'bench/bench-pacman.c',
+                'bench/bench-pengo.c',
+            ]);
+            t.addIncludeDirectories([b.importDir('sokol')]);
+            t.addCompileDefinitions(defs);
+            t.addDependencies(['chips', 'chipprof', 'roms']);
         });
+    }
+    // headless visual regression check against golden framebuffer hashes
+    b.addTarget('golden-frames', type, (t) => {
+        t.setDir(dir);
+        t.setIdeFolder(ideFolder);
+        t.addSources([
+            'golden-frames.c',
+            'testvec.h',
+            'bench/bench.h',
+            'bench/bench-args.h',
+            'bench/bench-chips.c',
+            'bench/bench-c64.c',
+            'bench/bench-vic20.c',
+            'bench/bench-cpc.c',
+            'bench/bench-zx.c',
+            'bench/bench-kc85.c',
+            'bench/bench-atom.c',
+            'bench/bench-z1013.c',
+            'bench/bench-z9001.c',
+            'bench/bench-bombjack.c',
+            'bench/bench-pacman.c',
+            'bench/bench-pengo.c',
+        ]);
+        t.addIncludeDirectories([b.importDir('sokol')]);
+        t.addDependencies(['chips', 'chipprof', 'roms']);
+    });
+    b.addTarget('cpu-opbench', type, (t) => {
+        t.setDir(dir);
+        t.setIdeFolder(ideFolder);
+        t.addSources(['cpu-opbench.c', 'bench/bench-args.h']);
         t.addIncludeDirectories([b.importDir('sokol')]);
         t.addDependencies(['chips']);
     });
-    b.addTarget('c64-bench', type, (t) => {
+    b.addTarget('base64-bench', type, (t) => {
+        t.setDir(dir);
+        t.setIdeFolder(ideFolder);
+        t.addSources(['base64-bench.c']);
+        t.addIncludeDirectories([b.importDir('sokol')]);
+        t.addDependencies(['base64']);
+    });
+    b.addTarget('mem-bench', type, (t) => {
         t.setDir(dir);
         t.setIdeFolder(ideFolder);
-        t.addSources(['c64-bench.c']);
+        t.addSources(['mem-bench.c', 'memview.h', 'testvec.h']);
+        t.addIncludeDirectories([b.importDir('sokol')]);
+        t.addDependencies(['chips']);
+    });
+    // headless runner for the self-checking VICE test programs in tests/vice-tests
+    b.addTarget('vice-testbench', type, (t) => {
+        t.setDir(dir);
+        t.setIdeFolder(ideFolder);
+        t.addSources(['vice-testbench.c']);
         t.addIncludeDirectories([b.importDir('sokol')]);
         t.addDependencies(['chips', 'roms']);
     });
@@ -404,86 +507,91 @@ function addTests(b: Builder) {
         t.setIdeFolder(ideFolder);
         t.addSources([
             'm6502-perfect.c',
-            'perfect6502/netlist_6502.h',
+            'perfect6502/netlist_load.c',
+            'perfect6502/netlist_load.h',
             'perfect6502/netlist_sim.c',
             'perfect6502/netlist_sim.h',
             'perfect6502/perfect6502.c',
             'perfect6502/perfect6502.h',
-            'perfect6502/types.h'
+            'perfect6502/types.h',
+            'testvec.h'
         ]);
         t.addDependencies(['chips']);
     });
+    b.addTarget('m6502-perfect-bench', type, (t) => {
+        t.setDir(dir);
+        t.setIdeFolder(ideFolder);
+        t.addSources([
+            'm6502-perfect-bench.c',
+            'perfect6502/netlist_load.c',
+            'perfect6502/netlist_load.h',
+            'perfect6502/netlist_sim.c',
+            'perfect6502/netlist_sim.h',
+            'perfect6502/perfect6502.c',
+            'perfect6502/perfect6502.h',
+            'perfect6502/types.h',
+            'testvec.h'
+        ]);
+        t.addIncludeDirectories([b.importDir('sokol')]);
+    });
+    b.addTarget('m6502-perfect-fuzz', type, (t) => {
+        t.setDir(dir);
+        t.setIdeFolder(ideFolder);
+        t.addSources([
+            'm6502-perfect-fuzz.c',
+            'parallel.h',
+            'perfect6502/netlist_load.c',
+            'perfect6502/netlist_load.h',
+            'perfect6502/netlist_sim.c',
+            'perfect6502/netlist_sim.h',
+            'perfect6502/perfect6502.c',
+            'perfect6502/perfect6502.h',
+            'perfect6502/types.h',
+            'testvec.h'
+        ]);
+        t.addIncludeDirectories([b.importDir('sokol')]);
+        t.addDependencies(['chips']);
+    });
     b.addTarget('m6502-wltest', type, (t) => {
         t.setDir(dir);
         t.setIdeFolder(ideFolder);
-        t.addSources(['m6502-wltest.c']);
+        t.addSources(['m6502-wltest.c', 'parallel.h', 'testvec.h', 'memview.h']);
         t.addIncludeDirectories([b.importDir('sokol')]);
         t.addDependencies(['chips']);
-        t.addJob({
-            job: 'embedfiles',
-            args: {
-                dir: `testsuite-2.15/bin`,
-                outHeader: 'dump.h',
-                prefix: 'dump_',
-                list: true,
-                asConst: false,
-                // deno-fmt-ignore
-                files: [
-                    '_start', 'adca', 'adcax', 'adcay', 'adcb', 'adcix', 'adciy', 'adcz', 'adczx', 'alrb', 'ancb', 'anda',
-                    'andax', 'anday', 'andb', 'andix', 'andiy', 'andz', 'andzx', 'aneb', 'arrb', 'asla', 'aslax', 'asln',
-                    'aslz', 'aslzx', 'asoa', 'asoax', 'asoay', 'asoix', 'asoiy', 'asoz', 'asozx', 'axsa', 'axsix', 'axsz',
-                    'axszy', 'bccr', 'bcsr', 'beqr', 'bita', 'bitz', 'bmir', 'bner', 'bplr', 'branchwrap', 'brkn', 'bvcr',
-                    'bvsr', 'cia1pb6', 'cia1pb7', 'cia1ta', 'cia1tab', 'cia1tb', 'cia1tb123',  'cia2pb6', 'cia2pb7',
-                    'cia2ta', 'cia2tb', 'cia2tb123', 'clcn', 'cldn', 'clin', 'clvn', 'cmpa', 'cmpax', 'cmpay', 'cmpb',
-                    'cmpix', 'cmpiy', 'cmpz', 'cmpzx', 'cntdef', 'cnto2', 'cpuport', 'cputiming', 'cpxa', 'cpxb', 'cpxz',
-                    'cpya', 'cpyb', 'cpyz', 'dcma', 'dcmax', 'dcmay', 'dcmix', 'dcmiy', 'dcmz', 'dcmzx', 'deca', 'decax',
-                    'decz', 'deczx', 'dexn', 'deyn', 'eora', 'eorax', 'eoray', 'eorb', 'eorix', 'eoriy', 'eorz', 'eorzx',
-                    'finish', 'flipos', 'icr01', 'imr', 'inca', 'incax', 'incz', 'inczx', 'insa', 'insax', 'insay', 'insix',
-                    'insiy', 'insz', 'inszx', 'inxn', 'inyn', 'irq', 'jmpi', 'jmpw', 'jsrw', 'lasay', 'laxa', 'laxay',
-                    'laxix', 'laxiy', 'laxz', 'laxzy', 'ldaa', 'ldaax', 'ldaay', 'ldab', 'ldaix', 'ldaiy', 'ldaz', 'ldazx',
-                    'ldxa', 'ldxay', 'ldxb', 'ldxz', 'ldxzy', 'ldya', 'ldyax', 'ldyb', 'ldyz', 'ldyzx', 'loadth', 'lsea',
-                    'lseax', 'lseay', 'lseix', 'lseiy', 'lsez', 'lsezx', 'lsra', 'lsrax', 'lsrn', 'lsrz', 'lsrzx', 'lxab',
-                    'mmu', 'mmufetch', 'nmi', 'nopa', 'nopax', 'nopb', 'nopn', 'nopz', 'nopzx', 'oneshot', 'oraa', 'oraax',
-                    'oraay', 'orab', 'oraix', 'oraiy', 'oraz', 'orazx', 'phan', 'phpn', 'plan', 'plpn', 'rlaa', 'rlaax',
-                    'rlaay', 'rlaix', 'rlaiy', 'rlaz', 'rlazx', 'rola', 'rolax', 'roln', 'rolz', 'rolzx', 'rora', 'rorax',
-                    'rorn', 'rorz', 'rorzx', 'rraa', 'rraax', 'rraay', 'rraix', 'rraiy', 'rraz', 'rrazx', 'rtin', 'rtsn',
-                    'sbca', 'sbcax', 'sbcay', 'sbcb', 'sbcb_eb', 'sbcix', 'sbciy', 'sbcz', 'sbczx', 'sbxb', 'secn', 'sedn',
-                    'sein', 'shaay', 'shaiy', 'shsay', 'shxay', 'shyax', 'staa', 'staax', 'staay', 'staix', 'staiy', 'staz',
-                    'stazx', 'stxa', 'stxz', 'stxzy', 'stya', 'styz', 'styzx', 'taxn', 'tayn', 'trap1', 'trap10', 'trap11',
-                    'trap12', 'trap13', 'trap14', 'trap15', 'trap16', 'trap17', 'trap2', 'trap3', 'trap4', 'trap5', 'trap6',
-                    'trap7', 'trap8', 'trap9', 'tsxn', 'txan', 'txsn', 'tyan',
-                ],
-            },
-        })
     });
     b.addTarget('m6502-nestest', type, (t) => {
         t.setDir(dir);
         t.setIdeFolder(ideFolder);
-        t.addSources(['m6502-nestest.c']);
+        t.addSources(['m6502-nestest.c', 'testvec.h']);
         t.addDependencies(['chips']);
         t.addJob({
             job: 'nestestlog',
             args: {
                 dir: 'nestest',
                 input: 'nestest.log.txt',
-                outHeader: 'nestestlog.h',
-            }
-        });
-        t.addJob({
-            job: 'embedfiles',
-            args: {
-                dir: 'nestest',
-                outHeader: 'dump.h',
-                files: ['nestest.nes'],
-                prefix: 'dump_',
-                asConst: false,
+                outFile: 'nestestlog.bin',
             }
         });
     });
+    b.addTarget('z80-perfect', type, (t) => {
+        t.setDir(dir);
+        t.setIdeFolder(ideFolder);
+        t.addSources([
+            'z80-perfect.c',
+            'perfect6502/netlist_load.c',
+            'perfect6502/netlist_load.h',
+            'perfect6502/netlist_sim.c',
+            'perfect6502/netlist_sim.h',
+            'perfect6502/types.h'
+        ]);
+        t.addIncludeDirectories([b.importDir('sokol')]);
+        t.addDependencies(['chips']);
+    });
     b.addTarget('z80-fuse', type, (t) => {
         t.setDir(dir);
         t.setIdeFolder(ideFolder);
-        t.addSources(['z80-fuse.c']);
+        t.addSources(['z80-fuse.c', 'parallel.h', 'testvec.h']);
+        t.addIncludeDirectories([b.importDir('sokol')]);
         t.addDependencies(['chips']);
         t.addJob({
             job: 'fuse',
@@ -491,7 +599,8 @@ function addTests(b: Builder) {
                 dir: 'fuse',
                 fuse_input_file: 'tests.in',
                 fuse_expected_file: 'tests.expected',
-                outHeader: 'fuse.h',
+                outInput: 'fuse-input.bin',
+                outExpected: 'fuse-expected.bin',
             }
         });
     });
@@ -0,0 +1,180 @@
+//------------------------------------------------------------------------------
+//  base64-bench.c
+//
+//  Checks and measures the base64 implementations in examples/common/base64.c.
+//
+//  First each implementation supported by the CPU is checked against the
+//  scalar implementation (encoding all input sizes up to a few hundred
+//  bytes, and decoding with invalid characters, padding and whitespace
+//  at each position), then the encoder and decoder throughput is measured
+//  on a buffer the size of a 24-bit C64 frame (what the Kitty terminal
+//  frontend encodes each frame).
+//
+//  Usage (all args are optional):
+//
+//  base64-bench size=319872 iters=200 runs=5
+//
+//  size:   number of bytes to encode per iteration
+//  iters:  number of iterations per run
+//  runs:   number of measured runs per implementation, the fastest counts
+//------------------------------------------------------------------------------
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include "sokol_args.h"
+#include "base64.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_RUNS (64)
+#define CHECK_MAX_SIZE (300)
+
+static struct {
+    int num_errors;
+    uint8_t src[CHECK_MAX_SIZE];
+    char enc[2][CHECK_MAX_SIZE * 2];
+    uint8_t dec[2][CHECK_MAX_SIZE];
+} check;
+
+static uint32_t rand_state = 0x12345678;
+static uint32_t xorshift(void) {
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state;
+}
+
+static void error(base64_impl_t impl, const char* what, size_t size, size_t pos) {
+    if (check.num_errors++ < 16) {
+        printf("  %s: %s mismatch (size %zu, pos %zu)\n", base64_impl_name(impl), what, size, pos);
+    }
+}
+
+// decode with the scalar implementation and impl, and compare the results
+static void check_decode(base64_impl_t impl, const char* src, size_t num_chars, size_t pos) {
+    size_t num_bytes[2] = { 0, 0 };
+    bool ok[2];
+    memset(check.dec, 0, sizeof(check.dec));
+    base64_select_impl(BASE64_IMPL_SCALAR);
+    ok[0] = base64_decode(src, num_chars, check.dec[0], &num_bytes[0]);
+    base64_select_impl(impl);
+    ok[1] = base64_decode(src, num_chars, check.dec[1], &num_bytes[1]);
+    if ((ok[0] != ok[1]) || (ok[0] && ((num_bytes[0] != num_bytes[1]) || memcmp(check.dec[0], check.dec[1], num_bytes[0])))) {
+        error(impl, "decode", num_chars, pos);
+    }
+}
+
+static void check_impl(base64_impl_t impl) {
+    for (size_t size = 0; size <= CHECK_MAX_SIZE; size++) {
+        for (size_t i = 0; i < size; i++) {
+            check.src[i] = (uint8_t)xorshift();
+        }
+        base64_select_impl(BASE64_IMPL_SCALAR);
+        const size_t num_chars = base64_encode(check.src, size, check.enc[0]);
+        base64_select_impl(impl);
+        if ((num_chars != base64_encoded_size(size)) || (num_chars != base64_encode(check.src, size, check.enc[1])) || memcmp(check.enc[0], check.enc[1], num_chars)) {
+            error(impl, "encode", size, 0);
+            continue;
+        }
+        size_t num_bytes = 0;
+        if ((size > 0) && (!base64_decode(check.enc[1], num_chars, check.dec[1], &num_bytes) || (num_bytes != size) || memcmp(check.src, check.dec[1], size))) {
+            error(impl, "roundtrip", size, 0);
+        }
+    }
+    // replace each character of an encoded string with each possible value
+    const size_t size = 96;
+    for (size_t i = 0; i < size; i++) {
+        check.src[i] = (uint8_t)xorshift();
+    }
+    base64_select_impl(BASE64_IMPL_SCALAR);
+    const size_t num_chars = base64_encode(check.src, size, check.enc[0]);
+    for (size_t pos = 0; pos < num_chars; pos++) {
+        for (int c = 1; c < 256; c++) {
+            memcpy(check.enc[1], check.enc[0], num_chars);
+            check.enc[1][pos] = (char)c;
+            check_decode(impl, check.enc[1], num_chars, pos);
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    stm_setup();
+    const size_t size = strtoull(sargs_value_def("size", "319872"), 0, 10);
+    const int num_iters = atoi(sargs_value_def("iters", "200"));
+    const int num_runs = atoi(sargs_value_def("runs", "5"));
+    if ((size == 0) || (num_iters < 1) || (num_runs < 1) || (num_runs > MAX_RUNS)) {
+        fprintf(stderr, "invalid args (size > 0, iters > 0, 1 <= runs <= %d)\n", MAX_RUNS);
+        return 10;
+    }
+    base64_select_impl(BASE64_IMPL_AUTO);
+    const base64_impl_t auto_impl = base64_impl();
+
+    printf("== checking against scalar implementation\n");
+    for (int impl = BASE64_IMPL_SSSE3; impl < BASE64_IMPL_NUM; impl++) {
+        if (base64_select_impl((base64_impl_t)impl)) {
+            const int num_errors = check.num_errors;
+            check_impl((base64_impl_t)impl);
+            printf("  %-8s %s\n", base64_impl_name((base64_impl_t)impl), (num_errors == check.num_errors) ? "ok" : "*** FAILED");
+        }
+    }
+
+    uint8_t* src = malloc(size);
+    char* enc = malloc(base64_encoded_size(size));
+    uint8_t* dec = malloc(base64_decoded_size(base64_encoded_size(size)));
+    for (size_t i = 0; i < size; i++) {
+        src[i] = (uint8_t)xorshift();
+    }
+    printf("== encoding/decoding %zu bytes, %d iterations per run, best of %d runs\n", size, num_iters, num_runs);
+    double scalar_enc_sec = 0.0;
+    double scalar_dec_sec = 0.0;
+    for (int impl = BASE64_IMPL_SCALAR; impl < BASE64_IMPL_NUM; impl++) {
+        if (!base64_select_impl((base64_impl_t)impl)) {
+            continue;
+        }
+        double enc_sec = 0.0;
+        double dec_sec = 0.0;
+        size_t num_chars = 0;
+        size_t num_bytes = 0;
+        for (int run = 0; run < num_runs; run++) {
+            uint64_t start = stm_now();
+            for (int i = 0; i < num_iters; i++) {
+                num_chars = base64_encode(src, size, enc);
+            }
+            const double run_enc_sec = stm_sec(stm_since(start));
+            start = stm_now();
+            for (int i = 0; i < num_iters; i++) {
+                base64_decode(enc, num_chars, dec, &num_bytes);
+            }
+            const double run_dec_sec = stm_sec(stm_since(start));
+            if ((0 == run) || (run_enc_sec < enc_sec)) {
+                enc_sec = run_enc_sec;
+            }
+            if ((0 == run) || (run_dec_sec < dec_sec)) {
+                dec_sec = run_dec_sec;
+            }
+        }
+        if ((num_bytes != size) || memcmp(src, dec, size)) {
+            error((base64_impl_t)impl, "roundtrip", size, 0);
+        }
+        if (impl == BASE64_IMPL_SCALAR) {
+            scalar_enc_sec = enc_sec;
+            scalar_dec_sec = dec_sec;
+        }
+        const double mbytes = ((double)size * num_iters) / (1024.0 * 1024.0);
+        printf("  %-8s encode %8.1f MB/s (%5.2fx)   decode %8.1f MB/s (%5.2fx)%s\n",
+            base64_impl_name((base64_impl_t)impl),
+            mbytes / enc_sec, scalar_enc_sec / enc_sec,
+            mbytes / dec_sec, scalar_dec_sec / dec_sec,
+            ((base64_impl_t)impl == auto_impl) ? "   (auto)" : "");
+    }
+    free(src);
+    free(enc);
+    free(dec);
+    sargs_shutdown();
+    if (check.num_errors > 0) {
+        printf("== %d mismatch(es)!\n", check.num_errors);
+        return 10;
+    }
+    return 0;
+}
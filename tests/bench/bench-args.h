@@ -0,0 +1,27 @@
+#pragma once
+/*
+    Command line helpers shared by chips-bench, cpu-opbench and
+    golden-frames, include sokol_args.h before this header.
+*/
+#include <stdbool.h>
+#include <string.h>
+
+// true if name is in the comma-separated list of the arg key (e.g.
+// systems=c64,zx), or if the arg is missing or 'all'
+static inline bool bench_arg_selected(const char* key, const char* name) {
+    if (!sargs_exists(key) || sargs_equals(key, "all")) {
+        return true;
+    }
+    const char* list = sargs_value(key);
+    const size_t len = strlen(name);
+    const char* p = list;
+    while ((p = strstr(p, name)) != 0) {
+        const bool starts = (p == list) || (p[-1] == ',');
+        const bool ends = (p[len] == 0) || (p[len] == ',');
+        if (starts && ends) {
+            return true;
+        }
+        p += len;
+    }
+    return false;
+}
@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+//  bench-atom.c
+//------------------------------------------------------------------------------
+#include "chips/chips_common.h"
+#include "chips/m6502.h"
+#include "chips/mc6847.h"
+#include "chips/i8255.h"
+#include "chips/m6522.h"
+#include "chips/beeper.h"
+#include "chips/clk.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_WRAP_M6502
+    #define CHIPPROF_WRAP_M6522
+    #include "chipprof.h"
+#endif
+#define CHIPS_IMPL
+#include "systems/atom.h"
+#include "atom-roms.h"
+#include "bench.h"
+
+static atom_t atom;
+
+static void init(void) {
+    atom_init(&atom, &(atom_desc_t){
+        .audio.callback.func = bench_dummy_audio_callback,
+        .roms = {
+            .abasic = { .ptr=dump_abasic_ic20, .size = sizeof(dump_abasic_ic20) },
+            .afloat = { .ptr=dump_afloat_ic21, .size = sizeof(dump_afloat_ic21) },
+            .dosrom = { .ptr=dump_dosrom_u15, .size = sizeof(dump_dosrom_u15) }
+        }
+    });
+}
+
+static uint32_t exec(uint32_t micro_seconds) {
+    return atom_exec(&atom, micro_seconds);
+}
+
+static chips_display_info_t display_info(void) {
+    return atom_display_info(&atom);
+}
+
+static void key(int key_code, bool down) {
+    if (down) {
+        atom_key_down(&atom, key_code);
+    } else {
+        atom_key_up(&atom, key_code);
+    }
+}
+
+static void discard(void) {
+    atom_discard(&atom);
+}
+
+const bench_system_t bench_atom = {
+    .name = "atom",
+    .config = "atom",
+    .frame_rate = 60.0,
+    .init = init,
+    .exec = exec,
+    .discard = discard,
+    .display_info = display_info,
+    .key = key,
+};
@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------------
+//  bench-bombjack.c
+//------------------------------------------------------------------------------
+#include "chips/chips_common.h"
+#include "chips/z80.h"
+#include "chips/ay38910.h"
+#include "chips/clk.h"
+#include "chips/mem.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_WRAP_Z80
+    #define CHIPPROF_WRAP_AY38910
+    #include "chipprof.h"
+#endif
+#define CHIPS_IMPL
+#include "systems/bombjack.h"
+#include "bombjack-roms.h"
+#include "bench.h"
+
+static bombjack_t sys;
+
+static void init(void) {
+    bombjack_init(&sys, &(bombjack_desc_t){
+        .audio.callback.func = bench_dummy_audio_callback,
+        .roms = {
+            .main_0000_1FFF = { .ptr=dump_09_j01b_bin, .size=sizeof(dump_09_j01b_bin) },
+            .main_2000_3FFF = { .ptr=dump_10_l01b_bin, .size=sizeof(dump_10_l01b_bin) },
+            .main_4000_5FFF = { .ptr=dump_11_m01b_bin, .size=sizeof(dump_11_m01b_bin) },
+            .main_6000_7FFF = { .ptr=dump_12_n01b_bin, .size=sizeof(dump_12_n01b_bin) },
+            .main_C000_DFFF = { .ptr=dump_13_1r, .size=sizeof(dump_13_1r) },
+            .sound_0000_1FFF = { .ptr=dump_01_h03t_bin, .size=sizeof(dump_01_h03t_bin) },
+            .chars_0000_0FFF = { .ptr=dump_03_e08t_bin, .size=sizeof(dump_03_e08t_bin) },
+            .chars_1000_1FFF = { .ptr=dump_04_h08t_bin, .size=sizeof(dump_04_h08t_bin) },
+            .chars_2000_2FFF = { .ptr=dump_05_k08t_bin, .size=sizeof(dump_05_k08t_bin) },
+            .tiles_0000_1FFF = { .ptr=dump_06_l08t_bin, .size=sizeof(dump_06_l08t_bin) },
+            .tiles_2000_3FFF = { .ptr=dump_07_n08t_bin, .size=sizeof(dump_07_n08t_bin) },
+            .tiles_4000_5FFF = { .ptr=dump_08_r08t_bin, .size=sizeof(dump_08_r08t_bin) },
+            .sprites_0000_1FFF = { .ptr=dump_16_m07b_bin, .size=sizeof(dump_16_m07b_bin) },
+            .sprites_2000_3FFF = { .ptr=dump_15_l07b_bin, .size=sizeof(dump_15_l07b_bin) },
+            .sprites_4000_5FFF = { .ptr=dump_14_j07b_bin, .size=sizeof(dump_14_j07b_bin) },
+            .maps_0000_0FFF = { .ptr=dump_02_p04t_bin, .size=sizeof(dump_02_p04t_bin) }
+        }
+    });
+}
+
+static uint32_t exec(uint32_t micro_seconds) {
+    return bombjack_exec(&sys, micro_seconds);
+}
+
+static chips_display_info_t display_info(void) {
+    return bombjack_display_info(&sys);
+}
+
+// '1' inserts a coin, space is the button, the cursor keys (0x08..0x0B) the joystick, anything else is start
+static void key(int key_code, bool down) {
+    uint8_t p1_mask = 0;
+    uint8_t sys_mask = 0;
+    switch (key_code) {
+        case 0x08:  p1_mask = BOMBJACK_JOYSTICK_LEFT; break;
+        case 0x09:  p1_mask = BOMBJACK_JOYSTICK_RIGHT; break;
+        case 0x0A:  p1_mask = BOMBJACK_JOYSTICK_DOWN; break;
+        case 0x0B:  p1_mask = BOMBJACK_JOYSTICK_UP; break;
+        case ' ':   p1_mask = BOMBJACK_JOYSTICK_BUTTON; break;
+        case '1':   sys_mask = BOMBJACK_SYS_P1_COIN; break;
+        default:    sys_mask = BOMBJACK_SYS_P1_START; break;
+    }
+    if (down) {
+        sys.mainboard.p1 |= p1_mask;
+        sys.mainboard.sys |= sys_mask;
+    } else {
+        sys.mainboard.p1 &= ~p1_mask;
+        sys.mainboard.sys &= ~sys_mask;
+    }
+}
+
+static void discard(void) {
+    bombjack_discard(&sys);
+}
+
+const bench_system_t bench_bombjack = {
+    .name = "bombjack",
+    .config = "bombjack",
+    .frame_rate = 60.0,
+    .init = init,
+    .exec = exec,
+    .discard = discard,
+    .display_info = display_info,
+    .key = key,
+};
@@ -0,0 +1,70 @@
+//------------------------------------------------------------------------------
+//  bench-c64.c
+//------------------------------------------------------------------------------
+#include "chips/chips_common.h"
+#include "chips/m6502.h"
+#include "chips/m6526.h"
+#include "chips/m6569.h"
+#include "chips/m6581.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#include "chips/clk.h"
+#include "systems/c1530.h"
+#include "chips/m6522.h"
+#include "systems/c1541.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_WRAP_M6502
+    #define CHIPPROF_WRAP_M6526
+    #define CHIPPROF_WRAP_M6569
+    #define CHIPPROF_WRAP_M6581
+    #define CHIPPROF_WRAP_C1541
+    #include "chipprof.h"
+#endif
+#define CHIPS_IMPL
+#include "systems/c64.h"
+#include "c64-roms.h"
+#include "bench.h"
+
+static c64_t c64;
+
+static void init(void) {
+    c64_init(&c64, &(c64_desc_t){
+        .audio.callback.func = bench_dummy_audio_callback,
+        .roms = {
+            .chars = { .ptr=dump_c64_char_bin, .size=sizeof(dump_c64_char_bin) },
+            .basic = { .ptr=dump_c64_basic_bin, .size=sizeof(dump_c64_basic_bin) },
+            .kernal = { .ptr=dump_c64_kernalv3_bin, .size=sizeof(dump_c64_kernalv3_bin) }
+        }
+    });
+}
+
+static uint32_t exec(uint32_t micro_seconds) {
+    return c64_exec(&c64, micro_seconds);
+}
+
+static chips_display_info_t display_info(void) {
+    return c64_display_info(&c64);
+}
+
+static void key(int key_code, bool down) {
+    if (down) {
+        c64_key_down(&c64, key_code);
+    } else {
+        c64_key_up(&c64, key_code);
+    }
+}
+
+static void discard(void) {
+    c64_discard(&c64);
+}
+
+const bench_system_t bench_c64 = {
+    .name = "c64",
+    .config = "c64-pal",
+    .frame_rate = 50.0,
+    .init = init,
+    .exec = exec,
+    .discard = discard,
+    .display_info = display_info,
+    .key = key,
+};
@@ -0,0 +1,44 @@
+//------------------------------------------------------------------------------
+//  bench-chips.c
+//
+//  Implementation of all chips and shared peripherals used by the
+//  chips-bench systems. The system headers are implemented in their
+//  own bench-*.c files, which include the chip headers below without
+//  CHIPS_IMPL.
+//------------------------------------------------------------------------------
+#define CHIPS_IMPL
+#include "chips/chips_common.h"
+#include "chips/m6502.h"
+#include "chips/m6526.h"
+#include "chips/m6569.h"
+#include "chips/m6581.h"
+#include "chips/m6522.h"
+#include "chips/m6561.h"
+#include "chips/mc6847.h"
+#include "chips/z80.h"
+#include "chips/z80ctc.h"
+#include "chips/z80pio.h"
+#include "chips/ay38910.h"
+#include "chips/i8255.h"
+#include "chips/mc6845.h"
+#include "chips/am40010.h"
+#include "chips/upd765.h"
+#include "chips/beeper.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#include "chips/clk.h"
+#include "chips/fdd.h"
+#include "chips/fdd_cpc.h"
+#include "systems/c1530.h"
+#include "systems/c1541.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_IMPL
+    #include "chipprof.h"
+#endif
+#include "bench.h"
+
+void bench_dummy_audio_callback(const float* samples, int num_samples, void* user_data) {
+    (void)samples;
+    (void)num_samples;
+    (void)user_data;
+}
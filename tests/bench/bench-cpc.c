@@ -0,0 +1,79 @@
+//------------------------------------------------------------------------------
+//  bench-cpc.c
+//------------------------------------------------------------------------------
+#include "chips/chips_common.h"
+#include "chips/z80.h"
+#include "chips/ay38910.h"
+#include "chips/i8255.h"
+#include "chips/mc6845.h"
+#include "chips/am40010.h"
+#include "chips/upd765.h"
+#include "chips/clk.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#include "chips/fdd.h"
+#include "chips/fdd_cpc.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_WRAP_Z80
+    #define CHIPPROF_WRAP_AY38910
+    #include "chipprof.h"
+#endif
+#define CHIPS_IMPL
+#include "systems/cpc.h"
+#include "cpc-roms.h"
+#include "bench.h"
+
+static cpc_t cpc;
+
+static void init(void) {
+    cpc_init(&cpc, &(cpc_desc_t){
+        .type = CPC_TYPE_6128,
+        .audio.callback.func = bench_dummy_audio_callback,
+        .roms = {
+            .cpc464 = {
+                .os = { .ptr=dump_cpc464_os_bin, .size=sizeof(dump_cpc464_os_bin) },
+                .basic = { .ptr=dump_cpc464_basic_bin, .size=sizeof(dump_cpc464_basic_bin) },
+            },
+            .cpc6128 = {
+                .os = { .ptr=dump_cpc6128_os_bin, .size=sizeof(dump_cpc6128_os_bin) },
+                .basic = { .ptr=dump_cpc6128_basic_bin, .size= sizeof(dump_cpc6128_basic_bin) },
+                .amsdos = { .ptr=dump_cpc6128_amsdos_bin, .size=sizeof(dump_cpc6128_amsdos_bin) }
+            },
+            .kcc = {
+                .os = { .ptr=dump_kcc_os_bin, .size=sizeof(dump_kcc_os_bin) },
+                .basic = { .ptr=dump_kcc_bas_bin, .size=sizeof(dump_kcc_bas_bin) }
+            },
+        }
+    });
+}
+
+static uint32_t exec(uint32_t micro_seconds) {
+    return cpc_exec(&cpc, micro_seconds);
+}
+
+static chips_display_info_t display_info(void) {
+    return cpc_display_info(&cpc);
+}
+
+static void key(int key_code, bool down) {
+    if (down) {
+        cpc_key_down(&cpc, key_code);
+    } else {
+        cpc_key_up(&cpc, key_code);
+    }
+}
+
+static void discard(void) {
+    cpc_discard(&cpc);
+}
+
+const bench_system_t bench_cpc = {
+    .name = "cpc",
+    .config = "cpc6128",
+    .frame_rate = 50.0,
+    .init = init,
+    .exec = exec,
+    .discard = discard,
+    .display_info = display_info,
+    .key = key,
+};
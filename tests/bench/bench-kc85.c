@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+//  bench-kc85.c
+//
+//  Always benchmarks the KC85/4, the most complex of the three models.
+//------------------------------------------------------------------------------
+#define CHIPS_KC85_TYPE_4
+#include "chips/chips_common.h"
+#include "chips/z80.h"
+#include "chips/z80ctc.h"
+#include "chips/z80pio.h"
+#include "chips/beeper.h"
+#include "chips/clk.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_WRAP_Z80
+    #include "chipprof.h"
+#endif
+#define CHIPS_IMPL
+#include "systems/kc85.h"
+#include "kc85-roms.h"
+#include "bench.h"
+
+static kc85_t kc85;
+
+static void init(void) {
+    kc85_init(&kc85, &(kc85_desc_t){
+        .audio.callback.func = bench_dummy_audio_callback,
+        .roms = {
+            .caos42c = { .ptr = dump_caos42c_854, .size = sizeof(dump_caos42c_854) },
+            .caos42e = { .ptr = dump_caos42e_854, .size = sizeof(dump_caos42e_854) },
+            .kcbasic = { .ptr = dump_basic_c0_853, .size = sizeof(dump_basic_c0_853) }
+        }
+    });
+}
+
+static uint32_t exec(uint32_t micro_seconds) {
+    return kc85_exec(&kc85, micro_seconds);
+}
+
+static chips_display_info_t display_info(void) {
+    return kc85_display_info(&kc85);
+}
+
+static void key(int key_code, bool down) {
+    if (down) {
+        kc85_key_down(&kc85, key_code);
+    } else {
+        kc85_key_up(&kc85, key_code);
+    }
+}
+
+static void discard(void) {
+    kc85_discard(&kc85);
+}
+
+const bench_system_t bench_kc85 = {
+    .name = "kc85",
+    .config = "kc854",
+    .frame_rate = 50.0,
+    .init = init,
+    .exec = exec,
+    .discard = discard,
+    .display_info = display_info,
+    .key = key,
+};
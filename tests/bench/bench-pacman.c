@@ -0,0 +1,81 @@
+//------------------------------------------------------------------------------
+//  bench-pacman.c
+//------------------------------------------------------------------------------
+#include "chips/chips_common.h"
+#include "chips/z80.h"
+#include "chips/clk.h"
+#include "chips/mem.h"
+#include "pacman-roms.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_WRAP_Z80
+    #include "chipprof.h"
+#endif
+#define CHIPS_IMPL
+#define NAMCO_PACMAN
+#include "systems/namco.h"
+#include "bench.h"
+
+static namco_t sys;
+
+static void init(void) {
+    namco_init(&sys, &(namco_desc_t){
+        .audio.callback.func = bench_dummy_audio_callback,
+        .roms = {
+            .common = {
+                .cpu_0000_0FFF = { .ptr=dump_pacman_6e, .size = sizeof(dump_pacman_6e) },
+                .cpu_1000_1FFF = { .ptr=dump_pacman_6f, .size = sizeof(dump_pacman_6f) },
+                .cpu_2000_2FFF = { .ptr=dump_pacman_6h, .size = sizeof(dump_pacman_6h) },
+                .cpu_3000_3FFF = { .ptr=dump_pacman_6j, .size = sizeof(dump_pacman_6j) },
+                .prom_0000_001F = { .ptr=dump_82s123_7f, .size = sizeof(dump_82s123_7f) },
+                .sound_0000_00FF = { .ptr=dump_82s126_1m, .size = sizeof(dump_82s126_1m) },
+                .sound_0100_01FF = { .ptr=dump_82s126_3m, .size = sizeof(dump_82s126_3m) },
+            },
+            .pacman = {
+                .gfx_0000_0FFF = { .ptr=dump_pacman_5e, .size = sizeof(dump_pacman_5e) },
+                .gfx_1000_1FFF = { .ptr=dump_pacman_5f, .size = sizeof(dump_pacman_5f) },
+                .prom_0020_011F = { .ptr=dump_82s126_4a, .size = sizeof(dump_82s126_4a) },
+            }
+        }
+    });
+}
+
+static uint32_t exec(uint32_t micro_seconds) {
+    return namco_exec(&sys, micro_seconds);
+}
+
+static chips_display_info_t display_info(void) {
+    return namco_display_info(&sys);
+}
+
+// '1' inserts a coin, the cursor keys (0x08..0x0B) the joystick, anything else is start
+static void key(int key_code, bool down) {
+    uint32_t mask;
+    switch (key_code) {
+        case 0x08:  mask = NAMCO_INPUT_P1_LEFT; break;
+        case 0x09:  mask = NAMCO_INPUT_P1_RIGHT; break;
+        case 0x0A:  mask = NAMCO_INPUT_P1_DOWN; break;
+        case 0x0B:  mask = NAMCO_INPUT_P1_UP; break;
+        case '1':   mask = NAMCO_INPUT_P1_COIN; break;
+        default:    mask = NAMCO_INPUT_P1_START; break;
+    }
+    if (down) {
+        namco_input_set(&sys, mask);
+    } else {
+        namco_input_clear(&sys, mask);
+    }
+}
+
+static void discard(void) {
+    namco_discard(&sys);
+}
+
+const bench_system_t bench_pacman = {
+    .name = "pacman",
+    .config = "pacman",
+    .frame_rate = 60.0,
+    .init = init,
+    .exec = exec,
+    .discard = discard,
+    .display_info = display_info,
+    .key = key,
+};
@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+//  bench-pengo.c
+//------------------------------------------------------------------------------
+#include "chips/chips_common.h"
+#include "chips/z80.h"
+#include "chips/clk.h"
+#include "chips/mem.h"
+#include "pengo-roms.h"
+// Pacman and Pengo are both implemented by namco.h, but with a different
+// compile-time config, rename the public API so that both can be
+// linked into the same executable
+#define namco_init pengo_namco_init
+#define namco_discard pengo_namco_discard
+#define namco_reset pengo_namco_reset
+#define namco_exec pengo_namco_exec
+#define namco_tick pengo_namco_tick
+#define namco_input_set pengo_namco_input_set
+#define namco_input_clear pengo_namco_input_clear
+#define namco_display_info pengo_namco_display_info
+#define namco_save_snapshot pengo_namco_save_snapshot
+#define namco_load_snapshot pengo_namco_load_snapshot
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_WRAP_Z80
+    #include "chipprof.h"
+#endif
+#define CHIPS_IMPL
+#define NAMCO_PENGO
+#include "systems/namco.h"
+#include "bench.h"
+
+static namco_t sys;
+
+static void init(void) {
+    namco_init(&sys, &(namco_desc_t){
+        .audio.callback.func = bench_dummy_audio_callback,
+        .roms = {
+            .common = {
+                .cpu_0000_0FFF = { .ptr=dump_ep5120_8, .size=sizeof(dump_ep5120_8) },
+                .cpu_1000_1FFF = { .ptr=dump_ep5121_7, .size=sizeof(dump_ep5121_7) },
+                .cpu_2000_2FFF = { .ptr=dump_ep5122_15, .size=sizeof(dump_ep5122_15) },
+                .cpu_3000_3FFF = { .ptr=dump_ep5123_14, .size=sizeof(dump_ep5123_14) },
+                .prom_0000_001F = { .ptr=dump_pr1633_78, .size=sizeof(dump_pr1633_78) },
+                .sound_0000_00FF = { .ptr=dump_pr1635_51, .size=sizeof(dump_pr1635_51) },
+                .sound_0100_01FF = { .ptr=dump_pr1636_70, .size=sizeof(dump_pr1636_70) }
+            },
+            .pengo = {
+                .cpu_4000_4FFF = { .ptr=dump_ep5124_21, .size=sizeof(dump_ep5124_21) },
+                .cpu_5000_5FFF = { .ptr=dump_ep5125_20, .size=sizeof(dump_ep5125_20) },
+                .cpu_6000_6FFF = { .ptr=dump_ep5126_32, .size=sizeof(dump_ep5126_32) },
+                .cpu_7000_7FFF = { .ptr=dump_ep5127_31, .size=sizeof(dump_ep5127_31) },
+                .gfx_0000_1FFF = { .ptr=dump_ep1640_92, .size=sizeof(dump_ep1640_92) },
+                .gfx_2000_3FFF = { .ptr=dump_ep1695_105, .size=sizeof(dump_ep1695_105) },
+                .prom_0020_041F = { .ptr=dump_pr1634_88, .size=sizeof(dump_pr1634_88) }
+            }
+        }
+    });
+}
+
+static uint32_t exec(uint32_t micro_seconds) {
+    return namco_exec(&sys, micro_seconds);
+}
+
+static chips_display_info_t display_info(void) {
+    return namco_display_info(&sys);
+}
+
+// '1' inserts a coin, space is the button, the cursor keys (0x08..0x0B) the joystick, anything else is start
+static void key(int key_code, bool down) {
+    uint32_t mask;
+    switch (key_code) {
+        case 0x08:  mask = NAMCO_INPUT_P1_LEFT; break;
+        case 0x09:  mask = NAMCO_INPUT_P1_RIGHT; break;
+        case 0x0A:  mask = NAMCO_INPUT_P1_DOWN; break;
+        case 0x0B:  mask = NAMCO_INPUT_P1_UP; break;
+        case '1':   mask = NAMCO_INPUT_P1_COIN; break;
+        case ' ':   mask = NAMCO_INPUT_P1_BUTTON; break;
+        default:    mask = NAMCO_INPUT_P1_START; break;
+    }
+    if (down) {
+        namco_input_set(&sys, mask);
+    } else {
+        namco_input_clear(&sys, mask);
+    }
+}
+
+static void discard(void) {
+    namco_discard(&sys);
+}
+
+const bench_system_t bench_pengo = {
+    .name = "pengo",
+    .config = "pengo",
+    .frame_rate = 60.0,
+    .init = init,
+    .exec = exec,
+    .discard = discard,
+    .display_info = display_info,
+    .key = key,
+};
@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+//  bench-vic20.c
+//------------------------------------------------------------------------------
+#include "chips/chips_common.h"
+#include "chips/m6502.h"
+#include "chips/m6522.h"
+#include "chips/m6561.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#include "chips/clk.h"
+#include "systems/c1530.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_WRAP_M6502
+    #define CHIPPROF_WRAP_M6522
+    #define CHIPPROF_WRAP_M6561
+    #include "chipprof.h"
+#endif
+#define CHIPS_IMPL
+#include "systems/vic20.h"
+#include "vic20-roms.h"
+#include "bench.h"
+
+static vic20_t vic20;
+
+static void init(void) {
+    vic20_init(&vic20, &(vic20_desc_t){
+        .audio.callback.func = bench_dummy_audio_callback,
+        .roms = {
+            .chars = { .ptr=dump_vic20_characters_901460_03_bin, .size=sizeof(dump_vic20_characters_901460_03_bin) },
+            .basic = { .ptr=dump_vic20_basic_901486_01_bin, .size=sizeof(dump_vic20_basic_901486_01_bin) },
+            .kernal = { .ptr=dump_vic20_kernal_901486_07_bin, .size=sizeof(dump_vic20_kernal_901486_07_bin) },
+        }
+    });
+}
+
+static uint32_t exec(uint32_t micro_seconds) {
+    return vic20_exec(&vic20, micro_seconds);
+}
+
+static chips_display_info_t display_info(void) {
+    return vic20_display_info(&vic20);
+}
+
+static void key(int key_code, bool down) {
+    if (down) {
+        vic20_key_down(&vic20, key_code);
+    } else {
+        vic20_key_up(&vic20, key_code);
+    }
+}
+
+static void discard(void) {
+    vic20_discard(&vic20);
+}
+
+const bench_system_t bench_vic20 = {
+    .name = "vic20",
+    .config = "vic20-pal",
+    .frame_rate = 50.0,
+    .init = init,
+    .exec = exec,
+    .discard = discard,
+    .display_info = display_info,
+    .key = key,
+};
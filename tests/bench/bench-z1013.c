@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------------
+//  bench-z1013.c
+//------------------------------------------------------------------------------
+#include "chips/chips_common.h"
+#include "chips/z80.h"
+#include "chips/z80pio.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#include "chips/clk.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_WRAP_Z80
+    #include "chipprof.h"
+#endif
+#define CHIPS_IMPL
+#include "systems/z1013.h"
+#include "z1013-roms.h"
+#include "bench.h"
+
+static z1013_t z1013;
+
+static void init(void) {
+    z1013_init(&z1013, &(z1013_desc_t){
+        .type = Z1013_TYPE_64,
+        .roms = {
+            .mon_a2 = { .ptr=dump_z1013_mon_a2_bin, .size=sizeof(dump_z1013_mon_a2_bin) },
+            .mon202 = { .ptr=dump_z1013_mon202_bin, .size=sizeof(dump_z1013_mon202_bin) },
+            .font = { .ptr=dump_z1013_font_bin, .size=sizeof(dump_z1013_font_bin) }
+        }
+    });
+}
+
+static uint32_t exec(uint32_t micro_seconds) {
+    return z1013_exec(&z1013, micro_seconds);
+}
+
+static chips_display_info_t display_info(void) {
+    return z1013_display_info(&z1013);
+}
+
+static void key(int key_code, bool down) {
+    if (down) {
+        z1013_key_down(&z1013, key_code);
+    } else {
+        z1013_key_up(&z1013, key_code);
+    }
+}
+
+static void discard(void) {
+    z1013_discard(&z1013);
+}
+
+const bench_system_t bench_z1013 = {
+    .name = "z1013",
+    .config = "z1013_64",
+    .frame_rate = 50.0,
+    .init = init,
+    .exec = exec,
+    .discard = discard,
+    .display_info = display_info,
+    .key = key,
+};
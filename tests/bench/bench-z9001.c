@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+//  bench-z9001.c
+//------------------------------------------------------------------------------
+#include "chips/chips_common.h"
+#include "chips/z80.h"
+#include "chips/z80pio.h"
+#include "chips/z80ctc.h"
+#include "chips/beeper.h"
+#include "chips/kbd.h"
+#include "chips/clk.h"
+#include "chips/mem.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_WRAP_Z80
+    #include "chipprof.h"
+#endif
+#define CHIPS_IMPL
+#include "systems/z9001.h"
+#include "z9001-roms.h"
+#include "bench.h"
+
+static z9001_t z9001;
+
+static void init(void) {
+    z9001_init(&z9001, &(z9001_desc_t){
+        .type = Z9001_TYPE_Z9001,
+        .audio.callback.func = bench_dummy_audio_callback,
+        .roms = {
+            .z9001 = {
+                .os_1  = { .ptr=dump_z9001_os12_1_bin, .size=sizeof(dump_z9001_os12_1_bin) },
+                .os_2  = { .ptr=dump_z9001_os12_2_bin, .size=sizeof(dump_z9001_os12_2_bin) },
+                .basic = { .ptr=dump_z9001_basic_507_511_bin, .size=sizeof(dump_z9001_basic_507_511_bin) },
+                .font  = { .ptr=dump_z9001_font_bin, .size=sizeof(dump_z9001_font_bin) },
+            },
+            .kc87 = {
+                .os    = { .ptr=dump_kc87_os_2_bin, .size=sizeof(dump_kc87_os_2_bin) },
+                .basic = { .ptr=dump_z9001_basic_bin, .size=sizeof(dump_z9001_basic_bin) },
+                .font  = { .ptr=dump_kc87_font_2_bin, .size=sizeof(dump_kc87_font_2_bin) }
+            },
+        }
+    });
+}
+
+static uint32_t exec(uint32_t micro_seconds) {
+    return z9001_exec(&z9001, micro_seconds);
+}
+
+static chips_display_info_t display_info(void) {
+    return z9001_display_info(&z9001);
+}
+
+static void key(int key_code, bool down) {
+    if (down) {
+        z9001_key_down(&z9001, key_code);
+    } else {
+        z9001_key_up(&z9001, key_code);
+    }
+}
+
+static void discard(void) {
+    z9001_discard(&z9001);
+}
+
+const bench_system_t bench_z9001 = {
+    .name = "z9001",
+    .config = "z9001",
+    .frame_rate = 50.0,
+    .init = init,
+    .exec = exec,
+    .discard = discard,
+    .display_info = display_info,
+    .key = key,
+};
@@ -0,0 +1,64 @@
+//------------------------------------------------------------------------------
+//  bench-zx.c
+//------------------------------------------------------------------------------
+#include "chips/chips_common.h"
+#include "chips/z80.h"
+#include "chips/beeper.h"
+#include "chips/ay38910.h"
+#include "chips/kbd.h"
+#include "chips/clk.h"
+#include "chips/mem.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_WRAP_Z80
+    #define CHIPPROF_WRAP_AY38910
+    #include "chipprof.h"
+#endif
+#define CHIPS_IMPL
+#include "systems/zx.h"
+#include "zx-roms.h"
+#include "bench.h"
+
+static zx_t zx;
+
+static void init(void) {
+    zx_init(&zx, &(zx_desc_t){
+        .type = ZX_TYPE_128,
+        .audio.callback.func = bench_dummy_audio_callback,
+        .roms = {
+            .zx48k = { .ptr=dump_amstrad_zx48k_bin, .size=sizeof(dump_amstrad_zx48k_bin) },
+            .zx128_0 = { .ptr=dump_amstrad_zx128k_0_bin, .size=sizeof(dump_amstrad_zx128k_0_bin) },
+            .zx128_1 = { .ptr=dump_amstrad_zx128k_1_bin, .size=sizeof(dump_amstrad_zx128k_1_bin) },
+        }
+    });
+}
+
+static uint32_t exec(uint32_t micro_seconds) {
+    return zx_exec(&zx, micro_seconds);
+}
+
+static chips_display_info_t display_info(void) {
+    return zx_display_info(&zx);
+}
+
+static void key(int key_code, bool down) {
+    if (down) {
+        zx_key_down(&zx, key_code);
+    } else {
+        zx_key_up(&zx, key_code);
+    }
+}
+
+static void discard(void) {
+    zx_discard(&zx);
+}
+
+const bench_system_t bench_zx = {
+    .name = "zx",
+    .config = "zx128",
+    .frame_rate = 50.0,
+    .init = init,
+    .exec = exec,
+    .discard = discard,
+    .display_info = display_info,
+    .key = key,
+};
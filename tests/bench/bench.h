@@ -0,0 +1,39 @@
+#pragma once
+/*
+    Common interface for the headless systems in chips-bench and
+    golden-frames.
+
+    Each emulated system lives in its own translation unit (bench-*.c)
+    and exposes a bench_system_t with plain function pointers, the
+    chip implementations shared between systems are compiled once
+    in bench-chips.c.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "chips/chips_common.h"
+
+typedef struct {
+    const char* name;       // short system name, same as the emulator target name
+    const char* config;     // the benchmarked model/config, part of the baseline key
+    double frame_rate;      // nominal display refresh rate in Hz
+    void (*init)(void);     // cold-boot the system with all ROMs
+    uint32_t (*exec)(uint32_t micro_seconds);   // run for a number of emulated micro-seconds, return executed ticks
+    void (*discard)(void);
+    chips_display_info_t (*display_info)(void);     // the display info, frame.buffer points into the running system
+    void (*key)(int key_code, bool down);   // ASCII key code (the arcade systems map a few keys to their inputs)
+} bench_system_t;
+
+extern const bench_system_t bench_c64;
+extern const bench_system_t bench_vic20;
+extern const bench_system_t bench_cpc;
+extern const bench_system_t bench_zx;
+extern const bench_system_t bench_kc85;
+extern const bench_system_t bench_atom;
+extern const bench_system_t bench_z1013;
+extern const bench_system_t bench_z9001;
+extern const bench_system_t bench_bombjack;
+extern const bench_system_t bench_pacman;
+extern const bench_system_t bench_pengo;
+
+// a throw-away audio callback, so that sound generation isn't skipped
+void bench_dummy_audio_callback(const float* samples, int num_samples, void* user_data);
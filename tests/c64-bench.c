@@ -1,6 +1,10 @@
 //------------------------------------------------------------------------------
 //  c64-bench.c
 //  Unthrottled headless C64 emu for benchmarking / profiling.
+//
+//  Build with CHIPS_USE_CHIPPROF (the c64-bench-prof target) for a
+//  per-chip cost breakdown, and optionally pass a path for a Chrome
+//  trace JSON file as first arg.
 //------------------------------------------------------------------------------
 #include <stdio.h>
 #define SOKOL_IMPL
@@ -18,6 +22,15 @@
 #include "systems/c1530.h"
 #include "chips/m6522.h"
 #include "systems/c1541.h"
+#if defined(CHIPS_USE_CHIPPROF)
+    #define CHIPPROF_IMPL
+    #define CHIPPROF_WRAP_M6502
+    #define CHIPPROF_WRAP_M6526
+    #define CHIPPROF_WRAP_M6569
+    #define CHIPPROF_WRAP_M6581
+    #define CHIPPROF_WRAP_C1541
+    #include "chipprof.h"
+#endif
 #include "systems/c64.h"
 #include "c64-roms.h"
 
@@ -26,6 +39,7 @@ static struct {
 } state;
 
 #define NUM_USEC (5*1000000)
+#define FRAME_USEC (20000)
 
 static void dummy_audio_callback(const float* samples, int num_samples, void* user_data) {
     (void)samples;
@@ -33,7 +47,8 @@ static void dummy_audio_callback(const float* samples, int num_samples, void* us
     (void)user_data;
 };
 
-int main() {
+int main(int argc, char* argv[]) {
+    (void)argc; (void)argv;
     /* provide "throw-away" pixel buffer and audio callback, so
        that the video and audio generation isn't skipped in the
        emulator
@@ -48,8 +63,25 @@ int main() {
     });
     stm_setup();
     printf("== running emulation for %.2f emulated secs\n", NUM_USEC / 1000000.0);
-    uint64_t start = stm_now();
-    c64_exec(&state.c64, NUM_USEC);
-    printf("== time: %f sec\n", stm_sec(stm_since(start)));
+    #if defined(CHIPS_USE_CHIPPROF)
+        // profile in frame-sized slices, so the trace has per-frame slices
+        chipprof_init();
+        uint64_t start = stm_now();
+        for (uint32_t usec = 0; usec < NUM_USEC; usec += FRAME_USEC) {
+            chipprof_begin_frame();
+            c64_exec(&state.c64, FRAME_USEC);
+            chipprof_end_frame();
+        }
+        printf("== time: %f sec\n", stm_sec(stm_since(start)));
+        chipprof_print_table(stdout, "c64");
+        if ((argc > 1) && !chipprof_write_trace(argv[1], "c64")) {
+            printf("== failed to write trace file '%s'\n", argv[1]);
+        }
+        chipprof_shutdown();
+    #else
+        uint64_t start = stm_now();
+        c64_exec(&state.c64, NUM_USEC);
+        printf("== time: %f sec\n", stm_sec(stm_since(start)));
+    #endif
     return 0;
 }
@@ -0,0 +1,434 @@
+//------------------------------------------------------------------------------
+//  chips-bench.c
+//
+//  Unthrottled headless benchmark for all emulated systems, generalizes
+//  c64-bench.c.
+//
+//  Each system is cold-booted and runs for a number of emulated seconds
+//  through its *_exec() function in frame-sized slices (like the windowed
+//  emulators do). After optional warmup runs, each measured run is
+//  repeated and the median and 95th percentile (the slow end) of the
+//  host time is reported as emulated MHz, emulated frames per host second
+//  and speed relative to real time.
+//
+//  Usage (all args are optional):
+//
+//  chips-bench systems=c64,zx duration=5 warmup=1 runs=5 slice=16667
+//
+//  systems:    comma-separated list of systems, default is all
+//  duration:   emulated seconds per run
+//  warmup:     number of unmeasured runs before the measured runs
+//  runs:       number of measured runs
+//  slice:      emulated micro-seconds per *_exec() call
+//  format:     text (default), json (one record per line) or csv
+//  out:        write records to this file instead of stdout
+//  baseline:   compare against a json or csv file written by a previous
+//              run, exit with an error if any system got slower
+//  threshold:  allowed slowdown against the baseline in percent (default 5)
+//
+//  Records are matched against the baseline by system and config, the
+//  compared value is the median ns/tick.
+//
+//  When built with CHIPS_USE_CHIPPROF (the chips-bench-prof target), the
+//  tick functions of the chips in each system are instrumented and a
+//  per-chip cost breakdown over all measured runs is printed to stderr,
+//  see examples/common/chipprof.h. Additional args:
+//
+//  trace:      write a Chrome trace JSON file per system to [trace]-[system].json
+//------------------------------------------------------------------------------
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include "sokol_args.h"
+#include "bench/bench.h"
+#include "bench/bench-args.h"
+#if defined(CHIPS_USE_CHIPPROF)
+#include "chipprof.h"
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <inttypes.h>
+
+#define MAX_RUNS (256)
+#define MAX_BASELINE_RECORDS (64)
+#define MAX_NAME_SIZE (32)
+
+#if defined(NDEBUG)
+#define BUILD_TYPE "release"
+#else
+#define BUILD_TYPE "debug"
+#endif
+
+#if defined(__clang__)
+#define COMPILER "clang " __clang_version__
+#elif defined(__GNUC__)
+#define COMPILER "gcc " __VERSION__
+#elif defined(_MSC_VER)
+#define COMPILER_STR2(x) #x
+#define COMPILER_STR(x) COMPILER_STR2(x)
+#define COMPILER "msvc " COMPILER_STR(_MSC_FULL_VER)
+#else
+#define COMPILER "unknown"
+#endif
+
+static const bench_system_t* systems[] = {
+    &bench_c64,
+    &bench_vic20,
+    &bench_cpc,
+    &bench_zx,
+    &bench_kc85,
+    &bench_atom,
+    &bench_z1013,
+    &bench_z9001,
+    &bench_bombjack,
+    &bench_pacman,
+    &bench_pengo,
+};
+#define NUM_SYSTEMS ((int)(sizeof(systems) / sizeof(systems[0])))
+
+typedef enum {
+    FORMAT_TEXT,
+    FORMAT_JSON,
+    FORMAT_CSV,
+} bench_format_t;
+
+typedef struct {
+    double duration_sec;
+    int num_warmup;
+    int num_runs;
+    uint32_t slice_us;
+} bench_params_t;
+
+typedef struct {
+    uint64_t ticks;
+    double host_sec;
+} bench_run_t;
+
+typedef struct {
+    const bench_system_t* sys;
+    bench_run_t median;
+    bench_run_t p95;
+} bench_result_t;
+
+typedef struct {
+    char system[MAX_NAME_SIZE];
+    char config[MAX_NAME_SIZE];
+    double ns_per_tick;
+} bench_baseline_t;
+
+static struct {
+    int num_results;
+    bench_result_t results[NUM_SYSTEMS];
+    int num_baseline;
+    bench_baseline_t baseline[MAX_BASELINE_RECORDS];
+} state;
+
+static bench_run_t run_system(const bench_system_t* sys, const bench_params_t* params) {
+    const uint64_t total_us = (uint64_t)(params->duration_sec * 1000000.0);
+    sys->init();
+    bench_run_t res = {0};
+    uint64_t remaining_us = total_us;
+    const uint64_t start = stm_now();
+    while (remaining_us > 0) {
+        const uint32_t us = (remaining_us > params->slice_us) ? params->slice_us : (uint32_t)remaining_us;
+        #if defined(CHIPS_USE_CHIPPROF)
+        chipprof_begin_frame();
+        #endif
+        res.ticks += sys->exec(us);
+        #if defined(CHIPS_USE_CHIPPROF)
+        chipprof_end_frame();
+        #endif
+        remaining_us -= us;
+    }
+    res.host_sec = stm_sec(stm_since(start));
+    sys->discard();
+    return res;
+}
+
+static int cmp_host_sec(const void* a, const void* b) {
+    const double ta = ((const bench_run_t*)a)->host_sec;
+    const double tb = ((const bench_run_t*)b)->host_sec;
+    return (ta < tb) ? -1 : ((ta > tb) ? 1 : 0);
+}
+
+// nearest-rank percentile over runs sorted by ascending host time
+static bench_run_t percentile(const bench_run_t* sorted_runs, int num_runs, int pct) {
+    assert(num_runs > 0);
+    int idx = (pct * num_runs + 99) / 100 - 1;
+    if (idx < 0) {
+        idx = 0;
+    }
+    return sorted_runs[idx];
+}
+
+static double ns_per_tick(bench_run_t run) {
+    return (run.ticks > 0) ? (run.host_sec * 1000000000.0) / (double)run.ticks : 0.0;
+}
+
+static double mhz(bench_run_t run) {
+    return ((double)run.ticks / run.host_sec) / 1000000.0;
+}
+
+static double realtime(bench_run_t run, double duration_sec) {
+    return duration_sec / run.host_sec;
+}
+
+static void print_text_run(FILE* fp, const char* label, bench_run_t run, double duration_sec, double frame_rate) {
+    const double rt = realtime(run, duration_sec);
+    fprintf(fp, "  %-6s %9.3f sec %9.2f MHz %8.2f ns/tick %10.1f frames/sec %8.2fx realtime\n",
+        label, run.host_sec, mhz(run), ns_per_tick(run), rt * frame_rate, rt);
+}
+
+static void write_results(FILE* fp, bench_format_t format, const bench_params_t* params) {
+    if (format == FORMAT_CSV) {
+        fprintf(fp, "system,config,build,compiler,duration_sec,runs,ticks,host_sec,ns_per_tick,ns_per_tick_p95,mhz,frames_per_sec,realtime\n");
+    }
+    for (int i = 0; i < state.num_results; i++) {
+        const bench_result_t* res = &state.results[i];
+        const double rt = realtime(res->median, params->duration_sec);
+        switch (format) {
+            case FORMAT_TEXT:
+                fprintf(fp, "%s (%s): %"PRIu64" ticks per run\n", res->sys->name, res->sys->config, res->median.ticks);
+                print_text_run(fp, "median", res->median, params->duration_sec, res->sys->frame_rate);
+                print_text_run(fp, "p95", res->p95, params->duration_sec, res->sys->frame_rate);
+                break;
+            case FORMAT_JSON:
+                fprintf(fp, "{\"system\":\"%s\",\"config\":\"%s\",\"build\":\"%s\",\"compiler\":\"%s\","
+                    "\"duration_sec\":%.3f,\"runs\":%d,\"ticks\":%"PRIu64",\"host_sec\":%.6f,"
+                    "\"ns_per_tick\":%.4f,\"ns_per_tick_p95\":%.4f,\"mhz\":%.3f,\"frames_per_sec\":%.2f,\"realtime\":%.3f}\n",
+                    res->sys->name, res->sys->config, BUILD_TYPE, COMPILER,
+                    params->duration_sec, params->num_runs, res->median.ticks, res->median.host_sec,
+                    ns_per_tick(res->median), ns_per_tick(res->p95), mhz(res->median), rt * res->sys->frame_rate, rt);
+                break;
+            case FORMAT_CSV:
+                fprintf(fp, "%s,%s,%s,\"%s\",%.3f,%d,%"PRIu64",%.6f,%.4f,%.4f,%.3f,%.2f,%.3f\n",
+                    res->sys->name, res->sys->config, BUILD_TYPE, COMPILER,
+                    params->duration_sec, params->num_runs, res->median.ticks, res->median.host_sec,
+                    ns_per_tick(res->median), ns_per_tick(res->p95), mhz(res->median), rt * res->sys->frame_rate, rt);
+                break;
+        }
+    }
+}
+
+// extract a "key":"string" or "key":number value from a single json line
+static bool json_value(const char* line, const char* key, char* buf, size_t buf_size) {
+    char pattern[MAX_NAME_SIZE + 4];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char* p = strstr(line, pattern);
+    if (!p) {
+        return false;
+    }
+    p += strlen(pattern);
+    const bool quoted = (*p == '"');
+    if (quoted) {
+        p++;
+    }
+    size_t i = 0;
+    while (*p && (i < (buf_size - 1))) {
+        if ((quoted && (*p == '"')) || (!quoted && ((*p == ',') || (*p == '}')))) {
+            break;
+        }
+        buf[i++] = *p++;
+    }
+    buf[i] = 0;
+    return true;
+}
+
+// extract the n-th field from a csv line, quoted fields may contain commas
+static bool csv_value(const char* line, int field, char* buf, size_t buf_size) {
+    const char* p = line;
+    for (int cur = 0; *p; cur++) {
+        const bool quoted = (*p == '"');
+        if (quoted) {
+            p++;
+        }
+        size_t i = 0;
+        while (*p && (quoted ? (*p != '"') : ((*p != ',') && (*p != '\n') && (*p != '\r')))) {
+            if ((cur == field) && (i < (buf_size - 1))) {
+                buf[i++] = *p;
+            }
+            p++;
+        }
+        if (quoted && *p) {
+            p++;
+        }
+        if (cur == field) {
+            buf[i] = 0;
+            return true;
+        }
+        if (*p != ',') {
+            break;
+        }
+        p++;
+    }
+    return false;
+}
+
+static bool load_baseline(const char* path) {
+    FILE* fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "failed to open baseline file '%s'\n", path);
+        return false;
+    }
+    // csv columns, see write_results()
+    const int csv_system = 0, csv_config = 1, csv_ns_per_tick = 8;
+    char line[1024];
+    char num[MAX_NAME_SIZE];
+    while (fgets(line, sizeof(line), fp) && (state.num_baseline < MAX_BASELINE_RECORDS)) {
+        bench_baseline_t* rec = &state.baseline[state.num_baseline];
+        bool valid = false;
+        if (line[0] == '{') {
+            valid = json_value(line, "system", rec->system, sizeof(rec->system)) &&
+                    json_value(line, "config", rec->config, sizeof(rec->config)) &&
+                    json_value(line, "ns_per_tick", num, sizeof(num));
+        } else if (0 != strncmp(line, "system,", 7)) {
+            valid = csv_value(line, csv_system, rec->system, sizeof(rec->system)) &&
+                    csv_value(line, csv_config, rec->config, sizeof(rec->config)) &&
+                    csv_value(line, csv_ns_per_tick, num, sizeof(num));
+        }
+        if (valid) {
+            rec->ns_per_tick = atof(num);
+            if (rec->ns_per_tick > 0.0) {
+                state.num_baseline++;
+            }
+        }
+    }
+    fclose(fp);
+    return true;
+}
+
+static const bench_baseline_t* find_baseline(const bench_system_t* sys) {
+    for (int i = 0; i < state.num_baseline; i++) {
+        const bench_baseline_t* rec = &state.baseline[i];
+        if ((0 == strcmp(rec->system, sys->name)) && (0 == strcmp(rec->config, sys->config))) {
+            return rec;
+        }
+    }
+    return 0;
+}
+
+// compare results against baseline, return number of regressions
+static int compare_baseline(double threshold_pct) {
+    int num_regressions = 0;
+    fprintf(stderr, "== comparing against baseline (threshold: %.1f%%)\n", threshold_pct);
+    for (int i = 0; i < state.num_results; i++) {
+        const bench_result_t* res = &state.results[i];
+        const bench_baseline_t* base = find_baseline(res->sys);
+        if (!base) {
+            fprintf(stderr, "  %-10s no baseline record\n", res->sys->name);
+            continue;
+        }
+        const double cur = ns_per_tick(res->median);
+        const double delta_pct = ((cur - base->ns_per_tick) / base->ns_per_tick) * 100.0;
+        const bool regressed = delta_pct > threshold_pct;
+        if (regressed) {
+            num_regressions++;
+        }
+        fprintf(stderr, "  %-10s %8.2f => %8.2f ns/tick (%+6.1f%%)%s\n",
+            res->sys->name, base->ns_per_tick, cur, delta_pct, regressed ? " *** REGRESSION" : "");
+    }
+    return num_regressions;
+}
+
+static int run(void) {
+    bench_params_t params = {
+        .duration_sec = atof(sargs_value_def("duration", "5")),
+        .num_warmup = atoi(sargs_value_def("warmup", "1")),
+        .num_runs = atoi(sargs_value_def("runs", "5")),
+        .slice_us = (uint32_t)atoi(sargs_value_def("slice", "16667")),
+    };
+    if ((params.duration_sec <= 0.0) || (params.num_warmup < 0) || (params.num_runs < 1) || (params.num_runs > MAX_RUNS) || (params.slice_us == 0)) {
+        fprintf(stderr, "invalid args (duration > 0, warmup >= 0, 1 <= runs <= %d, slice > 0)\n", MAX_RUNS);
+        return 10;
+    }
+    bench_format_t format = FORMAT_TEXT;
+    if (sargs_equals("format", "json")) {
+        format = FORMAT_JSON;
+    } else if (sargs_equals("format", "csv")) {
+        format = FORMAT_CSV;
+    } else if (sargs_exists("format") && !sargs_equals("format", "text")) {
+        fprintf(stderr, "unknown format '%s' (must be text, json or csv)\n", sargs_value("format"));
+        return 10;
+    }
+    const double threshold_pct = atof(sargs_value_def("threshold", "5"));
+    if (sargs_exists("baseline") && !load_baseline(sargs_value("baseline"))) {
+        return 10;
+    }
+
+    // progress goes to stderr, so that stdout only has records in json/csv mode
+    fprintf(stderr, "== running %.2f emulated secs per run, %d warmup, %d measured runs\n", params.duration_sec, params.num_warmup, params.num_runs);
+    for (int sys_idx = 0; sys_idx < NUM_SYSTEMS; sys_idx++) {
+        const bench_system_t* sys = systems[sys_idx];
+        if (!bench_arg_selected("systems", sys->name)) {
+            continue;
+        }
+        fprintf(stderr, "== %s...\n", sys->name);
+        for (int i = 0; i < params.num_warmup; i++) {
+            run_system(sys, &params);
+        }
+        #if defined(CHIPS_USE_CHIPPROF)
+        chipprof_reset();
+        #endif
+        static bench_run_t runs[MAX_RUNS];
+        for (int i = 0; i < params.num_runs; i++) {
+            runs[i] = run_system(sys, &params);
+        }
+        #if defined(CHIPS_USE_CHIPPROF)
+        chipprof_print_table(stderr, sys->name);
+        if (sargs_exists("trace")) {
+            char path[1024];
+            snprintf(path, sizeof(path), "%s-%s.json", sargs_value("trace"), sys->name);
+            if (!chipprof_write_trace(path, sys->name)) {
+                fprintf(stderr, "failed to write trace file '%s'\n", path);
+            }
+        }
+        #endif
+        qsort(runs, (size_t)params.num_runs, sizeof(bench_run_t), cmp_host_sec);
+        state.results[state.num_results++] = (bench_result_t){
+            .sys = sys,
+            .median = percentile(runs, params.num_runs, 50),
+            .p95 = percentile(runs, params.num_runs, 95),
+        };
+    }
+    if (0 == state.num_results) {
+        fprintf(stderr, "no matching systems for systems=%s\n", sargs_value("systems"));
+        return 10;
+    }
+
+    FILE* fp = stdout;
+    if (sargs_exists("out")) {
+        fp = fopen(sargs_value("out"), "w");
+        if (!fp) {
+            fprintf(stderr, "failed to open output file '%s'\n", sargs_value("out"));
+            return 10;
+        }
+    }
+    write_results(fp, format, &params);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+
+    if (sargs_exists("baseline")) {
+        const int num_regressions = compare_baseline(threshold_pct);
+        if (num_regressions > 0) {
+            fprintf(stderr, "== %d system(s) slower than baseline!\n", num_regressions);
+            return 10;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    stm_setup();
+    #if defined(CHIPS_USE_CHIPPROF)
+    chipprof_init();
+    #endif
+    int res = run();
+    #if defined(CHIPS_USE_CHIPPROF)
+    chipprof_shutdown();
+    #endif
+    sargs_shutdown();
+    return res;
+}
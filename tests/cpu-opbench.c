@@ -0,0 +1,403 @@
+//------------------------------------------------------------------------------
+//  cpu-opbench.c
+//
+//  Per-instruction throughput microbenchmark for the m6502 and z80 emulators.
+//
+//  Every opcode (on the Z80 including the CB, ED, DD, FD, DDCB and FDCB
+//  prefixed instructions, on the 6502 including the undocumented and JAM
+//  opcodes) runs in a tight loop through m6502_tick() / z80_tick() with a
+//  flat 64 KB memory, like the tick() function in z80-zex.c. The operand
+//  bytes are all 0x80, and the address registers point into the middle of
+//  memory, away from the code.
+//
+//  After each instruction the CPU state is restored from a snapshot
+//  taken right after the opcode fetch, and memory writes are undone, so
+//  that each iteration runs exactly the same code path (e.g. jumps are
+//  never followed, and LDIR runs one iteration).
+//
+//  The result is the best of several runs per instruction, reported as
+//  ns per tick and ns per instruction, sorted worst-first. The numbers
+//  include the small and constant overhead of the benchmark loop.
+//  Instructions which don't finish in MAX_INSTR_TICKS ticks (like the
+//  6502 JAM opcodes) are marked as 'stuck'.
+//
+//  Usage (all args are optional):
+//
+//  cpu-opbench cpus=m6502,z80 iterations=20000 runs=3 sort=tick top=0 format=text
+//
+//  cpus:       comma-separated list of CPUs, default is all
+//  iterations: number of executed instructions per run
+//  runs:       number of measured runs per instruction, the fastest counts
+//  sort:       tick (default) to sort by ns/tick, instr to sort by ns/instruction
+//  top:        only print the N slowest instructions per CPU, default is all
+//  format:     text (default) or csv
+//------------------------------------------------------------------------------
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include "sokol_args.h"
+#include "bench/bench-args.h"
+#define CHIPS_IMPL
+#include "chips/m6502.h"
+#include "chips/z80.h"
+#define CHIPS_UTIL_IMPL
+#include "util/m6502dasm.h"
+#include "util/z80dasm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define MEM_SIZE (1<<16)
+#define MAX_INSTR_TICKS (64)
+#define MAX_UNDO (MAX_INSTR_TICKS)
+#define MAX_INSTR_BYTES (4)
+#define MAX_OPS (2048)
+#define MAX_NAME_SIZE (32)
+#define MAX_RUNS (64)
+#define OPERAND (0x80)
+#define DATA_ADDR (0x8000)
+#define M6502_CODE_ADDR (0x0200)
+#define Z80_CODE_ADDR (0x0000)
+
+typedef struct {
+    uint8_t bytes[MAX_INSTR_BYTES];
+    int num_bytes;
+    char name[MAX_NAME_SIZE];
+    int ticks;                  // ticks per instruction
+    bool stuck;
+    double ns_per_instr;
+    double ns_per_tick;
+} op_result_t;
+
+typedef struct {
+    uint16_t addr;
+    uint8_t val;
+} undo_t;
+
+typedef struct {
+    int iterations;
+    int num_runs;
+    bool sort_by_instr;
+    int top;
+    bool csv;
+} params_t;
+
+static struct {
+    uint8_t mem[MEM_SIZE];
+    int num_undo;
+    undo_t undo[MAX_UNDO];
+    int num_ops;
+    op_result_t ops[MAX_OPS];
+    // disassembler input
+    const op_result_t* dasm_op;
+    int dasm_pos;
+} state;
+
+// memory writes are recorded, so that they can be undone after each instruction
+static inline void mem_write(uint16_t addr, uint8_t val) {
+    if (state.num_undo < MAX_UNDO) {
+        state.undo[state.num_undo++] = (undo_t){ .addr = addr, .val = state.mem[addr] };
+    }
+    state.mem[addr] = val;
+}
+
+static inline void mem_undo(void) {
+    while (state.num_undo > 0) {
+        const undo_t* u = &state.undo[--state.num_undo];
+        state.mem[u->addr] = u->val;
+    }
+}
+
+// put an instruction into memory, padded with operand bytes
+static void mem_load_instr(uint16_t addr, const uint8_t* bytes, int num_bytes) {
+    memset(state.mem, 0, sizeof(state.mem));
+    for (int i = 0; i < MAX_INSTR_BYTES; i++) {
+        state.mem[addr + i] = (i < num_bytes) ? bytes[i] : OPERAND;
+    }
+    state.num_undo = 0;
+}
+
+// same bytes as in memory, see mem_load_instr()
+static uint8_t dasm_in(void* user_data) {
+    (void)user_data;
+    const int pos = state.dasm_pos++;
+    return (pos < state.dasm_op->num_bytes) ? state.dasm_op->bytes[pos] : OPERAND;
+}
+
+static void dasm_out(char c, void* user_data) {
+    op_result_t* op = (op_result_t*)user_data;
+    const size_t len = strlen(op->name);
+    if ((len + 1) < MAX_NAME_SIZE) {
+        op->name[len] = c;
+        op->name[len + 1] = 0;
+    }
+}
+
+static op_result_t* add_op(const uint8_t* bytes, int num_bytes) {
+    assert((state.num_ops < MAX_OPS) && (num_bytes <= MAX_INSTR_BYTES));
+    op_result_t* op = &state.ops[state.num_ops++];
+    memset(op, 0, sizeof(op_result_t));
+    memcpy(op->bytes, bytes, (size_t)num_bytes);
+    op->num_bytes = num_bytes;
+    state.dasm_op = op;
+    state.dasm_pos = 0;
+    return op;
+}
+
+//== m6502 =====================================================================
+static inline uint64_t m6502_mem(m6502_t* cpu, uint64_t pins) {
+    pins = m6502_tick(cpu, pins);
+    const uint16_t addr = M6502_GET_ADDR(pins);
+    if (pins & M6502_RW) {
+        M6502_SET_DATA(pins, state.mem[addr]);
+    } else {
+        mem_write(addr, M6502_GET_DATA(pins));
+    }
+    return pins;
+}
+
+// returns the run duration in seconds
+static double m6502_run(op_result_t* op, int iterations) {
+    mem_load_instr(M6502_CODE_ADDR, op->bytes, op->num_bytes);
+    m6502_t cpu;
+    uint64_t pins = m6502_init(&cpu, &(m6502_desc_t){0});
+    for (int i = 0; i < 7; i++) {
+        pins = m6502_mem(&cpu, pins);
+    }
+    cpu.A = cpu.X = cpu.Y = 0;
+    cpu.S = 0xFF;
+    // continue at the opcode fetch (same as cpu_goto() in m6502-wltest.c)
+    M6502_SET_ADDR(pins, M6502_CODE_ADDR);
+    M6502_SET_DATA(pins, state.mem[M6502_CODE_ADDR]);
+    pins |= M6502_SYNC|M6502_RW;
+    cpu.PC = M6502_CODE_ADDR;
+    const m6502_t cpu0 = cpu;
+    const uint64_t pins0 = pins;
+    state.num_undo = 0;
+
+    int ticks = 0;
+    const uint64_t start = stm_now();
+    for (int i = 0; i < iterations; i++) {
+        ticks = 0;
+        do {
+            pins = m6502_mem(&cpu, pins);
+            ticks++;
+        } while ((0 == (pins & M6502_SYNC)) && (ticks < MAX_INSTR_TICKS));
+        cpu = cpu0;
+        pins = pins0;
+        mem_undo();
+    }
+    const double dur = stm_sec(stm_since(start));
+    op->ticks = ticks;
+    op->stuck = ticks >= MAX_INSTR_TICKS;
+    return dur;
+}
+
+static void m6502_add_ops(void) {
+    for (int i = 0; i < 256; i++) {
+        const uint8_t bytes[1] = { (uint8_t)i };
+        op_result_t* op = add_op(bytes, 1);
+        m6502dasm_op(M6502_CODE_ADDR, dasm_in, dasm_out, op);
+    }
+}
+
+//== z80 =======================================================================
+static inline uint64_t z80_mem(z80_t* cpu, uint64_t pins) {
+    pins = z80_tick(cpu, pins);
+    if (pins & Z80_MREQ) {
+        const uint16_t addr = Z80_GET_ADDR(pins);
+        if (pins & Z80_RD) {
+            Z80_SET_DATA(pins, state.mem[addr]);
+        } else if (pins & Z80_WR) {
+            mem_write(addr, Z80_GET_DATA(pins));
+        }
+    } else if ((pins & (Z80_IORQ|Z80_RD)) == (Z80_IORQ|Z80_RD)) {
+        Z80_SET_DATA(pins, 0xFF);
+    }
+    return pins;
+}
+
+static double z80_run(op_result_t* op, int iterations) {
+    mem_load_instr(Z80_CODE_ADDR, op->bytes, op->num_bytes);
+    z80_t cpu;
+    z80_init(&cpu);
+    cpu.bc = cpu.de = cpu.hl = DATA_ADDR;
+    cpu.ix = cpu.iy = DATA_ADDR;
+    cpu.sp = DATA_ADDR;
+    // the snapshot is taken after the opcode fetch (same as in z80-fuse.c)
+    uint64_t pins = z80_prefetch(&cpu, Z80_CODE_ADDR);
+    pins = z80_mem(&cpu, pins);
+    const z80_t cpu0 = cpu;
+    const uint64_t pins0 = pins;
+    state.num_undo = 0;
+
+    int ticks = 0;
+    const uint64_t start = stm_now();
+    for (int i = 0; i < iterations; i++) {
+        ticks = 0;
+        do {
+            pins = z80_mem(&cpu, pins);
+            ticks++;
+        } while (!z80_opdone(&cpu) && (ticks < MAX_INSTR_TICKS));
+        cpu = cpu0;
+        pins = pins0;
+        mem_undo();
+    }
+    const double dur = stm_sec(stm_since(start));
+    op->ticks = ticks;
+    op->stuck = ticks >= MAX_INSTR_TICKS;
+    return dur;
+}
+
+static void z80_add_op(const uint8_t* bytes, int num_bytes) {
+    op_result_t* op = add_op(bytes, num_bytes);
+    z80dasm_op(Z80_CODE_ADDR, dasm_in, dasm_out, op);
+}
+
+static void z80_add_ops(void) {
+    for (int i = 0; i < 256; i++) {
+        if ((i != 0xCB) && (i != 0xDD) && (i != 0xED) && (i != 0xFD)) {
+            z80_add_op((uint8_t[]){ (uint8_t)i }, 1);
+        }
+    }
+    for (int i = 0; i < 256; i++) {
+        z80_add_op((uint8_t[]){ 0xCB, (uint8_t)i }, 2);
+    }
+    for (int i = 0; i < 256; i++) {
+        z80_add_op((uint8_t[]){ 0xED, (uint8_t)i }, 2);
+    }
+    static const uint8_t index_prefixes[2] = { 0xDD, 0xFD };
+    for (int p = 0; p < 2; p++) {
+        for (int i = 0; i < 256; i++) {
+            if (i != 0xCB) {
+                z80_add_op((uint8_t[]){ index_prefixes[p], (uint8_t)i }, 2);
+            }
+        }
+        for (int i = 0; i < 256; i++) {
+            z80_add_op((uint8_t[]){ index_prefixes[p], 0xCB, OPERAND, (uint8_t)i }, 4);
+        }
+    }
+}
+
+//== benchmark driver ==========================================================
+typedef struct {
+    const char* name;
+    void (*add_ops)(void);
+    double (*run)(op_result_t* op, int iterations);
+} cpu_t;
+
+static const cpu_t cpus[] = {
+    { "m6502", m6502_add_ops, m6502_run },
+    { "z80", z80_add_ops, z80_run },
+};
+#define NUM_CPUS ((int)(sizeof(cpus) / sizeof(cpus[0])))
+
+static bool sort_by_instr;
+
+static int cmp_ops(const void* a, const void* b) {
+    const op_result_t* op_a = (const op_result_t*)a;
+    const op_result_t* op_b = (const op_result_t*)b;
+    const double va = sort_by_instr ? op_a->ns_per_instr : op_a->ns_per_tick;
+    const double vb = sort_by_instr ? op_b->ns_per_instr : op_b->ns_per_tick;
+    return (va > vb) ? -1 : ((va < vb) ? 1 : 0);
+}
+
+static void bytes_str(const op_result_t* op, char* buf, size_t buf_size) {
+    buf[0] = 0;
+    for (int i = 0; i < op->num_bytes; i++) {
+        const size_t len = strlen(buf);
+        snprintf(&buf[len], buf_size - len, "%s%02X", (i > 0) ? " " : "", op->bytes[i]);
+    }
+}
+
+static void print_results(const cpu_t* cpu, const params_t* params) {
+    int num = state.num_ops;
+    if ((params->top > 0) && (params->top < num)) {
+        num = params->top;
+    }
+    if (!params->csv) {
+        double sum_instr = 0.0;
+        double sum_tick = 0.0;
+        for (int i = 0; i < state.num_ops; i++) {
+            sum_instr += state.ops[i].ns_per_instr;
+            sum_tick += state.ops[i].ns_per_tick;
+        }
+        printf("== %s: %d instructions, average %.2f ns/instr, %.2f ns/tick\n",
+            cpu->name, state.num_ops, sum_instr / state.num_ops, sum_tick / state.num_ops);
+        printf("  %-12s %-20s %6s %10s %9s\n", "bytes", "instruction", "ticks", "ns/instr", "ns/tick");
+    }
+    for (int i = 0; i < num; i++) {
+        const op_result_t* op = &state.ops[i];
+        char bytes[MAX_INSTR_BYTES * 3];
+        bytes_str(op, bytes, sizeof(bytes));
+        if (params->csv) {
+            printf("%s,%s,\"%s\",%d,%.4f,%.4f,%s\n",
+                cpu->name, bytes, op->name, op->ticks, op->ns_per_instr, op->ns_per_tick, op->stuck ? "true" : "false");
+        } else {
+            printf("  %-12s %-20s %6d %10.2f %9.2f%s\n",
+                bytes, op->name, op->ticks, op->ns_per_instr, op->ns_per_tick, op->stuck ? "  (stuck)" : "");
+        }
+    }
+}
+
+static void run_cpu(const cpu_t* cpu, const params_t* params) {
+    state.num_ops = 0;
+    cpu->add_ops();
+    fprintf(stderr, "== %s: running %d instructions...\n", cpu->name, state.num_ops);
+    for (int i = 0; i < state.num_ops; i++) {
+        op_result_t* op = &state.ops[i];
+        // one unmeasured warmup run
+        cpu->run(op, params->iterations);
+        double best = 0.0;
+        for (int r = 0; r < params->num_runs; r++) {
+            const double dur = cpu->run(op, params->iterations);
+            if ((0 == r) || (dur < best)) {
+                best = dur;
+            }
+        }
+        op->ns_per_instr = (best * 1000000000.0) / params->iterations;
+        op->ns_per_tick = op->ns_per_instr / op->ticks;
+    }
+    sort_by_instr = params->sort_by_instr;
+    qsort(state.ops, (size_t)state.num_ops, sizeof(op_result_t), cmp_ops);
+    print_results(cpu, params);
+}
+
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    stm_setup();
+    const params_t params = {
+        .iterations = atoi(sargs_value_def("iterations", "20000")),
+        .num_runs = atoi(sargs_value_def("runs", "3")),
+        .sort_by_instr = sargs_equals("sort", "instr"),
+        .top = atoi(sargs_value_def("top", "0")),
+        .csv = sargs_equals("format", "csv"),
+    };
+    if ((params.iterations < 1) || (params.num_runs < 1) || (params.num_runs > MAX_RUNS) || (params.top < 0)) {
+        fprintf(stderr, "invalid args (iterations > 0, 1 <= runs <= %d, top >= 0)\n", MAX_RUNS);
+        return 10;
+    }
+    if (sargs_exists("sort") && !sargs_equals("sort", "tick") && !sargs_equals("sort", "instr")) {
+        fprintf(stderr, "unknown sort '%s' (must be tick or instr)\n", sargs_value("sort"));
+        return 10;
+    }
+    if (sargs_exists("format") && !sargs_equals("format", "text") && !sargs_equals("format", "csv")) {
+        fprintf(stderr, "unknown format '%s' (must be text or csv)\n", sargs_value("format"));
+        return 10;
+    }
+    if (params.csv) {
+        printf("cpu,bytes,instruction,ticks,ns_per_instr,ns_per_tick,stuck\n");
+    }
+    int num_cpus = 0;
+    for (int i = 0; i < NUM_CPUS; i++) {
+        if (bench_arg_selected("cpus", cpus[i].name)) {
+            run_cpu(&cpus[i], &params);
+            num_cpus++;
+        }
+    }
+    if (0 == num_cpus) {
+        fprintf(stderr, "no matching CPUs for cpus=%s\n", sargs_value("cpus"));
+    }
+    sargs_shutdown();
+    return (num_cpus > 0) ? 0 : 10;
+}
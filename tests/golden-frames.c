@@ -0,0 +1,344 @@
+//------------------------------------------------------------------------------
+//  golden-frames.c
+//
+//  Headless visual regression check for all emulated systems.
+//
+//  Each scenario below cold-boots a system (the same configs as in
+//  chips-bench), optionally types an input script, and at a number of
+//  checkpoint frames hashes the visible area of the framebuffer (and
+//  the palette) in place, straight from *_display_info().frame.buffer.
+//  The hashes are compared against the golden list in golden-frames.txt.
+//
+//  Usage (all args are optional):
+//
+//  golden-frames systems=c64,zx golden=golden-frames.txt update
+//
+//  systems:    comma-separated list of systems, default is all
+//  golden:     path of the golden list, default is golden-frames.txt
+//              in the test data dir
+//  dir:        directory with the test data, see testvec_path() in testvec.h
+//  update:     don't compare, but write the current hashes into the golden
+//              list (entries of systems which didn't run are kept)
+//
+//  The golden list has one checkpoint per line: system, scenario,
+//  frame number and hash. Lines starting with '#' are ignored.
+//
+//  After a chips update, run without args. A mismatch means that the
+//  system renders something different at that frame; check the scenario
+//  in the windowed emulator, and if the change is expected, run again
+//  with 'update' and commit the new golden list.
+//
+//  If the golden list doesn't exist yet, all scenarios are run but
+//  nothing is compared: run once with 'update' to create it, and commit it.
+//------------------------------------------------------------------------------
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include "sokol_args.h"
+#include "bench/bench.h"
+#include "bench/bench-args.h"
+#define TESTVEC_IMPL
+#include "testvec.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define MAX_CHECKPOINTS (8)
+#define MAX_GOLDEN (256)
+#define MAX_NAME_SIZE (32)
+// frames a key is held down, and frames between releasing a key and pressing the next
+#define KEY_HOLD_FRAMES (2)
+#define KEY_GAP_FRAMES (3)
+
+typedef struct {
+    const bench_system_t* sys;
+    const char* name;
+    int input_frame;                // start typing the input before this frame
+    const char* input;              // input script (ASCII key codes, see bench.h), or 0
+    int frames[MAX_CHECKPOINTS];    // hash the framebuffer after these frames (ascending, 0-terminated)
+} scenario_t;
+
+// NOTE: changing a scenario invalidates its golden hashes
+static const scenario_t scenarios[] = {
+    { &bench_c64,      "basic",   250, "PRINT 6*7\r",   { 25, 100, 250, 400 } },
+    { &bench_vic20,    "basic",   250, "PRINT 6*7\r",   { 25, 100, 250, 400 } },
+    { &bench_cpc,      "basic",   250, "print 6*7\r",   { 25, 100, 250, 400 } },
+    { &bench_zx,       "menu",    250, "\x0A\r",        { 25, 100, 250, 400 } },
+    { &bench_kc85,     "caos",    250, "MENU\r",        { 25, 100, 250, 400 } },
+    { &bench_atom,     "basic",   250, "PRINT 6*7\r",   { 25, 100, 250, 400 } },
+    { &bench_z1013,    "monitor", 250, "\r\r",          { 25, 100, 250, 400 } },
+    { &bench_z9001,    "os",      250, "\r\r",          { 25, 100, 250, 400 } },
+    { &bench_bombjack, "attract", 600, "1s",            { 60, 300, 600, 900, 1200 } },
+    { &bench_pacman,   "attract", 600, "1s",            { 60, 300, 600, 900, 1200 } },
+    { &bench_pengo,    "attract", 600, "1s",            { 60, 300, 600, 900, 1200 } },
+};
+#define NUM_SCENARIOS ((int)(sizeof(scenarios) / sizeof(scenarios[0])))
+
+typedef struct {
+    char system[MAX_NAME_SIZE];
+    char scenario[MAX_NAME_SIZE];
+    int frame;
+    uint64_t hash;
+    bool seen;      // checked in this run
+} golden_t;
+
+static struct {
+    bool have_golden;   // false if there's no golden list file
+    int num_golden;
+    golden_t golden[MAX_GOLDEN];
+    int num_checks;
+    int num_mismatches;
+    int num_missing;
+} state;
+
+// a fast non-cryptographic 64-bit hash over 8-byte words (multiply-rotate
+// like xxhash/murmur), the result depends on host byte order
+static uint64_t hash_mix(uint64_t h, uint64_t v) {
+    h ^= v * 0x9E3779B97F4A7C15ULL;
+    h = (h << 27) | (h >> 37);
+    return h * 0xC2B2AE3D27D4EB4FULL + 0x165667B19E3779F9ULL;
+}
+
+static uint64_t hash_bytes(uint64_t h, const uint8_t* ptr, size_t num_bytes) {
+    while (num_bytes >= 8) {
+        uint64_t v;
+        memcpy(&v, ptr, 8);
+        h = hash_mix(h, v);
+        ptr += 8;
+        num_bytes -= 8;
+    }
+    if (num_bytes > 0) {
+        uint64_t v = 0;
+        memcpy(&v, ptr, num_bytes);
+        h = hash_mix(h, v ^ ((uint64_t)num_bytes << 56));
+    }
+    return h;
+}
+
+static uint64_t hash_final(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// hash the visible area of the framebuffer row by row, and the palette
+static bool hash_display(const chips_display_info_t* info, uint64_t* out_hash) {
+    const size_t bpp = (size_t)info->frame.bytes_per_pixel;
+    const size_t stride = (size_t)info->frame.dim.width * bpp;
+    const size_t row_size = (size_t)info->screen.width * bpp;
+    const size_t end = ((size_t)(info->screen.y + info->screen.height - 1) * stride) + ((size_t)info->screen.x * bpp) + row_size;
+    if ((0 == info->frame.buffer.ptr) || (0 == bpp) || (info->screen.width <= 0) || (info->screen.height <= 0) ||
+        ((info->screen.x + info->screen.width) > info->frame.dim.width) || (end > info->frame.buffer.size))
+    {
+        return false;
+    }
+    const uint8_t* pixels = (const uint8_t*)info->frame.buffer.ptr;
+    uint64_t h = hash_mix(0, ((uint64_t)info->screen.width << 32) | (uint64_t)info->screen.height);
+    for (int y = info->screen.y; y < (info->screen.y + info->screen.height); y++) {
+        h = hash_bytes(h, pixels + (size_t)y * stride + (size_t)info->screen.x * bpp, row_size);
+    }
+    if (info->palette.ptr) {
+        h = hash_bytes(h, (const uint8_t*)info->palette.ptr, info->palette.size);
+    }
+    *out_hash = hash_final(h);
+    return true;
+}
+
+static golden_t* find_golden(const char* system, const char* scenario, int frame) {
+    for (int i = 0; i < state.num_golden; i++) {
+        golden_t* g = &state.golden[i];
+        if ((g->frame == frame) && (0 == strcmp(g->system, system)) && (0 == strcmp(g->scenario, scenario))) {
+            return g;
+        }
+    }
+    return 0;
+}
+
+static bool load_golden(const char* path) {
+    FILE* fp = fopen(path, "r");
+    if (!fp) {
+        // not an error, see state.have_golden
+        return true;
+    }
+    state.have_golden = true;
+    char line[256];
+    int line_nr = 0;
+    bool ok = true;
+    while (fgets(line, sizeof(line), fp)) {
+        line_nr++;
+        if ((line[0] == '#') || (line[0] == '\n') || (line[0] == '\r') || (line[0] == 0)) {
+            continue;
+        }
+        if (state.num_golden >= MAX_GOLDEN) {
+            fprintf(stderr, "%s: too many entries (max %d)\n", path, MAX_GOLDEN);
+            ok = false;
+            break;
+        }
+        golden_t* g = &state.golden[state.num_golden];
+        if (4 != sscanf(line, "%31s %31s %d %"SCNx64, g->system, g->scenario, &g->frame, &g->hash)) {
+            fprintf(stderr, "%s:%d: invalid line\n", path, line_nr);
+            ok = false;
+            break;
+        }
+        state.num_golden++;
+    }
+    fclose(fp);
+    return ok;
+}
+
+static bool write_golden(const char* path) {
+    FILE* fp = fopen(path, "w");
+    if (!fp) {
+        fprintf(stderr, "failed to write '%s'\n", path);
+        return false;
+    }
+    fprintf(fp, "# golden framebuffer hashes, written by golden-frames.c (run it with 'update')\n");
+    fprintf(fp, "# system scenario frame hash\n");
+    for (int i = 0; i < state.num_golden; i++) {
+        const golden_t* g = &state.golden[i];
+        fprintf(fp, "%s %s %d %016"PRIx64"\n", g->system, g->scenario, g->frame, g->hash);
+    }
+    fclose(fp);
+    return true;
+}
+
+static void check(const scenario_t* scn, int frame, uint64_t hash, bool update) {
+    state.num_checks++;
+    golden_t* g = find_golden(scn->sys->name, scn->name, frame);
+    if (update) {
+        if (!g) {
+            if (state.num_golden >= MAX_GOLDEN) {
+                fprintf(stderr, "too many checkpoints (max %d)\n", MAX_GOLDEN);
+                state.num_missing++;
+                return;
+            }
+            g = &state.golden[state.num_golden++];
+            snprintf(g->system, sizeof(g->system), "%s", scn->sys->name);
+            snprintf(g->scenario, sizeof(g->scenario), "%s", scn->name);
+            g->frame = frame;
+        }
+        g->hash = hash;
+        g->seen = true;
+        return;
+    }
+    if (!g) {
+        if (state.have_golden) {
+            printf("  %-10s %-8s frame %5d: %016"PRIx64" *** NOT IN GOLDEN LIST\n", scn->sys->name, scn->name, frame, hash);
+        }
+        state.num_missing++;
+    } else if (g->hash != hash) {
+        printf("  %-10s %-8s frame %5d: %016"PRIx64" *** MISMATCH (expected %016"PRIx64")\n", scn->sys->name, scn->name, frame, hash, g->hash);
+        state.num_mismatches++;
+    }
+    if (g) {
+        g->seen = true;
+    }
+}
+
+// press or release the input key which is due before a frame
+static void feed_input(const scenario_t* scn, int frame) {
+    if (!scn->input || (frame < scn->input_frame)) {
+        return;
+    }
+    const int key_frames = KEY_HOLD_FRAMES + KEY_GAP_FRAMES;
+    const int rel = frame - scn->input_frame;
+    const size_t index = (size_t)(rel / key_frames);
+    if (index >= strlen(scn->input)) {
+        return;
+    }
+    const int key_code = (uint8_t)scn->input[index];
+    if ((rel % key_frames) == 0) {
+        scn->sys->key(key_code, true);
+    } else if ((rel % key_frames) == KEY_HOLD_FRAMES) {
+        scn->sys->key(key_code, false);
+    }
+}
+
+static bool run_scenario(const scenario_t* scn, bool update) {
+    const uint32_t frame_us = (uint32_t)(1000000.0 / scn->sys->frame_rate + 0.5);
+    scn->sys->init();
+    int cp = 0;
+    bool ok = true;
+    for (int frame = 1; (cp < MAX_CHECKPOINTS) && (scn->frames[cp] > 0); frame++) {
+        feed_input(scn, frame);
+        scn->sys->exec(frame_us);
+        if (frame == scn->frames[cp]) {
+            // the display info points into the running system, nothing is copied
+            const chips_display_info_t info = scn->sys->display_info();
+            uint64_t hash;
+            if (!hash_display(&info, &hash)) {
+                fprintf(stderr, "%s: invalid display info\n", scn->sys->name);
+                ok = false;
+                break;
+            }
+            check(scn, frame, hash, update);
+            cp++;
+        }
+    }
+    scn->sys->discard();
+    return ok;
+}
+
+static int run(void) {
+    char default_path[TESTVEC_MAX_PATH];
+    testvec_path(default_path, sizeof(default_path), __FILE__, "golden-frames.txt");
+    const char* path = sargs_exists("golden") ? sargs_value("golden") : default_path;
+    const bool update = sargs_exists("update");
+    if (!load_golden(path)) {
+        return 10;
+    }
+    int num_scenarios = 0;
+    const uint64_t start = stm_now();
+    for (int i = 0; i < NUM_SCENARIOS; i++) {
+        const scenario_t* scn = &scenarios[i];
+        if (!bench_arg_selected("systems", scn->sys->name)) {
+            continue;
+        }
+        if (!run_scenario(scn, update)) {
+            return 10;
+        }
+        num_scenarios++;
+    }
+    const double host_sec = stm_sec(stm_since(start));
+    if (0 == num_scenarios) {
+        fprintf(stderr, "no matching systems for systems=%s\n", sargs_value("systems"));
+        return 10;
+    }
+    printf("== %d checkpoints in %d scenarios, %.3f sec (%.1f checks/sec)\n",
+        state.num_checks, num_scenarios, host_sec, (double)state.num_checks / host_sec);
+    if (update) {
+        if (!write_golden(path)) {
+            return 10;
+        }
+        printf("== golden list '%s' updated\n", path);
+        return 0;
+    }
+    if (!state.have_golden) {
+        printf("== no golden list '%s', run with 'update' to create it\n", path);
+        return 0;
+    }
+    for (int i = 0; i < state.num_golden; i++) {
+        const golden_t* g = &state.golden[i];
+        if (!g->seen && bench_arg_selected("systems", g->system)) {
+            printf("  %-10s %-8s frame %5d: *** STALE GOLDEN ENTRY (no such checkpoint)\n", g->system, g->scenario, g->frame);
+        }
+    }
+    if ((state.num_mismatches > 0) || (state.num_missing > 0)) {
+        printf("== %d mismatches, %d checkpoints not in golden list!\n", state.num_mismatches, state.num_missing);
+        return 10;
+    }
+    printf("== all checkpoints match\n");
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    testvec_set_dir(sargs_value("dir"));
+    stm_setup();
+    int res = run();
+    sargs_shutdown();
+    return res;
+}
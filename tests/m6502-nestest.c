@@ -2,15 +2,27 @@
 //  m6502-nestest.c
 //
 //  Tests CPU state after documented instructions, no BCD mode.
+//
+//  The ROM image and the expected CPU states (converted from the nestest
+//  log by the 'nestestlog' job in fibs-scripts/nestestlog.ts) are mapped
+//  into memory from the nestest directory.
 //------------------------------------------------------------------------------
 #define CHIPS_IMPL
 #include "chips/m6502.h"
 #include "chips/mem.h"
+#define TESTVEC_IMPL
+#include "testvec.h"
 #include <stdio.h>
-#include "nestest/dump.h"
-#include "nestest/nestestlog.h"
 #include "test.h"
 
+// must match the record layout written by fibs-scripts/nestestlog.ts
+typedef struct {
+    char desc[36];
+    uint16_t PC;
+    uint8_t A,X,Y,P,S;
+    uint8_t pad;
+} cpu_state_t;
+
 m6502_t cpu;
 mem_t mem;
 uint8_t ram[0x0800];
@@ -39,6 +51,24 @@ int main() {
     test_begin("NES TEST (m6502)");
     test_no_verbose();
 
+    /* map the ROM image (copy-on-write, so that it can be patched) and the expected states */
+    char path[TESTVEC_MAX_PATH];
+    testvec_file_t rom_file, log_file;
+    testvec_path(path, sizeof(path), __FILE__, "nestest/nestest.nes");
+    if (!testvec_map(&rom_file, path) || (rom_file.size < (16 + 0x4000))) {
+        return 10;
+    }
+    testvec_path(path, sizeof(path), __FILE__, "nestest/nestestlog.bin");
+    if (!testvec_map(&log_file, path)) {
+        return 10;
+    }
+    uint32_t num_states = 0;
+    const cpu_state_t* state_table = testvec_records(&log_file, TESTVEC_FOURCC('N','E','S','T'), sizeof(cpu_state_t), &num_states);
+    if (!state_table) {
+        return 10;
+    }
+    uint8_t* rom = rom_file.ptr;
+
     /* need to implement a minimal NES emulation */
     memset(ram, 0, sizeof(ram));
     memset(sram, 0, sizeof(sram));
@@ -56,10 +86,10 @@ int main() {
        the nestest fileformat has a 16-byte header,
        patch the test start address into the RESET vector
     */
-    dump_nestest_nes[16 + 0x3FFC] = 0x00;
-    dump_nestest_nes[16 + 0x3FFD] = 0xC0;
-    mem_map_rom(&mem, 0, 0x8000, 0x4000, &(dump_nestest_nes[16]));
-    mem_map_rom(&mem, 0, 0xC000, 0x4000, &(dump_nestest_nes[16]));
+    rom[16 + 0x3FFC] = 0x00;
+    rom[16 + 0x3FFD] = 0xC0;
+    mem_map_rom(&mem, 0, 0x8000, 0x4000, &(rom[16]));
+    mem_map_rom(&mem, 0, 0xC000, 0x4000, &(rom[16]));
 
     /* initialize the CPU */
     uint64_t pins = m6502_init(&cpu, &(m6502_desc_t){
@@ -72,9 +102,9 @@ int main() {
     cpu.P &= ~M6502_ZF;
 
     /* run the test */
-    int num_tests = sizeof(state_table) / sizeof(cpu_state);
+    int num_tests = (int)num_states;
     for (int i = 0; i < num_tests; i++) {
-        cpu_state* state = &state_table[i];
+        const cpu_state_t* state = &state_table[i];
         test(state->desc);
         T(cpu.PC == state->PC);
         T(cpu.A  == state->A);
@@ -89,5 +119,7 @@ int main() {
             pins = tick(pins);
         } while (0 == (pins & M6502_SYNC));
     }
+    testvec_unmap(&log_file);
+    testvec_unmap(&rom_file);
     return test_end();
 }
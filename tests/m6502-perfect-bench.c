@@ -0,0 +1,116 @@
+//------------------------------------------------------------------------------
+//  m6502-perfect-bench.c
+//
+//  Benchmark for the transistor-level perfect6502 simulation, reports
+//  simulated half-cycles per host second.
+//
+//  A small loop with loads, stores, arithmetic and branches is run for
+//  a fixed number of half-cycles. The final CPU state and a checksum of
+//  the 64 KB memory are printed as well, these must be identical
+//  between simulator configurations, and the netlist simulator's
+//  counters per half-cycle.
+//
+//  Usage (all args are optional):
+//
+//  m6502-perfect-bench halfcycles=20000 runs=3
+//
+//  dir:        directory with the test data, see testvec_path() in testvec.h
+//
+//  The 6502 netlist is loaded from tests/perfect6502/netlist-6502,
+//  this isn't included in the measured init time.
+//------------------------------------------------------------------------------
+#include "perfect6502/types.h"
+#include "perfect6502/netlist_sim.h"
+#include "perfect6502/perfect6502.h"
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include "sokol_args.h"
+#define TESTVEC_IMPL
+#include "testvec.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const uint8_t prog[] = {
+    0xA2, 0x00,         // LDX #$00
+    0xA0, 0x00,         // LDY #$00
+    0x18,               // loop: CLC
+    0x8A,               // TXA
+    0x79, 0x00, 0x10,   // ADC $1000,Y
+    0x99, 0x00, 0x11,   // STA $1100,Y
+    0xE8,               // INX
+    0xC8,               // INY
+    0xD0, 0xF4,         // BNE loop
+    0xEE, 0x00, 0x12,   // INC $1200
+    0x4C, 0x04, 0x04,   // JMP loop
+};
+
+static void init_memory(void) {
+    memset(memory, 0, sizeof(memory));
+    memcpy(&memory[0x0400], prog, sizeof(prog));
+    for (int i = 0; i < 256; i++) {
+        memory[0x1000 + i] = (uint8_t)(i * 7);
+    }
+    // reset vector
+    memory[0xFFFC] = 0x00;
+    memory[0xFFFD] = 0x04;
+}
+
+static uint32_t memory_checksum(void) {
+    // FNV-1a
+    uint32_t hash = 2166136261U;
+    for (size_t i = 0; i < sizeof(memory); i++) {
+        hash = (hash ^ memory[i]) * 16777619U;
+    }
+    return hash;
+}
+
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    testvec_set_dir(sargs_value("dir"));
+    stm_setup();
+    const int num_half_cycles = atoi(sargs_value_def("halfcycles", "20000"));
+    const int num_runs = atoi(sargs_value_def("runs", "3"));
+    if ((num_half_cycles <= 0) || (num_runs <= 0)) {
+        fprintf(stderr, "invalid args (halfcycles > 0, runs > 0)\n");
+        return 10;
+    }
+    char netlist_path[TESTVEC_MAX_PATH];
+    testvec_path(netlist_path, sizeof(netlist_path), __FILE__, "perfect6502/netlist-6502");
+    if (!loadChipNetlist(netlist_path)) {
+        return 10;
+    }
+    printf("== running %d half-cycles, %d runs\n", num_half_cycles, num_runs);
+    double best_sec = 0.0;
+    for (int run = 0; run < num_runs; run++) {
+        init_memory();
+        uint64_t start = stm_now();
+        void* state = initAndResetChip();
+        const double init_sec = stm_sec(stm_since(start));
+        resetStats(state);
+        start = stm_now();
+        for (int i = 0; i < num_half_cycles; i++) {
+            step(state);
+        }
+        const double sec = stm_sec(stm_since(start));
+        if ((0 == run) || (sec < best_sec)) {
+            best_sec = sec;
+        }
+        printf("  run %d: %.3f sec (init: %.3f sec), %.0f half-cycles/sec\n", run, sec, init_sec, num_half_cycles / sec);
+        if (run == (num_runs - 1)) {
+            printf("== PC:%04X A:%02X X:%02X Y:%02X SP:%02X P:%02X memory checksum:%08X\n",
+                readPC(state), readA(state), readX(state), readY(state), readSP(state), readP(state), memory_checksum());
+            netlist_stats_t stats;
+            getStats(state, &stats);
+            printf("== per half-cycle: %.1f iterations, %.1f groups rebuilt, %.1f groups cached, %.1f nodes visited\n",
+                (double)stats.iterations / num_half_cycles,
+                (double)stats.groups_rebuilt / num_half_cycles,
+                (double)stats.groups_cached / num_half_cycles,
+                (double)stats.nodes_visited / num_half_cycles);
+        }
+        destroyChip(state);
+    }
+    printf("== best: %.0f half-cycles/sec\n", num_half_cycles / best_sec);
+    sargs_shutdown();
+    return 0;
+}
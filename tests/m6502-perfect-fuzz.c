@@ -0,0 +1,301 @@
+//------------------------------------------------------------------------------
+//  m6502-perfect-fuzz.c
+//
+//  Differential fuzzing of the cycle-stepped m6502 emulator against the
+//  transistor-level perfect6502 simulation.
+//
+//  Each fuzz case fills the whole 64 KB address space of both emulators
+//  with the same random bytes (so that random jumps, branches, interrupt
+//  vectors and indirect addresses all land in random code and data),
+//  and starts with a short prelude which loads random values into
+//  A, X, Y, S and P. Then both emulators run side by side, and after each
+//  tick the address bus, data bus, RW and SYNC pins are compared, and
+//  on each instruction fetch the registers and flags.
+//
+//  JAM opcodes (which halt the CPU) and the 'unstable' undocumented
+//  opcodes (which depend on analog effects the netlist doesn't model)
+//  never appear in the random bytes.
+//
+//  The cases run in parallel, with one pair of emulators per worker
+//  thread. Each case is fully determined by its seed, a failing case
+//  can be rerun with: m6502-perfect-fuzz seed=[case seed] cases=1 log=true
+//
+//  Usage (all args are optional):
+//
+//  m6502-perfect-fuzz seed=1 cases=64 ticks=1000 threads=4 log=false
+//
+//  seed:       seed of the first case, the following cases use seed+1, ...
+//  cases:      number of fuzz cases
+//  ticks:      number of ticks per case
+//  threads:    number of worker threads, default is one per CPU core
+//  log:        print the perfect6502 state after each half-cycle
+//  dir:        directory with the test data, see testvec_path() in testvec.h
+//
+//  The 6502 netlist is loaded from tests/perfect6502/netlist-6502 once
+//  before the worker threads start, the chips share it read-only.
+//------------------------------------------------------------------------------
+#include "perfect6502/types.h"
+#include "perfect6502/netlist_sim.h"
+#include "perfect6502/perfect6502.h"
+#define CHIPS_IMPL
+#include "chips/m6502.h"
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include "sokol_args.h"
+#define PARALLEL_IMPL
+#include "parallel.h"
+#define TESTVEC_IMPL
+#include "testvec.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define MEM_SIZE (1<<16)
+#define MAX_CASES (1<<14)
+#define MAX_MESSAGE_SIZE (128)
+#define PRELUDE_ADDR (0x0200)
+#define SYNC_NODE (539)
+// flags which are not compared (same as in m6502-perfect.c)
+#define FLAGS_MASK ((uint8_t)~(M6502_XF|M6502_IF|M6502_BF))
+
+typedef struct {
+    m6502_t cpu;
+    uint64_t pins;
+    uint8_t mem[MEM_SIZE];
+    void* p6502;
+    uint8_t p6502_mem[MEM_SIZE];
+} worker_t;
+
+typedef struct {
+    bool failed;
+    uint32_t tick;
+    char msg[MAX_MESSAGE_SIZE];
+} result_t;
+
+static struct {
+    uint32_t seed;
+    int num_cases;
+    uint32_t num_ticks;
+    bool log;
+    worker_t workers[PAR_MAX_WORKERS];
+    result_t results[MAX_CASES];
+} state;
+
+static uint32_t xorshift32(uint32_t* x) {
+    *x ^= *x << 13;
+    *x ^= *x >> 17;
+    *x ^= *x << 5;
+    return *x;
+}
+
+// opcodes which halt the CPU, or which have unstable results on real hardware
+static bool is_excluded_opcode(uint8_t op) {
+    if (((op & 0x0F) == 0x02) && (op != 0x82) && (op != 0xA2) && (op != 0xC2) && (op != 0xE2)) {
+        // JAM: 02 12 22 32 42 52 62 72 92 B2 D2 F2
+        return true;
+    }
+    switch (op) {
+        case 0x8B:  // ANE
+        case 0xAB:  // LXA
+        case 0x93:  // SHA (zp),Y
+        case 0x9F:  // SHA abs,Y
+        case 0x9B:  // TAS
+        case 0x9C:  // SHY
+        case 0x9E:  // SHX
+            return true;
+        default:
+            return false;
+    }
+}
+
+static uint8_t random_byte(uint32_t* rng) {
+    uint8_t val;
+    do {
+        val = (uint8_t)xorshift32(rng);
+    } while (is_excluded_opcode(val));
+    return val;
+}
+
+// fill memory with random bytes, and put the register-loading prelude at the reset address
+static void init_memory(uint8_t* mem, uint32_t seed) {
+    uint32_t rng = seed * 2654435761U + 1;
+    if (0 == rng) {
+        rng = 1;
+    }
+    for (int i = 0; i < MEM_SIZE; i++) {
+        mem[i] = random_byte(&rng);
+    }
+    const uint8_t flags = random_byte(&rng);
+    const uint8_t prelude[] = {
+        0xA2, random_byte(&rng),    // LDX #sp
+        0x9A,                       // TXS
+        0xA9, flags,                // LDA #flags
+        0x48,                       // PHA
+        0xA9, random_byte(&rng),    // LDA #a
+        0xA2, random_byte(&rng),    // LDX #x
+        0xA0, random_byte(&rng),    // LDY #y
+        0x28,                       // PLP
+    };
+    memcpy(&mem[PRELUDE_ADDR], prelude, sizeof(prelude));
+    mem[0xFFFC] = PRELUDE_ADDR & 0xFF;
+    mem[0xFFFD] = PRELUDE_ADDR >> 8;
+}
+
+static uint64_t mem_access(worker_t* w, uint64_t pins) {
+    const uint16_t addr = M6502_GET_ADDR(pins);
+    if (pins & M6502_RW) {
+        M6502_SET_DATA(pins, w->mem[addr]);
+    } else {
+        w->mem[addr] = M6502_GET_DATA(pins);
+    }
+    return pins;
+}
+
+static void p6502_step(worker_t* w) {
+    step(w->p6502);
+    if (state.log) {
+        printf("<-- "); chipStatus(w->p6502);
+    }
+}
+
+static bool fail(result_t* res, uint32_t tick, const char* what, unsigned int m6502_val, unsigned int p6502_val) {
+    res->failed = true;
+    res->tick = tick;
+    snprintf(res->msg, sizeof(res->msg), "%s mismatch (m6502: %X, perfect6502: %X)", what, m6502_val, p6502_val);
+    return false;
+}
+
+// compare the observable pin state after a tick
+static bool check_pins(worker_t* w, result_t* res, uint32_t tick) {
+    const uint16_t m6502_addr = M6502_GET_ADDR(w->pins);
+    const uint16_t p6502_addr = readAddressBus(w->p6502);
+    if (m6502_addr != p6502_addr) {
+        return fail(res, tick, "AB", m6502_addr, p6502_addr);
+    }
+    const uint8_t m6502_data = M6502_GET_DATA(w->pins);
+    const uint8_t p6502_data = readDataBus(w->p6502);
+    if (m6502_data != p6502_data) {
+        return fail(res, tick, "DB", m6502_data, p6502_data);
+    }
+    const bool m6502_rw = 0 != (w->pins & M6502_RW);
+    const bool p6502_rw = readRW(w->p6502);
+    if (m6502_rw != p6502_rw) {
+        return fail(res, tick, "RW", m6502_rw, p6502_rw);
+    }
+    const bool m6502_sync = 0 != (w->pins & M6502_SYNC);
+    const bool p6502_sync = isNodeHigh(w->p6502, SYNC_NODE);
+    if (m6502_sync != p6502_sync) {
+        return fail(res, tick, "SYNC", m6502_sync, p6502_sync);
+    }
+    return true;
+}
+
+// compare the registers at the start of an instruction
+static bool check_regs(worker_t* w, result_t* res, uint32_t tick) {
+    if (w->cpu.A != readA(w->p6502)) {
+        return fail(res, tick, "A", w->cpu.A, readA(w->p6502));
+    }
+    if (w->cpu.X != readX(w->p6502)) {
+        return fail(res, tick, "X", w->cpu.X, readX(w->p6502));
+    }
+    if (w->cpu.Y != readY(w->p6502)) {
+        return fail(res, tick, "Y", w->cpu.Y, readY(w->p6502));
+    }
+    if (w->cpu.S != readSP(w->p6502)) {
+        return fail(res, tick, "S", w->cpu.S, readSP(w->p6502));
+    }
+    if ((w->cpu.P & FLAGS_MASK) != (readP(w->p6502) & FLAGS_MASK)) {
+        return fail(res, tick, "P", w->cpu.P & FLAGS_MASK, readP(w->p6502) & FLAGS_MASK);
+    }
+    return true;
+}
+
+static void run_case(int item_index, int worker_index, void* user_data) {
+    (void)user_data;
+    worker_t* w = &state.workers[worker_index];
+    result_t* res = &state.results[item_index];
+    const uint32_t seed = state.seed + (uint32_t)item_index;
+
+    init_memory(w->mem, seed);
+    memcpy(w->p6502_mem, w->mem, sizeof(w->mem));
+
+    // reset both emulators, this runs the same way as start() in m6502-perfect.c
+    w->pins = m6502_init(&w->cpu, &(m6502_desc_t){0});
+    w->cpu.S = 0xC0;
+    for (int i = 0; i < 7; i++) {
+        w->pins = mem_access(w, m6502_tick(&w->cpu, w->pins));
+    }
+    w->p6502 = initAndResetChipWithMemory(w->p6502_mem);
+    for (int i = 0; i < 18; i++) {
+        p6502_step(w);
+    }
+    // perfect6502 runs one half-cycle ahead
+    p6502_step(w);
+
+    // the registers are compared once the prelude is done
+    const int prelude_instructions = 8;
+    int num_instructions = 0;   // number of completed instructions
+    for (uint32_t tick = 0; tick < state.num_ticks; tick++) {
+        w->pins = mem_access(w, m6502_tick(&w->cpu, w->pins));
+        p6502_step(w);
+        if (!check_pins(w, res, tick)) {
+            break;
+        }
+        // run into the next cycle, so that overlapped operations are finished
+        p6502_step(w);
+        if (w->pins & M6502_SYNC) {
+            if ((++num_instructions >= prelude_instructions) && !check_regs(w, res, tick)) {
+                break;
+            }
+        }
+    }
+    if (!res->failed && (0 != memcmp(w->mem, w->p6502_mem, sizeof(w->mem)))) {
+        res->failed = true;
+        res->tick = state.num_ticks;
+        snprintf(res->msg, sizeof(res->msg), "memory content mismatch");
+    }
+    destroyChip(w->p6502);
+    w->p6502 = 0;
+}
+
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    testvec_set_dir(sargs_value("dir"));
+    stm_setup();
+    state.seed = (uint32_t)strtoul(sargs_value_def("seed", "1"), 0, 10);
+    state.num_cases = atoi(sargs_value_def("cases", "64"));
+    state.num_ticks = (uint32_t)strtoul(sargs_value_def("ticks", "1000"), 0, 10);
+    state.log = sargs_boolean("log");
+    int num_workers = par_num_workers(atoi(sargs_value_def("threads", "0")));
+    if ((state.num_cases <= 0) || (state.num_cases > MAX_CASES)) {
+        fprintf(stderr, "cases must be between 1 and %d\n", MAX_CASES);
+        return 10;
+    }
+    char netlist_path[TESTVEC_MAX_PATH];
+    testvec_path(netlist_path, sizeof(netlist_path), __FILE__, "perfect6502/netlist-6502");
+    if (!loadChipNetlist(netlist_path)) {
+        return 10;
+    }
+    if (state.log) {
+        // interleaved output would be useless
+        num_workers = 1;
+    }
+    printf(">>> Running %d fuzz cases with %"PRIu32" ticks each on %d threads...\n", state.num_cases, state.num_ticks, num_workers);
+
+    uint64_t start_time = stm_now();
+    par_for(state.num_cases, num_workers, run_case, 0);
+    double dur = stm_sec(stm_since(start_time));
+
+    int num_failed = 0;
+    for (int i = 0; i < state.num_cases; i++) {
+        const result_t* res = &state.results[i];
+        if (res->failed) {
+            printf("FAILED: seed=%"PRIu32" tick=%"PRIu32": %s\n", state.seed + (uint32_t)i, res->tick, res->msg);
+            num_failed++;
+        }
+    }
+    printf("%d cases, %d failed, %.3f secs\n", state.num_cases, num_failed, dur);
+    sargs_shutdown();
+    return (0 == num_failed) ? 0 : 10;
+}
@@ -14,14 +14,19 @@
 //  ahead of the cycle-stepped m6502 emulator (so that results computed
 //  in the previous instruction - which overlaps with the opcode fetch of the
 //  next instruction - are available in registers for testing).
+//
+//  The 6502 netlist is loaded from tests/perfect6502/netlist-6502.
 //------------------------------------------------------------------------------
 #include "perfect6502/types.h"
 #include "perfect6502/netlist_sim.h"
 #include "perfect6502/perfect6502.h"
 #define CHIPS_IMPL
 #include "chips/m6502.h"
+#define TESTVEC_IMPL
+#include "testvec.h"
 #include "utest.h"
 #include <assert.h>
+#include <stdlib.h>
 
 #define T(b) ASSERT_TRUE(b)
 
@@ -96,6 +101,12 @@ static bool r16(uint16_t addr, uint16_t expected) {
 
 // initialize both emulators
 static void init() {
+    // the netlist is only loaded on the first call
+    char netlist_path[TESTVEC_MAX_PATH];
+    testvec_path(netlist_path, sizeof(netlist_path), __FILE__, "perfect6502/netlist-6502");
+    if (!loadChipNetlist(netlist_path)) {
+        exit(10);
+    }
     memset(mem, 0, sizeof(mem));
     memset(memory, 0, sizeof(memory));
     pins = m6502_init(&cpu, &(m6502_desc_t){0});
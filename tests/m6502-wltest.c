@@ -2,52 +2,115 @@
 //  m6502-wltest.c
 //  Runs the CPU-parts of the Wolfgang Lorenz C64 test suite
 //  (see: http://6502.org/tools/emu/)
+//
+//  Each test program in the suite loads the next one when it's done. Here
+//  all test programs run independently in parallel (one CPU and 64 KB RAM
+//  per worker thread), each until it wants to load its successor. The
+//  output is then printed by following the chain of test programs from
+//  the start program, like a sequential run would do.
+//
+//  The test programs are mapped into memory from the testsuite-2.15/bin
+//  directory at startup.
+//
+//  Usage (all args are optional):
+//
+//  m6502-wltest threads=4
+//
+//  threads:    number of worker threads, default is one per CPU core
+//  dir:        directory with the test data, see testvec_path() in testvec.h
 //------------------------------------------------------------------------------
 // force assert() enabled
 #define SOKOL_IMPL
 #include "sokol_time.h"
+#include "sokol_args.h"
 #define CHIPS_IMPL
 #include "chips/m6502.h"
 #include "chips/mem.h"
+#include "memview.h"
+#define PARALLEL_IMPL
+#include "parallel.h"
+#define TESTVEC_IMPL
+#include "testvec.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <inttypes.h>
-#include "testsuite-2.15/bin/dump.h"
 #ifdef NDEBUG
 #undef NDEBUG
 #endif
 
-uint64_t cpu_pins;
-m6502_t cpu;
-mem_t mem;
-uint8_t ram[1<<16];
-bool text_enabled = true;
+/* a hanging test program is given up after this many ticks */
+#define MAX_TICKS (500000000ULL)
+#define OUTPUT_SIZE (1<<14)
+#define MAX_NAME_SIZE (64)
+#define MAX_TESTS (512)
 
-/* set CPU state to continue running at a specific address */
-void cpu_goto(uint16_t addr) {
-    M6502_SET_ADDR(cpu_pins, addr);
-    M6502_SET_DATA(cpu_pins, mem_rd(&mem, addr));
-    cpu_pins |= M6502_SYNC|M6502_RW;
-    cpu.PC = addr;
+typedef struct {
+    uint64_t cpu_pins;
+    m6502_t cpu;
+    mem_t mem;
+    memview_t view;     // the flat RAM fast path for the tick loop
+    uint8_t ram[1<<16];
+    bool text_enabled;
+} worker_t;
+
+typedef struct {
+    char name[MAX_NAME_SIZE];
+    testvec_file_t file;
+} test_prog_t;
+
+typedef struct {
+    bool failed;
+    uint64_t ticks;
+    char next[MAX_NAME_SIZE];   /* name of the test program loaded next, empty if done */
+    int out_pos;
+    char output[OUTPUT_SIZE];
+} result_t;
+
+static struct {
+    worker_t workers[PAR_MAX_WORKERS];
+    int num_tests;
+    test_prog_t tests[MAX_TESTS];
+    result_t results[MAX_TESTS];
+} state;
+
+static void put_char(result_t* res, char c) {
+    if (res->out_pos < (OUTPUT_SIZE - 1)) {
+        res->output[res->out_pos++] = c;
+    }
 }
 
-/* load a test dump into memory, return false if last test is reached ('trap17') */
-bool load_test(const char* name) {
-    if (0 == strcmp(name, "trap1")) {
-        /* last test reached */
-        return false;
+static void put_str(result_t* res, const char* str) {
+    while (*str) {
+        put_char(res, *str++);
     }
-    else if (0 == strcmp(name, "sbcb(eb)")) {
+}
+
+/* set CPU state to continue running at a specific address */
+void cpu_goto(worker_t* w, uint16_t addr) {
+    M6502_SET_ADDR(w->cpu_pins, addr);
+    M6502_SET_DATA(w->cpu_pins, mem_rd(&w->mem, addr));
+    w->cpu_pins |= M6502_SYNC|M6502_RW;
+    w->cpu.PC = addr;
+}
+
+/* find a test dump by name */
+int find_test(const char* name) {
+    if (0 == strcmp(name, "sbcb(eb)")) {
         name = "sbcb_eb";
     }
-    const uint8_t* ptr = 0;
-    int size = 0;
-    for (int i = 0; i < DUMP_NUM_ITEMS; i++) {
-        if (0 == strcmp(dump_items[i].name, name)) {
-            ptr = dump_items[i].ptr;
-            size = dump_items[i].size;
-            break;
+    for (int i = 0; i < state.num_tests; i++) {
+        if (0 == strcmp(state.tests[i].name, name)) {
+            return i;
         }
     }
+    return -1;
+}
+
+/* load a test dump into memory */
+void load_test(worker_t* w, int item_index) {
+    const uint8_t* ptr = state.tests[item_index].file.ptr;
+    int size = (int)state.tests[item_index].file.size;
     assert(ptr && (size > 2));
 
     /* first 2 bytes of the dump are the start address */
@@ -55,16 +118,16 @@ bool load_test(const char* name) {
     uint8_t l = *ptr++;
     uint8_t h = *ptr++;
     uint16_t addr = (h<<8)|l;
-    mem_write_range(&mem, addr, ptr, size);
+    mem_write_range(&w->mem, addr, ptr, size);
 
     /* initialize some memory locations */
-    mem_wr(&mem, 0x0002, 0x00);
-    mem_wr(&mem, 0xA002, 0x00);
-    mem_wr(&mem, 0xA003, 0x80);
-    mem_wr(&mem, 0xFFFE, 0x48);
-    mem_wr(&mem, 0xFFFF, 0xFF);
-    mem_wr(&mem, 0x01FE, 0xFF);
-    mem_wr(&mem, 0x01FF, 0x7F);
+    mem_wr(&w->mem, 0x0002, 0x00);
+    mem_wr(&w->mem, 0xA002, 0x00);
+    mem_wr(&w->mem, 0xA003, 0x80);
+    mem_wr(&w->mem, 0xFFFE, 0x48);
+    mem_wr(&w->mem, 0xFFFF, 0xFF);
+    mem_wr(&w->mem, 0x01FE, 0xFF);
+    mem_wr(&w->mem, 0x01FF, 0x7F);
 
     /* KERNAL IRQ handler at 0xFF48 */
     uint8_t irq_handler[] = {
@@ -80,20 +143,19 @@ bool load_test(const char* name) {
         0x6C, 0x16, 0x03,   // JMP ($0316)
         0x6C, 0x14, 0x03,   // JMP ($0314)
     };
-    mem_write_range(&mem, 0xFF48, irq_handler, sizeof(irq_handler));
+    mem_write_range(&w->mem, 0xFF48, irq_handler, sizeof(irq_handler));
 
     /* continue execution at start address */
-    cpu.S = 0xFD;
-    cpu.P = M6502_BF|M6502_IF;
-    cpu_goto(0x801);
-    return true;
+    w->cpu.S = 0xFD;
+    w->cpu.P = M6502_BF|M6502_IF;
+    cpu_goto(w, 0x801);
 }
 
 /* pop return address from CPU stack */
-uint16_t pop() {
-    cpu.S++;
-    uint8_t l = mem_rd(&mem, 0x0100|cpu.S++);
-    uint8_t h = mem_rd(&mem, 0x0100|cpu.S);
+uint16_t pop(worker_t* w) {
+    w->cpu.S++;
+    uint8_t l = mem_rd(&w->mem, 0x0100|w->cpu.S++);
+    uint8_t h = mem_rd(&w->mem, 0x0100|w->cpu.S);
     uint16_t addr = (h<<8)|l;
     return addr;
 }
@@ -123,116 +185,207 @@ char petscii2ascii(uint8_t p) {
 }
 
 /* check for special trap addresses, and perform OS functions, return false to exit */
-bool handle_trap(int trap_id) {
+bool handle_trap(worker_t* w, result_t* res, int trap_id) {
     if (trap_id == 1) {
         /* print character */
-        mem_wr(&mem, 0x030C, 0x00);
-        if (text_enabled) {
-            putchar(petscii2ascii(cpu.A));
+        mem_wr(&w->mem, 0x030C, 0x00);
+        if (w->text_enabled) {
+            put_char(res, petscii2ascii(w->cpu.A));
         }
-        cpu_goto(pop() + 1);
+        cpu_goto(w, pop(w) + 1);
     }
     else if (trap_id == 2) {
-        /* load dump */
-        uint8_t l = mem_rd(&mem, 0x00BB);   // petscii filename address, low byte
-        uint8_t h = mem_rd(&mem, 0x00BC);   // petscii filename address, high byte
+        /* load dump: this ends the current test, just remember the name of the next test */
+        uint8_t l = mem_rd(&w->mem, 0x00BB);   // petscii filename address, low byte
+        uint8_t h = mem_rd(&w->mem, 0x00BC);   // petscii filename address, high byte
         uint16_t addr = (h<<8)|l;
-        int s = mem_rd(&mem, 0x00B7);   // petscii filename length
-        char name[64];
-        for (int i = 0; i < s; i++) {
-            name[i] = petscii2ascii(mem_rd(&mem, addr++));
+        int s = mem_rd(&w->mem, 0x00B7);   // petscii filename length
+        if (s >= MAX_NAME_SIZE) {
+            s = MAX_NAME_SIZE - 1;
         }
-        name[s] = 0;
-        if (!load_test(name)) {
-            /* last test reached */
-            return false;
+        for (int i = 0; i < s; i++) {
+            res->next[i] = petscii2ascii(mem_rd(&w->mem, addr++));
         }
-        pop();
-        cpu_goto(0x0816);
-        text_enabled = true;
+        res->next[s] = 0;
+        return false;
     }
     else if (trap_id == 3) {
         /* scan keyboard, this is called when an error was encountered,
            we'll continue, but disable text output until the next test is loaded
         */
-        if (text_enabled) {
-            puts("\nSKIP TEXT OUTPUT UNTIL NEXT TEST\n");
+        if (w->text_enabled) {
+            put_str(res, "\nSKIP TEXT OUTPUT UNTIL NEXT TEST\n\n");
         }
-        text_enabled = false;
-        cpu.A = 0x02;
-        cpu_goto(pop() + 1);
+        w->text_enabled = false;
+        res->failed = true;
+        w->cpu.A = 0x02;
+        cpu_goto(w, pop(w) + 1);
     }
-    else if ((cpu.PC == 0x8001) || (cpu.PC == 0xA475)) {
+    else if ((w->cpu.PC == 0x8001) || (w->cpu.PC == 0xA475)) {
         /* done */
         return false;
     }
     return true;
 }
 
-static bool test_trap(uint16_t pc) {
-    return ((cpu_pins & (M6502_SYNC|0xFFFF)) == (M6502_SYNC|pc));
+static bool test_trap(worker_t* w, uint16_t pc) {
+    return ((w->cpu_pins & (M6502_SYNC|0xFFFF)) == (M6502_SYNC|pc));
 }
 
-int test_traps(void) {
+int test_traps(worker_t* w) {
     static const uint16_t traps[] = { 0xFFD2, 0xE16F, 0xFFE4, 0x8000, 0xA474 };
     for (int i = 0; i < (int)(sizeof(traps)/sizeof(uint16_t)); i++) {
-        if (test_trap(traps[i])) {
+        if (test_trap(w, traps[i])) {
             return i + 1;
         }
     }
     return 0;
 }
 
-void tick(void) {
-    cpu_pins = m6502_tick(&cpu, cpu_pins);
-    const uint16_t addr = M6502_GET_ADDR(cpu_pins);
-    if (cpu_pins & M6502_RW) {
+void tick(worker_t* w) {
+    w->cpu_pins = m6502_tick(&w->cpu, w->cpu_pins);
+    const uint16_t addr = M6502_GET_ADDR(w->cpu_pins);
+    if (w->cpu_pins & M6502_RW) {
         /* memory read */
-        M6502_SET_DATA(cpu_pins, mem_rd(&mem, addr));
+        M6502_SET_DATA(w->cpu_pins, memview_rd(&w->view, addr));
     }
     else {
         /* memory write */
-        mem_wr(&mem, addr, M6502_GET_DATA(cpu_pins));
+        memview_wr(&w->view, addr, M6502_GET_DATA(w->cpu_pins));
     }
 }
 
-int main() {
-    puts(">>> Running Wolfgang Lorenz C64 test suite...");
-    stm_setup();
+/* the trap tests come after the CPU tests and need a real C64 (see the c64-wlspecial-tests command) */
+static bool is_cpu_test(int item_index) {
+    return 0 != strncmp(state.tests[item_index].name, "trap", 4);
+}
+
+/* collect the test program names (files without extension) */
+static void add_test(const char* dir, const char* name, void* user_data) {
+    (void)dir; (void)user_data;
+    if (strchr(name, '.') || (strlen(name) >= MAX_NAME_SIZE) || (state.num_tests == MAX_TESTS)) {
+        return;
+    }
+    snprintf(state.tests[state.num_tests++].name, MAX_NAME_SIZE, "%s", name);
+}
+
+static int cmp_tests(const void* a, const void* b) {
+    return strcmp(((const test_prog_t*)a)->name, ((const test_prog_t*)b)->name);
+}
+
+/* map all test programs into memory, in a stable order */
+static bool load_tests(void) {
+    char dir[TESTVEC_MAX_PATH];
+    testvec_path(dir, sizeof(dir), __FILE__, "testsuite-2.15/bin");
+    if (!testvec_scan_dir(dir, add_test, 0)) {
+        return false;
+    }
+    qsort(state.tests, (size_t)state.num_tests, sizeof(test_prog_t), cmp_tests);
+    for (int i = 0; i < state.num_tests; i++) {
+        char path[TESTVEC_MAX_PATH];
+        snprintf(path, sizeof(path), "%s/%s", dir, state.tests[i].name);
+        if (!testvec_map(&state.tests[i].file, path)) {
+            return false;
+        }
+    }
+    if (find_test("_start") < 0) {
+        printf("no test programs found in '%s'\n", dir);
+        return false;
+    }
+    return true;
+}
+
+/* run a single test program until it loads the next one */
+static void run_test(int item_index, int worker_index, void* user_data) {
+    (void)user_data;
+    worker_t* w = &state.workers[worker_index];
+    result_t* res = &state.results[item_index];
+    if (!is_cpu_test(item_index)) {
+        return;
+    }
 
     /* prepare environment (see http://www.softwolves.com/arkiv/cbm-hackers/7/7114.html) */
-    memset(ram, 0, sizeof(ram));
-    mem_map_ram(&mem, 0, 0x0000, sizeof(ram), ram);
+    memset(w->ram, 0, sizeof(w->ram));
+    memset(&w->mem, 0, sizeof(w->mem));
+    mem_map_ram(&w->mem, 0, 0x0000, sizeof(w->ram), w->ram);
+    memview_init(&w->view, &w->mem);
+    w->text_enabled = true;
 
     /* init CPU and run through the reset sequence */
     m6502_desc_t desc;
     memset(&desc, 0, sizeof(desc));
-    cpu_pins = m6502_init(&cpu, &desc);
+    w->cpu_pins = m6502_init(&w->cpu, &desc);
     for (int i = 0; i < 7; i++) {
-        tick();
+        tick(w);
     }
 
-    /* run the tests */
-    load_test("_start");
+    load_test(w, item_index);
+    if (item_index != find_test("_start")) {
+        /* same state as if loaded by the previous test program */
+        pop(w);
+        cpu_goto(w, 0x0816);
+    }
     bool done = false;
-    uint64_t start_time = stm_now();
-    uint64_t ticks = 0;
-    while (!done) {
-        tick();
-        ticks++;
-        if (cpu_pins & M6502_SYNC) {
-            int trap_id = test_traps();
+    while (!done && (res->ticks < MAX_TICKS)) {
+        tick(w);
+        res->ticks++;
+        if (w->cpu_pins & M6502_SYNC) {
+            int trap_id = test_traps(w);
             if (0 != trap_id) {
-                if (!handle_trap(trap_id)) {
+                if (!handle_trap(w, res, trap_id)) {
                     done = true;
                 }
             }
         }
     }
+    if (!done) {
+        put_str(res, "\nTEST TIMED OUT\n");
+        res->failed = true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    testvec_set_dir(sargs_value("dir"));
+    const int num_workers = par_num_workers(atoi(sargs_value_def("threads", "0")));
+    printf(">>> Running Wolfgang Lorenz C64 test suite on %d threads...\n", num_workers);
+    stm_setup();
+    if (!load_tests()) {
+        return 10;
+    }
+
+    /* run the tests */
+    uint64_t start_time = stm_now();
+    par_for(state.num_tests, num_workers, run_test, 0);
     double dur = stm_sec(stm_since(start_time));
+
+    /* print the output in the order the test programs load each other, until 'trap1' */
+    uint64_t ticks = 0;
+    int num_tests = 0;
+    int num_failed = 0;
+    int item_index = find_test("_start");
+    while ((item_index >= 0) && is_cpu_test(item_index) && (num_tests < state.num_tests)) {
+        const result_t* res = &state.results[item_index];
+        fputs(res->output, stdout);
+        ticks += res->ticks;
+        num_tests++;
+        if (res->failed) {
+            num_failed++;
+        }
+        if (0 == res->next[0]) {
+            break;
+        }
+        item_index = find_test(res->next);
+        if (item_index < 0) {
+            printf("\nTEST '%s' NOT FOUND\n", res->next);
+        }
+    }
     printf("\n%"PRIu64" cycles in %.3fsecs (%.2f MHz)\n", ticks, dur, (ticks/dur)/1000000.0);
+    printf("%d tests, %d failed\n", num_tests, num_failed);
     putchar('\n');
+    for (int i = 0; i < state.num_tests; i++) {
+        testvec_unmap(&state.tests[i].file);
+    }
+    sargs_shutdown();
     return 0;
 }
-
-
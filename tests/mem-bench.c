@@ -0,0 +1,342 @@
+//------------------------------------------------------------------------------
+//  mem-bench.c
+//
+//  Measures the cost of the memory access in the CPU tick loop, by
+//  running the same Z80 workload (the ZEXDOC instruction exerciser,
+//  mapped from roms/zexdoc.com) against different memory layouts:
+//
+//  flat:       a plain 64 KB array, like z80-zex.c
+//  mem:        a chips/mem.h mem_t with one 64 KB RAM mapping, through
+//              mem_rd() / mem_wr(), like m6502-wltest.c
+//  memview:    the same mem_t, through memview_rd() / memview_wr() from
+//              memview.h on each access, like the tick() function in
+//              m6502-wltest.c (which detects that the mem_t maps a single
+//              RAM block, and then indexes it directly)
+//  banked:     a mem_t with a CPC-6128 style layout: 4 x 16 KB slots mapped
+//              from a 128 KB RAM pool (the CPC's RAM configuration 2), with
+//              the upper ROM overlaid at 0xC000 (reads come from the ROM,
+//              writes go to the RAM underneath), the mapping is rebuilt
+//              periodically like when the gate array changes the RAM
+//              configuration
+//
+//  Like under CP/M, the word at address 6 holds the top of the program
+//  area (0xC000), ZEXDOC puts its stack there, so that it doesn't run
+//  into the ROM overlay.
+//
+//  Each layout runs the same number of ticks, with the same CPU state
+//  and RAM content at the end (checked with a checksum). The result
+//  is the best of several runs, reported as ns/tick and relative to the
+//  flat layout.
+//
+//  Usage (all args are optional):
+//
+//  mem-bench ticks=50000000 runs=3 remap=80000
+//
+//  ticks:      number of ticks per run
+//  runs:       number of measured runs per layout, the fastest counts
+//  remap:      ticks between rebuilding the banked layout (80000 is one
+//              CPC frame at 4 MHz), 0 to disable
+//  dir:        directory with the test data, see testvec_path() in testvec.h
+//------------------------------------------------------------------------------
+#define CHIPS_IMPL
+#include "chips/z80.h"
+#include "chips/mem.h"
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include "sokol_args.h"
+#define TESTVEC_IMPL
+#include "testvec.h"
+#include "memview.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define MEM_SIZE (1<<16)
+#define BANK_SIZE (1<<14)
+#define NUM_BANKS (8)
+#define PROG_ADDR (0x0100)
+#define BDOS_ADDR (0x0005)
+#define TPA_TOP_ADDR (0xC000)
+#define ROM_ADDR (0xC000)
+#define MAX_RUNS (64)
+
+typedef enum {
+    LAYOUT_FLAT,
+    LAYOUT_MEM,
+    LAYOUT_MEMVIEW,
+    LAYOUT_BANKED,
+    NUM_LAYOUTS,
+} layout_t;
+
+static const char* layout_names[NUM_LAYOUTS] = { "flat", "mem", "memview", "banked" };
+
+typedef struct {
+    double host_sec;
+    uint32_t checksum;
+} run_result_t;
+
+static struct {
+    const uint8_t* prog;
+    size_t prog_size;
+    uint64_t num_ticks;
+    uint64_t remap_ticks;
+    z80_t cpu;
+    uint8_t flat[MEM_SIZE];
+    uint8_t ram[MEM_SIZE];
+    uint8_t banked_ram[NUM_BANKS][BANK_SIZE];
+    uint8_t rom[BANK_SIZE];
+    mem_t mem;
+    memview_t view;
+} state;
+
+// bank numbers of the 4 slots, like the CPC's RAM configuration 2
+static const int bank_config[4] = { 4, 5, 6, 7 };
+
+static void map_banked(void) {
+    for (int slot = 0; slot < 4; slot++) {
+        mem_map_ram(&state.mem, 1, (uint16_t)(slot * BANK_SIZE), BANK_SIZE, state.banked_ram[bank_config[slot]]);
+    }
+    // the upper ROM, with the RAM of slot 3 underneath
+    mem_map_rw(&state.mem, 0, ROM_ADDR, BANK_SIZE, state.rom, state.banked_ram[bank_config[3]]);
+}
+
+static uint8_t rd(layout_t layout, uint16_t addr) {
+    switch (layout) {
+        case LAYOUT_FLAT: return state.flat[addr];
+        case LAYOUT_MEMVIEW: return memview_rd(&state.view, addr);
+        default: return mem_rd(&state.mem, addr);
+    }
+}
+
+static void wr(layout_t layout, uint16_t addr, uint8_t data) {
+    switch (layout) {
+        case LAYOUT_FLAT: state.flat[addr] = data; break;
+        case LAYOUT_MEMVIEW: memview_wr(&state.view, addr, data); break;
+        default: mem_wr(&state.mem, addr, data); break;
+    }
+}
+
+// read the RAM, also where it's hidden under the ROM (for the checksum)
+static uint8_t ram_rd(layout_t layout, uint16_t addr) {
+    switch (layout) {
+        case LAYOUT_FLAT: return state.flat[addr];
+        case LAYOUT_BANKED: return state.banked_ram[bank_config[addr / BANK_SIZE]][addr % BANK_SIZE];
+        default: return state.ram[addr];
+    }
+}
+
+// load the program and reset the CPU, same as in z80-zex.c
+static uint64_t init(layout_t layout) {
+    memset(state.flat, 0, sizeof(state.flat));
+    memset(state.ram, 0, sizeof(state.ram));
+    memset(state.banked_ram, 0, sizeof(state.banked_ram));
+    memset(state.rom, 0xFF, sizeof(state.rom));
+    mem_init(&state.mem);
+    switch (layout) {
+        case LAYOUT_MEM:
+        case LAYOUT_MEMVIEW:
+            mem_map_ram(&state.mem, 0, 0x0000, MEM_SIZE, state.ram);
+            break;
+        case LAYOUT_BANKED:
+            map_banked();
+            break;
+        default:
+            break;
+    }
+    memview_init(&state.view, &state.mem);
+    for (size_t i = 0; i < state.prog_size; i++) {
+        wr(layout, (uint16_t)(PROG_ADDR + i), state.prog[i]);
+    }
+    wr(layout, BDOS_ADDR + 1, TPA_TOP_ADDR & 0xFF);
+    wr(layout, BDOS_ADDR + 2, TPA_TOP_ADDR >> 8);
+    z80_init(&state.cpu);
+    state.cpu.sp = 0xF000;
+    return z80_prefetch(&state.cpu, PROG_ADDR);
+}
+
+// CP/M system calls are ignored, just emulate a RET
+static void bdos(layout_t layout) {
+    uint8_t l = rd(layout, state.cpu.sp++);
+    uint8_t h = rd(layout, state.cpu.sp++);
+    state.cpu.wz = (h<<8) | l;
+    state.cpu.pc = state.cpu.wz;
+}
+
+static uint32_t checksum(layout_t layout) {
+    uint32_t hash = 2166136261U;
+    for (uint32_t addr = 0; addr < MEM_SIZE; addr++) {
+        hash = (hash ^ ram_rd(layout, (uint16_t)addr)) * 16777619U;
+    }
+    const uint16_t regs[] = { state.cpu.pc, state.cpu.sp, state.cpu.af, state.cpu.bc, state.cpu.de, state.cpu.hl };
+    for (size_t i = 0; i < sizeof(regs) / sizeof(regs[0]); i++) {
+        hash = (hash ^ regs[i]) * 16777619U;
+    }
+    return hash;
+}
+
+// the tick loops are written out for each layout, so that the memory access is inlined
+static void run_flat(uint64_t pins, uint8_t* mem, layout_t layout) {
+    z80_t* cpu = &state.cpu;
+    for (uint64_t i = 0; i < state.num_ticks; i++) {
+        pins = z80_tick(cpu, pins);
+        if (pins & Z80_MREQ) {
+            const uint16_t addr = Z80_GET_ADDR(pins);
+            if (pins & Z80_RD) {
+                Z80_SET_DATA(pins, mem[addr]);
+            } else if (pins & Z80_WR) {
+                mem[addr] = Z80_GET_DATA(pins);
+            }
+        }
+        if (cpu->pc == BDOS_ADDR) {
+            bdos(layout);
+        }
+    }
+}
+
+static void run_mem(uint64_t pins, layout_t layout) {
+    z80_t* cpu = &state.cpu;
+    mem_t* mem = &state.mem;
+    for (uint64_t i = 0; i < state.num_ticks; i++) {
+        pins = z80_tick(cpu, pins);
+        if (pins & Z80_MREQ) {
+            const uint16_t addr = Z80_GET_ADDR(pins);
+            if (pins & Z80_RD) {
+                Z80_SET_DATA(pins, mem_rd(mem, addr));
+            } else if (pins & Z80_WR) {
+                mem_wr(mem, addr, Z80_GET_DATA(pins));
+            }
+        }
+        if (cpu->pc == BDOS_ADDR) {
+            bdos(layout);
+        }
+    }
+}
+
+static void run_memview(uint64_t pins, layout_t layout) {
+    z80_t* cpu = &state.cpu;
+    const memview_t* view = &state.view;
+    for (uint64_t i = 0; i < state.num_ticks; i++) {
+        pins = z80_tick(cpu, pins);
+        if (pins & Z80_MREQ) {
+            const uint16_t addr = Z80_GET_ADDR(pins);
+            if (pins & Z80_RD) {
+                Z80_SET_DATA(pins, memview_rd(view, addr));
+            } else if (pins & Z80_WR) {
+                memview_wr(view, addr, Z80_GET_DATA(pins));
+            }
+        }
+        if (cpu->pc == BDOS_ADDR) {
+            bdos(layout);
+        }
+    }
+}
+
+static void run_banked(uint64_t pins) {
+    z80_t* cpu = &state.cpu;
+    mem_t* mem = &state.mem;
+    uint64_t remap_count = 0;
+    for (uint64_t i = 0; i < state.num_ticks; i++) {
+        pins = z80_tick(cpu, pins);
+        if (pins & Z80_MREQ) {
+            const uint16_t addr = Z80_GET_ADDR(pins);
+            if (pins & Z80_RD) {
+                Z80_SET_DATA(pins, mem_rd(mem, addr));
+            } else if (pins & Z80_WR) {
+                mem_wr(mem, addr, Z80_GET_DATA(pins));
+            }
+        }
+        if (cpu->pc == BDOS_ADDR) {
+            bdos(LAYOUT_BANKED);
+        }
+        if (state.remap_ticks && (++remap_count == state.remap_ticks)) {
+            remap_count = 0;
+            map_banked();
+        }
+    }
+}
+
+static run_result_t run(layout_t layout) {
+    const uint64_t pins = init(layout);
+    const uint64_t start = stm_now();
+    switch (layout) {
+        case LAYOUT_FLAT:
+            run_flat(pins, state.flat, layout);
+            break;
+        case LAYOUT_MEM:
+            run_mem(pins, layout);
+            break;
+        case LAYOUT_MEMVIEW:
+            run_memview(pins, layout);
+            break;
+        default:
+            run_banked(pins);
+            break;
+    }
+    run_result_t res;
+    res.host_sec = stm_sec(stm_since(start));
+    res.checksum = checksum(layout);
+    return res;
+}
+
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    testvec_set_dir(sargs_value("dir"));
+    stm_setup();
+    state.num_ticks = strtoull(sargs_value_def("ticks", "50000000"), 0, 10);
+    state.remap_ticks = strtoull(sargs_value_def("remap", "80000"), 0, 10);
+    const int num_runs = atoi(sargs_value_def("runs", "3"));
+    if ((state.num_ticks == 0) || (num_runs < 1) || (num_runs > MAX_RUNS)) {
+        fprintf(stderr, "invalid args (ticks > 0, 1 <= runs <= %d)\n", MAX_RUNS);
+        return 10;
+    }
+    char path[TESTVEC_MAX_PATH];
+    testvec_path(path, sizeof(path), __FILE__, "roms/zexdoc.com");
+    testvec_file_t prog;
+    if (!testvec_map(&prog, path)) {
+        return 10;
+    }
+    if (prog.size > (MEM_SIZE - PROG_ADDR)) {
+        fprintf(stderr, "%s: program too big!\n", path);
+        return 10;
+    }
+    state.prog = prog.ptr;
+    state.prog_size = prog.size;
+
+    printf("== running ZEXDOC for %"PRIu64" ticks per run, best of %d runs\n", state.num_ticks, num_runs);
+    int num_mismatches = 0;
+    double flat_sec = 0.0;
+    uint32_t flat_checksum = 0;
+    for (int layout = 0; layout < NUM_LAYOUTS; layout++) {
+        run_result_t best = {0};
+        for (int i = 0; i < num_runs; i++) {
+            const run_result_t res = run((layout_t)layout);
+            if ((0 == i) || (res.host_sec < best.host_sec)) {
+                best = res;
+            }
+        }
+        if (layout == LAYOUT_FLAT) {
+            flat_sec = best.host_sec;
+            flat_checksum = best.checksum;
+        }
+        const bool mismatch = best.checksum != flat_checksum;
+        if (mismatch) {
+            num_mismatches++;
+        }
+        printf("  %-8s %9.3f sec %8.3f ns/tick %7.1f%% of flat   checksum %08X%s%s\n",
+            layout_names[layout],
+            best.host_sec,
+            (best.host_sec * 1000000000.0) / (double)state.num_ticks,
+            (best.host_sec / flat_sec) * 100.0,
+            best.checksum,
+            ((layout == LAYOUT_MEMVIEW) && !memview_flat(&state.view)) ? " (not flat!)" : "",
+            mismatch ? " *** MISMATCH" : "");
+    }
+    testvec_unmap(&prog);
+    sargs_shutdown();
+    if (num_mismatches > 0) {
+        printf("== %d layout(s) ended with different CPU or memory state!\n", num_mismatches);
+        return 10;
+    }
+    return 0;
+}
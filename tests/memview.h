@@ -0,0 +1,65 @@
+#pragma once
+/*
+    memview.h -- a read-through fast path for chips/mem.h
+
+    Include chips/mem.h before this header.
+
+    mem_rd() and mem_wr() go through the mem_t page table on each access
+    (a shift, a page pointer load and a mask). In the common case of
+    test harnesses which map the whole 64 KB address space to a single
+    contiguous RAM block (like m6502-wltest.c), memview_init() detects
+    this, and memview_rd() / memview_wr() index the RAM block directly.
+    Any other mapping (mirrors, ROM, bank-switched layouts) falls back
+    to mem_rd() / mem_wr().
+
+    memview_rd() / memview_wr() check for the flat case on each access,
+    in the hottest loops get the RAM block once with memview_flat() and
+    pick a loop which indexes it directly.
+
+    memview_init() must be called again after each mem_map_*() or
+    mem_unmap_*() call.
+
+    See mem-bench.c for the measured difference.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+    mem_t* mem;
+    uint8_t* flat;      // the whole address space as one RAM block, or 0
+} memview_t;
+
+static inline void memview_init(memview_t* view, mem_t* mem) {
+    view->mem = mem;
+    view->flat = 0;
+    const uintptr_t base = (uintptr_t) mem->page_table[0].write_ptr;
+    for (uintptr_t i = 0; i < MEM_NUM_PAGES; i++) {
+        const mem_page_t* page = &mem->page_table[i];
+        const uintptr_t expected = base + i * MEM_PAGE_SIZE;
+        if (((uintptr_t)page->read_ptr != expected) || ((uintptr_t)page->write_ptr != expected)) {
+            return;
+        }
+    }
+    view->flat = mem->page_table[0].write_ptr;
+}
+
+// the RAM block mapped to the whole address space, or 0
+static inline uint8_t* memview_flat(const memview_t* view) {
+    return view->flat;
+}
+
+static inline uint8_t memview_rd(const memview_t* view, uint16_t addr) {
+    if (view->flat) {
+        return view->flat[addr];
+    } else {
+        return mem_rd(view->mem, addr);
+    }
+}
+
+static inline void memview_wr(const memview_t* view, uint16_t addr, uint8_t data) {
+    if (view->flat) {
+        view->flat[addr] = data;
+    } else {
+        mem_wr(view->mem, addr, data);
+    }
+}
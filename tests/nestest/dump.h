@@ -1,1544 +0,0 @@
-#pragma once
-// machine generated, do not edit!
-#include <stdint.h>
-#include <stddef.h>
-static uint8_t dump_nestest_nes[24592] = {
-0x4e, 0x45, 0x53, 0x1a, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x4c, 0xf5, 0xc5, 0x60, 0x78, 0xd8, 0xa2, 0xff, 0x9a, 0xad, 0x02, 0x20, 0x10, 0xfb, 0xad, 0x02, 
-0x20, 0x10, 0xfb, 0xa9, 0x00, 0x8d, 0x00, 0x20, 0x8d, 0x01, 0x20, 0x8d, 0x05, 0x20, 0x8d, 0x05, 
-0x20, 0xad, 0x02, 0x20, 0xa2, 0x20, 0x8e, 0x06, 0x20, 0xa2, 0x00, 0x8e, 0x06, 0x20, 0xa2, 0x00, 
-0xa0, 0x0f, 0xa9, 0x00, 0x8d, 0x07, 0x20, 0xca, 0xd0, 0xfa, 0x88, 0xd0, 0xf7, 0xa9, 0x3f, 0x8d, 
-0x06, 0x20, 0xa9, 0x00, 0x8d, 0x06, 0x20, 0xa2, 0x00, 0xbd, 0x78, 0xff, 0x8d, 0x07, 0x20, 0xe8, 
-0xe0, 0x20, 0xd0, 0xf5, 0xa9, 0xc0, 0x8d, 0x17, 0x40, 0xa9, 0x00, 0x8d, 0x15, 0x40, 0xa9, 0x78, 
-0x85, 0xd0, 0xa9, 0xfb, 0x85, 0xd1, 0xa9, 0x7f, 0x85, 0xd3, 0xa0, 0x00, 0x8c, 0x06, 0x20, 0x8c, 
-0x06, 0x20, 0xa9, 0x00, 0x85, 0xd7, 0xa9, 0x07, 0x85, 0xd0, 0xa9, 0xc3, 0x85, 0xd1, 0x20, 0xa7, 
-0xc2, 0x20, 0x8d, 0xc2, 0xa2, 0x12, 0x20, 0x61, 0xc2, 0xa5, 0xd5, 0x4a, 0x4a, 0x4a, 0xb0, 0x1c, 
-0x4a, 0xb0, 0x0c, 0x4a, 0xb0, 0x27, 0x4a, 0xb0, 0x03, 0x4c, 0x81, 0xc0, 0x4c, 0x26, 0xc1, 0x20, 
-0x6f, 0xc6, 0xc6, 0xd7, 0x10, 0xdb, 0xa9, 0x0d, 0x85, 0xd7, 0xd0, 0xd5, 0x20, 0x6f, 0xc6, 0xe6, 
-0xd7, 0xa5, 0xd7, 0xc9, 0x0e, 0x90, 0xca, 0xa9, 0x00, 0x85, 0xd7, 0xf0, 0xc4, 0x20, 0x89, 0xc6, 
-0xa5, 0xd7, 0xf0, 0x06, 0x20, 0xed, 0xc0, 0x4c, 0x81, 0xc0, 0xa9, 0x00, 0x85, 0xd8, 0xe6, 0xd7, 
-0x20, 0xed, 0xc0, 0xe6, 0xd7, 0xa5, 0xd7, 0xc9, 0x0e, 0xd0, 0xf5, 0xa9, 0x00, 0x85, 0xd7, 0xa5, 
-0xd8, 0xf0, 0x02, 0xa9, 0xff, 0x85, 0x00, 0x20, 0xed, 0xc1, 0x4c, 0x81, 0xc0, 0xa5, 0xd7, 0x0a, 
-0xaa, 0xbd, 0x0a, 0xc1, 0x8d, 0x00, 0x02, 0xbd, 0x0b, 0xc1, 0x8d, 0x01, 0x02, 0xa9, 0xc1, 0x48, 
-0xa9, 0xde, 0x48, 0xa9, 0x00, 0x85, 0x00, 0x6c, 0x00, 0x02, 0x2d, 0xc7, 0x2d, 0xc7, 0xdb, 0xc7, 
-0x85, 0xc8, 0xde, 0xcb, 0xf8, 0xcd, 0xee, 0xce, 0xa2, 0xcf, 0x74, 0xd1, 0xfb, 0xd4, 0xd4, 0xc1, 
-0x4a, 0xdf, 0xb8, 0xdb, 0xaa, 0xe1, 0xa9, 0x00, 0x85, 0xd7, 0xa9, 0x92, 0x85, 0xd0, 0xa9, 0xc4, 
-0x85, 0xd1, 0x20, 0xa7, 0xc2, 0x20, 0x8d, 0xc2, 0xa2, 0x0f, 0x20, 0x61, 0xc2, 0xa5, 0xd5, 0x4a, 
-0x4a, 0x4a, 0xb0, 0x1c, 0x4a, 0xb0, 0x0c, 0x4a, 0xb0, 0x27, 0x4a, 0xb0, 0x03, 0x4c, 0x35, 0xc1, 
-0x4c, 0x72, 0xc0, 0x20, 0x6f, 0xc6, 0xc6, 0xd7, 0x10, 0xdb, 0xa9, 0x0a, 0x85, 0xd7, 0xd0, 0xd5, 
-0x20, 0x6f, 0xc6, 0xe6, 0xd7, 0xa5, 0xd7, 0xc9, 0x0b, 0x90, 0xca, 0xa9, 0x00, 0x85, 0xd7, 0xf0, 
-0xc4, 0x20, 0x89, 0xc6, 0xa5, 0xd7, 0xf0, 0x06, 0x20, 0xa1, 0xc1, 0x4c, 0x35, 0xc1, 0xa9, 0x00, 
-0x85, 0xd8, 0xe6, 0xd7, 0x20, 0xa1, 0xc1, 0xe6, 0xd7, 0xa5, 0xd7, 0xc9, 0x0b, 0xd0, 0xf5, 0xa9, 
-0x00, 0x85, 0xd7, 0xa5, 0xd8, 0xf0, 0x02, 0xa9, 0xff, 0x85, 0x00, 0x20, 0xed, 0xc1, 0x4c, 0x35, 
-0xc1, 0xa5, 0xd7, 0x0a, 0xaa, 0xbd, 0xbe, 0xc1, 0x8d, 0x00, 0x02, 0xbd, 0xbf, 0xc1, 0x8d, 0x01, 
-0x02, 0xa9, 0xc1, 0x48, 0xa9, 0xde, 0x48, 0xa9, 0x00, 0x85, 0x00, 0x6c, 0x00, 0x02, 0xa3, 0xc6, 
-0xa3, 0xc6, 0x1e, 0xe5, 0x3d, 0xe7, 0xd3, 0xe8, 0x16, 0xe9, 0x86, 0xeb, 0xf6, 0xed, 0x66, 0xf0, 
-0xd6, 0xf2, 0x46, 0xf5, 0xa9, 0x00, 0x85, 0x00, 0x20, 0x00, 0xd9, 0x20, 0xe0, 0xda, 0xea, 0xea, 
-0xea, 0xa5, 0x00, 0xf0, 0x02, 0x85, 0xd8, 0x4c, 0xed, 0xc1, 0x4c, 0x81, 0xc0, 0x20, 0x8d, 0xc2, 
-0xa9, 0x00, 0x85, 0xd3, 0xa5, 0xd7, 0x18, 0x69, 0x04, 0x0a, 0x26, 0xd3, 0x0a, 0x26, 0xd3, 0x0a, 
-0x26, 0xd3, 0x0a, 0x26, 0xd3, 0x0a, 0x26, 0xd3, 0x48, 0xa5, 0xd3, 0x09, 0x20, 0x8d, 0x06, 0x20, 
-0x68, 0x09, 0x04, 0x8d, 0x06, 0x20, 0xa5, 0x00, 0xf0, 0x1d, 0xc9, 0xff, 0xf0, 0x26, 0x4a, 0x4a, 
-0x4a, 0x4a, 0xaa, 0xbd, 0x51, 0xc2, 0x8d, 0x07, 0x20, 0xa5, 0x00, 0x29, 0x0f, 0xaa, 0xbd, 0x51, 
-0xc2, 0x8d, 0x07, 0x20, 0x4c, 0x94, 0xc2, 0xa9, 0x4f, 0x8d, 0x07, 0x20, 0xa9, 0x4b, 0x8d, 0x07, 
-0x20, 0x4c, 0x94, 0xc2, 0xa9, 0x45, 0x8d, 0x07, 0x20, 0xa9, 0x72, 0x8d, 0x07, 0x20, 0x4c, 0x94, 
-0xc2, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41, 0x42, 0x43, 0x44, 0x45, 
-0x46, 0xa5, 0xd7, 0x18, 0x69, 0x04, 0xa8, 0xa9, 0x84, 0x8d, 0x00, 0x20, 0xa9, 0x20, 0x8d, 0x06, 
-0x20, 0xa9, 0x02, 0x8d, 0x06, 0x20, 0xa9, 0x20, 0x88, 0xc8, 0xd0, 0x02, 0xa9, 0x2a, 0x8d, 0x07, 
-0x20, 0x88, 0xca, 0xd0, 0xf1, 0xa9, 0x80, 0x8d, 0x00, 0x20, 0x4c, 0x94, 0xc2, 0xa5, 0xd2, 0xc5, 
-0xd2, 0xf0, 0xfc, 0x60, 0xa9, 0x00, 0x8d, 0x05, 0x20, 0x8d, 0x05, 0x20, 0xa9, 0x00, 0x8d, 0x06, 
-0x20, 0xa9, 0x00, 0x8d, 0x06, 0x20, 0x60, 0xa9, 0x00, 0x8d, 0x00, 0x20, 0x8d, 0x01, 0x20, 0x20, 
-0xed, 0xc2, 0xa9, 0x20, 0x8d, 0x06, 0x20, 0xa0, 0x00, 0x8c, 0x06, 0x20, 0xa2, 0x20, 0xb1, 0xd0, 
-0xf0, 0x20, 0xc9, 0xff, 0xf0, 0x0d, 0x8d, 0x07, 0x20, 0xc8, 0xd0, 0x02, 0xe6, 0xd1, 0xca, 0xd0, 
-0xed, 0xf0, 0xe9, 0xc8, 0xd0, 0x02, 0xe6, 0xd1, 0xa9, 0x20, 0x8d, 0x07, 0x20, 0xca, 0xd0, 0xf8, 
-0xf0, 0xda, 0xa9, 0x80, 0x8d, 0x00, 0x20, 0xa9, 0x0e, 0x8d, 0x01, 0x20, 0x60, 0xa9, 0x20, 0x8d, 
-0x06, 0x20, 0xa9, 0x00, 0x8d, 0x06, 0x20, 0xa2, 0x1e, 0xa9, 0x20, 0xa0, 0x20, 0x8d, 0x07, 0x20, 
-0x88, 0xd0, 0xfa, 0xca, 0xd0, 0xf5, 0x60, 0xff, 0xff, 0xff, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 
-0x2d, 0x20, 0x52, 0x75, 0x6e, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 
-0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x42, 0x72, 0x61, 0x6e, 0x63, 0x68, 0x20, 0x74, 0x65, 
-0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x46, 0x6c, 0x61, 0x67, 0x20, 
-0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x49, 0x6d, 0x6d, 
-0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 
-0x20, 0x2d, 0x2d, 0x20, 0x49, 0x6d, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x74, 0x65, 0x73, 0x74, 
-0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x53, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x74, 
-0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x41, 0x63, 0x63, 0x75, 
-0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x28, 0x49, 0x6e, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x2c, 0x58, 
-0x29, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x5a, 
-0x65, 0x72, 0x6f, 0x70, 0x61, 0x67, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x41, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x20, 0x74, 0x65, 
-0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x28, 0x49, 0x6e, 0x64, 0x69, 
-0x72, 0x65, 0x63, 0x74, 0x29, 0x2c, 0x59, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x41, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x2c, 0x59, 0x20, 
-0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x5a, 0x65, 0x72, 
-0x6f, 0x70, 0x61, 0x67, 0x65, 0x2c, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x41, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x2c, 0x58, 0x20, 
-0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0xff, 0xff, 0x20, 0x20, 0x20, 0x20, 0x55, 0x70, 0x2f, 0x44, 
-0x6f, 0x77, 0x6e, 0x3a, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74, 
-0xff, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x3a, 0x20, 0x72, 0x75, 
-0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0xff, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x6c, 0x65, 
-0x63, 0x74, 0x3a, 0x20, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x6f, 0x70, 0x73, 0x21, 
-0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x75, 0x6e, 
-0x20, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 
-0x2d, 0x20, 0x4e, 0x4f, 0x50, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 0x20, 
-0x2d, 0x2d, 0x20, 0x4c, 0x41, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 
-0x20, 0x2d, 0x2d, 0x20, 0x53, 0x41, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x53, 0x42, 0x43, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x28, 0x6f, 
-0x70, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x30, 0x45, 0x42, 0x68, 0x29, 0xff, 0x20, 0x20, 0x20, 0x20, 
-0x2d, 0x2d, 0x20, 0x44, 0x43, 0x50, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 0x20, 
-0x20, 0x2d, 0x2d, 0x20, 0x49, 0x53, 0x42, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 0x20, 
-0x20, 0x20, 0x2d, 0x2d, 0x20, 0x53, 0x4c, 0x4f, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 0x20, 
-0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x4c, 0x41, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xff, 
-0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x53, 0x52, 0x45, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 
-0xff, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x52, 0x41, 0x20, 0x74, 0x65, 0x73, 0x74, 
-0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x20, 0x20, 0x20, 0x55, 0x70, 0x2f, 0x44, 0x6f, 
-0x77, 0x6e, 0x3a, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74, 0xff, 
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x3a, 0x20, 0x72, 0x75, 0x6e, 
-0x20, 0x74, 0x65, 0x73, 0x74, 0xff, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x6c, 0x65, 0x63, 
-0x74, 0x3a, 0x20, 0x4e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x6f, 0x70, 0x73, 0xff, 0x00, 0x48, 
-0x8a, 0x48, 0xad, 0x02, 0x20, 0xa9, 0x20, 0x8d, 0x06, 0x20, 0xa9, 0x40, 0x8d, 0x06, 0x20, 0xe6, 
-0xd2, 0xa9, 0x00, 0x8d, 0x05, 0x20, 0x8d, 0x05, 0x20, 0xa9, 0x00, 0x8d, 0x06, 0x20, 0xa9, 0x00, 
-0x8d, 0x06, 0x20, 0xa2, 0x09, 0x8e, 0x16, 0x40, 0xca, 0x8e, 0x16, 0x40, 0xad, 0x16, 0x40, 0x4a, 
-0x26, 0xd4, 0xca, 0xd0, 0xf7, 0xa5, 0xd4, 0xaa, 0x45, 0xd6, 0x25, 0xd4, 0x85, 0xd5, 0x86, 0xd6, 
-0x68, 0xaa, 0x68, 0x40, 0x40, 0xa2, 0x00, 0x86, 0x00, 0x86, 0x10, 0x86, 0x11, 0x20, 0x2d, 0xc7, 
-0x20, 0xdb, 0xc7, 0x20, 0x85, 0xc8, 0x20, 0xde, 0xcb, 0x20, 0xf8, 0xcd, 0x20, 0xee, 0xce, 0x20, 
-0xa2, 0xcf, 0x20, 0x74, 0xd1, 0x20, 0xfb, 0xd4, 0x20, 0x00, 0xd9, 0xa5, 0x00, 0x85, 0x10, 0xa9, 
-0x00, 0x85, 0x00, 0x20, 0xe0, 0xda, 0x20, 0x4a, 0xdf, 0x20, 0xb8, 0xdb, 0x20, 0xaa, 0xe1, 0x20, 
-0xa3, 0xc6, 0x20, 0x1e, 0xe5, 0x20, 0x3d, 0xe7, 0x20, 0xd3, 0xe8, 0x20, 0x16, 0xe9, 0x20, 0x86, 
-0xeb, 0x20, 0xf6, 0xed, 0x20, 0x66, 0xf0, 0x20, 0xd6, 0xf2, 0xa5, 0x00, 0x85, 0x11, 0xa9, 0x00, 
-0x85, 0x00, 0x20, 0x46, 0xf5, 0xa5, 0x00, 0x05, 0x10, 0x05, 0x11, 0xf0, 0x0e, 0x20, 0x6f, 0xc6, 
-0xa6, 0x00, 0x86, 0x02, 0xa6, 0x10, 0x86, 0x03, 0x4c, 0x6e, 0xc6, 0x20, 0x89, 0xc6, 0x60, 0xa9, 
-0x03, 0x8d, 0x15, 0x40, 0xa9, 0x87, 0x8d, 0x00, 0x40, 0xa9, 0x89, 0x8d, 0x01, 0x40, 0xa9, 0xf0, 
-0x8d, 0x02, 0x40, 0xa9, 0x00, 0x8d, 0x03, 0x40, 0x60, 0xa9, 0x02, 0x8d, 0x15, 0x40, 0xa9, 0x3f, 
-0x8d, 0x04, 0x40, 0xa9, 0x9a, 0x8d, 0x05, 0x40, 0xa9, 0xff, 0x8d, 0x06, 0x40, 0xa9, 0x00, 0x8d, 
-0x07, 0x40, 0x60, 0xa0, 0x4e, 0xa9, 0xff, 0x85, 0x01, 0x20, 0xb0, 0xc6, 0x20, 0xb7, 0xc6, 0x60, 
-0xa9, 0xff, 0x48, 0xa9, 0xaa, 0xd0, 0x05, 0xa9, 0x34, 0x48, 0xa9, 0x55, 0x28, 0x04, 0xa9, 0x44, 
-0xa9, 0x64, 0xa9, 0xea, 0xea, 0xea, 0xea, 0x08, 0x48, 0x0c, 0xa9, 0xa9, 0xea, 0xea, 0xea, 0xea, 
-0x08, 0x48, 0x14, 0xa9, 0x34, 0xa9, 0x54, 0xa9, 0x74, 0xa9, 0xd4, 0xa9, 0xf4, 0xa9, 0xea, 0xea, 
-0xea, 0xea, 0x08, 0x48, 0x1a, 0x3a, 0x5a, 0x7a, 0xda, 0xfa, 0x80, 0x89, 0xea, 0xea, 0xea, 0xea, 
-0x08, 0x48, 0x1c, 0xa9, 0xa9, 0x3c, 0xa9, 0xa9, 0x5c, 0xa9, 0xa9, 0x7c, 0xa9, 0xa9, 0xdc, 0xa9, 
-0xa9, 0xfc, 0xa9, 0xa9, 0xea, 0xea, 0xea, 0xea, 0x08, 0x48, 0xa2, 0x05, 0x68, 0xc9, 0x55, 0xf0, 
-0x0a, 0xc9, 0xaa, 0xf0, 0x06, 0x68, 0x84, 0x00, 0x4c, 0x28, 0xc7, 0x68, 0x29, 0xcb, 0xc9, 0x00, 
-0xf0, 0x06, 0xc9, 0xcb, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xca, 0xd0, 0xe0, 0x60, 0xea, 0x38, 0xb0, 
-0x04, 0xa2, 0x01, 0x86, 0x00, 0xea, 0x18, 0xb0, 0x03, 0x4c, 0x40, 0xc7, 0xa2, 0x02, 0x86, 0x00, 
-0xea, 0x38, 0x90, 0x03, 0x4c, 0x4b, 0xc7, 0xa2, 0x03, 0x86, 0x00, 0xea, 0x18, 0x90, 0x04, 0xa2, 
-0x04, 0x86, 0x00, 0xea, 0xa9, 0x00, 0xf0, 0x04, 0xa2, 0x05, 0x86, 0x00, 0xea, 0xa9, 0x40, 0xf0, 
-0x03, 0x4c, 0x68, 0xc7, 0xa2, 0x06, 0x86, 0x00, 0xea, 0xa9, 0x40, 0xd0, 0x04, 0xa2, 0x07, 0x86, 
-0x00, 0xea, 0xa9, 0x00, 0xd0, 0x03, 0x4c, 0x7d, 0xc7, 0xa2, 0x08, 0x86, 0x00, 0xea, 0xa9, 0xff, 
-0x85, 0x01, 0x24, 0x01, 0x70, 0x04, 0xa2, 0x09, 0x86, 0x00, 0xea, 0x24, 0x01, 0x50, 0x03, 0x4c, 
-0x96, 0xc7, 0xa2, 0x0a, 0x86, 0x00, 0xea, 0xa9, 0x00, 0x85, 0x01, 0x24, 0x01, 0x50, 0x04, 0xa2, 
-0x0b, 0x86, 0x00, 0xea, 0x24, 0x01, 0x70, 0x03, 0x4c, 0xaf, 0xc7, 0xa2, 0x0c, 0x86, 0x00, 0xea, 
-0xa9, 0x00, 0x10, 0x04, 0xa2, 0x0d, 0x86, 0x00, 0xea, 0xa9, 0x80, 0x10, 0x03, 0x4c, 0xd9, 0xc7, 
-0xa2, 0x0e, 0x86, 0x00, 0xea, 0xa9, 0x80, 0x30, 0x04, 0xa2, 0x0f, 0x86, 0x00, 0xea, 0xa9, 0x00, 
-0x30, 0x03, 0x4c, 0xd9, 0xc7, 0xa2, 0x10, 0x86, 0x00, 0xea, 0x60, 0xea, 0xa9, 0xff, 0x85, 0x01, 
-0x24, 0x01, 0xa9, 0x00, 0x38, 0x78, 0xf8, 0x08, 0x68, 0x29, 0xef, 0xc9, 0x6f, 0xf0, 0x04, 0xa2, 
-0x11, 0x86, 0x00, 0xea, 0xa9, 0x40, 0x85, 0x01, 0x24, 0x01, 0xd8, 0xa9, 0x10, 0x18, 0x08, 0x68, 
-0x29, 0xef, 0xc9, 0x64, 0xf0, 0x04, 0xa2, 0x12, 0x86, 0x00, 0xea, 0xa9, 0x80, 0x85, 0x01, 0x24, 
-0x01, 0xf8, 0xa9, 0x00, 0x38, 0x08, 0x68, 0x29, 0xef, 0xc9, 0x2f, 0xf0, 0x04, 0xa2, 0x13, 0x86, 
-0x00, 0xea, 0xa9, 0xff, 0x48, 0x28, 0xd0, 0x09, 0x10, 0x07, 0x50, 0x05, 0x90, 0x03, 0x4c, 0x35, 
-0xc8, 0xa2, 0x14, 0x86, 0x00, 0xea, 0xa9, 0x04, 0x48, 0x28, 0xf0, 0x09, 0x30, 0x07, 0x70, 0x05, 
-0xb0, 0x03, 0x4c, 0x49, 0xc8, 0xa2, 0x15, 0x86, 0x00, 0xea, 0xf8, 0xa9, 0xff, 0x85, 0x01, 0x24, 
-0x01, 0x18, 0xa9, 0x00, 0x48, 0xa9, 0xff, 0x68, 0xd0, 0x09, 0x30, 0x07, 0x50, 0x05, 0xb0, 0x03, 
-0x4c, 0x67, 0xc8, 0xa2, 0x16, 0x86, 0x00, 0xea, 0xa9, 0x00, 0x85, 0x01, 0x24, 0x01, 0x38, 0xa9, 
-0xff, 0x48, 0xa9, 0x00, 0x68, 0xf0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4c, 0x84, 0xc8, 
-0xa2, 0x17, 0x86, 0x00, 0x60, 0xea, 0x18, 0xa9, 0xff, 0x85, 0x01, 0x24, 0x01, 0xa9, 0x55, 0x09, 
-0xaa, 0xb0, 0x0b, 0x10, 0x09, 0xc9, 0xff, 0xd0, 0x05, 0x50, 0x03, 0x4c, 0xa2, 0xc8, 0xa2, 0x18, 
-0x86, 0x00, 0xea, 0x38, 0xb8, 0xa9, 0x00, 0x09, 0x00, 0xd0, 0x09, 0x70, 0x07, 0x90, 0x05, 0x30, 
-0x03, 0x4c, 0xb8, 0xc8, 0xa2, 0x19, 0x86, 0x00, 0xea, 0x18, 0x24, 0x01, 0xa9, 0x55, 0x29, 0xaa, 
-0xd0, 0x09, 0x50, 0x07, 0xb0, 0x05, 0x30, 0x03, 0x4c, 0xcf, 0xc8, 0xa2, 0x1a, 0x86, 0x00, 0xea, 
-0x38, 0xb8, 0xa9, 0xf8, 0x29, 0xef, 0x90, 0x0b, 0x10, 0x09, 0xc9, 0xe8, 0xd0, 0x05, 0x70, 0x03, 
-0x4c, 0xe7, 0xc8, 0xa2, 0x1b, 0x86, 0x00, 0xea, 0x18, 0x24, 0x01, 0xa9, 0x5f, 0x49, 0xaa, 0xb0, 
-0x0b, 0x10, 0x09, 0xc9, 0xf5, 0xd0, 0x05, 0x50, 0x03, 0x4c, 0x00, 0xc9, 0xa2, 0x1c, 0x86, 0x00, 
-0xea, 0x38, 0xb8, 0xa9, 0x70, 0x49, 0x70, 0xd0, 0x09, 0x70, 0x07, 0x90, 0x05, 0x30, 0x03, 0x4c, 
-0x16, 0xc9, 0xa2, 0x1d, 0x86, 0x00, 0xea, 0x18, 0x24, 0x01, 0xa9, 0x00, 0x69, 0x69, 0x30, 0x0b, 
-0xb0, 0x09, 0xc9, 0x69, 0xd0, 0x05, 0x70, 0x03, 0x4c, 0x2f, 0xc9, 0xa2, 0x1e, 0x86, 0x00, 0xea, 
-0x38, 0xf8, 0x24, 0x01, 0xa9, 0x01, 0x69, 0x69, 0x30, 0x0b, 0xb0, 0x09, 0xc9, 0x6b, 0xd0, 0x05, 
-0x70, 0x03, 0x4c, 0x49, 0xc9, 0xa2, 0x1f, 0x86, 0x00, 0xea, 0xd8, 0x38, 0xb8, 0xa9, 0x7f, 0x69, 
-0x7f, 0x10, 0x0b, 0xb0, 0x09, 0xc9, 0xff, 0xd0, 0x05, 0x50, 0x03, 0x4c, 0x62, 0xc9, 0xa2, 0x20, 
-0x86, 0x00, 0xea, 0x18, 0x24, 0x01, 0xa9, 0x7f, 0x69, 0x80, 0x10, 0x0b, 0xb0, 0x09, 0xc9, 0xff, 
-0xd0, 0x05, 0x70, 0x03, 0x4c, 0x7b, 0xc9, 0xa2, 0x21, 0x86, 0x00, 0xea, 0x38, 0xb8, 0xa9, 0x7f, 
-0x69, 0x80, 0xd0, 0x09, 0x30, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4c, 0x91, 0xc9, 0xa2, 0x22, 0x86, 
-0x00, 0xea, 0x38, 0xb8, 0xa9, 0x9f, 0xf0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4c, 0xa5, 
-0xc9, 0xa2, 0x23, 0x86, 0x00, 0xea, 0x18, 0x24, 0x01, 0xa9, 0x00, 0xd0, 0x09, 0x30, 0x07, 0x50, 
-0x05, 0xb0, 0x03, 0x4c, 0xba, 0xc9, 0xa2, 0x23, 0x86, 0x00, 0xea, 0x24, 0x01, 0xa9, 0x40, 0xc9, 
-0x40, 0x30, 0x09, 0x90, 0x07, 0xd0, 0x05, 0x50, 0x03, 0x4c, 0xd0, 0xc9, 0xa2, 0x24, 0x86, 0x00, 
-0xea, 0xb8, 0xc9, 0x3f, 0xf0, 0x09, 0x30, 0x07, 0x90, 0x05, 0x70, 0x03, 0x4c, 0xe3, 0xc9, 0xa2, 
-0x25, 0x86, 0x00, 0xea, 0xc9, 0x41, 0xf0, 0x07, 0x10, 0x05, 0x10, 0x03, 0x4c, 0xf3, 0xc9, 0xa2, 
-0x26, 0x86, 0x00, 0xea, 0xa9, 0x80, 0xc9, 0x00, 0xf0, 0x07, 0x10, 0x05, 0x90, 0x03, 0x4c, 0x05, 
-0xca, 0xa2, 0x27, 0x86, 0x00, 0xea, 0xc9, 0x80, 0xd0, 0x07, 0x30, 0x05, 0x90, 0x03, 0x4c, 0x15, 
-0xca, 0xa2, 0x28, 0x86, 0x00, 0xea, 0xc9, 0x81, 0xb0, 0x07, 0xf0, 0x05, 0x10, 0x03, 0x4c, 0x25, 
-0xca, 0xa2, 0x29, 0x86, 0x00, 0xea, 0xc9, 0x7f, 0x90, 0x07, 0xf0, 0x05, 0x30, 0x03, 0x4c, 0x35, 
-0xca, 0xa2, 0x2a, 0x86, 0x00, 0xea, 0x24, 0x01, 0xa0, 0x40, 0xc0, 0x40, 0xd0, 0x09, 0x30, 0x07, 
-0x90, 0x05, 0x50, 0x03, 0x4c, 0x4b, 0xca, 0xa2, 0x2b, 0x86, 0x00, 0xea, 0xb8, 0xc0, 0x3f, 0xf0, 
-0x09, 0x30, 0x07, 0x90, 0x05, 0x70, 0x03, 0x4c, 0x5e, 0xca, 0xa2, 0x2c, 0x86, 0x00, 0xea, 0xc0, 
-0x41, 0xf0, 0x07, 0x10, 0x05, 0x10, 0x03, 0x4c, 0x6e, 0xca, 0xa2, 0x2d, 0x86, 0x00, 0xea, 0xa0, 
-0x80, 0xc0, 0x00, 0xf0, 0x07, 0x10, 0x05, 0x90, 0x03, 0x4c, 0x80, 0xca, 0xa2, 0x2e, 0x86, 0x00, 
-0xea, 0xc0, 0x80, 0xd0, 0x07, 0x30, 0x05, 0x90, 0x03, 0x4c, 0x90, 0xca, 0xa2, 0x2f, 0x86, 0x00, 
-0xea, 0xc0, 0x81, 0xb0, 0x07, 0xf0, 0x05, 0x10, 0x03, 0x4c, 0xa0, 0xca, 0xa2, 0x30, 0x86, 0x00, 
-0xea, 0xc0, 0x7f, 0x90, 0x07, 0xf0, 0x05, 0x30, 0x03, 0x4c, 0xb0, 0xca, 0xa2, 0x31, 0x86, 0x00, 
-0xea, 0x24, 0x01, 0xa2, 0x40, 0xe0, 0x40, 0xd0, 0x09, 0x30, 0x07, 0x90, 0x05, 0x50, 0x03, 0x4c, 
-0xc6, 0xca, 0xa9, 0x32, 0x85, 0x00, 0xea, 0xb8, 0xe0, 0x3f, 0xf0, 0x09, 0x30, 0x07, 0x90, 0x05, 
-0x70, 0x03, 0x4c, 0xd9, 0xca, 0xa9, 0x33, 0x85, 0x00, 0xea, 0xe0, 0x41, 0xf0, 0x07, 0x10, 0x05, 
-0x10, 0x03, 0x4c, 0xe9, 0xca, 0xa9, 0x34, 0x85, 0x00, 0xea, 0xa2, 0x80, 0xe0, 0x00, 0xf0, 0x07, 
-0x10, 0x05, 0x90, 0x03, 0x4c, 0xfb, 0xca, 0xa9, 0x35, 0x85, 0x00, 0xea, 0xe0, 0x80, 0xd0, 0x07, 
-0x30, 0x05, 0x90, 0x03, 0x4c, 0x0b, 0xcb, 0xa9, 0x36, 0x85, 0x00, 0xea, 0xe0, 0x81, 0xb0, 0x07, 
-0xf0, 0x05, 0x10, 0x03, 0x4c, 0x1b, 0xcb, 0xa9, 0x37, 0x85, 0x00, 0xea, 0xe0, 0x7f, 0x90, 0x07, 
-0xf0, 0x05, 0x30, 0x03, 0x4c, 0x2b, 0xcb, 0xa9, 0x38, 0x85, 0x00, 0xea, 0x38, 0xb8, 0xa2, 0x9f, 
-0xf0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4c, 0x3f, 0xcb, 0xa2, 0x39, 0x86, 0x00, 0xea, 
-0x18, 0x24, 0x01, 0xa2, 0x00, 0xd0, 0x09, 0x30, 0x07, 0x50, 0x05, 0xb0, 0x03, 0x4c, 0x54, 0xcb, 
-0xa2, 0x3a, 0x86, 0x00, 0xea, 0x38, 0xb8, 0xa0, 0x9f, 0xf0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90, 
-0x03, 0x4c, 0x68, 0xcb, 0xa2, 0x3b, 0x86, 0x00, 0xea, 0x18, 0x24, 0x01, 0xa0, 0x00, 0xd0, 0x09, 
-0x30, 0x07, 0x50, 0x05, 0xb0, 0x03, 0x4c, 0x7d, 0xcb, 0xa2, 0x3c, 0x86, 0x00, 0xea, 0xa9, 0x55, 
-0xa2, 0xaa, 0xa0, 0x33, 0xc9, 0x55, 0xd0, 0x23, 0xe0, 0xaa, 0xd0, 0x1f, 0xc0, 0x33, 0xd0, 0x1b, 
-0xc9, 0x55, 0xd0, 0x17, 0xe0, 0xaa, 0xd0, 0x13, 0xc0, 0x33, 0xd0, 0x0f, 0xc9, 0x56, 0xf0, 0x0b, 
-0xe0, 0xab, 0xf0, 0x07, 0xc0, 0x34, 0xf0, 0x03, 0x4c, 0xaf, 0xcb, 0xa2, 0x3d, 0x86, 0x00, 0xa0, 
-0x71, 0x20, 0x31, 0xf9, 0xe9, 0x40, 0x20, 0x37, 0xf9, 0xc8, 0x20, 0x47, 0xf9, 0xe9, 0x3f, 0x20, 
-0x4c, 0xf9, 0xc8, 0x20, 0x5c, 0xf9, 0xe9, 0x41, 0x20, 0x62, 0xf9, 0xc8, 0x20, 0x72, 0xf9, 0xe9, 
-0x00, 0x20, 0x76, 0xf9, 0xc8, 0x20, 0x80, 0xf9, 0xe9, 0x7f, 0x20, 0x84, 0xf9, 0x60, 0xea, 0xa9, 
-0xff, 0x85, 0x01, 0xa9, 0x44, 0xa2, 0x55, 0xa0, 0x66, 0xe8, 0x88, 0xe0, 0x56, 0xd0, 0x21, 0xc0, 
-0x65, 0xd0, 0x1d, 0xe8, 0xe8, 0x88, 0x88, 0xe0, 0x58, 0xd0, 0x15, 0xc0, 0x63, 0xd0, 0x11, 0xca, 
-0xc8, 0xe0, 0x57, 0xd0, 0x0b, 0xc0, 0x64, 0xd0, 0x07, 0xc9, 0x44, 0xd0, 0x03, 0x4c, 0x14, 0xcc, 
-0xa2, 0x3e, 0x86, 0x00, 0xea, 0x38, 0xa2, 0x69, 0xa9, 0x96, 0x24, 0x01, 0xa0, 0xff, 0xc8, 0xd0, 
-0x3d, 0x30, 0x3b, 0x90, 0x39, 0x50, 0x37, 0xc0, 0x00, 0xd0, 0x33, 0xc8, 0xf0, 0x30, 0x30, 0x2e, 
-0x90, 0x2c, 0x50, 0x2a, 0x18, 0xb8, 0xa0, 0x00, 0x88, 0xf0, 0x23, 0x10, 0x21, 0xb0, 0x1f, 0x70, 
-0x1d, 0xc0, 0xff, 0xd0, 0x19, 0x18, 0x88, 0xf0, 0x15, 0x10, 0x13, 0xb0, 0x11, 0x70, 0x0f, 0xc0, 
-0xfe, 0xd0, 0x0b, 0xc9, 0x96, 0xd0, 0x07, 0xe0, 0x69, 0xd0, 0x03, 0x4c, 0x62, 0xcc, 0xa2, 0x3f, 
-0x86, 0x00, 0xea, 0x38, 0xa0, 0x69, 0xa9, 0x96, 0x24, 0x01, 0xa2, 0xff, 0xe8, 0xd0, 0x3d, 0x30, 
-0x3b, 0x90, 0x39, 0x50, 0x37, 0xe0, 0x00, 0xd0, 0x33, 0xe8, 0xf0, 0x30, 0x30, 0x2e, 0x90, 0x2c, 
-0x50, 0x2a, 0x18, 0xb8, 0xa2, 0x00, 0xca, 0xf0, 0x23, 0x10, 0x21, 0xb0, 0x1f, 0x70, 0x1d, 0xe0, 
-0xff, 0xd0, 0x19, 0x18, 0xca, 0xf0, 0x15, 0x10, 0x13, 0xb0, 0x11, 0x70, 0x0f, 0xe0, 0xfe, 0xd0, 
-0x0b, 0xc9, 0x96, 0xd0, 0x07, 0xc0, 0x69, 0xd0, 0x03, 0x4c, 0xb0, 0xcc, 0xa2, 0x40, 0x86, 0x00, 
-0xea, 0xa9, 0x85, 0xa2, 0x34, 0xa0, 0x99, 0x18, 0x24, 0x01, 0xa8, 0xf0, 0x2e, 0xb0, 0x2c, 0x50, 
-0x2a, 0x10, 0x28, 0xc9, 0x85, 0xd0, 0x24, 0xe0, 0x34, 0xd0, 0x20, 0xc0, 0x85, 0xd0, 0x1c, 0xa9, 
-0x00, 0x38, 0xb8, 0xa8, 0xd0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0f, 0xc9, 0x00, 0xd0, 0x0b, 
-0xe0, 0x34, 0xd0, 0x07, 0xc0, 0x00, 0xd0, 0x03, 0x4c, 0xef, 0xcc, 0xa2, 0x41, 0x86, 0x00, 0xea, 
-0xa9, 0x85, 0xa2, 0x34, 0xa0, 0x99, 0x18, 0x24, 0x01, 0xaa, 0xf0, 0x2e, 0xb0, 0x2c, 0x50, 0x2a, 
-0x10, 0x28, 0xc9, 0x85, 0xd0, 0x24, 0xe0, 0x85, 0xd0, 0x20, 0xc0, 0x99, 0xd0, 0x1c, 0xa9, 0x00, 
-0x38, 0xb8, 0xaa, 0xd0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0f, 0xc9, 0x00, 0xd0, 0x0b, 0xe0, 
-0x00, 0xd0, 0x07, 0xc0, 0x99, 0xd0, 0x03, 0x4c, 0x2e, 0xcd, 0xa2, 0x42, 0x86, 0x00, 0xea, 0xa9, 
-0x85, 0xa2, 0x34, 0xa0, 0x99, 0x18, 0x24, 0x01, 0x98, 0xf0, 0x2e, 0xb0, 0x2c, 0x50, 0x2a, 0x10, 
-0x28, 0xc9, 0x99, 0xd0, 0x24, 0xe0, 0x34, 0xd0, 0x20, 0xc0, 0x99, 0xd0, 0x1c, 0xa0, 0x00, 0x38, 
-0xb8, 0x98, 0xd0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0f, 0xc9, 0x00, 0xd0, 0x0b, 0xe0, 0x34, 
-0xd0, 0x07, 0xc0, 0x00, 0xd0, 0x03, 0x4c, 0x6d, 0xcd, 0xa2, 0x43, 0x86, 0x00, 0xea, 0xa9, 0x85, 
-0xa2, 0x34, 0xa0, 0x99, 0x18, 0x24, 0x01, 0x8a, 0xf0, 0x2e, 0xb0, 0x2c, 0x50, 0x2a, 0x30, 0x28, 
-0xc9, 0x34, 0xd0, 0x24, 0xe0, 0x34, 0xd0, 0x20, 0xc0, 0x99, 0xd0, 0x1c, 0xa2, 0x00, 0x38, 0xb8, 
-0x8a, 0xd0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0f, 0xc9, 0x00, 0xd0, 0x0b, 0xe0, 0x00, 0xd0, 
-0x07, 0xc0, 0x99, 0xd0, 0x03, 0x4c, 0xac, 0xcd, 0xa2, 0x44, 0x86, 0x00, 0xea, 0xba, 0x8e, 0xff, 
-0x07, 0xa0, 0x33, 0xa2, 0x69, 0xa9, 0x84, 0x18, 0x24, 0x01, 0x9a, 0xf0, 0x32, 0x10, 0x30, 0xb0, 
-0x2e, 0x50, 0x2c, 0xc9, 0x84, 0xd0, 0x28, 0xe0, 0x69, 0xd0, 0x24, 0xc0, 0x33, 0xd0, 0x20, 0xa0, 
-0x01, 0xa9, 0x04, 0x38, 0xb8, 0xa2, 0x00, 0xba, 0xf0, 0x15, 0x30, 0x13, 0x90, 0x11, 0x70, 0x0f, 
-0xe0, 0x69, 0xd0, 0x0b, 0xc9, 0x04, 0xd0, 0x07, 0xc0, 0x01, 0xd0, 0x03, 0x4c, 0xf3, 0xcd, 0xa2, 
-0x45, 0x86, 0x00, 0xae, 0xff, 0x07, 0x9a, 0x60, 0xa9, 0xff, 0x85, 0x01, 0xba, 0x8e, 0xff, 0x07, 
-0xea, 0xa2, 0x80, 0x9a, 0xa9, 0x33, 0x48, 0xa9, 0x69, 0x48, 0xba, 0xe0, 0x7e, 0xd0, 0x20, 0x68, 
-0xc9, 0x69, 0xd0, 0x1b, 0x68, 0xc9, 0x33, 0xd0, 0x16, 0xba, 0xe0, 0x80, 0xd0, 0x11, 0xad, 0x80, 
-0x01, 0xc9, 0x33, 0xd0, 0x0a, 0xad, 0x7f, 0x01, 0xc9, 0x69, 0xd0, 0x03, 0x4c, 0x33, 0xce, 0xa2, 
-0x46, 0x86, 0x00, 0xea, 0xa2, 0x80, 0x9a, 0x20, 0x3d, 0xce, 0x4c, 0x5b, 0xce, 0xba, 0xe0, 0x7e, 
-0xd0, 0x19, 0x68, 0x68, 0xba, 0xe0, 0x80, 0xd0, 0x12, 0xa9, 0x00, 0x20, 0x4e, 0xce, 0x68, 0xc9, 
-0x4d, 0xd0, 0x08, 0x68, 0xc9, 0xce, 0xd0, 0x03, 0x4c, 0x5f, 0xce, 0xa2, 0x47, 0x86, 0x00, 0xea, 
-0xa9, 0xce, 0x48, 0xa9, 0x66, 0x48, 0x60, 0xa2, 0x77, 0xa0, 0x69, 0x18, 0x24, 0x01, 0xa9, 0x83, 
-0x20, 0x66, 0xce, 0xf0, 0x24, 0x10, 0x22, 0xb0, 0x20, 0x50, 0x1e, 0xc9, 0x83, 0xd0, 0x1a, 0xc0, 
-0x69, 0xd0, 0x16, 0xe0, 0x77, 0xd0, 0x12, 0x38, 0xb8, 0xa9, 0x00, 0x20, 0x66, 0xce, 0xd0, 0x09, 
-0x30, 0x07, 0x90, 0x05, 0x70, 0x03, 0x4c, 0x9d, 0xce, 0xa2, 0x48, 0x86, 0x00, 0xea, 0xa9, 0xce, 
-0x48, 0xa9, 0xae, 0x48, 0xa9, 0x65, 0x48, 0xa9, 0x55, 0xa0, 0x88, 0xa2, 0x99, 0x40, 0x30, 0x35, 
-0x50, 0x33, 0xf0, 0x31, 0x90, 0x2f, 0xc9, 0x55, 0xd0, 0x2b, 0xc0, 0x88, 0xd0, 0x27, 0xe0, 0x99, 
-0xd0, 0x23, 0xa9, 0xce, 0x48, 0xa9, 0xce, 0x48, 0xa9, 0x87, 0x48, 0xa9, 0x55, 0x40, 0x10, 0x15, 
-0x70, 0x13, 0xd0, 0x11, 0x90, 0x0f, 0xc9, 0x55, 0xd0, 0x0b, 0xc0, 0x88, 0xd0, 0x07, 0xe0, 0x99, 
-0xd0, 0x03, 0x4c, 0xe9, 0xce, 0xa2, 0x49, 0x86, 0x00, 0xae, 0xff, 0x07, 0x9a, 0x60, 0xa2, 0x55, 
-0xa0, 0x69, 0xa9, 0xff, 0x85, 0x01, 0xea, 0x24, 0x01, 0x38, 0xa9, 0x01, 0x4a, 0x90, 0x1d, 0xd0, 
-0x1b, 0x30, 0x19, 0x50, 0x17, 0xc9, 0x00, 0xd0, 0x13, 0xb8, 0xa9, 0xaa, 0x4a, 0xb0, 0x0d, 0xf0, 
-0x0b, 0x30, 0x09, 0x70, 0x07, 0xc9, 0x55, 0xd0, 0x03, 0x4c, 0x20, 0xcf, 0xa2, 0x4a, 0x86, 0x00, 
-0xea, 0x24, 0x01, 0x38, 0xa9, 0x80, 0x0a, 0x90, 0x1e, 0xd0, 0x1c, 0x30, 0x1a, 0x50, 0x18, 0xc9, 
-0x00, 0xd0, 0x14, 0xb8, 0x38, 0xa9, 0x55, 0x0a, 0xb0, 0x0d, 0xf0, 0x0b, 0x10, 0x09, 0x70, 0x07, 
-0xc9, 0xaa, 0xd0, 0x03, 0x4c, 0x4b, 0xcf, 0xa2, 0x4b, 0x86, 0x00, 0xea, 0x24, 0x01, 0x38, 0xa9, 
-0x01, 0x6a, 0x90, 0x1e, 0xf0, 0x1c, 0x10, 0x1a, 0x50, 0x18, 0xc9, 0x80, 0xd0, 0x14, 0xb8, 0x18, 
-0xa9, 0x55, 0x6a, 0x90, 0x0d, 0xf0, 0x0b, 0x30, 0x09, 0x70, 0x07, 0xc9, 0x2a, 0xd0, 0x03, 0x4c, 
-0x76, 0xcf, 0xa2, 0x4c, 0x86, 0x00, 0xea, 0x24, 0x01, 0x38, 0xa9, 0x80, 0x2a, 0x90, 0x1e, 0xf0, 
-0x1c, 0x30, 0x1a, 0x50, 0x18, 0xc9, 0x01, 0xd0, 0x14, 0xb8, 0x18, 0xa9, 0x55, 0x2a, 0xb0, 0x0d, 
-0xf0, 0x0b, 0x10, 0x09, 0x70, 0x07, 0xc9, 0xaa, 0xd0, 0x03, 0x4c, 0xa1, 0xcf, 0xa2, 0x4d, 0x86, 
-0x00, 0x60, 0xa5, 0x00, 0x8d, 0xff, 0x07, 0xa9, 0x00, 0x85, 0x80, 0xa9, 0x02, 0x85, 0x81, 0xa9, 
-0xff, 0x85, 0x01, 0xa9, 0x00, 0x85, 0x82, 0xa9, 0x03, 0x85, 0x83, 0x85, 0x84, 0xa9, 0x00, 0x85, 
-0xff, 0xa9, 0x04, 0x85, 0x00, 0xa9, 0x5a, 0x8d, 0x00, 0x02, 0xa9, 0x5b, 0x8d, 0x00, 0x03, 0xa9, 
-0x5c, 0x8d, 0x03, 0x03, 0xa9, 0x5d, 0x8d, 0x00, 0x04, 0xa2, 0x00, 0xa1, 0x80, 0xc9, 0x5a, 0xd0, 
-0x1f, 0xe8, 0xe8, 0xa1, 0x80, 0xc9, 0x5b, 0xd0, 0x17, 0xe8, 0xa1, 0x80, 0xc9, 0x5c, 0xd0, 0x10, 
-0xa2, 0x00, 0xa1, 0xff, 0xc9, 0x5d, 0xd0, 0x08, 0xa2, 0x81, 0xa1, 0xff, 0xc9, 0x5a, 0xf0, 0x05, 
-0xa9, 0x58, 0x8d, 0xff, 0x07, 0xa9, 0xaa, 0xa2, 0x00, 0x81, 0x80, 0xe8, 0xe8, 0xa9, 0xab, 0x81, 
-0x80, 0xe8, 0xa9, 0xac, 0x81, 0x80, 0xa2, 0x00, 0xa9, 0xad, 0x81, 0xff, 0xad, 0x00, 0x02, 0xc9, 
-0xaa, 0xd0, 0x15, 0xad, 0x00, 0x03, 0xc9, 0xab, 0xd0, 0x0e, 0xad, 0x03, 0x03, 0xc9, 0xac, 0xd0, 
-0x07, 0xad, 0x00, 0x04, 0xc9, 0xad, 0xf0, 0x05, 0xa9, 0x59, 0x8d, 0xff, 0x07, 0xad, 0xff, 0x07, 
-0x85, 0x00, 0xa9, 0x00, 0x8d, 0x00, 0x03, 0xa9, 0xaa, 0x8d, 0x00, 0x02, 0xa2, 0x00, 0xa0, 0x5a, 
-0x20, 0xb6, 0xf7, 0x01, 0x80, 0x20, 0xc0, 0xf7, 0xc8, 0x20, 0xce, 0xf7, 0x01, 0x82, 0x20, 0xd3, 
-0xf7, 0xc8, 0x20, 0xdf, 0xf7, 0x21, 0x80, 0x20, 0xe5, 0xf7, 0xc8, 0xa9, 0xef, 0x8d, 0x00, 0x03, 
-0x20, 0xf1, 0xf7, 0x21, 0x82, 0x20, 0xf6, 0xf7, 0xc8, 0x20, 0x04, 0xf8, 0x41, 0x80, 0x20, 0x0a, 
-0xf8, 0xc8, 0xa9, 0x70, 0x8d, 0x00, 0x03, 0x20, 0x18, 0xf8, 0x41, 0x82, 0x20, 0x1d, 0xf8, 0xc8, 
-0xa9, 0x69, 0x8d, 0x00, 0x02, 0x20, 0x29, 0xf8, 0x61, 0x80, 0x20, 0x2f, 0xf8, 0xc8, 0x20, 0x3d, 
-0xf8, 0x61, 0x80, 0x20, 0x43, 0xf8, 0xc8, 0xa9, 0x7f, 0x8d, 0x00, 0x02, 0x20, 0x51, 0xf8, 0x61, 
-0x80, 0x20, 0x56, 0xf8, 0xc8, 0xa9, 0x80, 0x8d, 0x00, 0x02, 0x20, 0x64, 0xf8, 0x61, 0x80, 0x20, 
-0x6a, 0xf8, 0xc8, 0x20, 0x78, 0xf8, 0x61, 0x80, 0x20, 0x7d, 0xf8, 0xc8, 0xa9, 0x40, 0x8d, 0x00, 
-0x02, 0x20, 0x89, 0xf8, 0xc1, 0x80, 0x20, 0x8e, 0xf8, 0xc8, 0x48, 0xa9, 0x3f, 0x8d, 0x00, 0x02, 
-0x68, 0x20, 0x9a, 0xf8, 0xc1, 0x80, 0x20, 0x9c, 0xf8, 0xc8, 0x48, 0xa9, 0x41, 0x8d, 0x00, 0x02, 
-0x68, 0xc1, 0x80, 0x20, 0xa8, 0xf8, 0xc8, 0x48, 0xa9, 0x00, 0x8d, 0x00, 0x02, 0x68, 0x20, 0xb2, 
-0xf8, 0xc1, 0x80, 0x20, 0xb5, 0xf8, 0xc8, 0x48, 0xa9, 0x80, 0x8d, 0x00, 0x02, 0x68, 0xc1, 0x80, 
-0x20, 0xbf, 0xf8, 0xc8, 0x48, 0xa9, 0x81, 0x8d, 0x00, 0x02, 0x68, 0xc1, 0x80, 0x20, 0xc9, 0xf8, 
-0xc8, 0x48, 0xa9, 0x7f, 0x8d, 0x00, 0x02, 0x68, 0xc1, 0x80, 0x20, 0xd3, 0xf8, 0xc8, 0xa9, 0x40, 
-0x8d, 0x00, 0x02, 0x20, 0x31, 0xf9, 0xe1, 0x80, 0x20, 0x37, 0xf9, 0xc8, 0xa9, 0x3f, 0x8d, 0x00, 
-0x02, 0x20, 0x47, 0xf9, 0xe1, 0x80, 0x20, 0x4c, 0xf9, 0xc8, 0xa9, 0x41, 0x8d, 0x00, 0x02, 0x20, 
-0x5c, 0xf9, 0xe1, 0x80, 0x20, 0x62, 0xf9, 0xc8, 0xa9, 0x00, 0x8d, 0x00, 0x02, 0x20, 0x72, 0xf9, 
-0xe1, 0x80, 0x20, 0x76, 0xf9, 0xc8, 0xa9, 0x7f, 0x8d, 0x00, 0x02, 0x20, 0x80, 0xf9, 0xe1, 0x80, 
-0x20, 0x84, 0xf9, 0x60, 0xa9, 0x55, 0x85, 0x78, 0xa9, 0xff, 0x85, 0x01, 0x24, 0x01, 0xa0, 0x11, 
-0xa2, 0x23, 0xa9, 0x00, 0xa5, 0x78, 0xf0, 0x10, 0x30, 0x0e, 0xc9, 0x55, 0xd0, 0x0a, 0xc0, 0x11, 
-0xd0, 0x06, 0xe0, 0x23, 0x50, 0x02, 0xf0, 0x04, 0xa9, 0x76, 0x85, 0x00, 0xa9, 0x46, 0x24, 0x01, 
-0x85, 0x78, 0xf0, 0x0a, 0x10, 0x08, 0x50, 0x06, 0xa5, 0x78, 0xc9, 0x46, 0xf0, 0x04, 0xa9, 0x77, 
-0x85, 0x00, 0xa9, 0x55, 0x85, 0x78, 0x24, 0x01, 0xa9, 0x11, 0xa2, 0x23, 0xa0, 0x00, 0xa4, 0x78, 
-0xf0, 0x10, 0x30, 0x0e, 0xc0, 0x55, 0xd0, 0x0a, 0xc9, 0x11, 0xd0, 0x06, 0xe0, 0x23, 0x50, 0x02, 
-0xf0, 0x04, 0xa9, 0x78, 0x85, 0x00, 0xa0, 0x46, 0x24, 0x01, 0x84, 0x78, 0xf0, 0x0a, 0x10, 0x08, 
-0x50, 0x06, 0xa4, 0x78, 0xc0, 0x46, 0xf0, 0x04, 0xa9, 0x79, 0x85, 0x00, 0x24, 0x01, 0xa9, 0x55, 
-0x85, 0x78, 0xa0, 0x11, 0xa9, 0x23, 0xa2, 0x00, 0xa6, 0x78, 0xf0, 0x10, 0x30, 0x0e, 0xe0, 0x55, 
-0xd0, 0x0a, 0xc0, 0x11, 0xd0, 0x06, 0xc9, 0x23, 0x50, 0x02, 0xf0, 0x04, 0xa9, 0x7a, 0x85, 0x00, 
-0xa2, 0x46, 0x24, 0x01, 0x86, 0x78, 0xf0, 0x0a, 0x10, 0x08, 0x50, 0x06, 0xa6, 0x78, 0xe0, 0x46, 
-0xf0, 0x04, 0xa9, 0x7b, 0x85, 0x00, 0xa9, 0xc0, 0x85, 0x78, 0xa2, 0x33, 0xa0, 0x88, 0xa9, 0x05, 
-0x24, 0x78, 0x10, 0x10, 0x50, 0x0e, 0xd0, 0x0c, 0xc9, 0x05, 0xd0, 0x08, 0xe0, 0x33, 0xd0, 0x04, 
-0xc0, 0x88, 0xf0, 0x04, 0xa9, 0x7c, 0x85, 0x00, 0xa9, 0x03, 0x85, 0x78, 0xa9, 0x01, 0x24, 0x78, 
-0x30, 0x08, 0x70, 0x06, 0xf0, 0x04, 0xc9, 0x01, 0xf0, 0x04, 0xa9, 0x7d, 0x85, 0x00, 0xa0, 0x7e, 
-0xa9, 0xaa, 0x85, 0x78, 0x20, 0xb6, 0xf7, 0x05, 0x78, 0x20, 0xc0, 0xf7, 0xc8, 0xa9, 0x00, 0x85, 
-0x78, 0x20, 0xce, 0xf7, 0x05, 0x78, 0x20, 0xd3, 0xf7, 0xc8, 0xa9, 0xaa, 0x85, 0x78, 0x20, 0xdf, 
-0xf7, 0x25, 0x78, 0x20, 0xe5, 0xf7, 0xc8, 0xa9, 0xef, 0x85, 0x78, 0x20, 0xf1, 0xf7, 0x25, 0x78, 
-0x20, 0xf6, 0xf7, 0xc8, 0xa9, 0xaa, 0x85, 0x78, 0x20, 0x04, 0xf8, 0x45, 0x78, 0x20, 0x0a, 0xf8, 
-0xc8, 0xa9, 0x70, 0x85, 0x78, 0x20, 0x18, 0xf8, 0x45, 0x78, 0x20, 0x1d, 0xf8, 0xc8, 0xa9, 0x69, 
-0x85, 0x78, 0x20, 0x29, 0xf8, 0x65, 0x78, 0x20, 0x2f, 0xf8, 0xc8, 0x20, 0x3d, 0xf8, 0x65, 0x78, 
-0x20, 0x43, 0xf8, 0xc8, 0xa9, 0x7f, 0x85, 0x78, 0x20, 0x51, 0xf8, 0x65, 0x78, 0x20, 0x56, 0xf8, 
-0xc8, 0xa9, 0x80, 0x85, 0x78, 0x20, 0x64, 0xf8, 0x65, 0x78, 0x20, 0x6a, 0xf8, 0xc8, 0x20, 0x78, 
-0xf8, 0x65, 0x78, 0x20, 0x7d, 0xf8, 0xc8, 0xa9, 0x40, 0x85, 0x78, 0x20, 0x89, 0xf8, 0xc5, 0x78, 
-0x20, 0x8e, 0xf8, 0xc8, 0x48, 0xa9, 0x3f, 0x85, 0x78, 0x68, 0x20, 0x9a, 0xf8, 0xc5, 0x78, 0x20, 
-0x9c, 0xf8, 0xc8, 0x48, 0xa9, 0x41, 0x85, 0x78, 0x68, 0xc5, 0x78, 0x20, 0xa8, 0xf8, 0xc8, 0x48, 
-0xa9, 0x00, 0x85, 0x78, 0x68, 0x20, 0xb2, 0xf8, 0xc5, 0x78, 0x20, 0xb5, 0xf8, 0xc8, 0x48, 0xa9, 
-0x80, 0x85, 0x78, 0x68, 0xc5, 0x78, 0x20, 0xbf, 0xf8, 0xc8, 0x48, 0xa9, 0x81, 0x85, 0x78, 0x68, 
-0xc5, 0x78, 0x20, 0xc9, 0xf8, 0xc8, 0x48, 0xa9, 0x7f, 0x85, 0x78, 0x68, 0xc5, 0x78, 0x20, 0xd3, 
-0xf8, 0xc8, 0xa9, 0x40, 0x85, 0x78, 0x20, 0x31, 0xf9, 0xe5, 0x78, 0x20, 0x37, 0xf9, 0xc8, 0xa9, 
-0x3f, 0x85, 0x78, 0x20, 0x47, 0xf9, 0xe5, 0x78, 0x20, 0x4c, 0xf9, 0xc8, 0xa9, 0x41, 0x85, 0x78, 
-0x20, 0x5c, 0xf9, 0xe5, 0x78, 0x20, 0x62, 0xf9, 0xc8, 0xa9, 0x00, 0x85, 0x78, 0x20, 0x72, 0xf9, 
-0xe5, 0x78, 0x20, 0x76, 0xf9, 0xc8, 0xa9, 0x7f, 0x85, 0x78, 0x20, 0x80, 0xf9, 0xe5, 0x78, 0x20, 
-0x84, 0xf9, 0xc8, 0xa9, 0x40, 0x85, 0x78, 0x20, 0x89, 0xf8, 0xaa, 0xe4, 0x78, 0x20, 0x8e, 0xf8, 
-0xc8, 0xa9, 0x3f, 0x85, 0x78, 0x20, 0x9a, 0xf8, 0xe4, 0x78, 0x20, 0x9c, 0xf8, 0xc8, 0xa9, 0x41, 
-0x85, 0x78, 0xe4, 0x78, 0x20, 0xa8, 0xf8, 0xc8, 0xa9, 0x00, 0x85, 0x78, 0x20, 0xb2, 0xf8, 0xaa, 
-0xe4, 0x78, 0x20, 0xb5, 0xf8, 0xc8, 0xa9, 0x80, 0x85, 0x78, 0xe4, 0x78, 0x20, 0xbf, 0xf8, 0xc8, 
-0xa9, 0x81, 0x85, 0x78, 0xe4, 0x78, 0x20, 0xc9, 0xf8, 0xc8, 0xa9, 0x7f, 0x85, 0x78, 0xe4, 0x78, 
-0x20, 0xd3, 0xf8, 0xc8, 0x98, 0xaa, 0xa9, 0x40, 0x85, 0x78, 0x20, 0xdd, 0xf8, 0xc4, 0x78, 0x20, 
-0xe2, 0xf8, 0xe8, 0xa9, 0x3f, 0x85, 0x78, 0x20, 0xee, 0xf8, 0xc4, 0x78, 0x20, 0xf0, 0xf8, 0xe8, 
-0xa9, 0x41, 0x85, 0x78, 0xc4, 0x78, 0x20, 0xfc, 0xf8, 0xe8, 0xa9, 0x00, 0x85, 0x78, 0x20, 0x06, 
-0xf9, 0xc4, 0x78, 0x20, 0x09, 0xf9, 0xe8, 0xa9, 0x80, 0x85, 0x78, 0xc4, 0x78, 0x20, 0x13, 0xf9, 
-0xe8, 0xa9, 0x81, 0x85, 0x78, 0xc4, 0x78, 0x20, 0x1d, 0xf9, 0xe8, 0xa9, 0x7f, 0x85, 0x78, 0xc4, 
-0x78, 0x20, 0x27, 0xf9, 0xe8, 0x8a, 0xa8, 0x20, 0x90, 0xf9, 0x85, 0x78, 0x46, 0x78, 0xa5, 0x78, 
-0x20, 0x9d, 0xf9, 0xc8, 0x85, 0x78, 0x46, 0x78, 0xa5, 0x78, 0x20, 0xad, 0xf9, 0xc8, 0x20, 0xbd, 
-0xf9, 0x85, 0x78, 0x06, 0x78, 0xa5, 0x78, 0x20, 0xc3, 0xf9, 0xc8, 0x85, 0x78, 0x06, 0x78, 0xa5, 
-0x78, 0x20, 0xd4, 0xf9, 0xc8, 0x20, 0xe4, 0xf9, 0x85, 0x78, 0x66, 0x78, 0xa5, 0x78, 0x20, 0xea, 
-0xf9, 0xc8, 0x85, 0x78, 0x66, 0x78, 0xa5, 0x78, 0x20, 0xfb, 0xf9, 0xc8, 0x20, 0x0a, 0xfa, 0x85, 
-0x78, 0x26, 0x78, 0xa5, 0x78, 0x20, 0x10, 0xfa, 0xc8, 0x85, 0x78, 0x26, 0x78, 0xa5, 0x78, 0x20, 
-0x21, 0xfa, 0xa9, 0xff, 0x85, 0x78, 0x85, 0x01, 0x24, 0x01, 0x38, 0xe6, 0x78, 0xd0, 0x0c, 0x30, 
-0x0a, 0x50, 0x08, 0x90, 0x06, 0xa5, 0x78, 0xc9, 0x00, 0xf0, 0x04, 0xa9, 0xab, 0x85, 0x00, 0xa9, 
-0x7f, 0x85, 0x78, 0xb8, 0x18, 0xe6, 0x78, 0xf0, 0x0c, 0x10, 0x0a, 0x70, 0x08, 0xb0, 0x06, 0xa5, 
-0x78, 0xc9, 0x80, 0xf0, 0x04, 0xa9, 0xac, 0x85, 0x00, 0xa9, 0x00, 0x85, 0x78, 0x24, 0x01, 0x38, 
-0xc6, 0x78, 0xf0, 0x0c, 0x10, 0x0a, 0x50, 0x08, 0x90, 0x06, 0xa5, 0x78, 0xc9, 0xff, 0xf0, 0x04, 
-0xa9, 0xad, 0x85, 0x00, 0xa9, 0x80, 0x85, 0x78, 0xb8, 0x18, 0xc6, 0x78, 0xf0, 0x0c, 0x30, 0x0a, 
-0x70, 0x08, 0xb0, 0x06, 0xa5, 0x78, 0xc9, 0x7f, 0xf0, 0x04, 0xa9, 0xae, 0x85, 0x00, 0xa9, 0x01, 
-0x85, 0x78, 0xc6, 0x78, 0xf0, 0x04, 0xa9, 0xaf, 0x85, 0x00, 0x60, 0xa9, 0x55, 0x8d, 0x78, 0x06, 
-0xa9, 0xff, 0x85, 0x01, 0x24, 0x01, 0xa0, 0x11, 0xa2, 0x23, 0xa9, 0x00, 0xad, 0x78, 0x06, 0xf0, 
-0x10, 0x30, 0x0e, 0xc9, 0x55, 0xd0, 0x0a, 0xc0, 0x11, 0xd0, 0x06, 0xe0, 0x23, 0x50, 0x02, 0xf0, 
-0x04, 0xa9, 0xb0, 0x85, 0x00, 0xa9, 0x46, 0x24, 0x01, 0x8d, 0x78, 0x06, 0xf0, 0x0b, 0x10, 0x09, 
-0x50, 0x07, 0xad, 0x78, 0x06, 0xc9, 0x46, 0xf0, 0x04, 0xa9, 0xb1, 0x85, 0x00, 0xa9, 0x55, 0x8d, 
-0x78, 0x06, 0x24, 0x01, 0xa9, 0x11, 0xa2, 0x23, 0xa0, 0x00, 0xac, 0x78, 0x06, 0xf0, 0x10, 0x30, 
-0x0e, 0xc0, 0x55, 0xd0, 0x0a, 0xc9, 0x11, 0xd0, 0x06, 0xe0, 0x23, 0x50, 0x02, 0xf0, 0x04, 0xa9, 
-0xb2, 0x85, 0x00, 0xa0, 0x46, 0x24, 0x01, 0x8c, 0x78, 0x06, 0xf0, 0x0b, 0x10, 0x09, 0x50, 0x07, 
-0xac, 0x78, 0x06, 0xc0, 0x46, 0xf0, 0x04, 0xa9, 0xb3, 0x85, 0x00, 0x24, 0x01, 0xa9, 0x55, 0x8d, 
-0x78, 0x06, 0xa0, 0x11, 0xa9, 0x23, 0xa2, 0x00, 0xae, 0x78, 0x06, 0xf0, 0x10, 0x30, 0x0e, 0xe0, 
-0x55, 0xd0, 0x0a, 0xc0, 0x11, 0xd0, 0x06, 0xc9, 0x23, 0x50, 0x02, 0xf0, 0x04, 0xa9, 0xb4, 0x85, 
-0x00, 0xa2, 0x46, 0x24, 0x01, 0x8e, 0x78, 0x06, 0xf0, 0x0b, 0x10, 0x09, 0x50, 0x07, 0xae, 0x78, 
-0x06, 0xe0, 0x46, 0xf0, 0x04, 0xa9, 0xb5, 0x85, 0x00, 0xa9, 0xc0, 0x8d, 0x78, 0x06, 0xa2, 0x33, 
-0xa0, 0x88, 0xa9, 0x05, 0x2c, 0x78, 0x06, 0x10, 0x10, 0x50, 0x0e, 0xd0, 0x0c, 0xc9, 0x05, 0xd0, 
-0x08, 0xe0, 0x33, 0xd0, 0x04, 0xc0, 0x88, 0xf0, 0x04, 0xa9, 0xb6, 0x85, 0x00, 0xa9, 0x03, 0x8d, 
-0x78, 0x06, 0xa9, 0x01, 0x2c, 0x78, 0x06, 0x30, 0x08, 0x70, 0x06, 0xf0, 0x04, 0xc9, 0x01, 0xf0, 
-0x04, 0xa9, 0xb7, 0x85, 0x00, 0xa0, 0xb8, 0xa9, 0xaa, 0x8d, 0x78, 0x06, 0x20, 0xb6, 0xf7, 0x0d, 
-0x78, 0x06, 0x20, 0xc0, 0xf7, 0xc8, 0xa9, 0x00, 0x8d, 0x78, 0x06, 0x20, 0xce, 0xf7, 0x0d, 0x78, 
-0x06, 0x20, 0xd3, 0xf7, 0xc8, 0xa9, 0xaa, 0x8d, 0x78, 0x06, 0x20, 0xdf, 0xf7, 0x2d, 0x78, 0x06, 
-0x20, 0xe5, 0xf7, 0xc8, 0xa9, 0xef, 0x8d, 0x78, 0x06, 0x20, 0xf1, 0xf7, 0x2d, 0x78, 0x06, 0x20, 
-0xf6, 0xf7, 0xc8, 0xa9, 0xaa, 0x8d, 0x78, 0x06, 0x20, 0x04, 0xf8, 0x4d, 0x78, 0x06, 0x20, 0x0a, 
-0xf8, 0xc8, 0xa9, 0x70, 0x8d, 0x78, 0x06, 0x20, 0x18, 0xf8, 0x4d, 0x78, 0x06, 0x20, 0x1d, 0xf8, 
-0xc8, 0xa9, 0x69, 0x8d, 0x78, 0x06, 0x20, 0x29, 0xf8, 0x6d, 0x78, 0x06, 0x20, 0x2f, 0xf8, 0xc8, 
-0x20, 0x3d, 0xf8, 0x6d, 0x78, 0x06, 0x20, 0x43, 0xf8, 0xc8, 0xa9, 0x7f, 0x8d, 0x78, 0x06, 0x20, 
-0x51, 0xf8, 0x6d, 0x78, 0x06, 0x20, 0x56, 0xf8, 0xc8, 0xa9, 0x80, 0x8d, 0x78, 0x06, 0x20, 0x64, 
-0xf8, 0x6d, 0x78, 0x06, 0x20, 0x6a, 0xf8, 0xc8, 0x20, 0x78, 0xf8, 0x6d, 0x78, 0x06, 0x20, 0x7d, 
-0xf8, 0xc8, 0xa9, 0x40, 0x8d, 0x78, 0x06, 0x20, 0x89, 0xf8, 0xcd, 0x78, 0x06, 0x20, 0x8e, 0xf8, 
-0xc8, 0x48, 0xa9, 0x3f, 0x8d, 0x78, 0x06, 0x68, 0x20, 0x9a, 0xf8, 0xcd, 0x78, 0x06, 0x20, 0x9c, 
-0xf8, 0xc8, 0x48, 0xa9, 0x41, 0x8d, 0x78, 0x06, 0x68, 0xcd, 0x78, 0x06, 0x20, 0xa8, 0xf8, 0xc8, 
-0x48, 0xa9, 0x00, 0x8d, 0x78, 0x06, 0x68, 0x20, 0xb2, 0xf8, 0xcd, 0x78, 0x06, 0x20, 0xb5, 0xf8, 
-0xc8, 0x48, 0xa9, 0x80, 0x8d, 0x78, 0x06, 0x68, 0xcd, 0x78, 0x06, 0x20, 0xbf, 0xf8, 0xc8, 0x48, 
-0xa9, 0x81, 0x8d, 0x78, 0x06, 0x68, 0xcd, 0x78, 0x06, 0x20, 0xc9, 0xf8, 0xc8, 0x48, 0xa9, 0x7f, 
-0x8d, 0x78, 0x06, 0x68, 0xcd, 0x78, 0x06, 0x20, 0xd3, 0xf8, 0xc8, 0xa9, 0x40, 0x8d, 0x78, 0x06, 
-0x20, 0x31, 0xf9, 0xed, 0x78, 0x06, 0x20, 0x37, 0xf9, 0xc8, 0xa9, 0x3f, 0x8d, 0x78, 0x06, 0x20, 
-0x47, 0xf9, 0xed, 0x78, 0x06, 0x20, 0x4c, 0xf9, 0xc8, 0xa9, 0x41, 0x8d, 0x78, 0x06, 0x20, 0x5c, 
-0xf9, 0xed, 0x78, 0x06, 0x20, 0x62, 0xf9, 0xc8, 0xa9, 0x00, 0x8d, 0x78, 0x06, 0x20, 0x72, 0xf9, 
-0xed, 0x78, 0x06, 0x20, 0x76, 0xf9, 0xc8, 0xa9, 0x7f, 0x8d, 0x78, 0x06, 0x20, 0x80, 0xf9, 0xed, 
-0x78, 0x06, 0x20, 0x84, 0xf9, 0xc8, 0xa9, 0x40, 0x8d, 0x78, 0x06, 0x20, 0x89, 0xf8, 0xaa, 0xec, 
-0x78, 0x06, 0x20, 0x8e, 0xf8, 0xc8, 0xa9, 0x3f, 0x8d, 0x78, 0x06, 0x20, 0x9a, 0xf8, 0xec, 0x78, 
-0x06, 0x20, 0x9c, 0xf8, 0xc8, 0xa9, 0x41, 0x8d, 0x78, 0x06, 0xec, 0x78, 0x06, 0x20, 0xa8, 0xf8, 
-0xc8, 0xa9, 0x00, 0x8d, 0x78, 0x06, 0x20, 0xb2, 0xf8, 0xaa, 0xec, 0x78, 0x06, 0x20, 0xb5, 0xf8, 
-0xc8, 0xa9, 0x80, 0x8d, 0x78, 0x06, 0xec, 0x78, 0x06, 0x20, 0xbf, 0xf8, 0xc8, 0xa9, 0x81, 0x8d, 
-0x78, 0x06, 0xec, 0x78, 0x06, 0x20, 0xc9, 0xf8, 0xc8, 0xa9, 0x7f, 0x8d, 0x78, 0x06, 0xec, 0x78, 
-0x06, 0x20, 0xd3, 0xf8, 0xc8, 0x98, 0xaa, 0xa9, 0x40, 0x8d, 0x78, 0x06, 0x20, 0xdd, 0xf8, 0xcc, 
-0x78, 0x06, 0x20, 0xe2, 0xf8, 0xe8, 0xa9, 0x3f, 0x8d, 0x78, 0x06, 0x20, 0xee, 0xf8, 0xcc, 0x78, 
-0x06, 0x20, 0xf0, 0xf8, 0xe8, 0xa9, 0x41, 0x8d, 0x78, 0x06, 0xcc, 0x78, 0x06, 0x20, 0xfc, 0xf8, 
-0xe8, 0xa9, 0x00, 0x8d, 0x78, 0x06, 0x20, 0x06, 0xf9, 0xcc, 0x78, 0x06, 0x20, 0x09, 0xf9, 0xe8, 
-0xa9, 0x80, 0x8d, 0x78, 0x06, 0xcc, 0x78, 0x06, 0x20, 0x13, 0xf9, 0xe8, 0xa9, 0x81, 0x8d, 0x78, 
-0x06, 0xcc, 0x78, 0x06, 0x20, 0x1d, 0xf9, 0xe8, 0xa9, 0x7f, 0x8d, 0x78, 0x06, 0xcc, 0x78, 0x06, 
-0x20, 0x27, 0xf9, 0xe8, 0x8a, 0xa8, 0x20, 0x90, 0xf9, 0x8d, 0x78, 0x06, 0x4e, 0x78, 0x06, 0xad, 
-0x78, 0x06, 0x20, 0x9d, 0xf9, 0xc8, 0x8d, 0x78, 0x06, 0x4e, 0x78, 0x06, 0xad, 0x78, 0x06, 0x20, 
-0xad, 0xf9, 0xc8, 0x20, 0xbd, 0xf9, 0x8d, 0x78, 0x06, 0x0e, 0x78, 0x06, 0xad, 0x78, 0x06, 0x20, 
-0xc3, 0xf9, 0xc8, 0x8d, 0x78, 0x06, 0x0e, 0x78, 0x06, 0xad, 0x78, 0x06, 0x20, 0xd4, 0xf9, 0xc8, 
-0x20, 0xe4, 0xf9, 0x8d, 0x78, 0x06, 0x6e, 0x78, 0x06, 0xad, 0x78, 0x06, 0x20, 0xea, 0xf9, 0xc8, 
-0x8d, 0x78, 0x06, 0x6e, 0x78, 0x06, 0xad, 0x78, 0x06, 0x20, 0xfb, 0xf9, 0xc8, 0x20, 0x0a, 0xfa, 
-0x8d, 0x78, 0x06, 0x2e, 0x78, 0x06, 0xad, 0x78, 0x06, 0x20, 0x10, 0xfa, 0xc8, 0x8d, 0x78, 0x06, 
-0x2e, 0x78, 0x06, 0xad, 0x78, 0x06, 0x20, 0x21, 0xfa, 0xa9, 0xff, 0x8d, 0x78, 0x06, 0x85, 0x01, 
-0x24, 0x01, 0x38, 0xee, 0x78, 0x06, 0xd0, 0x0d, 0x30, 0x0b, 0x50, 0x09, 0x90, 0x07, 0xad, 0x78, 
-0x06, 0xc9, 0x00, 0xf0, 0x04, 0xa9, 0xe5, 0x85, 0x00, 0xa9, 0x7f, 0x8d, 0x78, 0x06, 0xb8, 0x18, 
-0xee, 0x78, 0x06, 0xf0, 0x0d, 0x10, 0x0b, 0x70, 0x09, 0xb0, 0x07, 0xad, 0x78, 0x06, 0xc9, 0x80, 
-0xf0, 0x04, 0xa9, 0xe6, 0x85, 0x00, 0xa9, 0x00, 0x8d, 0x78, 0x06, 0x24, 0x01, 0x38, 0xce, 0x78, 
-0x06, 0xf0, 0x0d, 0x10, 0x0b, 0x50, 0x09, 0x90, 0x07, 0xad, 0x78, 0x06, 0xc9, 0xff, 0xf0, 0x04, 
-0xa9, 0xe7, 0x85, 0x00, 0xa9, 0x80, 0x8d, 0x78, 0x06, 0xb8, 0x18, 0xce, 0x78, 0x06, 0xf0, 0x0d, 
-0x30, 0x0b, 0x70, 0x09, 0xb0, 0x07, 0xad, 0x78, 0x06, 0xc9, 0x7f, 0xf0, 0x04, 0xa9, 0xe8, 0x85, 
-0x00, 0xa9, 0x01, 0x8d, 0x78, 0x06, 0xce, 0x78, 0x06, 0xf0, 0x04, 0xa9, 0xe9, 0x85, 0x00, 0x60, 
-0xa9, 0xa3, 0x85, 0x33, 0xa9, 0x89, 0x8d, 0x00, 0x03, 0xa9, 0x12, 0x8d, 0x45, 0x02, 0xa9, 0xff, 
-0x85, 0x01, 0xa2, 0x65, 0xa9, 0x00, 0x85, 0x89, 0xa9, 0x03, 0x85, 0x8a, 0xa0, 0x00, 0x38, 0xa9, 
-0x00, 0xb8, 0xb1, 0x89, 0xf0, 0x0c, 0x90, 0x0a, 0x70, 0x08, 0xc9, 0x89, 0xd0, 0x04, 0xe0, 0x65, 
-0xf0, 0x04, 0xa9, 0xea, 0x85, 0x00, 0xa9, 0xff, 0x85, 0x97, 0x85, 0x98, 0x24, 0x98, 0xa0, 0x34, 
-0xb1, 0x97, 0xc9, 0xa3, 0xd0, 0x02, 0xb0, 0x04, 0xa9, 0xeb, 0x85, 0x00, 0xa5, 0x00, 0x48, 0xa9, 
-0x46, 0x85, 0xff, 0xa9, 0x01, 0x85, 0x00, 0xa0, 0xff, 0xb1, 0xff, 0xc9, 0x12, 0xf0, 0x04, 0x68, 
-0xa9, 0xec, 0x48, 0x68, 0x85, 0x00, 0xa2, 0xed, 0xa9, 0x00, 0x85, 0x33, 0xa9, 0x04, 0x85, 0x34, 
-0xa0, 0x00, 0x18, 0xa9, 0xff, 0x85, 0x01, 0x24, 0x01, 0xa9, 0xaa, 0x8d, 0x00, 0x04, 0xa9, 0x55, 
-0x11, 0x33, 0xb0, 0x08, 0x10, 0x06, 0xc9, 0xff, 0xd0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xe8, 0x38, 
-0xb8, 0xa9, 0x00, 0x11, 0x33, 0xf0, 0x06, 0x70, 0x04, 0x90, 0x02, 0x30, 0x02, 0x86, 0x00, 0xe8, 
-0x18, 0x24, 0x01, 0xa9, 0x55, 0x31, 0x33, 0xd0, 0x06, 0x50, 0x04, 0xb0, 0x02, 0x10, 0x02, 0x86, 
-0x00, 0xe8, 0x38, 0xb8, 0xa9, 0xef, 0x8d, 0x00, 0x04, 0xa9, 0xf8, 0x31, 0x33, 0x90, 0x08, 0x10, 
-0x06, 0xc9, 0xe8, 0xd0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xe8, 0x18, 0x24, 0x01, 0xa9, 0xaa, 0x8d, 
-0x00, 0x04, 0xa9, 0x5f, 0x51, 0x33, 0xb0, 0x08, 0x10, 0x06, 0xc9, 0xf5, 0xd0, 0x02, 0x70, 0x02, 
-0x86, 0x00, 0xe8, 0x38, 0xb8, 0xa9, 0x70, 0x8d, 0x00, 0x04, 0x51, 0x33, 0xd0, 0x06, 0x70, 0x04, 
-0x90, 0x02, 0x10, 0x02, 0x86, 0x00, 0xe8, 0x18, 0x24, 0x01, 0xa9, 0x69, 0x8d, 0x00, 0x04, 0xa9, 
-0x00, 0x71, 0x33, 0x30, 0x08, 0xb0, 0x06, 0xc9, 0x69, 0xd0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xe8, 
-0x38, 0x24, 0x01, 0xa9, 0x00, 0x71, 0x33, 0x30, 0x08, 0xb0, 0x06, 0xc9, 0x6a, 0xd0, 0x02, 0x50, 
-0x02, 0x86, 0x00, 0xe8, 0x38, 0xb8, 0xa9, 0x7f, 0x8d, 0x00, 0x04, 0x71, 0x33, 0x10, 0x08, 0xb0, 
-0x06, 0xc9, 0xff, 0xd0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xe8, 0x18, 0x24, 0x01, 0xa9, 0x80, 0x8d, 
-0x00, 0x04, 0xa9, 0x7f, 0x71, 0x33, 0x10, 0x08, 0xb0, 0x06, 0xc9, 0xff, 0xd0, 0x02, 0x50, 0x02, 
-0x86, 0x00, 0xe8, 0x38, 0xb8, 0xa9, 0x80, 0x8d, 0x00, 0x04, 0xa9, 0x7f, 0x71, 0x33, 0xd0, 0x06, 
-0x30, 0x04, 0x70, 0x02, 0xb0, 0x02, 0x86, 0x00, 0xe8, 0x24, 0x01, 0xa9, 0x40, 0x8d, 0x00, 0x04, 
-0xd1, 0x33, 0x30, 0x06, 0x90, 0x04, 0xd0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xe8, 0xb8, 0xce, 0x00, 
-0x04, 0xd1, 0x33, 0xf0, 0x06, 0x30, 0x04, 0x90, 0x02, 0x50, 0x02, 0x86, 0x00, 0xe8, 0xee, 0x00, 
-0x04, 0xee, 0x00, 0x04, 0xd1, 0x33, 0xf0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xe8, 0xa9, 0x00, 0x8d, 
-0x00, 0x04, 0xa9, 0x80, 0xd1, 0x33, 0xf0, 0x04, 0x10, 0x02, 0xb0, 0x02, 0x86, 0x00, 0xe8, 0xa0, 
-0x80, 0x8c, 0x00, 0x04, 0xa0, 0x00, 0xd1, 0x33, 0xd0, 0x04, 0x30, 0x02, 0xb0, 0x02, 0x86, 0x00, 
-0xe8, 0xee, 0x00, 0x04, 0xd1, 0x33, 0xb0, 0x04, 0xf0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xe8, 0xce, 
-0x00, 0x04, 0xce, 0x00, 0x04, 0xd1, 0x33, 0x90, 0x04, 0xf0, 0x02, 0x10, 0x02, 0x86, 0x00, 0x60, 
-0xa9, 0x00, 0x85, 0x33, 0xa9, 0x04, 0x85, 0x34, 0xa0, 0x00, 0xa2, 0x01, 0x24, 0x01, 0xa9, 0x40, 
-0x8d, 0x00, 0x04, 0x38, 0xf1, 0x33, 0x30, 0x0a, 0x90, 0x08, 0xd0, 0x06, 0x70, 0x04, 0xc9, 0x00, 
-0xf0, 0x02, 0x86, 0x00, 0xe8, 0xb8, 0x38, 0xa9, 0x40, 0xce, 0x00, 0x04, 0xf1, 0x33, 0xf0, 0x0a, 
-0x30, 0x08, 0x90, 0x06, 0x70, 0x04, 0xc9, 0x01, 0xf0, 0x02, 0x86, 0x00, 0xe8, 0xa9, 0x40, 0x38, 
-0x24, 0x01, 0xee, 0x00, 0x04, 0xee, 0x00, 0x04, 0xf1, 0x33, 0xb0, 0x0a, 0xf0, 0x08, 0x10, 0x06, 
-0x70, 0x04, 0xc9, 0xff, 0xf0, 0x02, 0x86, 0x00, 0xe8, 0x18, 0xa9, 0x00, 0x8d, 0x00, 0x04, 0xa9, 
-0x80, 0xf1, 0x33, 0x90, 0x04, 0xc9, 0x7f, 0xf0, 0x02, 0x86, 0x00, 0xe8, 0x38, 0xa9, 0x7f, 0x8d, 
-0x00, 0x04, 0xa9, 0x81, 0xf1, 0x33, 0x50, 0x06, 0x90, 0x04, 0xc9, 0x02, 0xf0, 0x02, 0x86, 0x00, 
-0xe8, 0xa9, 0x00, 0xa9, 0x87, 0x91, 0x33, 0xad, 0x00, 0x04, 0xc9, 0x87, 0xf0, 0x02, 0x86, 0x00, 
-0xe8, 0xa9, 0x7e, 0x8d, 0x00, 0x02, 0xa9, 0xdb, 0x8d, 0x01, 0x02, 0x6c, 0x00, 0x02, 0xa9, 0x00, 
-0x8d, 0xff, 0x02, 0xa9, 0x01, 0x8d, 0x00, 0x03, 0xa9, 0x03, 0x8d, 0x00, 0x02, 0xa9, 0xa9, 0x8d, 
-0x00, 0x01, 0xa9, 0x55, 0x8d, 0x01, 0x01, 0xa9, 0x60, 0x8d, 0x02, 0x01, 0xa9, 0xa9, 0x8d, 0x00, 
-0x03, 0xa9, 0xaa, 0x8d, 0x01, 0x03, 0xa9, 0x60, 0x8d, 0x02, 0x03, 0x20, 0xb5, 0xdb, 0xc9, 0xaa, 
-0xf0, 0x02, 0x86, 0x00, 0x60, 0x6c, 0xff, 0x02, 0xa9, 0xff, 0x85, 0x01, 0xa9, 0xaa, 0x85, 0x33, 
-0xa9, 0xbb, 0x85, 0x89, 0xa2, 0x00, 0xa9, 0x66, 0x24, 0x01, 0x38, 0xa0, 0x00, 0xb4, 0x33, 0x10, 
-0x12, 0xf0, 0x10, 0x50, 0x0e, 0x90, 0x0c, 0xc9, 0x66, 0xd0, 0x08, 0xe0, 0x00, 0xd0, 0x04, 0xc0, 
-0xaa, 0xf0, 0x04, 0xa9, 0x08, 0x85, 0x00, 0xa2, 0x8a, 0xa9, 0x66, 0xb8, 0x18, 0xa0, 0x00, 0xb4, 
-0xff, 0x10, 0x12, 0xf0, 0x10, 0x70, 0x0e, 0xb0, 0x0c, 0xc0, 0xbb, 0xd0, 0x08, 0xc9, 0x66, 0xd0, 
-0x04, 0xe0, 0x8a, 0xf0, 0x04, 0xa9, 0x09, 0x85, 0x00, 0x24, 0x01, 0x38, 0xa0, 0x44, 0xa2, 0x00, 
-0x94, 0x33, 0xa5, 0x33, 0x90, 0x18, 0xc9, 0x44, 0xd0, 0x14, 0x50, 0x12, 0x18, 0xb8, 0xa0, 0x99, 
-0xa2, 0x80, 0x94, 0x85, 0xa5, 0x05, 0xb0, 0x06, 0xc9, 0x99, 0xd0, 0x02, 0x50, 0x04, 0xa9, 0x0a, 
-0x85, 0x00, 0xa0, 0x0b, 0xa9, 0xaa, 0xa2, 0x78, 0x85, 0x78, 0x20, 0xb6, 0xf7, 0x15, 0x00, 0x20, 
-0xc0, 0xf7, 0xc8, 0xa9, 0x00, 0x85, 0x78, 0x20, 0xce, 0xf7, 0x15, 0x00, 0x20, 0xd3, 0xf7, 0xc8, 
-0xa9, 0xaa, 0x85, 0x78, 0x20, 0xdf, 0xf7, 0x35, 0x00, 0x20, 0xe5, 0xf7, 0xc8, 0xa9, 0xef, 0x85, 
-0x78, 0x20, 0xf1, 0xf7, 0x35, 0x00, 0x20, 0xf6, 0xf7, 0xc8, 0xa9, 0xaa, 0x85, 0x78, 0x20, 0x04, 
-0xf8, 0x55, 0x00, 0x20, 0x0a, 0xf8, 0xc8, 0xa9, 0x70, 0x85, 0x78, 0x20, 0x18, 0xf8, 0x55, 0x00, 
-0x20, 0x1d, 0xf8, 0xc8, 0xa9, 0x69, 0x85, 0x78, 0x20, 0x29, 0xf8, 0x75, 0x00, 0x20, 0x2f, 0xf8, 
-0xc8, 0x20, 0x3d, 0xf8, 0x75, 0x00, 0x20, 0x43, 0xf8, 0xc8, 0xa9, 0x7f, 0x85, 0x78, 0x20, 0x51, 
-0xf8, 0x75, 0x00, 0x20, 0x56, 0xf8, 0xc8, 0xa9, 0x80, 0x85, 0x78, 0x20, 0x64, 0xf8, 0x75, 0x00, 
-0x20, 0x6a, 0xf8, 0xc8, 0x20, 0x78, 0xf8, 0x75, 0x00, 0x20, 0x7d, 0xf8, 0xc8, 0xa9, 0x40, 0x85, 
-0x78, 0x20, 0x89, 0xf8, 0xd5, 0x00, 0x20, 0x8e, 0xf8, 0xc8, 0x48, 0xa9, 0x3f, 0x85, 0x78, 0x68, 
-0x20, 0x9a, 0xf8, 0xd5, 0x00, 0x20, 0x9c, 0xf8, 0xc8, 0x48, 0xa9, 0x41, 0x85, 0x78, 0x68, 0xd5, 
-0x00, 0x20, 0xa8, 0xf8, 0xc8, 0x48, 0xa9, 0x00, 0x85, 0x78, 0x68, 0x20, 0xb2, 0xf8, 0xd5, 0x00, 
-0x20, 0xb5, 0xf8, 0xc8, 0x48, 0xa9, 0x80, 0x85, 0x78, 0x68, 0xd5, 0x00, 0x20, 0xbf, 0xf8, 0xc8, 
-0x48, 0xa9, 0x81, 0x85, 0x78, 0x68, 0xd5, 0x00, 0x20, 0xc9, 0xf8, 0xc8, 0x48, 0xa9, 0x7f, 0x85, 
-0x78, 0x68, 0xd5, 0x00, 0x20, 0xd3, 0xf8, 0xc8, 0xa9, 0x40, 0x85, 0x78, 0x20, 0x31, 0xf9, 0xf5, 
-0x00, 0x20, 0x37, 0xf9, 0xc8, 0xa9, 0x3f, 0x85, 0x78, 0x20, 0x47, 0xf9, 0xf5, 0x00, 0x20, 0x4c, 
-0xf9, 0xc8, 0xa9, 0x41, 0x85, 0x78, 0x20, 0x5c, 0xf9, 0xf5, 0x00, 0x20, 0x62, 0xf9, 0xc8, 0xa9, 
-0x00, 0x85, 0x78, 0x20, 0x72, 0xf9, 0xf5, 0x00, 0x20, 0x76, 0xf9, 0xc8, 0xa9, 0x7f, 0x85, 0x78, 
-0x20, 0x80, 0xf9, 0xf5, 0x00, 0x20, 0x84, 0xf9, 0xa9, 0xaa, 0x85, 0x33, 0xa9, 0xbb, 0x85, 0x89, 
-0xa2, 0x00, 0xa0, 0x66, 0x24, 0x01, 0x38, 0xa9, 0x00, 0xb5, 0x33, 0x10, 0x12, 0xf0, 0x10, 0x50, 
-0x0e, 0x90, 0x0c, 0xc0, 0x66, 0xd0, 0x08, 0xe0, 0x00, 0xd0, 0x04, 0xc9, 0xaa, 0xf0, 0x04, 0xa9, 
-0x22, 0x85, 0x00, 0xa2, 0x8a, 0xa0, 0x66, 0xb8, 0x18, 0xa9, 0x00, 0xb5, 0xff, 0x10, 0x12, 0xf0, 
-0x10, 0x70, 0x0e, 0xb0, 0x0c, 0xc9, 0xbb, 0xd0, 0x08, 0xc0, 0x66, 0xd0, 0x04, 0xe0, 0x8a, 0xf0, 
-0x04, 0xa9, 0x23, 0x85, 0x00, 0x24, 0x01, 0x38, 0xa9, 0x44, 0xa2, 0x00, 0x95, 0x33, 0xa5, 0x33, 
-0x90, 0x18, 0xc9, 0x44, 0xd0, 0x14, 0x50, 0x12, 0x18, 0xb8, 0xa9, 0x99, 0xa2, 0x80, 0x95, 0x85, 
-0xa5, 0x05, 0xb0, 0x06, 0xc9, 0x99, 0xd0, 0x02, 0x50, 0x04, 0xa9, 0x24, 0x85, 0x00, 0xa0, 0x25, 
-0xa2, 0x78, 0x20, 0x90, 0xf9, 0x95, 0x00, 0x56, 0x00, 0xb5, 0x00, 0x20, 0x9d, 0xf9, 0xc8, 0x95, 
-0x00, 0x56, 0x00, 0xb5, 0x00, 0x20, 0xad, 0xf9, 0xc8, 0x20, 0xbd, 0xf9, 0x95, 0x00, 0x16, 0x00, 
-0xb5, 0x00, 0x20, 0xc3, 0xf9, 0xc8, 0x95, 0x00, 0x16, 0x00, 0xb5, 0x00, 0x20, 0xd4, 0xf9, 0xc8, 
-0x20, 0xe4, 0xf9, 0x95, 0x00, 0x76, 0x00, 0xb5, 0x00, 0x20, 0xea, 0xf9, 0xc8, 0x95, 0x00, 0x76, 
-0x00, 0xb5, 0x00, 0x20, 0xfb, 0xf9, 0xc8, 0x20, 0x0a, 0xfa, 0x95, 0x00, 0x36, 0x00, 0xb5, 0x00, 
-0x20, 0x10, 0xfa, 0xc8, 0x95, 0x00, 0x36, 0x00, 0xb5, 0x00, 0x20, 0x21, 0xfa, 0xa9, 0xff, 0x95, 
-0x00, 0x85, 0x01, 0x24, 0x01, 0x38, 0xf6, 0x00, 0xd0, 0x0c, 0x30, 0x0a, 0x50, 0x08, 0x90, 0x06, 
-0xb5, 0x00, 0xc9, 0x00, 0xf0, 0x04, 0xa9, 0x2d, 0x85, 0x00, 0xa9, 0x7f, 0x95, 0x00, 0xb8, 0x18, 
-0xf6, 0x00, 0xf0, 0x0c, 0x10, 0x0a, 0x70, 0x08, 0xb0, 0x06, 0xb5, 0x00, 0xc9, 0x80, 0xf0, 0x04, 
-0xa9, 0x2e, 0x85, 0x00, 0xa9, 0x00, 0x95, 0x00, 0x24, 0x01, 0x38, 0xd6, 0x00, 0xf0, 0x0c, 0x10, 
-0x0a, 0x50, 0x08, 0x90, 0x06, 0xb5, 0x00, 0xc9, 0xff, 0xf0, 0x04, 0xa9, 0x2f, 0x85, 0x00, 0xa9, 
-0x80, 0x95, 0x00, 0xb8, 0x18, 0xd6, 0x00, 0xf0, 0x0c, 0x30, 0x0a, 0x70, 0x08, 0xb0, 0x06, 0xb5, 
-0x00, 0xc9, 0x7f, 0xf0, 0x04, 0xa9, 0x30, 0x85, 0x00, 0xa9, 0x01, 0x95, 0x00, 0xd6, 0x00, 0xf0, 
-0x04, 0xa9, 0x31, 0x85, 0x00, 0xa9, 0x33, 0x85, 0x78, 0xa9, 0x44, 0xa0, 0x78, 0xa2, 0x00, 0x38, 
-0x24, 0x01, 0xb6, 0x00, 0x90, 0x12, 0x50, 0x10, 0x30, 0x0e, 0xf0, 0x0c, 0xe0, 0x33, 0xd0, 0x08, 
-0xc0, 0x78, 0xd0, 0x04, 0xc9, 0x44, 0xf0, 0x04, 0xa9, 0x32, 0x85, 0x00, 0xa9, 0x97, 0x85, 0x7f, 
-0xa9, 0x47, 0xa0, 0xff, 0xa2, 0x00, 0x18, 0xb8, 0xb6, 0x80, 0xb0, 0x12, 0x70, 0x10, 0x10, 0x0e, 
-0xf0, 0x0c, 0xe0, 0x97, 0xd0, 0x08, 0xc0, 0xff, 0xd0, 0x04, 0xc9, 0x47, 0xf0, 0x04, 0xa9, 0x33, 
-0x85, 0x00, 0xa9, 0x00, 0x85, 0x7f, 0xa9, 0x47, 0xa0, 0xff, 0xa2, 0x69, 0x18, 0xb8, 0x96, 0x80, 
-0xb0, 0x18, 0x70, 0x16, 0x30, 0x14, 0xf0, 0x12, 0xe0, 0x69, 0xd0, 0x0e, 0xc0, 0xff, 0xd0, 0x0a, 
-0xc9, 0x47, 0xd0, 0x06, 0xa5, 0x7f, 0xc9, 0x69, 0xf0, 0x04, 0xa9, 0x34, 0x85, 0x00, 0xa9, 0xf5, 
-0x85, 0x4f, 0xa9, 0x47, 0xa0, 0x4f, 0x24, 0x01, 0xa2, 0x00, 0x38, 0x96, 0x00, 0x90, 0x16, 0x50, 
-0x14, 0x30, 0x12, 0xd0, 0x10, 0xe0, 0x00, 0xd0, 0x0c, 0xc0, 0x4f, 0xd0, 0x08, 0xc9, 0x47, 0xd0, 
-0x04, 0xa5, 0x4f, 0xf0, 0x04, 0xa9, 0x35, 0x85, 0x00, 0x60, 0xa9, 0x89, 0x8d, 0x00, 0x03, 0xa9, 
-0xa3, 0x85, 0x33, 0xa9, 0x12, 0x8d, 0x45, 0x02, 0xa2, 0x65, 0xa0, 0x00, 0x38, 0xa9, 0x00, 0xb8, 
-0xb9, 0x00, 0x03, 0xf0, 0x0c, 0x90, 0x0a, 0x70, 0x08, 0xc9, 0x89, 0xd0, 0x04, 0xe0, 0x65, 0xf0, 
-0x04, 0xa9, 0x36, 0x85, 0x00, 0xa9, 0xff, 0x85, 0x01, 0x24, 0x01, 0xa0, 0x34, 0xb9, 0xff, 0xff, 
-0xc9, 0xa3, 0xd0, 0x02, 0xb0, 0x04, 0xa9, 0x37, 0x85, 0x00, 0xa9, 0x46, 0x85, 0xff, 0xa0, 0xff, 
-0xb9, 0x46, 0x01, 0xc9, 0x12, 0xf0, 0x04, 0xa9, 0x38, 0x85, 0x00, 0xa2, 0x39, 0x18, 0xa9, 0xff, 
-0x85, 0x01, 0x24, 0x01, 0xa9, 0xaa, 0x8d, 0x00, 0x04, 0xa9, 0x55, 0xa0, 0x00, 0x19, 0x00, 0x04, 
-0xb0, 0x08, 0x10, 0x06, 0xc9, 0xff, 0xd0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xe8, 0x38, 0xb8, 0xa9, 
-0x00, 0x19, 0x00, 0x04, 0xf0, 0x06, 0x70, 0x04, 0x90, 0x02, 0x30, 0x02, 0x86, 0x00, 0xe8, 0x18, 
-0x24, 0x01, 0xa9, 0x55, 0x39, 0x00, 0x04, 0xd0, 0x06, 0x50, 0x04, 0xb0, 0x02, 0x10, 0x02, 0x86, 
-0x00, 0xe8, 0x38, 0xb8, 0xa9, 0xef, 0x8d, 0x00, 0x04, 0xa9, 0xf8, 0x39, 0x00, 0x04, 0x90, 0x08, 
-0x10, 0x06, 0xc9, 0xe8, 0xd0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xe8, 0x18, 0x24, 0x01, 0xa9, 0xaa, 
-0x8d, 0x00, 0x04, 0xa9, 0x5f, 0x59, 0x00, 0x04, 0xb0, 0x08, 0x10, 0x06, 0xc9, 0xf5, 0xd0, 0x02, 
-0x70, 0x02, 0x86, 0x00, 0xe8, 0x38, 0xb8, 0xa9, 0x70, 0x8d, 0x00, 0x04, 0x59, 0x00, 0x04, 0xd0, 
-0x06, 0x70, 0x04, 0x90, 0x02, 0x10, 0x02, 0x86, 0x00, 0xe8, 0x18, 0x24, 0x01, 0xa9, 0x69, 0x8d, 
-0x00, 0x04, 0xa9, 0x00, 0x79, 0x00, 0x04, 0x30, 0x08, 0xb0, 0x06, 0xc9, 0x69, 0xd0, 0x02, 0x50, 
-0x02, 0x86, 0x00, 0xe8, 0x38, 0x24, 0x01, 0xa9, 0x00, 0x79, 0x00, 0x04, 0x30, 0x08, 0xb0, 0x06, 
-0xc9, 0x6a, 0xd0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xe8, 0x38, 0xb8, 0xa9, 0x7f, 0x8d, 0x00, 0x04, 
-0x79, 0x00, 0x04, 0x10, 0x08, 0xb0, 0x06, 0xc9, 0xff, 0xd0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xe8, 
-0x18, 0x24, 0x01, 0xa9, 0x80, 0x8d, 0x00, 0x04, 0xa9, 0x7f, 0x79, 0x00, 0x04, 0x10, 0x08, 0xb0, 
-0x06, 0xc9, 0xff, 0xd0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xe8, 0x38, 0xb8, 0xa9, 0x80, 0x8d, 0x00, 
-0x04, 0xa9, 0x7f, 0x79, 0x00, 0x04, 0xd0, 0x06, 0x30, 0x04, 0x70, 0x02, 0xb0, 0x02, 0x86, 0x00, 
-0xe8, 0x24, 0x01, 0xa9, 0x40, 0x8d, 0x00, 0x04, 0xd9, 0x00, 0x04, 0x30, 0x06, 0x90, 0x04, 0xd0, 
-0x02, 0x70, 0x02, 0x86, 0x00, 0xe8, 0xb8, 0xce, 0x00, 0x04, 0xd9, 0x00, 0x04, 0xf0, 0x06, 0x30, 
-0x04, 0x90, 0x02, 0x50, 0x02, 0x86, 0x00, 0xe8, 0xee, 0x00, 0x04, 0xee, 0x00, 0x04, 0xd9, 0x00, 
-0x04, 0xf0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xe8, 0xa9, 0x00, 0x8d, 0x00, 0x04, 0xa9, 0x80, 0xd9, 
-0x00, 0x04, 0xf0, 0x04, 0x10, 0x02, 0xb0, 0x02, 0x86, 0x00, 0xe8, 0xa0, 0x80, 0x8c, 0x00, 0x04, 
-0xa0, 0x00, 0xd9, 0x00, 0x04, 0xd0, 0x04, 0x30, 0x02, 0xb0, 0x02, 0x86, 0x00, 0xe8, 0xee, 0x00, 
-0x04, 0xd9, 0x00, 0x04, 0xb0, 0x04, 0xf0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xe8, 0xce, 0x00, 0x04, 
-0xce, 0x00, 0x04, 0xd9, 0x00, 0x04, 0x90, 0x04, 0xf0, 0x02, 0x10, 0x02, 0x86, 0x00, 0xe8, 0x24, 
-0x01, 0xa9, 0x40, 0x8d, 0x00, 0x04, 0x38, 0xf9, 0x00, 0x04, 0x30, 0x0a, 0x90, 0x08, 0xd0, 0x06, 
-0x70, 0x04, 0xc9, 0x00, 0xf0, 0x02, 0x86, 0x00, 0xe8, 0xb8, 0x38, 0xa9, 0x40, 0xce, 0x00, 0x04, 
-0xf9, 0x00, 0x04, 0xf0, 0x0a, 0x30, 0x08, 0x90, 0x06, 0x70, 0x04, 0xc9, 0x01, 0xf0, 0x02, 0x86, 
-0x00, 0xe8, 0xa9, 0x40, 0x38, 0x24, 0x01, 0xee, 0x00, 0x04, 0xee, 0x00, 0x04, 0xf9, 0x00, 0x04, 
-0xb0, 0x0a, 0xf0, 0x08, 0x10, 0x06, 0x70, 0x04, 0xc9, 0xff, 0xf0, 0x02, 0x86, 0x00, 0xe8, 0x18, 
-0xa9, 0x00, 0x8d, 0x00, 0x04, 0xa9, 0x80, 0xf9, 0x00, 0x04, 0x90, 0x04, 0xc9, 0x7f, 0xf0, 0x02, 
-0x86, 0x00, 0xe8, 0x38, 0xa9, 0x7f, 0x8d, 0x00, 0x04, 0xa9, 0x81, 0xf9, 0x00, 0x04, 0x50, 0x06, 
-0x90, 0x04, 0xc9, 0x02, 0xf0, 0x02, 0x86, 0x00, 0xe8, 0xa9, 0x00, 0xa9, 0x87, 0x99, 0x00, 0x04, 
-0xad, 0x00, 0x04, 0xc9, 0x87, 0xf0, 0x02, 0x86, 0x00, 0x60, 0xa9, 0xff, 0x85, 0x01, 0xa9, 0xaa, 
-0x8d, 0x33, 0x06, 0xa9, 0xbb, 0x8d, 0x89, 0x06, 0xa2, 0x00, 0xa9, 0x66, 0x24, 0x01, 0x38, 0xa0, 
-0x00, 0xbc, 0x33, 0x06, 0x10, 0x12, 0xf0, 0x10, 0x50, 0x0e, 0x90, 0x0c, 0xc9, 0x66, 0xd0, 0x08, 
-0xe0, 0x00, 0xd0, 0x04, 0xc0, 0xaa, 0xf0, 0x04, 0xa9, 0x51, 0x85, 0x00, 0xa2, 0x8a, 0xa9, 0x66, 
-0xb8, 0x18, 0xa0, 0x00, 0xbc, 0xff, 0x05, 0x10, 0x12, 0xf0, 0x10, 0x70, 0x0e, 0xb0, 0x0c, 0xc0, 
-0xbb, 0xd0, 0x08, 0xc9, 0x66, 0xd0, 0x04, 0xe0, 0x8a, 0xf0, 0x04, 0xa9, 0x52, 0x85, 0x00, 0xa0, 
-0x53, 0xa9, 0xaa, 0xa2, 0x78, 0x8d, 0x78, 0x06, 0x20, 0xb6, 0xf7, 0x1d, 0x00, 0x06, 0x20, 0xc0, 
-0xf7, 0xc8, 0xa9, 0x00, 0x8d, 0x78, 0x06, 0x20, 0xce, 0xf7, 0x1d, 0x00, 0x06, 0x20, 0xd3, 0xf7, 
-0xc8, 0xa9, 0xaa, 0x8d, 0x78, 0x06, 0x20, 0xdf, 0xf7, 0x3d, 0x00, 0x06, 0x20, 0xe5, 0xf7, 0xc8, 
-0xa9, 0xef, 0x8d, 0x78, 0x06, 0x20, 0xf1, 0xf7, 0x3d, 0x00, 0x06, 0x20, 0xf6, 0xf7, 0xc8, 0xa9, 
-0xaa, 0x8d, 0x78, 0x06, 0x20, 0x04, 0xf8, 0x5d, 0x00, 0x06, 0x20, 0x0a, 0xf8, 0xc8, 0xa9, 0x70, 
-0x8d, 0x78, 0x06, 0x20, 0x18, 0xf8, 0x5d, 0x00, 0x06, 0x20, 0x1d, 0xf8, 0xc8, 0xa9, 0x69, 0x8d, 
-0x78, 0x06, 0x20, 0x29, 0xf8, 0x7d, 0x00, 0x06, 0x20, 0x2f, 0xf8, 0xc8, 0x20, 0x3d, 0xf8, 0x7d, 
-0x00, 0x06, 0x20, 0x43, 0xf8, 0xc8, 0xa9, 0x7f, 0x8d, 0x78, 0x06, 0x20, 0x51, 0xf8, 0x7d, 0x00, 
-0x06, 0x20, 0x56, 0xf8, 0xc8, 0xa9, 0x80, 0x8d, 0x78, 0x06, 0x20, 0x64, 0xf8, 0x7d, 0x00, 0x06, 
-0x20, 0x6a, 0xf8, 0xc8, 0x20, 0x78, 0xf8, 0x7d, 0x00, 0x06, 0x20, 0x7d, 0xf8, 0xc8, 0xa9, 0x40, 
-0x8d, 0x78, 0x06, 0x20, 0x89, 0xf8, 0xdd, 0x00, 0x06, 0x20, 0x8e, 0xf8, 0xc8, 0x48, 0xa9, 0x3f, 
-0x8d, 0x78, 0x06, 0x68, 0x20, 0x9a, 0xf8, 0xdd, 0x00, 0x06, 0x20, 0x9c, 0xf8, 0xc8, 0x48, 0xa9, 
-0x41, 0x8d, 0x78, 0x06, 0x68, 0xdd, 0x00, 0x06, 0x20, 0xa8, 0xf8, 0xc8, 0x48, 0xa9, 0x00, 0x8d, 
-0x78, 0x06, 0x68, 0x20, 0xb2, 0xf8, 0xdd, 0x00, 0x06, 0x20, 0xb5, 0xf8, 0xc8, 0x48, 0xa9, 0x80, 
-0x8d, 0x78, 0x06, 0x68, 0xdd, 0x00, 0x06, 0x20, 0xbf, 0xf8, 0xc8, 0x48, 0xa9, 0x81, 0x8d, 0x78, 
-0x06, 0x68, 0xdd, 0x00, 0x06, 0x20, 0xc9, 0xf8, 0xc8, 0x48, 0xa9, 0x7f, 0x8d, 0x78, 0x06, 0x68, 
-0xdd, 0x00, 0x06, 0x20, 0xd3, 0xf8, 0xc8, 0xa9, 0x40, 0x8d, 0x78, 0x06, 0x20, 0x31, 0xf9, 0xfd, 
-0x00, 0x06, 0x20, 0x37, 0xf9, 0xc8, 0xa9, 0x3f, 0x8d, 0x78, 0x06, 0x20, 0x47, 0xf9, 0xfd, 0x00, 
-0x06, 0x20, 0x4c, 0xf9, 0xc8, 0xa9, 0x41, 0x8d, 0x78, 0x06, 0x20, 0x5c, 0xf9, 0xfd, 0x00, 0x06, 
-0x20, 0x62, 0xf9, 0xc8, 0xa9, 0x00, 0x8d, 0x78, 0x06, 0x20, 0x72, 0xf9, 0xfd, 0x00, 0x06, 0x20, 
-0x76, 0xf9, 0xc8, 0xa9, 0x7f, 0x8d, 0x78, 0x06, 0x20, 0x80, 0xf9, 0xfd, 0x00, 0x06, 0x20, 0x84, 
-0xf9, 0xa9, 0xaa, 0x8d, 0x33, 0x06, 0xa9, 0xbb, 0x8d, 0x89, 0x06, 0xa2, 0x00, 0xa0, 0x66, 0x24, 
-0x01, 0x38, 0xa9, 0x00, 0xbd, 0x33, 0x06, 0x10, 0x12, 0xf0, 0x10, 0x50, 0x0e, 0x90, 0x0c, 0xc0, 
-0x66, 0xd0, 0x08, 0xe0, 0x00, 0xd0, 0x04, 0xc9, 0xaa, 0xf0, 0x04, 0xa9, 0x6a, 0x85, 0x00, 0xa2, 
-0x8a, 0xa0, 0x66, 0xb8, 0x18, 0xa9, 0x00, 0xbd, 0xff, 0x05, 0x10, 0x12, 0xf0, 0x10, 0x70, 0x0e, 
-0xb0, 0x0c, 0xc9, 0xbb, 0xd0, 0x08, 0xc0, 0x66, 0xd0, 0x04, 0xe0, 0x8a, 0xf0, 0x04, 0xa9, 0x6b, 
-0x85, 0x00, 0x24, 0x01, 0x38, 0xa9, 0x44, 0xa2, 0x00, 0x9d, 0x33, 0x06, 0xad, 0x33, 0x06, 0x90, 
-0x1a, 0xc9, 0x44, 0xd0, 0x16, 0x50, 0x14, 0x18, 0xb8, 0xa9, 0x99, 0xa2, 0x80, 0x9d, 0x85, 0x05, 
-0xad, 0x05, 0x06, 0xb0, 0x06, 0xc9, 0x99, 0xd0, 0x02, 0x50, 0x04, 0xa9, 0x6c, 0x85, 0x00, 0xa0, 
-0x6d, 0xa2, 0x6d, 0x20, 0x90, 0xf9, 0x9d, 0x00, 0x06, 0x5e, 0x00, 0x06, 0xbd, 0x00, 0x06, 0x20, 
-0x9d, 0xf9, 0xc8, 0x9d, 0x00, 0x06, 0x5e, 0x00, 0x06, 0xbd, 0x00, 0x06, 0x20, 0xad, 0xf9, 0xc8, 
-0x20, 0xbd, 0xf9, 0x9d, 0x00, 0x06, 0x1e, 0x00, 0x06, 0xbd, 0x00, 0x06, 0x20, 0xc3, 0xf9, 0xc8, 
-0x9d, 0x00, 0x06, 0x1e, 0x00, 0x06, 0xbd, 0x00, 0x06, 0x20, 0xd4, 0xf9, 0xc8, 0x20, 0xe4, 0xf9, 
-0x9d, 0x00, 0x06, 0x7e, 0x00, 0x06, 0xbd, 0x00, 0x06, 0x20, 0xea, 0xf9, 0xc8, 0x9d, 0x00, 0x06, 
-0x7e, 0x00, 0x06, 0xbd, 0x00, 0x06, 0x20, 0xfb, 0xf9, 0xc8, 0x20, 0x0a, 0xfa, 0x9d, 0x00, 0x06, 
-0x3e, 0x00, 0x06, 0xbd, 0x00, 0x06, 0x20, 0x10, 0xfa, 0xc8, 0x9d, 0x00, 0x06, 0x3e, 0x00, 0x06, 
-0xbd, 0x00, 0x06, 0x20, 0x21, 0xfa, 0xa9, 0xff, 0x9d, 0x00, 0x06, 0x85, 0x01, 0x24, 0x01, 0x38, 
-0xfe, 0x00, 0x06, 0xd0, 0x0d, 0x30, 0x0b, 0x50, 0x09, 0x90, 0x07, 0xbd, 0x00, 0x06, 0xc9, 0x00, 
-0xf0, 0x04, 0xa9, 0x75, 0x85, 0x00, 0xa9, 0x7f, 0x9d, 0x00, 0x06, 0xb8, 0x18, 0xfe, 0x00, 0x06, 
-0xf0, 0x0d, 0x10, 0x0b, 0x70, 0x09, 0xb0, 0x07, 0xbd, 0x00, 0x06, 0xc9, 0x80, 0xf0, 0x04, 0xa9, 
-0x76, 0x85, 0x00, 0xa9, 0x00, 0x9d, 0x00, 0x06, 0x24, 0x01, 0x38, 0xde, 0x00, 0x06, 0xf0, 0x0d, 
-0x10, 0x0b, 0x50, 0x09, 0x90, 0x07, 0xbd, 0x00, 0x06, 0xc9, 0xff, 0xf0, 0x04, 0xa9, 0x77, 0x85, 
-0x00, 0xa9, 0x80, 0x9d, 0x00, 0x06, 0xb8, 0x18, 0xde, 0x00, 0x06, 0xf0, 0x0d, 0x30, 0x0b, 0x70, 
-0x09, 0xb0, 0x07, 0xbd, 0x00, 0x06, 0xc9, 0x7f, 0xf0, 0x04, 0xa9, 0x78, 0x85, 0x00, 0xa9, 0x01, 
-0x9d, 0x00, 0x06, 0xde, 0x00, 0x06, 0xf0, 0x04, 0xa9, 0x79, 0x85, 0x00, 0xa9, 0x33, 0x8d, 0x78, 
-0x06, 0xa9, 0x44, 0xa0, 0x78, 0xa2, 0x00, 0x38, 0x24, 0x01, 0xbe, 0x00, 0x06, 0x90, 0x12, 0x50, 
-0x10, 0x30, 0x0e, 0xf0, 0x0c, 0xe0, 0x33, 0xd0, 0x08, 0xc0, 0x78, 0xd0, 0x04, 0xc9, 0x44, 0xf0, 
-0x04, 0xa9, 0x7a, 0x85, 0x00, 0xa9, 0x97, 0x8d, 0x7f, 0x06, 0xa9, 0x47, 0xa0, 0xff, 0xa2, 0x00, 
-0x18, 0xb8, 0xbe, 0x80, 0x05, 0xb0, 0x12, 0x70, 0x10, 0x10, 0x0e, 0xf0, 0x0c, 0xe0, 0x97, 0xd0, 
-0x08, 0xc0, 0xff, 0xd0, 0x04, 0xc9, 0x47, 0xf0, 0x04, 0xa9, 0x7b, 0x85, 0x00, 0x60, 0xa9, 0x55, 
-0x8d, 0x80, 0x05, 0xa9, 0xaa, 0x8d, 0x32, 0x04, 0xa9, 0x80, 0x85, 0x43, 0xa9, 0x05, 0x85, 0x44, 
-0xa9, 0x32, 0x85, 0x45, 0xa9, 0x04, 0x85, 0x46, 0xa2, 0x03, 0xa0, 0x77, 0xa9, 0xff, 0x85, 0x01, 
-0x24, 0x01, 0x38, 0xa9, 0x00, 0xa3, 0x40, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 0x30, 0x10, 0x50, 
-0x0e, 0x90, 0x0c, 0xc9, 0x55, 0xd0, 0x08, 0xe0, 0x55, 0xd0, 0x04, 0xc0, 0x77, 0xf0, 0x04, 0xa9, 
-0x7c, 0x85, 0x00, 0xa2, 0x05, 0xa0, 0x33, 0xb8, 0x18, 0xa9, 0x00, 0xa3, 0x40, 0xea, 0xea, 0xea, 
-0xea, 0xf0, 0x12, 0x10, 0x10, 0x70, 0x0e, 0xb0, 0x0c, 0xc9, 0xaa, 0xd0, 0x08, 0xe0, 0xaa, 0xd0, 
-0x04, 0xc0, 0x33, 0xf0, 0x04, 0xa9, 0x7d, 0x85, 0x00, 0xa9, 0x87, 0x85, 0x67, 0xa9, 0x32, 0x85, 
-0x68, 0xa0, 0x57, 0x24, 0x01, 0x38, 0xa9, 0x00, 0xa7, 0x67, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 
-0x10, 0x10, 0x50, 0x0e, 0x90, 0x0c, 0xc9, 0x87, 0xd0, 0x08, 0xe0, 0x87, 0xd0, 0x04, 0xc0, 0x57, 
-0xf0, 0x04, 0xa9, 0x7e, 0x85, 0x00, 0xa0, 0x53, 0xb8, 0x18, 0xa9, 0x00, 0xa7, 0x68, 0xea, 0xea, 
-0xea, 0xea, 0xf0, 0x12, 0x30, 0x10, 0x70, 0x0e, 0xb0, 0x0c, 0xc9, 0x32, 0xd0, 0x08, 0xe0, 0x32, 
-0xd0, 0x04, 0xc0, 0x53, 0xf0, 0x04, 0xa9, 0x7f, 0x85, 0x00, 0xa9, 0x87, 0x8d, 0x77, 0x05, 0xa9, 
-0x32, 0x8d, 0x78, 0x05, 0xa0, 0x57, 0x24, 0x01, 0x38, 0xa9, 0x00, 0xaf, 0x77, 0x05, 0xea, 0xea, 
-0xea, 0xea, 0xf0, 0x12, 0x10, 0x10, 0x50, 0x0e, 0x90, 0x0c, 0xc9, 0x87, 0xd0, 0x08, 0xe0, 0x87, 
-0xd0, 0x04, 0xc0, 0x57, 0xf0, 0x04, 0xa9, 0x80, 0x85, 0x00, 0xa0, 0x53, 0xb8, 0x18, 0xa9, 0x00, 
-0xaf, 0x78, 0x05, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 0x30, 0x10, 0x70, 0x0e, 0xb0, 0x0c, 0xc9, 
-0x32, 0xd0, 0x08, 0xe0, 0x32, 0xd0, 0x04, 0xc0, 0x53, 0xf0, 0x04, 0xa9, 0x81, 0x85, 0x00, 0xa9, 
-0xff, 0x85, 0x43, 0xa9, 0x04, 0x85, 0x44, 0xa9, 0x32, 0x85, 0x45, 0xa9, 0x04, 0x85, 0x46, 0xa9, 
-0x55, 0x8d, 0x80, 0x05, 0xa9, 0xaa, 0x8d, 0x32, 0x04, 0xa2, 0x03, 0xa0, 0x81, 0x24, 0x01, 0x38, 
-0xa9, 0x00, 0xb3, 0x43, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 0x30, 0x10, 0x50, 0x0e, 0x90, 0x0c, 
-0xc9, 0x55, 0xd0, 0x08, 0xe0, 0x55, 0xd0, 0x04, 0xc0, 0x81, 0xf0, 0x04, 0xa9, 0x82, 0x85, 0x00, 
-0xa2, 0x05, 0xa0, 0x00, 0xb8, 0x18, 0xa9, 0x00, 0xb3, 0x45, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 
-0x10, 0x10, 0x70, 0x0e, 0xb0, 0x0c, 0xc9, 0xaa, 0xd0, 0x08, 0xe0, 0xaa, 0xd0, 0x04, 0xc0, 0x00, 
-0xf0, 0x04, 0xa9, 0x83, 0x85, 0x00, 0xa9, 0x87, 0x85, 0x67, 0xa9, 0x32, 0x85, 0x68, 0xa0, 0x57, 
-0x24, 0x01, 0x38, 0xa9, 0x00, 0xb7, 0x10, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 0x10, 0x10, 0x50, 
-0x0e, 0x90, 0x0c, 0xc9, 0x87, 0xd0, 0x08, 0xe0, 0x87, 0xd0, 0x04, 0xc0, 0x57, 0xf0, 0x04, 0xa9, 
-0x84, 0x85, 0x00, 0xa0, 0xff, 0xb8, 0x18, 0xa9, 0x00, 0xb7, 0x69, 0xea, 0xea, 0xea, 0xea, 0xf0, 
-0x12, 0x30, 0x10, 0x70, 0x0e, 0xb0, 0x0c, 0xc9, 0x32, 0xd0, 0x08, 0xe0, 0x32, 0xd0, 0x04, 0xc0, 
-0xff, 0xf0, 0x04, 0xa9, 0x85, 0x85, 0x00, 0xa9, 0x87, 0x8d, 0x87, 0x05, 0xa9, 0x32, 0x8d, 0x88, 
-0x05, 0xa0, 0x30, 0x24, 0x01, 0x38, 0xa9, 0x00, 0xbf, 0x57, 0x05, 0xea, 0xea, 0xea, 0xea, 0xf0, 
-0x12, 0x10, 0x10, 0x50, 0x0e, 0x90, 0x0c, 0xc9, 0x87, 0xd0, 0x08, 0xe0, 0x87, 0xd0, 0x04, 0xc0, 
-0x30, 0xf0, 0x04, 0xa9, 0x86, 0x85, 0x00, 0xa0, 0x40, 0xb8, 0x18, 0xa9, 0x00, 0xbf, 0x48, 0x05, 
-0xea, 0xea, 0xea, 0xea, 0xf0, 0x12, 0x30, 0x10, 0x70, 0x0e, 0xb0, 0x0c, 0xc9, 0x32, 0xd0, 0x08, 
-0xe0, 0x32, 0xd0, 0x04, 0xc0, 0x40, 0xf0, 0x04, 0xa9, 0x87, 0x85, 0x00, 0x60, 0xa9, 0xc0, 0x85, 
-0x01, 0xa9, 0x00, 0x8d, 0x89, 0x04, 0xa9, 0x89, 0x85, 0x60, 0xa9, 0x04, 0x85, 0x61, 0xa0, 0x44, 
-0xa2, 0x17, 0xa9, 0x3e, 0x24, 0x01, 0x18, 0x83, 0x49, 0xea, 0xea, 0xea, 0xea, 0xd0, 0x19, 0xb0, 
-0x17, 0x50, 0x15, 0x10, 0x13, 0xc9, 0x3e, 0xd0, 0x0f, 0xc0, 0x44, 0xd0, 0x0b, 0xe0, 0x17, 0xd0, 
-0x07, 0xad, 0x89, 0x04, 0xc9, 0x16, 0xf0, 0x04, 0xa9, 0x88, 0x85, 0x00, 0xa0, 0x44, 0xa2, 0x7a, 
-0xa9, 0x66, 0x38, 0xb8, 0x83, 0xe6, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x19, 0x90, 0x17, 0x70, 0x15, 
-0x30, 0x13, 0xc9, 0x66, 0xd0, 0x0f, 0xc0, 0x44, 0xd0, 0x0b, 0xe0, 0x7a, 0xd0, 0x07, 0xad, 0x89, 
-0x04, 0xc9, 0x62, 0xf0, 0x04, 0xa9, 0x89, 0x85, 0x00, 0xa9, 0xff, 0x85, 0x49, 0xa0, 0x44, 0xa2, 
-0xaa, 0xa9, 0x55, 0x24, 0x01, 0x18, 0x87, 0x49, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x18, 0xb0, 0x16, 
-0x50, 0x14, 0x10, 0x12, 0xc9, 0x55, 0xd0, 0x0e, 0xc0, 0x44, 0xd0, 0x0a, 0xe0, 0xaa, 0xd0, 0x06, 
-0xa5, 0x49, 0xc9, 0x00, 0xf0, 0x04, 0xa9, 0x8a, 0x85, 0x00, 0xa9, 0x00, 0x85, 0x56, 0xa0, 0x58, 
-0xa2, 0xef, 0xa9, 0x66, 0x38, 0xb8, 0x87, 0x56, 0xea, 0xea, 0xea, 0xea, 0xf0, 0x18, 0x90, 0x16, 
-0x70, 0x14, 0x30, 0x12, 0xc9, 0x66, 0xd0, 0x0e, 0xc0, 0x58, 0xd0, 0x0a, 0xe0, 0xef, 0xd0, 0x06, 
-0xa5, 0x56, 0xc9, 0x66, 0xf0, 0x04, 0xa9, 0x8b, 0x85, 0x00, 0xa9, 0xff, 0x8d, 0x49, 0x05, 0xa0, 
-0xe5, 0xa2, 0xaf, 0xa9, 0xf5, 0x24, 0x01, 0x18, 0x8f, 0x49, 0x05, 0xea, 0xea, 0xea, 0xea, 0xf0, 
-0x19, 0xb0, 0x17, 0x50, 0x15, 0x10, 0x13, 0xc9, 0xf5, 0xd0, 0x0f, 0xc0, 0xe5, 0xd0, 0x0b, 0xe0, 
-0xaf, 0xd0, 0x07, 0xad, 0x49, 0x05, 0xc9, 0xa5, 0xf0, 0x04, 0xa9, 0x8c, 0x85, 0x00, 0xa9, 0x00, 
-0x8d, 0x56, 0x05, 0xa0, 0x58, 0xa2, 0xb3, 0xa9, 0x97, 0x38, 0xb8, 0x8f, 0x56, 0x05, 0xea, 0xea, 
-0xea, 0xea, 0xf0, 0x19, 0x90, 0x17, 0x70, 0x15, 0x10, 0x13, 0xc9, 0x97, 0xd0, 0x0f, 0xc0, 0x58, 
-0xd0, 0x0b, 0xe0, 0xb3, 0xd0, 0x07, 0xad, 0x56, 0x05, 0xc9, 0x93, 0xf0, 0x04, 0xa9, 0x8d, 0x85, 
-0x00, 0xa9, 0xff, 0x85, 0x49, 0xa0, 0xff, 0xa2, 0xaa, 0xa9, 0x55, 0x24, 0x01, 0x18, 0x97, 0x4a, 
-0xea, 0xea, 0xea, 0xea, 0xf0, 0x18, 0xb0, 0x16, 0x50, 0x14, 0x10, 0x12, 0xc9, 0x55, 0xd0, 0x0e, 
-0xc0, 0xff, 0xd0, 0x0a, 0xe0, 0xaa, 0xd0, 0x06, 0xa5, 0x49, 0xc9, 0x00, 0xf0, 0x04, 0xa9, 0x8e, 
-0x85, 0x00, 0xa9, 0x00, 0x85, 0x56, 0xa0, 0x06, 0xa2, 0xef, 0xa9, 0x66, 0x38, 0xb8, 0x97, 0x50, 
-0xea, 0xea, 0xea, 0xea, 0xf0, 0x18, 0x90, 0x16, 0x70, 0x14, 0x30, 0x12, 0xc9, 0x66, 0xd0, 0x0e, 
-0xc0, 0x06, 0xd0, 0x0a, 0xe0, 0xef, 0xd0, 0x06, 0xa5, 0x56, 0xc9, 0x66, 0xf0, 0x04, 0xa9, 0x8f, 
-0x85, 0x00, 0x60, 0xa0, 0x90, 0x20, 0x31, 0xf9, 0xeb, 0x40, 0xea, 0xea, 0xea, 0xea, 0x20, 0x37, 
-0xf9, 0xc8, 0x20, 0x47, 0xf9, 0xeb, 0x3f, 0xea, 0xea, 0xea, 0xea, 0x20, 0x4c, 0xf9, 0xc8, 0x20, 
-0x5c, 0xf9, 0xeb, 0x41, 0xea, 0xea, 0xea, 0xea, 0x20, 0x62, 0xf9, 0xc8, 0x20, 0x72, 0xf9, 0xeb, 
-0x00, 0xea, 0xea, 0xea, 0xea, 0x20, 0x76, 0xf9, 0xc8, 0x20, 0x80, 0xf9, 0xeb, 0x7f, 0xea, 0xea, 
-0xea, 0xea, 0x20, 0x84, 0xf9, 0x60, 0xa9, 0xff, 0x85, 0x01, 0xa0, 0x95, 0xa2, 0x02, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x06, 0x85, 0x48, 0xa9, 0xeb, 0x8d, 0x47, 0x06, 0x20, 0x31, 0xfa, 0xc3, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x37, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xea, 0xf0, 0x02, 0x84, 0x00, 
-0xc8, 0xa9, 0x00, 0x8d, 0x47, 0x06, 0x20, 0x42, 0xfa, 0xc3, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0x47, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xff, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x06, 0x20, 0x54, 0xfa, 0xc3, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfa, 0xad, 0x47, 0x06, 
-0xc9, 0x36, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0xeb, 0x85, 0x47, 0x20, 0x31, 0xfa, 0xc7, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x37, 0xfa, 0xa5, 0x47, 0xc9, 0xea, 0xf0, 0x02, 0x84, 0x00, 0xc8, 
-0xa9, 0x00, 0x85, 0x47, 0x20, 0x42, 0xfa, 0xc7, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x47, 0xfa, 
-0xa5, 0x47, 0xc9, 0xff, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x54, 0xfa, 
-0xc7, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfa, 0xa5, 0x47, 0xc9, 0x36, 0xf0, 0x02, 0x84, 
-0x00, 0xc8, 0xa9, 0xeb, 0x8d, 0x47, 0x06, 0x20, 0x31, 0xfa, 0xcf, 0x47, 0x06, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x37, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xea, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x00, 
-0x8d, 0x47, 0x06, 0x20, 0x42, 0xfa, 0xcf, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0x47, 0xfa, 
-0xad, 0x47, 0x06, 0xc9, 0xff, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0x54, 0xfa, 0xcf, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfa, 0xad, 0x47, 0x06, 0xc9, 
-0x36, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xeb, 0x8d, 0x47, 0x06, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x05, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0x31, 0xfa, 0xd3, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0x9e, 0x68, 
-0x28, 0x20, 0x37, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xea, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x00, 0x8d, 0x47, 0x06, 0x20, 0x42, 0xfa, 0xd3, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0x9f, 0x68, 
-0x28, 0x20, 0x47, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xff, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0x54, 0xfa, 0xd3, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xa0, 0x68, 
-0x28, 0x20, 0x59, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x36, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xa1, 0xa2, 
-0xff, 0xa9, 0xeb, 0x85, 0x47, 0x20, 0x31, 0xfa, 0xd7, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x37, 
-0xfa, 0xa5, 0x47, 0xc9, 0xea, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x00, 0x85, 0x47, 0x20, 0x42, 
-0xfa, 0xd7, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x47, 0xfa, 0xa5, 0x47, 0xc9, 0xff, 0xf0, 0x02, 
-0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x54, 0xfa, 0xd7, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0x59, 0xfa, 0xa5, 0x47, 0xc9, 0x36, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xeb, 0x8d, 0x47, 0x06, 
-0xa0, 0xff, 0x20, 0x31, 0xfa, 0xdb, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xa4, 0x68, 0x28, 
-0x20, 0x37, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xea, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 0x00, 
-0x8d, 0x47, 0x06, 0x20, 0x42, 0xfa, 0xdb, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xa5, 0x68, 
-0x28, 0x20, 0x47, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xff, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0x54, 0xfa, 0xdb, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xa6, 
-0x68, 0x28, 0x20, 0x59, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x36, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xa7, 
-0xa2, 0xff, 0xa9, 0xeb, 0x8d, 0x47, 0x06, 0x20, 0x31, 0xfa, 0xdf, 0x48, 0x05, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x37, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xea, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x00, 
-0x8d, 0x47, 0x06, 0x20, 0x42, 0xfa, 0xdf, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0x47, 0xfa, 
-0xad, 0x47, 0x06, 0xc9, 0xff, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0x54, 0xfa, 0xdf, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfa, 0xad, 0x47, 0x06, 0xc9, 
-0x36, 0xf0, 0x02, 0x84, 0x00, 0x60, 0xa9, 0xff, 0x85, 0x01, 0xa0, 0xaa, 0xa2, 0x02, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x06, 0x85, 0x48, 0xa9, 0xeb, 0x8d, 0x47, 0x06, 0x20, 0xb1, 0xfa, 0xe3, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0xb7, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xec, 0xf0, 0x02, 0x84, 0x00, 
-0xc8, 0xa9, 0xff, 0x8d, 0x47, 0x06, 0x20, 0xc2, 0xfa, 0xe3, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0xc7, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x00, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x06, 0x20, 0xd4, 0xfa, 0xe3, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0xda, 0xfa, 0xad, 0x47, 0x06, 
-0xc9, 0x38, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0xeb, 0x85, 0x47, 0x20, 0xb1, 0xfa, 0xe7, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0xb7, 0xfa, 0xa5, 0x47, 0xc9, 0xec, 0xf0, 0x02, 0x84, 0x00, 0xc8, 
-0xa9, 0xff, 0x85, 0x47, 0x20, 0xc2, 0xfa, 0xe7, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0xc7, 0xfa, 
-0xa5, 0x47, 0xc9, 0x00, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0xd4, 0xfa, 
-0xe7, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0xda, 0xfa, 0xa5, 0x47, 0xc9, 0x38, 0xf0, 0x02, 0x84, 
-0x00, 0xc8, 0xa9, 0xeb, 0x8d, 0x47, 0x06, 0x20, 0xb1, 0xfa, 0xef, 0x47, 0x06, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0xb7, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xec, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0xff, 
-0x8d, 0x47, 0x06, 0x20, 0xc2, 0xfa, 0xef, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0xc7, 0xfa, 
-0xad, 0x47, 0x06, 0xc9, 0x00, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0xd4, 0xfa, 0xef, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0xda, 0xfa, 0xad, 0x47, 0x06, 0xc9, 
-0x38, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xeb, 0x8d, 0x47, 0x06, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x05, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0xb1, 0xfa, 0xf3, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xb3, 0x68, 
-0x28, 0x20, 0xb7, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xec, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0xff, 0x8d, 0x47, 0x06, 0x20, 0xc2, 0xfa, 0xf3, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xb4, 0x68, 
-0x28, 0x20, 0xc7, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x00, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0xd4, 0xfa, 0xf3, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xb5, 0x68, 
-0x28, 0x20, 0xda, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x38, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xb6, 0xa2, 
-0xff, 0xa9, 0xeb, 0x85, 0x47, 0x20, 0xb1, 0xfa, 0xf7, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0xb7, 
-0xfa, 0xa5, 0x47, 0xc9, 0xec, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0xff, 0x85, 0x47, 0x20, 0xc2, 
-0xfa, 0xf7, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0xc7, 0xfa, 0xa5, 0x47, 0xc9, 0x00, 0xf0, 0x02, 
-0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0xd4, 0xfa, 0xf7, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0xda, 0xfa, 0xa5, 0x47, 0xc9, 0x38, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xeb, 0x8d, 0x47, 0x06, 
-0xa0, 0xff, 0x20, 0xb1, 0xfa, 0xfb, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xb9, 0x68, 0x28, 
-0x20, 0xb7, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xec, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 0xff, 
-0x8d, 0x47, 0x06, 0x20, 0xc2, 0xfa, 0xfb, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xba, 0x68, 
-0x28, 0x20, 0xc7, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x00, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0xd4, 0xfa, 0xfb, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xbb, 
-0x68, 0x28, 0x20, 0xda, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x38, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xbc, 
-0xa2, 0xff, 0xa9, 0xeb, 0x8d, 0x47, 0x06, 0x20, 0xb1, 0xfa, 0xff, 0x48, 0x05, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0xb7, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0xec, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0xff, 
-0x8d, 0x47, 0x06, 0x20, 0xc2, 0xfa, 0xff, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0xc7, 0xfa, 
-0xad, 0x47, 0x06, 0xc9, 0x00, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0xd4, 0xfa, 0xff, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0xda, 0xfa, 0xad, 0x47, 0x06, 0xc9, 
-0x38, 0xf0, 0x02, 0x84, 0x00, 0x60, 0xa9, 0xff, 0x85, 0x01, 0xa0, 0xbf, 0xa2, 0x02, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x06, 0x85, 0x48, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0x7b, 0xfa, 0x03, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x81, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 
-0xc8, 0xa9, 0x29, 0x8d, 0x47, 0x06, 0x20, 0x8c, 0xfa, 0x03, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0x91, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x06, 0x20, 0x9e, 0xfa, 0x03, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0xa4, 0xfa, 0xad, 0x47, 0x06, 
-0xc9, 0x6e, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x7b, 0xfa, 0x07, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x81, 0xfa, 0xa5, 0x47, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xc8, 
-0xa9, 0x29, 0x85, 0x47, 0x20, 0x8c, 0xfa, 0x07, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x91, 0xfa, 
-0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x9e, 0xfa, 
-0x07, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0xa4, 0xfa, 0xa5, 0x47, 0xc9, 0x6e, 0xf0, 0x02, 0x84, 
-0x00, 0xc8, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0x7b, 0xfa, 0x0f, 0x47, 0x06, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x81, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0x8c, 0xfa, 0x0f, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0x91, 0xfa, 
-0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0x9e, 0xfa, 0x0f, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0xa4, 0xfa, 0xad, 0x47, 0x06, 0xc9, 
-0x6e, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x05, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0x7b, 0xfa, 0x13, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xc8, 0x68, 
-0x28, 0x20, 0x81, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x29, 0x8d, 0x47, 0x06, 0x20, 0x8c, 0xfa, 0x13, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xc9, 0x68, 
-0x28, 0x20, 0x91, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0x9e, 0xfa, 0x13, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xca, 0x68, 
-0x28, 0x20, 0xa4, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x6e, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xcb, 0xa2, 
-0xff, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x7b, 0xfa, 0x17, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x81, 
-0xfa, 0xa5, 0x47, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 0x85, 0x47, 0x20, 0x8c, 
-0xfa, 0x17, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x91, 0xfa, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x02, 
-0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x9e, 0xfa, 0x17, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0xa4, 0xfa, 0xa5, 0x47, 0xc9, 0x6e, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 
-0xa0, 0xff, 0x20, 0x7b, 0xfa, 0x1b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xce, 0x68, 0x28, 
-0x20, 0x81, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0x8c, 0xfa, 0x1b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xcf, 0x68, 
-0x28, 0x20, 0x91, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0x9e, 0xfa, 0x1b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xd0, 
-0x68, 0x28, 0x20, 0xa4, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x6e, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xd1, 
-0xa2, 0xff, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0x7b, 0xfa, 0x1f, 0x48, 0x05, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x81, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0x8c, 0xfa, 0x1f, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0x91, 0xfa, 
-0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0x9e, 0xfa, 0x1f, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0xa4, 0xfa, 0xad, 0x47, 0x06, 0xc9, 
-0x6e, 0xf0, 0x02, 0x84, 0x00, 0x60, 0xa9, 0xff, 0x85, 0x01, 0xa0, 0xd4, 0xa2, 0x02, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x06, 0x85, 0x48, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0x53, 0xfb, 0x23, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 
-0xc8, 0xa9, 0x29, 0x8d, 0x47, 0x06, 0x20, 0x64, 0xfb, 0x23, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0x69, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x06, 0x20, 0x68, 0xfa, 0x23, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0x6e, 0xfa, 0xad, 0x47, 0x06, 
-0xc9, 0x6f, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x53, 0xfb, 0x27, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 0xfb, 0xa5, 0x47, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xc8, 
-0xa9, 0x29, 0x85, 0x47, 0x20, 0x64, 0xfb, 0x27, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x69, 0xfb, 
-0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x68, 0xfa, 
-0x27, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x6e, 0xfa, 0xa5, 0x47, 0xc9, 0x6f, 0xf0, 0x02, 0x84, 
-0x00, 0xc8, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0x53, 0xfb, 0x2f, 0x47, 0x06, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x59, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0x64, 0xfb, 0x2f, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0x69, 0xfb, 
-0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0x68, 0xfa, 0x2f, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0x6e, 0xfa, 0xad, 0x47, 0x06, 0xc9, 
-0x6f, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x05, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0x53, 0xfb, 0x33, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xdd, 0x68, 
-0x28, 0x20, 0x59, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x29, 0x8d, 0x47, 0x06, 0x20, 0x64, 0xfb, 0x33, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xde, 0x68, 
-0x28, 0x20, 0x69, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0x68, 0xfa, 0x33, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xdf, 0x68, 
-0x28, 0x20, 0x6e, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x6f, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xe0, 0xa2, 
-0xff, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x53, 0xfb, 0x37, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x59, 
-0xfb, 0xa5, 0x47, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 0x85, 0x47, 0x20, 0x64, 
-0xfb, 0x37, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x69, 0xfb, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x02, 
-0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x68, 0xfa, 0x37, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0x6e, 0xfa, 0xa5, 0x47, 0xc9, 0x6f, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 
-0xa0, 0xff, 0x20, 0x53, 0xfb, 0x3b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xe3, 0x68, 0x28, 
-0x20, 0x59, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0x64, 0xfb, 0x3b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xe4, 0x68, 
-0x28, 0x20, 0x69, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0x68, 0xfa, 0x3b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xe5, 
-0x68, 0x28, 0x20, 0x6e, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x6f, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xe6, 
-0xa2, 0xff, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0x53, 0xfb, 0x3f, 0x48, 0x05, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x59, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x4a, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0x64, 0xfb, 0x3f, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0x69, 0xfb, 
-0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0x68, 0xfa, 0x3f, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0x6e, 0xfa, 0xad, 0x47, 0x06, 0xc9, 
-0x6f, 0xf0, 0x02, 0x84, 0x00, 0x60, 0xa9, 0xff, 0x85, 0x01, 0xa0, 0xe9, 0xa2, 0x02, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x06, 0x85, 0x48, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0x1d, 0xfb, 0x43, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x23, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 
-0xc8, 0xa9, 0x29, 0x8d, 0x47, 0x06, 0x20, 0x2e, 0xfb, 0x43, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0x33, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x06, 0x20, 0x40, 0xfb, 0x43, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0x46, 0xfb, 0xad, 0x47, 0x06, 
-0xc9, 0x1b, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x1d, 0xfb, 0x47, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0x23, 0xfb, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 
-0xa9, 0x29, 0x85, 0x47, 0x20, 0x2e, 0xfb, 0x47, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x33, 0xfb, 
-0xa5, 0x47, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x40, 0xfb, 
-0x47, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x46, 0xfb, 0xa5, 0x47, 0xc9, 0x1b, 0xf0, 0x02, 0x84, 
-0x00, 0xc8, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0x1d, 0xfb, 0x4f, 0x47, 0x06, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x23, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0x2e, 0xfb, 0x4f, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0x33, 0xfb, 
-0xad, 0x47, 0x06, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0x40, 0xfb, 0x4f, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0x46, 0xfb, 0xad, 0x47, 0x06, 0xc9, 
-0x1b, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x05, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0x1d, 0xfb, 0x53, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xf2, 0x68, 
-0x28, 0x20, 0x23, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x29, 0x8d, 0x47, 0x06, 0x20, 0x2e, 0xfb, 0x53, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xf3, 0x68, 
-0x28, 0x20, 0x33, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0x40, 0xfb, 0x53, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xf4, 0x68, 
-0x28, 0x20, 0x46, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x1b, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xf5, 0xa2, 
-0xff, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0x1d, 0xfb, 0x57, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x23, 
-0xfb, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 0x85, 0x47, 0x20, 0x2e, 
-0xfb, 0x57, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0x33, 0xfb, 0xa5, 0x47, 0xc9, 0x14, 0xf0, 0x02, 
-0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x40, 0xfb, 0x57, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0x46, 0xfb, 0xa5, 0x47, 0xc9, 0x1b, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 
-0xa0, 0xff, 0x20, 0x1d, 0xfb, 0x5b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xf8, 0x68, 0x28, 
-0x20, 0x23, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0x2e, 0xfb, 0x5b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xf9, 0x68, 
-0x28, 0x20, 0x33, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0x40, 0xfb, 0x5b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0xfa, 
-0x68, 0x28, 0x20, 0x46, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x1b, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xfb, 
-0xa2, 0xff, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0x1d, 0xfb, 0x5f, 0x48, 0x05, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0x23, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0x2e, 0xfb, 0x5f, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0x33, 0xfb, 
-0xad, 0x47, 0x06, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0x40, 0xfb, 0x5f, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0x46, 0xfb, 0xad, 0x47, 0x06, 0xc9, 
-0x1b, 0xf0, 0x02, 0x84, 0x00, 0x60, 0xa9, 0xff, 0x85, 0x01, 0xa0, 0x01, 0xa2, 0x02, 0xa9, 0x47, 
-0x85, 0x47, 0xa9, 0x06, 0x85, 0x48, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0xe9, 0xfa, 0x63, 0x45, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0xef, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 
-0xc8, 0xa9, 0x29, 0x8d, 0x47, 0x06, 0x20, 0xfa, 0xfa, 0x63, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 
-0xff, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 
-0x06, 0x20, 0x0a, 0xfb, 0x63, 0x45, 0xea, 0xea, 0xea, 0xea, 0x20, 0x10, 0xfb, 0xad, 0x47, 0x06, 
-0xc9, 0x9b, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0xe9, 0xfa, 0x67, 0x47, 
-0xea, 0xea, 0xea, 0xea, 0x20, 0xef, 0xfa, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 
-0xa9, 0x29, 0x85, 0x47, 0x20, 0xfa, 0xfa, 0x67, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0xff, 0xfa, 
-0xa5, 0x47, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x0a, 0xfb, 
-0x67, 0x47, 0xea, 0xea, 0xea, 0xea, 0x20, 0x10, 0xfb, 0xa5, 0x47, 0xc9, 0x9b, 0xf0, 0x02, 0x84, 
-0x00, 0xc8, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0xe9, 0xfa, 0x6f, 0x47, 0x06, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0xef, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0xfa, 0xfa, 0x6f, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0xff, 0xfa, 
-0xad, 0x47, 0x06, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0x0a, 0xfb, 0x6f, 0x47, 0x06, 0xea, 0xea, 0xea, 0xea, 0x20, 0x10, 0xfb, 0xad, 0x47, 0x06, 0xc9, 
-0x9b, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0xa9, 0x48, 0x85, 0x45, 0xa9, 0x05, 
-0x85, 0x46, 0xa0, 0xff, 0x20, 0xe9, 0xfa, 0x73, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0x0a, 0x68, 
-0x28, 0x20, 0xef, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x29, 0x8d, 0x47, 0x06, 0x20, 0xfa, 0xfa, 0x73, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0x0b, 0x68, 
-0x28, 0x20, 0xff, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0x0a, 0xfb, 0x73, 0x45, 0xea, 0xea, 0x08, 0x48, 0xa0, 0x0c, 0x68, 
-0x28, 0x20, 0x10, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x9b, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0x0d, 0xa2, 
-0xff, 0xa9, 0xa5, 0x85, 0x47, 0x20, 0xe9, 0xfa, 0x77, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0xef, 
-0xfa, 0xa5, 0x47, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 0x85, 0x47, 0x20, 0xfa, 
-0xfa, 0x77, 0x48, 0xea, 0xea, 0xea, 0xea, 0x20, 0xff, 0xfa, 0xa5, 0x47, 0xc9, 0x14, 0xf0, 0x02, 
-0x84, 0x00, 0xc8, 0xa9, 0x37, 0x85, 0x47, 0x20, 0x0a, 0xfb, 0x77, 0x48, 0xea, 0xea, 0xea, 0xea, 
-0x20, 0x10, 0xfb, 0xa5, 0x47, 0xc9, 0x9b, 0xf0, 0x02, 0x84, 0x00, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 
-0xa0, 0xff, 0x20, 0xe9, 0xfa, 0x7b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0x10, 0x68, 0x28, 
-0x20, 0xef, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0xfa, 0xfa, 0x7b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0x11, 0x68, 
-0x28, 0x20, 0xff, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0xff, 0xa9, 
-0x37, 0x8d, 0x47, 0x06, 0x20, 0x0a, 0xfb, 0x7b, 0x48, 0x05, 0xea, 0xea, 0x08, 0x48, 0xa0, 0x12, 
-0x68, 0x28, 0x20, 0x10, 0xfb, 0xad, 0x47, 0x06, 0xc9, 0x9b, 0xf0, 0x02, 0x84, 0x00, 0xa0, 0x13, 
-0xa2, 0xff, 0xa9, 0xa5, 0x8d, 0x47, 0x06, 0x20, 0xe9, 0xfa, 0x7f, 0x48, 0x05, 0xea, 0xea, 0xea, 
-0xea, 0x20, 0xef, 0xfa, 0xad, 0x47, 0x06, 0xc9, 0x52, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x29, 
-0x8d, 0x47, 0x06, 0x20, 0xfa, 0xfa, 0x7f, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0xff, 0xfa, 
-0xad, 0x47, 0x06, 0xc9, 0x14, 0xf0, 0x02, 0x84, 0x00, 0xc8, 0xa9, 0x37, 0x8d, 0x47, 0x06, 0x20, 
-0x0a, 0xfb, 0x7f, 0x48, 0x05, 0xea, 0xea, 0xea, 0xea, 0x20, 0x10, 0xfb, 0xad, 0x47, 0x06, 0xc9, 
-0x9b, 0xf0, 0x02, 0x84, 0x00, 0x60, 0x18, 0xa9, 0xff, 0x85, 0x01, 0x24, 0x01, 0xa9, 0x55, 0x60, 
-0xb0, 0x09, 0x10, 0x07, 0xc9, 0xff, 0xd0, 0x03, 0x50, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0xb8, 
-0xa9, 0x00, 0x60, 0xd0, 0x07, 0x70, 0x05, 0x90, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00, 0x60, 0x18, 
-0x24, 0x01, 0xa9, 0x55, 0x60, 0xd0, 0x07, 0x50, 0x05, 0xb0, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00, 
-0x60, 0x38, 0xb8, 0xa9, 0xf8, 0x60, 0x90, 0x09, 0x10, 0x07, 0xc9, 0xe8, 0xd0, 0x03, 0x70, 0x01, 
-0x60, 0x84, 0x00, 0x60, 0x18, 0x24, 0x01, 0xa9, 0x5f, 0x60, 0xb0, 0x09, 0x10, 0x07, 0xc9, 0xf5, 
-0xd0, 0x03, 0x50, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0xb8, 0xa9, 0x70, 0x60, 0xd0, 0x07, 0x70, 
-0x05, 0x90, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00, 0x60, 0x18, 0x24, 0x01, 0xa9, 0x00, 0x60, 0x30, 
-0x09, 0xb0, 0x07, 0xc9, 0x69, 0xd0, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0x24, 0x01, 
-0xa9, 0x00, 0x60, 0x30, 0x09, 0xb0, 0x07, 0xc9, 0x6a, 0xd0, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00, 
-0x60, 0x38, 0xb8, 0xa9, 0x7f, 0x60, 0x10, 0x09, 0xb0, 0x07, 0xc9, 0xff, 0xd0, 0x03, 0x50, 0x01, 
-0x60, 0x84, 0x00, 0x60, 0x18, 0x24, 0x01, 0xa9, 0x7f, 0x60, 0x10, 0x09, 0xb0, 0x07, 0xc9, 0xff, 
-0xd0, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0xb8, 0xa9, 0x7f, 0x60, 0xd0, 0x07, 0x30, 
-0x05, 0x70, 0x03, 0x90, 0x01, 0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0xa9, 0x40, 0x60, 0x30, 0x07, 
-0x90, 0x05, 0xd0, 0x03, 0x50, 0x01, 0x60, 0x84, 0x00, 0x60, 0xb8, 0x60, 0xf0, 0x07, 0x30, 0x05, 
-0x90, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00, 0x60, 0xf0, 0x05, 0x10, 0x03, 0x10, 0x01, 0x60, 0x84, 
-0x00, 0x60, 0xa9, 0x80, 0x60, 0xf0, 0x05, 0x10, 0x03, 0x90, 0x01, 0x60, 0x84, 0x00, 0x60, 0xd0, 
-0x05, 0x30, 0x03, 0x90, 0x01, 0x60, 0x84, 0x00, 0x60, 0xb0, 0x05, 0xf0, 0x03, 0x10, 0x01, 0x60, 
-0x84, 0x00, 0x60, 0x90, 0x05, 0xf0, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0xa0, 
-0x40, 0x60, 0x30, 0x07, 0x90, 0x05, 0xd0, 0x03, 0x50, 0x01, 0x60, 0x86, 0x00, 0x60, 0xb8, 0x60, 
-0xf0, 0x07, 0x30, 0x05, 0x90, 0x03, 0x70, 0x01, 0x60, 0x86, 0x00, 0x60, 0xf0, 0x05, 0x10, 0x03, 
-0x10, 0x01, 0x60, 0x86, 0x00, 0x60, 0xa0, 0x80, 0x60, 0xf0, 0x05, 0x10, 0x03, 0x90, 0x01, 0x60, 
-0x86, 0x00, 0x60, 0xd0, 0x05, 0x30, 0x03, 0x90, 0x01, 0x60, 0x86, 0x00, 0x60, 0xb0, 0x05, 0xf0, 
-0x03, 0x10, 0x01, 0x60, 0x86, 0x00, 0x60, 0x90, 0x05, 0xf0, 0x03, 0x30, 0x01, 0x60, 0x86, 0x00, 
-0x60, 0x24, 0x01, 0xa9, 0x40, 0x38, 0x60, 0x30, 0x0b, 0x90, 0x09, 0xd0, 0x07, 0x70, 0x05, 0xc9, 
-0x00, 0xd0, 0x01, 0x60, 0x84, 0x00, 0x60, 0xb8, 0x38, 0xa9, 0x40, 0x60, 0xf0, 0x0b, 0x30, 0x09, 
-0x90, 0x07, 0x70, 0x05, 0xc9, 0x01, 0xd0, 0x01, 0x60, 0x84, 0x00, 0x60, 0xa9, 0x40, 0x38, 0x24, 
-0x01, 0x60, 0xb0, 0x0b, 0xf0, 0x09, 0x10, 0x07, 0x70, 0x05, 0xc9, 0xff, 0xd0, 0x01, 0x60, 0x84, 
-0x00, 0x60, 0x18, 0xa9, 0x80, 0x60, 0x90, 0x05, 0xc9, 0x7f, 0xd0, 0x01, 0x60, 0x84, 0x00, 0x60, 
-0x38, 0xa9, 0x81, 0x60, 0x50, 0x07, 0x90, 0x05, 0xc9, 0x02, 0xd0, 0x01, 0x60, 0x84, 0x00, 0x60, 
-0xa2, 0x55, 0xa9, 0xff, 0x85, 0x01, 0xea, 0x24, 0x01, 0x38, 0xa9, 0x01, 0x60, 0x90, 0x1b, 0xd0, 
-0x19, 0x30, 0x17, 0x50, 0x15, 0xc9, 0x00, 0xd0, 0x11, 0xb8, 0xa9, 0xaa, 0x60, 0xb0, 0x0b, 0xf0, 
-0x09, 0x30, 0x07, 0x70, 0x05, 0xc9, 0x55, 0xd0, 0x01, 0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0x38, 
-0xa9, 0x80, 0x60, 0x90, 0x1c, 0xd0, 0x1a, 0x30, 0x18, 0x50, 0x16, 0xc9, 0x00, 0xd0, 0x12, 0xb8, 
-0xa9, 0x55, 0x38, 0x60, 0xb0, 0x0b, 0xf0, 0x09, 0x10, 0x07, 0x70, 0x05, 0xc9, 0xaa, 0xd0, 0x01, 
-0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0x38, 0xa9, 0x01, 0x60, 0x90, 0x1c, 0xf0, 0x1a, 0x10, 0x18, 
-0x50, 0x16, 0xc9, 0x80, 0xd0, 0x12, 0xb8, 0x18, 0xa9, 0x55, 0x60, 0x90, 0x0b, 0xf0, 0x09, 0x30, 
-0x07, 0x70, 0x05, 0xc9, 0x2a, 0xd0, 0x01, 0x60, 0x84, 0x00, 0x24, 0x01, 0x38, 0xa9, 0x80, 0x60, 
-0x90, 0x1c, 0xf0, 0x1a, 0x30, 0x18, 0x50, 0x16, 0xc9, 0x01, 0xd0, 0x12, 0xb8, 0x18, 0xa9, 0x55, 
-0x60, 0xb0, 0x0b, 0xf0, 0x09, 0x10, 0x07, 0x70, 0x05, 0xc9, 0xaa, 0xd0, 0x01, 0x60, 0x84, 0x00, 
-0x60, 0x24, 0x01, 0x18, 0xa9, 0x40, 0x60, 0x50, 0x2c, 0xb0, 0x2a, 0x30, 0x28, 0xc9, 0x40, 0xd0, 
-0x24, 0x60, 0xb8, 0x38, 0xa9, 0xff, 0x60, 0x70, 0x1c, 0xd0, 0x1a, 0x30, 0x18, 0x90, 0x16, 0xc9, 
-0xff, 0xd0, 0x12, 0x60, 0x24, 0x01, 0xa9, 0xf0, 0x60, 0x50, 0x0a, 0xf0, 0x08, 0x10, 0x06, 0x90, 
-0x04, 0xc9, 0xf0, 0xf0, 0x02, 0x84, 0x00, 0x60, 0x24, 0x01, 0x38, 0xa9, 0x75, 0x60, 0x50, 0x76, 
-0xf0, 0x74, 0x30, 0x72, 0xb0, 0x70, 0xc9, 0x65, 0xd0, 0x6c, 0x60, 0x24, 0x01, 0x18, 0xa9, 0xb3, 
-0x60, 0x50, 0x63, 0x90, 0x61, 0x10, 0x5f, 0xc9, 0xfb, 0xd0, 0x5b, 0x60, 0xb8, 0x18, 0xa9, 0xc3, 
-0x60, 0x70, 0x53, 0xf0, 0x51, 0x10, 0x4f, 0xb0, 0x4d, 0xc9, 0xd3, 0xd0, 0x49, 0x60, 0x24, 0x01, 
-0x38, 0xa9, 0x10, 0x60, 0x50, 0x40, 0xf0, 0x3e, 0x30, 0x3c, 0xb0, 0x3a, 0xc9, 0x7e, 0xd0, 0x36, 
-0x60, 0x24, 0x01, 0x18, 0xa9, 0x40, 0x60, 0x70, 0x2d, 0xb0, 0x2b, 0x30, 0x29, 0xc9, 0x53, 0xd0, 
-0x25, 0x60, 0xb8, 0x38, 0xa9, 0xff, 0x60, 0x70, 0x1d, 0xf0, 0x1b, 0x10, 0x19, 0x90, 0x17, 0xc9, 
-0xff, 0xd0, 0x13, 0x60, 0x24, 0x01, 0x38, 0xa9, 0xf0, 0x60, 0x70, 0x0a, 0xf0, 0x08, 0x10, 0x06, 
-0x90, 0x04, 0xc9, 0xb8, 0xf0, 0x02, 0x84, 0x00, 0x60, 0x24, 0x01, 0x18, 0xa9, 0xb2, 0x60, 0x70, 
-0x2a, 0x90, 0x28, 0x30, 0x26, 0xc9, 0x05, 0xd0, 0x22, 0x60, 0xb8, 0x18, 0xa9, 0x42, 0x60, 0x70, 
-0x1a, 0x30, 0x18, 0xb0, 0x16, 0xc9, 0x57, 0xd0, 0x12, 0x60, 0x24, 0x01, 0x38, 0xa9, 0x75, 0x60, 
-0x70, 0x09, 0x30, 0x07, 0x90, 0x05, 0xc9, 0x11, 0xd0, 0x01, 0x60, 0x85, 0x00, 0x24, 0x01, 0x18, 
-0xa9, 0xb3, 0x60, 0x50, 0x50, 0x90, 0x4e, 0x10, 0x4c, 0xc9, 0xe1, 0xd0, 0x48, 0x60, 0xb8, 0x18, 
-0xa9, 0x42, 0x60, 0x70, 0x40, 0xf0, 0x3e, 0x30, 0x3c, 0x90, 0x3a, 0xc9, 0x56, 0xd0, 0x36, 0x60, 
-0x24, 0x01, 0x38, 0xa9, 0x75, 0x60, 0x50, 0x2d, 0xf0, 0x2b, 0x30, 0x29, 0x90, 0x27, 0xc9, 0x6e, 
-0xd0, 0x23, 0x60, 0x24, 0x01, 0x18, 0xa9, 0xb3, 0x60, 0x50, 0x1a, 0x90, 0x18, 0x30, 0x16, 0xc9, 
-0x02, 0xd0, 0x12, 0x60, 0xb8, 0x18, 0xa9, 0x42, 0x60, 0x70, 0x0a, 0xf0, 0x08, 0x30, 0x06, 0xb0, 
-0x04, 0xc9, 0x42, 0xf0, 0x02, 0x84, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xff, 0x80, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xff, 0x01, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xfe, 0x00, 0xc0, 0xc0, 0xfe, 0x7c, 0x00, 
-0xfe, 0xfe, 0x00, 0xf0, 0xc0, 0xfe, 0xfe, 0x00, 0xc6, 0xc6, 0x02, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 
-0xcc, 0xd8, 0x00, 0xf0, 0xd8, 0xcc, 0xc6, 0x00, 0xc6, 0xee, 0x02, 0xd6, 0xc6, 0xc6, 0xc6, 0x00, 
-0xc6, 0xc6, 0x02, 0xd6, 0xce, 0xc6, 0xc6, 0x00, 0x7c, 0xfe, 0x02, 0xc6, 0xc6, 0xfe, 0x7c, 0x00, 
-0xfc, 0xfe, 0x02, 0xfc, 0xc0, 0xc0, 0xc0, 0x00, 0xcc, 0xcc, 0x00, 0x78, 0x30, 0x30, 0x30, 0x00, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xfc, 0xfe, 0x02, 0x06, 0x1c, 0x70, 0xfe, 0x00, 
-0xfc, 0xfe, 0x02, 0x3c, 0x3c, 0x02, 0xfe, 0x00, 0x18, 0x18, 0xd8, 0xd8, 0xfe, 0x18, 0x18, 0x00, 
-0xfe, 0xfe, 0x00, 0x80, 0xfc, 0x06, 0xfe, 0x00, 0x7c, 0xfe, 0x00, 0xc0, 0xfc, 0xc6, 0xfe, 0x00, 
-0xfe, 0xfe, 0x06, 0x0c, 0x18, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x33, 0x33, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x66, 0x66, 0xff, 0x66, 0xff, 0x66, 0x66, 0x00, 0x18, 0x3e, 0x60, 0x3c, 0x06, 0x7c, 0x18, 0x00, 
-0x62, 0x66, 0x0c, 0x18, 0x30, 0x66, 0x46, 0x00, 0x3c, 0x66, 0x3c, 0x38, 0x67, 0x66, 0x3f, 0x00, 
-0x0c, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0c, 0x00, 
-0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x00, 0x00, 
-0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 
-0x00, 0x00, 0x00, 0x6e, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 
-0x00, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x00, 0x3e, 0x63, 0x67, 0x6b, 0x73, 0x63, 0x3e, 0x00, 
-0x0c, 0x1c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x00, 0x3e, 0x63, 0x63, 0x0e, 0x38, 0x63, 0x7f, 0x00, 
-0x3e, 0x63, 0x63, 0x0e, 0x63, 0x63, 0x3e, 0x00, 0x06, 0x0e, 0x1e, 0x26, 0x7f, 0x06, 0x06, 0x00, 
-0x7f, 0x63, 0x60, 0x7e, 0x03, 0x63, 0x3e, 0x00, 0x3e, 0x63, 0x60, 0x7e, 0x63, 0x63, 0x3e, 0x00, 
-0x7f, 0x63, 0x06, 0x0c, 0x18, 0x18, 0x3c, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x63, 0x63, 0x3e, 0x00, 
-0x3e, 0x63, 0x63, 0x3f, 0x03, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 
-0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x30, 0x0e, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0e, 0x00, 
-0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x70, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x70, 0x00, 
-0x7e, 0x63, 0x03, 0x06, 0x1c, 0x00, 0x18, 0x18, 0x7c, 0xc6, 0xce, 0xee, 0xe0, 0xe6, 0x7c, 0x00, 
-0x1c, 0x36, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x00, 0x6e, 0x73, 0x63, 0x7e, 0x63, 0x63, 0x7e, 0x00, 
-0x1e, 0x33, 0x60, 0x60, 0x60, 0x33, 0x1e, 0x00, 0x6c, 0x76, 0x63, 0x63, 0x63, 0x66, 0x7c, 0x00, 
-0x7f, 0x31, 0x30, 0x3c, 0x30, 0x31, 0x7f, 0x00, 0x7f, 0x31, 0x30, 0x3c, 0x30, 0x30, 0x78, 0x00, 
-0x1e, 0x33, 0x60, 0x67, 0x63, 0x37, 0x1d, 0x00, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x00, 
-0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x1f, 0x06, 0x06, 0x06, 0x06, 0x66, 0x3c, 0x00, 
-0x66, 0x66, 0x6c, 0x78, 0x6c, 0x67, 0x63, 0x00, 0x78, 0x30, 0x60, 0x60, 0x63, 0x63, 0x7e, 0x00, 
-0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x00, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x63, 0x00, 
-0x1c, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x00, 0x6e, 0x73, 0x63, 0x7e, 0x60, 0x60, 0x60, 0x00, 
-0x1c, 0x36, 0x63, 0x6b, 0x67, 0x36, 0x1d, 0x00, 0x6e, 0x73, 0x63, 0x7e, 0x6c, 0x67, 0x63, 0x00, 
-0x3e, 0x63, 0x60, 0x3e, 0x03, 0x63, 0x3e, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 
-0x73, 0x33, 0x63, 0x63, 0x63, 0x76, 0x3c, 0x00, 0x73, 0x33, 0x63, 0x63, 0x66, 0x3c, 0x18, 0x00, 
-0x73, 0x33, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x00, 0x63, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x63, 0x00, 
-0x33, 0x63, 0x63, 0x36, 0x1c, 0x78, 0x70, 0x00, 0x7f, 0x63, 0x06, 0x1c, 0x33, 0x63, 0x7e, 0x00, 
-0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00, 0x40, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0x00, 
-0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x3f, 0x63, 0x63, 0x67, 0x3b, 0x00, 0x60, 0x60, 0x6e, 0x73, 0x63, 0x63, 0x3e, 0x00, 
-0x00, 0x00, 0x3e, 0x63, 0x60, 0x63, 0x3e, 0x00, 0x03, 0x03, 0x3b, 0x67, 0x63, 0x63, 0x3e, 0x00, 
-0x00, 0x00, 0x3e, 0x61, 0x7f, 0x60, 0x3e, 0x00, 0x0e, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x3c, 0x00, 
-0x00, 0x00, 0x3e, 0x60, 0x63, 0x63, 0x3d, 0x00, 0x60, 0x60, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x00, 
-0x00, 0x00, 0x1e, 0x0c, 0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x3f, 0x06, 0x06, 0x06, 0x66, 0x3c, 
-0x60, 0x60, 0x66, 0x6e, 0x7c, 0x67, 0x63, 0x00, 0x1c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e, 0x00, 
-0x00, 0x00, 0x6e, 0x7f, 0x6b, 0x62, 0x67, 0x00, 0x00, 0x00, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x00, 
-0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x73, 0x6e, 0x60, 0x60, 
-0x00, 0x00, 0x3e, 0x63, 0x67, 0x3b, 0x03, 0x03, 0x00, 0x00, 0x6e, 0x73, 0x63, 0x7e, 0x63, 0x00, 
-0x00, 0x00, 0x3e, 0x71, 0x1c, 0x47, 0x3e, 0x00, 0x06, 0x0c, 0x3f, 0x18, 0x18, 0x1b, 0x0e, 0x00, 
-0x00, 0x00, 0x73, 0x33, 0x63, 0x67, 0x3b, 0x00, 0x00, 0x00, 0x73, 0x33, 0x63, 0x66, 0x3c, 0x00, 
-0x00, 0x00, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x00, 0x00, 0x00, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x00, 
-0x00, 0x00, 0x33, 0x63, 0x63, 0x3f, 0x03, 0x3e, 0x00, 0x00, 0x7f, 0x0e, 0x1c, 0x38, 0x7f, 0x00, 
-0x3c, 0x42, 0x99, 0xa1, 0xa1, 0x99, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x06, 0x12, 0x33, 0x33, 0x06, 0x12, 0x33, 
-0x38, 0x06, 0x12, 0x33, 0x3a, 0x06, 0x12, 0x33, 0x0f, 0x06, 0x12, 0x33, 0x33, 0x06, 0x12, 0x33, 
-0x38, 0x06, 0x12, 0x33, 0x3a, 0x06, 0x12, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc5, 0x04, 0xc0, 0xf4, 0xc5, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0x80, 0xff, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0xff, 0x80, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x01, 0xff, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0xff, 0x01, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x7c, 0xfe, 0x00, 0xc0, 0xc0, 0xfe, 0x7c, 0x00, 0x7c, 0xfe, 0x00, 0xc0, 0xc0, 0xfe, 0x7c, 0x00, 
-0xfe, 0xfe, 0x00, 0xf0, 0xc0, 0xfe, 0xfe, 0x00, 0xfe, 0xfe, 0x00, 0xf0, 0xc0, 0xfe, 0xfe, 0x00, 
-0xc6, 0xc6, 0x02, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0xc6, 0xc6, 0x02, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 
-0xcc, 0xd8, 0x00, 0xf0, 0xd8, 0xcc, 0xc6, 0x00, 0xcc, 0xd8, 0x00, 0xf0, 0xd8, 0xcc, 0xc6, 0x00, 
-0xc6, 0xee, 0x02, 0xd6, 0xc6, 0xc6, 0xc6, 0x00, 0xc6, 0xee, 0x02, 0xd6, 0xc6, 0xc6, 0xc6, 0x00, 
-0xc6, 0xc6, 0x02, 0xd6, 0xce, 0xc6, 0xc6, 0x00, 0xc6, 0xc6, 0x02, 0xd6, 0xce, 0xc6, 0xc6, 0x00, 
-0x7c, 0xfe, 0x02, 0xc6, 0xc6, 0xfe, 0x7c, 0x00, 0x7c, 0xfe, 0x02, 0xc6, 0xc6, 0xfe, 0x7c, 0x00, 
-0xfc, 0xfe, 0x02, 0xfc, 0xc0, 0xc0, 0xc0, 0x00, 0xfc, 0xfe, 0x02, 0xfc, 0xc0, 0xc0, 0xc0, 0x00, 
-0xcc, 0xcc, 0x00, 0x78, 0x30, 0x30, 0x30, 0x00, 0xcc, 0xcc, 0x00, 0x78, 0x30, 0x30, 0x30, 0x00, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 
-0xfc, 0xfe, 0x02, 0x06, 0x1c, 0x70, 0xfe, 0x00, 0xfc, 0xfe, 0x02, 0x06, 0x1c, 0x70, 0xfe, 0x00, 
-0xfc, 0xfe, 0x02, 0x3c, 0x3c, 0x02, 0xfe, 0x00, 0xfc, 0xfe, 0x02, 0x3c, 0x3c, 0x02, 0xfe, 0x00, 
-0x18, 0x18, 0xd8, 0xd8, 0xfe, 0x18, 0x18, 0x00, 0x18, 0x18, 0xd8, 0xd8, 0xfe, 0x18, 0x18, 0x00, 
-0xfe, 0xfe, 0x00, 0x80, 0xfc, 0x06, 0xfe, 0x00, 0xfe, 0xfe, 0x00, 0x80, 0xfc, 0x06, 0xfe, 0x00, 
-0x7c, 0xfe, 0x00, 0xc0, 0xfc, 0xc6, 0xfe, 0x00, 0x7c, 0xfe, 0x00, 0xc0, 0xfc, 0xc6, 0xfe, 0x00, 
-0xfe, 0xfe, 0x06, 0x0c, 0x18, 0x10, 0x30, 0x00, 0xfe, 0xfe, 0x06, 0x0c, 0x18, 0x10, 0x30, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 
-0x33, 0x33, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x66, 0x66, 0xff, 0x66, 0xff, 0x66, 0x66, 0x00, 0x66, 0x66, 0xff, 0x66, 0xff, 0x66, 0x66, 0x00, 
-0x18, 0x3e, 0x60, 0x3c, 0x06, 0x7c, 0x18, 0x00, 0x18, 0x3e, 0x60, 0x3c, 0x06, 0x7c, 0x18, 0x00, 
-0x62, 0x66, 0x0c, 0x18, 0x30, 0x66, 0x46, 0x00, 0x62, 0x66, 0x0c, 0x18, 0x30, 0x66, 0x46, 0x00, 
-0x3c, 0x66, 0x3c, 0x38, 0x67, 0x66, 0x3f, 0x00, 0x3c, 0x66, 0x3c, 0x38, 0x67, 0x66, 0x3f, 0x00, 
-0x0c, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x0c, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0c, 0x00, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0c, 0x00, 
-0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x18, 0x30, 0x00, 0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x18, 0x30, 0x00, 
-0x00, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x00, 0x00, 0x00, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x00, 0x00, 
-0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 
-0x00, 0x00, 0x00, 0x6e, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x3b, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 
-0x00, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x00, 0x00, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x00, 
-0x3e, 0x63, 0x67, 0x6b, 0x73, 0x63, 0x3e, 0x00, 0x3e, 0x63, 0x67, 0x6b, 0x73, 0x63, 0x3e, 0x00, 
-0x0c, 0x1c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x00, 0x0c, 0x1c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x00, 
-0x3e, 0x63, 0x63, 0x0e, 0x38, 0x63, 0x7f, 0x00, 0x3e, 0x63, 0x63, 0x0e, 0x38, 0x63, 0x7f, 0x00, 
-0x3e, 0x63, 0x63, 0x0e, 0x63, 0x63, 0x3e, 0x00, 0x3e, 0x63, 0x63, 0x0e, 0x63, 0x63, 0x3e, 0x00, 
-0x06, 0x0e, 0x1e, 0x26, 0x7f, 0x06, 0x06, 0x00, 0x06, 0x0e, 0x1e, 0x26, 0x7f, 0x06, 0x06, 0x00, 
-0x7f, 0x63, 0x60, 0x7e, 0x03, 0x63, 0x3e, 0x00, 0x7f, 0x63, 0x60, 0x7e, 0x03, 0x63, 0x3e, 0x00, 
-0x3e, 0x63, 0x60, 0x7e, 0x63, 0x63, 0x3e, 0x00, 0x3e, 0x63, 0x60, 0x7e, 0x63, 0x63, 0x3e, 0x00, 
-0x7f, 0x63, 0x06, 0x0c, 0x18, 0x18, 0x3c, 0x00, 0x7f, 0x63, 0x06, 0x0c, 0x18, 0x18, 0x3c, 0x00, 
-0x3e, 0x63, 0x63, 0x3e, 0x63, 0x63, 0x3e, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x63, 0x63, 0x3e, 0x00, 
-0x3e, 0x63, 0x63, 0x3f, 0x03, 0x63, 0x3e, 0x00, 0x3e, 0x63, 0x63, 0x3f, 0x03, 0x63, 0x3e, 0x00, 
-0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 
-0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x30, 
-0x0e, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0e, 0x00, 0x0e, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0e, 0x00, 
-0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 
-0x70, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x70, 0x00, 0x70, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x70, 0x00, 
-0x7e, 0x63, 0x03, 0x06, 0x1c, 0x00, 0x18, 0x18, 0x7e, 0x63, 0x03, 0x06, 0x1c, 0x00, 0x18, 0x18, 
-0x7c, 0xc6, 0xce, 0xee, 0xe0, 0xe6, 0x7c, 0x00, 0x7c, 0xc6, 0xce, 0xee, 0xe0, 0xe6, 0x7c, 0x00, 
-0x1c, 0x36, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x00, 0x1c, 0x36, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x00, 
-0x6e, 0x73, 0x63, 0x7e, 0x63, 0x63, 0x7e, 0x00, 0x6e, 0x73, 0x63, 0x7e, 0x63, 0x63, 0x7e, 0x00, 
-0x1e, 0x33, 0x60, 0x60, 0x60, 0x33, 0x1e, 0x00, 0x1e, 0x33, 0x60, 0x60, 0x60, 0x33, 0x1e, 0x00, 
-0x6c, 0x76, 0x63, 0x63, 0x63, 0x66, 0x7c, 0x00, 0x6c, 0x76, 0x63, 0x63, 0x63, 0x66, 0x7c, 0x00, 
-0x7f, 0x31, 0x30, 0x3c, 0x30, 0x31, 0x7f, 0x00, 0x7f, 0x31, 0x30, 0x3c, 0x30, 0x31, 0x7f, 0x00, 
-0x7f, 0x31, 0x30, 0x3c, 0x30, 0x30, 0x78, 0x00, 0x7f, 0x31, 0x30, 0x3c, 0x30, 0x30, 0x78, 0x00, 
-0x1e, 0x33, 0x60, 0x67, 0x63, 0x37, 0x1d, 0x00, 0x1e, 0x33, 0x60, 0x67, 0x63, 0x37, 0x1d, 0x00, 
-0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x00, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x00, 
-0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 
-0x1f, 0x06, 0x06, 0x06, 0x06, 0x66, 0x3c, 0x00, 0x1f, 0x06, 0x06, 0x06, 0x06, 0x66, 0x3c, 0x00, 
-0x66, 0x66, 0x6c, 0x78, 0x6c, 0x67, 0x63, 0x00, 0x66, 0x66, 0x6c, 0x78, 0x6c, 0x67, 0x63, 0x00, 
-0x78, 0x30, 0x60, 0x60, 0x63, 0x63, 0x7e, 0x00, 0x78, 0x30, 0x60, 0x60, 0x63, 0x63, 0x7e, 0x00, 
-0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x00, 0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x00, 
-0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x63, 0x00, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x63, 0x00, 
-0x1c, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x00, 0x1c, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x00, 
-0x6e, 0x73, 0x63, 0x7e, 0x60, 0x60, 0x60, 0x00, 0x6e, 0x73, 0x63, 0x7e, 0x60, 0x60, 0x60, 0x00, 
-0x1c, 0x36, 0x63, 0x6b, 0x67, 0x36, 0x1d, 0x00, 0x1c, 0x36, 0x63, 0x6b, 0x67, 0x36, 0x1d, 0x00, 
-0x6e, 0x73, 0x63, 0x7e, 0x6c, 0x67, 0x63, 0x00, 0x6e, 0x73, 0x63, 0x7e, 0x6c, 0x67, 0x63, 0x00, 
-0x3e, 0x63, 0x60, 0x3e, 0x03, 0x63, 0x3e, 0x00, 0x3e, 0x63, 0x60, 0x3e, 0x03, 0x63, 0x3e, 0x00, 
-0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 
-0x73, 0x33, 0x63, 0x63, 0x63, 0x76, 0x3c, 0x00, 0x73, 0x33, 0x63, 0x63, 0x63, 0x76, 0x3c, 0x00, 
-0x73, 0x33, 0x63, 0x63, 0x66, 0x3c, 0x18, 0x00, 0x73, 0x33, 0x63, 0x63, 0x66, 0x3c, 0x18, 0x00, 
-0x73, 0x33, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x00, 0x73, 0x33, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x00, 
-0x63, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x63, 0x00, 0x63, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x63, 0x00, 
-0x33, 0x63, 0x63, 0x36, 0x1c, 0x78, 0x70, 0x00, 0x33, 0x63, 0x63, 0x36, 0x1c, 0x78, 0x70, 0x00, 
-0x7f, 0x63, 0x06, 0x1c, 0x33, 0x63, 0x7e, 0x00, 0x7f, 0x63, 0x06, 0x1c, 0x33, 0x63, 0x7e, 0x00, 
-0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00, 
-0x40, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0x00, 0x40, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0x00, 
-0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x00, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x00, 
-0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x3f, 0x63, 0x63, 0x67, 0x3b, 0x00, 0x00, 0x00, 0x3f, 0x63, 0x63, 0x67, 0x3b, 0x00, 
-0x60, 0x60, 0x6e, 0x73, 0x63, 0x63, 0x3e, 0x00, 0x60, 0x60, 0x6e, 0x73, 0x63, 0x63, 0x3e, 0x00, 
-0x00, 0x00, 0x3e, 0x63, 0x60, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x60, 0x63, 0x3e, 0x00, 
-0x03, 0x03, 0x3b, 0x67, 0x63, 0x63, 0x3e, 0x00, 0x03, 0x03, 0x3b, 0x67, 0x63, 0x63, 0x3e, 0x00, 
-0x00, 0x00, 0x3e, 0x61, 0x7f, 0x60, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x61, 0x7f, 0x60, 0x3e, 0x00, 
-0x0e, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x3c, 0x00, 0x0e, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x3c, 0x00, 
-0x00, 0x00, 0x3e, 0x60, 0x63, 0x63, 0x3d, 0x00, 0x00, 0x00, 0x3e, 0x60, 0x63, 0x63, 0x3d, 0x00, 
-0x60, 0x60, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x00, 0x60, 0x60, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x00, 
-0x00, 0x00, 0x1e, 0x0c, 0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x0c, 0x0c, 0x0c, 0x1e, 0x00, 
-0x00, 0x00, 0x3f, 0x06, 0x06, 0x06, 0x66, 0x3c, 0x00, 0x00, 0x3f, 0x06, 0x06, 0x06, 0x66, 0x3c, 
-0x60, 0x60, 0x66, 0x6e, 0x7c, 0x67, 0x63, 0x00, 0x60, 0x60, 0x66, 0x6e, 0x7c, 0x67, 0x63, 0x00, 
-0x1c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e, 0x00, 0x1c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e, 0x00, 
-0x00, 0x00, 0x6e, 0x7f, 0x6b, 0x62, 0x67, 0x00, 0x00, 0x00, 0x6e, 0x7f, 0x6b, 0x62, 0x67, 0x00, 
-0x00, 0x00, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x00, 0x00, 0x00, 0x6e, 0x73, 0x63, 0x66, 0x67, 0x00, 
-0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x00, 
-0x00, 0x00, 0x3e, 0x63, 0x73, 0x6e, 0x60, 0x60, 0x00, 0x00, 0x3e, 0x63, 0x73, 0x6e, 0x60, 0x60, 
-0x00, 0x00, 0x3e, 0x63, 0x67, 0x3b, 0x03, 0x03, 0x00, 0x00, 0x3e, 0x63, 0x67, 0x3b, 0x03, 0x03, 
-0x00, 0x00, 0x6e, 0x73, 0x63, 0x7e, 0x63, 0x00, 0x00, 0x00, 0x6e, 0x73, 0x63, 0x7e, 0x63, 0x00, 
-0x00, 0x00, 0x3e, 0x71, 0x1c, 0x47, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x71, 0x1c, 0x47, 0x3e, 0x00, 
-0x06, 0x0c, 0x3f, 0x18, 0x18, 0x1b, 0x0e, 0x00, 0x06, 0x0c, 0x3f, 0x18, 0x18, 0x1b, 0x0e, 0x00, 
-0x00, 0x00, 0x73, 0x33, 0x63, 0x67, 0x3b, 0x00, 0x00, 0x00, 0x73, 0x33, 0x63, 0x67, 0x3b, 0x00, 
-0x00, 0x00, 0x73, 0x33, 0x63, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x73, 0x33, 0x63, 0x66, 0x3c, 0x00, 
-0x00, 0x00, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x00, 0x00, 0x00, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x00, 
-0x00, 0x00, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x00, 0x00, 0x00, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x00, 
-0x00, 0x00, 0x33, 0x63, 0x63, 0x3f, 0x03, 0x3e, 0x00, 0x00, 0x33, 0x63, 0x63, 0x3f, 0x03, 0x3e, 
-0x00, 0x00, 0x7f, 0x0e, 0x1c, 0x38, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x0e, 0x1c, 0x38, 0x7f, 0x00, 
-0x3c, 0x42, 0x99, 0xa1, 0xa1, 0x99, 0x42, 0x3c, 0x3c, 0x42, 0x99, 0xa1, 0xa1, 0x99, 0x42, 0x3c, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-};
@@ -1,9000 +0,0 @@
-// machine generated, do not edit!
-#include <stdint.h>
-typedef struct {
-    const char* desc;
-    uint16_t PC;
-    uint8_t A,X,Y,P,S;
-} cpu_state;
-cpu_state state_table[] = {
-  { "JMP $C5F5                       ", 0xC000, 0x00, 0x00, 0x00, 0x24, 0xFD },
-  { "LDX #$00                        ", 0xC5F5, 0x00, 0x00, 0x00, 0x24, 0xFD },
-  { "STX $00 = 00                    ", 0xC5F7, 0x00, 0x00, 0x00, 0x26, 0xFD },
-  { "STX $10 = 00                    ", 0xC5F9, 0x00, 0x00, 0x00, 0x26, 0xFD },
-  { "STX $11 = 00                    ", 0xC5FB, 0x00, 0x00, 0x00, 0x26, 0xFD },
-  { "JSR $C72D                       ", 0xC5FD, 0x00, 0x00, 0x00, 0x26, 0xFD },
-  { "NOP                             ", 0xC72D, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "SEC                             ", 0xC72E, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "BCS $C735                       ", 0xC72F, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "NOP                             ", 0xC735, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "CLC                             ", 0xC736, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "BCS $C73C                       ", 0xC737, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "JMP $C740                       ", 0xC739, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "NOP                             ", 0xC740, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "SEC                             ", 0xC741, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "BCC $C747                       ", 0xC742, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "JMP $C74B                       ", 0xC744, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "NOP                             ", 0xC74B, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "CLC                             ", 0xC74C, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "BCC $C753                       ", 0xC74D, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "NOP                             ", 0xC753, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "LDA #$00                        ", 0xC754, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "BEQ $C75C                       ", 0xC756, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "NOP                             ", 0xC75C, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "LDA #$40                        ", 0xC75D, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "BEQ $C764                       ", 0xC75F, 0x40, 0x00, 0x00, 0x24, 0xFB },
-  { "JMP $C768                       ", 0xC761, 0x40, 0x00, 0x00, 0x24, 0xFB },
-  { "NOP                             ", 0xC768, 0x40, 0x00, 0x00, 0x24, 0xFB },
-  { "LDA #$40                        ", 0xC769, 0x40, 0x00, 0x00, 0x24, 0xFB },
-  { "BNE $C771                       ", 0xC76B, 0x40, 0x00, 0x00, 0x24, 0xFB },
-  { "NOP                             ", 0xC771, 0x40, 0x00, 0x00, 0x24, 0xFB },
-  { "LDA #$00                        ", 0xC772, 0x40, 0x00, 0x00, 0x24, 0xFB },
-  { "BNE $C779                       ", 0xC774, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "JMP $C77D                       ", 0xC776, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "NOP                             ", 0xC77D, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "LDA #$FF                        ", 0xC77E, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "STA $01 = 00                    ", 0xC780, 0xFF, 0x00, 0x00, 0xA4, 0xFB },
-  { "BIT $01 = FF                    ", 0xC782, 0xFF, 0x00, 0x00, 0xA4, 0xFB },
-  { "BVS $C78A                       ", 0xC784, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "NOP                             ", 0xC78A, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "BIT $01 = FF                    ", 0xC78B, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "BVC $C792                       ", 0xC78D, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "JMP $C796                       ", 0xC78F, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "NOP                             ", 0xC796, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "LDA #$00                        ", 0xC797, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "STA $01 = FF                    ", 0xC799, 0x00, 0x00, 0x00, 0x66, 0xFB },
-  { "BIT $01 = 00                    ", 0xC79B, 0x00, 0x00, 0x00, 0x66, 0xFB },
-  { "BVC $C7A3                       ", 0xC79D, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "NOP                             ", 0xC7A3, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "BIT $01 = 00                    ", 0xC7A4, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "BVS $C7AB                       ", 0xC7A6, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "JMP $C7AF                       ", 0xC7A8, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "NOP                             ", 0xC7AF, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "LDA #$00                        ", 0xC7B0, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "BPL $C7B8                       ", 0xC7B2, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "NOP                             ", 0xC7B8, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "LDA #$80                        ", 0xC7B9, 0x00, 0x00, 0x00, 0x26, 0xFB },
-  { "BPL $C7C0                       ", 0xC7BB, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "JMP $C7D9                       ", 0xC7BD, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "NOP                             ", 0xC7D9, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "RTS                             ", 0xC7DA, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "JSR $C7DB                       ", 0xC600, 0x80, 0x00, 0x00, 0xA4, 0xFD },
-  { "NOP                             ", 0xC7DB, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "LDA #$FF                        ", 0xC7DC, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "STA $01 = 00                    ", 0xC7DE, 0xFF, 0x00, 0x00, 0xA4, 0xFB },
-  { "BIT $01 = FF                    ", 0xC7E0, 0xFF, 0x00, 0x00, 0xA4, 0xFB },
-  { "LDA #$00                        ", 0xC7E2, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "SEC                             ", 0xC7E4, 0x00, 0x00, 0x00, 0x66, 0xFB },
-  { "SEI                             ", 0xC7E5, 0x00, 0x00, 0x00, 0x67, 0xFB },
-  { "SED                             ", 0xC7E6, 0x00, 0x00, 0x00, 0x67, 0xFB },
-  { "PHP                             ", 0xC7E7, 0x00, 0x00, 0x00, 0x6F, 0xFB },
-  { "PLA                             ", 0xC7E8, 0x00, 0x00, 0x00, 0x6F, 0xFA },
-  { "AND #$EF                        ", 0xC7E9, 0x7F, 0x00, 0x00, 0x6D, 0xFB },
-  { "CMP #$6F                        ", 0xC7EB, 0x6F, 0x00, 0x00, 0x6D, 0xFB },
-  { "BEQ $C7F3                       ", 0xC7ED, 0x6F, 0x00, 0x00, 0x6F, 0xFB },
-  { "NOP                             ", 0xC7F3, 0x6F, 0x00, 0x00, 0x6F, 0xFB },
-  { "LDA #$40                        ", 0xC7F4, 0x6F, 0x00, 0x00, 0x6F, 0xFB },
-  { "STA $01 = FF                    ", 0xC7F6, 0x40, 0x00, 0x00, 0x6D, 0xFB },
-  { "BIT $01 = 40                    ", 0xC7F8, 0x40, 0x00, 0x00, 0x6D, 0xFB },
-  { "CLD                             ", 0xC7FA, 0x40, 0x00, 0x00, 0x6D, 0xFB },
-  { "LDA #$10                        ", 0xC7FB, 0x40, 0x00, 0x00, 0x65, 0xFB },
-  { "CLC                             ", 0xC7FD, 0x10, 0x00, 0x00, 0x65, 0xFB },
-  { "PHP                             ", 0xC7FE, 0x10, 0x00, 0x00, 0x64, 0xFB },
-  { "PLA                             ", 0xC7FF, 0x10, 0x00, 0x00, 0x64, 0xFA },
-  { "AND #$EF                        ", 0xC800, 0x74, 0x00, 0x00, 0x64, 0xFB },
-  { "CMP #$64                        ", 0xC802, 0x64, 0x00, 0x00, 0x64, 0xFB },
-  { "BEQ $C80A                       ", 0xC804, 0x64, 0x00, 0x00, 0x67, 0xFB },
-  { "NOP                             ", 0xC80A, 0x64, 0x00, 0x00, 0x67, 0xFB },
-  { "LDA #$80                        ", 0xC80B, 0x64, 0x00, 0x00, 0x67, 0xFB },
-  { "STA $01 = 40                    ", 0xC80D, 0x80, 0x00, 0x00, 0xE5, 0xFB },
-  { "BIT $01 = 80                    ", 0xC80F, 0x80, 0x00, 0x00, 0xE5, 0xFB },
-  { "SED                             ", 0xC811, 0x80, 0x00, 0x00, 0xA5, 0xFB },
-  { "LDA #$00                        ", 0xC812, 0x80, 0x00, 0x00, 0xAD, 0xFB },
-  { "SEC                             ", 0xC814, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "PHP                             ", 0xC815, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "PLA                             ", 0xC816, 0x00, 0x00, 0x00, 0x2F, 0xFA },
-  { "AND #$EF                        ", 0xC817, 0x3F, 0x00, 0x00, 0x2D, 0xFB },
-  { "CMP #$2F                        ", 0xC819, 0x2F, 0x00, 0x00, 0x2D, 0xFB },
-  { "BEQ $C821                       ", 0xC81B, 0x2F, 0x00, 0x00, 0x2F, 0xFB },
-  { "NOP                             ", 0xC821, 0x2F, 0x00, 0x00, 0x2F, 0xFB },
-  { "LDA #$FF                        ", 0xC822, 0x2F, 0x00, 0x00, 0x2F, 0xFB },
-  { "PHA                             ", 0xC824, 0xFF, 0x00, 0x00, 0xAD, 0xFB },
-  { "PLP                             ", 0xC825, 0xFF, 0x00, 0x00, 0xAD, 0xFA },
-  { "BNE $C831                       ", 0xC826, 0xFF, 0x00, 0x00, 0xEF, 0xFB },
-  { "BPL $C831                       ", 0xC828, 0xFF, 0x00, 0x00, 0xEF, 0xFB },
-  { "BVC $C831                       ", 0xC82A, 0xFF, 0x00, 0x00, 0xEF, 0xFB },
-  { "BCC $C831                       ", 0xC82C, 0xFF, 0x00, 0x00, 0xEF, 0xFB },
-  { "JMP $C835                       ", 0xC82E, 0xFF, 0x00, 0x00, 0xEF, 0xFB },
-  { "NOP                             ", 0xC835, 0xFF, 0x00, 0x00, 0xEF, 0xFB },
-  { "LDA #$04                        ", 0xC836, 0xFF, 0x00, 0x00, 0xEF, 0xFB },
-  { "PHA                             ", 0xC838, 0x04, 0x00, 0x00, 0x6D, 0xFB },
-  { "PLP                             ", 0xC839, 0x04, 0x00, 0x00, 0x6D, 0xFA },
-  { "BEQ $C845                       ", 0xC83A, 0x04, 0x00, 0x00, 0x24, 0xFB },
-  { "BMI $C845                       ", 0xC83C, 0x04, 0x00, 0x00, 0x24, 0xFB },
-  { "BVS $C845                       ", 0xC83E, 0x04, 0x00, 0x00, 0x24, 0xFB },
-  { "BCS $C845                       ", 0xC840, 0x04, 0x00, 0x00, 0x24, 0xFB },
-  { "JMP $C849                       ", 0xC842, 0x04, 0x00, 0x00, 0x24, 0xFB },
-  { "NOP                             ", 0xC849, 0x04, 0x00, 0x00, 0x24, 0xFB },
-  { "SED                             ", 0xC84A, 0x04, 0x00, 0x00, 0x24, 0xFB },
-  { "LDA #$FF                        ", 0xC84B, 0x04, 0x00, 0x00, 0x2C, 0xFB },
-  { "STA $01 = 80                    ", 0xC84D, 0xFF, 0x00, 0x00, 0xAC, 0xFB },
-  { "BIT $01 = FF                    ", 0xC84F, 0xFF, 0x00, 0x00, 0xAC, 0xFB },
-  { "CLC                             ", 0xC851, 0xFF, 0x00, 0x00, 0xEC, 0xFB },
-  { "LDA #$00                        ", 0xC852, 0xFF, 0x00, 0x00, 0xEC, 0xFB },
-  { "PHA                             ", 0xC854, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "LDA #$FF                        ", 0xC855, 0x00, 0x00, 0x00, 0x6E, 0xFA },
-  { "PLA                             ", 0xC857, 0xFF, 0x00, 0x00, 0xEC, 0xFA },
-  { "BNE $C863                       ", 0xC858, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "BMI $C863                       ", 0xC85A, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "BVC $C863                       ", 0xC85C, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "BCS $C863                       ", 0xC85E, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "JMP $C867                       ", 0xC860, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "NOP                             ", 0xC867, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "LDA #$00                        ", 0xC868, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "STA $01 = FF                    ", 0xC86A, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "BIT $01 = 00                    ", 0xC86C, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "SEC                             ", 0xC86E, 0x00, 0x00, 0x00, 0x2E, 0xFB },
-  { "LDA #$FF                        ", 0xC86F, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "PHA                             ", 0xC871, 0xFF, 0x00, 0x00, 0xAD, 0xFB },
-  { "LDA #$00                        ", 0xC872, 0xFF, 0x00, 0x00, 0xAD, 0xFA },
-  { "PLA                             ", 0xC874, 0x00, 0x00, 0x00, 0x2F, 0xFA },
-  { "BEQ $C880                       ", 0xC875, 0xFF, 0x00, 0x00, 0xAD, 0xFB },
-  { "BPL $C880                       ", 0xC877, 0xFF, 0x00, 0x00, 0xAD, 0xFB },
-  { "BVS $C880                       ", 0xC879, 0xFF, 0x00, 0x00, 0xAD, 0xFB },
-  { "BCC $C880                       ", 0xC87B, 0xFF, 0x00, 0x00, 0xAD, 0xFB },
-  { "JMP $C884                       ", 0xC87D, 0xFF, 0x00, 0x00, 0xAD, 0xFB },
-  { "RTS                             ", 0xC884, 0xFF, 0x00, 0x00, 0xAD, 0xFB },
-  { "JSR $C885                       ", 0xC603, 0xFF, 0x00, 0x00, 0xAD, 0xFD },
-  { "NOP                             ", 0xC885, 0xFF, 0x00, 0x00, 0xAD, 0xFB },
-  { "CLC                             ", 0xC886, 0xFF, 0x00, 0x00, 0xAD, 0xFB },
-  { "LDA #$FF                        ", 0xC887, 0xFF, 0x00, 0x00, 0xAC, 0xFB },
-  { "STA $01 = 00                    ", 0xC889, 0xFF, 0x00, 0x00, 0xAC, 0xFB },
-  { "BIT $01 = FF                    ", 0xC88B, 0xFF, 0x00, 0x00, 0xAC, 0xFB },
-  { "LDA #$55                        ", 0xC88D, 0xFF, 0x00, 0x00, 0xEC, 0xFB },
-  { "ORA #$AA                        ", 0xC88F, 0x55, 0x00, 0x00, 0x6C, 0xFB },
-  { "BCS $C89E                       ", 0xC891, 0xFF, 0x00, 0x00, 0xEC, 0xFB },
-  { "BPL $C89E                       ", 0xC893, 0xFF, 0x00, 0x00, 0xEC, 0xFB },
-  { "CMP #$FF                        ", 0xC895, 0xFF, 0x00, 0x00, 0xEC, 0xFB },
-  { "BNE $C89E                       ", 0xC897, 0xFF, 0x00, 0x00, 0x6F, 0xFB },
-  { "BVC $C89E                       ", 0xC899, 0xFF, 0x00, 0x00, 0x6F, 0xFB },
-  { "JMP $C8A2                       ", 0xC89B, 0xFF, 0x00, 0x00, 0x6F, 0xFB },
-  { "NOP                             ", 0xC8A2, 0xFF, 0x00, 0x00, 0x6F, 0xFB },
-  { "SEC                             ", 0xC8A3, 0xFF, 0x00, 0x00, 0x6F, 0xFB },
-  { "CLV                             ", 0xC8A4, 0xFF, 0x00, 0x00, 0x6F, 0xFB },
-  { "LDA #$00                        ", 0xC8A5, 0xFF, 0x00, 0x00, 0x2F, 0xFB },
-  { "ORA #$00                        ", 0xC8A7, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "BNE $C8B4                       ", 0xC8A9, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "BVS $C8B4                       ", 0xC8AB, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "BCC $C8B4                       ", 0xC8AD, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "BMI $C8B4                       ", 0xC8AF, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "JMP $C8B8                       ", 0xC8B1, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "NOP                             ", 0xC8B8, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "CLC                             ", 0xC8B9, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "BIT $01 = FF                    ", 0xC8BA, 0x00, 0x00, 0x00, 0x2E, 0xFB },
-  { "LDA #$55                        ", 0xC8BC, 0x00, 0x00, 0x00, 0xEE, 0xFB },
-  { "AND #$AA                        ", 0xC8BE, 0x55, 0x00, 0x00, 0x6C, 0xFB },
-  { "BNE $C8CB                       ", 0xC8C0, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "BVC $C8CB                       ", 0xC8C2, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "BCS $C8CB                       ", 0xC8C4, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "BMI $C8CB                       ", 0xC8C6, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "JMP $C8CF                       ", 0xC8C8, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "NOP                             ", 0xC8CF, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "SEC                             ", 0xC8D0, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "CLV                             ", 0xC8D1, 0x00, 0x00, 0x00, 0x6F, 0xFB },
-  { "LDA #$F8                        ", 0xC8D2, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "AND #$EF                        ", 0xC8D4, 0xF8, 0x00, 0x00, 0xAD, 0xFB },
-  { "BCC $C8E3                       ", 0xC8D6, 0xE8, 0x00, 0x00, 0xAD, 0xFB },
-  { "BPL $C8E3                       ", 0xC8D8, 0xE8, 0x00, 0x00, 0xAD, 0xFB },
-  { "CMP #$E8                        ", 0xC8DA, 0xE8, 0x00, 0x00, 0xAD, 0xFB },
-  { "BNE $C8E3                       ", 0xC8DC, 0xE8, 0x00, 0x00, 0x2F, 0xFB },
-  { "BVS $C8E3                       ", 0xC8DE, 0xE8, 0x00, 0x00, 0x2F, 0xFB },
-  { "JMP $C8E7                       ", 0xC8E0, 0xE8, 0x00, 0x00, 0x2F, 0xFB },
-  { "NOP                             ", 0xC8E7, 0xE8, 0x00, 0x00, 0x2F, 0xFB },
-  { "CLC                             ", 0xC8E8, 0xE8, 0x00, 0x00, 0x2F, 0xFB },
-  { "BIT $01 = FF                    ", 0xC8E9, 0xE8, 0x00, 0x00, 0x2E, 0xFB },
-  { "LDA #$5F                        ", 0xC8EB, 0xE8, 0x00, 0x00, 0xEC, 0xFB },
-  { "EOR #$AA                        ", 0xC8ED, 0x5F, 0x00, 0x00, 0x6C, 0xFB },
-  { "BCS $C8FC                       ", 0xC8EF, 0xF5, 0x00, 0x00, 0xEC, 0xFB },
-  { "BPL $C8FC                       ", 0xC8F1, 0xF5, 0x00, 0x00, 0xEC, 0xFB },
-  { "CMP #$F5                        ", 0xC8F3, 0xF5, 0x00, 0x00, 0xEC, 0xFB },
-  { "BNE $C8FC                       ", 0xC8F5, 0xF5, 0x00, 0x00, 0x6F, 0xFB },
-  { "BVC $C8FC                       ", 0xC8F7, 0xF5, 0x00, 0x00, 0x6F, 0xFB },
-  { "JMP $C900                       ", 0xC8F9, 0xF5, 0x00, 0x00, 0x6F, 0xFB },
-  { "NOP                             ", 0xC900, 0xF5, 0x00, 0x00, 0x6F, 0xFB },
-  { "SEC                             ", 0xC901, 0xF5, 0x00, 0x00, 0x6F, 0xFB },
-  { "CLV                             ", 0xC902, 0xF5, 0x00, 0x00, 0x6F, 0xFB },
-  { "LDA #$70                        ", 0xC903, 0xF5, 0x00, 0x00, 0x2F, 0xFB },
-  { "EOR #$70                        ", 0xC905, 0x70, 0x00, 0x00, 0x2D, 0xFB },
-  { "BNE $C912                       ", 0xC907, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "BVS $C912                       ", 0xC909, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "BCC $C912                       ", 0xC90B, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "BMI $C912                       ", 0xC90D, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "JMP $C916                       ", 0xC90F, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "NOP                             ", 0xC916, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "CLC                             ", 0xC917, 0x00, 0x00, 0x00, 0x2F, 0xFB },
-  { "BIT $01 = FF                    ", 0xC918, 0x00, 0x00, 0x00, 0x2E, 0xFB },
-  { "LDA #$00                        ", 0xC91A, 0x00, 0x00, 0x00, 0xEE, 0xFB },
-  { "ADC #$69                        ", 0xC91C, 0x00, 0x00, 0x00, 0x6E, 0xFB },
-  { "BMI $C92B                       ", 0xC91E, 0x69, 0x00, 0x00, 0x2C, 0xFB },
-  { "BCS $C92B                       ", 0xC920, 0x69, 0x00, 0x00, 0x2C, 0xFB },
-  { "CMP #$69                        ", 0xC922, 0x69, 0x00, 0x00, 0x2C, 0xFB },
-  { "BNE $C92B                       ", 0xC924, 0x69, 0x00, 0x00, 0x2F, 0xFB },
-  { "BVS $C92B                       ", 0xC926, 0x69, 0x00, 0x00, 0x2F, 0xFB },
-  { "JMP $C92F                       ", 0xC928, 0x69, 0x00, 0x00, 0x2F, 0xFB },
-  { "NOP                             ", 0xC92F, 0x69, 0x00, 0x00, 0x2F, 0xFB },
-  { "SEC                             ", 0xC930, 0x69, 0x00, 0x00, 0x2F, 0xFB },
-  { "SED                             ", 0xC931, 0x69, 0x00, 0x00, 0x2F, 0xFB },
-  { "BIT $01 = FF                    ", 0xC932, 0x69, 0x00, 0x00, 0x2F, 0xFB },
-  { "LDA #$01                        ", 0xC934, 0x69, 0x00, 0x00, 0xED, 0xFB },
-  { "ADC #$69                        ", 0xC936, 0x01, 0x00, 0x00, 0x6D, 0xFB },
-  { "BMI $C945                       ", 0xC938, 0x6B, 0x00, 0x00, 0x2C, 0xFB },
-  { "BCS $C945                       ", 0xC93A, 0x6B, 0x00, 0x00, 0x2C, 0xFB },
-  { "CMP #$6B                        ", 0xC93C, 0x6B, 0x00, 0x00, 0x2C, 0xFB },
-  { "BNE $C945                       ", 0xC93E, 0x6B, 0x00, 0x00, 0x2F, 0xFB },
-  { "BVS $C945                       ", 0xC940, 0x6B, 0x00, 0x00, 0x2F, 0xFB },
-  { "JMP $C949                       ", 0xC942, 0x6B, 0x00, 0x00, 0x2F, 0xFB },
-  { "NOP                             ", 0xC949, 0x6B, 0x00, 0x00, 0x2F, 0xFB },
-  { "CLD                             ", 0xC94A, 0x6B, 0x00, 0x00, 0x2F, 0xFB },
-  { "SEC                             ", 0xC94B, 0x6B, 0x00, 0x00, 0x27, 0xFB },
-  { "CLV                             ", 0xC94C, 0x6B, 0x00, 0x00, 0x27, 0xFB },
-  { "LDA #$7F                        ", 0xC94D, 0x6B, 0x00, 0x00, 0x27, 0xFB },
-  { "ADC #$7F                        ", 0xC94F, 0x7F, 0x00, 0x00, 0x25, 0xFB },
-  { "BPL $C95E                       ", 0xC951, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "BCS $C95E                       ", 0xC953, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "CMP #$FF                        ", 0xC955, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "BNE $C95E                       ", 0xC957, 0xFF, 0x00, 0x00, 0x67, 0xFB },
-  { "BVC $C95E                       ", 0xC959, 0xFF, 0x00, 0x00, 0x67, 0xFB },
-  { "JMP $C962                       ", 0xC95B, 0xFF, 0x00, 0x00, 0x67, 0xFB },
-  { "NOP                             ", 0xC962, 0xFF, 0x00, 0x00, 0x67, 0xFB },
-  { "CLC                             ", 0xC963, 0xFF, 0x00, 0x00, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xC964, 0xFF, 0x00, 0x00, 0x66, 0xFB },
-  { "LDA #$7F                        ", 0xC966, 0xFF, 0x00, 0x00, 0xE4, 0xFB },
-  { "ADC #$80                        ", 0xC968, 0x7F, 0x00, 0x00, 0x64, 0xFB },
-  { "BPL $C977                       ", 0xC96A, 0xFF, 0x00, 0x00, 0xA4, 0xFB },
-  { "BCS $C977                       ", 0xC96C, 0xFF, 0x00, 0x00, 0xA4, 0xFB },
-  { "CMP #$FF                        ", 0xC96E, 0xFF, 0x00, 0x00, 0xA4, 0xFB },
-  { "BNE $C977                       ", 0xC970, 0xFF, 0x00, 0x00, 0x27, 0xFB },
-  { "BVS $C977                       ", 0xC972, 0xFF, 0x00, 0x00, 0x27, 0xFB },
-  { "JMP $C97B                       ", 0xC974, 0xFF, 0x00, 0x00, 0x27, 0xFB },
-  { "NOP                             ", 0xC97B, 0xFF, 0x00, 0x00, 0x27, 0xFB },
-  { "SEC                             ", 0xC97C, 0xFF, 0x00, 0x00, 0x27, 0xFB },
-  { "CLV                             ", 0xC97D, 0xFF, 0x00, 0x00, 0x27, 0xFB },
-  { "LDA #$7F                        ", 0xC97E, 0xFF, 0x00, 0x00, 0x27, 0xFB },
-  { "ADC #$80                        ", 0xC980, 0x7F, 0x00, 0x00, 0x25, 0xFB },
-  { "BNE $C98D                       ", 0xC982, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "BMI $C98D                       ", 0xC984, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "BVS $C98D                       ", 0xC986, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "BCC $C98D                       ", 0xC988, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "JMP $C991                       ", 0xC98A, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "NOP                             ", 0xC991, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "SEC                             ", 0xC992, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "CLV                             ", 0xC993, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "LDA #$9F                        ", 0xC994, 0x00, 0x00, 0x00, 0x27, 0xFB },
-  { "BEQ $C9A1                       ", 0xC996, 0x9F, 0x00, 0x00, 0xA5, 0xFB },
-  { "BPL $C9A1                       ", 0xC998, 0x9F, 0x00, 0x00, 0xA5, 0xFB },
-  { "BVS $C9A1                       ", 0xC99A, 0x9F, 0x00, 0x00, 0xA5, 0xFB },
-  { "BCC $C9A1                       ", 0xC99C, 0x9F, 0x00, 0x00, 0xA5, 0xFB },
-  { "JMP $C9A5                       ", 0xC99E, 0x9F, 0x00, 0x00, 0xA5, 0xFB },
-  { "NOP                             ", 0xC9A5, 0x9F, 0x00, 0x00, 0xA5, 0xFB },
-  { "CLC                             ", 0xC9A6, 0x9F, 0x00, 0x00, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xC9A7, 0x9F, 0x00, 0x00, 0xA4, 0xFB },
-  { "LDA #$00                        ", 0xC9A9, 0x9F, 0x00, 0x00, 0xE4, 0xFB },
-  { "BNE $C9B6                       ", 0xC9AB, 0x00, 0x00, 0x00, 0x66, 0xFB },
-  { "BMI $C9B6                       ", 0xC9AD, 0x00, 0x00, 0x00, 0x66, 0xFB },
-  { "BVC $C9B6                       ", 0xC9AF, 0x00, 0x00, 0x00, 0x66, 0xFB },
-  { "BCS $C9B6                       ", 0xC9B1, 0x00, 0x00, 0x00, 0x66, 0xFB },
-  { "JMP $C9BA                       ", 0xC9B3, 0x00, 0x00, 0x00, 0x66, 0xFB },
-  { "NOP                             ", 0xC9BA, 0x00, 0x00, 0x00, 0x66, 0xFB },
-  { "BIT $01 = FF                    ", 0xC9BB, 0x00, 0x00, 0x00, 0x66, 0xFB },
-  { "LDA #$40                        ", 0xC9BD, 0x00, 0x00, 0x00, 0xE6, 0xFB },
-  { "CMP #$40                        ", 0xC9BF, 0x40, 0x00, 0x00, 0x64, 0xFB },
-  { "BMI $C9CC                       ", 0xC9C1, 0x40, 0x00, 0x00, 0x67, 0xFB },
-  { "BCC $C9CC                       ", 0xC9C3, 0x40, 0x00, 0x00, 0x67, 0xFB },
-  { "BNE $C9CC                       ", 0xC9C5, 0x40, 0x00, 0x00, 0x67, 0xFB },
-  { "BVC $C9CC                       ", 0xC9C7, 0x40, 0x00, 0x00, 0x67, 0xFB },
-  { "JMP $C9D0                       ", 0xC9C9, 0x40, 0x00, 0x00, 0x67, 0xFB },
-  { "NOP                             ", 0xC9D0, 0x40, 0x00, 0x00, 0x67, 0xFB },
-  { "CLV                             ", 0xC9D1, 0x40, 0x00, 0x00, 0x67, 0xFB },
-  { "CMP #$3F                        ", 0xC9D2, 0x40, 0x00, 0x00, 0x27, 0xFB },
-  { "BEQ $C9DF                       ", 0xC9D4, 0x40, 0x00, 0x00, 0x25, 0xFB },
-  { "BMI $C9DF                       ", 0xC9D6, 0x40, 0x00, 0x00, 0x25, 0xFB },
-  { "BCC $C9DF                       ", 0xC9D8, 0x40, 0x00, 0x00, 0x25, 0xFB },
-  { "BVS $C9DF                       ", 0xC9DA, 0x40, 0x00, 0x00, 0x25, 0xFB },
-  { "JMP $C9E3                       ", 0xC9DC, 0x40, 0x00, 0x00, 0x25, 0xFB },
-  { "NOP                             ", 0xC9E3, 0x40, 0x00, 0x00, 0x25, 0xFB },
-  { "CMP #$41                        ", 0xC9E4, 0x40, 0x00, 0x00, 0x25, 0xFB },
-  { "BEQ $C9EF                       ", 0xC9E6, 0x40, 0x00, 0x00, 0xA4, 0xFB },
-  { "BPL $C9EF                       ", 0xC9E8, 0x40, 0x00, 0x00, 0xA4, 0xFB },
-  { "BPL $C9EF                       ", 0xC9EA, 0x40, 0x00, 0x00, 0xA4, 0xFB },
-  { "JMP $C9F3                       ", 0xC9EC, 0x40, 0x00, 0x00, 0xA4, 0xFB },
-  { "NOP                             ", 0xC9F3, 0x40, 0x00, 0x00, 0xA4, 0xFB },
-  { "LDA #$80                        ", 0xC9F4, 0x40, 0x00, 0x00, 0xA4, 0xFB },
-  { "CMP #$00                        ", 0xC9F6, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "BEQ $CA01                       ", 0xC9F8, 0x80, 0x00, 0x00, 0xA5, 0xFB },
-  { "BPL $CA01                       ", 0xC9FA, 0x80, 0x00, 0x00, 0xA5, 0xFB },
-  { "BCC $CA01                       ", 0xC9FC, 0x80, 0x00, 0x00, 0xA5, 0xFB },
-  { "JMP $CA05                       ", 0xC9FE, 0x80, 0x00, 0x00, 0xA5, 0xFB },
-  { "NOP                             ", 0xCA05, 0x80, 0x00, 0x00, 0xA5, 0xFB },
-  { "CMP #$80                        ", 0xCA06, 0x80, 0x00, 0x00, 0xA5, 0xFB },
-  { "BNE $CA11                       ", 0xCA08, 0x80, 0x00, 0x00, 0x27, 0xFB },
-  { "BMI $CA11                       ", 0xCA0A, 0x80, 0x00, 0x00, 0x27, 0xFB },
-  { "BCC $CA11                       ", 0xCA0C, 0x80, 0x00, 0x00, 0x27, 0xFB },
-  { "JMP $CA15                       ", 0xCA0E, 0x80, 0x00, 0x00, 0x27, 0xFB },
-  { "NOP                             ", 0xCA15, 0x80, 0x00, 0x00, 0x27, 0xFB },
-  { "CMP #$81                        ", 0xCA16, 0x80, 0x00, 0x00, 0x27, 0xFB },
-  { "BCS $CA21                       ", 0xCA18, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "BEQ $CA21                       ", 0xCA1A, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "BPL $CA21                       ", 0xCA1C, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "JMP $CA25                       ", 0xCA1E, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "NOP                             ", 0xCA25, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "CMP #$7F                        ", 0xCA26, 0x80, 0x00, 0x00, 0xA4, 0xFB },
-  { "BCC $CA31                       ", 0xCA28, 0x80, 0x00, 0x00, 0x25, 0xFB },
-  { "BEQ $CA31                       ", 0xCA2A, 0x80, 0x00, 0x00, 0x25, 0xFB },
-  { "BMI $CA31                       ", 0xCA2C, 0x80, 0x00, 0x00, 0x25, 0xFB },
-  { "JMP $CA35                       ", 0xCA2E, 0x80, 0x00, 0x00, 0x25, 0xFB },
-  { "NOP                             ", 0xCA35, 0x80, 0x00, 0x00, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xCA36, 0x80, 0x00, 0x00, 0x25, 0xFB },
-  { "LDY #$40                        ", 0xCA38, 0x80, 0x00, 0x00, 0xE5, 0xFB },
-  { "CPY #$40                        ", 0xCA3A, 0x80, 0x00, 0x40, 0x65, 0xFB },
-  { "BNE $CA47                       ", 0xCA3C, 0x80, 0x00, 0x40, 0x67, 0xFB },
-  { "BMI $CA47                       ", 0xCA3E, 0x80, 0x00, 0x40, 0x67, 0xFB },
-  { "BCC $CA47                       ", 0xCA40, 0x80, 0x00, 0x40, 0x67, 0xFB },
-  { "BVC $CA47                       ", 0xCA42, 0x80, 0x00, 0x40, 0x67, 0xFB },
-  { "JMP $CA4B                       ", 0xCA44, 0x80, 0x00, 0x40, 0x67, 0xFB },
-  { "NOP                             ", 0xCA4B, 0x80, 0x00, 0x40, 0x67, 0xFB },
-  { "CLV                             ", 0xCA4C, 0x80, 0x00, 0x40, 0x67, 0xFB },
-  { "CPY #$3F                        ", 0xCA4D, 0x80, 0x00, 0x40, 0x27, 0xFB },
-  { "BEQ $CA5A                       ", 0xCA4F, 0x80, 0x00, 0x40, 0x25, 0xFB },
-  { "BMI $CA5A                       ", 0xCA51, 0x80, 0x00, 0x40, 0x25, 0xFB },
-  { "BCC $CA5A                       ", 0xCA53, 0x80, 0x00, 0x40, 0x25, 0xFB },
-  { "BVS $CA5A                       ", 0xCA55, 0x80, 0x00, 0x40, 0x25, 0xFB },
-  { "JMP $CA5E                       ", 0xCA57, 0x80, 0x00, 0x40, 0x25, 0xFB },
-  { "NOP                             ", 0xCA5E, 0x80, 0x00, 0x40, 0x25, 0xFB },
-  { "CPY #$41                        ", 0xCA5F, 0x80, 0x00, 0x40, 0x25, 0xFB },
-  { "BEQ $CA6A                       ", 0xCA61, 0x80, 0x00, 0x40, 0xA4, 0xFB },
-  { "BPL $CA6A                       ", 0xCA63, 0x80, 0x00, 0x40, 0xA4, 0xFB },
-  { "BPL $CA6A                       ", 0xCA65, 0x80, 0x00, 0x40, 0xA4, 0xFB },
-  { "JMP $CA6E                       ", 0xCA67, 0x80, 0x00, 0x40, 0xA4, 0xFB },
-  { "NOP                             ", 0xCA6E, 0x80, 0x00, 0x40, 0xA4, 0xFB },
-  { "LDY #$80                        ", 0xCA6F, 0x80, 0x00, 0x40, 0xA4, 0xFB },
-  { "CPY #$00                        ", 0xCA71, 0x80, 0x00, 0x80, 0xA4, 0xFB },
-  { "BEQ $CA7C                       ", 0xCA73, 0x80, 0x00, 0x80, 0xA5, 0xFB },
-  { "BPL $CA7C                       ", 0xCA75, 0x80, 0x00, 0x80, 0xA5, 0xFB },
-  { "BCC $CA7C                       ", 0xCA77, 0x80, 0x00, 0x80, 0xA5, 0xFB },
-  { "JMP $CA80                       ", 0xCA79, 0x80, 0x00, 0x80, 0xA5, 0xFB },
-  { "NOP                             ", 0xCA80, 0x80, 0x00, 0x80, 0xA5, 0xFB },
-  { "CPY #$80                        ", 0xCA81, 0x80, 0x00, 0x80, 0xA5, 0xFB },
-  { "BNE $CA8C                       ", 0xCA83, 0x80, 0x00, 0x80, 0x27, 0xFB },
-  { "BMI $CA8C                       ", 0xCA85, 0x80, 0x00, 0x80, 0x27, 0xFB },
-  { "BCC $CA8C                       ", 0xCA87, 0x80, 0x00, 0x80, 0x27, 0xFB },
-  { "JMP $CA90                       ", 0xCA89, 0x80, 0x00, 0x80, 0x27, 0xFB },
-  { "NOP                             ", 0xCA90, 0x80, 0x00, 0x80, 0x27, 0xFB },
-  { "CPY #$81                        ", 0xCA91, 0x80, 0x00, 0x80, 0x27, 0xFB },
-  { "BCS $CA9C                       ", 0xCA93, 0x80, 0x00, 0x80, 0xA4, 0xFB },
-  { "BEQ $CA9C                       ", 0xCA95, 0x80, 0x00, 0x80, 0xA4, 0xFB },
-  { "BPL $CA9C                       ", 0xCA97, 0x80, 0x00, 0x80, 0xA4, 0xFB },
-  { "JMP $CAA0                       ", 0xCA99, 0x80, 0x00, 0x80, 0xA4, 0xFB },
-  { "NOP                             ", 0xCAA0, 0x80, 0x00, 0x80, 0xA4, 0xFB },
-  { "CPY #$7F                        ", 0xCAA1, 0x80, 0x00, 0x80, 0xA4, 0xFB },
-  { "BCC $CAAC                       ", 0xCAA3, 0x80, 0x00, 0x80, 0x25, 0xFB },
-  { "BEQ $CAAC                       ", 0xCAA5, 0x80, 0x00, 0x80, 0x25, 0xFB },
-  { "BMI $CAAC                       ", 0xCAA7, 0x80, 0x00, 0x80, 0x25, 0xFB },
-  { "JMP $CAB0                       ", 0xCAA9, 0x80, 0x00, 0x80, 0x25, 0xFB },
-  { "NOP                             ", 0xCAB0, 0x80, 0x00, 0x80, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xCAB1, 0x80, 0x00, 0x80, 0x25, 0xFB },
-  { "LDX #$40                        ", 0xCAB3, 0x80, 0x00, 0x80, 0xE5, 0xFB },
-  { "CPX #$40                        ", 0xCAB5, 0x80, 0x40, 0x80, 0x65, 0xFB },
-  { "BNE $CAC2                       ", 0xCAB7, 0x80, 0x40, 0x80, 0x67, 0xFB },
-  { "BMI $CAC2                       ", 0xCAB9, 0x80, 0x40, 0x80, 0x67, 0xFB },
-  { "BCC $CAC2                       ", 0xCABB, 0x80, 0x40, 0x80, 0x67, 0xFB },
-  { "BVC $CAC2                       ", 0xCABD, 0x80, 0x40, 0x80, 0x67, 0xFB },
-  { "JMP $CAC6                       ", 0xCABF, 0x80, 0x40, 0x80, 0x67, 0xFB },
-  { "NOP                             ", 0xCAC6, 0x80, 0x40, 0x80, 0x67, 0xFB },
-  { "CLV                             ", 0xCAC7, 0x80, 0x40, 0x80, 0x67, 0xFB },
-  { "CPX #$3F                        ", 0xCAC8, 0x80, 0x40, 0x80, 0x27, 0xFB },
-  { "BEQ $CAD5                       ", 0xCACA, 0x80, 0x40, 0x80, 0x25, 0xFB },
-  { "BMI $CAD5                       ", 0xCACC, 0x80, 0x40, 0x80, 0x25, 0xFB },
-  { "BCC $CAD5                       ", 0xCACE, 0x80, 0x40, 0x80, 0x25, 0xFB },
-  { "BVS $CAD5                       ", 0xCAD0, 0x80, 0x40, 0x80, 0x25, 0xFB },
-  { "JMP $CAD9                       ", 0xCAD2, 0x80, 0x40, 0x80, 0x25, 0xFB },
-  { "NOP                             ", 0xCAD9, 0x80, 0x40, 0x80, 0x25, 0xFB },
-  { "CPX #$41                        ", 0xCADA, 0x80, 0x40, 0x80, 0x25, 0xFB },
-  { "BEQ $CAE5                       ", 0xCADC, 0x80, 0x40, 0x80, 0xA4, 0xFB },
-  { "BPL $CAE5                       ", 0xCADE, 0x80, 0x40, 0x80, 0xA4, 0xFB },
-  { "BPL $CAE5                       ", 0xCAE0, 0x80, 0x40, 0x80, 0xA4, 0xFB },
-  { "JMP $CAE9                       ", 0xCAE2, 0x80, 0x40, 0x80, 0xA4, 0xFB },
-  { "NOP                             ", 0xCAE9, 0x80, 0x40, 0x80, 0xA4, 0xFB },
-  { "LDX #$80                        ", 0xCAEA, 0x80, 0x40, 0x80, 0xA4, 0xFB },
-  { "CPX #$00                        ", 0xCAEC, 0x80, 0x80, 0x80, 0xA4, 0xFB },
-  { "BEQ $CAF7                       ", 0xCAEE, 0x80, 0x80, 0x80, 0xA5, 0xFB },
-  { "BPL $CAF7                       ", 0xCAF0, 0x80, 0x80, 0x80, 0xA5, 0xFB },
-  { "BCC $CAF7                       ", 0xCAF2, 0x80, 0x80, 0x80, 0xA5, 0xFB },
-  { "JMP $CAFB                       ", 0xCAF4, 0x80, 0x80, 0x80, 0xA5, 0xFB },
-  { "NOP                             ", 0xCAFB, 0x80, 0x80, 0x80, 0xA5, 0xFB },
-  { "CPX #$80                        ", 0xCAFC, 0x80, 0x80, 0x80, 0xA5, 0xFB },
-  { "BNE $CB07                       ", 0xCAFE, 0x80, 0x80, 0x80, 0x27, 0xFB },
-  { "BMI $CB07                       ", 0xCB00, 0x80, 0x80, 0x80, 0x27, 0xFB },
-  { "BCC $CB07                       ", 0xCB02, 0x80, 0x80, 0x80, 0x27, 0xFB },
-  { "JMP $CB0B                       ", 0xCB04, 0x80, 0x80, 0x80, 0x27, 0xFB },
-  { "NOP                             ", 0xCB0B, 0x80, 0x80, 0x80, 0x27, 0xFB },
-  { "CPX #$81                        ", 0xCB0C, 0x80, 0x80, 0x80, 0x27, 0xFB },
-  { "BCS $CB17                       ", 0xCB0E, 0x80, 0x80, 0x80, 0xA4, 0xFB },
-  { "BEQ $CB17                       ", 0xCB10, 0x80, 0x80, 0x80, 0xA4, 0xFB },
-  { "BPL $CB17                       ", 0xCB12, 0x80, 0x80, 0x80, 0xA4, 0xFB },
-  { "JMP $CB1B                       ", 0xCB14, 0x80, 0x80, 0x80, 0xA4, 0xFB },
-  { "NOP                             ", 0xCB1B, 0x80, 0x80, 0x80, 0xA4, 0xFB },
-  { "CPX #$7F                        ", 0xCB1C, 0x80, 0x80, 0x80, 0xA4, 0xFB },
-  { "BCC $CB27                       ", 0xCB1E, 0x80, 0x80, 0x80, 0x25, 0xFB },
-  { "BEQ $CB27                       ", 0xCB20, 0x80, 0x80, 0x80, 0x25, 0xFB },
-  { "BMI $CB27                       ", 0xCB22, 0x80, 0x80, 0x80, 0x25, 0xFB },
-  { "JMP $CB2B                       ", 0xCB24, 0x80, 0x80, 0x80, 0x25, 0xFB },
-  { "NOP                             ", 0xCB2B, 0x80, 0x80, 0x80, 0x25, 0xFB },
-  { "SEC                             ", 0xCB2C, 0x80, 0x80, 0x80, 0x25, 0xFB },
-  { "CLV                             ", 0xCB2D, 0x80, 0x80, 0x80, 0x25, 0xFB },
-  { "LDX #$9F                        ", 0xCB2E, 0x80, 0x80, 0x80, 0x25, 0xFB },
-  { "BEQ $CB3B                       ", 0xCB30, 0x80, 0x9F, 0x80, 0xA5, 0xFB },
-  { "BPL $CB3B                       ", 0xCB32, 0x80, 0x9F, 0x80, 0xA5, 0xFB },
-  { "BVS $CB3B                       ", 0xCB34, 0x80, 0x9F, 0x80, 0xA5, 0xFB },
-  { "BCC $CB3B                       ", 0xCB36, 0x80, 0x9F, 0x80, 0xA5, 0xFB },
-  { "JMP $CB3F                       ", 0xCB38, 0x80, 0x9F, 0x80, 0xA5, 0xFB },
-  { "NOP                             ", 0xCB3F, 0x80, 0x9F, 0x80, 0xA5, 0xFB },
-  { "CLC                             ", 0xCB40, 0x80, 0x9F, 0x80, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xCB41, 0x80, 0x9F, 0x80, 0xA4, 0xFB },
-  { "LDX #$00                        ", 0xCB43, 0x80, 0x9F, 0x80, 0xE4, 0xFB },
-  { "BNE $CB50                       ", 0xCB45, 0x80, 0x00, 0x80, 0x66, 0xFB },
-  { "BMI $CB50                       ", 0xCB47, 0x80, 0x00, 0x80, 0x66, 0xFB },
-  { "BVC $CB50                       ", 0xCB49, 0x80, 0x00, 0x80, 0x66, 0xFB },
-  { "BCS $CB50                       ", 0xCB4B, 0x80, 0x00, 0x80, 0x66, 0xFB },
-  { "JMP $CB54                       ", 0xCB4D, 0x80, 0x00, 0x80, 0x66, 0xFB },
-  { "NOP                             ", 0xCB54, 0x80, 0x00, 0x80, 0x66, 0xFB },
-  { "SEC                             ", 0xCB55, 0x80, 0x00, 0x80, 0x66, 0xFB },
-  { "CLV                             ", 0xCB56, 0x80, 0x00, 0x80, 0x67, 0xFB },
-  { "LDY #$9F                        ", 0xCB57, 0x80, 0x00, 0x80, 0x27, 0xFB },
-  { "BEQ $CB64                       ", 0xCB59, 0x80, 0x00, 0x9F, 0xA5, 0xFB },
-  { "BPL $CB64                       ", 0xCB5B, 0x80, 0x00, 0x9F, 0xA5, 0xFB },
-  { "BVS $CB64                       ", 0xCB5D, 0x80, 0x00, 0x9F, 0xA5, 0xFB },
-  { "BCC $CB64                       ", 0xCB5F, 0x80, 0x00, 0x9F, 0xA5, 0xFB },
-  { "JMP $CB68                       ", 0xCB61, 0x80, 0x00, 0x9F, 0xA5, 0xFB },
-  { "NOP                             ", 0xCB68, 0x80, 0x00, 0x9F, 0xA5, 0xFB },
-  { "CLC                             ", 0xCB69, 0x80, 0x00, 0x9F, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xCB6A, 0x80, 0x00, 0x9F, 0xA4, 0xFB },
-  { "LDY #$00                        ", 0xCB6C, 0x80, 0x00, 0x9F, 0xE4, 0xFB },
-  { "BNE $CB79                       ", 0xCB6E, 0x80, 0x00, 0x00, 0x66, 0xFB },
-  { "BMI $CB79                       ", 0xCB70, 0x80, 0x00, 0x00, 0x66, 0xFB },
-  { "BVC $CB79                       ", 0xCB72, 0x80, 0x00, 0x00, 0x66, 0xFB },
-  { "BCS $CB79                       ", 0xCB74, 0x80, 0x00, 0x00, 0x66, 0xFB },
-  { "JMP $CB7D                       ", 0xCB76, 0x80, 0x00, 0x00, 0x66, 0xFB },
-  { "NOP                             ", 0xCB7D, 0x80, 0x00, 0x00, 0x66, 0xFB },
-  { "LDA #$55                        ", 0xCB7E, 0x80, 0x00, 0x00, 0x66, 0xFB },
-  { "LDX #$AA                        ", 0xCB80, 0x55, 0x00, 0x00, 0x64, 0xFB },
-  { "LDY #$33                        ", 0xCB82, 0x55, 0xAA, 0x00, 0xE4, 0xFB },
-  { "CMP #$55                        ", 0xCB84, 0x55, 0xAA, 0x33, 0x64, 0xFB },
-  { "BNE $CBAB                       ", 0xCB86, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "CPX #$AA                        ", 0xCB88, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "BNE $CBAB                       ", 0xCB8A, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "CPY #$33                        ", 0xCB8C, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "BNE $CBAB                       ", 0xCB8E, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "CMP #$55                        ", 0xCB90, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "BNE $CBAB                       ", 0xCB92, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "CPX #$AA                        ", 0xCB94, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "BNE $CBAB                       ", 0xCB96, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "CPY #$33                        ", 0xCB98, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "BNE $CBAB                       ", 0xCB9A, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "CMP #$56                        ", 0xCB9C, 0x55, 0xAA, 0x33, 0x67, 0xFB },
-  { "BEQ $CBAB                       ", 0xCB9E, 0x55, 0xAA, 0x33, 0xE4, 0xFB },
-  { "CPX #$AB                        ", 0xCBA0, 0x55, 0xAA, 0x33, 0xE4, 0xFB },
-  { "BEQ $CBAB                       ", 0xCBA2, 0x55, 0xAA, 0x33, 0xE4, 0xFB },
-  { "CPY #$34                        ", 0xCBA4, 0x55, 0xAA, 0x33, 0xE4, 0xFB },
-  { "BEQ $CBAB                       ", 0xCBA6, 0x55, 0xAA, 0x33, 0xE4, 0xFB },
-  { "JMP $CBAF                       ", 0xCBA8, 0x55, 0xAA, 0x33, 0xE4, 0xFB },
-  { "LDY #$71                        ", 0xCBAF, 0x55, 0xAA, 0x33, 0xE4, 0xFB },
-  { "JSR $F931                       ", 0xCBB1, 0x55, 0xAA, 0x71, 0x64, 0xFB },
-  { "BIT $01 = FF                    ", 0xF931, 0x55, 0xAA, 0x71, 0x64, 0xF9 },
-  { "LDA #$40                        ", 0xF933, 0x55, 0xAA, 0x71, 0xE4, 0xF9 },
-  { "SEC                             ", 0xF935, 0x40, 0xAA, 0x71, 0x64, 0xF9 },
-  { "RTS                             ", 0xF936, 0x40, 0xAA, 0x71, 0x65, 0xF9 },
-  { "SBC #$40                        ", 0xCBB4, 0x40, 0xAA, 0x71, 0x65, 0xFB },
-  { "JSR $F937                       ", 0xCBB6, 0x00, 0xAA, 0x71, 0x27, 0xFB },
-  { "BMI $F944                       ", 0xF937, 0x00, 0xAA, 0x71, 0x27, 0xF9 },
-  { "BCC $F944                       ", 0xF939, 0x00, 0xAA, 0x71, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF93B, 0x00, 0xAA, 0x71, 0x27, 0xF9 },
-  { "BVS $F944                       ", 0xF93D, 0x00, 0xAA, 0x71, 0x27, 0xF9 },
-  { "CMP #$00                        ", 0xF93F, 0x00, 0xAA, 0x71, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF941, 0x00, 0xAA, 0x71, 0x27, 0xF9 },
-  { "RTS                             ", 0xF943, 0x00, 0xAA, 0x71, 0x27, 0xF9 },
-  { "INY                             ", 0xCBB9, 0x00, 0xAA, 0x71, 0x27, 0xFB },
-  { "JSR $F947                       ", 0xCBBA, 0x00, 0xAA, 0x72, 0x25, 0xFB },
-  { "CLV                             ", 0xF947, 0x00, 0xAA, 0x72, 0x25, 0xF9 },
-  { "SEC                             ", 0xF948, 0x00, 0xAA, 0x72, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF949, 0x00, 0xAA, 0x72, 0x25, 0xF9 },
-  { "RTS                             ", 0xF94B, 0x40, 0xAA, 0x72, 0x25, 0xF9 },
-  { "SBC #$3F                        ", 0xCBBD, 0x40, 0xAA, 0x72, 0x25, 0xFB },
-  { "JSR $F94C                       ", 0xCBBF, 0x01, 0xAA, 0x72, 0x25, 0xFB },
-  { "BEQ $F959                       ", 0xF94C, 0x01, 0xAA, 0x72, 0x25, 0xF9 },
-  { "BMI $F959                       ", 0xF94E, 0x01, 0xAA, 0x72, 0x25, 0xF9 },
-  { "BCC $F959                       ", 0xF950, 0x01, 0xAA, 0x72, 0x25, 0xF9 },
-  { "BVS $F959                       ", 0xF952, 0x01, 0xAA, 0x72, 0x25, 0xF9 },
-  { "CMP #$01                        ", 0xF954, 0x01, 0xAA, 0x72, 0x25, 0xF9 },
-  { "BNE $F959                       ", 0xF956, 0x01, 0xAA, 0x72, 0x27, 0xF9 },
-  { "RTS                             ", 0xF958, 0x01, 0xAA, 0x72, 0x27, 0xF9 },
-  { "INY                             ", 0xCBC2, 0x01, 0xAA, 0x72, 0x27, 0xFB },
-  { "JSR $F95C                       ", 0xCBC3, 0x01, 0xAA, 0x73, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xF95C, 0x01, 0xAA, 0x73, 0x25, 0xF9 },
-  { "SEC                             ", 0xF95E, 0x40, 0xAA, 0x73, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF95F, 0x40, 0xAA, 0x73, 0x25, 0xF9 },
-  { "RTS                             ", 0xF961, 0x40, 0xAA, 0x73, 0xE5, 0xF9 },
-  { "SBC #$41                        ", 0xCBC6, 0x40, 0xAA, 0x73, 0xE5, 0xFB },
-  { "JSR $F962                       ", 0xCBC8, 0xFF, 0xAA, 0x73, 0xA4, 0xFB },
-  { "BCS $F96F                       ", 0xF962, 0xFF, 0xAA, 0x73, 0xA4, 0xF9 },
-  { "BEQ $F96F                       ", 0xF964, 0xFF, 0xAA, 0x73, 0xA4, 0xF9 },
-  { "BPL $F96F                       ", 0xF966, 0xFF, 0xAA, 0x73, 0xA4, 0xF9 },
-  { "BVS $F96F                       ", 0xF968, 0xFF, 0xAA, 0x73, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF96A, 0xFF, 0xAA, 0x73, 0xA4, 0xF9 },
-  { "BNE $F96F                       ", 0xF96C, 0xFF, 0xAA, 0x73, 0x27, 0xF9 },
-  { "RTS                             ", 0xF96E, 0xFF, 0xAA, 0x73, 0x27, 0xF9 },
-  { "INY                             ", 0xCBCB, 0xFF, 0xAA, 0x73, 0x27, 0xFB },
-  { "JSR $F972                       ", 0xCBCC, 0xFF, 0xAA, 0x74, 0x25, 0xFB },
-  { "CLC                             ", 0xF972, 0xFF, 0xAA, 0x74, 0x25, 0xF9 },
-  { "LDA #$80                        ", 0xF973, 0xFF, 0xAA, 0x74, 0x24, 0xF9 },
-  { "RTS                             ", 0xF975, 0x80, 0xAA, 0x74, 0xA4, 0xF9 },
-  { "SBC #$00                        ", 0xCBCF, 0x80, 0xAA, 0x74, 0xA4, 0xFB },
-  { "JSR $F976                       ", 0xCBD1, 0x7F, 0xAA, 0x74, 0x65, 0xFB },
-  { "BCC $F97D                       ", 0xF976, 0x7F, 0xAA, 0x74, 0x65, 0xF9 },
-  { "CMP #$7F                        ", 0xF978, 0x7F, 0xAA, 0x74, 0x65, 0xF9 },
-  { "BNE $F97D                       ", 0xF97A, 0x7F, 0xAA, 0x74, 0x67, 0xF9 },
-  { "RTS                             ", 0xF97C, 0x7F, 0xAA, 0x74, 0x67, 0xF9 },
-  { "INY                             ", 0xCBD4, 0x7F, 0xAA, 0x74, 0x67, 0xFB },
-  { "JSR $F980                       ", 0xCBD5, 0x7F, 0xAA, 0x75, 0x65, 0xFB },
-  { "SEC                             ", 0xF980, 0x7F, 0xAA, 0x75, 0x65, 0xF9 },
-  { "LDA #$81                        ", 0xF981, 0x7F, 0xAA, 0x75, 0x65, 0xF9 },
-  { "RTS                             ", 0xF983, 0x81, 0xAA, 0x75, 0xE5, 0xF9 },
-  { "SBC #$7F                        ", 0xCBD8, 0x81, 0xAA, 0x75, 0xE5, 0xFB },
-  { "JSR $F984                       ", 0xCBDA, 0x02, 0xAA, 0x75, 0x65, 0xFB },
-  { "BVC $F98D                       ", 0xF984, 0x02, 0xAA, 0x75, 0x65, 0xF9 },
-  { "BCC $F98D                       ", 0xF986, 0x02, 0xAA, 0x75, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xF988, 0x02, 0xAA, 0x75, 0x65, 0xF9 },
-  { "BNE $F98D                       ", 0xF98A, 0x02, 0xAA, 0x75, 0x67, 0xF9 },
-  { "RTS                             ", 0xF98C, 0x02, 0xAA, 0x75, 0x67, 0xF9 },
-  { "RTS                             ", 0xCBDD, 0x02, 0xAA, 0x75, 0x67, 0xFB },
-  { "JSR $CBDE                       ", 0xC606, 0x02, 0xAA, 0x75, 0x67, 0xFD },
-  { "NOP                             ", 0xCBDE, 0x02, 0xAA, 0x75, 0x67, 0xFB },
-  { "LDA #$FF                        ", 0xCBDF, 0x02, 0xAA, 0x75, 0x67, 0xFB },
-  { "STA $01 = FF                    ", 0xCBE1, 0xFF, 0xAA, 0x75, 0xE5, 0xFB },
-  { "LDA #$44                        ", 0xCBE3, 0xFF, 0xAA, 0x75, 0xE5, 0xFB },
-  { "LDX #$55                        ", 0xCBE5, 0x44, 0xAA, 0x75, 0x65, 0xFB },
-  { "LDY #$66                        ", 0xCBE7, 0x44, 0x55, 0x75, 0x65, 0xFB },
-  { "INX                             ", 0xCBE9, 0x44, 0x55, 0x66, 0x65, 0xFB },
-  { "DEY                             ", 0xCBEA, 0x44, 0x56, 0x66, 0x65, 0xFB },
-  { "CPX #$56                        ", 0xCBEB, 0x44, 0x56, 0x65, 0x65, 0xFB },
-  { "BNE $CC10                       ", 0xCBED, 0x44, 0x56, 0x65, 0x67, 0xFB },
-  { "CPY #$65                        ", 0xCBEF, 0x44, 0x56, 0x65, 0x67, 0xFB },
-  { "BNE $CC10                       ", 0xCBF1, 0x44, 0x56, 0x65, 0x67, 0xFB },
-  { "INX                             ", 0xCBF3, 0x44, 0x56, 0x65, 0x67, 0xFB },
-  { "INX                             ", 0xCBF4, 0x44, 0x57, 0x65, 0x65, 0xFB },
-  { "DEY                             ", 0xCBF5, 0x44, 0x58, 0x65, 0x65, 0xFB },
-  { "DEY                             ", 0xCBF6, 0x44, 0x58, 0x64, 0x65, 0xFB },
-  { "CPX #$58                        ", 0xCBF7, 0x44, 0x58, 0x63, 0x65, 0xFB },
-  { "BNE $CC10                       ", 0xCBF9, 0x44, 0x58, 0x63, 0x67, 0xFB },
-  { "CPY #$63                        ", 0xCBFB, 0x44, 0x58, 0x63, 0x67, 0xFB },
-  { "BNE $CC10                       ", 0xCBFD, 0x44, 0x58, 0x63, 0x67, 0xFB },
-  { "DEX                             ", 0xCBFF, 0x44, 0x58, 0x63, 0x67, 0xFB },
-  { "INY                             ", 0xCC00, 0x44, 0x57, 0x63, 0x65, 0xFB },
-  { "CPX #$57                        ", 0xCC01, 0x44, 0x57, 0x64, 0x65, 0xFB },
-  { "BNE $CC10                       ", 0xCC03, 0x44, 0x57, 0x64, 0x67, 0xFB },
-  { "CPY #$64                        ", 0xCC05, 0x44, 0x57, 0x64, 0x67, 0xFB },
-  { "BNE $CC10                       ", 0xCC07, 0x44, 0x57, 0x64, 0x67, 0xFB },
-  { "CMP #$44                        ", 0xCC09, 0x44, 0x57, 0x64, 0x67, 0xFB },
-  { "BNE $CC10                       ", 0xCC0B, 0x44, 0x57, 0x64, 0x67, 0xFB },
-  { "JMP $CC14                       ", 0xCC0D, 0x44, 0x57, 0x64, 0x67, 0xFB },
-  { "NOP                             ", 0xCC14, 0x44, 0x57, 0x64, 0x67, 0xFB },
-  { "SEC                             ", 0xCC15, 0x44, 0x57, 0x64, 0x67, 0xFB },
-  { "LDX #$69                        ", 0xCC16, 0x44, 0x57, 0x64, 0x67, 0xFB },
-  { "LDA #$96                        ", 0xCC18, 0x44, 0x69, 0x64, 0x65, 0xFB },
-  { "BIT $01 = FF                    ", 0xCC1A, 0x96, 0x69, 0x64, 0xE5, 0xFB },
-  { "LDY #$FF                        ", 0xCC1C, 0x96, 0x69, 0x64, 0xE5, 0xFB },
-  { "INY                             ", 0xCC1E, 0x96, 0x69, 0xFF, 0xE5, 0xFB },
-  { "BNE $CC5E                       ", 0xCC1F, 0x96, 0x69, 0x00, 0x67, 0xFB },
-  { "BMI $CC5E                       ", 0xCC21, 0x96, 0x69, 0x00, 0x67, 0xFB },
-  { "BCC $CC5E                       ", 0xCC23, 0x96, 0x69, 0x00, 0x67, 0xFB },
-  { "BVC $CC5E                       ", 0xCC25, 0x96, 0x69, 0x00, 0x67, 0xFB },
-  { "CPY #$00                        ", 0xCC27, 0x96, 0x69, 0x00, 0x67, 0xFB },
-  { "BNE $CC5E                       ", 0xCC29, 0x96, 0x69, 0x00, 0x67, 0xFB },
-  { "INY                             ", 0xCC2B, 0x96, 0x69, 0x00, 0x67, 0xFB },
-  { "BEQ $CC5E                       ", 0xCC2C, 0x96, 0x69, 0x01, 0x65, 0xFB },
-  { "BMI $CC5E                       ", 0xCC2E, 0x96, 0x69, 0x01, 0x65, 0xFB },
-  { "BCC $CC5E                       ", 0xCC30, 0x96, 0x69, 0x01, 0x65, 0xFB },
-  { "BVC $CC5E                       ", 0xCC32, 0x96, 0x69, 0x01, 0x65, 0xFB },
-  { "CLC                             ", 0xCC34, 0x96, 0x69, 0x01, 0x65, 0xFB },
-  { "CLV                             ", 0xCC35, 0x96, 0x69, 0x01, 0x64, 0xFB },
-  { "LDY #$00                        ", 0xCC36, 0x96, 0x69, 0x01, 0x24, 0xFB },
-  { "DEY                             ", 0xCC38, 0x96, 0x69, 0x00, 0x26, 0xFB },
-  { "BEQ $CC5E                       ", 0xCC39, 0x96, 0x69, 0xFF, 0xA4, 0xFB },
-  { "BPL $CC5E                       ", 0xCC3B, 0x96, 0x69, 0xFF, 0xA4, 0xFB },
-  { "BCS $CC5E                       ", 0xCC3D, 0x96, 0x69, 0xFF, 0xA4, 0xFB },
-  { "BVS $CC5E                       ", 0xCC3F, 0x96, 0x69, 0xFF, 0xA4, 0xFB },
-  { "CPY #$FF                        ", 0xCC41, 0x96, 0x69, 0xFF, 0xA4, 0xFB },
-  { "BNE $CC5E                       ", 0xCC43, 0x96, 0x69, 0xFF, 0x27, 0xFB },
-  { "CLC                             ", 0xCC45, 0x96, 0x69, 0xFF, 0x27, 0xFB },
-  { "DEY                             ", 0xCC46, 0x96, 0x69, 0xFF, 0x26, 0xFB },
-  { "BEQ $CC5E                       ", 0xCC47, 0x96, 0x69, 0xFE, 0xA4, 0xFB },
-  { "BPL $CC5E                       ", 0xCC49, 0x96, 0x69, 0xFE, 0xA4, 0xFB },
-  { "BCS $CC5E                       ", 0xCC4B, 0x96, 0x69, 0xFE, 0xA4, 0xFB },
-  { "BVS $CC5E                       ", 0xCC4D, 0x96, 0x69, 0xFE, 0xA4, 0xFB },
-  { "CPY #$FE                        ", 0xCC4F, 0x96, 0x69, 0xFE, 0xA4, 0xFB },
-  { "BNE $CC5E                       ", 0xCC51, 0x96, 0x69, 0xFE, 0x27, 0xFB },
-  { "CMP #$96                        ", 0xCC53, 0x96, 0x69, 0xFE, 0x27, 0xFB },
-  { "BNE $CC5E                       ", 0xCC55, 0x96, 0x69, 0xFE, 0x27, 0xFB },
-  { "CPX #$69                        ", 0xCC57, 0x96, 0x69, 0xFE, 0x27, 0xFB },
-  { "BNE $CC5E                       ", 0xCC59, 0x96, 0x69, 0xFE, 0x27, 0xFB },
-  { "JMP $CC62                       ", 0xCC5B, 0x96, 0x69, 0xFE, 0x27, 0xFB },
-  { "NOP                             ", 0xCC62, 0x96, 0x69, 0xFE, 0x27, 0xFB },
-  { "SEC                             ", 0xCC63, 0x96, 0x69, 0xFE, 0x27, 0xFB },
-  { "LDY #$69                        ", 0xCC64, 0x96, 0x69, 0xFE, 0x27, 0xFB },
-  { "LDA #$96                        ", 0xCC66, 0x96, 0x69, 0x69, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xCC68, 0x96, 0x69, 0x69, 0xA5, 0xFB },
-  { "LDX #$FF                        ", 0xCC6A, 0x96, 0x69, 0x69, 0xE5, 0xFB },
-  { "INX                             ", 0xCC6C, 0x96, 0xFF, 0x69, 0xE5, 0xFB },
-  { "BNE $CCAC                       ", 0xCC6D, 0x96, 0x00, 0x69, 0x67, 0xFB },
-  { "BMI $CCAC                       ", 0xCC6F, 0x96, 0x00, 0x69, 0x67, 0xFB },
-  { "BCC $CCAC                       ", 0xCC71, 0x96, 0x00, 0x69, 0x67, 0xFB },
-  { "BVC $CCAC                       ", 0xCC73, 0x96, 0x00, 0x69, 0x67, 0xFB },
-  { "CPX #$00                        ", 0xCC75, 0x96, 0x00, 0x69, 0x67, 0xFB },
-  { "BNE $CCAC                       ", 0xCC77, 0x96, 0x00, 0x69, 0x67, 0xFB },
-  { "INX                             ", 0xCC79, 0x96, 0x00, 0x69, 0x67, 0xFB },
-  { "BEQ $CCAC                       ", 0xCC7A, 0x96, 0x01, 0x69, 0x65, 0xFB },
-  { "BMI $CCAC                       ", 0xCC7C, 0x96, 0x01, 0x69, 0x65, 0xFB },
-  { "BCC $CCAC                       ", 0xCC7E, 0x96, 0x01, 0x69, 0x65, 0xFB },
-  { "BVC $CCAC                       ", 0xCC80, 0x96, 0x01, 0x69, 0x65, 0xFB },
-  { "CLC                             ", 0xCC82, 0x96, 0x01, 0x69, 0x65, 0xFB },
-  { "CLV                             ", 0xCC83, 0x96, 0x01, 0x69, 0x64, 0xFB },
-  { "LDX #$00                        ", 0xCC84, 0x96, 0x01, 0x69, 0x24, 0xFB },
-  { "DEX                             ", 0xCC86, 0x96, 0x00, 0x69, 0x26, 0xFB },
-  { "BEQ $CCAC                       ", 0xCC87, 0x96, 0xFF, 0x69, 0xA4, 0xFB },
-  { "BPL $CCAC                       ", 0xCC89, 0x96, 0xFF, 0x69, 0xA4, 0xFB },
-  { "BCS $CCAC                       ", 0xCC8B, 0x96, 0xFF, 0x69, 0xA4, 0xFB },
-  { "BVS $CCAC                       ", 0xCC8D, 0x96, 0xFF, 0x69, 0xA4, 0xFB },
-  { "CPX #$FF                        ", 0xCC8F, 0x96, 0xFF, 0x69, 0xA4, 0xFB },
-  { "BNE $CCAC                       ", 0xCC91, 0x96, 0xFF, 0x69, 0x27, 0xFB },
-  { "CLC                             ", 0xCC93, 0x96, 0xFF, 0x69, 0x27, 0xFB },
-  { "DEX                             ", 0xCC94, 0x96, 0xFF, 0x69, 0x26, 0xFB },
-  { "BEQ $CCAC                       ", 0xCC95, 0x96, 0xFE, 0x69, 0xA4, 0xFB },
-  { "BPL $CCAC                       ", 0xCC97, 0x96, 0xFE, 0x69, 0xA4, 0xFB },
-  { "BCS $CCAC                       ", 0xCC99, 0x96, 0xFE, 0x69, 0xA4, 0xFB },
-  { "BVS $CCAC                       ", 0xCC9B, 0x96, 0xFE, 0x69, 0xA4, 0xFB },
-  { "CPX #$FE                        ", 0xCC9D, 0x96, 0xFE, 0x69, 0xA4, 0xFB },
-  { "BNE $CCAC                       ", 0xCC9F, 0x96, 0xFE, 0x69, 0x27, 0xFB },
-  { "CMP #$96                        ", 0xCCA1, 0x96, 0xFE, 0x69, 0x27, 0xFB },
-  { "BNE $CCAC                       ", 0xCCA3, 0x96, 0xFE, 0x69, 0x27, 0xFB },
-  { "CPY #$69                        ", 0xCCA5, 0x96, 0xFE, 0x69, 0x27, 0xFB },
-  { "BNE $CCAC                       ", 0xCCA7, 0x96, 0xFE, 0x69, 0x27, 0xFB },
-  { "JMP $CCB0                       ", 0xCCA9, 0x96, 0xFE, 0x69, 0x27, 0xFB },
-  { "NOP                             ", 0xCCB0, 0x96, 0xFE, 0x69, 0x27, 0xFB },
-  { "LDA #$85                        ", 0xCCB1, 0x96, 0xFE, 0x69, 0x27, 0xFB },
-  { "LDX #$34                        ", 0xCCB3, 0x85, 0xFE, 0x69, 0xA5, 0xFB },
-  { "LDY #$99                        ", 0xCCB5, 0x85, 0x34, 0x69, 0x25, 0xFB },
-  { "CLC                             ", 0xCCB7, 0x85, 0x34, 0x99, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xCCB8, 0x85, 0x34, 0x99, 0xA4, 0xFB },
-  { "TAY                             ", 0xCCBA, 0x85, 0x34, 0x99, 0xE4, 0xFB },
-  { "BEQ $CCEB                       ", 0xCCBB, 0x85, 0x34, 0x85, 0xE4, 0xFB },
-  { "BCS $CCEB                       ", 0xCCBD, 0x85, 0x34, 0x85, 0xE4, 0xFB },
-  { "BVC $CCEB                       ", 0xCCBF, 0x85, 0x34, 0x85, 0xE4, 0xFB },
-  { "BPL $CCEB                       ", 0xCCC1, 0x85, 0x34, 0x85, 0xE4, 0xFB },
-  { "CMP #$85                        ", 0xCCC3, 0x85, 0x34, 0x85, 0xE4, 0xFB },
-  { "BNE $CCEB                       ", 0xCCC5, 0x85, 0x34, 0x85, 0x67, 0xFB },
-  { "CPX #$34                        ", 0xCCC7, 0x85, 0x34, 0x85, 0x67, 0xFB },
-  { "BNE $CCEB                       ", 0xCCC9, 0x85, 0x34, 0x85, 0x67, 0xFB },
-  { "CPY #$85                        ", 0xCCCB, 0x85, 0x34, 0x85, 0x67, 0xFB },
-  { "BNE $CCEB                       ", 0xCCCD, 0x85, 0x34, 0x85, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xCCCF, 0x85, 0x34, 0x85, 0x67, 0xFB },
-  { "SEC                             ", 0xCCD1, 0x00, 0x34, 0x85, 0x67, 0xFB },
-  { "CLV                             ", 0xCCD2, 0x00, 0x34, 0x85, 0x67, 0xFB },
-  { "TAY                             ", 0xCCD3, 0x00, 0x34, 0x85, 0x27, 0xFB },
-  { "BNE $CCEB                       ", 0xCCD4, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BCC $CCEB                       ", 0xCCD6, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BVS $CCEB                       ", 0xCCD8, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BMI $CCEB                       ", 0xCCDA, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xCCDC, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BNE $CCEB                       ", 0xCCDE, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "CPX #$34                        ", 0xCCE0, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BNE $CCEB                       ", 0xCCE2, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "CPY #$00                        ", 0xCCE4, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BNE $CCEB                       ", 0xCCE6, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "JMP $CCEF                       ", 0xCCE8, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "NOP                             ", 0xCCEF, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "LDA #$85                        ", 0xCCF0, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "LDX #$34                        ", 0xCCF2, 0x85, 0x34, 0x00, 0xA5, 0xFB },
-  { "LDY #$99                        ", 0xCCF4, 0x85, 0x34, 0x00, 0x25, 0xFB },
-  { "CLC                             ", 0xCCF6, 0x85, 0x34, 0x99, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xCCF7, 0x85, 0x34, 0x99, 0xA4, 0xFB },
-  { "TAX                             ", 0xCCF9, 0x85, 0x34, 0x99, 0xE4, 0xFB },
-  { "BEQ $CD2A                       ", 0xCCFA, 0x85, 0x85, 0x99, 0xE4, 0xFB },
-  { "BCS $CD2A                       ", 0xCCFC, 0x85, 0x85, 0x99, 0xE4, 0xFB },
-  { "BVC $CD2A                       ", 0xCCFE, 0x85, 0x85, 0x99, 0xE4, 0xFB },
-  { "BPL $CD2A                       ", 0xCD00, 0x85, 0x85, 0x99, 0xE4, 0xFB },
-  { "CMP #$85                        ", 0xCD02, 0x85, 0x85, 0x99, 0xE4, 0xFB },
-  { "BNE $CD2A                       ", 0xCD04, 0x85, 0x85, 0x99, 0x67, 0xFB },
-  { "CPX #$85                        ", 0xCD06, 0x85, 0x85, 0x99, 0x67, 0xFB },
-  { "BNE $CD2A                       ", 0xCD08, 0x85, 0x85, 0x99, 0x67, 0xFB },
-  { "CPY #$99                        ", 0xCD0A, 0x85, 0x85, 0x99, 0x67, 0xFB },
-  { "BNE $CD2A                       ", 0xCD0C, 0x85, 0x85, 0x99, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xCD0E, 0x85, 0x85, 0x99, 0x67, 0xFB },
-  { "SEC                             ", 0xCD10, 0x00, 0x85, 0x99, 0x67, 0xFB },
-  { "CLV                             ", 0xCD11, 0x00, 0x85, 0x99, 0x67, 0xFB },
-  { "TAX                             ", 0xCD12, 0x00, 0x85, 0x99, 0x27, 0xFB },
-  { "BNE $CD2A                       ", 0xCD13, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BCC $CD2A                       ", 0xCD15, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BVS $CD2A                       ", 0xCD17, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BMI $CD2A                       ", 0xCD19, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xCD1B, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BNE $CD2A                       ", 0xCD1D, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "CPX #$00                        ", 0xCD1F, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BNE $CD2A                       ", 0xCD21, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "CPY #$99                        ", 0xCD23, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BNE $CD2A                       ", 0xCD25, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "JMP $CD2E                       ", 0xCD27, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "NOP                             ", 0xCD2E, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "LDA #$85                        ", 0xCD2F, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "LDX #$34                        ", 0xCD31, 0x85, 0x00, 0x99, 0xA5, 0xFB },
-  { "LDY #$99                        ", 0xCD33, 0x85, 0x34, 0x99, 0x25, 0xFB },
-  { "CLC                             ", 0xCD35, 0x85, 0x34, 0x99, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xCD36, 0x85, 0x34, 0x99, 0xA4, 0xFB },
-  { "TYA                             ", 0xCD38, 0x85, 0x34, 0x99, 0xE4, 0xFB },
-  { "BEQ $CD69                       ", 0xCD39, 0x99, 0x34, 0x99, 0xE4, 0xFB },
-  { "BCS $CD69                       ", 0xCD3B, 0x99, 0x34, 0x99, 0xE4, 0xFB },
-  { "BVC $CD69                       ", 0xCD3D, 0x99, 0x34, 0x99, 0xE4, 0xFB },
-  { "BPL $CD69                       ", 0xCD3F, 0x99, 0x34, 0x99, 0xE4, 0xFB },
-  { "CMP #$99                        ", 0xCD41, 0x99, 0x34, 0x99, 0xE4, 0xFB },
-  { "BNE $CD69                       ", 0xCD43, 0x99, 0x34, 0x99, 0x67, 0xFB },
-  { "CPX #$34                        ", 0xCD45, 0x99, 0x34, 0x99, 0x67, 0xFB },
-  { "BNE $CD69                       ", 0xCD47, 0x99, 0x34, 0x99, 0x67, 0xFB },
-  { "CPY #$99                        ", 0xCD49, 0x99, 0x34, 0x99, 0x67, 0xFB },
-  { "BNE $CD69                       ", 0xCD4B, 0x99, 0x34, 0x99, 0x67, 0xFB },
-  { "LDY #$00                        ", 0xCD4D, 0x99, 0x34, 0x99, 0x67, 0xFB },
-  { "SEC                             ", 0xCD4F, 0x99, 0x34, 0x00, 0x67, 0xFB },
-  { "CLV                             ", 0xCD50, 0x99, 0x34, 0x00, 0x67, 0xFB },
-  { "TYA                             ", 0xCD51, 0x99, 0x34, 0x00, 0x27, 0xFB },
-  { "BNE $CD69                       ", 0xCD52, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BCC $CD69                       ", 0xCD54, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BVS $CD69                       ", 0xCD56, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BMI $CD69                       ", 0xCD58, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xCD5A, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BNE $CD69                       ", 0xCD5C, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "CPX #$34                        ", 0xCD5E, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BNE $CD69                       ", 0xCD60, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "CPY #$00                        ", 0xCD62, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "BNE $CD69                       ", 0xCD64, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "JMP $CD6D                       ", 0xCD66, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "NOP                             ", 0xCD6D, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "LDA #$85                        ", 0xCD6E, 0x00, 0x34, 0x00, 0x27, 0xFB },
-  { "LDX #$34                        ", 0xCD70, 0x85, 0x34, 0x00, 0xA5, 0xFB },
-  { "LDY #$99                        ", 0xCD72, 0x85, 0x34, 0x00, 0x25, 0xFB },
-  { "CLC                             ", 0xCD74, 0x85, 0x34, 0x99, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xCD75, 0x85, 0x34, 0x99, 0xA4, 0xFB },
-  { "TXA                             ", 0xCD77, 0x85, 0x34, 0x99, 0xE4, 0xFB },
-  { "BEQ $CDA8                       ", 0xCD78, 0x34, 0x34, 0x99, 0x64, 0xFB },
-  { "BCS $CDA8                       ", 0xCD7A, 0x34, 0x34, 0x99, 0x64, 0xFB },
-  { "BVC $CDA8                       ", 0xCD7C, 0x34, 0x34, 0x99, 0x64, 0xFB },
-  { "BMI $CDA8                       ", 0xCD7E, 0x34, 0x34, 0x99, 0x64, 0xFB },
-  { "CMP #$34                        ", 0xCD80, 0x34, 0x34, 0x99, 0x64, 0xFB },
-  { "BNE $CDA8                       ", 0xCD82, 0x34, 0x34, 0x99, 0x67, 0xFB },
-  { "CPX #$34                        ", 0xCD84, 0x34, 0x34, 0x99, 0x67, 0xFB },
-  { "BNE $CDA8                       ", 0xCD86, 0x34, 0x34, 0x99, 0x67, 0xFB },
-  { "CPY #$99                        ", 0xCD88, 0x34, 0x34, 0x99, 0x67, 0xFB },
-  { "BNE $CDA8                       ", 0xCD8A, 0x34, 0x34, 0x99, 0x67, 0xFB },
-  { "LDX #$00                        ", 0xCD8C, 0x34, 0x34, 0x99, 0x67, 0xFB },
-  { "SEC                             ", 0xCD8E, 0x34, 0x00, 0x99, 0x67, 0xFB },
-  { "CLV                             ", 0xCD8F, 0x34, 0x00, 0x99, 0x67, 0xFB },
-  { "TXA                             ", 0xCD90, 0x34, 0x00, 0x99, 0x27, 0xFB },
-  { "BNE $CDA8                       ", 0xCD91, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BCC $CDA8                       ", 0xCD93, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BVS $CDA8                       ", 0xCD95, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BMI $CDA8                       ", 0xCD97, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xCD99, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BNE $CDA8                       ", 0xCD9B, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "CPX #$00                        ", 0xCD9D, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BNE $CDA8                       ", 0xCD9F, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "CPY #$99                        ", 0xCDA1, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "BNE $CDA8                       ", 0xCDA3, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "JMP $CDAC                       ", 0xCDA5, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "NOP                             ", 0xCDAC, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "TSX                             ", 0xCDAD, 0x00, 0x00, 0x99, 0x27, 0xFB },
-  { "STX $07FF = 00                  ", 0xCDAE, 0x00, 0xFB, 0x99, 0xA5, 0xFB },
-  { "LDY #$33                        ", 0xCDB1, 0x00, 0xFB, 0x99, 0xA5, 0xFB },
-  { "LDX #$69                        ", 0xCDB3, 0x00, 0xFB, 0x33, 0x25, 0xFB },
-  { "LDA #$84                        ", 0xCDB5, 0x00, 0x69, 0x33, 0x25, 0xFB },
-  { "CLC                             ", 0xCDB7, 0x84, 0x69, 0x33, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xCDB8, 0x84, 0x69, 0x33, 0xA4, 0xFB },
-  { "TXS                             ", 0xCDBA, 0x84, 0x69, 0x33, 0xE4, 0xFB },
-  { "BEQ $CDEF                       ", 0xCDBB, 0x84, 0x69, 0x33, 0xE4, 0x69 },
-  { "BPL $CDEF                       ", 0xCDBD, 0x84, 0x69, 0x33, 0xE4, 0x69 },
-  { "BCS $CDEF                       ", 0xCDBF, 0x84, 0x69, 0x33, 0xE4, 0x69 },
-  { "BVC $CDEF                       ", 0xCDC1, 0x84, 0x69, 0x33, 0xE4, 0x69 },
-  { "CMP #$84                        ", 0xCDC3, 0x84, 0x69, 0x33, 0xE4, 0x69 },
-  { "BNE $CDEF                       ", 0xCDC5, 0x84, 0x69, 0x33, 0x67, 0x69 },
-  { "CPX #$69                        ", 0xCDC7, 0x84, 0x69, 0x33, 0x67, 0x69 },
-  { "BNE $CDEF                       ", 0xCDC9, 0x84, 0x69, 0x33, 0x67, 0x69 },
-  { "CPY #$33                        ", 0xCDCB, 0x84, 0x69, 0x33, 0x67, 0x69 },
-  { "BNE $CDEF                       ", 0xCDCD, 0x84, 0x69, 0x33, 0x67, 0x69 },
-  { "LDY #$01                        ", 0xCDCF, 0x84, 0x69, 0x33, 0x67, 0x69 },
-  { "LDA #$04                        ", 0xCDD1, 0x84, 0x69, 0x01, 0x65, 0x69 },
-  { "SEC                             ", 0xCDD3, 0x04, 0x69, 0x01, 0x65, 0x69 },
-  { "CLV                             ", 0xCDD4, 0x04, 0x69, 0x01, 0x65, 0x69 },
-  { "LDX #$00                        ", 0xCDD5, 0x04, 0x69, 0x01, 0x25, 0x69 },
-  { "TSX                             ", 0xCDD7, 0x04, 0x00, 0x01, 0x27, 0x69 },
-  { "BEQ $CDEF                       ", 0xCDD8, 0x04, 0x69, 0x01, 0x25, 0x69 },
-  { "BMI $CDEF                       ", 0xCDDA, 0x04, 0x69, 0x01, 0x25, 0x69 },
-  { "BCC $CDEF                       ", 0xCDDC, 0x04, 0x69, 0x01, 0x25, 0x69 },
-  { "BVS $CDEF                       ", 0xCDDE, 0x04, 0x69, 0x01, 0x25, 0x69 },
-  { "CPX #$69                        ", 0xCDE0, 0x04, 0x69, 0x01, 0x25, 0x69 },
-  { "BNE $CDEF                       ", 0xCDE2, 0x04, 0x69, 0x01, 0x27, 0x69 },
-  { "CMP #$04                        ", 0xCDE4, 0x04, 0x69, 0x01, 0x27, 0x69 },
-  { "BNE $CDEF                       ", 0xCDE6, 0x04, 0x69, 0x01, 0x27, 0x69 },
-  { "CPY #$01                        ", 0xCDE8, 0x04, 0x69, 0x01, 0x27, 0x69 },
-  { "BNE $CDEF                       ", 0xCDEA, 0x04, 0x69, 0x01, 0x27, 0x69 },
-  { "JMP $CDF3                       ", 0xCDEC, 0x04, 0x69, 0x01, 0x27, 0x69 },
-  { "LDX $07FF = FB                  ", 0xCDF3, 0x04, 0x69, 0x01, 0x27, 0x69 },
-  { "TXS                             ", 0xCDF6, 0x04, 0xFB, 0x01, 0xA5, 0x69 },
-  { "RTS                             ", 0xCDF7, 0x04, 0xFB, 0x01, 0xA5, 0xFB },
-  { "JSR $CDF8                       ", 0xC609, 0x04, 0xFB, 0x01, 0xA5, 0xFD },
-  { "LDA #$FF                        ", 0xCDF8, 0x04, 0xFB, 0x01, 0xA5, 0xFB },
-  { "STA $01 = FF                    ", 0xCDFA, 0xFF, 0xFB, 0x01, 0xA5, 0xFB },
-  { "TSX                             ", 0xCDFC, 0xFF, 0xFB, 0x01, 0xA5, 0xFB },
-  { "STX $07FF = FB                  ", 0xCDFD, 0xFF, 0xFB, 0x01, 0xA5, 0xFB },
-  { "NOP                             ", 0xCE00, 0xFF, 0xFB, 0x01, 0xA5, 0xFB },
-  { "LDX #$80                        ", 0xCE01, 0xFF, 0xFB, 0x01, 0xA5, 0xFB },
-  { "TXS                             ", 0xCE03, 0xFF, 0x80, 0x01, 0xA5, 0xFB },
-  { "LDA #$33                        ", 0xCE04, 0xFF, 0x80, 0x01, 0xA5, 0x80 },
-  { "PHA                             ", 0xCE06, 0x33, 0x80, 0x01, 0x25, 0x80 },
-  { "LDA #$69                        ", 0xCE07, 0x33, 0x80, 0x01, 0x25, 0x7F },
-  { "PHA                             ", 0xCE09, 0x69, 0x80, 0x01, 0x25, 0x7F },
-  { "TSX                             ", 0xCE0A, 0x69, 0x80, 0x01, 0x25, 0x7E },
-  { "CPX #$7E                        ", 0xCE0B, 0x69, 0x7E, 0x01, 0x25, 0x7E },
-  { "BNE $CE2F                       ", 0xCE0D, 0x69, 0x7E, 0x01, 0x27, 0x7E },
-  { "PLA                             ", 0xCE0F, 0x69, 0x7E, 0x01, 0x27, 0x7E },
-  { "CMP #$69                        ", 0xCE10, 0x69, 0x7E, 0x01, 0x25, 0x7F },
-  { "BNE $CE2F                       ", 0xCE12, 0x69, 0x7E, 0x01, 0x27, 0x7F },
-  { "PLA                             ", 0xCE14, 0x69, 0x7E, 0x01, 0x27, 0x7F },
-  { "CMP #$33                        ", 0xCE15, 0x33, 0x7E, 0x01, 0x25, 0x80 },
-  { "BNE $CE2F                       ", 0xCE17, 0x33, 0x7E, 0x01, 0x27, 0x80 },
-  { "TSX                             ", 0xCE19, 0x33, 0x7E, 0x01, 0x27, 0x80 },
-  { "CPX #$80                        ", 0xCE1A, 0x33, 0x80, 0x01, 0xA5, 0x80 },
-  { "BNE $CE2F                       ", 0xCE1C, 0x33, 0x80, 0x01, 0x27, 0x80 },
-  { "LDA $0180 = 33                  ", 0xCE1E, 0x33, 0x80, 0x01, 0x27, 0x80 },
-  { "CMP #$33                        ", 0xCE21, 0x33, 0x80, 0x01, 0x25, 0x80 },
-  { "BNE $CE2F                       ", 0xCE23, 0x33, 0x80, 0x01, 0x27, 0x80 },
-  { "LDA $017F = 69                  ", 0xCE25, 0x33, 0x80, 0x01, 0x27, 0x80 },
-  { "CMP #$69                        ", 0xCE28, 0x69, 0x80, 0x01, 0x25, 0x80 },
-  { "BNE $CE2F                       ", 0xCE2A, 0x69, 0x80, 0x01, 0x27, 0x80 },
-  { "JMP $CE33                       ", 0xCE2C, 0x69, 0x80, 0x01, 0x27, 0x80 },
-  { "NOP                             ", 0xCE33, 0x69, 0x80, 0x01, 0x27, 0x80 },
-  { "LDX #$80                        ", 0xCE34, 0x69, 0x80, 0x01, 0x27, 0x80 },
-  { "TXS                             ", 0xCE36, 0x69, 0x80, 0x01, 0xA5, 0x80 },
-  { "JSR $CE3D                       ", 0xCE37, 0x69, 0x80, 0x01, 0xA5, 0x80 },
-  { "TSX                             ", 0xCE3D, 0x69, 0x80, 0x01, 0xA5, 0x7E },
-  { "CPX #$7E                        ", 0xCE3E, 0x69, 0x7E, 0x01, 0x25, 0x7E },
-  { "BNE $CE5B                       ", 0xCE40, 0x69, 0x7E, 0x01, 0x27, 0x7E },
-  { "PLA                             ", 0xCE42, 0x69, 0x7E, 0x01, 0x27, 0x7E },
-  { "PLA                             ", 0xCE43, 0x39, 0x7E, 0x01, 0x25, 0x7F },
-  { "TSX                             ", 0xCE44, 0xCE, 0x7E, 0x01, 0xA5, 0x80 },
-  { "CPX #$80                        ", 0xCE45, 0xCE, 0x80, 0x01, 0xA5, 0x80 },
-  { "BNE $CE5B                       ", 0xCE47, 0xCE, 0x80, 0x01, 0x27, 0x80 },
-  { "LDA #$00                        ", 0xCE49, 0xCE, 0x80, 0x01, 0x27, 0x80 },
-  { "JSR $CE4E                       ", 0xCE4B, 0x00, 0x80, 0x01, 0x27, 0x80 },
-  { "PLA                             ", 0xCE4E, 0x00, 0x80, 0x01, 0x27, 0x7E },
-  { "CMP #$4D                        ", 0xCE4F, 0x4D, 0x80, 0x01, 0x25, 0x7F },
-  { "BNE $CE5B                       ", 0xCE51, 0x4D, 0x80, 0x01, 0x27, 0x7F },
-  { "PLA                             ", 0xCE53, 0x4D, 0x80, 0x01, 0x27, 0x7F },
-  { "CMP #$CE                        ", 0xCE54, 0xCE, 0x80, 0x01, 0xA5, 0x80 },
-  { "BNE $CE5B                       ", 0xCE56, 0xCE, 0x80, 0x01, 0x27, 0x80 },
-  { "JMP $CE5F                       ", 0xCE58, 0xCE, 0x80, 0x01, 0x27, 0x80 },
-  { "NOP                             ", 0xCE5F, 0xCE, 0x80, 0x01, 0x27, 0x80 },
-  { "LDA #$CE                        ", 0xCE60, 0xCE, 0x80, 0x01, 0x27, 0x80 },
-  { "PHA                             ", 0xCE62, 0xCE, 0x80, 0x01, 0xA5, 0x80 },
-  { "LDA #$66                        ", 0xCE63, 0xCE, 0x80, 0x01, 0xA5, 0x7F },
-  { "PHA                             ", 0xCE65, 0x66, 0x80, 0x01, 0x25, 0x7F },
-  { "RTS                             ", 0xCE66, 0x66, 0x80, 0x01, 0x25, 0x7E },
-  { "LDX #$77                        ", 0xCE67, 0x66, 0x80, 0x01, 0x25, 0x80 },
-  { "LDY #$69                        ", 0xCE69, 0x66, 0x77, 0x01, 0x25, 0x80 },
-  { "CLC                             ", 0xCE6B, 0x66, 0x77, 0x69, 0x25, 0x80 },
-  { "BIT $01 = FF                    ", 0xCE6C, 0x66, 0x77, 0x69, 0x24, 0x80 },
-  { "LDA #$83                        ", 0xCE6E, 0x66, 0x77, 0x69, 0xE4, 0x80 },
-  { "JSR $CE66                       ", 0xCE70, 0x83, 0x77, 0x69, 0xE4, 0x80 },
-  { "RTS                             ", 0xCE66, 0x83, 0x77, 0x69, 0xE4, 0x7E },
-  { "BEQ $CE99                       ", 0xCE73, 0x83, 0x77, 0x69, 0xE4, 0x80 },
-  { "BPL $CE99                       ", 0xCE75, 0x83, 0x77, 0x69, 0xE4, 0x80 },
-  { "BCS $CE99                       ", 0xCE77, 0x83, 0x77, 0x69, 0xE4, 0x80 },
-  { "BVC $CE99                       ", 0xCE79, 0x83, 0x77, 0x69, 0xE4, 0x80 },
-  { "CMP #$83                        ", 0xCE7B, 0x83, 0x77, 0x69, 0xE4, 0x80 },
-  { "BNE $CE99                       ", 0xCE7D, 0x83, 0x77, 0x69, 0x67, 0x80 },
-  { "CPY #$69                        ", 0xCE7F, 0x83, 0x77, 0x69, 0x67, 0x80 },
-  { "BNE $CE99                       ", 0xCE81, 0x83, 0x77, 0x69, 0x67, 0x80 },
-  { "CPX #$77                        ", 0xCE83, 0x83, 0x77, 0x69, 0x67, 0x80 },
-  { "BNE $CE99                       ", 0xCE85, 0x83, 0x77, 0x69, 0x67, 0x80 },
-  { "SEC                             ", 0xCE87, 0x83, 0x77, 0x69, 0x67, 0x80 },
-  { "CLV                             ", 0xCE88, 0x83, 0x77, 0x69, 0x67, 0x80 },
-  { "LDA #$00                        ", 0xCE89, 0x83, 0x77, 0x69, 0x27, 0x80 },
-  { "JSR $CE66                       ", 0xCE8B, 0x00, 0x77, 0x69, 0x27, 0x80 },
-  { "RTS                             ", 0xCE66, 0x00, 0x77, 0x69, 0x27, 0x7E },
-  { "BNE $CE99                       ", 0xCE8E, 0x00, 0x77, 0x69, 0x27, 0x80 },
-  { "BMI $CE99                       ", 0xCE90, 0x00, 0x77, 0x69, 0x27, 0x80 },
-  { "BCC $CE99                       ", 0xCE92, 0x00, 0x77, 0x69, 0x27, 0x80 },
-  { "BVS $CE99                       ", 0xCE94, 0x00, 0x77, 0x69, 0x27, 0x80 },
-  { "JMP $CE9D                       ", 0xCE96, 0x00, 0x77, 0x69, 0x27, 0x80 },
-  { "NOP                             ", 0xCE9D, 0x00, 0x77, 0x69, 0x27, 0x80 },
-  { "LDA #$CE                        ", 0xCE9E, 0x00, 0x77, 0x69, 0x27, 0x80 },
-  { "PHA                             ", 0xCEA0, 0xCE, 0x77, 0x69, 0xA5, 0x80 },
-  { "LDA #$AE                        ", 0xCEA1, 0xCE, 0x77, 0x69, 0xA5, 0x7F },
-  { "PHA                             ", 0xCEA3, 0xAE, 0x77, 0x69, 0xA5, 0x7F },
-  { "LDA #$65                        ", 0xCEA4, 0xAE, 0x77, 0x69, 0xA5, 0x7E },
-  { "PHA                             ", 0xCEA6, 0x65, 0x77, 0x69, 0x25, 0x7E },
-  { "LDA #$55                        ", 0xCEA7, 0x65, 0x77, 0x69, 0x25, 0x7D },
-  { "LDY #$88                        ", 0xCEA9, 0x55, 0x77, 0x69, 0x25, 0x7D },
-  { "LDX #$99                        ", 0xCEAB, 0x55, 0x77, 0x88, 0xA5, 0x7D },
-  { "RTI                             ", 0xCEAD, 0x55, 0x99, 0x88, 0xA5, 0x7D },
-  { "BMI $CEE5                       ", 0xCEAE, 0x55, 0x99, 0x88, 0x65, 0x80 },
-  { "BVC $CEE5                       ", 0xCEB0, 0x55, 0x99, 0x88, 0x65, 0x80 },
-  { "BEQ $CEE5                       ", 0xCEB2, 0x55, 0x99, 0x88, 0x65, 0x80 },
-  { "BCC $CEE5                       ", 0xCEB4, 0x55, 0x99, 0x88, 0x65, 0x80 },
-  { "CMP #$55                        ", 0xCEB6, 0x55, 0x99, 0x88, 0x65, 0x80 },
-  { "BNE $CEE5                       ", 0xCEB8, 0x55, 0x99, 0x88, 0x67, 0x80 },
-  { "CPY #$88                        ", 0xCEBA, 0x55, 0x99, 0x88, 0x67, 0x80 },
-  { "BNE $CEE5                       ", 0xCEBC, 0x55, 0x99, 0x88, 0x67, 0x80 },
-  { "CPX #$99                        ", 0xCEBE, 0x55, 0x99, 0x88, 0x67, 0x80 },
-  { "BNE $CEE5                       ", 0xCEC0, 0x55, 0x99, 0x88, 0x67, 0x80 },
-  { "LDA #$CE                        ", 0xCEC2, 0x55, 0x99, 0x88, 0x67, 0x80 },
-  { "PHA                             ", 0xCEC4, 0xCE, 0x99, 0x88, 0xE5, 0x80 },
-  { "LDA #$CE                        ", 0xCEC5, 0xCE, 0x99, 0x88, 0xE5, 0x7F },
-  { "PHA                             ", 0xCEC7, 0xCE, 0x99, 0x88, 0xE5, 0x7F },
-  { "LDA #$87                        ", 0xCEC8, 0xCE, 0x99, 0x88, 0xE5, 0x7E },
-  { "PHA                             ", 0xCECA, 0x87, 0x99, 0x88, 0xE5, 0x7E },
-  { "LDA #$55                        ", 0xCECB, 0x87, 0x99, 0x88, 0xE5, 0x7D },
-  { "RTI                             ", 0xCECD, 0x55, 0x99, 0x88, 0x65, 0x7D },
-  { "BPL $CEE5                       ", 0xCECE, 0x55, 0x99, 0x88, 0xA7, 0x80 },
-  { "BVS $CEE5                       ", 0xCED0, 0x55, 0x99, 0x88, 0xA7, 0x80 },
-  { "BNE $CEE5                       ", 0xCED2, 0x55, 0x99, 0x88, 0xA7, 0x80 },
-  { "BCC $CEE5                       ", 0xCED4, 0x55, 0x99, 0x88, 0xA7, 0x80 },
-  { "CMP #$55                        ", 0xCED6, 0x55, 0x99, 0x88, 0xA7, 0x80 },
-  { "BNE $CEE5                       ", 0xCED8, 0x55, 0x99, 0x88, 0x27, 0x80 },
-  { "CPY #$88                        ", 0xCEDA, 0x55, 0x99, 0x88, 0x27, 0x80 },
-  { "BNE $CEE5                       ", 0xCEDC, 0x55, 0x99, 0x88, 0x27, 0x80 },
-  { "CPX #$99                        ", 0xCEDE, 0x55, 0x99, 0x88, 0x27, 0x80 },
-  { "BNE $CEE5                       ", 0xCEE0, 0x55, 0x99, 0x88, 0x27, 0x80 },
-  { "JMP $CEE9                       ", 0xCEE2, 0x55, 0x99, 0x88, 0x27, 0x80 },
-  { "LDX $07FF = FB                  ", 0xCEE9, 0x55, 0x99, 0x88, 0x27, 0x80 },
-  { "TXS                             ", 0xCEEC, 0x55, 0xFB, 0x88, 0xA5, 0x80 },
-  { "RTS                             ", 0xCEED, 0x55, 0xFB, 0x88, 0xA5, 0xFB },
-  { "JSR $CEEE                       ", 0xC60C, 0x55, 0xFB, 0x88, 0xA5, 0xFD },
-  { "LDX #$55                        ", 0xCEEE, 0x55, 0xFB, 0x88, 0xA5, 0xFB },
-  { "LDY #$69                        ", 0xCEF0, 0x55, 0x55, 0x88, 0x25, 0xFB },
-  { "LDA #$FF                        ", 0xCEF2, 0x55, 0x55, 0x69, 0x25, 0xFB },
-  { "STA $01 = FF                    ", 0xCEF4, 0xFF, 0x55, 0x69, 0xA5, 0xFB },
-  { "NOP                             ", 0xCEF6, 0xFF, 0x55, 0x69, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xCEF7, 0xFF, 0x55, 0x69, 0xA5, 0xFB },
-  { "SEC                             ", 0xCEF9, 0xFF, 0x55, 0x69, 0xE5, 0xFB },
-  { "LDA #$01                        ", 0xCEFA, 0xFF, 0x55, 0x69, 0xE5, 0xFB },
-  { "LSR A                           ", 0xCEFC, 0x01, 0x55, 0x69, 0x65, 0xFB },
-  { "BCC $CF1C                       ", 0xCEFD, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "BNE $CF1C                       ", 0xCEFF, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "BMI $CF1C                       ", 0xCF01, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "BVC $CF1C                       ", 0xCF03, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "CMP #$00                        ", 0xCF05, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "BNE $CF1C                       ", 0xCF07, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "CLV                             ", 0xCF09, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "LDA #$AA                        ", 0xCF0A, 0x00, 0x55, 0x69, 0x27, 0xFB },
-  { "LSR A                           ", 0xCF0C, 0xAA, 0x55, 0x69, 0xA5, 0xFB },
-  { "BCS $CF1C                       ", 0xCF0D, 0x55, 0x55, 0x69, 0x24, 0xFB },
-  { "BEQ $CF1C                       ", 0xCF0F, 0x55, 0x55, 0x69, 0x24, 0xFB },
-  { "BMI $CF1C                       ", 0xCF11, 0x55, 0x55, 0x69, 0x24, 0xFB },
-  { "BVS $CF1C                       ", 0xCF13, 0x55, 0x55, 0x69, 0x24, 0xFB },
-  { "CMP #$55                        ", 0xCF15, 0x55, 0x55, 0x69, 0x24, 0xFB },
-  { "BNE $CF1C                       ", 0xCF17, 0x55, 0x55, 0x69, 0x27, 0xFB },
-  { "JMP $CF20                       ", 0xCF19, 0x55, 0x55, 0x69, 0x27, 0xFB },
-  { "NOP                             ", 0xCF20, 0x55, 0x55, 0x69, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xCF21, 0x55, 0x55, 0x69, 0x27, 0xFB },
-  { "SEC                             ", 0xCF23, 0x55, 0x55, 0x69, 0xE5, 0xFB },
-  { "LDA #$80                        ", 0xCF24, 0x55, 0x55, 0x69, 0xE5, 0xFB },
-  { "ASL A                           ", 0xCF26, 0x80, 0x55, 0x69, 0xE5, 0xFB },
-  { "BCC $CF47                       ", 0xCF27, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "BNE $CF47                       ", 0xCF29, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "BMI $CF47                       ", 0xCF2B, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "BVC $CF47                       ", 0xCF2D, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "CMP #$00                        ", 0xCF2F, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "BNE $CF47                       ", 0xCF31, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "CLV                             ", 0xCF33, 0x00, 0x55, 0x69, 0x67, 0xFB },
-  { "SEC                             ", 0xCF34, 0x00, 0x55, 0x69, 0x27, 0xFB },
-  { "LDA #$55                        ", 0xCF35, 0x00, 0x55, 0x69, 0x27, 0xFB },
-  { "ASL A                           ", 0xCF37, 0x55, 0x55, 0x69, 0x25, 0xFB },
-  { "BCS $CF47                       ", 0xCF38, 0xAA, 0x55, 0x69, 0xA4, 0xFB },
-  { "BEQ $CF47                       ", 0xCF3A, 0xAA, 0x55, 0x69, 0xA4, 0xFB },
-  { "BPL $CF47                       ", 0xCF3C, 0xAA, 0x55, 0x69, 0xA4, 0xFB },
-  { "BVS $CF47                       ", 0xCF3E, 0xAA, 0x55, 0x69, 0xA4, 0xFB },
-  { "CMP #$AA                        ", 0xCF40, 0xAA, 0x55, 0x69, 0xA4, 0xFB },
-  { "BNE $CF47                       ", 0xCF42, 0xAA, 0x55, 0x69, 0x27, 0xFB },
-  { "JMP $CF4B                       ", 0xCF44, 0xAA, 0x55, 0x69, 0x27, 0xFB },
-  { "NOP                             ", 0xCF4B, 0xAA, 0x55, 0x69, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xCF4C, 0xAA, 0x55, 0x69, 0x27, 0xFB },
-  { "SEC                             ", 0xCF4E, 0xAA, 0x55, 0x69, 0xE5, 0xFB },
-  { "LDA #$01                        ", 0xCF4F, 0xAA, 0x55, 0x69, 0xE5, 0xFB },
-  { "ROR A                           ", 0xCF51, 0x01, 0x55, 0x69, 0x65, 0xFB },
-  { "BCC $CF72                       ", 0xCF52, 0x80, 0x55, 0x69, 0xE5, 0xFB },
-  { "BEQ $CF72                       ", 0xCF54, 0x80, 0x55, 0x69, 0xE5, 0xFB },
-  { "BPL $CF72                       ", 0xCF56, 0x80, 0x55, 0x69, 0xE5, 0xFB },
-  { "BVC $CF72                       ", 0xCF58, 0x80, 0x55, 0x69, 0xE5, 0xFB },
-  { "CMP #$80                        ", 0xCF5A, 0x80, 0x55, 0x69, 0xE5, 0xFB },
-  { "BNE $CF72                       ", 0xCF5C, 0x80, 0x55, 0x69, 0x67, 0xFB },
-  { "CLV                             ", 0xCF5E, 0x80, 0x55, 0x69, 0x67, 0xFB },
-  { "CLC                             ", 0xCF5F, 0x80, 0x55, 0x69, 0x27, 0xFB },
-  { "LDA #$55                        ", 0xCF60, 0x80, 0x55, 0x69, 0x26, 0xFB },
-  { "ROR A                           ", 0xCF62, 0x55, 0x55, 0x69, 0x24, 0xFB },
-  { "BCC $CF72                       ", 0xCF63, 0x2A, 0x55, 0x69, 0x25, 0xFB },
-  { "BEQ $CF72                       ", 0xCF65, 0x2A, 0x55, 0x69, 0x25, 0xFB },
-  { "BMI $CF72                       ", 0xCF67, 0x2A, 0x55, 0x69, 0x25, 0xFB },
-  { "BVS $CF72                       ", 0xCF69, 0x2A, 0x55, 0x69, 0x25, 0xFB },
-  { "CMP #$2A                        ", 0xCF6B, 0x2A, 0x55, 0x69, 0x25, 0xFB },
-  { "BNE $CF72                       ", 0xCF6D, 0x2A, 0x55, 0x69, 0x27, 0xFB },
-  { "JMP $CF76                       ", 0xCF6F, 0x2A, 0x55, 0x69, 0x27, 0xFB },
-  { "NOP                             ", 0xCF76, 0x2A, 0x55, 0x69, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xCF77, 0x2A, 0x55, 0x69, 0x27, 0xFB },
-  { "SEC                             ", 0xCF79, 0x2A, 0x55, 0x69, 0xE5, 0xFB },
-  { "LDA #$80                        ", 0xCF7A, 0x2A, 0x55, 0x69, 0xE5, 0xFB },
-  { "ROL A                           ", 0xCF7C, 0x80, 0x55, 0x69, 0xE5, 0xFB },
-  { "BCC $CF9D                       ", 0xCF7D, 0x01, 0x55, 0x69, 0x65, 0xFB },
-  { "BEQ $CF9D                       ", 0xCF7F, 0x01, 0x55, 0x69, 0x65, 0xFB },
-  { "BMI $CF9D                       ", 0xCF81, 0x01, 0x55, 0x69, 0x65, 0xFB },
-  { "BVC $CF9D                       ", 0xCF83, 0x01, 0x55, 0x69, 0x65, 0xFB },
-  { "CMP #$01                        ", 0xCF85, 0x01, 0x55, 0x69, 0x65, 0xFB },
-  { "BNE $CF9D                       ", 0xCF87, 0x01, 0x55, 0x69, 0x67, 0xFB },
-  { "CLV                             ", 0xCF89, 0x01, 0x55, 0x69, 0x67, 0xFB },
-  { "CLC                             ", 0xCF8A, 0x01, 0x55, 0x69, 0x27, 0xFB },
-  { "LDA #$55                        ", 0xCF8B, 0x01, 0x55, 0x69, 0x26, 0xFB },
-  { "ROL A                           ", 0xCF8D, 0x55, 0x55, 0x69, 0x24, 0xFB },
-  { "BCS $CF9D                       ", 0xCF8E, 0xAA, 0x55, 0x69, 0xA4, 0xFB },
-  { "BEQ $CF9D                       ", 0xCF90, 0xAA, 0x55, 0x69, 0xA4, 0xFB },
-  { "BPL $CF9D                       ", 0xCF92, 0xAA, 0x55, 0x69, 0xA4, 0xFB },
-  { "BVS $CF9D                       ", 0xCF94, 0xAA, 0x55, 0x69, 0xA4, 0xFB },
-  { "CMP #$AA                        ", 0xCF96, 0xAA, 0x55, 0x69, 0xA4, 0xFB },
-  { "BNE $CF9D                       ", 0xCF98, 0xAA, 0x55, 0x69, 0x27, 0xFB },
-  { "JMP $CFA1                       ", 0xCF9A, 0xAA, 0x55, 0x69, 0x27, 0xFB },
-  { "RTS                             ", 0xCFA1, 0xAA, 0x55, 0x69, 0x27, 0xFB },
-  { "JSR $CFA2                       ", 0xC60F, 0xAA, 0x55, 0x69, 0x27, 0xFD },
-  { "LDA $00 = 00                    ", 0xCFA2, 0xAA, 0x55, 0x69, 0x27, 0xFB },
-  { "STA $07FF = FB                  ", 0xCFA4, 0x00, 0x55, 0x69, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xCFA7, 0x00, 0x55, 0x69, 0x27, 0xFB },
-  { "STA $80 = 00                    ", 0xCFA9, 0x00, 0x55, 0x69, 0x27, 0xFB },
-  { "LDA #$02                        ", 0xCFAB, 0x00, 0x55, 0x69, 0x27, 0xFB },
-  { "STA $81 = 00                    ", 0xCFAD, 0x02, 0x55, 0x69, 0x25, 0xFB },
-  { "LDA #$FF                        ", 0xCFAF, 0x02, 0x55, 0x69, 0x25, 0xFB },
-  { "STA $01 = FF                    ", 0xCFB1, 0xFF, 0x55, 0x69, 0xA5, 0xFB },
-  { "LDA #$00                        ", 0xCFB3, 0xFF, 0x55, 0x69, 0xA5, 0xFB },
-  { "STA $82 = 00                    ", 0xCFB5, 0x00, 0x55, 0x69, 0x27, 0xFB },
-  { "LDA #$03                        ", 0xCFB7, 0x00, 0x55, 0x69, 0x27, 0xFB },
-  { "STA $83 = 00                    ", 0xCFB9, 0x03, 0x55, 0x69, 0x25, 0xFB },
-  { "STA $84 = 00                    ", 0xCFBB, 0x03, 0x55, 0x69, 0x25, 0xFB },
-  { "LDA #$00                        ", 0xCFBD, 0x03, 0x55, 0x69, 0x25, 0xFB },
-  { "STA $FF = 00                    ", 0xCFBF, 0x00, 0x55, 0x69, 0x27, 0xFB },
-  { "LDA #$04                        ", 0xCFC1, 0x00, 0x55, 0x69, 0x27, 0xFB },
-  { "STA $00 = 00                    ", 0xCFC3, 0x04, 0x55, 0x69, 0x25, 0xFB },
-  { "LDA #$5A                        ", 0xCFC5, 0x04, 0x55, 0x69, 0x25, 0xFB },
-  { "STA $0200 = 00                  ", 0xCFC7, 0x5A, 0x55, 0x69, 0x25, 0xFB },
-  { "LDA #$5B                        ", 0xCFCA, 0x5A, 0x55, 0x69, 0x25, 0xFB },
-  { "STA $0300 = 00                  ", 0xCFCC, 0x5B, 0x55, 0x69, 0x25, 0xFB },
-  { "LDA #$5C                        ", 0xCFCF, 0x5B, 0x55, 0x69, 0x25, 0xFB },
-  { "STA $0303 = 00                  ", 0xCFD1, 0x5C, 0x55, 0x69, 0x25, 0xFB },
-  { "LDA #$5D                        ", 0xCFD4, 0x5C, 0x55, 0x69, 0x25, 0xFB },
-  { "STA $0400 = 00                  ", 0xCFD6, 0x5D, 0x55, 0x69, 0x25, 0xFB },
-  { "LDX #$00                        ", 0xCFD9, 0x5D, 0x55, 0x69, 0x25, 0xFB },
-  { "LDA ($80,X) @ 80 = 0200 = 5A    ", 0xCFDB, 0x5D, 0x00, 0x69, 0x27, 0xFB },
-  { "CMP #$5A                        ", 0xCFDD, 0x5A, 0x00, 0x69, 0x25, 0xFB },
-  { "BNE $D000                       ", 0xCFDF, 0x5A, 0x00, 0x69, 0x27, 0xFB },
-  { "INX                             ", 0xCFE1, 0x5A, 0x00, 0x69, 0x27, 0xFB },
-  { "INX                             ", 0xCFE2, 0x5A, 0x01, 0x69, 0x25, 0xFB },
-  { "LDA ($80,X) @ 82 = 0300 = 5B    ", 0xCFE3, 0x5A, 0x02, 0x69, 0x25, 0xFB },
-  { "CMP #$5B                        ", 0xCFE5, 0x5B, 0x02, 0x69, 0x25, 0xFB },
-  { "BNE $D000                       ", 0xCFE7, 0x5B, 0x02, 0x69, 0x27, 0xFB },
-  { "INX                             ", 0xCFE9, 0x5B, 0x02, 0x69, 0x27, 0xFB },
-  { "LDA ($80,X) @ 83 = 0303 = 5C    ", 0xCFEA, 0x5B, 0x03, 0x69, 0x25, 0xFB },
-  { "CMP #$5C                        ", 0xCFEC, 0x5C, 0x03, 0x69, 0x25, 0xFB },
-  { "BNE $D000                       ", 0xCFEE, 0x5C, 0x03, 0x69, 0x27, 0xFB },
-  { "LDX #$00                        ", 0xCFF0, 0x5C, 0x03, 0x69, 0x27, 0xFB },
-  { "LDA ($FF,X) @ FF = 0400 = 5D    ", 0xCFF2, 0x5C, 0x00, 0x69, 0x27, 0xFB },
-  { "CMP #$5D                        ", 0xCFF4, 0x5D, 0x00, 0x69, 0x25, 0xFB },
-  { "BNE $D000                       ", 0xCFF6, 0x5D, 0x00, 0x69, 0x27, 0xFB },
-  { "LDX #$81                        ", 0xCFF8, 0x5D, 0x00, 0x69, 0x27, 0xFB },
-  { "LDA ($FF,X) @ 80 = 0200 = 5A    ", 0xCFFA, 0x5D, 0x81, 0x69, 0xA5, 0xFB },
-  { "CMP #$5A                        ", 0xCFFC, 0x5A, 0x81, 0x69, 0x25, 0xFB },
-  { "BEQ $D005                       ", 0xCFFE, 0x5A, 0x81, 0x69, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xD005, 0x5A, 0x81, 0x69, 0x27, 0xFB },
-  { "LDX #$00                        ", 0xD007, 0xAA, 0x81, 0x69, 0xA5, 0xFB },
-  { "STA ($80,X) @ 80 = 0200 = 5A    ", 0xD009, 0xAA, 0x00, 0x69, 0x27, 0xFB },
-  { "INX                             ", 0xD00B, 0xAA, 0x00, 0x69, 0x27, 0xFB },
-  { "INX                             ", 0xD00C, 0xAA, 0x01, 0x69, 0x25, 0xFB },
-  { "LDA #$AB                        ", 0xD00D, 0xAA, 0x02, 0x69, 0x25, 0xFB },
-  { "STA ($80,X) @ 82 = 0300 = 5B    ", 0xD00F, 0xAB, 0x02, 0x69, 0xA5, 0xFB },
-  { "INX                             ", 0xD011, 0xAB, 0x02, 0x69, 0xA5, 0xFB },
-  { "LDA #$AC                        ", 0xD012, 0xAB, 0x03, 0x69, 0x25, 0xFB },
-  { "STA ($80,X) @ 83 = 0303 = 5C    ", 0xD014, 0xAC, 0x03, 0x69, 0xA5, 0xFB },
-  { "LDX #$00                        ", 0xD016, 0xAC, 0x03, 0x69, 0xA5, 0xFB },
-  { "LDA #$AD                        ", 0xD018, 0xAC, 0x00, 0x69, 0x27, 0xFB },
-  { "STA ($FF,X) @ FF = 0400 = 5D    ", 0xD01A, 0xAD, 0x00, 0x69, 0xA5, 0xFB },
-  { "LDA $0200 = AA                  ", 0xD01C, 0xAD, 0x00, 0x69, 0xA5, 0xFB },
-  { "CMP #$AA                        ", 0xD01F, 0xAA, 0x00, 0x69, 0xA5, 0xFB },
-  { "BNE $D038                       ", 0xD021, 0xAA, 0x00, 0x69, 0x27, 0xFB },
-  { "LDA $0300 = AB                  ", 0xD023, 0xAA, 0x00, 0x69, 0x27, 0xFB },
-  { "CMP #$AB                        ", 0xD026, 0xAB, 0x00, 0x69, 0xA5, 0xFB },
-  { "BNE $D038                       ", 0xD028, 0xAB, 0x00, 0x69, 0x27, 0xFB },
-  { "LDA $0303 = AC                  ", 0xD02A, 0xAB, 0x00, 0x69, 0x27, 0xFB },
-  { "CMP #$AC                        ", 0xD02D, 0xAC, 0x00, 0x69, 0xA5, 0xFB },
-  { "BNE $D038                       ", 0xD02F, 0xAC, 0x00, 0x69, 0x27, 0xFB },
-  { "LDA $0400 = AD                  ", 0xD031, 0xAC, 0x00, 0x69, 0x27, 0xFB },
-  { "CMP #$AD                        ", 0xD034, 0xAD, 0x00, 0x69, 0xA5, 0xFB },
-  { "BEQ $D03D                       ", 0xD036, 0xAD, 0x00, 0x69, 0x27, 0xFB },
-  { "LDA $07FF = 00                  ", 0xD03D, 0xAD, 0x00, 0x69, 0x27, 0xFB },
-  { "STA $00 = 04                    ", 0xD040, 0x00, 0x00, 0x69, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xD042, 0x00, 0x00, 0x69, 0x27, 0xFB },
-  { "STA $0300 = AB                  ", 0xD044, 0x00, 0x00, 0x69, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xD047, 0x00, 0x00, 0x69, 0x27, 0xFB },
-  { "STA $0200 = AA                  ", 0xD049, 0xAA, 0x00, 0x69, 0xA5, 0xFB },
-  { "LDX #$00                        ", 0xD04C, 0xAA, 0x00, 0x69, 0xA5, 0xFB },
-  { "LDY #$5A                        ", 0xD04E, 0xAA, 0x00, 0x69, 0x27, 0xFB },
-  { "JSR $F7B6                       ", 0xD050, 0xAA, 0x00, 0x5A, 0x25, 0xFB },
-  { "CLC                             ", 0xF7B6, 0xAA, 0x00, 0x5A, 0x25, 0xF9 },
-  { "LDA #$FF                        ", 0xF7B7, 0xAA, 0x00, 0x5A, 0x24, 0xF9 },
-  { "STA $01 = FF                    ", 0xF7B9, 0xFF, 0x00, 0x5A, 0xA4, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF7BB, 0xFF, 0x00, 0x5A, 0xA4, 0xF9 },
-  { "LDA #$55                        ", 0xF7BD, 0xFF, 0x00, 0x5A, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF7BF, 0x55, 0x00, 0x5A, 0x64, 0xF9 },
-  { "ORA ($80,X) @ 80 = 0200 = AA    ", 0xD053, 0x55, 0x00, 0x5A, 0x64, 0xFB },
-  { "JSR $F7C0                       ", 0xD055, 0xFF, 0x00, 0x5A, 0xE4, 0xFB },
-  { "BCS $F7CB                       ", 0xF7C0, 0xFF, 0x00, 0x5A, 0xE4, 0xF9 },
-  { "BPL $F7CB                       ", 0xF7C2, 0xFF, 0x00, 0x5A, 0xE4, 0xF9 },
-  { "CMP #$FF                        ", 0xF7C4, 0xFF, 0x00, 0x5A, 0xE4, 0xF9 },
-  { "BNE $F7CB                       ", 0xF7C6, 0xFF, 0x00, 0x5A, 0x67, 0xF9 },
-  { "BVC $F7CB                       ", 0xF7C8, 0xFF, 0x00, 0x5A, 0x67, 0xF9 },
-  { "RTS                             ", 0xF7CA, 0xFF, 0x00, 0x5A, 0x67, 0xF9 },
-  { "INY                             ", 0xD058, 0xFF, 0x00, 0x5A, 0x67, 0xFB },
-  { "JSR $F7CE                       ", 0xD059, 0xFF, 0x00, 0x5B, 0x65, 0xFB },
-  { "SEC                             ", 0xF7CE, 0xFF, 0x00, 0x5B, 0x65, 0xF9 },
-  { "CLV                             ", 0xF7CF, 0xFF, 0x00, 0x5B, 0x65, 0xF9 },
-  { "LDA #$00                        ", 0xF7D0, 0xFF, 0x00, 0x5B, 0x25, 0xF9 },
-  { "RTS                             ", 0xF7D2, 0x00, 0x00, 0x5B, 0x27, 0xF9 },
-  { "ORA ($82,X) @ 82 = 0300 = 00    ", 0xD05C, 0x00, 0x00, 0x5B, 0x27, 0xFB },
-  { "JSR $F7D3                       ", 0xD05E, 0x00, 0x00, 0x5B, 0x27, 0xFB },
-  { "BNE $F7DC                       ", 0xF7D3, 0x00, 0x00, 0x5B, 0x27, 0xF9 },
-  { "BVS $F7DC                       ", 0xF7D5, 0x00, 0x00, 0x5B, 0x27, 0xF9 },
-  { "BCC $F7DC                       ", 0xF7D7, 0x00, 0x00, 0x5B, 0x27, 0xF9 },
-  { "BMI $F7DC                       ", 0xF7D9, 0x00, 0x00, 0x5B, 0x27, 0xF9 },
-  { "RTS                             ", 0xF7DB, 0x00, 0x00, 0x5B, 0x27, 0xF9 },
-  { "INY                             ", 0xD061, 0x00, 0x00, 0x5B, 0x27, 0xFB },
-  { "JSR $F7DF                       ", 0xD062, 0x00, 0x00, 0x5C, 0x25, 0xFB },
-  { "CLC                             ", 0xF7DF, 0x00, 0x00, 0x5C, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF7E0, 0x00, 0x00, 0x5C, 0x24, 0xF9 },
-  { "LDA #$55                        ", 0xF7E2, 0x00, 0x00, 0x5C, 0xE6, 0xF9 },
-  { "RTS                             ", 0xF7E4, 0x55, 0x00, 0x5C, 0x64, 0xF9 },
-  { "AND ($80,X) @ 80 = 0200 = AA    ", 0xD065, 0x55, 0x00, 0x5C, 0x64, 0xFB },
-  { "JSR $F7E5                       ", 0xD067, 0x00, 0x00, 0x5C, 0x66, 0xFB },
-  { "BNE $F7EE                       ", 0xF7E5, 0x00, 0x00, 0x5C, 0x66, 0xF9 },
-  { "BVC $F7EE                       ", 0xF7E7, 0x00, 0x00, 0x5C, 0x66, 0xF9 },
-  { "BCS $F7EE                       ", 0xF7E9, 0x00, 0x00, 0x5C, 0x66, 0xF9 },
-  { "BMI $F7EE                       ", 0xF7EB, 0x00, 0x00, 0x5C, 0x66, 0xF9 },
-  { "RTS                             ", 0xF7ED, 0x00, 0x00, 0x5C, 0x66, 0xF9 },
-  { "INY                             ", 0xD06A, 0x00, 0x00, 0x5C, 0x66, 0xFB },
-  { "LDA #$EF                        ", 0xD06B, 0x00, 0x00, 0x5D, 0x64, 0xFB },
-  { "STA $0300 = 00                  ", 0xD06D, 0xEF, 0x00, 0x5D, 0xE4, 0xFB },
-  { "JSR $F7F1                       ", 0xD070, 0xEF, 0x00, 0x5D, 0xE4, 0xFB },
-  { "SEC                             ", 0xF7F1, 0xEF, 0x00, 0x5D, 0xE4, 0xF9 },
-  { "CLV                             ", 0xF7F2, 0xEF, 0x00, 0x5D, 0xE5, 0xF9 },
-  { "LDA #$F8                        ", 0xF7F3, 0xEF, 0x00, 0x5D, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF7F5, 0xF8, 0x00, 0x5D, 0xA5, 0xF9 },
-  { "AND ($82,X) @ 82 = 0300 = EF    ", 0xD073, 0xF8, 0x00, 0x5D, 0xA5, 0xFB },
-  { "JSR $F7F6                       ", 0xD075, 0xE8, 0x00, 0x5D, 0xA5, 0xFB },
-  { "BCC $F801                       ", 0xF7F6, 0xE8, 0x00, 0x5D, 0xA5, 0xF9 },
-  { "BPL $F801                       ", 0xF7F8, 0xE8, 0x00, 0x5D, 0xA5, 0xF9 },
-  { "CMP #$E8                        ", 0xF7FA, 0xE8, 0x00, 0x5D, 0xA5, 0xF9 },
-  { "BNE $F801                       ", 0xF7FC, 0xE8, 0x00, 0x5D, 0x27, 0xF9 },
-  { "BVS $F801                       ", 0xF7FE, 0xE8, 0x00, 0x5D, 0x27, 0xF9 },
-  { "RTS                             ", 0xF800, 0xE8, 0x00, 0x5D, 0x27, 0xF9 },
-  { "INY                             ", 0xD078, 0xE8, 0x00, 0x5D, 0x27, 0xFB },
-  { "JSR $F804                       ", 0xD079, 0xE8, 0x00, 0x5E, 0x25, 0xFB },
-  { "CLC                             ", 0xF804, 0xE8, 0x00, 0x5E, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF805, 0xE8, 0x00, 0x5E, 0x24, 0xF9 },
-  { "LDA #$5F                        ", 0xF807, 0xE8, 0x00, 0x5E, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF809, 0x5F, 0x00, 0x5E, 0x64, 0xF9 },
-  { "EOR ($80,X) @ 80 = 0200 = AA    ", 0xD07C, 0x5F, 0x00, 0x5E, 0x64, 0xFB },
-  { "JSR $F80A                       ", 0xD07E, 0xF5, 0x00, 0x5E, 0xE4, 0xFB },
-  { "BCS $F815                       ", 0xF80A, 0xF5, 0x00, 0x5E, 0xE4, 0xF9 },
-  { "BPL $F815                       ", 0xF80C, 0xF5, 0x00, 0x5E, 0xE4, 0xF9 },
-  { "CMP #$F5                        ", 0xF80E, 0xF5, 0x00, 0x5E, 0xE4, 0xF9 },
-  { "BNE $F815                       ", 0xF810, 0xF5, 0x00, 0x5E, 0x67, 0xF9 },
-  { "BVC $F815                       ", 0xF812, 0xF5, 0x00, 0x5E, 0x67, 0xF9 },
-  { "RTS                             ", 0xF814, 0xF5, 0x00, 0x5E, 0x67, 0xF9 },
-  { "INY                             ", 0xD081, 0xF5, 0x00, 0x5E, 0x67, 0xFB },
-  { "LDA #$70                        ", 0xD082, 0xF5, 0x00, 0x5F, 0x65, 0xFB },
-  { "STA $0300 = EF                  ", 0xD084, 0x70, 0x00, 0x5F, 0x65, 0xFB },
-  { "JSR $F818                       ", 0xD087, 0x70, 0x00, 0x5F, 0x65, 0xFB },
-  { "SEC                             ", 0xF818, 0x70, 0x00, 0x5F, 0x65, 0xF9 },
-  { "CLV                             ", 0xF819, 0x70, 0x00, 0x5F, 0x65, 0xF9 },
-  { "LDA #$70                        ", 0xF81A, 0x70, 0x00, 0x5F, 0x25, 0xF9 },
-  { "RTS                             ", 0xF81C, 0x70, 0x00, 0x5F, 0x25, 0xF9 },
-  { "EOR ($82,X) @ 82 = 0300 = 70    ", 0xD08A, 0x70, 0x00, 0x5F, 0x25, 0xFB },
-  { "JSR $F81D                       ", 0xD08C, 0x00, 0x00, 0x5F, 0x27, 0xFB },
-  { "BNE $F826                       ", 0xF81D, 0x00, 0x00, 0x5F, 0x27, 0xF9 },
-  { "BVS $F826                       ", 0xF81F, 0x00, 0x00, 0x5F, 0x27, 0xF9 },
-  { "BCC $F826                       ", 0xF821, 0x00, 0x00, 0x5F, 0x27, 0xF9 },
-  { "BMI $F826                       ", 0xF823, 0x00, 0x00, 0x5F, 0x27, 0xF9 },
-  { "RTS                             ", 0xF825, 0x00, 0x00, 0x5F, 0x27, 0xF9 },
-  { "INY                             ", 0xD08F, 0x00, 0x00, 0x5F, 0x27, 0xFB },
-  { "LDA #$69                        ", 0xD090, 0x00, 0x00, 0x60, 0x25, 0xFB },
-  { "STA $0200 = AA                  ", 0xD092, 0x69, 0x00, 0x60, 0x25, 0xFB },
-  { "JSR $F829                       ", 0xD095, 0x69, 0x00, 0x60, 0x25, 0xFB },
-  { "CLC                             ", 0xF829, 0x69, 0x00, 0x60, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF82A, 0x69, 0x00, 0x60, 0x24, 0xF9 },
-  { "LDA #$00                        ", 0xF82C, 0x69, 0x00, 0x60, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF82E, 0x00, 0x00, 0x60, 0x66, 0xF9 },
-  { "ADC ($80,X) @ 80 = 0200 = 69    ", 0xD098, 0x00, 0x00, 0x60, 0x66, 0xFB },
-  { "JSR $F82F                       ", 0xD09A, 0x69, 0x00, 0x60, 0x24, 0xFB },
-  { "BMI $F83A                       ", 0xF82F, 0x69, 0x00, 0x60, 0x24, 0xF9 },
-  { "BCS $F83A                       ", 0xF831, 0x69, 0x00, 0x60, 0x24, 0xF9 },
-  { "CMP #$69                        ", 0xF833, 0x69, 0x00, 0x60, 0x24, 0xF9 },
-  { "BNE $F83A                       ", 0xF835, 0x69, 0x00, 0x60, 0x27, 0xF9 },
-  { "BVS $F83A                       ", 0xF837, 0x69, 0x00, 0x60, 0x27, 0xF9 },
-  { "RTS                             ", 0xF839, 0x69, 0x00, 0x60, 0x27, 0xF9 },
-  { "INY                             ", 0xD09D, 0x69, 0x00, 0x60, 0x27, 0xFB },
-  { "JSR $F83D                       ", 0xD09E, 0x69, 0x00, 0x61, 0x25, 0xFB },
-  { "SEC                             ", 0xF83D, 0x69, 0x00, 0x61, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF83E, 0x69, 0x00, 0x61, 0x25, 0xF9 },
-  { "LDA #$00                        ", 0xF840, 0x69, 0x00, 0x61, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF842, 0x00, 0x00, 0x61, 0x67, 0xF9 },
-  { "ADC ($80,X) @ 80 = 0200 = 69    ", 0xD0A1, 0x00, 0x00, 0x61, 0x67, 0xFB },
-  { "JSR $F843                       ", 0xD0A3, 0x6A, 0x00, 0x61, 0x24, 0xFB },
-  { "BMI $F84E                       ", 0xF843, 0x6A, 0x00, 0x61, 0x24, 0xF9 },
-  { "BCS $F84E                       ", 0xF845, 0x6A, 0x00, 0x61, 0x24, 0xF9 },
-  { "CMP #$6A                        ", 0xF847, 0x6A, 0x00, 0x61, 0x24, 0xF9 },
-  { "BNE $F84E                       ", 0xF849, 0x6A, 0x00, 0x61, 0x27, 0xF9 },
-  { "BVS $F84E                       ", 0xF84B, 0x6A, 0x00, 0x61, 0x27, 0xF9 },
-  { "RTS                             ", 0xF84D, 0x6A, 0x00, 0x61, 0x27, 0xF9 },
-  { "INY                             ", 0xD0A6, 0x6A, 0x00, 0x61, 0x27, 0xFB },
-  { "LDA #$7F                        ", 0xD0A7, 0x6A, 0x00, 0x62, 0x25, 0xFB },
-  { "STA $0200 = 69                  ", 0xD0A9, 0x7F, 0x00, 0x62, 0x25, 0xFB },
-  { "JSR $F851                       ", 0xD0AC, 0x7F, 0x00, 0x62, 0x25, 0xFB },
-  { "SEC                             ", 0xF851, 0x7F, 0x00, 0x62, 0x25, 0xF9 },
-  { "CLV                             ", 0xF852, 0x7F, 0x00, 0x62, 0x25, 0xF9 },
-  { "LDA #$7F                        ", 0xF853, 0x7F, 0x00, 0x62, 0x25, 0xF9 },
-  { "RTS                             ", 0xF855, 0x7F, 0x00, 0x62, 0x25, 0xF9 },
-  { "ADC ($80,X) @ 80 = 0200 = 7F    ", 0xD0AF, 0x7F, 0x00, 0x62, 0x25, 0xFB },
-  { "JSR $F856                       ", 0xD0B1, 0xFF, 0x00, 0x62, 0xE4, 0xFB },
-  { "BPL $F861                       ", 0xF856, 0xFF, 0x00, 0x62, 0xE4, 0xF9 },
-  { "BCS $F861                       ", 0xF858, 0xFF, 0x00, 0x62, 0xE4, 0xF9 },
-  { "CMP #$FF                        ", 0xF85A, 0xFF, 0x00, 0x62, 0xE4, 0xF9 },
-  { "BNE $F861                       ", 0xF85C, 0xFF, 0x00, 0x62, 0x67, 0xF9 },
-  { "BVC $F861                       ", 0xF85E, 0xFF, 0x00, 0x62, 0x67, 0xF9 },
-  { "RTS                             ", 0xF860, 0xFF, 0x00, 0x62, 0x67, 0xF9 },
-  { "INY                             ", 0xD0B4, 0xFF, 0x00, 0x62, 0x67, 0xFB },
-  { "LDA #$80                        ", 0xD0B5, 0xFF, 0x00, 0x63, 0x65, 0xFB },
-  { "STA $0200 = 7F                  ", 0xD0B7, 0x80, 0x00, 0x63, 0xE5, 0xFB },
-  { "JSR $F864                       ", 0xD0BA, 0x80, 0x00, 0x63, 0xE5, 0xFB },
-  { "CLC                             ", 0xF864, 0x80, 0x00, 0x63, 0xE5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF865, 0x80, 0x00, 0x63, 0xE4, 0xF9 },
-  { "LDA #$7F                        ", 0xF867, 0x80, 0x00, 0x63, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF869, 0x7F, 0x00, 0x63, 0x64, 0xF9 },
-  { "ADC ($80,X) @ 80 = 0200 = 80    ", 0xD0BD, 0x7F, 0x00, 0x63, 0x64, 0xFB },
-  { "JSR $F86A                       ", 0xD0BF, 0xFF, 0x00, 0x63, 0xA4, 0xFB },
-  { "BPL $F875                       ", 0xF86A, 0xFF, 0x00, 0x63, 0xA4, 0xF9 },
-  { "BCS $F875                       ", 0xF86C, 0xFF, 0x00, 0x63, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF86E, 0xFF, 0x00, 0x63, 0xA4, 0xF9 },
-  { "BNE $F875                       ", 0xF870, 0xFF, 0x00, 0x63, 0x27, 0xF9 },
-  { "BVS $F875                       ", 0xF872, 0xFF, 0x00, 0x63, 0x27, 0xF9 },
-  { "RTS                             ", 0xF874, 0xFF, 0x00, 0x63, 0x27, 0xF9 },
-  { "INY                             ", 0xD0C2, 0xFF, 0x00, 0x63, 0x27, 0xFB },
-  { "JSR $F878                       ", 0xD0C3, 0xFF, 0x00, 0x64, 0x25, 0xFB },
-  { "SEC                             ", 0xF878, 0xFF, 0x00, 0x64, 0x25, 0xF9 },
-  { "CLV                             ", 0xF879, 0xFF, 0x00, 0x64, 0x25, 0xF9 },
-  { "LDA #$7F                        ", 0xF87A, 0xFF, 0x00, 0x64, 0x25, 0xF9 },
-  { "RTS                             ", 0xF87C, 0x7F, 0x00, 0x64, 0x25, 0xF9 },
-  { "ADC ($80,X) @ 80 = 0200 = 80    ", 0xD0C6, 0x7F, 0x00, 0x64, 0x25, 0xFB },
-  { "JSR $F87D                       ", 0xD0C8, 0x00, 0x00, 0x64, 0x27, 0xFB },
-  { "BNE $F886                       ", 0xF87D, 0x00, 0x00, 0x64, 0x27, 0xF9 },
-  { "BMI $F886                       ", 0xF87F, 0x00, 0x00, 0x64, 0x27, 0xF9 },
-  { "BVS $F886                       ", 0xF881, 0x00, 0x00, 0x64, 0x27, 0xF9 },
-  { "BCC $F886                       ", 0xF883, 0x00, 0x00, 0x64, 0x27, 0xF9 },
-  { "RTS                             ", 0xF885, 0x00, 0x00, 0x64, 0x27, 0xF9 },
-  { "INY                             ", 0xD0CB, 0x00, 0x00, 0x64, 0x27, 0xFB },
-  { "LDA #$40                        ", 0xD0CC, 0x00, 0x00, 0x65, 0x25, 0xFB },
-  { "STA $0200 = 80                  ", 0xD0CE, 0x40, 0x00, 0x65, 0x25, 0xFB },
-  { "JSR $F889                       ", 0xD0D1, 0x40, 0x00, 0x65, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF889, 0x40, 0x00, 0x65, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF88B, 0x40, 0x00, 0x65, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF88D, 0x40, 0x00, 0x65, 0x65, 0xF9 },
-  { "CMP ($80,X) @ 80 = 0200 = 40    ", 0xD0D4, 0x40, 0x00, 0x65, 0x65, 0xFB },
-  { "JSR $F88E                       ", 0xD0D6, 0x40, 0x00, 0x65, 0x67, 0xFB },
-  { "BMI $F897                       ", 0xF88E, 0x40, 0x00, 0x65, 0x67, 0xF9 },
-  { "BCC $F897                       ", 0xF890, 0x40, 0x00, 0x65, 0x67, 0xF9 },
-  { "BNE $F897                       ", 0xF892, 0x40, 0x00, 0x65, 0x67, 0xF9 },
-  { "BVC $F897                       ", 0xF894, 0x40, 0x00, 0x65, 0x67, 0xF9 },
-  { "RTS                             ", 0xF896, 0x40, 0x00, 0x65, 0x67, 0xF9 },
-  { "INY                             ", 0xD0D9, 0x40, 0x00, 0x65, 0x67, 0xFB },
-  { "PHA                             ", 0xD0DA, 0x40, 0x00, 0x66, 0x65, 0xFB },
-  { "LDA #$3F                        ", 0xD0DB, 0x40, 0x00, 0x66, 0x65, 0xFA },
-  { "STA $0200 = 40                  ", 0xD0DD, 0x3F, 0x00, 0x66, 0x65, 0xFA },
-  { "PLA                             ", 0xD0E0, 0x3F, 0x00, 0x66, 0x65, 0xFA },
-  { "JSR $F89A                       ", 0xD0E1, 0x40, 0x00, 0x66, 0x65, 0xFB },
-  { "CLV                             ", 0xF89A, 0x40, 0x00, 0x66, 0x65, 0xF9 },
-  { "RTS                             ", 0xF89B, 0x40, 0x00, 0x66, 0x25, 0xF9 },
-  { "CMP ($80,X) @ 80 = 0200 = 3F    ", 0xD0E4, 0x40, 0x00, 0x66, 0x25, 0xFB },
-  { "JSR $F89C                       ", 0xD0E6, 0x40, 0x00, 0x66, 0x25, 0xFB },
-  { "BEQ $F8A5                       ", 0xF89C, 0x40, 0x00, 0x66, 0x25, 0xF9 },
-  { "BMI $F8A5                       ", 0xF89E, 0x40, 0x00, 0x66, 0x25, 0xF9 },
-  { "BCC $F8A5                       ", 0xF8A0, 0x40, 0x00, 0x66, 0x25, 0xF9 },
-  { "BVS $F8A5                       ", 0xF8A2, 0x40, 0x00, 0x66, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8A4, 0x40, 0x00, 0x66, 0x25, 0xF9 },
-  { "INY                             ", 0xD0E9, 0x40, 0x00, 0x66, 0x25, 0xFB },
-  { "PHA                             ", 0xD0EA, 0x40, 0x00, 0x67, 0x25, 0xFB },
-  { "LDA #$41                        ", 0xD0EB, 0x40, 0x00, 0x67, 0x25, 0xFA },
-  { "STA $0200 = 3F                  ", 0xD0ED, 0x41, 0x00, 0x67, 0x25, 0xFA },
-  { "PLA                             ", 0xD0F0, 0x41, 0x00, 0x67, 0x25, 0xFA },
-  { "CMP ($80,X) @ 80 = 0200 = 41    ", 0xD0F1, 0x40, 0x00, 0x67, 0x25, 0xFB },
-  { "JSR $F8A8                       ", 0xD0F3, 0x40, 0x00, 0x67, 0xA4, 0xFB },
-  { "BEQ $F8AF                       ", 0xF8A8, 0x40, 0x00, 0x67, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AA, 0x40, 0x00, 0x67, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AC, 0x40, 0x00, 0x67, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8AE, 0x40, 0x00, 0x67, 0xA4, 0xF9 },
-  { "INY                             ", 0xD0F6, 0x40, 0x00, 0x67, 0xA4, 0xFB },
-  { "PHA                             ", 0xD0F7, 0x40, 0x00, 0x68, 0x24, 0xFB },
-  { "LDA #$00                        ", 0xD0F8, 0x40, 0x00, 0x68, 0x24, 0xFA },
-  { "STA $0200 = 41                  ", 0xD0FA, 0x00, 0x00, 0x68, 0x26, 0xFA },
-  { "PLA                             ", 0xD0FD, 0x00, 0x00, 0x68, 0x26, 0xFA },
-  { "JSR $F8B2                       ", 0xD0FE, 0x40, 0x00, 0x68, 0x24, 0xFB },
-  { "LDA #$80                        ", 0xF8B2, 0x40, 0x00, 0x68, 0x24, 0xF9 },
-  { "RTS                             ", 0xF8B4, 0x80, 0x00, 0x68, 0xA4, 0xF9 },
-  { "CMP ($80,X) @ 80 = 0200 = 00    ", 0xD101, 0x80, 0x00, 0x68, 0xA4, 0xFB },
-  { "JSR $F8B5                       ", 0xD103, 0x80, 0x00, 0x68, 0xA5, 0xFB },
-  { "BEQ $F8BC                       ", 0xF8B5, 0x80, 0x00, 0x68, 0xA5, 0xF9 },
-  { "BPL $F8BC                       ", 0xF8B7, 0x80, 0x00, 0x68, 0xA5, 0xF9 },
-  { "BCC $F8BC                       ", 0xF8B9, 0x80, 0x00, 0x68, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF8BB, 0x80, 0x00, 0x68, 0xA5, 0xF9 },
-  { "INY                             ", 0xD106, 0x80, 0x00, 0x68, 0xA5, 0xFB },
-  { "PHA                             ", 0xD107, 0x80, 0x00, 0x69, 0x25, 0xFB },
-  { "LDA #$80                        ", 0xD108, 0x80, 0x00, 0x69, 0x25, 0xFA },
-  { "STA $0200 = 00                  ", 0xD10A, 0x80, 0x00, 0x69, 0xA5, 0xFA },
-  { "PLA                             ", 0xD10D, 0x80, 0x00, 0x69, 0xA5, 0xFA },
-  { "CMP ($80,X) @ 80 = 0200 = 80    ", 0xD10E, 0x80, 0x00, 0x69, 0xA5, 0xFB },
-  { "JSR $F8BF                       ", 0xD110, 0x80, 0x00, 0x69, 0x27, 0xFB },
-  { "BNE $F8C6                       ", 0xF8BF, 0x80, 0x00, 0x69, 0x27, 0xF9 },
-  { "BMI $F8C6                       ", 0xF8C1, 0x80, 0x00, 0x69, 0x27, 0xF9 },
-  { "BCC $F8C6                       ", 0xF8C3, 0x80, 0x00, 0x69, 0x27, 0xF9 },
-  { "RTS                             ", 0xF8C5, 0x80, 0x00, 0x69, 0x27, 0xF9 },
-  { "INY                             ", 0xD113, 0x80, 0x00, 0x69, 0x27, 0xFB },
-  { "PHA                             ", 0xD114, 0x80, 0x00, 0x6A, 0x25, 0xFB },
-  { "LDA #$81                        ", 0xD115, 0x80, 0x00, 0x6A, 0x25, 0xFA },
-  { "STA $0200 = 80                  ", 0xD117, 0x81, 0x00, 0x6A, 0xA5, 0xFA },
-  { "PLA                             ", 0xD11A, 0x81, 0x00, 0x6A, 0xA5, 0xFA },
-  { "CMP ($80,X) @ 80 = 0200 = 81    ", 0xD11B, 0x80, 0x00, 0x6A, 0xA5, 0xFB },
-  { "JSR $F8C9                       ", 0xD11D, 0x80, 0x00, 0x6A, 0xA4, 0xFB },
-  { "BCS $F8D0                       ", 0xF8C9, 0x80, 0x00, 0x6A, 0xA4, 0xF9 },
-  { "BEQ $F8D0                       ", 0xF8CB, 0x80, 0x00, 0x6A, 0xA4, 0xF9 },
-  { "BPL $F8D0                       ", 0xF8CD, 0x80, 0x00, 0x6A, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8CF, 0x80, 0x00, 0x6A, 0xA4, 0xF9 },
-  { "INY                             ", 0xD120, 0x80, 0x00, 0x6A, 0xA4, 0xFB },
-  { "PHA                             ", 0xD121, 0x80, 0x00, 0x6B, 0x24, 0xFB },
-  { "LDA #$7F                        ", 0xD122, 0x80, 0x00, 0x6B, 0x24, 0xFA },
-  { "STA $0200 = 81                  ", 0xD124, 0x7F, 0x00, 0x6B, 0x24, 0xFA },
-  { "PLA                             ", 0xD127, 0x7F, 0x00, 0x6B, 0x24, 0xFA },
-  { "CMP ($80,X) @ 80 = 0200 = 7F    ", 0xD128, 0x80, 0x00, 0x6B, 0xA4, 0xFB },
-  { "JSR $F8D3                       ", 0xD12A, 0x80, 0x00, 0x6B, 0x25, 0xFB },
-  { "BCC $F8DA                       ", 0xF8D3, 0x80, 0x00, 0x6B, 0x25, 0xF9 },
-  { "BEQ $F8DA                       ", 0xF8D5, 0x80, 0x00, 0x6B, 0x25, 0xF9 },
-  { "BMI $F8DA                       ", 0xF8D7, 0x80, 0x00, 0x6B, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8D9, 0x80, 0x00, 0x6B, 0x25, 0xF9 },
-  { "INY                             ", 0xD12D, 0x80, 0x00, 0x6B, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xD12E, 0x80, 0x00, 0x6C, 0x25, 0xFB },
-  { "STA $0200 = 7F                  ", 0xD130, 0x40, 0x00, 0x6C, 0x25, 0xFB },
-  { "JSR $F931                       ", 0xD133, 0x40, 0x00, 0x6C, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF931, 0x40, 0x00, 0x6C, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF933, 0x40, 0x00, 0x6C, 0xE5, 0xF9 },
-  { "SEC                             ", 0xF935, 0x40, 0x00, 0x6C, 0x65, 0xF9 },
-  { "RTS                             ", 0xF936, 0x40, 0x00, 0x6C, 0x65, 0xF9 },
-  { "SBC ($80,X) @ 80 = 0200 = 40    ", 0xD136, 0x40, 0x00, 0x6C, 0x65, 0xFB },
-  { "JSR $F937                       ", 0xD138, 0x00, 0x00, 0x6C, 0x27, 0xFB },
-  { "BMI $F944                       ", 0xF937, 0x00, 0x00, 0x6C, 0x27, 0xF9 },
-  { "BCC $F944                       ", 0xF939, 0x00, 0x00, 0x6C, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF93B, 0x00, 0x00, 0x6C, 0x27, 0xF9 },
-  { "BVS $F944                       ", 0xF93D, 0x00, 0x00, 0x6C, 0x27, 0xF9 },
-  { "CMP #$00                        ", 0xF93F, 0x00, 0x00, 0x6C, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF941, 0x00, 0x00, 0x6C, 0x27, 0xF9 },
-  { "RTS                             ", 0xF943, 0x00, 0x00, 0x6C, 0x27, 0xF9 },
-  { "INY                             ", 0xD13B, 0x00, 0x00, 0x6C, 0x27, 0xFB },
-  { "LDA #$3F                        ", 0xD13C, 0x00, 0x00, 0x6D, 0x25, 0xFB },
-  { "STA $0200 = 40                  ", 0xD13E, 0x3F, 0x00, 0x6D, 0x25, 0xFB },
-  { "JSR $F947                       ", 0xD141, 0x3F, 0x00, 0x6D, 0x25, 0xFB },
-  { "CLV                             ", 0xF947, 0x3F, 0x00, 0x6D, 0x25, 0xF9 },
-  { "SEC                             ", 0xF948, 0x3F, 0x00, 0x6D, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF949, 0x3F, 0x00, 0x6D, 0x25, 0xF9 },
-  { "RTS                             ", 0xF94B, 0x40, 0x00, 0x6D, 0x25, 0xF9 },
-  { "SBC ($80,X) @ 80 = 0200 = 3F    ", 0xD144, 0x40, 0x00, 0x6D, 0x25, 0xFB },
-  { "JSR $F94C                       ", 0xD146, 0x01, 0x00, 0x6D, 0x25, 0xFB },
-  { "BEQ $F959                       ", 0xF94C, 0x01, 0x00, 0x6D, 0x25, 0xF9 },
-  { "BMI $F959                       ", 0xF94E, 0x01, 0x00, 0x6D, 0x25, 0xF9 },
-  { "BCC $F959                       ", 0xF950, 0x01, 0x00, 0x6D, 0x25, 0xF9 },
-  { "BVS $F959                       ", 0xF952, 0x01, 0x00, 0x6D, 0x25, 0xF9 },
-  { "CMP #$01                        ", 0xF954, 0x01, 0x00, 0x6D, 0x25, 0xF9 },
-  { "BNE $F959                       ", 0xF956, 0x01, 0x00, 0x6D, 0x27, 0xF9 },
-  { "RTS                             ", 0xF958, 0x01, 0x00, 0x6D, 0x27, 0xF9 },
-  { "INY                             ", 0xD149, 0x01, 0x00, 0x6D, 0x27, 0xFB },
-  { "LDA #$41                        ", 0xD14A, 0x01, 0x00, 0x6E, 0x25, 0xFB },
-  { "STA $0200 = 3F                  ", 0xD14C, 0x41, 0x00, 0x6E, 0x25, 0xFB },
-  { "JSR $F95C                       ", 0xD14F, 0x41, 0x00, 0x6E, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xF95C, 0x41, 0x00, 0x6E, 0x25, 0xF9 },
-  { "SEC                             ", 0xF95E, 0x40, 0x00, 0x6E, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF95F, 0x40, 0x00, 0x6E, 0x25, 0xF9 },
-  { "RTS                             ", 0xF961, 0x40, 0x00, 0x6E, 0xE5, 0xF9 },
-  { "SBC ($80,X) @ 80 = 0200 = 41    ", 0xD152, 0x40, 0x00, 0x6E, 0xE5, 0xFB },
-  { "JSR $F962                       ", 0xD154, 0xFF, 0x00, 0x6E, 0xA4, 0xFB },
-  { "BCS $F96F                       ", 0xF962, 0xFF, 0x00, 0x6E, 0xA4, 0xF9 },
-  { "BEQ $F96F                       ", 0xF964, 0xFF, 0x00, 0x6E, 0xA4, 0xF9 },
-  { "BPL $F96F                       ", 0xF966, 0xFF, 0x00, 0x6E, 0xA4, 0xF9 },
-  { "BVS $F96F                       ", 0xF968, 0xFF, 0x00, 0x6E, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF96A, 0xFF, 0x00, 0x6E, 0xA4, 0xF9 },
-  { "BNE $F96F                       ", 0xF96C, 0xFF, 0x00, 0x6E, 0x27, 0xF9 },
-  { "RTS                             ", 0xF96E, 0xFF, 0x00, 0x6E, 0x27, 0xF9 },
-  { "INY                             ", 0xD157, 0xFF, 0x00, 0x6E, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xD158, 0xFF, 0x00, 0x6F, 0x25, 0xFB },
-  { "STA $0200 = 41                  ", 0xD15A, 0x00, 0x00, 0x6F, 0x27, 0xFB },
-  { "JSR $F972                       ", 0xD15D, 0x00, 0x00, 0x6F, 0x27, 0xFB },
-  { "CLC                             ", 0xF972, 0x00, 0x00, 0x6F, 0x27, 0xF9 },
-  { "LDA #$80                        ", 0xF973, 0x00, 0x00, 0x6F, 0x26, 0xF9 },
-  { "RTS                             ", 0xF975, 0x80, 0x00, 0x6F, 0xA4, 0xF9 },
-  { "SBC ($80,X) @ 80 = 0200 = 00    ", 0xD160, 0x80, 0x00, 0x6F, 0xA4, 0xFB },
-  { "JSR $F976                       ", 0xD162, 0x7F, 0x00, 0x6F, 0x65, 0xFB },
-  { "BCC $F97D                       ", 0xF976, 0x7F, 0x00, 0x6F, 0x65, 0xF9 },
-  { "CMP #$7F                        ", 0xF978, 0x7F, 0x00, 0x6F, 0x65, 0xF9 },
-  { "BNE $F97D                       ", 0xF97A, 0x7F, 0x00, 0x6F, 0x67, 0xF9 },
-  { "RTS                             ", 0xF97C, 0x7F, 0x00, 0x6F, 0x67, 0xF9 },
-  { "INY                             ", 0xD165, 0x7F, 0x00, 0x6F, 0x67, 0xFB },
-  { "LDA #$7F                        ", 0xD166, 0x7F, 0x00, 0x70, 0x65, 0xFB },
-  { "STA $0200 = 00                  ", 0xD168, 0x7F, 0x00, 0x70, 0x65, 0xFB },
-  { "JSR $F980                       ", 0xD16B, 0x7F, 0x00, 0x70, 0x65, 0xFB },
-  { "SEC                             ", 0xF980, 0x7F, 0x00, 0x70, 0x65, 0xF9 },
-  { "LDA #$81                        ", 0xF981, 0x7F, 0x00, 0x70, 0x65, 0xF9 },
-  { "RTS                             ", 0xF983, 0x81, 0x00, 0x70, 0xE5, 0xF9 },
-  { "SBC ($80,X) @ 80 = 0200 = 7F    ", 0xD16E, 0x81, 0x00, 0x70, 0xE5, 0xFB },
-  { "JSR $F984                       ", 0xD170, 0x02, 0x00, 0x70, 0x65, 0xFB },
-  { "BVC $F98D                       ", 0xF984, 0x02, 0x00, 0x70, 0x65, 0xF9 },
-  { "BCC $F98D                       ", 0xF986, 0x02, 0x00, 0x70, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xF988, 0x02, 0x00, 0x70, 0x65, 0xF9 },
-  { "BNE $F98D                       ", 0xF98A, 0x02, 0x00, 0x70, 0x67, 0xF9 },
-  { "RTS                             ", 0xF98C, 0x02, 0x00, 0x70, 0x67, 0xF9 },
-  { "RTS                             ", 0xD173, 0x02, 0x00, 0x70, 0x67, 0xFB },
-  { "JSR $D174                       ", 0xC612, 0x02, 0x00, 0x70, 0x67, 0xFD },
-  { "LDA #$55                        ", 0xD174, 0x02, 0x00, 0x70, 0x67, 0xFB },
-  { "STA $78 = 00                    ", 0xD176, 0x55, 0x00, 0x70, 0x65, 0xFB },
-  { "LDA #$FF                        ", 0xD178, 0x55, 0x00, 0x70, 0x65, 0xFB },
-  { "STA $01 = FF                    ", 0xD17A, 0xFF, 0x00, 0x70, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xD17C, 0xFF, 0x00, 0x70, 0xE5, 0xFB },
-  { "LDY #$11                        ", 0xD17E, 0xFF, 0x00, 0x70, 0xE5, 0xFB },
-  { "LDX #$23                        ", 0xD180, 0xFF, 0x00, 0x11, 0x65, 0xFB },
-  { "LDA #$00                        ", 0xD182, 0xFF, 0x23, 0x11, 0x65, 0xFB },
-  { "LDA $78 = 55                    ", 0xD184, 0x00, 0x23, 0x11, 0x67, 0xFB },
-  { "BEQ $D198                       ", 0xD186, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "BMI $D198                       ", 0xD188, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "CMP #$55                        ", 0xD18A, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "BNE $D198                       ", 0xD18C, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "CPY #$11                        ", 0xD18E, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "BNE $D198                       ", 0xD190, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "CPX #$23                        ", 0xD192, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "BVC $D198                       ", 0xD194, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "BEQ $D19C                       ", 0xD196, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "LDA #$46                        ", 0xD19C, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xD19E, 0x46, 0x23, 0x11, 0x65, 0xFB },
-  { "STA $78 = 55                    ", 0xD1A0, 0x46, 0x23, 0x11, 0xE5, 0xFB },
-  { "BEQ $D1AE                       ", 0xD1A2, 0x46, 0x23, 0x11, 0xE5, 0xFB },
-  { "BPL $D1AE                       ", 0xD1A4, 0x46, 0x23, 0x11, 0xE5, 0xFB },
-  { "BVC $D1AE                       ", 0xD1A6, 0x46, 0x23, 0x11, 0xE5, 0xFB },
-  { "LDA $78 = 46                    ", 0xD1A8, 0x46, 0x23, 0x11, 0xE5, 0xFB },
-  { "CMP #$46                        ", 0xD1AA, 0x46, 0x23, 0x11, 0x65, 0xFB },
-  { "BEQ $D1B2                       ", 0xD1AC, 0x46, 0x23, 0x11, 0x67, 0xFB },
-  { "LDA #$55                        ", 0xD1B2, 0x46, 0x23, 0x11, 0x67, 0xFB },
-  { "STA $78 = 46                    ", 0xD1B4, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "BIT $01 = FF                    ", 0xD1B6, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "LDA #$11                        ", 0xD1B8, 0x55, 0x23, 0x11, 0xE5, 0xFB },
-  { "LDX #$23                        ", 0xD1BA, 0x11, 0x23, 0x11, 0x65, 0xFB },
-  { "LDY #$00                        ", 0xD1BC, 0x11, 0x23, 0x11, 0x65, 0xFB },
-  { "LDY $78 = 55                    ", 0xD1BE, 0x11, 0x23, 0x00, 0x67, 0xFB },
-  { "BEQ $D1D2                       ", 0xD1C0, 0x11, 0x23, 0x55, 0x65, 0xFB },
-  { "BMI $D1D2                       ", 0xD1C2, 0x11, 0x23, 0x55, 0x65, 0xFB },
-  { "CPY #$55                        ", 0xD1C4, 0x11, 0x23, 0x55, 0x65, 0xFB },
-  { "BNE $D1D2                       ", 0xD1C6, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "CMP #$11                        ", 0xD1C8, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "BNE $D1D2                       ", 0xD1CA, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "CPX #$23                        ", 0xD1CC, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "BVC $D1D2                       ", 0xD1CE, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "BEQ $D1D6                       ", 0xD1D0, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "LDY #$46                        ", 0xD1D6, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xD1D8, 0x11, 0x23, 0x46, 0x65, 0xFB },
-  { "STY $78 = 55                    ", 0xD1DA, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "BEQ $D1E8                       ", 0xD1DC, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "BPL $D1E8                       ", 0xD1DE, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "BVC $D1E8                       ", 0xD1E0, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "LDY $78 = 46                    ", 0xD1E2, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "CPY #$46                        ", 0xD1E4, 0x11, 0x23, 0x46, 0x65, 0xFB },
-  { "BEQ $D1EC                       ", 0xD1E6, 0x11, 0x23, 0x46, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xD1EC, 0x11, 0x23, 0x46, 0x67, 0xFB },
-  { "LDA #$55                        ", 0xD1EE, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "STA $78 = 46                    ", 0xD1F0, 0x55, 0x23, 0x46, 0x65, 0xFB },
-  { "LDY #$11                        ", 0xD1F2, 0x55, 0x23, 0x46, 0x65, 0xFB },
-  { "LDA #$23                        ", 0xD1F4, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "LDX #$00                        ", 0xD1F6, 0x23, 0x23, 0x11, 0x65, 0xFB },
-  { "LDX $78 = 55                    ", 0xD1F8, 0x23, 0x00, 0x11, 0x67, 0xFB },
-  { "BEQ $D20C                       ", 0xD1FA, 0x23, 0x55, 0x11, 0x65, 0xFB },
-  { "BMI $D20C                       ", 0xD1FC, 0x23, 0x55, 0x11, 0x65, 0xFB },
-  { "CPX #$55                        ", 0xD1FE, 0x23, 0x55, 0x11, 0x65, 0xFB },
-  { "BNE $D20C                       ", 0xD200, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "CPY #$11                        ", 0xD202, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "BNE $D20C                       ", 0xD204, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "CMP #$23                        ", 0xD206, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "BVC $D20C                       ", 0xD208, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "BEQ $D210                       ", 0xD20A, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "LDX #$46                        ", 0xD210, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xD212, 0x23, 0x46, 0x11, 0x65, 0xFB },
-  { "STX $78 = 55                    ", 0xD214, 0x23, 0x46, 0x11, 0xE5, 0xFB },
-  { "BEQ $D222                       ", 0xD216, 0x23, 0x46, 0x11, 0xE5, 0xFB },
-  { "BPL $D222                       ", 0xD218, 0x23, 0x46, 0x11, 0xE5, 0xFB },
-  { "BVC $D222                       ", 0xD21A, 0x23, 0x46, 0x11, 0xE5, 0xFB },
-  { "LDX $78 = 46                    ", 0xD21C, 0x23, 0x46, 0x11, 0xE5, 0xFB },
-  { "CPX #$46                        ", 0xD21E, 0x23, 0x46, 0x11, 0x65, 0xFB },
-  { "BEQ $D226                       ", 0xD220, 0x23, 0x46, 0x11, 0x67, 0xFB },
-  { "LDA #$C0                        ", 0xD226, 0x23, 0x46, 0x11, 0x67, 0xFB },
-  { "STA $78 = 46                    ", 0xD228, 0xC0, 0x46, 0x11, 0xE5, 0xFB },
-  { "LDX #$33                        ", 0xD22A, 0xC0, 0x46, 0x11, 0xE5, 0xFB },
-  { "LDY #$88                        ", 0xD22C, 0xC0, 0x33, 0x11, 0x65, 0xFB },
-  { "LDA #$05                        ", 0xD22E, 0xC0, 0x33, 0x88, 0xE5, 0xFB },
-  { "BIT $78 = C0                    ", 0xD230, 0x05, 0x33, 0x88, 0x65, 0xFB },
-  { "BPL $D244                       ", 0xD232, 0x05, 0x33, 0x88, 0xE7, 0xFB },
-  { "BVC $D244                       ", 0xD234, 0x05, 0x33, 0x88, 0xE7, 0xFB },
-  { "BNE $D244                       ", 0xD236, 0x05, 0x33, 0x88, 0xE7, 0xFB },
-  { "CMP #$05                        ", 0xD238, 0x05, 0x33, 0x88, 0xE7, 0xFB },
-  { "BNE $D244                       ", 0xD23A, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "CPX #$33                        ", 0xD23C, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "BNE $D244                       ", 0xD23E, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "CPY #$88                        ", 0xD240, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "BEQ $D248                       ", 0xD242, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "LDA #$03                        ", 0xD248, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "STA $78 = C0                    ", 0xD24A, 0x03, 0x33, 0x88, 0x65, 0xFB },
-  { "LDA #$01                        ", 0xD24C, 0x03, 0x33, 0x88, 0x65, 0xFB },
-  { "BIT $78 = 03                    ", 0xD24E, 0x01, 0x33, 0x88, 0x65, 0xFB },
-  { "BMI $D25A                       ", 0xD250, 0x01, 0x33, 0x88, 0x25, 0xFB },
-  { "BVS $D25A                       ", 0xD252, 0x01, 0x33, 0x88, 0x25, 0xFB },
-  { "BEQ $D25A                       ", 0xD254, 0x01, 0x33, 0x88, 0x25, 0xFB },
-  { "CMP #$01                        ", 0xD256, 0x01, 0x33, 0x88, 0x25, 0xFB },
-  { "BEQ $D25E                       ", 0xD258, 0x01, 0x33, 0x88, 0x27, 0xFB },
-  { "LDY #$7E                        ", 0xD25E, 0x01, 0x33, 0x88, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xD260, 0x01, 0x33, 0x7E, 0x25, 0xFB },
-  { "STA $78 = 03                    ", 0xD262, 0xAA, 0x33, 0x7E, 0xA5, 0xFB },
-  { "JSR $F7B6                       ", 0xD264, 0xAA, 0x33, 0x7E, 0xA5, 0xFB },
-  { "CLC                             ", 0xF7B6, 0xAA, 0x33, 0x7E, 0xA5, 0xF9 },
-  { "LDA #$FF                        ", 0xF7B7, 0xAA, 0x33, 0x7E, 0xA4, 0xF9 },
-  { "STA $01 = FF                    ", 0xF7B9, 0xFF, 0x33, 0x7E, 0xA4, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF7BB, 0xFF, 0x33, 0x7E, 0xA4, 0xF9 },
-  { "LDA #$55                        ", 0xF7BD, 0xFF, 0x33, 0x7E, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF7BF, 0x55, 0x33, 0x7E, 0x64, 0xF9 },
-  { "ORA $78 = AA                    ", 0xD267, 0x55, 0x33, 0x7E, 0x64, 0xFB },
-  { "JSR $F7C0                       ", 0xD269, 0xFF, 0x33, 0x7E, 0xE4, 0xFB },
-  { "BCS $F7CB                       ", 0xF7C0, 0xFF, 0x33, 0x7E, 0xE4, 0xF9 },
-  { "BPL $F7CB                       ", 0xF7C2, 0xFF, 0x33, 0x7E, 0xE4, 0xF9 },
-  { "CMP #$FF                        ", 0xF7C4, 0xFF, 0x33, 0x7E, 0xE4, 0xF9 },
-  { "BNE $F7CB                       ", 0xF7C6, 0xFF, 0x33, 0x7E, 0x67, 0xF9 },
-  { "BVC $F7CB                       ", 0xF7C8, 0xFF, 0x33, 0x7E, 0x67, 0xF9 },
-  { "RTS                             ", 0xF7CA, 0xFF, 0x33, 0x7E, 0x67, 0xF9 },
-  { "INY                             ", 0xD26C, 0xFF, 0x33, 0x7E, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xD26D, 0xFF, 0x33, 0x7F, 0x65, 0xFB },
-  { "STA $78 = AA                    ", 0xD26F, 0x00, 0x33, 0x7F, 0x67, 0xFB },
-  { "JSR $F7CE                       ", 0xD271, 0x00, 0x33, 0x7F, 0x67, 0xFB },
-  { "SEC                             ", 0xF7CE, 0x00, 0x33, 0x7F, 0x67, 0xF9 },
-  { "CLV                             ", 0xF7CF, 0x00, 0x33, 0x7F, 0x67, 0xF9 },
-  { "LDA #$00                        ", 0xF7D0, 0x00, 0x33, 0x7F, 0x27, 0xF9 },
-  { "RTS                             ", 0xF7D2, 0x00, 0x33, 0x7F, 0x27, 0xF9 },
-  { "ORA $78 = 00                    ", 0xD274, 0x00, 0x33, 0x7F, 0x27, 0xFB },
-  { "JSR $F7D3                       ", 0xD276, 0x00, 0x33, 0x7F, 0x27, 0xFB },
-  { "BNE $F7DC                       ", 0xF7D3, 0x00, 0x33, 0x7F, 0x27, 0xF9 },
-  { "BVS $F7DC                       ", 0xF7D5, 0x00, 0x33, 0x7F, 0x27, 0xF9 },
-  { "BCC $F7DC                       ", 0xF7D7, 0x00, 0x33, 0x7F, 0x27, 0xF9 },
-  { "BMI $F7DC                       ", 0xF7D9, 0x00, 0x33, 0x7F, 0x27, 0xF9 },
-  { "RTS                             ", 0xF7DB, 0x00, 0x33, 0x7F, 0x27, 0xF9 },
-  { "INY                             ", 0xD279, 0x00, 0x33, 0x7F, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xD27A, 0x00, 0x33, 0x80, 0xA5, 0xFB },
-  { "STA $78 = 00                    ", 0xD27C, 0xAA, 0x33, 0x80, 0xA5, 0xFB },
-  { "JSR $F7DF                       ", 0xD27E, 0xAA, 0x33, 0x80, 0xA5, 0xFB },
-  { "CLC                             ", 0xF7DF, 0xAA, 0x33, 0x80, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF7E0, 0xAA, 0x33, 0x80, 0xA4, 0xF9 },
-  { "LDA #$55                        ", 0xF7E2, 0xAA, 0x33, 0x80, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF7E4, 0x55, 0x33, 0x80, 0x64, 0xF9 },
-  { "AND $78 = AA                    ", 0xD281, 0x55, 0x33, 0x80, 0x64, 0xFB },
-  { "JSR $F7E5                       ", 0xD283, 0x00, 0x33, 0x80, 0x66, 0xFB },
-  { "BNE $F7EE                       ", 0xF7E5, 0x00, 0x33, 0x80, 0x66, 0xF9 },
-  { "BVC $F7EE                       ", 0xF7E7, 0x00, 0x33, 0x80, 0x66, 0xF9 },
-  { "BCS $F7EE                       ", 0xF7E9, 0x00, 0x33, 0x80, 0x66, 0xF9 },
-  { "BMI $F7EE                       ", 0xF7EB, 0x00, 0x33, 0x80, 0x66, 0xF9 },
-  { "RTS                             ", 0xF7ED, 0x00, 0x33, 0x80, 0x66, 0xF9 },
-  { "INY                             ", 0xD286, 0x00, 0x33, 0x80, 0x66, 0xFB },
-  { "LDA #$EF                        ", 0xD287, 0x00, 0x33, 0x81, 0xE4, 0xFB },
-  { "STA $78 = AA                    ", 0xD289, 0xEF, 0x33, 0x81, 0xE4, 0xFB },
-  { "JSR $F7F1                       ", 0xD28B, 0xEF, 0x33, 0x81, 0xE4, 0xFB },
-  { "SEC                             ", 0xF7F1, 0xEF, 0x33, 0x81, 0xE4, 0xF9 },
-  { "CLV                             ", 0xF7F2, 0xEF, 0x33, 0x81, 0xE5, 0xF9 },
-  { "LDA #$F8                        ", 0xF7F3, 0xEF, 0x33, 0x81, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF7F5, 0xF8, 0x33, 0x81, 0xA5, 0xF9 },
-  { "AND $78 = EF                    ", 0xD28E, 0xF8, 0x33, 0x81, 0xA5, 0xFB },
-  { "JSR $F7F6                       ", 0xD290, 0xE8, 0x33, 0x81, 0xA5, 0xFB },
-  { "BCC $F801                       ", 0xF7F6, 0xE8, 0x33, 0x81, 0xA5, 0xF9 },
-  { "BPL $F801                       ", 0xF7F8, 0xE8, 0x33, 0x81, 0xA5, 0xF9 },
-  { "CMP #$E8                        ", 0xF7FA, 0xE8, 0x33, 0x81, 0xA5, 0xF9 },
-  { "BNE $F801                       ", 0xF7FC, 0xE8, 0x33, 0x81, 0x27, 0xF9 },
-  { "BVS $F801                       ", 0xF7FE, 0xE8, 0x33, 0x81, 0x27, 0xF9 },
-  { "RTS                             ", 0xF800, 0xE8, 0x33, 0x81, 0x27, 0xF9 },
-  { "INY                             ", 0xD293, 0xE8, 0x33, 0x81, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xD294, 0xE8, 0x33, 0x82, 0xA5, 0xFB },
-  { "STA $78 = EF                    ", 0xD296, 0xAA, 0x33, 0x82, 0xA5, 0xFB },
-  { "JSR $F804                       ", 0xD298, 0xAA, 0x33, 0x82, 0xA5, 0xFB },
-  { "CLC                             ", 0xF804, 0xAA, 0x33, 0x82, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF805, 0xAA, 0x33, 0x82, 0xA4, 0xF9 },
-  { "LDA #$5F                        ", 0xF807, 0xAA, 0x33, 0x82, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF809, 0x5F, 0x33, 0x82, 0x64, 0xF9 },
-  { "EOR $78 = AA                    ", 0xD29B, 0x5F, 0x33, 0x82, 0x64, 0xFB },
-  { "JSR $F80A                       ", 0xD29D, 0xF5, 0x33, 0x82, 0xE4, 0xFB },
-  { "BCS $F815                       ", 0xF80A, 0xF5, 0x33, 0x82, 0xE4, 0xF9 },
-  { "BPL $F815                       ", 0xF80C, 0xF5, 0x33, 0x82, 0xE4, 0xF9 },
-  { "CMP #$F5                        ", 0xF80E, 0xF5, 0x33, 0x82, 0xE4, 0xF9 },
-  { "BNE $F815                       ", 0xF810, 0xF5, 0x33, 0x82, 0x67, 0xF9 },
-  { "BVC $F815                       ", 0xF812, 0xF5, 0x33, 0x82, 0x67, 0xF9 },
-  { "RTS                             ", 0xF814, 0xF5, 0x33, 0x82, 0x67, 0xF9 },
-  { "INY                             ", 0xD2A0, 0xF5, 0x33, 0x82, 0x67, 0xFB },
-  { "LDA #$70                        ", 0xD2A1, 0xF5, 0x33, 0x83, 0xE5, 0xFB },
-  { "STA $78 = AA                    ", 0xD2A3, 0x70, 0x33, 0x83, 0x65, 0xFB },
-  { "JSR $F818                       ", 0xD2A5, 0x70, 0x33, 0x83, 0x65, 0xFB },
-  { "SEC                             ", 0xF818, 0x70, 0x33, 0x83, 0x65, 0xF9 },
-  { "CLV                             ", 0xF819, 0x70, 0x33, 0x83, 0x65, 0xF9 },
-  { "LDA #$70                        ", 0xF81A, 0x70, 0x33, 0x83, 0x25, 0xF9 },
-  { "RTS                             ", 0xF81C, 0x70, 0x33, 0x83, 0x25, 0xF9 },
-  { "EOR $78 = 70                    ", 0xD2A8, 0x70, 0x33, 0x83, 0x25, 0xFB },
-  { "JSR $F81D                       ", 0xD2AA, 0x00, 0x33, 0x83, 0x27, 0xFB },
-  { "BNE $F826                       ", 0xF81D, 0x00, 0x33, 0x83, 0x27, 0xF9 },
-  { "BVS $F826                       ", 0xF81F, 0x00, 0x33, 0x83, 0x27, 0xF9 },
-  { "BCC $F826                       ", 0xF821, 0x00, 0x33, 0x83, 0x27, 0xF9 },
-  { "BMI $F826                       ", 0xF823, 0x00, 0x33, 0x83, 0x27, 0xF9 },
-  { "RTS                             ", 0xF825, 0x00, 0x33, 0x83, 0x27, 0xF9 },
-  { "INY                             ", 0xD2AD, 0x00, 0x33, 0x83, 0x27, 0xFB },
-  { "LDA #$69                        ", 0xD2AE, 0x00, 0x33, 0x84, 0xA5, 0xFB },
-  { "STA $78 = 70                    ", 0xD2B0, 0x69, 0x33, 0x84, 0x25, 0xFB },
-  { "JSR $F829                       ", 0xD2B2, 0x69, 0x33, 0x84, 0x25, 0xFB },
-  { "CLC                             ", 0xF829, 0x69, 0x33, 0x84, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF82A, 0x69, 0x33, 0x84, 0x24, 0xF9 },
-  { "LDA #$00                        ", 0xF82C, 0x69, 0x33, 0x84, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF82E, 0x00, 0x33, 0x84, 0x66, 0xF9 },
-  { "ADC $78 = 69                    ", 0xD2B5, 0x00, 0x33, 0x84, 0x66, 0xFB },
-  { "JSR $F82F                       ", 0xD2B7, 0x69, 0x33, 0x84, 0x24, 0xFB },
-  { "BMI $F83A                       ", 0xF82F, 0x69, 0x33, 0x84, 0x24, 0xF9 },
-  { "BCS $F83A                       ", 0xF831, 0x69, 0x33, 0x84, 0x24, 0xF9 },
-  { "CMP #$69                        ", 0xF833, 0x69, 0x33, 0x84, 0x24, 0xF9 },
-  { "BNE $F83A                       ", 0xF835, 0x69, 0x33, 0x84, 0x27, 0xF9 },
-  { "BVS $F83A                       ", 0xF837, 0x69, 0x33, 0x84, 0x27, 0xF9 },
-  { "RTS                             ", 0xF839, 0x69, 0x33, 0x84, 0x27, 0xF9 },
-  { "INY                             ", 0xD2BA, 0x69, 0x33, 0x84, 0x27, 0xFB },
-  { "JSR $F83D                       ", 0xD2BB, 0x69, 0x33, 0x85, 0xA5, 0xFB },
-  { "SEC                             ", 0xF83D, 0x69, 0x33, 0x85, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF83E, 0x69, 0x33, 0x85, 0xA5, 0xF9 },
-  { "LDA #$00                        ", 0xF840, 0x69, 0x33, 0x85, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF842, 0x00, 0x33, 0x85, 0x67, 0xF9 },
-  { "ADC $78 = 69                    ", 0xD2BE, 0x00, 0x33, 0x85, 0x67, 0xFB },
-  { "JSR $F843                       ", 0xD2C0, 0x6A, 0x33, 0x85, 0x24, 0xFB },
-  { "BMI $F84E                       ", 0xF843, 0x6A, 0x33, 0x85, 0x24, 0xF9 },
-  { "BCS $F84E                       ", 0xF845, 0x6A, 0x33, 0x85, 0x24, 0xF9 },
-  { "CMP #$6A                        ", 0xF847, 0x6A, 0x33, 0x85, 0x24, 0xF9 },
-  { "BNE $F84E                       ", 0xF849, 0x6A, 0x33, 0x85, 0x27, 0xF9 },
-  { "BVS $F84E                       ", 0xF84B, 0x6A, 0x33, 0x85, 0x27, 0xF9 },
-  { "RTS                             ", 0xF84D, 0x6A, 0x33, 0x85, 0x27, 0xF9 },
-  { "INY                             ", 0xD2C3, 0x6A, 0x33, 0x85, 0x27, 0xFB },
-  { "LDA #$7F                        ", 0xD2C4, 0x6A, 0x33, 0x86, 0xA5, 0xFB },
-  { "STA $78 = 69                    ", 0xD2C6, 0x7F, 0x33, 0x86, 0x25, 0xFB },
-  { "JSR $F851                       ", 0xD2C8, 0x7F, 0x33, 0x86, 0x25, 0xFB },
-  { "SEC                             ", 0xF851, 0x7F, 0x33, 0x86, 0x25, 0xF9 },
-  { "CLV                             ", 0xF852, 0x7F, 0x33, 0x86, 0x25, 0xF9 },
-  { "LDA #$7F                        ", 0xF853, 0x7F, 0x33, 0x86, 0x25, 0xF9 },
-  { "RTS                             ", 0xF855, 0x7F, 0x33, 0x86, 0x25, 0xF9 },
-  { "ADC $78 = 7F                    ", 0xD2CB, 0x7F, 0x33, 0x86, 0x25, 0xFB },
-  { "JSR $F856                       ", 0xD2CD, 0xFF, 0x33, 0x86, 0xE4, 0xFB },
-  { "BPL $F861                       ", 0xF856, 0xFF, 0x33, 0x86, 0xE4, 0xF9 },
-  { "BCS $F861                       ", 0xF858, 0xFF, 0x33, 0x86, 0xE4, 0xF9 },
-  { "CMP #$FF                        ", 0xF85A, 0xFF, 0x33, 0x86, 0xE4, 0xF9 },
-  { "BNE $F861                       ", 0xF85C, 0xFF, 0x33, 0x86, 0x67, 0xF9 },
-  { "BVC $F861                       ", 0xF85E, 0xFF, 0x33, 0x86, 0x67, 0xF9 },
-  { "RTS                             ", 0xF860, 0xFF, 0x33, 0x86, 0x67, 0xF9 },
-  { "INY                             ", 0xD2D0, 0xFF, 0x33, 0x86, 0x67, 0xFB },
-  { "LDA #$80                        ", 0xD2D1, 0xFF, 0x33, 0x87, 0xE5, 0xFB },
-  { "STA $78 = 7F                    ", 0xD2D3, 0x80, 0x33, 0x87, 0xE5, 0xFB },
-  { "JSR $F864                       ", 0xD2D5, 0x80, 0x33, 0x87, 0xE5, 0xFB },
-  { "CLC                             ", 0xF864, 0x80, 0x33, 0x87, 0xE5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF865, 0x80, 0x33, 0x87, 0xE4, 0xF9 },
-  { "LDA #$7F                        ", 0xF867, 0x80, 0x33, 0x87, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF869, 0x7F, 0x33, 0x87, 0x64, 0xF9 },
-  { "ADC $78 = 80                    ", 0xD2D8, 0x7F, 0x33, 0x87, 0x64, 0xFB },
-  { "JSR $F86A                       ", 0xD2DA, 0xFF, 0x33, 0x87, 0xA4, 0xFB },
-  { "BPL $F875                       ", 0xF86A, 0xFF, 0x33, 0x87, 0xA4, 0xF9 },
-  { "BCS $F875                       ", 0xF86C, 0xFF, 0x33, 0x87, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF86E, 0xFF, 0x33, 0x87, 0xA4, 0xF9 },
-  { "BNE $F875                       ", 0xF870, 0xFF, 0x33, 0x87, 0x27, 0xF9 },
-  { "BVS $F875                       ", 0xF872, 0xFF, 0x33, 0x87, 0x27, 0xF9 },
-  { "RTS                             ", 0xF874, 0xFF, 0x33, 0x87, 0x27, 0xF9 },
-  { "INY                             ", 0xD2DD, 0xFF, 0x33, 0x87, 0x27, 0xFB },
-  { "JSR $F878                       ", 0xD2DE, 0xFF, 0x33, 0x88, 0xA5, 0xFB },
-  { "SEC                             ", 0xF878, 0xFF, 0x33, 0x88, 0xA5, 0xF9 },
-  { "CLV                             ", 0xF879, 0xFF, 0x33, 0x88, 0xA5, 0xF9 },
-  { "LDA #$7F                        ", 0xF87A, 0xFF, 0x33, 0x88, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF87C, 0x7F, 0x33, 0x88, 0x25, 0xF9 },
-  { "ADC $78 = 80                    ", 0xD2E1, 0x7F, 0x33, 0x88, 0x25, 0xFB },
-  { "JSR $F87D                       ", 0xD2E3, 0x00, 0x33, 0x88, 0x27, 0xFB },
-  { "BNE $F886                       ", 0xF87D, 0x00, 0x33, 0x88, 0x27, 0xF9 },
-  { "BMI $F886                       ", 0xF87F, 0x00, 0x33, 0x88, 0x27, 0xF9 },
-  { "BVS $F886                       ", 0xF881, 0x00, 0x33, 0x88, 0x27, 0xF9 },
-  { "BCC $F886                       ", 0xF883, 0x00, 0x33, 0x88, 0x27, 0xF9 },
-  { "RTS                             ", 0xF885, 0x00, 0x33, 0x88, 0x27, 0xF9 },
-  { "INY                             ", 0xD2E6, 0x00, 0x33, 0x88, 0x27, 0xFB },
-  { "LDA #$40                        ", 0xD2E7, 0x00, 0x33, 0x89, 0xA5, 0xFB },
-  { "STA $78 = 80                    ", 0xD2E9, 0x40, 0x33, 0x89, 0x25, 0xFB },
-  { "JSR $F889                       ", 0xD2EB, 0x40, 0x33, 0x89, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF889, 0x40, 0x33, 0x89, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF88B, 0x40, 0x33, 0x89, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF88D, 0x40, 0x33, 0x89, 0x65, 0xF9 },
-  { "CMP $78 = 40                    ", 0xD2EE, 0x40, 0x33, 0x89, 0x65, 0xFB },
-  { "JSR $F88E                       ", 0xD2F0, 0x40, 0x33, 0x89, 0x67, 0xFB },
-  { "BMI $F897                       ", 0xF88E, 0x40, 0x33, 0x89, 0x67, 0xF9 },
-  { "BCC $F897                       ", 0xF890, 0x40, 0x33, 0x89, 0x67, 0xF9 },
-  { "BNE $F897                       ", 0xF892, 0x40, 0x33, 0x89, 0x67, 0xF9 },
-  { "BVC $F897                       ", 0xF894, 0x40, 0x33, 0x89, 0x67, 0xF9 },
-  { "RTS                             ", 0xF896, 0x40, 0x33, 0x89, 0x67, 0xF9 },
-  { "INY                             ", 0xD2F3, 0x40, 0x33, 0x89, 0x67, 0xFB },
-  { "PHA                             ", 0xD2F4, 0x40, 0x33, 0x8A, 0xE5, 0xFB },
-  { "LDA #$3F                        ", 0xD2F5, 0x40, 0x33, 0x8A, 0xE5, 0xFA },
-  { "STA $78 = 40                    ", 0xD2F7, 0x3F, 0x33, 0x8A, 0x65, 0xFA },
-  { "PLA                             ", 0xD2F9, 0x3F, 0x33, 0x8A, 0x65, 0xFA },
-  { "JSR $F89A                       ", 0xD2FA, 0x40, 0x33, 0x8A, 0x65, 0xFB },
-  { "CLV                             ", 0xF89A, 0x40, 0x33, 0x8A, 0x65, 0xF9 },
-  { "RTS                             ", 0xF89B, 0x40, 0x33, 0x8A, 0x25, 0xF9 },
-  { "CMP $78 = 3F                    ", 0xD2FD, 0x40, 0x33, 0x8A, 0x25, 0xFB },
-  { "JSR $F89C                       ", 0xD2FF, 0x40, 0x33, 0x8A, 0x25, 0xFB },
-  { "BEQ $F8A5                       ", 0xF89C, 0x40, 0x33, 0x8A, 0x25, 0xF9 },
-  { "BMI $F8A5                       ", 0xF89E, 0x40, 0x33, 0x8A, 0x25, 0xF9 },
-  { "BCC $F8A5                       ", 0xF8A0, 0x40, 0x33, 0x8A, 0x25, 0xF9 },
-  { "BVS $F8A5                       ", 0xF8A2, 0x40, 0x33, 0x8A, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8A4, 0x40, 0x33, 0x8A, 0x25, 0xF9 },
-  { "INY                             ", 0xD302, 0x40, 0x33, 0x8A, 0x25, 0xFB },
-  { "PHA                             ", 0xD303, 0x40, 0x33, 0x8B, 0xA5, 0xFB },
-  { "LDA #$41                        ", 0xD304, 0x40, 0x33, 0x8B, 0xA5, 0xFA },
-  { "STA $78 = 3F                    ", 0xD306, 0x41, 0x33, 0x8B, 0x25, 0xFA },
-  { "PLA                             ", 0xD308, 0x41, 0x33, 0x8B, 0x25, 0xFA },
-  { "CMP $78 = 41                    ", 0xD309, 0x40, 0x33, 0x8B, 0x25, 0xFB },
-  { "JSR $F8A8                       ", 0xD30B, 0x40, 0x33, 0x8B, 0xA4, 0xFB },
-  { "BEQ $F8AF                       ", 0xF8A8, 0x40, 0x33, 0x8B, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AA, 0x40, 0x33, 0x8B, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AC, 0x40, 0x33, 0x8B, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8AE, 0x40, 0x33, 0x8B, 0xA4, 0xF9 },
-  { "INY                             ", 0xD30E, 0x40, 0x33, 0x8B, 0xA4, 0xFB },
-  { "PHA                             ", 0xD30F, 0x40, 0x33, 0x8C, 0xA4, 0xFB },
-  { "LDA #$00                        ", 0xD310, 0x40, 0x33, 0x8C, 0xA4, 0xFA },
-  { "STA $78 = 41                    ", 0xD312, 0x00, 0x33, 0x8C, 0x26, 0xFA },
-  { "PLA                             ", 0xD314, 0x00, 0x33, 0x8C, 0x26, 0xFA },
-  { "JSR $F8B2                       ", 0xD315, 0x40, 0x33, 0x8C, 0x24, 0xFB },
-  { "LDA #$80                        ", 0xF8B2, 0x40, 0x33, 0x8C, 0x24, 0xF9 },
-  { "RTS                             ", 0xF8B4, 0x80, 0x33, 0x8C, 0xA4, 0xF9 },
-  { "CMP $78 = 00                    ", 0xD318, 0x80, 0x33, 0x8C, 0xA4, 0xFB },
-  { "JSR $F8B5                       ", 0xD31A, 0x80, 0x33, 0x8C, 0xA5, 0xFB },
-  { "BEQ $F8BC                       ", 0xF8B5, 0x80, 0x33, 0x8C, 0xA5, 0xF9 },
-  { "BPL $F8BC                       ", 0xF8B7, 0x80, 0x33, 0x8C, 0xA5, 0xF9 },
-  { "BCC $F8BC                       ", 0xF8B9, 0x80, 0x33, 0x8C, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF8BB, 0x80, 0x33, 0x8C, 0xA5, 0xF9 },
-  { "INY                             ", 0xD31D, 0x80, 0x33, 0x8C, 0xA5, 0xFB },
-  { "PHA                             ", 0xD31E, 0x80, 0x33, 0x8D, 0xA5, 0xFB },
-  { "LDA #$80                        ", 0xD31F, 0x80, 0x33, 0x8D, 0xA5, 0xFA },
-  { "STA $78 = 00                    ", 0xD321, 0x80, 0x33, 0x8D, 0xA5, 0xFA },
-  { "PLA                             ", 0xD323, 0x80, 0x33, 0x8D, 0xA5, 0xFA },
-  { "CMP $78 = 80                    ", 0xD324, 0x80, 0x33, 0x8D, 0xA5, 0xFB },
-  { "JSR $F8BF                       ", 0xD326, 0x80, 0x33, 0x8D, 0x27, 0xFB },
-  { "BNE $F8C6                       ", 0xF8BF, 0x80, 0x33, 0x8D, 0x27, 0xF9 },
-  { "BMI $F8C6                       ", 0xF8C1, 0x80, 0x33, 0x8D, 0x27, 0xF9 },
-  { "BCC $F8C6                       ", 0xF8C3, 0x80, 0x33, 0x8D, 0x27, 0xF9 },
-  { "RTS                             ", 0xF8C5, 0x80, 0x33, 0x8D, 0x27, 0xF9 },
-  { "INY                             ", 0xD329, 0x80, 0x33, 0x8D, 0x27, 0xFB },
-  { "PHA                             ", 0xD32A, 0x80, 0x33, 0x8E, 0xA5, 0xFB },
-  { "LDA #$81                        ", 0xD32B, 0x80, 0x33, 0x8E, 0xA5, 0xFA },
-  { "STA $78 = 80                    ", 0xD32D, 0x81, 0x33, 0x8E, 0xA5, 0xFA },
-  { "PLA                             ", 0xD32F, 0x81, 0x33, 0x8E, 0xA5, 0xFA },
-  { "CMP $78 = 81                    ", 0xD330, 0x80, 0x33, 0x8E, 0xA5, 0xFB },
-  { "JSR $F8C9                       ", 0xD332, 0x80, 0x33, 0x8E, 0xA4, 0xFB },
-  { "BCS $F8D0                       ", 0xF8C9, 0x80, 0x33, 0x8E, 0xA4, 0xF9 },
-  { "BEQ $F8D0                       ", 0xF8CB, 0x80, 0x33, 0x8E, 0xA4, 0xF9 },
-  { "BPL $F8D0                       ", 0xF8CD, 0x80, 0x33, 0x8E, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8CF, 0x80, 0x33, 0x8E, 0xA4, 0xF9 },
-  { "INY                             ", 0xD335, 0x80, 0x33, 0x8E, 0xA4, 0xFB },
-  { "PHA                             ", 0xD336, 0x80, 0x33, 0x8F, 0xA4, 0xFB },
-  { "LDA #$7F                        ", 0xD337, 0x80, 0x33, 0x8F, 0xA4, 0xFA },
-  { "STA $78 = 81                    ", 0xD339, 0x7F, 0x33, 0x8F, 0x24, 0xFA },
-  { "PLA                             ", 0xD33B, 0x7F, 0x33, 0x8F, 0x24, 0xFA },
-  { "CMP $78 = 7F                    ", 0xD33C, 0x80, 0x33, 0x8F, 0xA4, 0xFB },
-  { "JSR $F8D3                       ", 0xD33E, 0x80, 0x33, 0x8F, 0x25, 0xFB },
-  { "BCC $F8DA                       ", 0xF8D3, 0x80, 0x33, 0x8F, 0x25, 0xF9 },
-  { "BEQ $F8DA                       ", 0xF8D5, 0x80, 0x33, 0x8F, 0x25, 0xF9 },
-  { "BMI $F8DA                       ", 0xF8D7, 0x80, 0x33, 0x8F, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8D9, 0x80, 0x33, 0x8F, 0x25, 0xF9 },
-  { "INY                             ", 0xD341, 0x80, 0x33, 0x8F, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xD342, 0x80, 0x33, 0x90, 0xA5, 0xFB },
-  { "STA $78 = 7F                    ", 0xD344, 0x40, 0x33, 0x90, 0x25, 0xFB },
-  { "JSR $F931                       ", 0xD346, 0x40, 0x33, 0x90, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF931, 0x40, 0x33, 0x90, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF933, 0x40, 0x33, 0x90, 0xE5, 0xF9 },
-  { "SEC                             ", 0xF935, 0x40, 0x33, 0x90, 0x65, 0xF9 },
-  { "RTS                             ", 0xF936, 0x40, 0x33, 0x90, 0x65, 0xF9 },
-  { "SBC $78 = 40                    ", 0xD349, 0x40, 0x33, 0x90, 0x65, 0xFB },
-  { "JSR $F937                       ", 0xD34B, 0x00, 0x33, 0x90, 0x27, 0xFB },
-  { "BMI $F944                       ", 0xF937, 0x00, 0x33, 0x90, 0x27, 0xF9 },
-  { "BCC $F944                       ", 0xF939, 0x00, 0x33, 0x90, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF93B, 0x00, 0x33, 0x90, 0x27, 0xF9 },
-  { "BVS $F944                       ", 0xF93D, 0x00, 0x33, 0x90, 0x27, 0xF9 },
-  { "CMP #$00                        ", 0xF93F, 0x00, 0x33, 0x90, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF941, 0x00, 0x33, 0x90, 0x27, 0xF9 },
-  { "RTS                             ", 0xF943, 0x00, 0x33, 0x90, 0x27, 0xF9 },
-  { "INY                             ", 0xD34E, 0x00, 0x33, 0x90, 0x27, 0xFB },
-  { "LDA #$3F                        ", 0xD34F, 0x00, 0x33, 0x91, 0xA5, 0xFB },
-  { "STA $78 = 40                    ", 0xD351, 0x3F, 0x33, 0x91, 0x25, 0xFB },
-  { "JSR $F947                       ", 0xD353, 0x3F, 0x33, 0x91, 0x25, 0xFB },
-  { "CLV                             ", 0xF947, 0x3F, 0x33, 0x91, 0x25, 0xF9 },
-  { "SEC                             ", 0xF948, 0x3F, 0x33, 0x91, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF949, 0x3F, 0x33, 0x91, 0x25, 0xF9 },
-  { "RTS                             ", 0xF94B, 0x40, 0x33, 0x91, 0x25, 0xF9 },
-  { "SBC $78 = 3F                    ", 0xD356, 0x40, 0x33, 0x91, 0x25, 0xFB },
-  { "JSR $F94C                       ", 0xD358, 0x01, 0x33, 0x91, 0x25, 0xFB },
-  { "BEQ $F959                       ", 0xF94C, 0x01, 0x33, 0x91, 0x25, 0xF9 },
-  { "BMI $F959                       ", 0xF94E, 0x01, 0x33, 0x91, 0x25, 0xF9 },
-  { "BCC $F959                       ", 0xF950, 0x01, 0x33, 0x91, 0x25, 0xF9 },
-  { "BVS $F959                       ", 0xF952, 0x01, 0x33, 0x91, 0x25, 0xF9 },
-  { "CMP #$01                        ", 0xF954, 0x01, 0x33, 0x91, 0x25, 0xF9 },
-  { "BNE $F959                       ", 0xF956, 0x01, 0x33, 0x91, 0x27, 0xF9 },
-  { "RTS                             ", 0xF958, 0x01, 0x33, 0x91, 0x27, 0xF9 },
-  { "INY                             ", 0xD35B, 0x01, 0x33, 0x91, 0x27, 0xFB },
-  { "LDA #$41                        ", 0xD35C, 0x01, 0x33, 0x92, 0xA5, 0xFB },
-  { "STA $78 = 3F                    ", 0xD35E, 0x41, 0x33, 0x92, 0x25, 0xFB },
-  { "JSR $F95C                       ", 0xD360, 0x41, 0x33, 0x92, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xF95C, 0x41, 0x33, 0x92, 0x25, 0xF9 },
-  { "SEC                             ", 0xF95E, 0x40, 0x33, 0x92, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF95F, 0x40, 0x33, 0x92, 0x25, 0xF9 },
-  { "RTS                             ", 0xF961, 0x40, 0x33, 0x92, 0xE5, 0xF9 },
-  { "SBC $78 = 41                    ", 0xD363, 0x40, 0x33, 0x92, 0xE5, 0xFB },
-  { "JSR $F962                       ", 0xD365, 0xFF, 0x33, 0x92, 0xA4, 0xFB },
-  { "BCS $F96F                       ", 0xF962, 0xFF, 0x33, 0x92, 0xA4, 0xF9 },
-  { "BEQ $F96F                       ", 0xF964, 0xFF, 0x33, 0x92, 0xA4, 0xF9 },
-  { "BPL $F96F                       ", 0xF966, 0xFF, 0x33, 0x92, 0xA4, 0xF9 },
-  { "BVS $F96F                       ", 0xF968, 0xFF, 0x33, 0x92, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF96A, 0xFF, 0x33, 0x92, 0xA4, 0xF9 },
-  { "BNE $F96F                       ", 0xF96C, 0xFF, 0x33, 0x92, 0x27, 0xF9 },
-  { "RTS                             ", 0xF96E, 0xFF, 0x33, 0x92, 0x27, 0xF9 },
-  { "INY                             ", 0xD368, 0xFF, 0x33, 0x92, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xD369, 0xFF, 0x33, 0x93, 0xA5, 0xFB },
-  { "STA $78 = 41                    ", 0xD36B, 0x00, 0x33, 0x93, 0x27, 0xFB },
-  { "JSR $F972                       ", 0xD36D, 0x00, 0x33, 0x93, 0x27, 0xFB },
-  { "CLC                             ", 0xF972, 0x00, 0x33, 0x93, 0x27, 0xF9 },
-  { "LDA #$80                        ", 0xF973, 0x00, 0x33, 0x93, 0x26, 0xF9 },
-  { "RTS                             ", 0xF975, 0x80, 0x33, 0x93, 0xA4, 0xF9 },
-  { "SBC $78 = 00                    ", 0xD370, 0x80, 0x33, 0x93, 0xA4, 0xFB },
-  { "JSR $F976                       ", 0xD372, 0x7F, 0x33, 0x93, 0x65, 0xFB },
-  { "BCC $F97D                       ", 0xF976, 0x7F, 0x33, 0x93, 0x65, 0xF9 },
-  { "CMP #$7F                        ", 0xF978, 0x7F, 0x33, 0x93, 0x65, 0xF9 },
-  { "BNE $F97D                       ", 0xF97A, 0x7F, 0x33, 0x93, 0x67, 0xF9 },
-  { "RTS                             ", 0xF97C, 0x7F, 0x33, 0x93, 0x67, 0xF9 },
-  { "INY                             ", 0xD375, 0x7F, 0x33, 0x93, 0x67, 0xFB },
-  { "LDA #$7F                        ", 0xD376, 0x7F, 0x33, 0x94, 0xE5, 0xFB },
-  { "STA $78 = 00                    ", 0xD378, 0x7F, 0x33, 0x94, 0x65, 0xFB },
-  { "JSR $F980                       ", 0xD37A, 0x7F, 0x33, 0x94, 0x65, 0xFB },
-  { "SEC                             ", 0xF980, 0x7F, 0x33, 0x94, 0x65, 0xF9 },
-  { "LDA #$81                        ", 0xF981, 0x7F, 0x33, 0x94, 0x65, 0xF9 },
-  { "RTS                             ", 0xF983, 0x81, 0x33, 0x94, 0xE5, 0xF9 },
-  { "SBC $78 = 7F                    ", 0xD37D, 0x81, 0x33, 0x94, 0xE5, 0xFB },
-  { "JSR $F984                       ", 0xD37F, 0x02, 0x33, 0x94, 0x65, 0xFB },
-  { "BVC $F98D                       ", 0xF984, 0x02, 0x33, 0x94, 0x65, 0xF9 },
-  { "BCC $F98D                       ", 0xF986, 0x02, 0x33, 0x94, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xF988, 0x02, 0x33, 0x94, 0x65, 0xF9 },
-  { "BNE $F98D                       ", 0xF98A, 0x02, 0x33, 0x94, 0x67, 0xF9 },
-  { "RTS                             ", 0xF98C, 0x02, 0x33, 0x94, 0x67, 0xF9 },
-  { "INY                             ", 0xD382, 0x02, 0x33, 0x94, 0x67, 0xFB },
-  { "LDA #$40                        ", 0xD383, 0x02, 0x33, 0x95, 0xE5, 0xFB },
-  { "STA $78 = 7F                    ", 0xD385, 0x40, 0x33, 0x95, 0x65, 0xFB },
-  { "JSR $F889                       ", 0xD387, 0x40, 0x33, 0x95, 0x65, 0xFB },
-  { "BIT $01 = FF                    ", 0xF889, 0x40, 0x33, 0x95, 0x65, 0xF9 },
-  { "LDA #$40                        ", 0xF88B, 0x40, 0x33, 0x95, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF88D, 0x40, 0x33, 0x95, 0x65, 0xF9 },
-  { "TAX                             ", 0xD38A, 0x40, 0x33, 0x95, 0x65, 0xFB },
-  { "CPX $78 = 40                    ", 0xD38B, 0x40, 0x40, 0x95, 0x65, 0xFB },
-  { "JSR $F88E                       ", 0xD38D, 0x40, 0x40, 0x95, 0x67, 0xFB },
-  { "BMI $F897                       ", 0xF88E, 0x40, 0x40, 0x95, 0x67, 0xF9 },
-  { "BCC $F897                       ", 0xF890, 0x40, 0x40, 0x95, 0x67, 0xF9 },
-  { "BNE $F897                       ", 0xF892, 0x40, 0x40, 0x95, 0x67, 0xF9 },
-  { "BVC $F897                       ", 0xF894, 0x40, 0x40, 0x95, 0x67, 0xF9 },
-  { "RTS                             ", 0xF896, 0x40, 0x40, 0x95, 0x67, 0xF9 },
-  { "INY                             ", 0xD390, 0x40, 0x40, 0x95, 0x67, 0xFB },
-  { "LDA #$3F                        ", 0xD391, 0x40, 0x40, 0x96, 0xE5, 0xFB },
-  { "STA $78 = 40                    ", 0xD393, 0x3F, 0x40, 0x96, 0x65, 0xFB },
-  { "JSR $F89A                       ", 0xD395, 0x3F, 0x40, 0x96, 0x65, 0xFB },
-  { "CLV                             ", 0xF89A, 0x3F, 0x40, 0x96, 0x65, 0xF9 },
-  { "RTS                             ", 0xF89B, 0x3F, 0x40, 0x96, 0x25, 0xF9 },
-  { "CPX $78 = 3F                    ", 0xD398, 0x3F, 0x40, 0x96, 0x25, 0xFB },
-  { "JSR $F89C                       ", 0xD39A, 0x3F, 0x40, 0x96, 0x25, 0xFB },
-  { "BEQ $F8A5                       ", 0xF89C, 0x3F, 0x40, 0x96, 0x25, 0xF9 },
-  { "BMI $F8A5                       ", 0xF89E, 0x3F, 0x40, 0x96, 0x25, 0xF9 },
-  { "BCC $F8A5                       ", 0xF8A0, 0x3F, 0x40, 0x96, 0x25, 0xF9 },
-  { "BVS $F8A5                       ", 0xF8A2, 0x3F, 0x40, 0x96, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8A4, 0x3F, 0x40, 0x96, 0x25, 0xF9 },
-  { "INY                             ", 0xD39D, 0x3F, 0x40, 0x96, 0x25, 0xFB },
-  { "LDA #$41                        ", 0xD39E, 0x3F, 0x40, 0x97, 0xA5, 0xFB },
-  { "STA $78 = 3F                    ", 0xD3A0, 0x41, 0x40, 0x97, 0x25, 0xFB },
-  { "CPX $78 = 41                    ", 0xD3A2, 0x41, 0x40, 0x97, 0x25, 0xFB },
-  { "JSR $F8A8                       ", 0xD3A4, 0x41, 0x40, 0x97, 0xA4, 0xFB },
-  { "BEQ $F8AF                       ", 0xF8A8, 0x41, 0x40, 0x97, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AA, 0x41, 0x40, 0x97, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AC, 0x41, 0x40, 0x97, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8AE, 0x41, 0x40, 0x97, 0xA4, 0xF9 },
-  { "INY                             ", 0xD3A7, 0x41, 0x40, 0x97, 0xA4, 0xFB },
-  { "LDA #$00                        ", 0xD3A8, 0x41, 0x40, 0x98, 0xA4, 0xFB },
-  { "STA $78 = 41                    ", 0xD3AA, 0x00, 0x40, 0x98, 0x26, 0xFB },
-  { "JSR $F8B2                       ", 0xD3AC, 0x00, 0x40, 0x98, 0x26, 0xFB },
-  { "LDA #$80                        ", 0xF8B2, 0x00, 0x40, 0x98, 0x26, 0xF9 },
-  { "RTS                             ", 0xF8B4, 0x80, 0x40, 0x98, 0xA4, 0xF9 },
-  { "TAX                             ", 0xD3AF, 0x80, 0x40, 0x98, 0xA4, 0xFB },
-  { "CPX $78 = 00                    ", 0xD3B0, 0x80, 0x80, 0x98, 0xA4, 0xFB },
-  { "JSR $F8B5                       ", 0xD3B2, 0x80, 0x80, 0x98, 0xA5, 0xFB },
-  { "BEQ $F8BC                       ", 0xF8B5, 0x80, 0x80, 0x98, 0xA5, 0xF9 },
-  { "BPL $F8BC                       ", 0xF8B7, 0x80, 0x80, 0x98, 0xA5, 0xF9 },
-  { "BCC $F8BC                       ", 0xF8B9, 0x80, 0x80, 0x98, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF8BB, 0x80, 0x80, 0x98, 0xA5, 0xF9 },
-  { "INY                             ", 0xD3B5, 0x80, 0x80, 0x98, 0xA5, 0xFB },
-  { "LDA #$80                        ", 0xD3B6, 0x80, 0x80, 0x99, 0xA5, 0xFB },
-  { "STA $78 = 00                    ", 0xD3B8, 0x80, 0x80, 0x99, 0xA5, 0xFB },
-  { "CPX $78 = 80                    ", 0xD3BA, 0x80, 0x80, 0x99, 0xA5, 0xFB },
-  { "JSR $F8BF                       ", 0xD3BC, 0x80, 0x80, 0x99, 0x27, 0xFB },
-  { "BNE $F8C6                       ", 0xF8BF, 0x80, 0x80, 0x99, 0x27, 0xF9 },
-  { "BMI $F8C6                       ", 0xF8C1, 0x80, 0x80, 0x99, 0x27, 0xF9 },
-  { "BCC $F8C6                       ", 0xF8C3, 0x80, 0x80, 0x99, 0x27, 0xF9 },
-  { "RTS                             ", 0xF8C5, 0x80, 0x80, 0x99, 0x27, 0xF9 },
-  { "INY                             ", 0xD3BF, 0x80, 0x80, 0x99, 0x27, 0xFB },
-  { "LDA #$81                        ", 0xD3C0, 0x80, 0x80, 0x9A, 0xA5, 0xFB },
-  { "STA $78 = 80                    ", 0xD3C2, 0x81, 0x80, 0x9A, 0xA5, 0xFB },
-  { "CPX $78 = 81                    ", 0xD3C4, 0x81, 0x80, 0x9A, 0xA5, 0xFB },
-  { "JSR $F8C9                       ", 0xD3C6, 0x81, 0x80, 0x9A, 0xA4, 0xFB },
-  { "BCS $F8D0                       ", 0xF8C9, 0x81, 0x80, 0x9A, 0xA4, 0xF9 },
-  { "BEQ $F8D0                       ", 0xF8CB, 0x81, 0x80, 0x9A, 0xA4, 0xF9 },
-  { "BPL $F8D0                       ", 0xF8CD, 0x81, 0x80, 0x9A, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8CF, 0x81, 0x80, 0x9A, 0xA4, 0xF9 },
-  { "INY                             ", 0xD3C9, 0x81, 0x80, 0x9A, 0xA4, 0xFB },
-  { "LDA #$7F                        ", 0xD3CA, 0x81, 0x80, 0x9B, 0xA4, 0xFB },
-  { "STA $78 = 81                    ", 0xD3CC, 0x7F, 0x80, 0x9B, 0x24, 0xFB },
-  { "CPX $78 = 7F                    ", 0xD3CE, 0x7F, 0x80, 0x9B, 0x24, 0xFB },
-  { "JSR $F8D3                       ", 0xD3D0, 0x7F, 0x80, 0x9B, 0x25, 0xFB },
-  { "BCC $F8DA                       ", 0xF8D3, 0x7F, 0x80, 0x9B, 0x25, 0xF9 },
-  { "BEQ $F8DA                       ", 0xF8D5, 0x7F, 0x80, 0x9B, 0x25, 0xF9 },
-  { "BMI $F8DA                       ", 0xF8D7, 0x7F, 0x80, 0x9B, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8D9, 0x7F, 0x80, 0x9B, 0x25, 0xF9 },
-  { "INY                             ", 0xD3D3, 0x7F, 0x80, 0x9B, 0x25, 0xFB },
-  { "TYA                             ", 0xD3D4, 0x7F, 0x80, 0x9C, 0xA5, 0xFB },
-  { "TAX                             ", 0xD3D5, 0x9C, 0x80, 0x9C, 0xA5, 0xFB },
-  { "LDA #$40                        ", 0xD3D6, 0x9C, 0x9C, 0x9C, 0xA5, 0xFB },
-  { "STA $78 = 7F                    ", 0xD3D8, 0x40, 0x9C, 0x9C, 0x25, 0xFB },
-  { "JSR $F8DD                       ", 0xD3DA, 0x40, 0x9C, 0x9C, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF8DD, 0x40, 0x9C, 0x9C, 0x25, 0xF9 },
-  { "LDY #$40                        ", 0xF8DF, 0x40, 0x9C, 0x9C, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF8E1, 0x40, 0x9C, 0x40, 0x65, 0xF9 },
-  { "CPY $78 = 40                    ", 0xD3DD, 0x40, 0x9C, 0x40, 0x65, 0xFB },
-  { "JSR $F8E2                       ", 0xD3DF, 0x40, 0x9C, 0x40, 0x67, 0xFB },
-  { "BMI $F8EB                       ", 0xF8E2, 0x40, 0x9C, 0x40, 0x67, 0xF9 },
-  { "BCC $F8EB                       ", 0xF8E4, 0x40, 0x9C, 0x40, 0x67, 0xF9 },
-  { "BNE $F8EB                       ", 0xF8E6, 0x40, 0x9C, 0x40, 0x67, 0xF9 },
-  { "BVC $F8EB                       ", 0xF8E8, 0x40, 0x9C, 0x40, 0x67, 0xF9 },
-  { "RTS                             ", 0xF8EA, 0x40, 0x9C, 0x40, 0x67, 0xF9 },
-  { "INX                             ", 0xD3E2, 0x40, 0x9C, 0x40, 0x67, 0xFB },
-  { "LDA #$3F                        ", 0xD3E3, 0x40, 0x9D, 0x40, 0xE5, 0xFB },
-  { "STA $78 = 40                    ", 0xD3E5, 0x3F, 0x9D, 0x40, 0x65, 0xFB },
-  { "JSR $F8EE                       ", 0xD3E7, 0x3F, 0x9D, 0x40, 0x65, 0xFB },
-  { "CLV                             ", 0xF8EE, 0x3F, 0x9D, 0x40, 0x65, 0xF9 },
-  { "RTS                             ", 0xF8EF, 0x3F, 0x9D, 0x40, 0x25, 0xF9 },
-  { "CPY $78 = 3F                    ", 0xD3EA, 0x3F, 0x9D, 0x40, 0x25, 0xFB },
-  { "JSR $F8F0                       ", 0xD3EC, 0x3F, 0x9D, 0x40, 0x25, 0xFB },
-  { "BEQ $F8F9                       ", 0xF8F0, 0x3F, 0x9D, 0x40, 0x25, 0xF9 },
-  { "BMI $F8F9                       ", 0xF8F2, 0x3F, 0x9D, 0x40, 0x25, 0xF9 },
-  { "BCC $F8F9                       ", 0xF8F4, 0x3F, 0x9D, 0x40, 0x25, 0xF9 },
-  { "BVS $F8F9                       ", 0xF8F6, 0x3F, 0x9D, 0x40, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8F8, 0x3F, 0x9D, 0x40, 0x25, 0xF9 },
-  { "INX                             ", 0xD3EF, 0x3F, 0x9D, 0x40, 0x25, 0xFB },
-  { "LDA #$41                        ", 0xD3F0, 0x3F, 0x9E, 0x40, 0xA5, 0xFB },
-  { "STA $78 = 3F                    ", 0xD3F2, 0x41, 0x9E, 0x40, 0x25, 0xFB },
-  { "CPY $78 = 41                    ", 0xD3F4, 0x41, 0x9E, 0x40, 0x25, 0xFB },
-  { "JSR $F8FC                       ", 0xD3F6, 0x41, 0x9E, 0x40, 0xA4, 0xFB },
-  { "BEQ $F903                       ", 0xF8FC, 0x41, 0x9E, 0x40, 0xA4, 0xF9 },
-  { "BPL $F903                       ", 0xF8FE, 0x41, 0x9E, 0x40, 0xA4, 0xF9 },
-  { "BPL $F903                       ", 0xF900, 0x41, 0x9E, 0x40, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF902, 0x41, 0x9E, 0x40, 0xA4, 0xF9 },
-  { "INX                             ", 0xD3F9, 0x41, 0x9E, 0x40, 0xA4, 0xFB },
-  { "LDA #$00                        ", 0xD3FA, 0x41, 0x9F, 0x40, 0xA4, 0xFB },
-  { "STA $78 = 41                    ", 0xD3FC, 0x00, 0x9F, 0x40, 0x26, 0xFB },
-  { "JSR $F906                       ", 0xD3FE, 0x00, 0x9F, 0x40, 0x26, 0xFB },
-  { "LDY #$80                        ", 0xF906, 0x00, 0x9F, 0x40, 0x26, 0xF9 },
-  { "RTS                             ", 0xF908, 0x00, 0x9F, 0x80, 0xA4, 0xF9 },
-  { "CPY $78 = 00                    ", 0xD401, 0x00, 0x9F, 0x80, 0xA4, 0xFB },
-  { "JSR $F909                       ", 0xD403, 0x00, 0x9F, 0x80, 0xA5, 0xFB },
-  { "BEQ $F910                       ", 0xF909, 0x00, 0x9F, 0x80, 0xA5, 0xF9 },
-  { "BPL $F910                       ", 0xF90B, 0x00, 0x9F, 0x80, 0xA5, 0xF9 },
-  { "BCC $F910                       ", 0xF90D, 0x00, 0x9F, 0x80, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF90F, 0x00, 0x9F, 0x80, 0xA5, 0xF9 },
-  { "INX                             ", 0xD406, 0x00, 0x9F, 0x80, 0xA5, 0xFB },
-  { "LDA #$80                        ", 0xD407, 0x00, 0xA0, 0x80, 0xA5, 0xFB },
-  { "STA $78 = 00                    ", 0xD409, 0x80, 0xA0, 0x80, 0xA5, 0xFB },
-  { "CPY $78 = 80                    ", 0xD40B, 0x80, 0xA0, 0x80, 0xA5, 0xFB },
-  { "JSR $F913                       ", 0xD40D, 0x80, 0xA0, 0x80, 0x27, 0xFB },
-  { "BNE $F91A                       ", 0xF913, 0x80, 0xA0, 0x80, 0x27, 0xF9 },
-  { "BMI $F91A                       ", 0xF915, 0x80, 0xA0, 0x80, 0x27, 0xF9 },
-  { "BCC $F91A                       ", 0xF917, 0x80, 0xA0, 0x80, 0x27, 0xF9 },
-  { "RTS                             ", 0xF919, 0x80, 0xA0, 0x80, 0x27, 0xF9 },
-  { "INX                             ", 0xD410, 0x80, 0xA0, 0x80, 0x27, 0xFB },
-  { "LDA #$81                        ", 0xD411, 0x80, 0xA1, 0x80, 0xA5, 0xFB },
-  { "STA $78 = 80                    ", 0xD413, 0x81, 0xA1, 0x80, 0xA5, 0xFB },
-  { "CPY $78 = 81                    ", 0xD415, 0x81, 0xA1, 0x80, 0xA5, 0xFB },
-  { "JSR $F91D                       ", 0xD417, 0x81, 0xA1, 0x80, 0xA4, 0xFB },
-  { "BCS $F924                       ", 0xF91D, 0x81, 0xA1, 0x80, 0xA4, 0xF9 },
-  { "BEQ $F924                       ", 0xF91F, 0x81, 0xA1, 0x80, 0xA4, 0xF9 },
-  { "BPL $F924                       ", 0xF921, 0x81, 0xA1, 0x80, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF923, 0x81, 0xA1, 0x80, 0xA4, 0xF9 },
-  { "INX                             ", 0xD41A, 0x81, 0xA1, 0x80, 0xA4, 0xFB },
-  { "LDA #$7F                        ", 0xD41B, 0x81, 0xA2, 0x80, 0xA4, 0xFB },
-  { "STA $78 = 81                    ", 0xD41D, 0x7F, 0xA2, 0x80, 0x24, 0xFB },
-  { "CPY $78 = 7F                    ", 0xD41F, 0x7F, 0xA2, 0x80, 0x24, 0xFB },
-  { "JSR $F927                       ", 0xD421, 0x7F, 0xA2, 0x80, 0x25, 0xFB },
-  { "BCC $F92E                       ", 0xF927, 0x7F, 0xA2, 0x80, 0x25, 0xF9 },
-  { "BEQ $F92E                       ", 0xF929, 0x7F, 0xA2, 0x80, 0x25, 0xF9 },
-  { "BMI $F92E                       ", 0xF92B, 0x7F, 0xA2, 0x80, 0x25, 0xF9 },
-  { "RTS                             ", 0xF92D, 0x7F, 0xA2, 0x80, 0x25, 0xF9 },
-  { "INX                             ", 0xD424, 0x7F, 0xA2, 0x80, 0x25, 0xFB },
-  { "TXA                             ", 0xD425, 0x7F, 0xA3, 0x80, 0xA5, 0xFB },
-  { "TAY                             ", 0xD426, 0xA3, 0xA3, 0x80, 0xA5, 0xFB },
-  { "JSR $F990                       ", 0xD427, 0xA3, 0xA3, 0xA3, 0xA5, 0xFB },
-  { "LDX #$55                        ", 0xF990, 0xA3, 0xA3, 0xA3, 0xA5, 0xF9 },
-  { "LDA #$FF                        ", 0xF992, 0xA3, 0x55, 0xA3, 0x25, 0xF9 },
-  { "STA $01 = FF                    ", 0xF994, 0xFF, 0x55, 0xA3, 0xA5, 0xF9 },
-  { "NOP                             ", 0xF996, 0xFF, 0x55, 0xA3, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF997, 0xFF, 0x55, 0xA3, 0xA5, 0xF9 },
-  { "SEC                             ", 0xF999, 0xFF, 0x55, 0xA3, 0xE5, 0xF9 },
-  { "LDA #$01                        ", 0xF99A, 0xFF, 0x55, 0xA3, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF99C, 0x01, 0x55, 0xA3, 0x65, 0xF9 },
-  { "STA $78 = 7F                    ", 0xD42A, 0x01, 0x55, 0xA3, 0x65, 0xFB },
-  { "LSR $78 = 01                    ", 0xD42C, 0x01, 0x55, 0xA3, 0x65, 0xFB },
-  { "LDA $78 = 00                    ", 0xD42E, 0x01, 0x55, 0xA3, 0x67, 0xFB },
-  { "JSR $F99D                       ", 0xD430, 0x00, 0x55, 0xA3, 0x67, 0xFB },
-  { "BCC $F9BA                       ", 0xF99D, 0x00, 0x55, 0xA3, 0x67, 0xF9 },
-  { "BNE $F9BA                       ", 0xF99F, 0x00, 0x55, 0xA3, 0x67, 0xF9 },
-  { "BMI $F9BA                       ", 0xF9A1, 0x00, 0x55, 0xA3, 0x67, 0xF9 },
-  { "BVC $F9BA                       ", 0xF9A3, 0x00, 0x55, 0xA3, 0x67, 0xF9 },
-  { "CMP #$00                        ", 0xF9A5, 0x00, 0x55, 0xA3, 0x67, 0xF9 },
-  { "BNE $F9BA                       ", 0xF9A7, 0x00, 0x55, 0xA3, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9A9, 0x00, 0x55, 0xA3, 0x67, 0xF9 },
-  { "LDA #$AA                        ", 0xF9AA, 0x00, 0x55, 0xA3, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9AC, 0xAA, 0x55, 0xA3, 0xA5, 0xF9 },
-  { "INY                             ", 0xD433, 0xAA, 0x55, 0xA3, 0xA5, 0xFB },
-  { "STA $78 = 00                    ", 0xD434, 0xAA, 0x55, 0xA4, 0xA5, 0xFB },
-  { "LSR $78 = AA                    ", 0xD436, 0xAA, 0x55, 0xA4, 0xA5, 0xFB },
-  { "LDA $78 = 55                    ", 0xD438, 0xAA, 0x55, 0xA4, 0x24, 0xFB },
-  { "JSR $F9AD                       ", 0xD43A, 0x55, 0x55, 0xA4, 0x24, 0xFB },
-  { "BCS $F9BA                       ", 0xF9AD, 0x55, 0x55, 0xA4, 0x24, 0xF9 },
-  { "BEQ $F9BA                       ", 0xF9AF, 0x55, 0x55, 0xA4, 0x24, 0xF9 },
-  { "BMI $F9BA                       ", 0xF9B1, 0x55, 0x55, 0xA4, 0x24, 0xF9 },
-  { "BVS $F9BA                       ", 0xF9B3, 0x55, 0x55, 0xA4, 0x24, 0xF9 },
-  { "CMP #$55                        ", 0xF9B5, 0x55, 0x55, 0xA4, 0x24, 0xF9 },
-  { "BNE $F9BA                       ", 0xF9B7, 0x55, 0x55, 0xA4, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9B9, 0x55, 0x55, 0xA4, 0x27, 0xF9 },
-  { "INY                             ", 0xD43D, 0x55, 0x55, 0xA4, 0x27, 0xFB },
-  { "JSR $F9BD                       ", 0xD43E, 0x55, 0x55, 0xA5, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xF9BD, 0x55, 0x55, 0xA5, 0xA5, 0xF9 },
-  { "SEC                             ", 0xF9BF, 0x55, 0x55, 0xA5, 0xE5, 0xF9 },
-  { "LDA #$80                        ", 0xF9C0, 0x55, 0x55, 0xA5, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF9C2, 0x80, 0x55, 0xA5, 0xE5, 0xF9 },
-  { "STA $78 = 55                    ", 0xD441, 0x80, 0x55, 0xA5, 0xE5, 0xFB },
-  { "ASL $78 = 80                    ", 0xD443, 0x80, 0x55, 0xA5, 0xE5, 0xFB },
-  { "LDA $78 = 00                    ", 0xD445, 0x80, 0x55, 0xA5, 0x67, 0xFB },
-  { "JSR $F9C3                       ", 0xD447, 0x00, 0x55, 0xA5, 0x67, 0xFB },
-  { "BCC $F9E1                       ", 0xF9C3, 0x00, 0x55, 0xA5, 0x67, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9C5, 0x00, 0x55, 0xA5, 0x67, 0xF9 },
-  { "BMI $F9E1                       ", 0xF9C7, 0x00, 0x55, 0xA5, 0x67, 0xF9 },
-  { "BVC $F9E1                       ", 0xF9C9, 0x00, 0x55, 0xA5, 0x67, 0xF9 },
-  { "CMP #$00                        ", 0xF9CB, 0x00, 0x55, 0xA5, 0x67, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9CD, 0x00, 0x55, 0xA5, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9CF, 0x00, 0x55, 0xA5, 0x67, 0xF9 },
-  { "LDA #$55                        ", 0xF9D0, 0x00, 0x55, 0xA5, 0x27, 0xF9 },
-  { "SEC                             ", 0xF9D2, 0x55, 0x55, 0xA5, 0x25, 0xF9 },
-  { "RTS                             ", 0xF9D3, 0x55, 0x55, 0xA5, 0x25, 0xF9 },
-  { "INY                             ", 0xD44A, 0x55, 0x55, 0xA5, 0x25, 0xFB },
-  { "STA $78 = 00                    ", 0xD44B, 0x55, 0x55, 0xA6, 0xA5, 0xFB },
-  { "ASL $78 = 55                    ", 0xD44D, 0x55, 0x55, 0xA6, 0xA5, 0xFB },
-  { "LDA $78 = AA                    ", 0xD44F, 0x55, 0x55, 0xA6, 0xA4, 0xFB },
-  { "JSR $F9D4                       ", 0xD451, 0xAA, 0x55, 0xA6, 0xA4, 0xFB },
-  { "BCS $F9E1                       ", 0xF9D4, 0xAA, 0x55, 0xA6, 0xA4, 0xF9 },
-  { "BEQ $F9E1                       ", 0xF9D6, 0xAA, 0x55, 0xA6, 0xA4, 0xF9 },
-  { "BPL $F9E1                       ", 0xF9D8, 0xAA, 0x55, 0xA6, 0xA4, 0xF9 },
-  { "BVS $F9E1                       ", 0xF9DA, 0xAA, 0x55, 0xA6, 0xA4, 0xF9 },
-  { "CMP #$AA                        ", 0xF9DC, 0xAA, 0x55, 0xA6, 0xA4, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9DE, 0xAA, 0x55, 0xA6, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9E0, 0xAA, 0x55, 0xA6, 0x27, 0xF9 },
-  { "INY                             ", 0xD454, 0xAA, 0x55, 0xA6, 0x27, 0xFB },
-  { "JSR $F9E4                       ", 0xD455, 0xAA, 0x55, 0xA7, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xF9E4, 0xAA, 0x55, 0xA7, 0xA5, 0xF9 },
-  { "SEC                             ", 0xF9E6, 0xAA, 0x55, 0xA7, 0xE5, 0xF9 },
-  { "LDA #$01                        ", 0xF9E7, 0xAA, 0x55, 0xA7, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF9E9, 0x01, 0x55, 0xA7, 0x65, 0xF9 },
-  { "STA $78 = AA                    ", 0xD458, 0x01, 0x55, 0xA7, 0x65, 0xFB },
-  { "ROR $78 = 01                    ", 0xD45A, 0x01, 0x55, 0xA7, 0x65, 0xFB },
-  { "LDA $78 = 80                    ", 0xD45C, 0x01, 0x55, 0xA7, 0xE5, 0xFB },
-  { "JSR $F9EA                       ", 0xD45E, 0x80, 0x55, 0xA7, 0xE5, 0xFB },
-  { "BCC $FA08                       ", 0xF9EA, 0x80, 0x55, 0xA7, 0xE5, 0xF9 },
-  { "BEQ $FA08                       ", 0xF9EC, 0x80, 0x55, 0xA7, 0xE5, 0xF9 },
-  { "BPL $FA08                       ", 0xF9EE, 0x80, 0x55, 0xA7, 0xE5, 0xF9 },
-  { "BVC $FA08                       ", 0xF9F0, 0x80, 0x55, 0xA7, 0xE5, 0xF9 },
-  { "CMP #$80                        ", 0xF9F2, 0x80, 0x55, 0xA7, 0xE5, 0xF9 },
-  { "BNE $FA08                       ", 0xF9F4, 0x80, 0x55, 0xA7, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9F6, 0x80, 0x55, 0xA7, 0x67, 0xF9 },
-  { "CLC                             ", 0xF9F7, 0x80, 0x55, 0xA7, 0x27, 0xF9 },
-  { "LDA #$55                        ", 0xF9F8, 0x80, 0x55, 0xA7, 0x26, 0xF9 },
-  { "RTS                             ", 0xF9FA, 0x55, 0x55, 0xA7, 0x24, 0xF9 },
-  { "INY                             ", 0xD461, 0x55, 0x55, 0xA7, 0x24, 0xFB },
-  { "STA $78 = 80                    ", 0xD462, 0x55, 0x55, 0xA8, 0xA4, 0xFB },
-  { "ROR $78 = 55                    ", 0xD464, 0x55, 0x55, 0xA8, 0xA4, 0xFB },
-  { "LDA $78 = 2A                    ", 0xD466, 0x55, 0x55, 0xA8, 0x25, 0xFB },
-  { "JSR $F9FB                       ", 0xD468, 0x2A, 0x55, 0xA8, 0x25, 0xFB },
-  { "BCC $FA08                       ", 0xF9FB, 0x2A, 0x55, 0xA8, 0x25, 0xF9 },
-  { "BEQ $FA08                       ", 0xF9FD, 0x2A, 0x55, 0xA8, 0x25, 0xF9 },
-  { "BMI $FA08                       ", 0xF9FF, 0x2A, 0x55, 0xA8, 0x25, 0xF9 },
-  { "BVS $FA08                       ", 0xFA01, 0x2A, 0x55, 0xA8, 0x25, 0xF9 },
-  { "CMP #$2A                        ", 0xFA03, 0x2A, 0x55, 0xA8, 0x25, 0xF9 },
-  { "BNE $FA08                       ", 0xFA05, 0x2A, 0x55, 0xA8, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA07, 0x2A, 0x55, 0xA8, 0x27, 0xF9 },
-  { "INY                             ", 0xD46B, 0x2A, 0x55, 0xA8, 0x27, 0xFB },
-  { "JSR $FA0A                       ", 0xD46C, 0x2A, 0x55, 0xA9, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA0A, 0x2A, 0x55, 0xA9, 0xA5, 0xF9 },
-  { "SEC                             ", 0xFA0C, 0x2A, 0x55, 0xA9, 0xE5, 0xF9 },
-  { "LDA #$80                        ", 0xFA0D, 0x2A, 0x55, 0xA9, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA0F, 0x80, 0x55, 0xA9, 0xE5, 0xF9 },
-  { "STA $78 = 2A                    ", 0xD46F, 0x80, 0x55, 0xA9, 0xE5, 0xFB },
-  { "ROL $78 = 80                    ", 0xD471, 0x80, 0x55, 0xA9, 0xE5, 0xFB },
-  { "LDA $78 = 01                    ", 0xD473, 0x80, 0x55, 0xA9, 0x65, 0xFB },
-  { "JSR $FA10                       ", 0xD475, 0x01, 0x55, 0xA9, 0x65, 0xFB },
-  { "BCC $FA2E                       ", 0xFA10, 0x01, 0x55, 0xA9, 0x65, 0xF9 },
-  { "BEQ $FA2E                       ", 0xFA12, 0x01, 0x55, 0xA9, 0x65, 0xF9 },
-  { "BMI $FA2E                       ", 0xFA14, 0x01, 0x55, 0xA9, 0x65, 0xF9 },
-  { "BVC $FA2E                       ", 0xFA16, 0x01, 0x55, 0xA9, 0x65, 0xF9 },
-  { "CMP #$01                        ", 0xFA18, 0x01, 0x55, 0xA9, 0x65, 0xF9 },
-  { "BNE $FA2E                       ", 0xFA1A, 0x01, 0x55, 0xA9, 0x67, 0xF9 },
-  { "CLV                             ", 0xFA1C, 0x01, 0x55, 0xA9, 0x67, 0xF9 },
-  { "CLC                             ", 0xFA1D, 0x01, 0x55, 0xA9, 0x27, 0xF9 },
-  { "LDA #$55                        ", 0xFA1E, 0x01, 0x55, 0xA9, 0x26, 0xF9 },
-  { "RTS                             ", 0xFA20, 0x55, 0x55, 0xA9, 0x24, 0xF9 },
-  { "INY                             ", 0xD478, 0x55, 0x55, 0xA9, 0x24, 0xFB },
-  { "STA $78 = 01                    ", 0xD479, 0x55, 0x55, 0xAA, 0xA4, 0xFB },
-  { "ROL $78 = 55                    ", 0xD47B, 0x55, 0x55, 0xAA, 0xA4, 0xFB },
-  { "LDA $78 = AA                    ", 0xD47D, 0x55, 0x55, 0xAA, 0xA4, 0xFB },
-  { "JSR $FA21                       ", 0xD47F, 0xAA, 0x55, 0xAA, 0xA4, 0xFB },
-  { "BCS $FA2E                       ", 0xFA21, 0xAA, 0x55, 0xAA, 0xA4, 0xF9 },
-  { "BEQ $FA2E                       ", 0xFA23, 0xAA, 0x55, 0xAA, 0xA4, 0xF9 },
-  { "BPL $FA2E                       ", 0xFA25, 0xAA, 0x55, 0xAA, 0xA4, 0xF9 },
-  { "BVS $FA2E                       ", 0xFA27, 0xAA, 0x55, 0xAA, 0xA4, 0xF9 },
-  { "CMP #$AA                        ", 0xFA29, 0xAA, 0x55, 0xAA, 0xA4, 0xF9 },
-  { "BNE $FA2E                       ", 0xFA2B, 0xAA, 0x55, 0xAA, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA2D, 0xAA, 0x55, 0xAA, 0x27, 0xF9 },
-  { "LDA #$FF                        ", 0xD482, 0xAA, 0x55, 0xAA, 0x27, 0xFB },
-  { "STA $78 = AA                    ", 0xD484, 0xFF, 0x55, 0xAA, 0xA5, 0xFB },
-  { "STA $01 = FF                    ", 0xD486, 0xFF, 0x55, 0xAA, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xD488, 0xFF, 0x55, 0xAA, 0xA5, 0xFB },
-  { "SEC                             ", 0xD48A, 0xFF, 0x55, 0xAA, 0xE5, 0xFB },
-  { "INC $78 = FF                    ", 0xD48B, 0xFF, 0x55, 0xAA, 0xE5, 0xFB },
-  { "BNE $D49B                       ", 0xD48D, 0xFF, 0x55, 0xAA, 0x67, 0xFB },
-  { "BMI $D49B                       ", 0xD48F, 0xFF, 0x55, 0xAA, 0x67, 0xFB },
-  { "BVC $D49B                       ", 0xD491, 0xFF, 0x55, 0xAA, 0x67, 0xFB },
-  { "BCC $D49B                       ", 0xD493, 0xFF, 0x55, 0xAA, 0x67, 0xFB },
-  { "LDA $78 = 00                    ", 0xD495, 0xFF, 0x55, 0xAA, 0x67, 0xFB },
-  { "CMP #$00                        ", 0xD497, 0x00, 0x55, 0xAA, 0x67, 0xFB },
-  { "BEQ $D49F                       ", 0xD499, 0x00, 0x55, 0xAA, 0x67, 0xFB },
-  { "LDA #$7F                        ", 0xD49F, 0x00, 0x55, 0xAA, 0x67, 0xFB },
-  { "STA $78 = 00                    ", 0xD4A1, 0x7F, 0x55, 0xAA, 0x65, 0xFB },
-  { "CLV                             ", 0xD4A3, 0x7F, 0x55, 0xAA, 0x65, 0xFB },
-  { "CLC                             ", 0xD4A4, 0x7F, 0x55, 0xAA, 0x25, 0xFB },
-  { "INC $78 = 7F                    ", 0xD4A5, 0x7F, 0x55, 0xAA, 0x24, 0xFB },
-  { "BEQ $D4B5                       ", 0xD4A7, 0x7F, 0x55, 0xAA, 0xA4, 0xFB },
-  { "BPL $D4B5                       ", 0xD4A9, 0x7F, 0x55, 0xAA, 0xA4, 0xFB },
-  { "BVS $D4B5                       ", 0xD4AB, 0x7F, 0x55, 0xAA, 0xA4, 0xFB },
-  { "BCS $D4B5                       ", 0xD4AD, 0x7F, 0x55, 0xAA, 0xA4, 0xFB },
-  { "LDA $78 = 80                    ", 0xD4AF, 0x7F, 0x55, 0xAA, 0xA4, 0xFB },
-  { "CMP #$80                        ", 0xD4B1, 0x80, 0x55, 0xAA, 0xA4, 0xFB },
-  { "BEQ $D4B9                       ", 0xD4B3, 0x80, 0x55, 0xAA, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xD4B9, 0x80, 0x55, 0xAA, 0x27, 0xFB },
-  { "STA $78 = 80                    ", 0xD4BB, 0x00, 0x55, 0xAA, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xD4BD, 0x00, 0x55, 0xAA, 0x27, 0xFB },
-  { "SEC                             ", 0xD4BF, 0x00, 0x55, 0xAA, 0xE7, 0xFB },
-  { "DEC $78 = 00                    ", 0xD4C0, 0x00, 0x55, 0xAA, 0xE7, 0xFB },
-  { "BEQ $D4D0                       ", 0xD4C2, 0x00, 0x55, 0xAA, 0xE5, 0xFB },
-  { "BPL $D4D0                       ", 0xD4C4, 0x00, 0x55, 0xAA, 0xE5, 0xFB },
-  { "BVC $D4D0                       ", 0xD4C6, 0x00, 0x55, 0xAA, 0xE5, 0xFB },
-  { "BCC $D4D0                       ", 0xD4C8, 0x00, 0x55, 0xAA, 0xE5, 0xFB },
-  { "LDA $78 = FF                    ", 0xD4CA, 0x00, 0x55, 0xAA, 0xE5, 0xFB },
-  { "CMP #$FF                        ", 0xD4CC, 0xFF, 0x55, 0xAA, 0xE5, 0xFB },
-  { "BEQ $D4D4                       ", 0xD4CE, 0xFF, 0x55, 0xAA, 0x67, 0xFB },
-  { "LDA #$80                        ", 0xD4D4, 0xFF, 0x55, 0xAA, 0x67, 0xFB },
-  { "STA $78 = FF                    ", 0xD4D6, 0x80, 0x55, 0xAA, 0xE5, 0xFB },
-  { "CLV                             ", 0xD4D8, 0x80, 0x55, 0xAA, 0xE5, 0xFB },
-  { "CLC                             ", 0xD4D9, 0x80, 0x55, 0xAA, 0xA5, 0xFB },
-  { "DEC $78 = 80                    ", 0xD4DA, 0x80, 0x55, 0xAA, 0xA4, 0xFB },
-  { "BEQ $D4EA                       ", 0xD4DC, 0x80, 0x55, 0xAA, 0x24, 0xFB },
-  { "BMI $D4EA                       ", 0xD4DE, 0x80, 0x55, 0xAA, 0x24, 0xFB },
-  { "BVS $D4EA                       ", 0xD4E0, 0x80, 0x55, 0xAA, 0x24, 0xFB },
-  { "BCS $D4EA                       ", 0xD4E2, 0x80, 0x55, 0xAA, 0x24, 0xFB },
-  { "LDA $78 = 7F                    ", 0xD4E4, 0x80, 0x55, 0xAA, 0x24, 0xFB },
-  { "CMP #$7F                        ", 0xD4E6, 0x7F, 0x55, 0xAA, 0x24, 0xFB },
-  { "BEQ $D4EE                       ", 0xD4E8, 0x7F, 0x55, 0xAA, 0x27, 0xFB },
-  { "LDA #$01                        ", 0xD4EE, 0x7F, 0x55, 0xAA, 0x27, 0xFB },
-  { "STA $78 = 7F                    ", 0xD4F0, 0x01, 0x55, 0xAA, 0x25, 0xFB },
-  { "DEC $78 = 01                    ", 0xD4F2, 0x01, 0x55, 0xAA, 0x25, 0xFB },
-  { "BEQ $D4FA                       ", 0xD4F4, 0x01, 0x55, 0xAA, 0x27, 0xFB },
-  { "RTS                             ", 0xD4FA, 0x01, 0x55, 0xAA, 0x27, 0xFB },
-  { "JSR $D4FB                       ", 0xC615, 0x01, 0x55, 0xAA, 0x27, 0xFD },
-  { "LDA #$55                        ", 0xD4FB, 0x01, 0x55, 0xAA, 0x27, 0xFB },
-  { "STA $0678 = 00                  ", 0xD4FD, 0x55, 0x55, 0xAA, 0x25, 0xFB },
-  { "LDA #$FF                        ", 0xD500, 0x55, 0x55, 0xAA, 0x25, 0xFB },
-  { "STA $01 = FF                    ", 0xD502, 0xFF, 0x55, 0xAA, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xD504, 0xFF, 0x55, 0xAA, 0xA5, 0xFB },
-  { "LDY #$11                        ", 0xD506, 0xFF, 0x55, 0xAA, 0xE5, 0xFB },
-  { "LDX #$23                        ", 0xD508, 0xFF, 0x55, 0x11, 0x65, 0xFB },
-  { "LDA #$00                        ", 0xD50A, 0xFF, 0x23, 0x11, 0x65, 0xFB },
-  { "LDA $0678 = 55                  ", 0xD50C, 0x00, 0x23, 0x11, 0x67, 0xFB },
-  { "BEQ $D521                       ", 0xD50F, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "BMI $D521                       ", 0xD511, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "CMP #$55                        ", 0xD513, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "BNE $D521                       ", 0xD515, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "CPY #$11                        ", 0xD517, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "BNE $D521                       ", 0xD519, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "CPX #$23                        ", 0xD51B, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "BVC $D521                       ", 0xD51D, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "BEQ $D525                       ", 0xD51F, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "LDA #$46                        ", 0xD525, 0x55, 0x23, 0x11, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xD527, 0x46, 0x23, 0x11, 0x65, 0xFB },
-  { "STA $0678 = 55                  ", 0xD529, 0x46, 0x23, 0x11, 0xE5, 0xFB },
-  { "BEQ $D539                       ", 0xD52C, 0x46, 0x23, 0x11, 0xE5, 0xFB },
-  { "BPL $D539                       ", 0xD52E, 0x46, 0x23, 0x11, 0xE5, 0xFB },
-  { "BVC $D539                       ", 0xD530, 0x46, 0x23, 0x11, 0xE5, 0xFB },
-  { "LDA $0678 = 46                  ", 0xD532, 0x46, 0x23, 0x11, 0xE5, 0xFB },
-  { "CMP #$46                        ", 0xD535, 0x46, 0x23, 0x11, 0x65, 0xFB },
-  { "BEQ $D53D                       ", 0xD537, 0x46, 0x23, 0x11, 0x67, 0xFB },
-  { "LDA #$55                        ", 0xD53D, 0x46, 0x23, 0x11, 0x67, 0xFB },
-  { "STA $0678 = 46                  ", 0xD53F, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "BIT $01 = FF                    ", 0xD542, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "LDA #$11                        ", 0xD544, 0x55, 0x23, 0x11, 0xE5, 0xFB },
-  { "LDX #$23                        ", 0xD546, 0x11, 0x23, 0x11, 0x65, 0xFB },
-  { "LDY #$00                        ", 0xD548, 0x11, 0x23, 0x11, 0x65, 0xFB },
-  { "LDY $0678 = 55                  ", 0xD54A, 0x11, 0x23, 0x00, 0x67, 0xFB },
-  { "BEQ $D55F                       ", 0xD54D, 0x11, 0x23, 0x55, 0x65, 0xFB },
-  { "BMI $D55F                       ", 0xD54F, 0x11, 0x23, 0x55, 0x65, 0xFB },
-  { "CPY #$55                        ", 0xD551, 0x11, 0x23, 0x55, 0x65, 0xFB },
-  { "BNE $D55F                       ", 0xD553, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "CMP #$11                        ", 0xD555, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "BNE $D55F                       ", 0xD557, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "CPX #$23                        ", 0xD559, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "BVC $D55F                       ", 0xD55B, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "BEQ $D563                       ", 0xD55D, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "LDY #$46                        ", 0xD563, 0x11, 0x23, 0x55, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xD565, 0x11, 0x23, 0x46, 0x65, 0xFB },
-  { "STY $0678 = 55                  ", 0xD567, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "BEQ $D577                       ", 0xD56A, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "BPL $D577                       ", 0xD56C, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "BVC $D577                       ", 0xD56E, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "LDY $0678 = 46                  ", 0xD570, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "CPY #$46                        ", 0xD573, 0x11, 0x23, 0x46, 0x65, 0xFB },
-  { "BEQ $D57B                       ", 0xD575, 0x11, 0x23, 0x46, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xD57B, 0x11, 0x23, 0x46, 0x67, 0xFB },
-  { "LDA #$55                        ", 0xD57D, 0x11, 0x23, 0x46, 0xE5, 0xFB },
-  { "STA $0678 = 46                  ", 0xD57F, 0x55, 0x23, 0x46, 0x65, 0xFB },
-  { "LDY #$11                        ", 0xD582, 0x55, 0x23, 0x46, 0x65, 0xFB },
-  { "LDA #$23                        ", 0xD584, 0x55, 0x23, 0x11, 0x65, 0xFB },
-  { "LDX #$00                        ", 0xD586, 0x23, 0x23, 0x11, 0x65, 0xFB },
-  { "LDX $0678 = 55                  ", 0xD588, 0x23, 0x00, 0x11, 0x67, 0xFB },
-  { "BEQ $D59D                       ", 0xD58B, 0x23, 0x55, 0x11, 0x65, 0xFB },
-  { "BMI $D59D                       ", 0xD58D, 0x23, 0x55, 0x11, 0x65, 0xFB },
-  { "CPX #$55                        ", 0xD58F, 0x23, 0x55, 0x11, 0x65, 0xFB },
-  { "BNE $D59D                       ", 0xD591, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "CPY #$11                        ", 0xD593, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "BNE $D59D                       ", 0xD595, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "CMP #$23                        ", 0xD597, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "BVC $D59D                       ", 0xD599, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "BEQ $D5A1                       ", 0xD59B, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "LDX #$46                        ", 0xD5A1, 0x23, 0x55, 0x11, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xD5A3, 0x23, 0x46, 0x11, 0x65, 0xFB },
-  { "STX $0678 = 55                  ", 0xD5A5, 0x23, 0x46, 0x11, 0xE5, 0xFB },
-  { "BEQ $D5B5                       ", 0xD5A8, 0x23, 0x46, 0x11, 0xE5, 0xFB },
-  { "BPL $D5B5                       ", 0xD5AA, 0x23, 0x46, 0x11, 0xE5, 0xFB },
-  { "BVC $D5B5                       ", 0xD5AC, 0x23, 0x46, 0x11, 0xE5, 0xFB },
-  { "LDX $0678 = 46                  ", 0xD5AE, 0x23, 0x46, 0x11, 0xE5, 0xFB },
-  { "CPX #$46                        ", 0xD5B1, 0x23, 0x46, 0x11, 0x65, 0xFB },
-  { "BEQ $D5B9                       ", 0xD5B3, 0x23, 0x46, 0x11, 0x67, 0xFB },
-  { "LDA #$C0                        ", 0xD5B9, 0x23, 0x46, 0x11, 0x67, 0xFB },
-  { "STA $0678 = 46                  ", 0xD5BB, 0xC0, 0x46, 0x11, 0xE5, 0xFB },
-  { "LDX #$33                        ", 0xD5BE, 0xC0, 0x46, 0x11, 0xE5, 0xFB },
-  { "LDY #$88                        ", 0xD5C0, 0xC0, 0x33, 0x11, 0x65, 0xFB },
-  { "LDA #$05                        ", 0xD5C2, 0xC0, 0x33, 0x88, 0xE5, 0xFB },
-  { "BIT $0678 = C0                  ", 0xD5C4, 0x05, 0x33, 0x88, 0x65, 0xFB },
-  { "BPL $D5D9                       ", 0xD5C7, 0x05, 0x33, 0x88, 0xE7, 0xFB },
-  { "BVC $D5D9                       ", 0xD5C9, 0x05, 0x33, 0x88, 0xE7, 0xFB },
-  { "BNE $D5D9                       ", 0xD5CB, 0x05, 0x33, 0x88, 0xE7, 0xFB },
-  { "CMP #$05                        ", 0xD5CD, 0x05, 0x33, 0x88, 0xE7, 0xFB },
-  { "BNE $D5D9                       ", 0xD5CF, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "CPX #$33                        ", 0xD5D1, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "BNE $D5D9                       ", 0xD5D3, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "CPY #$88                        ", 0xD5D5, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "BEQ $D5DD                       ", 0xD5D7, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "LDA #$03                        ", 0xD5DD, 0x05, 0x33, 0x88, 0x67, 0xFB },
-  { "STA $0678 = C0                  ", 0xD5DF, 0x03, 0x33, 0x88, 0x65, 0xFB },
-  { "LDA #$01                        ", 0xD5E2, 0x03, 0x33, 0x88, 0x65, 0xFB },
-  { "BIT $0678 = 03                  ", 0xD5E4, 0x01, 0x33, 0x88, 0x65, 0xFB },
-  { "BMI $D5F1                       ", 0xD5E7, 0x01, 0x33, 0x88, 0x25, 0xFB },
-  { "BVS $D5F1                       ", 0xD5E9, 0x01, 0x33, 0x88, 0x25, 0xFB },
-  { "BEQ $D5F1                       ", 0xD5EB, 0x01, 0x33, 0x88, 0x25, 0xFB },
-  { "CMP #$01                        ", 0xD5ED, 0x01, 0x33, 0x88, 0x25, 0xFB },
-  { "BEQ $D5F5                       ", 0xD5EF, 0x01, 0x33, 0x88, 0x27, 0xFB },
-  { "LDY #$B8                        ", 0xD5F5, 0x01, 0x33, 0x88, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xD5F7, 0x01, 0x33, 0xB8, 0xA5, 0xFB },
-  { "STA $0678 = 03                  ", 0xD5F9, 0xAA, 0x33, 0xB8, 0xA5, 0xFB },
-  { "JSR $F7B6                       ", 0xD5FC, 0xAA, 0x33, 0xB8, 0xA5, 0xFB },
-  { "CLC                             ", 0xF7B6, 0xAA, 0x33, 0xB8, 0xA5, 0xF9 },
-  { "LDA #$FF                        ", 0xF7B7, 0xAA, 0x33, 0xB8, 0xA4, 0xF9 },
-  { "STA $01 = FF                    ", 0xF7B9, 0xFF, 0x33, 0xB8, 0xA4, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF7BB, 0xFF, 0x33, 0xB8, 0xA4, 0xF9 },
-  { "LDA #$55                        ", 0xF7BD, 0xFF, 0x33, 0xB8, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF7BF, 0x55, 0x33, 0xB8, 0x64, 0xF9 },
-  { "ORA $0678 = AA                  ", 0xD5FF, 0x55, 0x33, 0xB8, 0x64, 0xFB },
-  { "JSR $F7C0                       ", 0xD602, 0xFF, 0x33, 0xB8, 0xE4, 0xFB },
-  { "BCS $F7CB                       ", 0xF7C0, 0xFF, 0x33, 0xB8, 0xE4, 0xF9 },
-  { "BPL $F7CB                       ", 0xF7C2, 0xFF, 0x33, 0xB8, 0xE4, 0xF9 },
-  { "CMP #$FF                        ", 0xF7C4, 0xFF, 0x33, 0xB8, 0xE4, 0xF9 },
-  { "BNE $F7CB                       ", 0xF7C6, 0xFF, 0x33, 0xB8, 0x67, 0xF9 },
-  { "BVC $F7CB                       ", 0xF7C8, 0xFF, 0x33, 0xB8, 0x67, 0xF9 },
-  { "RTS                             ", 0xF7CA, 0xFF, 0x33, 0xB8, 0x67, 0xF9 },
-  { "INY                             ", 0xD605, 0xFF, 0x33, 0xB8, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xD606, 0xFF, 0x33, 0xB9, 0xE5, 0xFB },
-  { "STA $0678 = AA                  ", 0xD608, 0x00, 0x33, 0xB9, 0x67, 0xFB },
-  { "JSR $F7CE                       ", 0xD60B, 0x00, 0x33, 0xB9, 0x67, 0xFB },
-  { "SEC                             ", 0xF7CE, 0x00, 0x33, 0xB9, 0x67, 0xF9 },
-  { "CLV                             ", 0xF7CF, 0x00, 0x33, 0xB9, 0x67, 0xF9 },
-  { "LDA #$00                        ", 0xF7D0, 0x00, 0x33, 0xB9, 0x27, 0xF9 },
-  { "RTS                             ", 0xF7D2, 0x00, 0x33, 0xB9, 0x27, 0xF9 },
-  { "ORA $0678 = 00                  ", 0xD60E, 0x00, 0x33, 0xB9, 0x27, 0xFB },
-  { "JSR $F7D3                       ", 0xD611, 0x00, 0x33, 0xB9, 0x27, 0xFB },
-  { "BNE $F7DC                       ", 0xF7D3, 0x00, 0x33, 0xB9, 0x27, 0xF9 },
-  { "BVS $F7DC                       ", 0xF7D5, 0x00, 0x33, 0xB9, 0x27, 0xF9 },
-  { "BCC $F7DC                       ", 0xF7D7, 0x00, 0x33, 0xB9, 0x27, 0xF9 },
-  { "BMI $F7DC                       ", 0xF7D9, 0x00, 0x33, 0xB9, 0x27, 0xF9 },
-  { "RTS                             ", 0xF7DB, 0x00, 0x33, 0xB9, 0x27, 0xF9 },
-  { "INY                             ", 0xD614, 0x00, 0x33, 0xB9, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xD615, 0x00, 0x33, 0xBA, 0xA5, 0xFB },
-  { "STA $0678 = 00                  ", 0xD617, 0xAA, 0x33, 0xBA, 0xA5, 0xFB },
-  { "JSR $F7DF                       ", 0xD61A, 0xAA, 0x33, 0xBA, 0xA5, 0xFB },
-  { "CLC                             ", 0xF7DF, 0xAA, 0x33, 0xBA, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF7E0, 0xAA, 0x33, 0xBA, 0xA4, 0xF9 },
-  { "LDA #$55                        ", 0xF7E2, 0xAA, 0x33, 0xBA, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF7E4, 0x55, 0x33, 0xBA, 0x64, 0xF9 },
-  { "AND $0678 = AA                  ", 0xD61D, 0x55, 0x33, 0xBA, 0x64, 0xFB },
-  { "JSR $F7E5                       ", 0xD620, 0x00, 0x33, 0xBA, 0x66, 0xFB },
-  { "BNE $F7EE                       ", 0xF7E5, 0x00, 0x33, 0xBA, 0x66, 0xF9 },
-  { "BVC $F7EE                       ", 0xF7E7, 0x00, 0x33, 0xBA, 0x66, 0xF9 },
-  { "BCS $F7EE                       ", 0xF7E9, 0x00, 0x33, 0xBA, 0x66, 0xF9 },
-  { "BMI $F7EE                       ", 0xF7EB, 0x00, 0x33, 0xBA, 0x66, 0xF9 },
-  { "RTS                             ", 0xF7ED, 0x00, 0x33, 0xBA, 0x66, 0xF9 },
-  { "INY                             ", 0xD623, 0x00, 0x33, 0xBA, 0x66, 0xFB },
-  { "LDA #$EF                        ", 0xD624, 0x00, 0x33, 0xBB, 0xE4, 0xFB },
-  { "STA $0678 = AA                  ", 0xD626, 0xEF, 0x33, 0xBB, 0xE4, 0xFB },
-  { "JSR $F7F1                       ", 0xD629, 0xEF, 0x33, 0xBB, 0xE4, 0xFB },
-  { "SEC                             ", 0xF7F1, 0xEF, 0x33, 0xBB, 0xE4, 0xF9 },
-  { "CLV                             ", 0xF7F2, 0xEF, 0x33, 0xBB, 0xE5, 0xF9 },
-  { "LDA #$F8                        ", 0xF7F3, 0xEF, 0x33, 0xBB, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF7F5, 0xF8, 0x33, 0xBB, 0xA5, 0xF9 },
-  { "AND $0678 = EF                  ", 0xD62C, 0xF8, 0x33, 0xBB, 0xA5, 0xFB },
-  { "JSR $F7F6                       ", 0xD62F, 0xE8, 0x33, 0xBB, 0xA5, 0xFB },
-  { "BCC $F801                       ", 0xF7F6, 0xE8, 0x33, 0xBB, 0xA5, 0xF9 },
-  { "BPL $F801                       ", 0xF7F8, 0xE8, 0x33, 0xBB, 0xA5, 0xF9 },
-  { "CMP #$E8                        ", 0xF7FA, 0xE8, 0x33, 0xBB, 0xA5, 0xF9 },
-  { "BNE $F801                       ", 0xF7FC, 0xE8, 0x33, 0xBB, 0x27, 0xF9 },
-  { "BVS $F801                       ", 0xF7FE, 0xE8, 0x33, 0xBB, 0x27, 0xF9 },
-  { "RTS                             ", 0xF800, 0xE8, 0x33, 0xBB, 0x27, 0xF9 },
-  { "INY                             ", 0xD632, 0xE8, 0x33, 0xBB, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xD633, 0xE8, 0x33, 0xBC, 0xA5, 0xFB },
-  { "STA $0678 = EF                  ", 0xD635, 0xAA, 0x33, 0xBC, 0xA5, 0xFB },
-  { "JSR $F804                       ", 0xD638, 0xAA, 0x33, 0xBC, 0xA5, 0xFB },
-  { "CLC                             ", 0xF804, 0xAA, 0x33, 0xBC, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF805, 0xAA, 0x33, 0xBC, 0xA4, 0xF9 },
-  { "LDA #$5F                        ", 0xF807, 0xAA, 0x33, 0xBC, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF809, 0x5F, 0x33, 0xBC, 0x64, 0xF9 },
-  { "EOR $0678 = AA                  ", 0xD63B, 0x5F, 0x33, 0xBC, 0x64, 0xFB },
-  { "JSR $F80A                       ", 0xD63E, 0xF5, 0x33, 0xBC, 0xE4, 0xFB },
-  { "BCS $F815                       ", 0xF80A, 0xF5, 0x33, 0xBC, 0xE4, 0xF9 },
-  { "BPL $F815                       ", 0xF80C, 0xF5, 0x33, 0xBC, 0xE4, 0xF9 },
-  { "CMP #$F5                        ", 0xF80E, 0xF5, 0x33, 0xBC, 0xE4, 0xF9 },
-  { "BNE $F815                       ", 0xF810, 0xF5, 0x33, 0xBC, 0x67, 0xF9 },
-  { "BVC $F815                       ", 0xF812, 0xF5, 0x33, 0xBC, 0x67, 0xF9 },
-  { "RTS                             ", 0xF814, 0xF5, 0x33, 0xBC, 0x67, 0xF9 },
-  { "INY                             ", 0xD641, 0xF5, 0x33, 0xBC, 0x67, 0xFB },
-  { "LDA #$70                        ", 0xD642, 0xF5, 0x33, 0xBD, 0xE5, 0xFB },
-  { "STA $0678 = AA                  ", 0xD644, 0x70, 0x33, 0xBD, 0x65, 0xFB },
-  { "JSR $F818                       ", 0xD647, 0x70, 0x33, 0xBD, 0x65, 0xFB },
-  { "SEC                             ", 0xF818, 0x70, 0x33, 0xBD, 0x65, 0xF9 },
-  { "CLV                             ", 0xF819, 0x70, 0x33, 0xBD, 0x65, 0xF9 },
-  { "LDA #$70                        ", 0xF81A, 0x70, 0x33, 0xBD, 0x25, 0xF9 },
-  { "RTS                             ", 0xF81C, 0x70, 0x33, 0xBD, 0x25, 0xF9 },
-  { "EOR $0678 = 70                  ", 0xD64A, 0x70, 0x33, 0xBD, 0x25, 0xFB },
-  { "JSR $F81D                       ", 0xD64D, 0x00, 0x33, 0xBD, 0x27, 0xFB },
-  { "BNE $F826                       ", 0xF81D, 0x00, 0x33, 0xBD, 0x27, 0xF9 },
-  { "BVS $F826                       ", 0xF81F, 0x00, 0x33, 0xBD, 0x27, 0xF9 },
-  { "BCC $F826                       ", 0xF821, 0x00, 0x33, 0xBD, 0x27, 0xF9 },
-  { "BMI $F826                       ", 0xF823, 0x00, 0x33, 0xBD, 0x27, 0xF9 },
-  { "RTS                             ", 0xF825, 0x00, 0x33, 0xBD, 0x27, 0xF9 },
-  { "INY                             ", 0xD650, 0x00, 0x33, 0xBD, 0x27, 0xFB },
-  { "LDA #$69                        ", 0xD651, 0x00, 0x33, 0xBE, 0xA5, 0xFB },
-  { "STA $0678 = 70                  ", 0xD653, 0x69, 0x33, 0xBE, 0x25, 0xFB },
-  { "JSR $F829                       ", 0xD656, 0x69, 0x33, 0xBE, 0x25, 0xFB },
-  { "CLC                             ", 0xF829, 0x69, 0x33, 0xBE, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF82A, 0x69, 0x33, 0xBE, 0x24, 0xF9 },
-  { "LDA #$00                        ", 0xF82C, 0x69, 0x33, 0xBE, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF82E, 0x00, 0x33, 0xBE, 0x66, 0xF9 },
-  { "ADC $0678 = 69                  ", 0xD659, 0x00, 0x33, 0xBE, 0x66, 0xFB },
-  { "JSR $F82F                       ", 0xD65C, 0x69, 0x33, 0xBE, 0x24, 0xFB },
-  { "BMI $F83A                       ", 0xF82F, 0x69, 0x33, 0xBE, 0x24, 0xF9 },
-  { "BCS $F83A                       ", 0xF831, 0x69, 0x33, 0xBE, 0x24, 0xF9 },
-  { "CMP #$69                        ", 0xF833, 0x69, 0x33, 0xBE, 0x24, 0xF9 },
-  { "BNE $F83A                       ", 0xF835, 0x69, 0x33, 0xBE, 0x27, 0xF9 },
-  { "BVS $F83A                       ", 0xF837, 0x69, 0x33, 0xBE, 0x27, 0xF9 },
-  { "RTS                             ", 0xF839, 0x69, 0x33, 0xBE, 0x27, 0xF9 },
-  { "INY                             ", 0xD65F, 0x69, 0x33, 0xBE, 0x27, 0xFB },
-  { "JSR $F83D                       ", 0xD660, 0x69, 0x33, 0xBF, 0xA5, 0xFB },
-  { "SEC                             ", 0xF83D, 0x69, 0x33, 0xBF, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF83E, 0x69, 0x33, 0xBF, 0xA5, 0xF9 },
-  { "LDA #$00                        ", 0xF840, 0x69, 0x33, 0xBF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF842, 0x00, 0x33, 0xBF, 0x67, 0xF9 },
-  { "ADC $0678 = 69                  ", 0xD663, 0x00, 0x33, 0xBF, 0x67, 0xFB },
-  { "JSR $F843                       ", 0xD666, 0x6A, 0x33, 0xBF, 0x24, 0xFB },
-  { "BMI $F84E                       ", 0xF843, 0x6A, 0x33, 0xBF, 0x24, 0xF9 },
-  { "BCS $F84E                       ", 0xF845, 0x6A, 0x33, 0xBF, 0x24, 0xF9 },
-  { "CMP #$6A                        ", 0xF847, 0x6A, 0x33, 0xBF, 0x24, 0xF9 },
-  { "BNE $F84E                       ", 0xF849, 0x6A, 0x33, 0xBF, 0x27, 0xF9 },
-  { "BVS $F84E                       ", 0xF84B, 0x6A, 0x33, 0xBF, 0x27, 0xF9 },
-  { "RTS                             ", 0xF84D, 0x6A, 0x33, 0xBF, 0x27, 0xF9 },
-  { "INY                             ", 0xD669, 0x6A, 0x33, 0xBF, 0x27, 0xFB },
-  { "LDA #$7F                        ", 0xD66A, 0x6A, 0x33, 0xC0, 0xA5, 0xFB },
-  { "STA $0678 = 69                  ", 0xD66C, 0x7F, 0x33, 0xC0, 0x25, 0xFB },
-  { "JSR $F851                       ", 0xD66F, 0x7F, 0x33, 0xC0, 0x25, 0xFB },
-  { "SEC                             ", 0xF851, 0x7F, 0x33, 0xC0, 0x25, 0xF9 },
-  { "CLV                             ", 0xF852, 0x7F, 0x33, 0xC0, 0x25, 0xF9 },
-  { "LDA #$7F                        ", 0xF853, 0x7F, 0x33, 0xC0, 0x25, 0xF9 },
-  { "RTS                             ", 0xF855, 0x7F, 0x33, 0xC0, 0x25, 0xF9 },
-  { "ADC $0678 = 7F                  ", 0xD672, 0x7F, 0x33, 0xC0, 0x25, 0xFB },
-  { "JSR $F856                       ", 0xD675, 0xFF, 0x33, 0xC0, 0xE4, 0xFB },
-  { "BPL $F861                       ", 0xF856, 0xFF, 0x33, 0xC0, 0xE4, 0xF9 },
-  { "BCS $F861                       ", 0xF858, 0xFF, 0x33, 0xC0, 0xE4, 0xF9 },
-  { "CMP #$FF                        ", 0xF85A, 0xFF, 0x33, 0xC0, 0xE4, 0xF9 },
-  { "BNE $F861                       ", 0xF85C, 0xFF, 0x33, 0xC0, 0x67, 0xF9 },
-  { "BVC $F861                       ", 0xF85E, 0xFF, 0x33, 0xC0, 0x67, 0xF9 },
-  { "RTS                             ", 0xF860, 0xFF, 0x33, 0xC0, 0x67, 0xF9 },
-  { "INY                             ", 0xD678, 0xFF, 0x33, 0xC0, 0x67, 0xFB },
-  { "LDA #$80                        ", 0xD679, 0xFF, 0x33, 0xC1, 0xE5, 0xFB },
-  { "STA $0678 = 7F                  ", 0xD67B, 0x80, 0x33, 0xC1, 0xE5, 0xFB },
-  { "JSR $F864                       ", 0xD67E, 0x80, 0x33, 0xC1, 0xE5, 0xFB },
-  { "CLC                             ", 0xF864, 0x80, 0x33, 0xC1, 0xE5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF865, 0x80, 0x33, 0xC1, 0xE4, 0xF9 },
-  { "LDA #$7F                        ", 0xF867, 0x80, 0x33, 0xC1, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF869, 0x7F, 0x33, 0xC1, 0x64, 0xF9 },
-  { "ADC $0678 = 80                  ", 0xD681, 0x7F, 0x33, 0xC1, 0x64, 0xFB },
-  { "JSR $F86A                       ", 0xD684, 0xFF, 0x33, 0xC1, 0xA4, 0xFB },
-  { "BPL $F875                       ", 0xF86A, 0xFF, 0x33, 0xC1, 0xA4, 0xF9 },
-  { "BCS $F875                       ", 0xF86C, 0xFF, 0x33, 0xC1, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF86E, 0xFF, 0x33, 0xC1, 0xA4, 0xF9 },
-  { "BNE $F875                       ", 0xF870, 0xFF, 0x33, 0xC1, 0x27, 0xF9 },
-  { "BVS $F875                       ", 0xF872, 0xFF, 0x33, 0xC1, 0x27, 0xF9 },
-  { "RTS                             ", 0xF874, 0xFF, 0x33, 0xC1, 0x27, 0xF9 },
-  { "INY                             ", 0xD687, 0xFF, 0x33, 0xC1, 0x27, 0xFB },
-  { "JSR $F878                       ", 0xD688, 0xFF, 0x33, 0xC2, 0xA5, 0xFB },
-  { "SEC                             ", 0xF878, 0xFF, 0x33, 0xC2, 0xA5, 0xF9 },
-  { "CLV                             ", 0xF879, 0xFF, 0x33, 0xC2, 0xA5, 0xF9 },
-  { "LDA #$7F                        ", 0xF87A, 0xFF, 0x33, 0xC2, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF87C, 0x7F, 0x33, 0xC2, 0x25, 0xF9 },
-  { "ADC $0678 = 80                  ", 0xD68B, 0x7F, 0x33, 0xC2, 0x25, 0xFB },
-  { "JSR $F87D                       ", 0xD68E, 0x00, 0x33, 0xC2, 0x27, 0xFB },
-  { "BNE $F886                       ", 0xF87D, 0x00, 0x33, 0xC2, 0x27, 0xF9 },
-  { "BMI $F886                       ", 0xF87F, 0x00, 0x33, 0xC2, 0x27, 0xF9 },
-  { "BVS $F886                       ", 0xF881, 0x00, 0x33, 0xC2, 0x27, 0xF9 },
-  { "BCC $F886                       ", 0xF883, 0x00, 0x33, 0xC2, 0x27, 0xF9 },
-  { "RTS                             ", 0xF885, 0x00, 0x33, 0xC2, 0x27, 0xF9 },
-  { "INY                             ", 0xD691, 0x00, 0x33, 0xC2, 0x27, 0xFB },
-  { "LDA #$40                        ", 0xD692, 0x00, 0x33, 0xC3, 0xA5, 0xFB },
-  { "STA $0678 = 80                  ", 0xD694, 0x40, 0x33, 0xC3, 0x25, 0xFB },
-  { "JSR $F889                       ", 0xD697, 0x40, 0x33, 0xC3, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF889, 0x40, 0x33, 0xC3, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF88B, 0x40, 0x33, 0xC3, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF88D, 0x40, 0x33, 0xC3, 0x65, 0xF9 },
-  { "CMP $0678 = 40                  ", 0xD69A, 0x40, 0x33, 0xC3, 0x65, 0xFB },
-  { "JSR $F88E                       ", 0xD69D, 0x40, 0x33, 0xC3, 0x67, 0xFB },
-  { "BMI $F897                       ", 0xF88E, 0x40, 0x33, 0xC3, 0x67, 0xF9 },
-  { "BCC $F897                       ", 0xF890, 0x40, 0x33, 0xC3, 0x67, 0xF9 },
-  { "BNE $F897                       ", 0xF892, 0x40, 0x33, 0xC3, 0x67, 0xF9 },
-  { "BVC $F897                       ", 0xF894, 0x40, 0x33, 0xC3, 0x67, 0xF9 },
-  { "RTS                             ", 0xF896, 0x40, 0x33, 0xC3, 0x67, 0xF9 },
-  { "INY                             ", 0xD6A0, 0x40, 0x33, 0xC3, 0x67, 0xFB },
-  { "PHA                             ", 0xD6A1, 0x40, 0x33, 0xC4, 0xE5, 0xFB },
-  { "LDA #$3F                        ", 0xD6A2, 0x40, 0x33, 0xC4, 0xE5, 0xFA },
-  { "STA $0678 = 40                  ", 0xD6A4, 0x3F, 0x33, 0xC4, 0x65, 0xFA },
-  { "PLA                             ", 0xD6A7, 0x3F, 0x33, 0xC4, 0x65, 0xFA },
-  { "JSR $F89A                       ", 0xD6A8, 0x40, 0x33, 0xC4, 0x65, 0xFB },
-  { "CLV                             ", 0xF89A, 0x40, 0x33, 0xC4, 0x65, 0xF9 },
-  { "RTS                             ", 0xF89B, 0x40, 0x33, 0xC4, 0x25, 0xF9 },
-  { "CMP $0678 = 3F                  ", 0xD6AB, 0x40, 0x33, 0xC4, 0x25, 0xFB },
-  { "JSR $F89C                       ", 0xD6AE, 0x40, 0x33, 0xC4, 0x25, 0xFB },
-  { "BEQ $F8A5                       ", 0xF89C, 0x40, 0x33, 0xC4, 0x25, 0xF9 },
-  { "BMI $F8A5                       ", 0xF89E, 0x40, 0x33, 0xC4, 0x25, 0xF9 },
-  { "BCC $F8A5                       ", 0xF8A0, 0x40, 0x33, 0xC4, 0x25, 0xF9 },
-  { "BVS $F8A5                       ", 0xF8A2, 0x40, 0x33, 0xC4, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8A4, 0x40, 0x33, 0xC4, 0x25, 0xF9 },
-  { "INY                             ", 0xD6B1, 0x40, 0x33, 0xC4, 0x25, 0xFB },
-  { "PHA                             ", 0xD6B2, 0x40, 0x33, 0xC5, 0xA5, 0xFB },
-  { "LDA #$41                        ", 0xD6B3, 0x40, 0x33, 0xC5, 0xA5, 0xFA },
-  { "STA $0678 = 3F                  ", 0xD6B5, 0x41, 0x33, 0xC5, 0x25, 0xFA },
-  { "PLA                             ", 0xD6B8, 0x41, 0x33, 0xC5, 0x25, 0xFA },
-  { "CMP $0678 = 41                  ", 0xD6B9, 0x40, 0x33, 0xC5, 0x25, 0xFB },
-  { "JSR $F8A8                       ", 0xD6BC, 0x40, 0x33, 0xC5, 0xA4, 0xFB },
-  { "BEQ $F8AF                       ", 0xF8A8, 0x40, 0x33, 0xC5, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AA, 0x40, 0x33, 0xC5, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AC, 0x40, 0x33, 0xC5, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8AE, 0x40, 0x33, 0xC5, 0xA4, 0xF9 },
-  { "INY                             ", 0xD6BF, 0x40, 0x33, 0xC5, 0xA4, 0xFB },
-  { "PHA                             ", 0xD6C0, 0x40, 0x33, 0xC6, 0xA4, 0xFB },
-  { "LDA #$00                        ", 0xD6C1, 0x40, 0x33, 0xC6, 0xA4, 0xFA },
-  { "STA $0678 = 41                  ", 0xD6C3, 0x00, 0x33, 0xC6, 0x26, 0xFA },
-  { "PLA                             ", 0xD6C6, 0x00, 0x33, 0xC6, 0x26, 0xFA },
-  { "JSR $F8B2                       ", 0xD6C7, 0x40, 0x33, 0xC6, 0x24, 0xFB },
-  { "LDA #$80                        ", 0xF8B2, 0x40, 0x33, 0xC6, 0x24, 0xF9 },
-  { "RTS                             ", 0xF8B4, 0x80, 0x33, 0xC6, 0xA4, 0xF9 },
-  { "CMP $0678 = 00                  ", 0xD6CA, 0x80, 0x33, 0xC6, 0xA4, 0xFB },
-  { "JSR $F8B5                       ", 0xD6CD, 0x80, 0x33, 0xC6, 0xA5, 0xFB },
-  { "BEQ $F8BC                       ", 0xF8B5, 0x80, 0x33, 0xC6, 0xA5, 0xF9 },
-  { "BPL $F8BC                       ", 0xF8B7, 0x80, 0x33, 0xC6, 0xA5, 0xF9 },
-  { "BCC $F8BC                       ", 0xF8B9, 0x80, 0x33, 0xC6, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF8BB, 0x80, 0x33, 0xC6, 0xA5, 0xF9 },
-  { "INY                             ", 0xD6D0, 0x80, 0x33, 0xC6, 0xA5, 0xFB },
-  { "PHA                             ", 0xD6D1, 0x80, 0x33, 0xC7, 0xA5, 0xFB },
-  { "LDA #$80                        ", 0xD6D2, 0x80, 0x33, 0xC7, 0xA5, 0xFA },
-  { "STA $0678 = 00                  ", 0xD6D4, 0x80, 0x33, 0xC7, 0xA5, 0xFA },
-  { "PLA                             ", 0xD6D7, 0x80, 0x33, 0xC7, 0xA5, 0xFA },
-  { "CMP $0678 = 80                  ", 0xD6D8, 0x80, 0x33, 0xC7, 0xA5, 0xFB },
-  { "JSR $F8BF                       ", 0xD6DB, 0x80, 0x33, 0xC7, 0x27, 0xFB },
-  { "BNE $F8C6                       ", 0xF8BF, 0x80, 0x33, 0xC7, 0x27, 0xF9 },
-  { "BMI $F8C6                       ", 0xF8C1, 0x80, 0x33, 0xC7, 0x27, 0xF9 },
-  { "BCC $F8C6                       ", 0xF8C3, 0x80, 0x33, 0xC7, 0x27, 0xF9 },
-  { "RTS                             ", 0xF8C5, 0x80, 0x33, 0xC7, 0x27, 0xF9 },
-  { "INY                             ", 0xD6DE, 0x80, 0x33, 0xC7, 0x27, 0xFB },
-  { "PHA                             ", 0xD6DF, 0x80, 0x33, 0xC8, 0xA5, 0xFB },
-  { "LDA #$81                        ", 0xD6E0, 0x80, 0x33, 0xC8, 0xA5, 0xFA },
-  { "STA $0678 = 80                  ", 0xD6E2, 0x81, 0x33, 0xC8, 0xA5, 0xFA },
-  { "PLA                             ", 0xD6E5, 0x81, 0x33, 0xC8, 0xA5, 0xFA },
-  { "CMP $0678 = 81                  ", 0xD6E6, 0x80, 0x33, 0xC8, 0xA5, 0xFB },
-  { "JSR $F8C9                       ", 0xD6E9, 0x80, 0x33, 0xC8, 0xA4, 0xFB },
-  { "BCS $F8D0                       ", 0xF8C9, 0x80, 0x33, 0xC8, 0xA4, 0xF9 },
-  { "BEQ $F8D0                       ", 0xF8CB, 0x80, 0x33, 0xC8, 0xA4, 0xF9 },
-  { "BPL $F8D0                       ", 0xF8CD, 0x80, 0x33, 0xC8, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8CF, 0x80, 0x33, 0xC8, 0xA4, 0xF9 },
-  { "INY                             ", 0xD6EC, 0x80, 0x33, 0xC8, 0xA4, 0xFB },
-  { "PHA                             ", 0xD6ED, 0x80, 0x33, 0xC9, 0xA4, 0xFB },
-  { "LDA #$7F                        ", 0xD6EE, 0x80, 0x33, 0xC9, 0xA4, 0xFA },
-  { "STA $0678 = 81                  ", 0xD6F0, 0x7F, 0x33, 0xC9, 0x24, 0xFA },
-  { "PLA                             ", 0xD6F3, 0x7F, 0x33, 0xC9, 0x24, 0xFA },
-  { "CMP $0678 = 7F                  ", 0xD6F4, 0x80, 0x33, 0xC9, 0xA4, 0xFB },
-  { "JSR $F8D3                       ", 0xD6F7, 0x80, 0x33, 0xC9, 0x25, 0xFB },
-  { "BCC $F8DA                       ", 0xF8D3, 0x80, 0x33, 0xC9, 0x25, 0xF9 },
-  { "BEQ $F8DA                       ", 0xF8D5, 0x80, 0x33, 0xC9, 0x25, 0xF9 },
-  { "BMI $F8DA                       ", 0xF8D7, 0x80, 0x33, 0xC9, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8D9, 0x80, 0x33, 0xC9, 0x25, 0xF9 },
-  { "INY                             ", 0xD6FA, 0x80, 0x33, 0xC9, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xD6FB, 0x80, 0x33, 0xCA, 0xA5, 0xFB },
-  { "STA $0678 = 7F                  ", 0xD6FD, 0x40, 0x33, 0xCA, 0x25, 0xFB },
-  { "JSR $F931                       ", 0xD700, 0x40, 0x33, 0xCA, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF931, 0x40, 0x33, 0xCA, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF933, 0x40, 0x33, 0xCA, 0xE5, 0xF9 },
-  { "SEC                             ", 0xF935, 0x40, 0x33, 0xCA, 0x65, 0xF9 },
-  { "RTS                             ", 0xF936, 0x40, 0x33, 0xCA, 0x65, 0xF9 },
-  { "SBC $0678 = 40                  ", 0xD703, 0x40, 0x33, 0xCA, 0x65, 0xFB },
-  { "JSR $F937                       ", 0xD706, 0x00, 0x33, 0xCA, 0x27, 0xFB },
-  { "BMI $F944                       ", 0xF937, 0x00, 0x33, 0xCA, 0x27, 0xF9 },
-  { "BCC $F944                       ", 0xF939, 0x00, 0x33, 0xCA, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF93B, 0x00, 0x33, 0xCA, 0x27, 0xF9 },
-  { "BVS $F944                       ", 0xF93D, 0x00, 0x33, 0xCA, 0x27, 0xF9 },
-  { "CMP #$00                        ", 0xF93F, 0x00, 0x33, 0xCA, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF941, 0x00, 0x33, 0xCA, 0x27, 0xF9 },
-  { "RTS                             ", 0xF943, 0x00, 0x33, 0xCA, 0x27, 0xF9 },
-  { "INY                             ", 0xD709, 0x00, 0x33, 0xCA, 0x27, 0xFB },
-  { "LDA #$3F                        ", 0xD70A, 0x00, 0x33, 0xCB, 0xA5, 0xFB },
-  { "STA $0678 = 40                  ", 0xD70C, 0x3F, 0x33, 0xCB, 0x25, 0xFB },
-  { "JSR $F947                       ", 0xD70F, 0x3F, 0x33, 0xCB, 0x25, 0xFB },
-  { "CLV                             ", 0xF947, 0x3F, 0x33, 0xCB, 0x25, 0xF9 },
-  { "SEC                             ", 0xF948, 0x3F, 0x33, 0xCB, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF949, 0x3F, 0x33, 0xCB, 0x25, 0xF9 },
-  { "RTS                             ", 0xF94B, 0x40, 0x33, 0xCB, 0x25, 0xF9 },
-  { "SBC $0678 = 3F                  ", 0xD712, 0x40, 0x33, 0xCB, 0x25, 0xFB },
-  { "JSR $F94C                       ", 0xD715, 0x01, 0x33, 0xCB, 0x25, 0xFB },
-  { "BEQ $F959                       ", 0xF94C, 0x01, 0x33, 0xCB, 0x25, 0xF9 },
-  { "BMI $F959                       ", 0xF94E, 0x01, 0x33, 0xCB, 0x25, 0xF9 },
-  { "BCC $F959                       ", 0xF950, 0x01, 0x33, 0xCB, 0x25, 0xF9 },
-  { "BVS $F959                       ", 0xF952, 0x01, 0x33, 0xCB, 0x25, 0xF9 },
-  { "CMP #$01                        ", 0xF954, 0x01, 0x33, 0xCB, 0x25, 0xF9 },
-  { "BNE $F959                       ", 0xF956, 0x01, 0x33, 0xCB, 0x27, 0xF9 },
-  { "RTS                             ", 0xF958, 0x01, 0x33, 0xCB, 0x27, 0xF9 },
-  { "INY                             ", 0xD718, 0x01, 0x33, 0xCB, 0x27, 0xFB },
-  { "LDA #$41                        ", 0xD719, 0x01, 0x33, 0xCC, 0xA5, 0xFB },
-  { "STA $0678 = 3F                  ", 0xD71B, 0x41, 0x33, 0xCC, 0x25, 0xFB },
-  { "JSR $F95C                       ", 0xD71E, 0x41, 0x33, 0xCC, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xF95C, 0x41, 0x33, 0xCC, 0x25, 0xF9 },
-  { "SEC                             ", 0xF95E, 0x40, 0x33, 0xCC, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF95F, 0x40, 0x33, 0xCC, 0x25, 0xF9 },
-  { "RTS                             ", 0xF961, 0x40, 0x33, 0xCC, 0xE5, 0xF9 },
-  { "SBC $0678 = 41                  ", 0xD721, 0x40, 0x33, 0xCC, 0xE5, 0xFB },
-  { "JSR $F962                       ", 0xD724, 0xFF, 0x33, 0xCC, 0xA4, 0xFB },
-  { "BCS $F96F                       ", 0xF962, 0xFF, 0x33, 0xCC, 0xA4, 0xF9 },
-  { "BEQ $F96F                       ", 0xF964, 0xFF, 0x33, 0xCC, 0xA4, 0xF9 },
-  { "BPL $F96F                       ", 0xF966, 0xFF, 0x33, 0xCC, 0xA4, 0xF9 },
-  { "BVS $F96F                       ", 0xF968, 0xFF, 0x33, 0xCC, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF96A, 0xFF, 0x33, 0xCC, 0xA4, 0xF9 },
-  { "BNE $F96F                       ", 0xF96C, 0xFF, 0x33, 0xCC, 0x27, 0xF9 },
-  { "RTS                             ", 0xF96E, 0xFF, 0x33, 0xCC, 0x27, 0xF9 },
-  { "INY                             ", 0xD727, 0xFF, 0x33, 0xCC, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xD728, 0xFF, 0x33, 0xCD, 0xA5, 0xFB },
-  { "STA $0678 = 41                  ", 0xD72A, 0x00, 0x33, 0xCD, 0x27, 0xFB },
-  { "JSR $F972                       ", 0xD72D, 0x00, 0x33, 0xCD, 0x27, 0xFB },
-  { "CLC                             ", 0xF972, 0x00, 0x33, 0xCD, 0x27, 0xF9 },
-  { "LDA #$80                        ", 0xF973, 0x00, 0x33, 0xCD, 0x26, 0xF9 },
-  { "RTS                             ", 0xF975, 0x80, 0x33, 0xCD, 0xA4, 0xF9 },
-  { "SBC $0678 = 00                  ", 0xD730, 0x80, 0x33, 0xCD, 0xA4, 0xFB },
-  { "JSR $F976                       ", 0xD733, 0x7F, 0x33, 0xCD, 0x65, 0xFB },
-  { "BCC $F97D                       ", 0xF976, 0x7F, 0x33, 0xCD, 0x65, 0xF9 },
-  { "CMP #$7F                        ", 0xF978, 0x7F, 0x33, 0xCD, 0x65, 0xF9 },
-  { "BNE $F97D                       ", 0xF97A, 0x7F, 0x33, 0xCD, 0x67, 0xF9 },
-  { "RTS                             ", 0xF97C, 0x7F, 0x33, 0xCD, 0x67, 0xF9 },
-  { "INY                             ", 0xD736, 0x7F, 0x33, 0xCD, 0x67, 0xFB },
-  { "LDA #$7F                        ", 0xD737, 0x7F, 0x33, 0xCE, 0xE5, 0xFB },
-  { "STA $0678 = 00                  ", 0xD739, 0x7F, 0x33, 0xCE, 0x65, 0xFB },
-  { "JSR $F980                       ", 0xD73C, 0x7F, 0x33, 0xCE, 0x65, 0xFB },
-  { "SEC                             ", 0xF980, 0x7F, 0x33, 0xCE, 0x65, 0xF9 },
-  { "LDA #$81                        ", 0xF981, 0x7F, 0x33, 0xCE, 0x65, 0xF9 },
-  { "RTS                             ", 0xF983, 0x81, 0x33, 0xCE, 0xE5, 0xF9 },
-  { "SBC $0678 = 7F                  ", 0xD73F, 0x81, 0x33, 0xCE, 0xE5, 0xFB },
-  { "JSR $F984                       ", 0xD742, 0x02, 0x33, 0xCE, 0x65, 0xFB },
-  { "BVC $F98D                       ", 0xF984, 0x02, 0x33, 0xCE, 0x65, 0xF9 },
-  { "BCC $F98D                       ", 0xF986, 0x02, 0x33, 0xCE, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xF988, 0x02, 0x33, 0xCE, 0x65, 0xF9 },
-  { "BNE $F98D                       ", 0xF98A, 0x02, 0x33, 0xCE, 0x67, 0xF9 },
-  { "RTS                             ", 0xF98C, 0x02, 0x33, 0xCE, 0x67, 0xF9 },
-  { "INY                             ", 0xD745, 0x02, 0x33, 0xCE, 0x67, 0xFB },
-  { "LDA #$40                        ", 0xD746, 0x02, 0x33, 0xCF, 0xE5, 0xFB },
-  { "STA $0678 = 7F                  ", 0xD748, 0x40, 0x33, 0xCF, 0x65, 0xFB },
-  { "JSR $F889                       ", 0xD74B, 0x40, 0x33, 0xCF, 0x65, 0xFB },
-  { "BIT $01 = FF                    ", 0xF889, 0x40, 0x33, 0xCF, 0x65, 0xF9 },
-  { "LDA #$40                        ", 0xF88B, 0x40, 0x33, 0xCF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF88D, 0x40, 0x33, 0xCF, 0x65, 0xF9 },
-  { "TAX                             ", 0xD74E, 0x40, 0x33, 0xCF, 0x65, 0xFB },
-  { "CPX $0678 = 40                  ", 0xD74F, 0x40, 0x40, 0xCF, 0x65, 0xFB },
-  { "JSR $F88E                       ", 0xD752, 0x40, 0x40, 0xCF, 0x67, 0xFB },
-  { "BMI $F897                       ", 0xF88E, 0x40, 0x40, 0xCF, 0x67, 0xF9 },
-  { "BCC $F897                       ", 0xF890, 0x40, 0x40, 0xCF, 0x67, 0xF9 },
-  { "BNE $F897                       ", 0xF892, 0x40, 0x40, 0xCF, 0x67, 0xF9 },
-  { "BVC $F897                       ", 0xF894, 0x40, 0x40, 0xCF, 0x67, 0xF9 },
-  { "RTS                             ", 0xF896, 0x40, 0x40, 0xCF, 0x67, 0xF9 },
-  { "INY                             ", 0xD755, 0x40, 0x40, 0xCF, 0x67, 0xFB },
-  { "LDA #$3F                        ", 0xD756, 0x40, 0x40, 0xD0, 0xE5, 0xFB },
-  { "STA $0678 = 40                  ", 0xD758, 0x3F, 0x40, 0xD0, 0x65, 0xFB },
-  { "JSR $F89A                       ", 0xD75B, 0x3F, 0x40, 0xD0, 0x65, 0xFB },
-  { "CLV                             ", 0xF89A, 0x3F, 0x40, 0xD0, 0x65, 0xF9 },
-  { "RTS                             ", 0xF89B, 0x3F, 0x40, 0xD0, 0x25, 0xF9 },
-  { "CPX $0678 = 3F                  ", 0xD75E, 0x3F, 0x40, 0xD0, 0x25, 0xFB },
-  { "JSR $F89C                       ", 0xD761, 0x3F, 0x40, 0xD0, 0x25, 0xFB },
-  { "BEQ $F8A5                       ", 0xF89C, 0x3F, 0x40, 0xD0, 0x25, 0xF9 },
-  { "BMI $F8A5                       ", 0xF89E, 0x3F, 0x40, 0xD0, 0x25, 0xF9 },
-  { "BCC $F8A5                       ", 0xF8A0, 0x3F, 0x40, 0xD0, 0x25, 0xF9 },
-  { "BVS $F8A5                       ", 0xF8A2, 0x3F, 0x40, 0xD0, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8A4, 0x3F, 0x40, 0xD0, 0x25, 0xF9 },
-  { "INY                             ", 0xD764, 0x3F, 0x40, 0xD0, 0x25, 0xFB },
-  { "LDA #$41                        ", 0xD765, 0x3F, 0x40, 0xD1, 0xA5, 0xFB },
-  { "STA $0678 = 3F                  ", 0xD767, 0x41, 0x40, 0xD1, 0x25, 0xFB },
-  { "CPX $0678 = 41                  ", 0xD76A, 0x41, 0x40, 0xD1, 0x25, 0xFB },
-  { "JSR $F8A8                       ", 0xD76D, 0x41, 0x40, 0xD1, 0xA4, 0xFB },
-  { "BEQ $F8AF                       ", 0xF8A8, 0x41, 0x40, 0xD1, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AA, 0x41, 0x40, 0xD1, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AC, 0x41, 0x40, 0xD1, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8AE, 0x41, 0x40, 0xD1, 0xA4, 0xF9 },
-  { "INY                             ", 0xD770, 0x41, 0x40, 0xD1, 0xA4, 0xFB },
-  { "LDA #$00                        ", 0xD771, 0x41, 0x40, 0xD2, 0xA4, 0xFB },
-  { "STA $0678 = 41                  ", 0xD773, 0x00, 0x40, 0xD2, 0x26, 0xFB },
-  { "JSR $F8B2                       ", 0xD776, 0x00, 0x40, 0xD2, 0x26, 0xFB },
-  { "LDA #$80                        ", 0xF8B2, 0x00, 0x40, 0xD2, 0x26, 0xF9 },
-  { "RTS                             ", 0xF8B4, 0x80, 0x40, 0xD2, 0xA4, 0xF9 },
-  { "TAX                             ", 0xD779, 0x80, 0x40, 0xD2, 0xA4, 0xFB },
-  { "CPX $0678 = 00                  ", 0xD77A, 0x80, 0x80, 0xD2, 0xA4, 0xFB },
-  { "JSR $F8B5                       ", 0xD77D, 0x80, 0x80, 0xD2, 0xA5, 0xFB },
-  { "BEQ $F8BC                       ", 0xF8B5, 0x80, 0x80, 0xD2, 0xA5, 0xF9 },
-  { "BPL $F8BC                       ", 0xF8B7, 0x80, 0x80, 0xD2, 0xA5, 0xF9 },
-  { "BCC $F8BC                       ", 0xF8B9, 0x80, 0x80, 0xD2, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF8BB, 0x80, 0x80, 0xD2, 0xA5, 0xF9 },
-  { "INY                             ", 0xD780, 0x80, 0x80, 0xD2, 0xA5, 0xFB },
-  { "LDA #$80                        ", 0xD781, 0x80, 0x80, 0xD3, 0xA5, 0xFB },
-  { "STA $0678 = 00                  ", 0xD783, 0x80, 0x80, 0xD3, 0xA5, 0xFB },
-  { "CPX $0678 = 80                  ", 0xD786, 0x80, 0x80, 0xD3, 0xA5, 0xFB },
-  { "JSR $F8BF                       ", 0xD789, 0x80, 0x80, 0xD3, 0x27, 0xFB },
-  { "BNE $F8C6                       ", 0xF8BF, 0x80, 0x80, 0xD3, 0x27, 0xF9 },
-  { "BMI $F8C6                       ", 0xF8C1, 0x80, 0x80, 0xD3, 0x27, 0xF9 },
-  { "BCC $F8C6                       ", 0xF8C3, 0x80, 0x80, 0xD3, 0x27, 0xF9 },
-  { "RTS                             ", 0xF8C5, 0x80, 0x80, 0xD3, 0x27, 0xF9 },
-  { "INY                             ", 0xD78C, 0x80, 0x80, 0xD3, 0x27, 0xFB },
-  { "LDA #$81                        ", 0xD78D, 0x80, 0x80, 0xD4, 0xA5, 0xFB },
-  { "STA $0678 = 80                  ", 0xD78F, 0x81, 0x80, 0xD4, 0xA5, 0xFB },
-  { "CPX $0678 = 81                  ", 0xD792, 0x81, 0x80, 0xD4, 0xA5, 0xFB },
-  { "JSR $F8C9                       ", 0xD795, 0x81, 0x80, 0xD4, 0xA4, 0xFB },
-  { "BCS $F8D0                       ", 0xF8C9, 0x81, 0x80, 0xD4, 0xA4, 0xF9 },
-  { "BEQ $F8D0                       ", 0xF8CB, 0x81, 0x80, 0xD4, 0xA4, 0xF9 },
-  { "BPL $F8D0                       ", 0xF8CD, 0x81, 0x80, 0xD4, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8CF, 0x81, 0x80, 0xD4, 0xA4, 0xF9 },
-  { "INY                             ", 0xD798, 0x81, 0x80, 0xD4, 0xA4, 0xFB },
-  { "LDA #$7F                        ", 0xD799, 0x81, 0x80, 0xD5, 0xA4, 0xFB },
-  { "STA $0678 = 81                  ", 0xD79B, 0x7F, 0x80, 0xD5, 0x24, 0xFB },
-  { "CPX $0678 = 7F                  ", 0xD79E, 0x7F, 0x80, 0xD5, 0x24, 0xFB },
-  { "JSR $F8D3                       ", 0xD7A1, 0x7F, 0x80, 0xD5, 0x25, 0xFB },
-  { "BCC $F8DA                       ", 0xF8D3, 0x7F, 0x80, 0xD5, 0x25, 0xF9 },
-  { "BEQ $F8DA                       ", 0xF8D5, 0x7F, 0x80, 0xD5, 0x25, 0xF9 },
-  { "BMI $F8DA                       ", 0xF8D7, 0x7F, 0x80, 0xD5, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8D9, 0x7F, 0x80, 0xD5, 0x25, 0xF9 },
-  { "INY                             ", 0xD7A4, 0x7F, 0x80, 0xD5, 0x25, 0xFB },
-  { "TYA                             ", 0xD7A5, 0x7F, 0x80, 0xD6, 0xA5, 0xFB },
-  { "TAX                             ", 0xD7A6, 0xD6, 0x80, 0xD6, 0xA5, 0xFB },
-  { "LDA #$40                        ", 0xD7A7, 0xD6, 0xD6, 0xD6, 0xA5, 0xFB },
-  { "STA $0678 = 7F                  ", 0xD7A9, 0x40, 0xD6, 0xD6, 0x25, 0xFB },
-  { "JSR $F8DD                       ", 0xD7AC, 0x40, 0xD6, 0xD6, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF8DD, 0x40, 0xD6, 0xD6, 0x25, 0xF9 },
-  { "LDY #$40                        ", 0xF8DF, 0x40, 0xD6, 0xD6, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF8E1, 0x40, 0xD6, 0x40, 0x65, 0xF9 },
-  { "CPY $0678 = 40                  ", 0xD7AF, 0x40, 0xD6, 0x40, 0x65, 0xFB },
-  { "JSR $F8E2                       ", 0xD7B2, 0x40, 0xD6, 0x40, 0x67, 0xFB },
-  { "BMI $F8EB                       ", 0xF8E2, 0x40, 0xD6, 0x40, 0x67, 0xF9 },
-  { "BCC $F8EB                       ", 0xF8E4, 0x40, 0xD6, 0x40, 0x67, 0xF9 },
-  { "BNE $F8EB                       ", 0xF8E6, 0x40, 0xD6, 0x40, 0x67, 0xF9 },
-  { "BVC $F8EB                       ", 0xF8E8, 0x40, 0xD6, 0x40, 0x67, 0xF9 },
-  { "RTS                             ", 0xF8EA, 0x40, 0xD6, 0x40, 0x67, 0xF9 },
-  { "INX                             ", 0xD7B5, 0x40, 0xD6, 0x40, 0x67, 0xFB },
-  { "LDA #$3F                        ", 0xD7B6, 0x40, 0xD7, 0x40, 0xE5, 0xFB },
-  { "STA $0678 = 40                  ", 0xD7B8, 0x3F, 0xD7, 0x40, 0x65, 0xFB },
-  { "JSR $F8EE                       ", 0xD7BB, 0x3F, 0xD7, 0x40, 0x65, 0xFB },
-  { "CLV                             ", 0xF8EE, 0x3F, 0xD7, 0x40, 0x65, 0xF9 },
-  { "RTS                             ", 0xF8EF, 0x3F, 0xD7, 0x40, 0x25, 0xF9 },
-  { "CPY $0678 = 3F                  ", 0xD7BE, 0x3F, 0xD7, 0x40, 0x25, 0xFB },
-  { "JSR $F8F0                       ", 0xD7C1, 0x3F, 0xD7, 0x40, 0x25, 0xFB },
-  { "BEQ $F8F9                       ", 0xF8F0, 0x3F, 0xD7, 0x40, 0x25, 0xF9 },
-  { "BMI $F8F9                       ", 0xF8F2, 0x3F, 0xD7, 0x40, 0x25, 0xF9 },
-  { "BCC $F8F9                       ", 0xF8F4, 0x3F, 0xD7, 0x40, 0x25, 0xF9 },
-  { "BVS $F8F9                       ", 0xF8F6, 0x3F, 0xD7, 0x40, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8F8, 0x3F, 0xD7, 0x40, 0x25, 0xF9 },
-  { "INX                             ", 0xD7C4, 0x3F, 0xD7, 0x40, 0x25, 0xFB },
-  { "LDA #$41                        ", 0xD7C5, 0x3F, 0xD8, 0x40, 0xA5, 0xFB },
-  { "STA $0678 = 3F                  ", 0xD7C7, 0x41, 0xD8, 0x40, 0x25, 0xFB },
-  { "CPY $0678 = 41                  ", 0xD7CA, 0x41, 0xD8, 0x40, 0x25, 0xFB },
-  { "JSR $F8FC                       ", 0xD7CD, 0x41, 0xD8, 0x40, 0xA4, 0xFB },
-  { "BEQ $F903                       ", 0xF8FC, 0x41, 0xD8, 0x40, 0xA4, 0xF9 },
-  { "BPL $F903                       ", 0xF8FE, 0x41, 0xD8, 0x40, 0xA4, 0xF9 },
-  { "BPL $F903                       ", 0xF900, 0x41, 0xD8, 0x40, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF902, 0x41, 0xD8, 0x40, 0xA4, 0xF9 },
-  { "INX                             ", 0xD7D0, 0x41, 0xD8, 0x40, 0xA4, 0xFB },
-  { "LDA #$00                        ", 0xD7D1, 0x41, 0xD9, 0x40, 0xA4, 0xFB },
-  { "STA $0678 = 41                  ", 0xD7D3, 0x00, 0xD9, 0x40, 0x26, 0xFB },
-  { "JSR $F906                       ", 0xD7D6, 0x00, 0xD9, 0x40, 0x26, 0xFB },
-  { "LDY #$80                        ", 0xF906, 0x00, 0xD9, 0x40, 0x26, 0xF9 },
-  { "RTS                             ", 0xF908, 0x00, 0xD9, 0x80, 0xA4, 0xF9 },
-  { "CPY $0678 = 00                  ", 0xD7D9, 0x00, 0xD9, 0x80, 0xA4, 0xFB },
-  { "JSR $F909                       ", 0xD7DC, 0x00, 0xD9, 0x80, 0xA5, 0xFB },
-  { "BEQ $F910                       ", 0xF909, 0x00, 0xD9, 0x80, 0xA5, 0xF9 },
-  { "BPL $F910                       ", 0xF90B, 0x00, 0xD9, 0x80, 0xA5, 0xF9 },
-  { "BCC $F910                       ", 0xF90D, 0x00, 0xD9, 0x80, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF90F, 0x00, 0xD9, 0x80, 0xA5, 0xF9 },
-  { "INX                             ", 0xD7DF, 0x00, 0xD9, 0x80, 0xA5, 0xFB },
-  { "LDA #$80                        ", 0xD7E0, 0x00, 0xDA, 0x80, 0xA5, 0xFB },
-  { "STA $0678 = 00                  ", 0xD7E2, 0x80, 0xDA, 0x80, 0xA5, 0xFB },
-  { "CPY $0678 = 80                  ", 0xD7E5, 0x80, 0xDA, 0x80, 0xA5, 0xFB },
-  { "JSR $F913                       ", 0xD7E8, 0x80, 0xDA, 0x80, 0x27, 0xFB },
-  { "BNE $F91A                       ", 0xF913, 0x80, 0xDA, 0x80, 0x27, 0xF9 },
-  { "BMI $F91A                       ", 0xF915, 0x80, 0xDA, 0x80, 0x27, 0xF9 },
-  { "BCC $F91A                       ", 0xF917, 0x80, 0xDA, 0x80, 0x27, 0xF9 },
-  { "RTS                             ", 0xF919, 0x80, 0xDA, 0x80, 0x27, 0xF9 },
-  { "INX                             ", 0xD7EB, 0x80, 0xDA, 0x80, 0x27, 0xFB },
-  { "LDA #$81                        ", 0xD7EC, 0x80, 0xDB, 0x80, 0xA5, 0xFB },
-  { "STA $0678 = 80                  ", 0xD7EE, 0x81, 0xDB, 0x80, 0xA5, 0xFB },
-  { "CPY $0678 = 81                  ", 0xD7F1, 0x81, 0xDB, 0x80, 0xA5, 0xFB },
-  { "JSR $F91D                       ", 0xD7F4, 0x81, 0xDB, 0x80, 0xA4, 0xFB },
-  { "BCS $F924                       ", 0xF91D, 0x81, 0xDB, 0x80, 0xA4, 0xF9 },
-  { "BEQ $F924                       ", 0xF91F, 0x81, 0xDB, 0x80, 0xA4, 0xF9 },
-  { "BPL $F924                       ", 0xF921, 0x81, 0xDB, 0x80, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF923, 0x81, 0xDB, 0x80, 0xA4, 0xF9 },
-  { "INX                             ", 0xD7F7, 0x81, 0xDB, 0x80, 0xA4, 0xFB },
-  { "LDA #$7F                        ", 0xD7F8, 0x81, 0xDC, 0x80, 0xA4, 0xFB },
-  { "STA $0678 = 81                  ", 0xD7FA, 0x7F, 0xDC, 0x80, 0x24, 0xFB },
-  { "CPY $0678 = 7F                  ", 0xD7FD, 0x7F, 0xDC, 0x80, 0x24, 0xFB },
-  { "JSR $F927                       ", 0xD800, 0x7F, 0xDC, 0x80, 0x25, 0xFB },
-  { "BCC $F92E                       ", 0xF927, 0x7F, 0xDC, 0x80, 0x25, 0xF9 },
-  { "BEQ $F92E                       ", 0xF929, 0x7F, 0xDC, 0x80, 0x25, 0xF9 },
-  { "BMI $F92E                       ", 0xF92B, 0x7F, 0xDC, 0x80, 0x25, 0xF9 },
-  { "RTS                             ", 0xF92D, 0x7F, 0xDC, 0x80, 0x25, 0xF9 },
-  { "INX                             ", 0xD803, 0x7F, 0xDC, 0x80, 0x25, 0xFB },
-  { "TXA                             ", 0xD804, 0x7F, 0xDD, 0x80, 0xA5, 0xFB },
-  { "TAY                             ", 0xD805, 0xDD, 0xDD, 0x80, 0xA5, 0xFB },
-  { "JSR $F990                       ", 0xD806, 0xDD, 0xDD, 0xDD, 0xA5, 0xFB },
-  { "LDX #$55                        ", 0xF990, 0xDD, 0xDD, 0xDD, 0xA5, 0xF9 },
-  { "LDA #$FF                        ", 0xF992, 0xDD, 0x55, 0xDD, 0x25, 0xF9 },
-  { "STA $01 = FF                    ", 0xF994, 0xFF, 0x55, 0xDD, 0xA5, 0xF9 },
-  { "NOP                             ", 0xF996, 0xFF, 0x55, 0xDD, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF997, 0xFF, 0x55, 0xDD, 0xA5, 0xF9 },
-  { "SEC                             ", 0xF999, 0xFF, 0x55, 0xDD, 0xE5, 0xF9 },
-  { "LDA #$01                        ", 0xF99A, 0xFF, 0x55, 0xDD, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF99C, 0x01, 0x55, 0xDD, 0x65, 0xF9 },
-  { "STA $0678 = 7F                  ", 0xD809, 0x01, 0x55, 0xDD, 0x65, 0xFB },
-  { "LSR $0678 = 01                  ", 0xD80C, 0x01, 0x55, 0xDD, 0x65, 0xFB },
-  { "LDA $0678 = 00                  ", 0xD80F, 0x01, 0x55, 0xDD, 0x67, 0xFB },
-  { "JSR $F99D                       ", 0xD812, 0x00, 0x55, 0xDD, 0x67, 0xFB },
-  { "BCC $F9BA                       ", 0xF99D, 0x00, 0x55, 0xDD, 0x67, 0xF9 },
-  { "BNE $F9BA                       ", 0xF99F, 0x00, 0x55, 0xDD, 0x67, 0xF9 },
-  { "BMI $F9BA                       ", 0xF9A1, 0x00, 0x55, 0xDD, 0x67, 0xF9 },
-  { "BVC $F9BA                       ", 0xF9A3, 0x00, 0x55, 0xDD, 0x67, 0xF9 },
-  { "CMP #$00                        ", 0xF9A5, 0x00, 0x55, 0xDD, 0x67, 0xF9 },
-  { "BNE $F9BA                       ", 0xF9A7, 0x00, 0x55, 0xDD, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9A9, 0x00, 0x55, 0xDD, 0x67, 0xF9 },
-  { "LDA #$AA                        ", 0xF9AA, 0x00, 0x55, 0xDD, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9AC, 0xAA, 0x55, 0xDD, 0xA5, 0xF9 },
-  { "INY                             ", 0xD815, 0xAA, 0x55, 0xDD, 0xA5, 0xFB },
-  { "STA $0678 = 00                  ", 0xD816, 0xAA, 0x55, 0xDE, 0xA5, 0xFB },
-  { "LSR $0678 = AA                  ", 0xD819, 0xAA, 0x55, 0xDE, 0xA5, 0xFB },
-  { "LDA $0678 = 55                  ", 0xD81C, 0xAA, 0x55, 0xDE, 0x24, 0xFB },
-  { "JSR $F9AD                       ", 0xD81F, 0x55, 0x55, 0xDE, 0x24, 0xFB },
-  { "BCS $F9BA                       ", 0xF9AD, 0x55, 0x55, 0xDE, 0x24, 0xF9 },
-  { "BEQ $F9BA                       ", 0xF9AF, 0x55, 0x55, 0xDE, 0x24, 0xF9 },
-  { "BMI $F9BA                       ", 0xF9B1, 0x55, 0x55, 0xDE, 0x24, 0xF9 },
-  { "BVS $F9BA                       ", 0xF9B3, 0x55, 0x55, 0xDE, 0x24, 0xF9 },
-  { "CMP #$55                        ", 0xF9B5, 0x55, 0x55, 0xDE, 0x24, 0xF9 },
-  { "BNE $F9BA                       ", 0xF9B7, 0x55, 0x55, 0xDE, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9B9, 0x55, 0x55, 0xDE, 0x27, 0xF9 },
-  { "INY                             ", 0xD822, 0x55, 0x55, 0xDE, 0x27, 0xFB },
-  { "JSR $F9BD                       ", 0xD823, 0x55, 0x55, 0xDF, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xF9BD, 0x55, 0x55, 0xDF, 0xA5, 0xF9 },
-  { "SEC                             ", 0xF9BF, 0x55, 0x55, 0xDF, 0xE5, 0xF9 },
-  { "LDA #$80                        ", 0xF9C0, 0x55, 0x55, 0xDF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF9C2, 0x80, 0x55, 0xDF, 0xE5, 0xF9 },
-  { "STA $0678 = 55                  ", 0xD826, 0x80, 0x55, 0xDF, 0xE5, 0xFB },
-  { "ASL $0678 = 80                  ", 0xD829, 0x80, 0x55, 0xDF, 0xE5, 0xFB },
-  { "LDA $0678 = 00                  ", 0xD82C, 0x80, 0x55, 0xDF, 0x67, 0xFB },
-  { "JSR $F9C3                       ", 0xD82F, 0x00, 0x55, 0xDF, 0x67, 0xFB },
-  { "BCC $F9E1                       ", 0xF9C3, 0x00, 0x55, 0xDF, 0x67, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9C5, 0x00, 0x55, 0xDF, 0x67, 0xF9 },
-  { "BMI $F9E1                       ", 0xF9C7, 0x00, 0x55, 0xDF, 0x67, 0xF9 },
-  { "BVC $F9E1                       ", 0xF9C9, 0x00, 0x55, 0xDF, 0x67, 0xF9 },
-  { "CMP #$00                        ", 0xF9CB, 0x00, 0x55, 0xDF, 0x67, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9CD, 0x00, 0x55, 0xDF, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9CF, 0x00, 0x55, 0xDF, 0x67, 0xF9 },
-  { "LDA #$55                        ", 0xF9D0, 0x00, 0x55, 0xDF, 0x27, 0xF9 },
-  { "SEC                             ", 0xF9D2, 0x55, 0x55, 0xDF, 0x25, 0xF9 },
-  { "RTS                             ", 0xF9D3, 0x55, 0x55, 0xDF, 0x25, 0xF9 },
-  { "INY                             ", 0xD832, 0x55, 0x55, 0xDF, 0x25, 0xFB },
-  { "STA $0678 = 00                  ", 0xD833, 0x55, 0x55, 0xE0, 0xA5, 0xFB },
-  { "ASL $0678 = 55                  ", 0xD836, 0x55, 0x55, 0xE0, 0xA5, 0xFB },
-  { "LDA $0678 = AA                  ", 0xD839, 0x55, 0x55, 0xE0, 0xA4, 0xFB },
-  { "JSR $F9D4                       ", 0xD83C, 0xAA, 0x55, 0xE0, 0xA4, 0xFB },
-  { "BCS $F9E1                       ", 0xF9D4, 0xAA, 0x55, 0xE0, 0xA4, 0xF9 },
-  { "BEQ $F9E1                       ", 0xF9D6, 0xAA, 0x55, 0xE0, 0xA4, 0xF9 },
-  { "BPL $F9E1                       ", 0xF9D8, 0xAA, 0x55, 0xE0, 0xA4, 0xF9 },
-  { "BVS $F9E1                       ", 0xF9DA, 0xAA, 0x55, 0xE0, 0xA4, 0xF9 },
-  { "CMP #$AA                        ", 0xF9DC, 0xAA, 0x55, 0xE0, 0xA4, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9DE, 0xAA, 0x55, 0xE0, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9E0, 0xAA, 0x55, 0xE0, 0x27, 0xF9 },
-  { "INY                             ", 0xD83F, 0xAA, 0x55, 0xE0, 0x27, 0xFB },
-  { "JSR $F9E4                       ", 0xD840, 0xAA, 0x55, 0xE1, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xF9E4, 0xAA, 0x55, 0xE1, 0xA5, 0xF9 },
-  { "SEC                             ", 0xF9E6, 0xAA, 0x55, 0xE1, 0xE5, 0xF9 },
-  { "LDA #$01                        ", 0xF9E7, 0xAA, 0x55, 0xE1, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF9E9, 0x01, 0x55, 0xE1, 0x65, 0xF9 },
-  { "STA $0678 = AA                  ", 0xD843, 0x01, 0x55, 0xE1, 0x65, 0xFB },
-  { "ROR $0678 = 01                  ", 0xD846, 0x01, 0x55, 0xE1, 0x65, 0xFB },
-  { "LDA $0678 = 80                  ", 0xD849, 0x01, 0x55, 0xE1, 0xE5, 0xFB },
-  { "JSR $F9EA                       ", 0xD84C, 0x80, 0x55, 0xE1, 0xE5, 0xFB },
-  { "BCC $FA08                       ", 0xF9EA, 0x80, 0x55, 0xE1, 0xE5, 0xF9 },
-  { "BEQ $FA08                       ", 0xF9EC, 0x80, 0x55, 0xE1, 0xE5, 0xF9 },
-  { "BPL $FA08                       ", 0xF9EE, 0x80, 0x55, 0xE1, 0xE5, 0xF9 },
-  { "BVC $FA08                       ", 0xF9F0, 0x80, 0x55, 0xE1, 0xE5, 0xF9 },
-  { "CMP #$80                        ", 0xF9F2, 0x80, 0x55, 0xE1, 0xE5, 0xF9 },
-  { "BNE $FA08                       ", 0xF9F4, 0x80, 0x55, 0xE1, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9F6, 0x80, 0x55, 0xE1, 0x67, 0xF9 },
-  { "CLC                             ", 0xF9F7, 0x80, 0x55, 0xE1, 0x27, 0xF9 },
-  { "LDA #$55                        ", 0xF9F8, 0x80, 0x55, 0xE1, 0x26, 0xF9 },
-  { "RTS                             ", 0xF9FA, 0x55, 0x55, 0xE1, 0x24, 0xF9 },
-  { "INY                             ", 0xD84F, 0x55, 0x55, 0xE1, 0x24, 0xFB },
-  { "STA $0678 = 80                  ", 0xD850, 0x55, 0x55, 0xE2, 0xA4, 0xFB },
-  { "ROR $0678 = 55                  ", 0xD853, 0x55, 0x55, 0xE2, 0xA4, 0xFB },
-  { "LDA $0678 = 2A                  ", 0xD856, 0x55, 0x55, 0xE2, 0x25, 0xFB },
-  { "JSR $F9FB                       ", 0xD859, 0x2A, 0x55, 0xE2, 0x25, 0xFB },
-  { "BCC $FA08                       ", 0xF9FB, 0x2A, 0x55, 0xE2, 0x25, 0xF9 },
-  { "BEQ $FA08                       ", 0xF9FD, 0x2A, 0x55, 0xE2, 0x25, 0xF9 },
-  { "BMI $FA08                       ", 0xF9FF, 0x2A, 0x55, 0xE2, 0x25, 0xF9 },
-  { "BVS $FA08                       ", 0xFA01, 0x2A, 0x55, 0xE2, 0x25, 0xF9 },
-  { "CMP #$2A                        ", 0xFA03, 0x2A, 0x55, 0xE2, 0x25, 0xF9 },
-  { "BNE $FA08                       ", 0xFA05, 0x2A, 0x55, 0xE2, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA07, 0x2A, 0x55, 0xE2, 0x27, 0xF9 },
-  { "INY                             ", 0xD85C, 0x2A, 0x55, 0xE2, 0x27, 0xFB },
-  { "JSR $FA0A                       ", 0xD85D, 0x2A, 0x55, 0xE3, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA0A, 0x2A, 0x55, 0xE3, 0xA5, 0xF9 },
-  { "SEC                             ", 0xFA0C, 0x2A, 0x55, 0xE3, 0xE5, 0xF9 },
-  { "LDA #$80                        ", 0xFA0D, 0x2A, 0x55, 0xE3, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA0F, 0x80, 0x55, 0xE3, 0xE5, 0xF9 },
-  { "STA $0678 = 2A                  ", 0xD860, 0x80, 0x55, 0xE3, 0xE5, 0xFB },
-  { "ROL $0678 = 80                  ", 0xD863, 0x80, 0x55, 0xE3, 0xE5, 0xFB },
-  { "LDA $0678 = 01                  ", 0xD866, 0x80, 0x55, 0xE3, 0x65, 0xFB },
-  { "JSR $FA10                       ", 0xD869, 0x01, 0x55, 0xE3, 0x65, 0xFB },
-  { "BCC $FA2E                       ", 0xFA10, 0x01, 0x55, 0xE3, 0x65, 0xF9 },
-  { "BEQ $FA2E                       ", 0xFA12, 0x01, 0x55, 0xE3, 0x65, 0xF9 },
-  { "BMI $FA2E                       ", 0xFA14, 0x01, 0x55, 0xE3, 0x65, 0xF9 },
-  { "BVC $FA2E                       ", 0xFA16, 0x01, 0x55, 0xE3, 0x65, 0xF9 },
-  { "CMP #$01                        ", 0xFA18, 0x01, 0x55, 0xE3, 0x65, 0xF9 },
-  { "BNE $FA2E                       ", 0xFA1A, 0x01, 0x55, 0xE3, 0x67, 0xF9 },
-  { "CLV                             ", 0xFA1C, 0x01, 0x55, 0xE3, 0x67, 0xF9 },
-  { "CLC                             ", 0xFA1D, 0x01, 0x55, 0xE3, 0x27, 0xF9 },
-  { "LDA #$55                        ", 0xFA1E, 0x01, 0x55, 0xE3, 0x26, 0xF9 },
-  { "RTS                             ", 0xFA20, 0x55, 0x55, 0xE3, 0x24, 0xF9 },
-  { "INY                             ", 0xD86C, 0x55, 0x55, 0xE3, 0x24, 0xFB },
-  { "STA $0678 = 01                  ", 0xD86D, 0x55, 0x55, 0xE4, 0xA4, 0xFB },
-  { "ROL $0678 = 55                  ", 0xD870, 0x55, 0x55, 0xE4, 0xA4, 0xFB },
-  { "LDA $0678 = AA                  ", 0xD873, 0x55, 0x55, 0xE4, 0xA4, 0xFB },
-  { "JSR $FA21                       ", 0xD876, 0xAA, 0x55, 0xE4, 0xA4, 0xFB },
-  { "BCS $FA2E                       ", 0xFA21, 0xAA, 0x55, 0xE4, 0xA4, 0xF9 },
-  { "BEQ $FA2E                       ", 0xFA23, 0xAA, 0x55, 0xE4, 0xA4, 0xF9 },
-  { "BPL $FA2E                       ", 0xFA25, 0xAA, 0x55, 0xE4, 0xA4, 0xF9 },
-  { "BVS $FA2E                       ", 0xFA27, 0xAA, 0x55, 0xE4, 0xA4, 0xF9 },
-  { "CMP #$AA                        ", 0xFA29, 0xAA, 0x55, 0xE4, 0xA4, 0xF9 },
-  { "BNE $FA2E                       ", 0xFA2B, 0xAA, 0x55, 0xE4, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA2D, 0xAA, 0x55, 0xE4, 0x27, 0xF9 },
-  { "LDA #$FF                        ", 0xD879, 0xAA, 0x55, 0xE4, 0x27, 0xFB },
-  { "STA $0678 = AA                  ", 0xD87B, 0xFF, 0x55, 0xE4, 0xA5, 0xFB },
-  { "STA $01 = FF                    ", 0xD87E, 0xFF, 0x55, 0xE4, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xD880, 0xFF, 0x55, 0xE4, 0xA5, 0xFB },
-  { "SEC                             ", 0xD882, 0xFF, 0x55, 0xE4, 0xE5, 0xFB },
-  { "INC $0678 = FF                  ", 0xD883, 0xFF, 0x55, 0xE4, 0xE5, 0xFB },
-  { "BNE $D895                       ", 0xD886, 0xFF, 0x55, 0xE4, 0x67, 0xFB },
-  { "BMI $D895                       ", 0xD888, 0xFF, 0x55, 0xE4, 0x67, 0xFB },
-  { "BVC $D895                       ", 0xD88A, 0xFF, 0x55, 0xE4, 0x67, 0xFB },
-  { "BCC $D895                       ", 0xD88C, 0xFF, 0x55, 0xE4, 0x67, 0xFB },
-  { "LDA $0678 = 00                  ", 0xD88E, 0xFF, 0x55, 0xE4, 0x67, 0xFB },
-  { "CMP #$00                        ", 0xD891, 0x00, 0x55, 0xE4, 0x67, 0xFB },
-  { "BEQ $D899                       ", 0xD893, 0x00, 0x55, 0xE4, 0x67, 0xFB },
-  { "LDA #$7F                        ", 0xD899, 0x00, 0x55, 0xE4, 0x67, 0xFB },
-  { "STA $0678 = 00                  ", 0xD89B, 0x7F, 0x55, 0xE4, 0x65, 0xFB },
-  { "CLV                             ", 0xD89E, 0x7F, 0x55, 0xE4, 0x65, 0xFB },
-  { "CLC                             ", 0xD89F, 0x7F, 0x55, 0xE4, 0x25, 0xFB },
-  { "INC $0678 = 7F                  ", 0xD8A0, 0x7F, 0x55, 0xE4, 0x24, 0xFB },
-  { "BEQ $D8B2                       ", 0xD8A3, 0x7F, 0x55, 0xE4, 0xA4, 0xFB },
-  { "BPL $D8B2                       ", 0xD8A5, 0x7F, 0x55, 0xE4, 0xA4, 0xFB },
-  { "BVS $D8B2                       ", 0xD8A7, 0x7F, 0x55, 0xE4, 0xA4, 0xFB },
-  { "BCS $D8B2                       ", 0xD8A9, 0x7F, 0x55, 0xE4, 0xA4, 0xFB },
-  { "LDA $0678 = 80                  ", 0xD8AB, 0x7F, 0x55, 0xE4, 0xA4, 0xFB },
-  { "CMP #$80                        ", 0xD8AE, 0x80, 0x55, 0xE4, 0xA4, 0xFB },
-  { "BEQ $D8B6                       ", 0xD8B0, 0x80, 0x55, 0xE4, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xD8B6, 0x80, 0x55, 0xE4, 0x27, 0xFB },
-  { "STA $0678 = 80                  ", 0xD8B8, 0x00, 0x55, 0xE4, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xD8BB, 0x00, 0x55, 0xE4, 0x27, 0xFB },
-  { "SEC                             ", 0xD8BD, 0x00, 0x55, 0xE4, 0xE7, 0xFB },
-  { "DEC $0678 = 00                  ", 0xD8BE, 0x00, 0x55, 0xE4, 0xE7, 0xFB },
-  { "BEQ $D8D0                       ", 0xD8C1, 0x00, 0x55, 0xE4, 0xE5, 0xFB },
-  { "BPL $D8D0                       ", 0xD8C3, 0x00, 0x55, 0xE4, 0xE5, 0xFB },
-  { "BVC $D8D0                       ", 0xD8C5, 0x00, 0x55, 0xE4, 0xE5, 0xFB },
-  { "BCC $D8D0                       ", 0xD8C7, 0x00, 0x55, 0xE4, 0xE5, 0xFB },
-  { "LDA $0678 = FF                  ", 0xD8C9, 0x00, 0x55, 0xE4, 0xE5, 0xFB },
-  { "CMP #$FF                        ", 0xD8CC, 0xFF, 0x55, 0xE4, 0xE5, 0xFB },
-  { "BEQ $D8D4                       ", 0xD8CE, 0xFF, 0x55, 0xE4, 0x67, 0xFB },
-  { "LDA #$80                        ", 0xD8D4, 0xFF, 0x55, 0xE4, 0x67, 0xFB },
-  { "STA $0678 = FF                  ", 0xD8D6, 0x80, 0x55, 0xE4, 0xE5, 0xFB },
-  { "CLV                             ", 0xD8D9, 0x80, 0x55, 0xE4, 0xE5, 0xFB },
-  { "CLC                             ", 0xD8DA, 0x80, 0x55, 0xE4, 0xA5, 0xFB },
-  { "DEC $0678 = 80                  ", 0xD8DB, 0x80, 0x55, 0xE4, 0xA4, 0xFB },
-  { "BEQ $D8ED                       ", 0xD8DE, 0x80, 0x55, 0xE4, 0x24, 0xFB },
-  { "BMI $D8ED                       ", 0xD8E0, 0x80, 0x55, 0xE4, 0x24, 0xFB },
-  { "BVS $D8ED                       ", 0xD8E2, 0x80, 0x55, 0xE4, 0x24, 0xFB },
-  { "BCS $D8ED                       ", 0xD8E4, 0x80, 0x55, 0xE4, 0x24, 0xFB },
-  { "LDA $0678 = 7F                  ", 0xD8E6, 0x80, 0x55, 0xE4, 0x24, 0xFB },
-  { "CMP #$7F                        ", 0xD8E9, 0x7F, 0x55, 0xE4, 0x24, 0xFB },
-  { "BEQ $D8F1                       ", 0xD8EB, 0x7F, 0x55, 0xE4, 0x27, 0xFB },
-  { "LDA #$01                        ", 0xD8F1, 0x7F, 0x55, 0xE4, 0x27, 0xFB },
-  { "STA $0678 = 7F                  ", 0xD8F3, 0x01, 0x55, 0xE4, 0x25, 0xFB },
-  { "DEC $0678 = 01                  ", 0xD8F6, 0x01, 0x55, 0xE4, 0x25, 0xFB },
-  { "BEQ $D8FF                       ", 0xD8F9, 0x01, 0x55, 0xE4, 0x27, 0xFB },
-  { "RTS                             ", 0xD8FF, 0x01, 0x55, 0xE4, 0x27, 0xFB },
-  { "JSR $D900                       ", 0xC618, 0x01, 0x55, 0xE4, 0x27, 0xFD },
-  { "LDA #$A3                        ", 0xD900, 0x01, 0x55, 0xE4, 0x27, 0xFB },
-  { "STA $33 = 00                    ", 0xD902, 0xA3, 0x55, 0xE4, 0xA5, 0xFB },
-  { "LDA #$89                        ", 0xD904, 0xA3, 0x55, 0xE4, 0xA5, 0xFB },
-  { "STA $0300 = 70                  ", 0xD906, 0x89, 0x55, 0xE4, 0xA5, 0xFB },
-  { "LDA #$12                        ", 0xD909, 0x89, 0x55, 0xE4, 0xA5, 0xFB },
-  { "STA $0245 = 00                  ", 0xD90B, 0x12, 0x55, 0xE4, 0x25, 0xFB },
-  { "LDA #$FF                        ", 0xD90E, 0x12, 0x55, 0xE4, 0x25, 0xFB },
-  { "STA $01 = FF                    ", 0xD910, 0xFF, 0x55, 0xE4, 0xA5, 0xFB },
-  { "LDX #$65                        ", 0xD912, 0xFF, 0x55, 0xE4, 0xA5, 0xFB },
-  { "LDA #$00                        ", 0xD914, 0xFF, 0x65, 0xE4, 0x25, 0xFB },
-  { "STA $89 = 00                    ", 0xD916, 0x00, 0x65, 0xE4, 0x27, 0xFB },
-  { "LDA #$03                        ", 0xD918, 0x00, 0x65, 0xE4, 0x27, 0xFB },
-  { "STA $8A = 00                    ", 0xD91A, 0x03, 0x65, 0xE4, 0x25, 0xFB },
-  { "LDY #$00                        ", 0xD91C, 0x03, 0x65, 0xE4, 0x25, 0xFB },
-  { "SEC                             ", 0xD91E, 0x03, 0x65, 0x00, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xD91F, 0x03, 0x65, 0x00, 0x27, 0xFB },
-  { "CLV                             ", 0xD921, 0x00, 0x65, 0x00, 0x27, 0xFB },
-  { "LDA ($89),Y = 0300 @ 0300 = 89  ", 0xD922, 0x00, 0x65, 0x00, 0x27, 0xFB },
-  { "BEQ $D932                       ", 0xD924, 0x89, 0x65, 0x00, 0xA5, 0xFB },
-  { "BCC $D932                       ", 0xD926, 0x89, 0x65, 0x00, 0xA5, 0xFB },
-  { "BVS $D932                       ", 0xD928, 0x89, 0x65, 0x00, 0xA5, 0xFB },
-  { "CMP #$89                        ", 0xD92A, 0x89, 0x65, 0x00, 0xA5, 0xFB },
-  { "BNE $D932                       ", 0xD92C, 0x89, 0x65, 0x00, 0x27, 0xFB },
-  { "CPX #$65                        ", 0xD92E, 0x89, 0x65, 0x00, 0x27, 0xFB },
-  { "BEQ $D936                       ", 0xD930, 0x89, 0x65, 0x00, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xD936, 0x89, 0x65, 0x00, 0x27, 0xFB },
-  { "STA $97 = 00                    ", 0xD938, 0xFF, 0x65, 0x00, 0xA5, 0xFB },
-  { "STA $98 = 00                    ", 0xD93A, 0xFF, 0x65, 0x00, 0xA5, 0xFB },
-  { "BIT $98 = FF                    ", 0xD93C, 0xFF, 0x65, 0x00, 0xA5, 0xFB },
-  { "LDY #$34                        ", 0xD93E, 0xFF, 0x65, 0x00, 0xE5, 0xFB },
-  { "LDA ($97),Y = FFFF @ 0033 = A3  ", 0xD940, 0xFF, 0x65, 0x34, 0x65, 0xFB },
-  { "CMP #$A3                        ", 0xD942, 0xA3, 0x65, 0x34, 0xE5, 0xFB },
-  { "BNE $D948                       ", 0xD944, 0xA3, 0x65, 0x34, 0x67, 0xFB },
-  { "BCS $D94C                       ", 0xD946, 0xA3, 0x65, 0x34, 0x67, 0xFB },
-  { "LDA $00 = 00                    ", 0xD94C, 0xA3, 0x65, 0x34, 0x67, 0xFB },
-  { "PHA                             ", 0xD94E, 0x00, 0x65, 0x34, 0x67, 0xFB },
-  { "LDA #$46                        ", 0xD94F, 0x00, 0x65, 0x34, 0x67, 0xFA },
-  { "STA $FF = 00                    ", 0xD951, 0x46, 0x65, 0x34, 0x65, 0xFA },
-  { "LDA #$01                        ", 0xD953, 0x46, 0x65, 0x34, 0x65, 0xFA },
-  { "STA $00 = 00                    ", 0xD955, 0x01, 0x65, 0x34, 0x65, 0xFA },
-  { "LDY #$FF                        ", 0xD957, 0x01, 0x65, 0x34, 0x65, 0xFA },
-  { "LDA ($FF),Y = 0146 @ 0245 = 12  ", 0xD959, 0x01, 0x65, 0xFF, 0xE5, 0xFA },
-  { "CMP #$12                        ", 0xD95B, 0x12, 0x65, 0xFF, 0x65, 0xFA },
-  { "BEQ $D963                       ", 0xD95D, 0x12, 0x65, 0xFF, 0x67, 0xFA },
-  { "PLA                             ", 0xD963, 0x12, 0x65, 0xFF, 0x67, 0xFA },
-  { "STA $00 = 01                    ", 0xD964, 0x00, 0x65, 0xFF, 0x67, 0xFB },
-  { "LDX #$ED                        ", 0xD966, 0x00, 0x65, 0xFF, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xD968, 0x00, 0xED, 0xFF, 0xE5, 0xFB },
-  { "STA $33 = A3                    ", 0xD96A, 0x00, 0xED, 0xFF, 0x67, 0xFB },
-  { "LDA #$04                        ", 0xD96C, 0x00, 0xED, 0xFF, 0x67, 0xFB },
-  { "STA $34 = 00                    ", 0xD96E, 0x04, 0xED, 0xFF, 0x65, 0xFB },
-  { "LDY #$00                        ", 0xD970, 0x04, 0xED, 0xFF, 0x65, 0xFB },
-  { "CLC                             ", 0xD972, 0x04, 0xED, 0x00, 0x67, 0xFB },
-  { "LDA #$FF                        ", 0xD973, 0x04, 0xED, 0x00, 0x66, 0xFB },
-  { "STA $01 = FF                    ", 0xD975, 0xFF, 0xED, 0x00, 0xE4, 0xFB },
-  { "BIT $01 = FF                    ", 0xD977, 0xFF, 0xED, 0x00, 0xE4, 0xFB },
-  { "LDA #$AA                        ", 0xD979, 0xFF, 0xED, 0x00, 0xE4, 0xFB },
-  { "STA $0400 = AD                  ", 0xD97B, 0xAA, 0xED, 0x00, 0xE4, 0xFB },
-  { "LDA #$55                        ", 0xD97E, 0xAA, 0xED, 0x00, 0xE4, 0xFB },
-  { "ORA ($33),Y = 0400 @ 0400 = AA  ", 0xD980, 0x55, 0xED, 0x00, 0x64, 0xFB },
-  { "BCS $D98C                       ", 0xD982, 0xFF, 0xED, 0x00, 0xE4, 0xFB },
-  { "BPL $D98C                       ", 0xD984, 0xFF, 0xED, 0x00, 0xE4, 0xFB },
-  { "CMP #$FF                        ", 0xD986, 0xFF, 0xED, 0x00, 0xE4, 0xFB },
-  { "BNE $D98C                       ", 0xD988, 0xFF, 0xED, 0x00, 0x67, 0xFB },
-  { "BVS $D98E                       ", 0xD98A, 0xFF, 0xED, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xD98E, 0xFF, 0xED, 0x00, 0x67, 0xFB },
-  { "SEC                             ", 0xD98F, 0xFF, 0xEE, 0x00, 0xE5, 0xFB },
-  { "CLV                             ", 0xD990, 0xFF, 0xEE, 0x00, 0xE5, 0xFB },
-  { "LDA #$00                        ", 0xD991, 0xFF, 0xEE, 0x00, 0xA5, 0xFB },
-  { "ORA ($33),Y = 0400 @ 0400 = AA  ", 0xD993, 0x00, 0xEE, 0x00, 0x27, 0xFB },
-  { "BEQ $D99D                       ", 0xD995, 0xAA, 0xEE, 0x00, 0xA5, 0xFB },
-  { "BVS $D99D                       ", 0xD997, 0xAA, 0xEE, 0x00, 0xA5, 0xFB },
-  { "BCC $D99D                       ", 0xD999, 0xAA, 0xEE, 0x00, 0xA5, 0xFB },
-  { "BMI $D99F                       ", 0xD99B, 0xAA, 0xEE, 0x00, 0xA5, 0xFB },
-  { "INX                             ", 0xD99F, 0xAA, 0xEE, 0x00, 0xA5, 0xFB },
-  { "CLC                             ", 0xD9A0, 0xAA, 0xEF, 0x00, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xD9A1, 0xAA, 0xEF, 0x00, 0xA4, 0xFB },
-  { "LDA #$55                        ", 0xD9A3, 0xAA, 0xEF, 0x00, 0xE4, 0xFB },
-  { "AND ($33),Y = 0400 @ 0400 = AA  ", 0xD9A5, 0x55, 0xEF, 0x00, 0x64, 0xFB },
-  { "BNE $D9AF                       ", 0xD9A7, 0x00, 0xEF, 0x00, 0x66, 0xFB },
-  { "BVC $D9AF                       ", 0xD9A9, 0x00, 0xEF, 0x00, 0x66, 0xFB },
-  { "BCS $D9AF                       ", 0xD9AB, 0x00, 0xEF, 0x00, 0x66, 0xFB },
-  { "BPL $D9B1                       ", 0xD9AD, 0x00, 0xEF, 0x00, 0x66, 0xFB },
-  { "INX                             ", 0xD9B1, 0x00, 0xEF, 0x00, 0x66, 0xFB },
-  { "SEC                             ", 0xD9B2, 0x00, 0xF0, 0x00, 0xE4, 0xFB },
-  { "CLV                             ", 0xD9B3, 0x00, 0xF0, 0x00, 0xE5, 0xFB },
-  { "LDA #$EF                        ", 0xD9B4, 0x00, 0xF0, 0x00, 0xA5, 0xFB },
-  { "STA $0400 = AA                  ", 0xD9B6, 0xEF, 0xF0, 0x00, 0xA5, 0xFB },
-  { "LDA #$F8                        ", 0xD9B9, 0xEF, 0xF0, 0x00, 0xA5, 0xFB },
-  { "AND ($33),Y = 0400 @ 0400 = EF  ", 0xD9BB, 0xF8, 0xF0, 0x00, 0xA5, 0xFB },
-  { "BCC $D9C7                       ", 0xD9BD, 0xE8, 0xF0, 0x00, 0xA5, 0xFB },
-  { "BPL $D9C7                       ", 0xD9BF, 0xE8, 0xF0, 0x00, 0xA5, 0xFB },
-  { "CMP #$E8                        ", 0xD9C1, 0xE8, 0xF0, 0x00, 0xA5, 0xFB },
-  { "BNE $D9C7                       ", 0xD9C3, 0xE8, 0xF0, 0x00, 0x27, 0xFB },
-  { "BVC $D9C9                       ", 0xD9C5, 0xE8, 0xF0, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xD9C9, 0xE8, 0xF0, 0x00, 0x27, 0xFB },
-  { "CLC                             ", 0xD9CA, 0xE8, 0xF1, 0x00, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xD9CB, 0xE8, 0xF1, 0x00, 0xA4, 0xFB },
-  { "LDA #$AA                        ", 0xD9CD, 0xE8, 0xF1, 0x00, 0xE4, 0xFB },
-  { "STA $0400 = EF                  ", 0xD9CF, 0xAA, 0xF1, 0x00, 0xE4, 0xFB },
-  { "LDA #$5F                        ", 0xD9D2, 0xAA, 0xF1, 0x00, 0xE4, 0xFB },
-  { "EOR ($33),Y = 0400 @ 0400 = AA  ", 0xD9D4, 0x5F, 0xF1, 0x00, 0x64, 0xFB },
-  { "BCS $D9E0                       ", 0xD9D6, 0xF5, 0xF1, 0x00, 0xE4, 0xFB },
-  { "BPL $D9E0                       ", 0xD9D8, 0xF5, 0xF1, 0x00, 0xE4, 0xFB },
-  { "CMP #$F5                        ", 0xD9DA, 0xF5, 0xF1, 0x00, 0xE4, 0xFB },
-  { "BNE $D9E0                       ", 0xD9DC, 0xF5, 0xF1, 0x00, 0x67, 0xFB },
-  { "BVS $D9E2                       ", 0xD9DE, 0xF5, 0xF1, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xD9E2, 0xF5, 0xF1, 0x00, 0x67, 0xFB },
-  { "SEC                             ", 0xD9E3, 0xF5, 0xF2, 0x00, 0xE5, 0xFB },
-  { "CLV                             ", 0xD9E4, 0xF5, 0xF2, 0x00, 0xE5, 0xFB },
-  { "LDA #$70                        ", 0xD9E5, 0xF5, 0xF2, 0x00, 0xA5, 0xFB },
-  { "STA $0400 = AA                  ", 0xD9E7, 0x70, 0xF2, 0x00, 0x25, 0xFB },
-  { "EOR ($33),Y = 0400 @ 0400 = 70  ", 0xD9EA, 0x70, 0xF2, 0x00, 0x25, 0xFB },
-  { "BNE $D9F4                       ", 0xD9EC, 0x00, 0xF2, 0x00, 0x27, 0xFB },
-  { "BVS $D9F4                       ", 0xD9EE, 0x00, 0xF2, 0x00, 0x27, 0xFB },
-  { "BCC $D9F4                       ", 0xD9F0, 0x00, 0xF2, 0x00, 0x27, 0xFB },
-  { "BPL $D9F6                       ", 0xD9F2, 0x00, 0xF2, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xD9F6, 0x00, 0xF2, 0x00, 0x27, 0xFB },
-  { "CLC                             ", 0xD9F7, 0x00, 0xF3, 0x00, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xD9F8, 0x00, 0xF3, 0x00, 0xA4, 0xFB },
-  { "LDA #$69                        ", 0xD9FA, 0x00, 0xF3, 0x00, 0xE6, 0xFB },
-  { "STA $0400 = 70                  ", 0xD9FC, 0x69, 0xF3, 0x00, 0x64, 0xFB },
-  { "LDA #$00                        ", 0xD9FF, 0x69, 0xF3, 0x00, 0x64, 0xFB },
-  { "ADC ($33),Y = 0400 @ 0400 = 69  ", 0xDA01, 0x00, 0xF3, 0x00, 0x66, 0xFB },
-  { "BMI $DA0D                       ", 0xDA03, 0x69, 0xF3, 0x00, 0x24, 0xFB },
-  { "BCS $DA0D                       ", 0xDA05, 0x69, 0xF3, 0x00, 0x24, 0xFB },
-  { "CMP #$69                        ", 0xDA07, 0x69, 0xF3, 0x00, 0x24, 0xFB },
-  { "BNE $DA0D                       ", 0xDA09, 0x69, 0xF3, 0x00, 0x27, 0xFB },
-  { "BVC $DA0F                       ", 0xDA0B, 0x69, 0xF3, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xDA0F, 0x69, 0xF3, 0x00, 0x27, 0xFB },
-  { "SEC                             ", 0xDA10, 0x69, 0xF4, 0x00, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xDA11, 0x69, 0xF4, 0x00, 0xA5, 0xFB },
-  { "LDA #$00                        ", 0xDA13, 0x69, 0xF4, 0x00, 0xE5, 0xFB },
-  { "ADC ($33),Y = 0400 @ 0400 = 69  ", 0xDA15, 0x00, 0xF4, 0x00, 0x67, 0xFB },
-  { "BMI $DA21                       ", 0xDA17, 0x6A, 0xF4, 0x00, 0x24, 0xFB },
-  { "BCS $DA21                       ", 0xDA19, 0x6A, 0xF4, 0x00, 0x24, 0xFB },
-  { "CMP #$6A                        ", 0xDA1B, 0x6A, 0xF4, 0x00, 0x24, 0xFB },
-  { "BNE $DA21                       ", 0xDA1D, 0x6A, 0xF4, 0x00, 0x27, 0xFB },
-  { "BVC $DA23                       ", 0xDA1F, 0x6A, 0xF4, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xDA23, 0x6A, 0xF4, 0x00, 0x27, 0xFB },
-  { "SEC                             ", 0xDA24, 0x6A, 0xF5, 0x00, 0xA5, 0xFB },
-  { "CLV                             ", 0xDA25, 0x6A, 0xF5, 0x00, 0xA5, 0xFB },
-  { "LDA #$7F                        ", 0xDA26, 0x6A, 0xF5, 0x00, 0xA5, 0xFB },
-  { "STA $0400 = 69                  ", 0xDA28, 0x7F, 0xF5, 0x00, 0x25, 0xFB },
-  { "ADC ($33),Y = 0400 @ 0400 = 7F  ", 0xDA2B, 0x7F, 0xF5, 0x00, 0x25, 0xFB },
-  { "BPL $DA37                       ", 0xDA2D, 0xFF, 0xF5, 0x00, 0xE4, 0xFB },
-  { "BCS $DA37                       ", 0xDA2F, 0xFF, 0xF5, 0x00, 0xE4, 0xFB },
-  { "CMP #$FF                        ", 0xDA31, 0xFF, 0xF5, 0x00, 0xE4, 0xFB },
-  { "BNE $DA37                       ", 0xDA33, 0xFF, 0xF5, 0x00, 0x67, 0xFB },
-  { "BVS $DA39                       ", 0xDA35, 0xFF, 0xF5, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xDA39, 0xFF, 0xF5, 0x00, 0x67, 0xFB },
-  { "CLC                             ", 0xDA3A, 0xFF, 0xF6, 0x00, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xDA3B, 0xFF, 0xF6, 0x00, 0xE4, 0xFB },
-  { "LDA #$80                        ", 0xDA3D, 0xFF, 0xF6, 0x00, 0xE4, 0xFB },
-  { "STA $0400 = 7F                  ", 0xDA3F, 0x80, 0xF6, 0x00, 0xE4, 0xFB },
-  { "LDA #$7F                        ", 0xDA42, 0x80, 0xF6, 0x00, 0xE4, 0xFB },
-  { "ADC ($33),Y = 0400 @ 0400 = 80  ", 0xDA44, 0x7F, 0xF6, 0x00, 0x64, 0xFB },
-  { "BPL $DA50                       ", 0xDA46, 0xFF, 0xF6, 0x00, 0xA4, 0xFB },
-  { "BCS $DA50                       ", 0xDA48, 0xFF, 0xF6, 0x00, 0xA4, 0xFB },
-  { "CMP #$FF                        ", 0xDA4A, 0xFF, 0xF6, 0x00, 0xA4, 0xFB },
-  { "BNE $DA50                       ", 0xDA4C, 0xFF, 0xF6, 0x00, 0x27, 0xFB },
-  { "BVC $DA52                       ", 0xDA4E, 0xFF, 0xF6, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xDA52, 0xFF, 0xF6, 0x00, 0x27, 0xFB },
-  { "SEC                             ", 0xDA53, 0xFF, 0xF7, 0x00, 0xA5, 0xFB },
-  { "CLV                             ", 0xDA54, 0xFF, 0xF7, 0x00, 0xA5, 0xFB },
-  { "LDA #$80                        ", 0xDA55, 0xFF, 0xF7, 0x00, 0xA5, 0xFB },
-  { "STA $0400 = 80                  ", 0xDA57, 0x80, 0xF7, 0x00, 0xA5, 0xFB },
-  { "LDA #$7F                        ", 0xDA5A, 0x80, 0xF7, 0x00, 0xA5, 0xFB },
-  { "ADC ($33),Y = 0400 @ 0400 = 80  ", 0xDA5C, 0x7F, 0xF7, 0x00, 0x25, 0xFB },
-  { "BNE $DA66                       ", 0xDA5E, 0x00, 0xF7, 0x00, 0x27, 0xFB },
-  { "BMI $DA66                       ", 0xDA60, 0x00, 0xF7, 0x00, 0x27, 0xFB },
-  { "BVS $DA66                       ", 0xDA62, 0x00, 0xF7, 0x00, 0x27, 0xFB },
-  { "BCS $DA68                       ", 0xDA64, 0x00, 0xF7, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xDA68, 0x00, 0xF7, 0x00, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xDA69, 0x00, 0xF8, 0x00, 0xA5, 0xFB },
-  { "LDA #$40                        ", 0xDA6B, 0x00, 0xF8, 0x00, 0xE7, 0xFB },
-  { "STA $0400 = 80                  ", 0xDA6D, 0x40, 0xF8, 0x00, 0x65, 0xFB },
-  { "CMP ($33),Y = 0400 @ 0400 = 40  ", 0xDA70, 0x40, 0xF8, 0x00, 0x65, 0xFB },
-  { "BMI $DA7A                       ", 0xDA72, 0x40, 0xF8, 0x00, 0x67, 0xFB },
-  { "BCC $DA7A                       ", 0xDA74, 0x40, 0xF8, 0x00, 0x67, 0xFB },
-  { "BNE $DA7A                       ", 0xDA76, 0x40, 0xF8, 0x00, 0x67, 0xFB },
-  { "BVS $DA7C                       ", 0xDA78, 0x40, 0xF8, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xDA7C, 0x40, 0xF8, 0x00, 0x67, 0xFB },
-  { "CLV                             ", 0xDA7D, 0x40, 0xF9, 0x00, 0xE5, 0xFB },
-  { "DEC $0400 = 40                  ", 0xDA7E, 0x40, 0xF9, 0x00, 0xA5, 0xFB },
-  { "CMP ($33),Y = 0400 @ 0400 = 3F  ", 0xDA81, 0x40, 0xF9, 0x00, 0x25, 0xFB },
-  { "BEQ $DA8B                       ", 0xDA83, 0x40, 0xF9, 0x00, 0x25, 0xFB },
-  { "BMI $DA8B                       ", 0xDA85, 0x40, 0xF9, 0x00, 0x25, 0xFB },
-  { "BCC $DA8B                       ", 0xDA87, 0x40, 0xF9, 0x00, 0x25, 0xFB },
-  { "BVC $DA8D                       ", 0xDA89, 0x40, 0xF9, 0x00, 0x25, 0xFB },
-  { "INX                             ", 0xDA8D, 0x40, 0xF9, 0x00, 0x25, 0xFB },
-  { "INC $0400 = 3F                  ", 0xDA8E, 0x40, 0xFA, 0x00, 0xA5, 0xFB },
-  { "INC $0400 = 40                  ", 0xDA91, 0x40, 0xFA, 0x00, 0x25, 0xFB },
-  { "CMP ($33),Y = 0400 @ 0400 = 41  ", 0xDA94, 0x40, 0xFA, 0x00, 0x25, 0xFB },
-  { "BEQ $DA9A                       ", 0xDA96, 0x40, 0xFA, 0x00, 0xA4, 0xFB },
-  { "BMI $DA9C                       ", 0xDA98, 0x40, 0xFA, 0x00, 0xA4, 0xFB },
-  { "INX                             ", 0xDA9C, 0x40, 0xFA, 0x00, 0xA4, 0xFB },
-  { "LDA #$00                        ", 0xDA9D, 0x40, 0xFB, 0x00, 0xA4, 0xFB },
-  { "STA $0400 = 41                  ", 0xDA9F, 0x00, 0xFB, 0x00, 0x26, 0xFB },
-  { "LDA #$80                        ", 0xDAA2, 0x00, 0xFB, 0x00, 0x26, 0xFB },
-  { "CMP ($33),Y = 0400 @ 0400 = 00  ", 0xDAA4, 0x80, 0xFB, 0x00, 0xA4, 0xFB },
-  { "BEQ $DAAC                       ", 0xDAA6, 0x80, 0xFB, 0x00, 0xA5, 0xFB },
-  { "BPL $DAAC                       ", 0xDAA8, 0x80, 0xFB, 0x00, 0xA5, 0xFB },
-  { "BCS $DAAE                       ", 0xDAAA, 0x80, 0xFB, 0x00, 0xA5, 0xFB },
-  { "INX                             ", 0xDAAE, 0x80, 0xFB, 0x00, 0xA5, 0xFB },
-  { "LDY #$80                        ", 0xDAAF, 0x80, 0xFC, 0x00, 0xA5, 0xFB },
-  { "STY $0400 = 00                  ", 0xDAB1, 0x80, 0xFC, 0x80, 0xA5, 0xFB },
-  { "LDY #$00                        ", 0xDAB4, 0x80, 0xFC, 0x80, 0xA5, 0xFB },
-  { "CMP ($33),Y = 0400 @ 0400 = 80  ", 0xDAB6, 0x80, 0xFC, 0x00, 0x27, 0xFB },
-  { "BNE $DABE                       ", 0xDAB8, 0x80, 0xFC, 0x00, 0x27, 0xFB },
-  { "BMI $DABE                       ", 0xDABA, 0x80, 0xFC, 0x00, 0x27, 0xFB },
-  { "BCS $DAC0                       ", 0xDABC, 0x80, 0xFC, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xDAC0, 0x80, 0xFC, 0x00, 0x27, 0xFB },
-  { "INC $0400 = 80                  ", 0xDAC1, 0x80, 0xFD, 0x00, 0xA5, 0xFB },
-  { "CMP ($33),Y = 0400 @ 0400 = 81  ", 0xDAC4, 0x80, 0xFD, 0x00, 0xA5, 0xFB },
-  { "BCS $DACC                       ", 0xDAC6, 0x80, 0xFD, 0x00, 0xA4, 0xFB },
-  { "BEQ $DACC                       ", 0xDAC8, 0x80, 0xFD, 0x00, 0xA4, 0xFB },
-  { "BMI $DACE                       ", 0xDACA, 0x80, 0xFD, 0x00, 0xA4, 0xFB },
-  { "INX                             ", 0xDACE, 0x80, 0xFD, 0x00, 0xA4, 0xFB },
-  { "DEC $0400 = 81                  ", 0xDACF, 0x80, 0xFE, 0x00, 0xA4, 0xFB },
-  { "DEC $0400 = 80                  ", 0xDAD2, 0x80, 0xFE, 0x00, 0xA4, 0xFB },
-  { "CMP ($33),Y = 0400 @ 0400 = 7F  ", 0xDAD5, 0x80, 0xFE, 0x00, 0x24, 0xFB },
-  { "BCC $DADD                       ", 0xDAD7, 0x80, 0xFE, 0x00, 0x25, 0xFB },
-  { "BEQ $DADD                       ", 0xDAD9, 0x80, 0xFE, 0x00, 0x25, 0xFB },
-  { "BPL $DADF                       ", 0xDADB, 0x80, 0xFE, 0x00, 0x25, 0xFB },
-  { "RTS                             ", 0xDADF, 0x80, 0xFE, 0x00, 0x25, 0xFB },
-  { "LDA $00 = 00                    ", 0xC61B, 0x80, 0xFE, 0x00, 0x25, 0xFD },
-  { "STA $10 = 00                    ", 0xC61D, 0x00, 0xFE, 0x00, 0x27, 0xFD },
-  { "LDA #$00                        ", 0xC61F, 0x00, 0xFE, 0x00, 0x27, 0xFD },
-  { "STA $00 = 00                    ", 0xC621, 0x00, 0xFE, 0x00, 0x27, 0xFD },
-  { "JSR $DAE0                       ", 0xC623, 0x00, 0xFE, 0x00, 0x27, 0xFD },
-  { "LDA #$00                        ", 0xDAE0, 0x00, 0xFE, 0x00, 0x27, 0xFB },
-  { "STA $33 = 00                    ", 0xDAE2, 0x00, 0xFE, 0x00, 0x27, 0xFB },
-  { "LDA #$04                        ", 0xDAE4, 0x00, 0xFE, 0x00, 0x27, 0xFB },
-  { "STA $34 = 04                    ", 0xDAE6, 0x04, 0xFE, 0x00, 0x25, 0xFB },
-  { "LDY #$00                        ", 0xDAE8, 0x04, 0xFE, 0x00, 0x25, 0xFB },
-  { "LDX #$01                        ", 0xDAEA, 0x04, 0xFE, 0x00, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xDAEC, 0x04, 0x01, 0x00, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xDAEE, 0x04, 0x01, 0x00, 0xE5, 0xFB },
-  { "STA $0400 = 7F                  ", 0xDAF0, 0x40, 0x01, 0x00, 0x65, 0xFB },
-  { "SEC                             ", 0xDAF3, 0x40, 0x01, 0x00, 0x65, 0xFB },
-  { "SBC ($33),Y = 0400 @ 0400 = 40  ", 0xDAF4, 0x40, 0x01, 0x00, 0x65, 0xFB },
-  { "BMI $DB02                       ", 0xDAF6, 0x00, 0x01, 0x00, 0x27, 0xFB },
-  { "BCC $DB02                       ", 0xDAF8, 0x00, 0x01, 0x00, 0x27, 0xFB },
-  { "BNE $DB02                       ", 0xDAFA, 0x00, 0x01, 0x00, 0x27, 0xFB },
-  { "BVS $DB02                       ", 0xDAFC, 0x00, 0x01, 0x00, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xDAFE, 0x00, 0x01, 0x00, 0x27, 0xFB },
-  { "BEQ $DB04                       ", 0xDB00, 0x00, 0x01, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xDB04, 0x00, 0x01, 0x00, 0x27, 0xFB },
-  { "CLV                             ", 0xDB05, 0x00, 0x02, 0x00, 0x25, 0xFB },
-  { "SEC                             ", 0xDB06, 0x00, 0x02, 0x00, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xDB07, 0x00, 0x02, 0x00, 0x25, 0xFB },
-  { "DEC $0400 = 40                  ", 0xDB09, 0x40, 0x02, 0x00, 0x25, 0xFB },
-  { "SBC ($33),Y = 0400 @ 0400 = 3F  ", 0xDB0C, 0x40, 0x02, 0x00, 0x25, 0xFB },
-  { "BEQ $DB1A                       ", 0xDB0E, 0x01, 0x02, 0x00, 0x25, 0xFB },
-  { "BMI $DB1A                       ", 0xDB10, 0x01, 0x02, 0x00, 0x25, 0xFB },
-  { "BCC $DB1A                       ", 0xDB12, 0x01, 0x02, 0x00, 0x25, 0xFB },
-  { "BVS $DB1A                       ", 0xDB14, 0x01, 0x02, 0x00, 0x25, 0xFB },
-  { "CMP #$01                        ", 0xDB16, 0x01, 0x02, 0x00, 0x25, 0xFB },
-  { "BEQ $DB1C                       ", 0xDB18, 0x01, 0x02, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xDB1C, 0x01, 0x02, 0x00, 0x27, 0xFB },
-  { "LDA #$40                        ", 0xDB1D, 0x01, 0x03, 0x00, 0x25, 0xFB },
-  { "SEC                             ", 0xDB1F, 0x40, 0x03, 0x00, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xDB20, 0x40, 0x03, 0x00, 0x25, 0xFB },
-  { "INC $0400 = 3F                  ", 0xDB22, 0x40, 0x03, 0x00, 0xE5, 0xFB },
-  { "INC $0400 = 40                  ", 0xDB25, 0x40, 0x03, 0x00, 0x65, 0xFB },
-  { "SBC ($33),Y = 0400 @ 0400 = 41  ", 0xDB28, 0x40, 0x03, 0x00, 0x65, 0xFB },
-  { "BCS $DB36                       ", 0xDB2A, 0xFF, 0x03, 0x00, 0xA4, 0xFB },
-  { "BEQ $DB36                       ", 0xDB2C, 0xFF, 0x03, 0x00, 0xA4, 0xFB },
-  { "BPL $DB36                       ", 0xDB2E, 0xFF, 0x03, 0x00, 0xA4, 0xFB },
-  { "BVS $DB36                       ", 0xDB30, 0xFF, 0x03, 0x00, 0xA4, 0xFB },
-  { "CMP #$FF                        ", 0xDB32, 0xFF, 0x03, 0x00, 0xA4, 0xFB },
-  { "BEQ $DB38                       ", 0xDB34, 0xFF, 0x03, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xDB38, 0xFF, 0x03, 0x00, 0x27, 0xFB },
-  { "CLC                             ", 0xDB39, 0xFF, 0x04, 0x00, 0x25, 0xFB },
-  { "LDA #$00                        ", 0xDB3A, 0xFF, 0x04, 0x00, 0x24, 0xFB },
-  { "STA $0400 = 41                  ", 0xDB3C, 0x00, 0x04, 0x00, 0x26, 0xFB },
-  { "LDA #$80                        ", 0xDB3F, 0x00, 0x04, 0x00, 0x26, 0xFB },
-  { "SBC ($33),Y = 0400 @ 0400 = 00  ", 0xDB41, 0x80, 0x04, 0x00, 0xA4, 0xFB },
-  { "BCC $DB49                       ", 0xDB43, 0x7F, 0x04, 0x00, 0x65, 0xFB },
-  { "CMP #$7F                        ", 0xDB45, 0x7F, 0x04, 0x00, 0x65, 0xFB },
-  { "BEQ $DB4B                       ", 0xDB47, 0x7F, 0x04, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xDB4B, 0x7F, 0x04, 0x00, 0x67, 0xFB },
-  { "SEC                             ", 0xDB4C, 0x7F, 0x05, 0x00, 0x65, 0xFB },
-  { "LDA #$7F                        ", 0xDB4D, 0x7F, 0x05, 0x00, 0x65, 0xFB },
-  { "STA $0400 = 00                  ", 0xDB4F, 0x7F, 0x05, 0x00, 0x65, 0xFB },
-  { "LDA #$81                        ", 0xDB52, 0x7F, 0x05, 0x00, 0x65, 0xFB },
-  { "SBC ($33),Y = 0400 @ 0400 = 7F  ", 0xDB54, 0x81, 0x05, 0x00, 0xE5, 0xFB },
-  { "BVC $DB5E                       ", 0xDB56, 0x02, 0x05, 0x00, 0x65, 0xFB },
-  { "BCC $DB5E                       ", 0xDB58, 0x02, 0x05, 0x00, 0x65, 0xFB },
-  { "CMP #$02                        ", 0xDB5A, 0x02, 0x05, 0x00, 0x65, 0xFB },
-  { "BEQ $DB60                       ", 0xDB5C, 0x02, 0x05, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xDB60, 0x02, 0x05, 0x00, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xDB61, 0x02, 0x06, 0x00, 0x65, 0xFB },
-  { "LDA #$87                        ", 0xDB63, 0x00, 0x06, 0x00, 0x67, 0xFB },
-  { "STA ($33),Y = 0400 @ 0400 = 7F  ", 0xDB65, 0x87, 0x06, 0x00, 0xE5, 0xFB },
-  { "LDA $0400 = 87                  ", 0xDB67, 0x87, 0x06, 0x00, 0xE5, 0xFB },
-  { "CMP #$87                        ", 0xDB6A, 0x87, 0x06, 0x00, 0xE5, 0xFB },
-  { "BEQ $DB70                       ", 0xDB6C, 0x87, 0x06, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xDB70, 0x87, 0x06, 0x00, 0x67, 0xFB },
-  { "LDA #$7E                        ", 0xDB71, 0x87, 0x07, 0x00, 0x65, 0xFB },
-  { "STA $0200 = 7F                  ", 0xDB73, 0x7E, 0x07, 0x00, 0x65, 0xFB },
-  { "LDA #$DB                        ", 0xDB76, 0x7E, 0x07, 0x00, 0x65, 0xFB },
-  { "STA $0201 = 00                  ", 0xDB78, 0xDB, 0x07, 0x00, 0xE5, 0xFB },
-  { "JMP ($0200) = DB7E              ", 0xDB7B, 0xDB, 0x07, 0x00, 0xE5, 0xFB },
-  { "LDA #$00                        ", 0xDB7E, 0xDB, 0x07, 0x00, 0xE5, 0xFB },
-  { "STA $02FF = 00                  ", 0xDB80, 0x00, 0x07, 0x00, 0x67, 0xFB },
-  { "LDA #$01                        ", 0xDB83, 0x00, 0x07, 0x00, 0x67, 0xFB },
-  { "STA $0300 = 89                  ", 0xDB85, 0x01, 0x07, 0x00, 0x65, 0xFB },
-  { "LDA #$03                        ", 0xDB88, 0x01, 0x07, 0x00, 0x65, 0xFB },
-  { "STA $0200 = 7E                  ", 0xDB8A, 0x03, 0x07, 0x00, 0x65, 0xFB },
-  { "LDA #$A9                        ", 0xDB8D, 0x03, 0x07, 0x00, 0x65, 0xFB },
-  { "STA $0100 = 00                  ", 0xDB8F, 0xA9, 0x07, 0x00, 0xE5, 0xFB },
-  { "LDA #$55                        ", 0xDB92, 0xA9, 0x07, 0x00, 0xE5, 0xFB },
-  { "STA $0101 = 00                  ", 0xDB94, 0x55, 0x07, 0x00, 0x65, 0xFB },
-  { "LDA #$60                        ", 0xDB97, 0x55, 0x07, 0x00, 0x65, 0xFB },
-  { "STA $0102 = 00                  ", 0xDB99, 0x60, 0x07, 0x00, 0x65, 0xFB },
-  { "LDA #$A9                        ", 0xDB9C, 0x60, 0x07, 0x00, 0x65, 0xFB },
-  { "STA $0300 = 01                  ", 0xDB9E, 0xA9, 0x07, 0x00, 0xE5, 0xFB },
-  { "LDA #$AA                        ", 0xDBA1, 0xA9, 0x07, 0x00, 0xE5, 0xFB },
-  { "STA $0301 = 00                  ", 0xDBA3, 0xAA, 0x07, 0x00, 0xE5, 0xFB },
-  { "LDA #$60                        ", 0xDBA6, 0xAA, 0x07, 0x00, 0xE5, 0xFB },
-  { "STA $0302 = 00                  ", 0xDBA8, 0x60, 0x07, 0x00, 0x65, 0xFB },
-  { "JSR $DBB5                       ", 0xDBAB, 0x60, 0x07, 0x00, 0x65, 0xFB },
-  { "JMP ($02FF) = 0300              ", 0xDBB5, 0x60, 0x07, 0x00, 0x65, 0xF9 },
-  { "LDA #$AA                        ", 0x0300, 0x60, 0x07, 0x00, 0x65, 0xF9 },
-  { "RTS                             ", 0x0302, 0xAA, 0x07, 0x00, 0xE5, 0xF9 },
-  { "CMP #$AA                        ", 0xDBAE, 0xAA, 0x07, 0x00, 0xE5, 0xFB },
-  { "BEQ $DBB4                       ", 0xDBB0, 0xAA, 0x07, 0x00, 0x67, 0xFB },
-  { "RTS                             ", 0xDBB4, 0xAA, 0x07, 0x00, 0x67, 0xFB },
-  { "JSR $DF4A                       ", 0xC626, 0xAA, 0x07, 0x00, 0x67, 0xFD },
-  { "LDA #$89                        ", 0xDF4A, 0xAA, 0x07, 0x00, 0x67, 0xFB },
-  { "STA $0300 = A9                  ", 0xDF4C, 0x89, 0x07, 0x00, 0xE5, 0xFB },
-  { "LDA #$A3                        ", 0xDF4F, 0x89, 0x07, 0x00, 0xE5, 0xFB },
-  { "STA $33 = 00                    ", 0xDF51, 0xA3, 0x07, 0x00, 0xE5, 0xFB },
-  { "LDA #$12                        ", 0xDF53, 0xA3, 0x07, 0x00, 0xE5, 0xFB },
-  { "STA $0245 = 12                  ", 0xDF55, 0x12, 0x07, 0x00, 0x65, 0xFB },
-  { "LDX #$65                        ", 0xDF58, 0x12, 0x07, 0x00, 0x65, 0xFB },
-  { "LDY #$00                        ", 0xDF5A, 0x12, 0x65, 0x00, 0x65, 0xFB },
-  { "SEC                             ", 0xDF5C, 0x12, 0x65, 0x00, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xDF5D, 0x12, 0x65, 0x00, 0x67, 0xFB },
-  { "CLV                             ", 0xDF5F, 0x00, 0x65, 0x00, 0x67, 0xFB },
-  { "LDA $0300,Y @ 0300 = 89         ", 0xDF60, 0x00, 0x65, 0x00, 0x27, 0xFB },
-  { "BEQ $DF71                       ", 0xDF63, 0x89, 0x65, 0x00, 0xA5, 0xFB },
-  { "BCC $DF71                       ", 0xDF65, 0x89, 0x65, 0x00, 0xA5, 0xFB },
-  { "BVS $DF71                       ", 0xDF67, 0x89, 0x65, 0x00, 0xA5, 0xFB },
-  { "CMP #$89                        ", 0xDF69, 0x89, 0x65, 0x00, 0xA5, 0xFB },
-  { "BNE $DF71                       ", 0xDF6B, 0x89, 0x65, 0x00, 0x27, 0xFB },
-  { "CPX #$65                        ", 0xDF6D, 0x89, 0x65, 0x00, 0x27, 0xFB },
-  { "BEQ $DF75                       ", 0xDF6F, 0x89, 0x65, 0x00, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xDF75, 0x89, 0x65, 0x00, 0x27, 0xFB },
-  { "STA $01 = FF                    ", 0xDF77, 0xFF, 0x65, 0x00, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xDF79, 0xFF, 0x65, 0x00, 0xA5, 0xFB },
-  { "LDY #$34                        ", 0xDF7B, 0xFF, 0x65, 0x00, 0xE5, 0xFB },
-  { "LDA $FFFF,Y @ 0033 = A3         ", 0xDF7D, 0xFF, 0x65, 0x34, 0x65, 0xFB },
-  { "CMP #$A3                        ", 0xDF80, 0xA3, 0x65, 0x34, 0xE5, 0xFB },
-  { "BNE $DF86                       ", 0xDF82, 0xA3, 0x65, 0x34, 0x67, 0xFB },
-  { "BCS $DF8A                       ", 0xDF84, 0xA3, 0x65, 0x34, 0x67, 0xFB },
-  { "LDA #$46                        ", 0xDF8A, 0xA3, 0x65, 0x34, 0x67, 0xFB },
-  { "STA $FF = 46                    ", 0xDF8C, 0x46, 0x65, 0x34, 0x65, 0xFB },
-  { "LDY #$FF                        ", 0xDF8E, 0x46, 0x65, 0x34, 0x65, 0xFB },
-  { "LDA $0146,Y @ 0245 = 12         ", 0xDF90, 0x46, 0x65, 0xFF, 0xE5, 0xFB },
-  { "CMP #$12                        ", 0xDF93, 0x12, 0x65, 0xFF, 0x65, 0xFB },
-  { "BEQ $DF9B                       ", 0xDF95, 0x12, 0x65, 0xFF, 0x67, 0xFB },
-  { "LDX #$39                        ", 0xDF9B, 0x12, 0x65, 0xFF, 0x67, 0xFB },
-  { "CLC                             ", 0xDF9D, 0x12, 0x39, 0xFF, 0x65, 0xFB },
-  { "LDA #$FF                        ", 0xDF9E, 0x12, 0x39, 0xFF, 0x64, 0xFB },
-  { "STA $01 = FF                    ", 0xDFA0, 0xFF, 0x39, 0xFF, 0xE4, 0xFB },
-  { "BIT $01 = FF                    ", 0xDFA2, 0xFF, 0x39, 0xFF, 0xE4, 0xFB },
-  { "LDA #$AA                        ", 0xDFA4, 0xFF, 0x39, 0xFF, 0xE4, 0xFB },
-  { "STA $0400 = 87                  ", 0xDFA6, 0xAA, 0x39, 0xFF, 0xE4, 0xFB },
-  { "LDA #$55                        ", 0xDFA9, 0xAA, 0x39, 0xFF, 0xE4, 0xFB },
-  { "LDY #$00                        ", 0xDFAB, 0x55, 0x39, 0xFF, 0x64, 0xFB },
-  { "ORA $0400,Y @ 0400 = AA         ", 0xDFAD, 0x55, 0x39, 0x00, 0x66, 0xFB },
-  { "BCS $DFBA                       ", 0xDFB0, 0xFF, 0x39, 0x00, 0xE4, 0xFB },
-  { "BPL $DFBA                       ", 0xDFB2, 0xFF, 0x39, 0x00, 0xE4, 0xFB },
-  { "CMP #$FF                        ", 0xDFB4, 0xFF, 0x39, 0x00, 0xE4, 0xFB },
-  { "BNE $DFBA                       ", 0xDFB6, 0xFF, 0x39, 0x00, 0x67, 0xFB },
-  { "BVS $DFBC                       ", 0xDFB8, 0xFF, 0x39, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xDFBC, 0xFF, 0x39, 0x00, 0x67, 0xFB },
-  { "SEC                             ", 0xDFBD, 0xFF, 0x3A, 0x00, 0x65, 0xFB },
-  { "CLV                             ", 0xDFBE, 0xFF, 0x3A, 0x00, 0x65, 0xFB },
-  { "LDA #$00                        ", 0xDFBF, 0xFF, 0x3A, 0x00, 0x25, 0xFB },
-  { "ORA $0400,Y @ 0400 = AA         ", 0xDFC1, 0x00, 0x3A, 0x00, 0x27, 0xFB },
-  { "BEQ $DFCC                       ", 0xDFC4, 0xAA, 0x3A, 0x00, 0xA5, 0xFB },
-  { "BVS $DFCC                       ", 0xDFC6, 0xAA, 0x3A, 0x00, 0xA5, 0xFB },
-  { "BCC $DFCC                       ", 0xDFC8, 0xAA, 0x3A, 0x00, 0xA5, 0xFB },
-  { "BMI $DFCE                       ", 0xDFCA, 0xAA, 0x3A, 0x00, 0xA5, 0xFB },
-  { "INX                             ", 0xDFCE, 0xAA, 0x3A, 0x00, 0xA5, 0xFB },
-  { "CLC                             ", 0xDFCF, 0xAA, 0x3B, 0x00, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xDFD0, 0xAA, 0x3B, 0x00, 0x24, 0xFB },
-  { "LDA #$55                        ", 0xDFD2, 0xAA, 0x3B, 0x00, 0xE4, 0xFB },
-  { "AND $0400,Y @ 0400 = AA         ", 0xDFD4, 0x55, 0x3B, 0x00, 0x64, 0xFB },
-  { "BNE $DFDF                       ", 0xDFD7, 0x00, 0x3B, 0x00, 0x66, 0xFB },
-  { "BVC $DFDF                       ", 0xDFD9, 0x00, 0x3B, 0x00, 0x66, 0xFB },
-  { "BCS $DFDF                       ", 0xDFDB, 0x00, 0x3B, 0x00, 0x66, 0xFB },
-  { "BPL $DFE1                       ", 0xDFDD, 0x00, 0x3B, 0x00, 0x66, 0xFB },
-  { "INX                             ", 0xDFE1, 0x00, 0x3B, 0x00, 0x66, 0xFB },
-  { "SEC                             ", 0xDFE2, 0x00, 0x3C, 0x00, 0x64, 0xFB },
-  { "CLV                             ", 0xDFE3, 0x00, 0x3C, 0x00, 0x65, 0xFB },
-  { "LDA #$EF                        ", 0xDFE4, 0x00, 0x3C, 0x00, 0x25, 0xFB },
-  { "STA $0400 = AA                  ", 0xDFE6, 0xEF, 0x3C, 0x00, 0xA5, 0xFB },
-  { "LDA #$F8                        ", 0xDFE9, 0xEF, 0x3C, 0x00, 0xA5, 0xFB },
-  { "AND $0400,Y @ 0400 = EF         ", 0xDFEB, 0xF8, 0x3C, 0x00, 0xA5, 0xFB },
-  { "BCC $DFF8                       ", 0xDFEE, 0xE8, 0x3C, 0x00, 0xA5, 0xFB },
-  { "BPL $DFF8                       ", 0xDFF0, 0xE8, 0x3C, 0x00, 0xA5, 0xFB },
-  { "CMP #$E8                        ", 0xDFF2, 0xE8, 0x3C, 0x00, 0xA5, 0xFB },
-  { "BNE $DFF8                       ", 0xDFF4, 0xE8, 0x3C, 0x00, 0x27, 0xFB },
-  { "BVC $DFFA                       ", 0xDFF6, 0xE8, 0x3C, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xDFFA, 0xE8, 0x3C, 0x00, 0x27, 0xFB },
-  { "CLC                             ", 0xDFFB, 0xE8, 0x3D, 0x00, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xDFFC, 0xE8, 0x3D, 0x00, 0x24, 0xFB },
-  { "LDA #$AA                        ", 0xDFFE, 0xE8, 0x3D, 0x00, 0xE4, 0xFB },
-  { "STA $0400 = EF                  ", 0xE000, 0xAA, 0x3D, 0x00, 0xE4, 0xFB },
-  { "LDA #$5F                        ", 0xE003, 0xAA, 0x3D, 0x00, 0xE4, 0xFB },
-  { "EOR $0400,Y @ 0400 = AA         ", 0xE005, 0x5F, 0x3D, 0x00, 0x64, 0xFB },
-  { "BCS $E012                       ", 0xE008, 0xF5, 0x3D, 0x00, 0xE4, 0xFB },
-  { "BPL $E012                       ", 0xE00A, 0xF5, 0x3D, 0x00, 0xE4, 0xFB },
-  { "CMP #$F5                        ", 0xE00C, 0xF5, 0x3D, 0x00, 0xE4, 0xFB },
-  { "BNE $E012                       ", 0xE00E, 0xF5, 0x3D, 0x00, 0x67, 0xFB },
-  { "BVS $E014                       ", 0xE010, 0xF5, 0x3D, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xE014, 0xF5, 0x3D, 0x00, 0x67, 0xFB },
-  { "SEC                             ", 0xE015, 0xF5, 0x3E, 0x00, 0x65, 0xFB },
-  { "CLV                             ", 0xE016, 0xF5, 0x3E, 0x00, 0x65, 0xFB },
-  { "LDA #$70                        ", 0xE017, 0xF5, 0x3E, 0x00, 0x25, 0xFB },
-  { "STA $0400 = AA                  ", 0xE019, 0x70, 0x3E, 0x00, 0x25, 0xFB },
-  { "EOR $0400,Y @ 0400 = 70         ", 0xE01C, 0x70, 0x3E, 0x00, 0x25, 0xFB },
-  { "BNE $E027                       ", 0xE01F, 0x00, 0x3E, 0x00, 0x27, 0xFB },
-  { "BVS $E027                       ", 0xE021, 0x00, 0x3E, 0x00, 0x27, 0xFB },
-  { "BCC $E027                       ", 0xE023, 0x00, 0x3E, 0x00, 0x27, 0xFB },
-  { "BPL $E029                       ", 0xE025, 0x00, 0x3E, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xE029, 0x00, 0x3E, 0x00, 0x27, 0xFB },
-  { "CLC                             ", 0xE02A, 0x00, 0x3F, 0x00, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xE02B, 0x00, 0x3F, 0x00, 0x24, 0xFB },
-  { "LDA #$69                        ", 0xE02D, 0x00, 0x3F, 0x00, 0xE6, 0xFB },
-  { "STA $0400 = 70                  ", 0xE02F, 0x69, 0x3F, 0x00, 0x64, 0xFB },
-  { "LDA #$00                        ", 0xE032, 0x69, 0x3F, 0x00, 0x64, 0xFB },
-  { "ADC $0400,Y @ 0400 = 69         ", 0xE034, 0x00, 0x3F, 0x00, 0x66, 0xFB },
-  { "BMI $E041                       ", 0xE037, 0x69, 0x3F, 0x00, 0x24, 0xFB },
-  { "BCS $E041                       ", 0xE039, 0x69, 0x3F, 0x00, 0x24, 0xFB },
-  { "CMP #$69                        ", 0xE03B, 0x69, 0x3F, 0x00, 0x24, 0xFB },
-  { "BNE $E041                       ", 0xE03D, 0x69, 0x3F, 0x00, 0x27, 0xFB },
-  { "BVC $E043                       ", 0xE03F, 0x69, 0x3F, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xE043, 0x69, 0x3F, 0x00, 0x27, 0xFB },
-  { "SEC                             ", 0xE044, 0x69, 0x40, 0x00, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xE045, 0x69, 0x40, 0x00, 0x25, 0xFB },
-  { "LDA #$00                        ", 0xE047, 0x69, 0x40, 0x00, 0xE5, 0xFB },
-  { "ADC $0400,Y @ 0400 = 69         ", 0xE049, 0x00, 0x40, 0x00, 0x67, 0xFB },
-  { "BMI $E056                       ", 0xE04C, 0x6A, 0x40, 0x00, 0x24, 0xFB },
-  { "BCS $E056                       ", 0xE04E, 0x6A, 0x40, 0x00, 0x24, 0xFB },
-  { "CMP #$6A                        ", 0xE050, 0x6A, 0x40, 0x00, 0x24, 0xFB },
-  { "BNE $E056                       ", 0xE052, 0x6A, 0x40, 0x00, 0x27, 0xFB },
-  { "BVC $E058                       ", 0xE054, 0x6A, 0x40, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xE058, 0x6A, 0x40, 0x00, 0x27, 0xFB },
-  { "SEC                             ", 0xE059, 0x6A, 0x41, 0x00, 0x25, 0xFB },
-  { "CLV                             ", 0xE05A, 0x6A, 0x41, 0x00, 0x25, 0xFB },
-  { "LDA #$7F                        ", 0xE05B, 0x6A, 0x41, 0x00, 0x25, 0xFB },
-  { "STA $0400 = 69                  ", 0xE05D, 0x7F, 0x41, 0x00, 0x25, 0xFB },
-  { "ADC $0400,Y @ 0400 = 7F         ", 0xE060, 0x7F, 0x41, 0x00, 0x25, 0xFB },
-  { "BPL $E06D                       ", 0xE063, 0xFF, 0x41, 0x00, 0xE4, 0xFB },
-  { "BCS $E06D                       ", 0xE065, 0xFF, 0x41, 0x00, 0xE4, 0xFB },
-  { "CMP #$FF                        ", 0xE067, 0xFF, 0x41, 0x00, 0xE4, 0xFB },
-  { "BNE $E06D                       ", 0xE069, 0xFF, 0x41, 0x00, 0x67, 0xFB },
-  { "BVS $E06F                       ", 0xE06B, 0xFF, 0x41, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xE06F, 0xFF, 0x41, 0x00, 0x67, 0xFB },
-  { "CLC                             ", 0xE070, 0xFF, 0x42, 0x00, 0x65, 0xFB },
-  { "BIT $01 = FF                    ", 0xE071, 0xFF, 0x42, 0x00, 0x64, 0xFB },
-  { "LDA #$80                        ", 0xE073, 0xFF, 0x42, 0x00, 0xE4, 0xFB },
-  { "STA $0400 = 7F                  ", 0xE075, 0x80, 0x42, 0x00, 0xE4, 0xFB },
-  { "LDA #$7F                        ", 0xE078, 0x80, 0x42, 0x00, 0xE4, 0xFB },
-  { "ADC $0400,Y @ 0400 = 80         ", 0xE07A, 0x7F, 0x42, 0x00, 0x64, 0xFB },
-  { "BPL $E087                       ", 0xE07D, 0xFF, 0x42, 0x00, 0xA4, 0xFB },
-  { "BCS $E087                       ", 0xE07F, 0xFF, 0x42, 0x00, 0xA4, 0xFB },
-  { "CMP #$FF                        ", 0xE081, 0xFF, 0x42, 0x00, 0xA4, 0xFB },
-  { "BNE $E087                       ", 0xE083, 0xFF, 0x42, 0x00, 0x27, 0xFB },
-  { "BVC $E089                       ", 0xE085, 0xFF, 0x42, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xE089, 0xFF, 0x42, 0x00, 0x27, 0xFB },
-  { "SEC                             ", 0xE08A, 0xFF, 0x43, 0x00, 0x25, 0xFB },
-  { "CLV                             ", 0xE08B, 0xFF, 0x43, 0x00, 0x25, 0xFB },
-  { "LDA #$80                        ", 0xE08C, 0xFF, 0x43, 0x00, 0x25, 0xFB },
-  { "STA $0400 = 80                  ", 0xE08E, 0x80, 0x43, 0x00, 0xA5, 0xFB },
-  { "LDA #$7F                        ", 0xE091, 0x80, 0x43, 0x00, 0xA5, 0xFB },
-  { "ADC $0400,Y @ 0400 = 80         ", 0xE093, 0x7F, 0x43, 0x00, 0x25, 0xFB },
-  { "BNE $E09E                       ", 0xE096, 0x00, 0x43, 0x00, 0x27, 0xFB },
-  { "BMI $E09E                       ", 0xE098, 0x00, 0x43, 0x00, 0x27, 0xFB },
-  { "BVS $E09E                       ", 0xE09A, 0x00, 0x43, 0x00, 0x27, 0xFB },
-  { "BCS $E0A0                       ", 0xE09C, 0x00, 0x43, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xE0A0, 0x00, 0x43, 0x00, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xE0A1, 0x00, 0x44, 0x00, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xE0A3, 0x00, 0x44, 0x00, 0xE7, 0xFB },
-  { "STA $0400 = 80                  ", 0xE0A5, 0x40, 0x44, 0x00, 0x65, 0xFB },
-  { "CMP $0400,Y @ 0400 = 40         ", 0xE0A8, 0x40, 0x44, 0x00, 0x65, 0xFB },
-  { "BMI $E0B3                       ", 0xE0AB, 0x40, 0x44, 0x00, 0x67, 0xFB },
-  { "BCC $E0B3                       ", 0xE0AD, 0x40, 0x44, 0x00, 0x67, 0xFB },
-  { "BNE $E0B3                       ", 0xE0AF, 0x40, 0x44, 0x00, 0x67, 0xFB },
-  { "BVS $E0B5                       ", 0xE0B1, 0x40, 0x44, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xE0B5, 0x40, 0x44, 0x00, 0x67, 0xFB },
-  { "CLV                             ", 0xE0B6, 0x40, 0x45, 0x00, 0x65, 0xFB },
-  { "DEC $0400 = 40                  ", 0xE0B7, 0x40, 0x45, 0x00, 0x25, 0xFB },
-  { "CMP $0400,Y @ 0400 = 3F         ", 0xE0BA, 0x40, 0x45, 0x00, 0x25, 0xFB },
-  { "BEQ $E0C5                       ", 0xE0BD, 0x40, 0x45, 0x00, 0x25, 0xFB },
-  { "BMI $E0C5                       ", 0xE0BF, 0x40, 0x45, 0x00, 0x25, 0xFB },
-  { "BCC $E0C5                       ", 0xE0C1, 0x40, 0x45, 0x00, 0x25, 0xFB },
-  { "BVC $E0C7                       ", 0xE0C3, 0x40, 0x45, 0x00, 0x25, 0xFB },
-  { "INX                             ", 0xE0C7, 0x40, 0x45, 0x00, 0x25, 0xFB },
-  { "INC $0400 = 3F                  ", 0xE0C8, 0x40, 0x46, 0x00, 0x25, 0xFB },
-  { "INC $0400 = 40                  ", 0xE0CB, 0x40, 0x46, 0x00, 0x25, 0xFB },
-  { "CMP $0400,Y @ 0400 = 41         ", 0xE0CE, 0x40, 0x46, 0x00, 0x25, 0xFB },
-  { "BEQ $E0D5                       ", 0xE0D1, 0x40, 0x46, 0x00, 0xA4, 0xFB },
-  { "BMI $E0D7                       ", 0xE0D3, 0x40, 0x46, 0x00, 0xA4, 0xFB },
-  { "INX                             ", 0xE0D7, 0x40, 0x46, 0x00, 0xA4, 0xFB },
-  { "LDA #$00                        ", 0xE0D8, 0x40, 0x47, 0x00, 0x24, 0xFB },
-  { "STA $0400 = 41                  ", 0xE0DA, 0x00, 0x47, 0x00, 0x26, 0xFB },
-  { "LDA #$80                        ", 0xE0DD, 0x00, 0x47, 0x00, 0x26, 0xFB },
-  { "CMP $0400,Y @ 0400 = 00         ", 0xE0DF, 0x80, 0x47, 0x00, 0xA4, 0xFB },
-  { "BEQ $E0E8                       ", 0xE0E2, 0x80, 0x47, 0x00, 0xA5, 0xFB },
-  { "BPL $E0E8                       ", 0xE0E4, 0x80, 0x47, 0x00, 0xA5, 0xFB },
-  { "BCS $E0EA                       ", 0xE0E6, 0x80, 0x47, 0x00, 0xA5, 0xFB },
-  { "INX                             ", 0xE0EA, 0x80, 0x47, 0x00, 0xA5, 0xFB },
-  { "LDY #$80                        ", 0xE0EB, 0x80, 0x48, 0x00, 0x25, 0xFB },
-  { "STY $0400 = 00                  ", 0xE0ED, 0x80, 0x48, 0x80, 0xA5, 0xFB },
-  { "LDY #$00                        ", 0xE0F0, 0x80, 0x48, 0x80, 0xA5, 0xFB },
-  { "CMP $0400,Y @ 0400 = 80         ", 0xE0F2, 0x80, 0x48, 0x00, 0x27, 0xFB },
-  { "BNE $E0FB                       ", 0xE0F5, 0x80, 0x48, 0x00, 0x27, 0xFB },
-  { "BMI $E0FB                       ", 0xE0F7, 0x80, 0x48, 0x00, 0x27, 0xFB },
-  { "BCS $E0FD                       ", 0xE0F9, 0x80, 0x48, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xE0FD, 0x80, 0x48, 0x00, 0x27, 0xFB },
-  { "INC $0400 = 80                  ", 0xE0FE, 0x80, 0x49, 0x00, 0x25, 0xFB },
-  { "CMP $0400,Y @ 0400 = 81         ", 0xE101, 0x80, 0x49, 0x00, 0xA5, 0xFB },
-  { "BCS $E10A                       ", 0xE104, 0x80, 0x49, 0x00, 0xA4, 0xFB },
-  { "BEQ $E10A                       ", 0xE106, 0x80, 0x49, 0x00, 0xA4, 0xFB },
-  { "BMI $E10C                       ", 0xE108, 0x80, 0x49, 0x00, 0xA4, 0xFB },
-  { "INX                             ", 0xE10C, 0x80, 0x49, 0x00, 0xA4, 0xFB },
-  { "DEC $0400 = 81                  ", 0xE10D, 0x80, 0x4A, 0x00, 0x24, 0xFB },
-  { "DEC $0400 = 80                  ", 0xE110, 0x80, 0x4A, 0x00, 0xA4, 0xFB },
-  { "CMP $0400,Y @ 0400 = 7F         ", 0xE113, 0x80, 0x4A, 0x00, 0x24, 0xFB },
-  { "BCC $E11C                       ", 0xE116, 0x80, 0x4A, 0x00, 0x25, 0xFB },
-  { "BEQ $E11C                       ", 0xE118, 0x80, 0x4A, 0x00, 0x25, 0xFB },
-  { "BPL $E11E                       ", 0xE11A, 0x80, 0x4A, 0x00, 0x25, 0xFB },
-  { "INX                             ", 0xE11E, 0x80, 0x4A, 0x00, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xE11F, 0x80, 0x4B, 0x00, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xE121, 0x80, 0x4B, 0x00, 0xE5, 0xFB },
-  { "STA $0400 = 7F                  ", 0xE123, 0x40, 0x4B, 0x00, 0x65, 0xFB },
-  { "SEC                             ", 0xE126, 0x40, 0x4B, 0x00, 0x65, 0xFB },
-  { "SBC $0400,Y @ 0400 = 40         ", 0xE127, 0x40, 0x4B, 0x00, 0x65, 0xFB },
-  { "BMI $E136                       ", 0xE12A, 0x00, 0x4B, 0x00, 0x27, 0xFB },
-  { "BCC $E136                       ", 0xE12C, 0x00, 0x4B, 0x00, 0x27, 0xFB },
-  { "BNE $E136                       ", 0xE12E, 0x00, 0x4B, 0x00, 0x27, 0xFB },
-  { "BVS $E136                       ", 0xE130, 0x00, 0x4B, 0x00, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xE132, 0x00, 0x4B, 0x00, 0x27, 0xFB },
-  { "BEQ $E138                       ", 0xE134, 0x00, 0x4B, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xE138, 0x00, 0x4B, 0x00, 0x27, 0xFB },
-  { "CLV                             ", 0xE139, 0x00, 0x4C, 0x00, 0x25, 0xFB },
-  { "SEC                             ", 0xE13A, 0x00, 0x4C, 0x00, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xE13B, 0x00, 0x4C, 0x00, 0x25, 0xFB },
-  { "DEC $0400 = 40                  ", 0xE13D, 0x40, 0x4C, 0x00, 0x25, 0xFB },
-  { "SBC $0400,Y @ 0400 = 3F         ", 0xE140, 0x40, 0x4C, 0x00, 0x25, 0xFB },
-  { "BEQ $E14F                       ", 0xE143, 0x01, 0x4C, 0x00, 0x25, 0xFB },
-  { "BMI $E14F                       ", 0xE145, 0x01, 0x4C, 0x00, 0x25, 0xFB },
-  { "BCC $E14F                       ", 0xE147, 0x01, 0x4C, 0x00, 0x25, 0xFB },
-  { "BVS $E14F                       ", 0xE149, 0x01, 0x4C, 0x00, 0x25, 0xFB },
-  { "CMP #$01                        ", 0xE14B, 0x01, 0x4C, 0x00, 0x25, 0xFB },
-  { "BEQ $E151                       ", 0xE14D, 0x01, 0x4C, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xE151, 0x01, 0x4C, 0x00, 0x27, 0xFB },
-  { "LDA #$40                        ", 0xE152, 0x01, 0x4D, 0x00, 0x25, 0xFB },
-  { "SEC                             ", 0xE154, 0x40, 0x4D, 0x00, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xE155, 0x40, 0x4D, 0x00, 0x25, 0xFB },
-  { "INC $0400 = 3F                  ", 0xE157, 0x40, 0x4D, 0x00, 0xE5, 0xFB },
-  { "INC $0400 = 40                  ", 0xE15A, 0x40, 0x4D, 0x00, 0x65, 0xFB },
-  { "SBC $0400,Y @ 0400 = 41         ", 0xE15D, 0x40, 0x4D, 0x00, 0x65, 0xFB },
-  { "BCS $E16C                       ", 0xE160, 0xFF, 0x4D, 0x00, 0xA4, 0xFB },
-  { "BEQ $E16C                       ", 0xE162, 0xFF, 0x4D, 0x00, 0xA4, 0xFB },
-  { "BPL $E16C                       ", 0xE164, 0xFF, 0x4D, 0x00, 0xA4, 0xFB },
-  { "BVS $E16C                       ", 0xE166, 0xFF, 0x4D, 0x00, 0xA4, 0xFB },
-  { "CMP #$FF                        ", 0xE168, 0xFF, 0x4D, 0x00, 0xA4, 0xFB },
-  { "BEQ $E16E                       ", 0xE16A, 0xFF, 0x4D, 0x00, 0x27, 0xFB },
-  { "INX                             ", 0xE16E, 0xFF, 0x4D, 0x00, 0x27, 0xFB },
-  { "CLC                             ", 0xE16F, 0xFF, 0x4E, 0x00, 0x25, 0xFB },
-  { "LDA #$00                        ", 0xE170, 0xFF, 0x4E, 0x00, 0x24, 0xFB },
-  { "STA $0400 = 41                  ", 0xE172, 0x00, 0x4E, 0x00, 0x26, 0xFB },
-  { "LDA #$80                        ", 0xE175, 0x00, 0x4E, 0x00, 0x26, 0xFB },
-  { "SBC $0400,Y @ 0400 = 00         ", 0xE177, 0x80, 0x4E, 0x00, 0xA4, 0xFB },
-  { "BCC $E180                       ", 0xE17A, 0x7F, 0x4E, 0x00, 0x65, 0xFB },
-  { "CMP #$7F                        ", 0xE17C, 0x7F, 0x4E, 0x00, 0x65, 0xFB },
-  { "BEQ $E182                       ", 0xE17E, 0x7F, 0x4E, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xE182, 0x7F, 0x4E, 0x00, 0x67, 0xFB },
-  { "SEC                             ", 0xE183, 0x7F, 0x4F, 0x00, 0x65, 0xFB },
-  { "LDA #$7F                        ", 0xE184, 0x7F, 0x4F, 0x00, 0x65, 0xFB },
-  { "STA $0400 = 00                  ", 0xE186, 0x7F, 0x4F, 0x00, 0x65, 0xFB },
-  { "LDA #$81                        ", 0xE189, 0x7F, 0x4F, 0x00, 0x65, 0xFB },
-  { "SBC $0400,Y @ 0400 = 7F         ", 0xE18B, 0x81, 0x4F, 0x00, 0xE5, 0xFB },
-  { "BVC $E196                       ", 0xE18E, 0x02, 0x4F, 0x00, 0x65, 0xFB },
-  { "BCC $E196                       ", 0xE190, 0x02, 0x4F, 0x00, 0x65, 0xFB },
-  { "CMP #$02                        ", 0xE192, 0x02, 0x4F, 0x00, 0x65, 0xFB },
-  { "BEQ $E198                       ", 0xE194, 0x02, 0x4F, 0x00, 0x67, 0xFB },
-  { "INX                             ", 0xE198, 0x02, 0x4F, 0x00, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xE199, 0x02, 0x50, 0x00, 0x65, 0xFB },
-  { "LDA #$87                        ", 0xE19B, 0x00, 0x50, 0x00, 0x67, 0xFB },
-  { "STA $0400,Y @ 0400 = 7F         ", 0xE19D, 0x87, 0x50, 0x00, 0xE5, 0xFB },
-  { "LDA $0400 = 87                  ", 0xE1A0, 0x87, 0x50, 0x00, 0xE5, 0xFB },
-  { "CMP #$87                        ", 0xE1A3, 0x87, 0x50, 0x00, 0xE5, 0xFB },
-  { "BEQ $E1A9                       ", 0xE1A5, 0x87, 0x50, 0x00, 0x67, 0xFB },
-  { "RTS                             ", 0xE1A9, 0x87, 0x50, 0x00, 0x67, 0xFB },
-  { "JSR $DBB8                       ", 0xC629, 0x87, 0x50, 0x00, 0x67, 0xFD },
-  { "LDA #$FF                        ", 0xDBB8, 0x87, 0x50, 0x00, 0x67, 0xFB },
-  { "STA $01 = FF                    ", 0xDBBA, 0xFF, 0x50, 0x00, 0xE5, 0xFB },
-  { "LDA #$AA                        ", 0xDBBC, 0xFF, 0x50, 0x00, 0xE5, 0xFB },
-  { "STA $33 = A3                    ", 0xDBBE, 0xAA, 0x50, 0x00, 0xE5, 0xFB },
-  { "LDA #$BB                        ", 0xDBC0, 0xAA, 0x50, 0x00, 0xE5, 0xFB },
-  { "STA $89 = 00                    ", 0xDBC2, 0xBB, 0x50, 0x00, 0xE5, 0xFB },
-  { "LDX #$00                        ", 0xDBC4, 0xBB, 0x50, 0x00, 0xE5, 0xFB },
-  { "LDA #$66                        ", 0xDBC6, 0xBB, 0x00, 0x00, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xDBC8, 0x66, 0x00, 0x00, 0x65, 0xFB },
-  { "SEC                             ", 0xDBCA, 0x66, 0x00, 0x00, 0xE5, 0xFB },
-  { "LDY #$00                        ", 0xDBCB, 0x66, 0x00, 0x00, 0xE5, 0xFB },
-  { "LDY $33,X @ 33 = AA             ", 0xDBCD, 0x66, 0x00, 0x00, 0x67, 0xFB },
-  { "BPL $DBE3                       ", 0xDBCF, 0x66, 0x00, 0xAA, 0xE5, 0xFB },
-  { "BEQ $DBE3                       ", 0xDBD1, 0x66, 0x00, 0xAA, 0xE5, 0xFB },
-  { "BVC $DBE3                       ", 0xDBD3, 0x66, 0x00, 0xAA, 0xE5, 0xFB },
-  { "BCC $DBE3                       ", 0xDBD5, 0x66, 0x00, 0xAA, 0xE5, 0xFB },
-  { "CMP #$66                        ", 0xDBD7, 0x66, 0x00, 0xAA, 0xE5, 0xFB },
-  { "BNE $DBE3                       ", 0xDBD9, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "CPX #$00                        ", 0xDBDB, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "BNE $DBE3                       ", 0xDBDD, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "CPY #$AA                        ", 0xDBDF, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "BEQ $DBE7                       ", 0xDBE1, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "LDX #$8A                        ", 0xDBE7, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "LDA #$66                        ", 0xDBE9, 0x66, 0x8A, 0xAA, 0xE5, 0xFB },
-  { "CLV                             ", 0xDBEB, 0x66, 0x8A, 0xAA, 0x65, 0xFB },
-  { "CLC                             ", 0xDBEC, 0x66, 0x8A, 0xAA, 0x25, 0xFB },
-  { "LDY #$00                        ", 0xDBED, 0x66, 0x8A, 0xAA, 0x24, 0xFB },
-  { "LDY $FF,X @ 89 = BB             ", 0xDBEF, 0x66, 0x8A, 0x00, 0x26, 0xFB },
-  { "BPL $DC05                       ", 0xDBF1, 0x66, 0x8A, 0xBB, 0xA4, 0xFB },
-  { "BEQ $DC05                       ", 0xDBF3, 0x66, 0x8A, 0xBB, 0xA4, 0xFB },
-  { "BVS $DC05                       ", 0xDBF5, 0x66, 0x8A, 0xBB, 0xA4, 0xFB },
-  { "BCS $DC05                       ", 0xDBF7, 0x66, 0x8A, 0xBB, 0xA4, 0xFB },
-  { "CPY #$BB                        ", 0xDBF9, 0x66, 0x8A, 0xBB, 0xA4, 0xFB },
-  { "BNE $DC05                       ", 0xDBFB, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "CMP #$66                        ", 0xDBFD, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "BNE $DC05                       ", 0xDBFF, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "CPX #$8A                        ", 0xDC01, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "BEQ $DC09                       ", 0xDC03, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xDC09, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "SEC                             ", 0xDC0B, 0x66, 0x8A, 0xBB, 0xE5, 0xFB },
-  { "LDY #$44                        ", 0xDC0C, 0x66, 0x8A, 0xBB, 0xE5, 0xFB },
-  { "LDX #$00                        ", 0xDC0E, 0x66, 0x8A, 0x44, 0x65, 0xFB },
-  { "STY $33,X @ 33 = AA             ", 0xDC10, 0x66, 0x00, 0x44, 0x67, 0xFB },
-  { "LDA $33 = 44                    ", 0xDC12, 0x66, 0x00, 0x44, 0x67, 0xFB },
-  { "BCC $DC2E                       ", 0xDC14, 0x44, 0x00, 0x44, 0x65, 0xFB },
-  { "CMP #$44                        ", 0xDC16, 0x44, 0x00, 0x44, 0x65, 0xFB },
-  { "BNE $DC2E                       ", 0xDC18, 0x44, 0x00, 0x44, 0x67, 0xFB },
-  { "BVC $DC2E                       ", 0xDC1A, 0x44, 0x00, 0x44, 0x67, 0xFB },
-  { "CLC                             ", 0xDC1C, 0x44, 0x00, 0x44, 0x67, 0xFB },
-  { "CLV                             ", 0xDC1D, 0x44, 0x00, 0x44, 0x66, 0xFB },
-  { "LDY #$99                        ", 0xDC1E, 0x44, 0x00, 0x44, 0x26, 0xFB },
-  { "LDX #$80                        ", 0xDC20, 0x44, 0x00, 0x99, 0xA4, 0xFB },
-  { "STY $85,X @ 05 = 00             ", 0xDC22, 0x44, 0x80, 0x99, 0xA4, 0xFB },
-  { "LDA $05 = 99                    ", 0xDC24, 0x44, 0x80, 0x99, 0xA4, 0xFB },
-  { "BCS $DC2E                       ", 0xDC26, 0x99, 0x80, 0x99, 0xA4, 0xFB },
-  { "CMP #$99                        ", 0xDC28, 0x99, 0x80, 0x99, 0xA4, 0xFB },
-  { "BNE $DC2E                       ", 0xDC2A, 0x99, 0x80, 0x99, 0x27, 0xFB },
-  { "BVC $DC32                       ", 0xDC2C, 0x99, 0x80, 0x99, 0x27, 0xFB },
-  { "LDY #$0B                        ", 0xDC32, 0x99, 0x80, 0x99, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xDC34, 0x99, 0x80, 0x0B, 0x25, 0xFB },
-  { "LDX #$78                        ", 0xDC36, 0xAA, 0x80, 0x0B, 0xA5, 0xFB },
-  { "STA $78 = 00                    ", 0xDC38, 0xAA, 0x78, 0x0B, 0x25, 0xFB },
-  { "JSR $F7B6                       ", 0xDC3A, 0xAA, 0x78, 0x0B, 0x25, 0xFB },
-  { "CLC                             ", 0xF7B6, 0xAA, 0x78, 0x0B, 0x25, 0xF9 },
-  { "LDA #$FF                        ", 0xF7B7, 0xAA, 0x78, 0x0B, 0x24, 0xF9 },
-  { "STA $01 = FF                    ", 0xF7B9, 0xFF, 0x78, 0x0B, 0xA4, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF7BB, 0xFF, 0x78, 0x0B, 0xA4, 0xF9 },
-  { "LDA #$55                        ", 0xF7BD, 0xFF, 0x78, 0x0B, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF7BF, 0x55, 0x78, 0x0B, 0x64, 0xF9 },
-  { "ORA $00,X @ 78 = AA             ", 0xDC3D, 0x55, 0x78, 0x0B, 0x64, 0xFB },
-  { "JSR $F7C0                       ", 0xDC3F, 0xFF, 0x78, 0x0B, 0xE4, 0xFB },
-  { "BCS $F7CB                       ", 0xF7C0, 0xFF, 0x78, 0x0B, 0xE4, 0xF9 },
-  { "BPL $F7CB                       ", 0xF7C2, 0xFF, 0x78, 0x0B, 0xE4, 0xF9 },
-  { "CMP #$FF                        ", 0xF7C4, 0xFF, 0x78, 0x0B, 0xE4, 0xF9 },
-  { "BNE $F7CB                       ", 0xF7C6, 0xFF, 0x78, 0x0B, 0x67, 0xF9 },
-  { "BVC $F7CB                       ", 0xF7C8, 0xFF, 0x78, 0x0B, 0x67, 0xF9 },
-  { "RTS                             ", 0xF7CA, 0xFF, 0x78, 0x0B, 0x67, 0xF9 },
-  { "INY                             ", 0xDC42, 0xFF, 0x78, 0x0B, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xDC43, 0xFF, 0x78, 0x0C, 0x65, 0xFB },
-  { "STA $78 = AA                    ", 0xDC45, 0x00, 0x78, 0x0C, 0x67, 0xFB },
-  { "JSR $F7CE                       ", 0xDC47, 0x00, 0x78, 0x0C, 0x67, 0xFB },
-  { "SEC                             ", 0xF7CE, 0x00, 0x78, 0x0C, 0x67, 0xF9 },
-  { "CLV                             ", 0xF7CF, 0x00, 0x78, 0x0C, 0x67, 0xF9 },
-  { "LDA #$00                        ", 0xF7D0, 0x00, 0x78, 0x0C, 0x27, 0xF9 },
-  { "RTS                             ", 0xF7D2, 0x00, 0x78, 0x0C, 0x27, 0xF9 },
-  { "ORA $00,X @ 78 = 00             ", 0xDC4A, 0x00, 0x78, 0x0C, 0x27, 0xFB },
-  { "JSR $F7D3                       ", 0xDC4C, 0x00, 0x78, 0x0C, 0x27, 0xFB },
-  { "BNE $F7DC                       ", 0xF7D3, 0x00, 0x78, 0x0C, 0x27, 0xF9 },
-  { "BVS $F7DC                       ", 0xF7D5, 0x00, 0x78, 0x0C, 0x27, 0xF9 },
-  { "BCC $F7DC                       ", 0xF7D7, 0x00, 0x78, 0x0C, 0x27, 0xF9 },
-  { "BMI $F7DC                       ", 0xF7D9, 0x00, 0x78, 0x0C, 0x27, 0xF9 },
-  { "RTS                             ", 0xF7DB, 0x00, 0x78, 0x0C, 0x27, 0xF9 },
-  { "INY                             ", 0xDC4F, 0x00, 0x78, 0x0C, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xDC50, 0x00, 0x78, 0x0D, 0x25, 0xFB },
-  { "STA $78 = 00                    ", 0xDC52, 0xAA, 0x78, 0x0D, 0xA5, 0xFB },
-  { "JSR $F7DF                       ", 0xDC54, 0xAA, 0x78, 0x0D, 0xA5, 0xFB },
-  { "CLC                             ", 0xF7DF, 0xAA, 0x78, 0x0D, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF7E0, 0xAA, 0x78, 0x0D, 0xA4, 0xF9 },
-  { "LDA #$55                        ", 0xF7E2, 0xAA, 0x78, 0x0D, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF7E4, 0x55, 0x78, 0x0D, 0x64, 0xF9 },
-  { "AND $00,X @ 78 = AA             ", 0xDC57, 0x55, 0x78, 0x0D, 0x64, 0xFB },
-  { "JSR $F7E5                       ", 0xDC59, 0x00, 0x78, 0x0D, 0x66, 0xFB },
-  { "BNE $F7EE                       ", 0xF7E5, 0x00, 0x78, 0x0D, 0x66, 0xF9 },
-  { "BVC $F7EE                       ", 0xF7E7, 0x00, 0x78, 0x0D, 0x66, 0xF9 },
-  { "BCS $F7EE                       ", 0xF7E9, 0x00, 0x78, 0x0D, 0x66, 0xF9 },
-  { "BMI $F7EE                       ", 0xF7EB, 0x00, 0x78, 0x0D, 0x66, 0xF9 },
-  { "RTS                             ", 0xF7ED, 0x00, 0x78, 0x0D, 0x66, 0xF9 },
-  { "INY                             ", 0xDC5C, 0x00, 0x78, 0x0D, 0x66, 0xFB },
-  { "LDA #$EF                        ", 0xDC5D, 0x00, 0x78, 0x0E, 0x64, 0xFB },
-  { "STA $78 = AA                    ", 0xDC5F, 0xEF, 0x78, 0x0E, 0xE4, 0xFB },
-  { "JSR $F7F1                       ", 0xDC61, 0xEF, 0x78, 0x0E, 0xE4, 0xFB },
-  { "SEC                             ", 0xF7F1, 0xEF, 0x78, 0x0E, 0xE4, 0xF9 },
-  { "CLV                             ", 0xF7F2, 0xEF, 0x78, 0x0E, 0xE5, 0xF9 },
-  { "LDA #$F8                        ", 0xF7F3, 0xEF, 0x78, 0x0E, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF7F5, 0xF8, 0x78, 0x0E, 0xA5, 0xF9 },
-  { "AND $00,X @ 78 = EF             ", 0xDC64, 0xF8, 0x78, 0x0E, 0xA5, 0xFB },
-  { "JSR $F7F6                       ", 0xDC66, 0xE8, 0x78, 0x0E, 0xA5, 0xFB },
-  { "BCC $F801                       ", 0xF7F6, 0xE8, 0x78, 0x0E, 0xA5, 0xF9 },
-  { "BPL $F801                       ", 0xF7F8, 0xE8, 0x78, 0x0E, 0xA5, 0xF9 },
-  { "CMP #$E8                        ", 0xF7FA, 0xE8, 0x78, 0x0E, 0xA5, 0xF9 },
-  { "BNE $F801                       ", 0xF7FC, 0xE8, 0x78, 0x0E, 0x27, 0xF9 },
-  { "BVS $F801                       ", 0xF7FE, 0xE8, 0x78, 0x0E, 0x27, 0xF9 },
-  { "RTS                             ", 0xF800, 0xE8, 0x78, 0x0E, 0x27, 0xF9 },
-  { "INY                             ", 0xDC69, 0xE8, 0x78, 0x0E, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xDC6A, 0xE8, 0x78, 0x0F, 0x25, 0xFB },
-  { "STA $78 = EF                    ", 0xDC6C, 0xAA, 0x78, 0x0F, 0xA5, 0xFB },
-  { "JSR $F804                       ", 0xDC6E, 0xAA, 0x78, 0x0F, 0xA5, 0xFB },
-  { "CLC                             ", 0xF804, 0xAA, 0x78, 0x0F, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF805, 0xAA, 0x78, 0x0F, 0xA4, 0xF9 },
-  { "LDA #$5F                        ", 0xF807, 0xAA, 0x78, 0x0F, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF809, 0x5F, 0x78, 0x0F, 0x64, 0xF9 },
-  { "EOR $00,X @ 78 = AA             ", 0xDC71, 0x5F, 0x78, 0x0F, 0x64, 0xFB },
-  { "JSR $F80A                       ", 0xDC73, 0xF5, 0x78, 0x0F, 0xE4, 0xFB },
-  { "BCS $F815                       ", 0xF80A, 0xF5, 0x78, 0x0F, 0xE4, 0xF9 },
-  { "BPL $F815                       ", 0xF80C, 0xF5, 0x78, 0x0F, 0xE4, 0xF9 },
-  { "CMP #$F5                        ", 0xF80E, 0xF5, 0x78, 0x0F, 0xE4, 0xF9 },
-  { "BNE $F815                       ", 0xF810, 0xF5, 0x78, 0x0F, 0x67, 0xF9 },
-  { "BVC $F815                       ", 0xF812, 0xF5, 0x78, 0x0F, 0x67, 0xF9 },
-  { "RTS                             ", 0xF814, 0xF5, 0x78, 0x0F, 0x67, 0xF9 },
-  { "INY                             ", 0xDC76, 0xF5, 0x78, 0x0F, 0x67, 0xFB },
-  { "LDA #$70                        ", 0xDC77, 0xF5, 0x78, 0x10, 0x65, 0xFB },
-  { "STA $78 = AA                    ", 0xDC79, 0x70, 0x78, 0x10, 0x65, 0xFB },
-  { "JSR $F818                       ", 0xDC7B, 0x70, 0x78, 0x10, 0x65, 0xFB },
-  { "SEC                             ", 0xF818, 0x70, 0x78, 0x10, 0x65, 0xF9 },
-  { "CLV                             ", 0xF819, 0x70, 0x78, 0x10, 0x65, 0xF9 },
-  { "LDA #$70                        ", 0xF81A, 0x70, 0x78, 0x10, 0x25, 0xF9 },
-  { "RTS                             ", 0xF81C, 0x70, 0x78, 0x10, 0x25, 0xF9 },
-  { "EOR $00,X @ 78 = 70             ", 0xDC7E, 0x70, 0x78, 0x10, 0x25, 0xFB },
-  { "JSR $F81D                       ", 0xDC80, 0x00, 0x78, 0x10, 0x27, 0xFB },
-  { "BNE $F826                       ", 0xF81D, 0x00, 0x78, 0x10, 0x27, 0xF9 },
-  { "BVS $F826                       ", 0xF81F, 0x00, 0x78, 0x10, 0x27, 0xF9 },
-  { "BCC $F826                       ", 0xF821, 0x00, 0x78, 0x10, 0x27, 0xF9 },
-  { "BMI $F826                       ", 0xF823, 0x00, 0x78, 0x10, 0x27, 0xF9 },
-  { "RTS                             ", 0xF825, 0x00, 0x78, 0x10, 0x27, 0xF9 },
-  { "INY                             ", 0xDC83, 0x00, 0x78, 0x10, 0x27, 0xFB },
-  { "LDA #$69                        ", 0xDC84, 0x00, 0x78, 0x11, 0x25, 0xFB },
-  { "STA $78 = 70                    ", 0xDC86, 0x69, 0x78, 0x11, 0x25, 0xFB },
-  { "JSR $F829                       ", 0xDC88, 0x69, 0x78, 0x11, 0x25, 0xFB },
-  { "CLC                             ", 0xF829, 0x69, 0x78, 0x11, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF82A, 0x69, 0x78, 0x11, 0x24, 0xF9 },
-  { "LDA #$00                        ", 0xF82C, 0x69, 0x78, 0x11, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF82E, 0x00, 0x78, 0x11, 0x66, 0xF9 },
-  { "ADC $00,X @ 78 = 69             ", 0xDC8B, 0x00, 0x78, 0x11, 0x66, 0xFB },
-  { "JSR $F82F                       ", 0xDC8D, 0x69, 0x78, 0x11, 0x24, 0xFB },
-  { "BMI $F83A                       ", 0xF82F, 0x69, 0x78, 0x11, 0x24, 0xF9 },
-  { "BCS $F83A                       ", 0xF831, 0x69, 0x78, 0x11, 0x24, 0xF9 },
-  { "CMP #$69                        ", 0xF833, 0x69, 0x78, 0x11, 0x24, 0xF9 },
-  { "BNE $F83A                       ", 0xF835, 0x69, 0x78, 0x11, 0x27, 0xF9 },
-  { "BVS $F83A                       ", 0xF837, 0x69, 0x78, 0x11, 0x27, 0xF9 },
-  { "RTS                             ", 0xF839, 0x69, 0x78, 0x11, 0x27, 0xF9 },
-  { "INY                             ", 0xDC90, 0x69, 0x78, 0x11, 0x27, 0xFB },
-  { "JSR $F83D                       ", 0xDC91, 0x69, 0x78, 0x12, 0x25, 0xFB },
-  { "SEC                             ", 0xF83D, 0x69, 0x78, 0x12, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF83E, 0x69, 0x78, 0x12, 0x25, 0xF9 },
-  { "LDA #$00                        ", 0xF840, 0x69, 0x78, 0x12, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF842, 0x00, 0x78, 0x12, 0x67, 0xF9 },
-  { "ADC $00,X @ 78 = 69             ", 0xDC94, 0x00, 0x78, 0x12, 0x67, 0xFB },
-  { "JSR $F843                       ", 0xDC96, 0x6A, 0x78, 0x12, 0x24, 0xFB },
-  { "BMI $F84E                       ", 0xF843, 0x6A, 0x78, 0x12, 0x24, 0xF9 },
-  { "BCS $F84E                       ", 0xF845, 0x6A, 0x78, 0x12, 0x24, 0xF9 },
-  { "CMP #$6A                        ", 0xF847, 0x6A, 0x78, 0x12, 0x24, 0xF9 },
-  { "BNE $F84E                       ", 0xF849, 0x6A, 0x78, 0x12, 0x27, 0xF9 },
-  { "BVS $F84E                       ", 0xF84B, 0x6A, 0x78, 0x12, 0x27, 0xF9 },
-  { "RTS                             ", 0xF84D, 0x6A, 0x78, 0x12, 0x27, 0xF9 },
-  { "INY                             ", 0xDC99, 0x6A, 0x78, 0x12, 0x27, 0xFB },
-  { "LDA #$7F                        ", 0xDC9A, 0x6A, 0x78, 0x13, 0x25, 0xFB },
-  { "STA $78 = 69                    ", 0xDC9C, 0x7F, 0x78, 0x13, 0x25, 0xFB },
-  { "JSR $F851                       ", 0xDC9E, 0x7F, 0x78, 0x13, 0x25, 0xFB },
-  { "SEC                             ", 0xF851, 0x7F, 0x78, 0x13, 0x25, 0xF9 },
-  { "CLV                             ", 0xF852, 0x7F, 0x78, 0x13, 0x25, 0xF9 },
-  { "LDA #$7F                        ", 0xF853, 0x7F, 0x78, 0x13, 0x25, 0xF9 },
-  { "RTS                             ", 0xF855, 0x7F, 0x78, 0x13, 0x25, 0xF9 },
-  { "ADC $00,X @ 78 = 7F             ", 0xDCA1, 0x7F, 0x78, 0x13, 0x25, 0xFB },
-  { "JSR $F856                       ", 0xDCA3, 0xFF, 0x78, 0x13, 0xE4, 0xFB },
-  { "BPL $F861                       ", 0xF856, 0xFF, 0x78, 0x13, 0xE4, 0xF9 },
-  { "BCS $F861                       ", 0xF858, 0xFF, 0x78, 0x13, 0xE4, 0xF9 },
-  { "CMP #$FF                        ", 0xF85A, 0xFF, 0x78, 0x13, 0xE4, 0xF9 },
-  { "BNE $F861                       ", 0xF85C, 0xFF, 0x78, 0x13, 0x67, 0xF9 },
-  { "BVC $F861                       ", 0xF85E, 0xFF, 0x78, 0x13, 0x67, 0xF9 },
-  { "RTS                             ", 0xF860, 0xFF, 0x78, 0x13, 0x67, 0xF9 },
-  { "INY                             ", 0xDCA6, 0xFF, 0x78, 0x13, 0x67, 0xFB },
-  { "LDA #$80                        ", 0xDCA7, 0xFF, 0x78, 0x14, 0x65, 0xFB },
-  { "STA $78 = 7F                    ", 0xDCA9, 0x80, 0x78, 0x14, 0xE5, 0xFB },
-  { "JSR $F864                       ", 0xDCAB, 0x80, 0x78, 0x14, 0xE5, 0xFB },
-  { "CLC                             ", 0xF864, 0x80, 0x78, 0x14, 0xE5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF865, 0x80, 0x78, 0x14, 0xE4, 0xF9 },
-  { "LDA #$7F                        ", 0xF867, 0x80, 0x78, 0x14, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF869, 0x7F, 0x78, 0x14, 0x64, 0xF9 },
-  { "ADC $00,X @ 78 = 80             ", 0xDCAE, 0x7F, 0x78, 0x14, 0x64, 0xFB },
-  { "JSR $F86A                       ", 0xDCB0, 0xFF, 0x78, 0x14, 0xA4, 0xFB },
-  { "BPL $F875                       ", 0xF86A, 0xFF, 0x78, 0x14, 0xA4, 0xF9 },
-  { "BCS $F875                       ", 0xF86C, 0xFF, 0x78, 0x14, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF86E, 0xFF, 0x78, 0x14, 0xA4, 0xF9 },
-  { "BNE $F875                       ", 0xF870, 0xFF, 0x78, 0x14, 0x27, 0xF9 },
-  { "BVS $F875                       ", 0xF872, 0xFF, 0x78, 0x14, 0x27, 0xF9 },
-  { "RTS                             ", 0xF874, 0xFF, 0x78, 0x14, 0x27, 0xF9 },
-  { "INY                             ", 0xDCB3, 0xFF, 0x78, 0x14, 0x27, 0xFB },
-  { "JSR $F878                       ", 0xDCB4, 0xFF, 0x78, 0x15, 0x25, 0xFB },
-  { "SEC                             ", 0xF878, 0xFF, 0x78, 0x15, 0x25, 0xF9 },
-  { "CLV                             ", 0xF879, 0xFF, 0x78, 0x15, 0x25, 0xF9 },
-  { "LDA #$7F                        ", 0xF87A, 0xFF, 0x78, 0x15, 0x25, 0xF9 },
-  { "RTS                             ", 0xF87C, 0x7F, 0x78, 0x15, 0x25, 0xF9 },
-  { "ADC $00,X @ 78 = 80             ", 0xDCB7, 0x7F, 0x78, 0x15, 0x25, 0xFB },
-  { "JSR $F87D                       ", 0xDCB9, 0x00, 0x78, 0x15, 0x27, 0xFB },
-  { "BNE $F886                       ", 0xF87D, 0x00, 0x78, 0x15, 0x27, 0xF9 },
-  { "BMI $F886                       ", 0xF87F, 0x00, 0x78, 0x15, 0x27, 0xF9 },
-  { "BVS $F886                       ", 0xF881, 0x00, 0x78, 0x15, 0x27, 0xF9 },
-  { "BCC $F886                       ", 0xF883, 0x00, 0x78, 0x15, 0x27, 0xF9 },
-  { "RTS                             ", 0xF885, 0x00, 0x78, 0x15, 0x27, 0xF9 },
-  { "INY                             ", 0xDCBC, 0x00, 0x78, 0x15, 0x27, 0xFB },
-  { "LDA #$40                        ", 0xDCBD, 0x00, 0x78, 0x16, 0x25, 0xFB },
-  { "STA $78 = 80                    ", 0xDCBF, 0x40, 0x78, 0x16, 0x25, 0xFB },
-  { "JSR $F889                       ", 0xDCC1, 0x40, 0x78, 0x16, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF889, 0x40, 0x78, 0x16, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF88B, 0x40, 0x78, 0x16, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF88D, 0x40, 0x78, 0x16, 0x65, 0xF9 },
-  { "CMP $00,X @ 78 = 40             ", 0xDCC4, 0x40, 0x78, 0x16, 0x65, 0xFB },
-  { "JSR $F88E                       ", 0xDCC6, 0x40, 0x78, 0x16, 0x67, 0xFB },
-  { "BMI $F897                       ", 0xF88E, 0x40, 0x78, 0x16, 0x67, 0xF9 },
-  { "BCC $F897                       ", 0xF890, 0x40, 0x78, 0x16, 0x67, 0xF9 },
-  { "BNE $F897                       ", 0xF892, 0x40, 0x78, 0x16, 0x67, 0xF9 },
-  { "BVC $F897                       ", 0xF894, 0x40, 0x78, 0x16, 0x67, 0xF9 },
-  { "RTS                             ", 0xF896, 0x40, 0x78, 0x16, 0x67, 0xF9 },
-  { "INY                             ", 0xDCC9, 0x40, 0x78, 0x16, 0x67, 0xFB },
-  { "PHA                             ", 0xDCCA, 0x40, 0x78, 0x17, 0x65, 0xFB },
-  { "LDA #$3F                        ", 0xDCCB, 0x40, 0x78, 0x17, 0x65, 0xFA },
-  { "STA $78 = 40                    ", 0xDCCD, 0x3F, 0x78, 0x17, 0x65, 0xFA },
-  { "PLA                             ", 0xDCCF, 0x3F, 0x78, 0x17, 0x65, 0xFA },
-  { "JSR $F89A                       ", 0xDCD0, 0x40, 0x78, 0x17, 0x65, 0xFB },
-  { "CLV                             ", 0xF89A, 0x40, 0x78, 0x17, 0x65, 0xF9 },
-  { "RTS                             ", 0xF89B, 0x40, 0x78, 0x17, 0x25, 0xF9 },
-  { "CMP $00,X @ 78 = 3F             ", 0xDCD3, 0x40, 0x78, 0x17, 0x25, 0xFB },
-  { "JSR $F89C                       ", 0xDCD5, 0x40, 0x78, 0x17, 0x25, 0xFB },
-  { "BEQ $F8A5                       ", 0xF89C, 0x40, 0x78, 0x17, 0x25, 0xF9 },
-  { "BMI $F8A5                       ", 0xF89E, 0x40, 0x78, 0x17, 0x25, 0xF9 },
-  { "BCC $F8A5                       ", 0xF8A0, 0x40, 0x78, 0x17, 0x25, 0xF9 },
-  { "BVS $F8A5                       ", 0xF8A2, 0x40, 0x78, 0x17, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8A4, 0x40, 0x78, 0x17, 0x25, 0xF9 },
-  { "INY                             ", 0xDCD8, 0x40, 0x78, 0x17, 0x25, 0xFB },
-  { "PHA                             ", 0xDCD9, 0x40, 0x78, 0x18, 0x25, 0xFB },
-  { "LDA #$41                        ", 0xDCDA, 0x40, 0x78, 0x18, 0x25, 0xFA },
-  { "STA $78 = 3F                    ", 0xDCDC, 0x41, 0x78, 0x18, 0x25, 0xFA },
-  { "PLA                             ", 0xDCDE, 0x41, 0x78, 0x18, 0x25, 0xFA },
-  { "CMP $00,X @ 78 = 41             ", 0xDCDF, 0x40, 0x78, 0x18, 0x25, 0xFB },
-  { "JSR $F8A8                       ", 0xDCE1, 0x40, 0x78, 0x18, 0xA4, 0xFB },
-  { "BEQ $F8AF                       ", 0xF8A8, 0x40, 0x78, 0x18, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AA, 0x40, 0x78, 0x18, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AC, 0x40, 0x78, 0x18, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8AE, 0x40, 0x78, 0x18, 0xA4, 0xF9 },
-  { "INY                             ", 0xDCE4, 0x40, 0x78, 0x18, 0xA4, 0xFB },
-  { "PHA                             ", 0xDCE5, 0x40, 0x78, 0x19, 0x24, 0xFB },
-  { "LDA #$00                        ", 0xDCE6, 0x40, 0x78, 0x19, 0x24, 0xFA },
-  { "STA $78 = 41                    ", 0xDCE8, 0x00, 0x78, 0x19, 0x26, 0xFA },
-  { "PLA                             ", 0xDCEA, 0x00, 0x78, 0x19, 0x26, 0xFA },
-  { "JSR $F8B2                       ", 0xDCEB, 0x40, 0x78, 0x19, 0x24, 0xFB },
-  { "LDA #$80                        ", 0xF8B2, 0x40, 0x78, 0x19, 0x24, 0xF9 },
-  { "RTS                             ", 0xF8B4, 0x80, 0x78, 0x19, 0xA4, 0xF9 },
-  { "CMP $00,X @ 78 = 00             ", 0xDCEE, 0x80, 0x78, 0x19, 0xA4, 0xFB },
-  { "JSR $F8B5                       ", 0xDCF0, 0x80, 0x78, 0x19, 0xA5, 0xFB },
-  { "BEQ $F8BC                       ", 0xF8B5, 0x80, 0x78, 0x19, 0xA5, 0xF9 },
-  { "BPL $F8BC                       ", 0xF8B7, 0x80, 0x78, 0x19, 0xA5, 0xF9 },
-  { "BCC $F8BC                       ", 0xF8B9, 0x80, 0x78, 0x19, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF8BB, 0x80, 0x78, 0x19, 0xA5, 0xF9 },
-  { "INY                             ", 0xDCF3, 0x80, 0x78, 0x19, 0xA5, 0xFB },
-  { "PHA                             ", 0xDCF4, 0x80, 0x78, 0x1A, 0x25, 0xFB },
-  { "LDA #$80                        ", 0xDCF5, 0x80, 0x78, 0x1A, 0x25, 0xFA },
-  { "STA $78 = 00                    ", 0xDCF7, 0x80, 0x78, 0x1A, 0xA5, 0xFA },
-  { "PLA                             ", 0xDCF9, 0x80, 0x78, 0x1A, 0xA5, 0xFA },
-  { "CMP $00,X @ 78 = 80             ", 0xDCFA, 0x80, 0x78, 0x1A, 0xA5, 0xFB },
-  { "JSR $F8BF                       ", 0xDCFC, 0x80, 0x78, 0x1A, 0x27, 0xFB },
-  { "BNE $F8C6                       ", 0xF8BF, 0x80, 0x78, 0x1A, 0x27, 0xF9 },
-  { "BMI $F8C6                       ", 0xF8C1, 0x80, 0x78, 0x1A, 0x27, 0xF9 },
-  { "BCC $F8C6                       ", 0xF8C3, 0x80, 0x78, 0x1A, 0x27, 0xF9 },
-  { "RTS                             ", 0xF8C5, 0x80, 0x78, 0x1A, 0x27, 0xF9 },
-  { "INY                             ", 0xDCFF, 0x80, 0x78, 0x1A, 0x27, 0xFB },
-  { "PHA                             ", 0xDD00, 0x80, 0x78, 0x1B, 0x25, 0xFB },
-  { "LDA #$81                        ", 0xDD01, 0x80, 0x78, 0x1B, 0x25, 0xFA },
-  { "STA $78 = 80                    ", 0xDD03, 0x81, 0x78, 0x1B, 0xA5, 0xFA },
-  { "PLA                             ", 0xDD05, 0x81, 0x78, 0x1B, 0xA5, 0xFA },
-  { "CMP $00,X @ 78 = 81             ", 0xDD06, 0x80, 0x78, 0x1B, 0xA5, 0xFB },
-  { "JSR $F8C9                       ", 0xDD08, 0x80, 0x78, 0x1B, 0xA4, 0xFB },
-  { "BCS $F8D0                       ", 0xF8C9, 0x80, 0x78, 0x1B, 0xA4, 0xF9 },
-  { "BEQ $F8D0                       ", 0xF8CB, 0x80, 0x78, 0x1B, 0xA4, 0xF9 },
-  { "BPL $F8D0                       ", 0xF8CD, 0x80, 0x78, 0x1B, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8CF, 0x80, 0x78, 0x1B, 0xA4, 0xF9 },
-  { "INY                             ", 0xDD0B, 0x80, 0x78, 0x1B, 0xA4, 0xFB },
-  { "PHA                             ", 0xDD0C, 0x80, 0x78, 0x1C, 0x24, 0xFB },
-  { "LDA #$7F                        ", 0xDD0D, 0x80, 0x78, 0x1C, 0x24, 0xFA },
-  { "STA $78 = 81                    ", 0xDD0F, 0x7F, 0x78, 0x1C, 0x24, 0xFA },
-  { "PLA                             ", 0xDD11, 0x7F, 0x78, 0x1C, 0x24, 0xFA },
-  { "CMP $00,X @ 78 = 7F             ", 0xDD12, 0x80, 0x78, 0x1C, 0xA4, 0xFB },
-  { "JSR $F8D3                       ", 0xDD14, 0x80, 0x78, 0x1C, 0x25, 0xFB },
-  { "BCC $F8DA                       ", 0xF8D3, 0x80, 0x78, 0x1C, 0x25, 0xF9 },
-  { "BEQ $F8DA                       ", 0xF8D5, 0x80, 0x78, 0x1C, 0x25, 0xF9 },
-  { "BMI $F8DA                       ", 0xF8D7, 0x80, 0x78, 0x1C, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8D9, 0x80, 0x78, 0x1C, 0x25, 0xF9 },
-  { "INY                             ", 0xDD17, 0x80, 0x78, 0x1C, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xDD18, 0x80, 0x78, 0x1D, 0x25, 0xFB },
-  { "STA $78 = 7F                    ", 0xDD1A, 0x40, 0x78, 0x1D, 0x25, 0xFB },
-  { "JSR $F931                       ", 0xDD1C, 0x40, 0x78, 0x1D, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF931, 0x40, 0x78, 0x1D, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF933, 0x40, 0x78, 0x1D, 0xE5, 0xF9 },
-  { "SEC                             ", 0xF935, 0x40, 0x78, 0x1D, 0x65, 0xF9 },
-  { "RTS                             ", 0xF936, 0x40, 0x78, 0x1D, 0x65, 0xF9 },
-  { "SBC $00,X @ 78 = 40             ", 0xDD1F, 0x40, 0x78, 0x1D, 0x65, 0xFB },
-  { "JSR $F937                       ", 0xDD21, 0x00, 0x78, 0x1D, 0x27, 0xFB },
-  { "BMI $F944                       ", 0xF937, 0x00, 0x78, 0x1D, 0x27, 0xF9 },
-  { "BCC $F944                       ", 0xF939, 0x00, 0x78, 0x1D, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF93B, 0x00, 0x78, 0x1D, 0x27, 0xF9 },
-  { "BVS $F944                       ", 0xF93D, 0x00, 0x78, 0x1D, 0x27, 0xF9 },
-  { "CMP #$00                        ", 0xF93F, 0x00, 0x78, 0x1D, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF941, 0x00, 0x78, 0x1D, 0x27, 0xF9 },
-  { "RTS                             ", 0xF943, 0x00, 0x78, 0x1D, 0x27, 0xF9 },
-  { "INY                             ", 0xDD24, 0x00, 0x78, 0x1D, 0x27, 0xFB },
-  { "LDA #$3F                        ", 0xDD25, 0x00, 0x78, 0x1E, 0x25, 0xFB },
-  { "STA $78 = 40                    ", 0xDD27, 0x3F, 0x78, 0x1E, 0x25, 0xFB },
-  { "JSR $F947                       ", 0xDD29, 0x3F, 0x78, 0x1E, 0x25, 0xFB },
-  { "CLV                             ", 0xF947, 0x3F, 0x78, 0x1E, 0x25, 0xF9 },
-  { "SEC                             ", 0xF948, 0x3F, 0x78, 0x1E, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF949, 0x3F, 0x78, 0x1E, 0x25, 0xF9 },
-  { "RTS                             ", 0xF94B, 0x40, 0x78, 0x1E, 0x25, 0xF9 },
-  { "SBC $00,X @ 78 = 3F             ", 0xDD2C, 0x40, 0x78, 0x1E, 0x25, 0xFB },
-  { "JSR $F94C                       ", 0xDD2E, 0x01, 0x78, 0x1E, 0x25, 0xFB },
-  { "BEQ $F959                       ", 0xF94C, 0x01, 0x78, 0x1E, 0x25, 0xF9 },
-  { "BMI $F959                       ", 0xF94E, 0x01, 0x78, 0x1E, 0x25, 0xF9 },
-  { "BCC $F959                       ", 0xF950, 0x01, 0x78, 0x1E, 0x25, 0xF9 },
-  { "BVS $F959                       ", 0xF952, 0x01, 0x78, 0x1E, 0x25, 0xF9 },
-  { "CMP #$01                        ", 0xF954, 0x01, 0x78, 0x1E, 0x25, 0xF9 },
-  { "BNE $F959                       ", 0xF956, 0x01, 0x78, 0x1E, 0x27, 0xF9 },
-  { "RTS                             ", 0xF958, 0x01, 0x78, 0x1E, 0x27, 0xF9 },
-  { "INY                             ", 0xDD31, 0x01, 0x78, 0x1E, 0x27, 0xFB },
-  { "LDA #$41                        ", 0xDD32, 0x01, 0x78, 0x1F, 0x25, 0xFB },
-  { "STA $78 = 3F                    ", 0xDD34, 0x41, 0x78, 0x1F, 0x25, 0xFB },
-  { "JSR $F95C                       ", 0xDD36, 0x41, 0x78, 0x1F, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xF95C, 0x41, 0x78, 0x1F, 0x25, 0xF9 },
-  { "SEC                             ", 0xF95E, 0x40, 0x78, 0x1F, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF95F, 0x40, 0x78, 0x1F, 0x25, 0xF9 },
-  { "RTS                             ", 0xF961, 0x40, 0x78, 0x1F, 0xE5, 0xF9 },
-  { "SBC $00,X @ 78 = 41             ", 0xDD39, 0x40, 0x78, 0x1F, 0xE5, 0xFB },
-  { "JSR $F962                       ", 0xDD3B, 0xFF, 0x78, 0x1F, 0xA4, 0xFB },
-  { "BCS $F96F                       ", 0xF962, 0xFF, 0x78, 0x1F, 0xA4, 0xF9 },
-  { "BEQ $F96F                       ", 0xF964, 0xFF, 0x78, 0x1F, 0xA4, 0xF9 },
-  { "BPL $F96F                       ", 0xF966, 0xFF, 0x78, 0x1F, 0xA4, 0xF9 },
-  { "BVS $F96F                       ", 0xF968, 0xFF, 0x78, 0x1F, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF96A, 0xFF, 0x78, 0x1F, 0xA4, 0xF9 },
-  { "BNE $F96F                       ", 0xF96C, 0xFF, 0x78, 0x1F, 0x27, 0xF9 },
-  { "RTS                             ", 0xF96E, 0xFF, 0x78, 0x1F, 0x27, 0xF9 },
-  { "INY                             ", 0xDD3E, 0xFF, 0x78, 0x1F, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xDD3F, 0xFF, 0x78, 0x20, 0x25, 0xFB },
-  { "STA $78 = 41                    ", 0xDD41, 0x00, 0x78, 0x20, 0x27, 0xFB },
-  { "JSR $F972                       ", 0xDD43, 0x00, 0x78, 0x20, 0x27, 0xFB },
-  { "CLC                             ", 0xF972, 0x00, 0x78, 0x20, 0x27, 0xF9 },
-  { "LDA #$80                        ", 0xF973, 0x00, 0x78, 0x20, 0x26, 0xF9 },
-  { "RTS                             ", 0xF975, 0x80, 0x78, 0x20, 0xA4, 0xF9 },
-  { "SBC $00,X @ 78 = 00             ", 0xDD46, 0x80, 0x78, 0x20, 0xA4, 0xFB },
-  { "JSR $F976                       ", 0xDD48, 0x7F, 0x78, 0x20, 0x65, 0xFB },
-  { "BCC $F97D                       ", 0xF976, 0x7F, 0x78, 0x20, 0x65, 0xF9 },
-  { "CMP #$7F                        ", 0xF978, 0x7F, 0x78, 0x20, 0x65, 0xF9 },
-  { "BNE $F97D                       ", 0xF97A, 0x7F, 0x78, 0x20, 0x67, 0xF9 },
-  { "RTS                             ", 0xF97C, 0x7F, 0x78, 0x20, 0x67, 0xF9 },
-  { "INY                             ", 0xDD4B, 0x7F, 0x78, 0x20, 0x67, 0xFB },
-  { "LDA #$7F                        ", 0xDD4C, 0x7F, 0x78, 0x21, 0x65, 0xFB },
-  { "STA $78 = 00                    ", 0xDD4E, 0x7F, 0x78, 0x21, 0x65, 0xFB },
-  { "JSR $F980                       ", 0xDD50, 0x7F, 0x78, 0x21, 0x65, 0xFB },
-  { "SEC                             ", 0xF980, 0x7F, 0x78, 0x21, 0x65, 0xF9 },
-  { "LDA #$81                        ", 0xF981, 0x7F, 0x78, 0x21, 0x65, 0xF9 },
-  { "RTS                             ", 0xF983, 0x81, 0x78, 0x21, 0xE5, 0xF9 },
-  { "SBC $00,X @ 78 = 7F             ", 0xDD53, 0x81, 0x78, 0x21, 0xE5, 0xFB },
-  { "JSR $F984                       ", 0xDD55, 0x02, 0x78, 0x21, 0x65, 0xFB },
-  { "BVC $F98D                       ", 0xF984, 0x02, 0x78, 0x21, 0x65, 0xF9 },
-  { "BCC $F98D                       ", 0xF986, 0x02, 0x78, 0x21, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xF988, 0x02, 0x78, 0x21, 0x65, 0xF9 },
-  { "BNE $F98D                       ", 0xF98A, 0x02, 0x78, 0x21, 0x67, 0xF9 },
-  { "RTS                             ", 0xF98C, 0x02, 0x78, 0x21, 0x67, 0xF9 },
-  { "LDA #$AA                        ", 0xDD58, 0x02, 0x78, 0x21, 0x67, 0xFB },
-  { "STA $33 = 44                    ", 0xDD5A, 0xAA, 0x78, 0x21, 0xE5, 0xFB },
-  { "LDA #$BB                        ", 0xDD5C, 0xAA, 0x78, 0x21, 0xE5, 0xFB },
-  { "STA $89 = BB                    ", 0xDD5E, 0xBB, 0x78, 0x21, 0xE5, 0xFB },
-  { "LDX #$00                        ", 0xDD60, 0xBB, 0x78, 0x21, 0xE5, 0xFB },
-  { "LDY #$66                        ", 0xDD62, 0xBB, 0x00, 0x21, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xDD64, 0xBB, 0x00, 0x66, 0x65, 0xFB },
-  { "SEC                             ", 0xDD66, 0xBB, 0x00, 0x66, 0xE5, 0xFB },
-  { "LDA #$00                        ", 0xDD67, 0xBB, 0x00, 0x66, 0xE5, 0xFB },
-  { "LDA $33,X @ 33 = AA             ", 0xDD69, 0x00, 0x00, 0x66, 0x67, 0xFB },
-  { "BPL $DD7F                       ", 0xDD6B, 0xAA, 0x00, 0x66, 0xE5, 0xFB },
-  { "BEQ $DD7F                       ", 0xDD6D, 0xAA, 0x00, 0x66, 0xE5, 0xFB },
-  { "BVC $DD7F                       ", 0xDD6F, 0xAA, 0x00, 0x66, 0xE5, 0xFB },
-  { "BCC $DD7F                       ", 0xDD71, 0xAA, 0x00, 0x66, 0xE5, 0xFB },
-  { "CPY #$66                        ", 0xDD73, 0xAA, 0x00, 0x66, 0xE5, 0xFB },
-  { "BNE $DD7F                       ", 0xDD75, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "CPX #$00                        ", 0xDD77, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "BNE $DD7F                       ", 0xDD79, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "CMP #$AA                        ", 0xDD7B, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "BEQ $DD83                       ", 0xDD7D, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "LDX #$8A                        ", 0xDD83, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "LDY #$66                        ", 0xDD85, 0xAA, 0x8A, 0x66, 0xE5, 0xFB },
-  { "CLV                             ", 0xDD87, 0xAA, 0x8A, 0x66, 0x65, 0xFB },
-  { "CLC                             ", 0xDD88, 0xAA, 0x8A, 0x66, 0x25, 0xFB },
-  { "LDA #$00                        ", 0xDD89, 0xAA, 0x8A, 0x66, 0x24, 0xFB },
-  { "LDA $FF,X @ 89 = BB             ", 0xDD8B, 0x00, 0x8A, 0x66, 0x26, 0xFB },
-  { "BPL $DDA1                       ", 0xDD8D, 0xBB, 0x8A, 0x66, 0xA4, 0xFB },
-  { "BEQ $DDA1                       ", 0xDD8F, 0xBB, 0x8A, 0x66, 0xA4, 0xFB },
-  { "BVS $DDA1                       ", 0xDD91, 0xBB, 0x8A, 0x66, 0xA4, 0xFB },
-  { "BCS $DDA1                       ", 0xDD93, 0xBB, 0x8A, 0x66, 0xA4, 0xFB },
-  { "CMP #$BB                        ", 0xDD95, 0xBB, 0x8A, 0x66, 0xA4, 0xFB },
-  { "BNE $DDA1                       ", 0xDD97, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "CPY #$66                        ", 0xDD99, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "BNE $DDA1                       ", 0xDD9B, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "CPX #$8A                        ", 0xDD9D, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "BEQ $DDA5                       ", 0xDD9F, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xDDA5, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "SEC                             ", 0xDDA7, 0xBB, 0x8A, 0x66, 0xE5, 0xFB },
-  { "LDA #$44                        ", 0xDDA8, 0xBB, 0x8A, 0x66, 0xE5, 0xFB },
-  { "LDX #$00                        ", 0xDDAA, 0x44, 0x8A, 0x66, 0x65, 0xFB },
-  { "STA $33,X @ 33 = AA             ", 0xDDAC, 0x44, 0x00, 0x66, 0x67, 0xFB },
-  { "LDA $33 = 44                    ", 0xDDAE, 0x44, 0x00, 0x66, 0x67, 0xFB },
-  { "BCC $DDCA                       ", 0xDDB0, 0x44, 0x00, 0x66, 0x65, 0xFB },
-  { "CMP #$44                        ", 0xDDB2, 0x44, 0x00, 0x66, 0x65, 0xFB },
-  { "BNE $DDCA                       ", 0xDDB4, 0x44, 0x00, 0x66, 0x67, 0xFB },
-  { "BVC $DDCA                       ", 0xDDB6, 0x44, 0x00, 0x66, 0x67, 0xFB },
-  { "CLC                             ", 0xDDB8, 0x44, 0x00, 0x66, 0x67, 0xFB },
-  { "CLV                             ", 0xDDB9, 0x44, 0x00, 0x66, 0x66, 0xFB },
-  { "LDA #$99                        ", 0xDDBA, 0x44, 0x00, 0x66, 0x26, 0xFB },
-  { "LDX #$80                        ", 0xDDBC, 0x99, 0x00, 0x66, 0xA4, 0xFB },
-  { "STA $85,X @ 05 = 99             ", 0xDDBE, 0x99, 0x80, 0x66, 0xA4, 0xFB },
-  { "LDA $05 = 99                    ", 0xDDC0, 0x99, 0x80, 0x66, 0xA4, 0xFB },
-  { "BCS $DDCA                       ", 0xDDC2, 0x99, 0x80, 0x66, 0xA4, 0xFB },
-  { "CMP #$99                        ", 0xDDC4, 0x99, 0x80, 0x66, 0xA4, 0xFB },
-  { "BNE $DDCA                       ", 0xDDC6, 0x99, 0x80, 0x66, 0x27, 0xFB },
-  { "BVC $DDCE                       ", 0xDDC8, 0x99, 0x80, 0x66, 0x27, 0xFB },
-  { "LDY #$25                        ", 0xDDCE, 0x99, 0x80, 0x66, 0x27, 0xFB },
-  { "LDX #$78                        ", 0xDDD0, 0x99, 0x80, 0x25, 0x25, 0xFB },
-  { "JSR $F990                       ", 0xDDD2, 0x99, 0x78, 0x25, 0x25, 0xFB },
-  { "LDX #$55                        ", 0xF990, 0x99, 0x78, 0x25, 0x25, 0xF9 },
-  { "LDA #$FF                        ", 0xF992, 0x99, 0x55, 0x25, 0x25, 0xF9 },
-  { "STA $01 = FF                    ", 0xF994, 0xFF, 0x55, 0x25, 0xA5, 0xF9 },
-  { "NOP                             ", 0xF996, 0xFF, 0x55, 0x25, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF997, 0xFF, 0x55, 0x25, 0xA5, 0xF9 },
-  { "SEC                             ", 0xF999, 0xFF, 0x55, 0x25, 0xE5, 0xF9 },
-  { "LDA #$01                        ", 0xF99A, 0xFF, 0x55, 0x25, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF99C, 0x01, 0x55, 0x25, 0x65, 0xF9 },
-  { "STA $00,X @ 55 = 00             ", 0xDDD5, 0x01, 0x55, 0x25, 0x65, 0xFB },
-  { "LSR $00,X @ 55 = 01             ", 0xDDD7, 0x01, 0x55, 0x25, 0x65, 0xFB },
-  { "LDA $00,X @ 55 = 00             ", 0xDDD9, 0x01, 0x55, 0x25, 0x67, 0xFB },
-  { "JSR $F99D                       ", 0xDDDB, 0x00, 0x55, 0x25, 0x67, 0xFB },
-  { "BCC $F9BA                       ", 0xF99D, 0x00, 0x55, 0x25, 0x67, 0xF9 },
-  { "BNE $F9BA                       ", 0xF99F, 0x00, 0x55, 0x25, 0x67, 0xF9 },
-  { "BMI $F9BA                       ", 0xF9A1, 0x00, 0x55, 0x25, 0x67, 0xF9 },
-  { "BVC $F9BA                       ", 0xF9A3, 0x00, 0x55, 0x25, 0x67, 0xF9 },
-  { "CMP #$00                        ", 0xF9A5, 0x00, 0x55, 0x25, 0x67, 0xF9 },
-  { "BNE $F9BA                       ", 0xF9A7, 0x00, 0x55, 0x25, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9A9, 0x00, 0x55, 0x25, 0x67, 0xF9 },
-  { "LDA #$AA                        ", 0xF9AA, 0x00, 0x55, 0x25, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9AC, 0xAA, 0x55, 0x25, 0xA5, 0xF9 },
-  { "INY                             ", 0xDDDE, 0xAA, 0x55, 0x25, 0xA5, 0xFB },
-  { "STA $00,X @ 55 = 00             ", 0xDDDF, 0xAA, 0x55, 0x26, 0x25, 0xFB },
-  { "LSR $00,X @ 55 = AA             ", 0xDDE1, 0xAA, 0x55, 0x26, 0x25, 0xFB },
-  { "LDA $00,X @ 55 = 55             ", 0xDDE3, 0xAA, 0x55, 0x26, 0x24, 0xFB },
-  { "JSR $F9AD                       ", 0xDDE5, 0x55, 0x55, 0x26, 0x24, 0xFB },
-  { "BCS $F9BA                       ", 0xF9AD, 0x55, 0x55, 0x26, 0x24, 0xF9 },
-  { "BEQ $F9BA                       ", 0xF9AF, 0x55, 0x55, 0x26, 0x24, 0xF9 },
-  { "BMI $F9BA                       ", 0xF9B1, 0x55, 0x55, 0x26, 0x24, 0xF9 },
-  { "BVS $F9BA                       ", 0xF9B3, 0x55, 0x55, 0x26, 0x24, 0xF9 },
-  { "CMP #$55                        ", 0xF9B5, 0x55, 0x55, 0x26, 0x24, 0xF9 },
-  { "BNE $F9BA                       ", 0xF9B7, 0x55, 0x55, 0x26, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9B9, 0x55, 0x55, 0x26, 0x27, 0xF9 },
-  { "INY                             ", 0xDDE8, 0x55, 0x55, 0x26, 0x27, 0xFB },
-  { "JSR $F9BD                       ", 0xDDE9, 0x55, 0x55, 0x27, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF9BD, 0x55, 0x55, 0x27, 0x25, 0xF9 },
-  { "SEC                             ", 0xF9BF, 0x55, 0x55, 0x27, 0xE5, 0xF9 },
-  { "LDA #$80                        ", 0xF9C0, 0x55, 0x55, 0x27, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF9C2, 0x80, 0x55, 0x27, 0xE5, 0xF9 },
-  { "STA $00,X @ 55 = 55             ", 0xDDEC, 0x80, 0x55, 0x27, 0xE5, 0xFB },
-  { "ASL $00,X @ 55 = 80             ", 0xDDEE, 0x80, 0x55, 0x27, 0xE5, 0xFB },
-  { "LDA $00,X @ 55 = 00             ", 0xDDF0, 0x80, 0x55, 0x27, 0x67, 0xFB },
-  { "JSR $F9C3                       ", 0xDDF2, 0x00, 0x55, 0x27, 0x67, 0xFB },
-  { "BCC $F9E1                       ", 0xF9C3, 0x00, 0x55, 0x27, 0x67, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9C5, 0x00, 0x55, 0x27, 0x67, 0xF9 },
-  { "BMI $F9E1                       ", 0xF9C7, 0x00, 0x55, 0x27, 0x67, 0xF9 },
-  { "BVC $F9E1                       ", 0xF9C9, 0x00, 0x55, 0x27, 0x67, 0xF9 },
-  { "CMP #$00                        ", 0xF9CB, 0x00, 0x55, 0x27, 0x67, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9CD, 0x00, 0x55, 0x27, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9CF, 0x00, 0x55, 0x27, 0x67, 0xF9 },
-  { "LDA #$55                        ", 0xF9D0, 0x00, 0x55, 0x27, 0x27, 0xF9 },
-  { "SEC                             ", 0xF9D2, 0x55, 0x55, 0x27, 0x25, 0xF9 },
-  { "RTS                             ", 0xF9D3, 0x55, 0x55, 0x27, 0x25, 0xF9 },
-  { "INY                             ", 0xDDF5, 0x55, 0x55, 0x27, 0x25, 0xFB },
-  { "STA $00,X @ 55 = 00             ", 0xDDF6, 0x55, 0x55, 0x28, 0x25, 0xFB },
-  { "ASL $00,X @ 55 = 55             ", 0xDDF8, 0x55, 0x55, 0x28, 0x25, 0xFB },
-  { "LDA $00,X @ 55 = AA             ", 0xDDFA, 0x55, 0x55, 0x28, 0xA4, 0xFB },
-  { "JSR $F9D4                       ", 0xDDFC, 0xAA, 0x55, 0x28, 0xA4, 0xFB },
-  { "BCS $F9E1                       ", 0xF9D4, 0xAA, 0x55, 0x28, 0xA4, 0xF9 },
-  { "BEQ $F9E1                       ", 0xF9D6, 0xAA, 0x55, 0x28, 0xA4, 0xF9 },
-  { "BPL $F9E1                       ", 0xF9D8, 0xAA, 0x55, 0x28, 0xA4, 0xF9 },
-  { "BVS $F9E1                       ", 0xF9DA, 0xAA, 0x55, 0x28, 0xA4, 0xF9 },
-  { "CMP #$AA                        ", 0xF9DC, 0xAA, 0x55, 0x28, 0xA4, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9DE, 0xAA, 0x55, 0x28, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9E0, 0xAA, 0x55, 0x28, 0x27, 0xF9 },
-  { "INY                             ", 0xDDFF, 0xAA, 0x55, 0x28, 0x27, 0xFB },
-  { "JSR $F9E4                       ", 0xDE00, 0xAA, 0x55, 0x29, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF9E4, 0xAA, 0x55, 0x29, 0x25, 0xF9 },
-  { "SEC                             ", 0xF9E6, 0xAA, 0x55, 0x29, 0xE5, 0xF9 },
-  { "LDA #$01                        ", 0xF9E7, 0xAA, 0x55, 0x29, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF9E9, 0x01, 0x55, 0x29, 0x65, 0xF9 },
-  { "STA $00,X @ 55 = AA             ", 0xDE03, 0x01, 0x55, 0x29, 0x65, 0xFB },
-  { "ROR $00,X @ 55 = 01             ", 0xDE05, 0x01, 0x55, 0x29, 0x65, 0xFB },
-  { "LDA $00,X @ 55 = 80             ", 0xDE07, 0x01, 0x55, 0x29, 0xE5, 0xFB },
-  { "JSR $F9EA                       ", 0xDE09, 0x80, 0x55, 0x29, 0xE5, 0xFB },
-  { "BCC $FA08                       ", 0xF9EA, 0x80, 0x55, 0x29, 0xE5, 0xF9 },
-  { "BEQ $FA08                       ", 0xF9EC, 0x80, 0x55, 0x29, 0xE5, 0xF9 },
-  { "BPL $FA08                       ", 0xF9EE, 0x80, 0x55, 0x29, 0xE5, 0xF9 },
-  { "BVC $FA08                       ", 0xF9F0, 0x80, 0x55, 0x29, 0xE5, 0xF9 },
-  { "CMP #$80                        ", 0xF9F2, 0x80, 0x55, 0x29, 0xE5, 0xF9 },
-  { "BNE $FA08                       ", 0xF9F4, 0x80, 0x55, 0x29, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9F6, 0x80, 0x55, 0x29, 0x67, 0xF9 },
-  { "CLC                             ", 0xF9F7, 0x80, 0x55, 0x29, 0x27, 0xF9 },
-  { "LDA #$55                        ", 0xF9F8, 0x80, 0x55, 0x29, 0x26, 0xF9 },
-  { "RTS                             ", 0xF9FA, 0x55, 0x55, 0x29, 0x24, 0xF9 },
-  { "INY                             ", 0xDE0C, 0x55, 0x55, 0x29, 0x24, 0xFB },
-  { "STA $00,X @ 55 = 80             ", 0xDE0D, 0x55, 0x55, 0x2A, 0x24, 0xFB },
-  { "ROR $00,X @ 55 = 55             ", 0xDE0F, 0x55, 0x55, 0x2A, 0x24, 0xFB },
-  { "LDA $00,X @ 55 = 2A             ", 0xDE11, 0x55, 0x55, 0x2A, 0x25, 0xFB },
-  { "JSR $F9FB                       ", 0xDE13, 0x2A, 0x55, 0x2A, 0x25, 0xFB },
-  { "BCC $FA08                       ", 0xF9FB, 0x2A, 0x55, 0x2A, 0x25, 0xF9 },
-  { "BEQ $FA08                       ", 0xF9FD, 0x2A, 0x55, 0x2A, 0x25, 0xF9 },
-  { "BMI $FA08                       ", 0xF9FF, 0x2A, 0x55, 0x2A, 0x25, 0xF9 },
-  { "BVS $FA08                       ", 0xFA01, 0x2A, 0x55, 0x2A, 0x25, 0xF9 },
-  { "CMP #$2A                        ", 0xFA03, 0x2A, 0x55, 0x2A, 0x25, 0xF9 },
-  { "BNE $FA08                       ", 0xFA05, 0x2A, 0x55, 0x2A, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA07, 0x2A, 0x55, 0x2A, 0x27, 0xF9 },
-  { "INY                             ", 0xDE16, 0x2A, 0x55, 0x2A, 0x27, 0xFB },
-  { "JSR $FA0A                       ", 0xDE17, 0x2A, 0x55, 0x2B, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA0A, 0x2A, 0x55, 0x2B, 0x25, 0xF9 },
-  { "SEC                             ", 0xFA0C, 0x2A, 0x55, 0x2B, 0xE5, 0xF9 },
-  { "LDA #$80                        ", 0xFA0D, 0x2A, 0x55, 0x2B, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA0F, 0x80, 0x55, 0x2B, 0xE5, 0xF9 },
-  { "STA $00,X @ 55 = 2A             ", 0xDE1A, 0x80, 0x55, 0x2B, 0xE5, 0xFB },
-  { "ROL $00,X @ 55 = 80             ", 0xDE1C, 0x80, 0x55, 0x2B, 0xE5, 0xFB },
-  { "LDA $00,X @ 55 = 01             ", 0xDE1E, 0x80, 0x55, 0x2B, 0x65, 0xFB },
-  { "JSR $FA10                       ", 0xDE20, 0x01, 0x55, 0x2B, 0x65, 0xFB },
-  { "BCC $FA2E                       ", 0xFA10, 0x01, 0x55, 0x2B, 0x65, 0xF9 },
-  { "BEQ $FA2E                       ", 0xFA12, 0x01, 0x55, 0x2B, 0x65, 0xF9 },
-  { "BMI $FA2E                       ", 0xFA14, 0x01, 0x55, 0x2B, 0x65, 0xF9 },
-  { "BVC $FA2E                       ", 0xFA16, 0x01, 0x55, 0x2B, 0x65, 0xF9 },
-  { "CMP #$01                        ", 0xFA18, 0x01, 0x55, 0x2B, 0x65, 0xF9 },
-  { "BNE $FA2E                       ", 0xFA1A, 0x01, 0x55, 0x2B, 0x67, 0xF9 },
-  { "CLV                             ", 0xFA1C, 0x01, 0x55, 0x2B, 0x67, 0xF9 },
-  { "CLC                             ", 0xFA1D, 0x01, 0x55, 0x2B, 0x27, 0xF9 },
-  { "LDA #$55                        ", 0xFA1E, 0x01, 0x55, 0x2B, 0x26, 0xF9 },
-  { "RTS                             ", 0xFA20, 0x55, 0x55, 0x2B, 0x24, 0xF9 },
-  { "INY                             ", 0xDE23, 0x55, 0x55, 0x2B, 0x24, 0xFB },
-  { "STA $00,X @ 55 = 01             ", 0xDE24, 0x55, 0x55, 0x2C, 0x24, 0xFB },
-  { "ROL $00,X @ 55 = 55             ", 0xDE26, 0x55, 0x55, 0x2C, 0x24, 0xFB },
-  { "LDA $00,X @ 55 = AA             ", 0xDE28, 0x55, 0x55, 0x2C, 0xA4, 0xFB },
-  { "JSR $FA21                       ", 0xDE2A, 0xAA, 0x55, 0x2C, 0xA4, 0xFB },
-  { "BCS $FA2E                       ", 0xFA21, 0xAA, 0x55, 0x2C, 0xA4, 0xF9 },
-  { "BEQ $FA2E                       ", 0xFA23, 0xAA, 0x55, 0x2C, 0xA4, 0xF9 },
-  { "BPL $FA2E                       ", 0xFA25, 0xAA, 0x55, 0x2C, 0xA4, 0xF9 },
-  { "BVS $FA2E                       ", 0xFA27, 0xAA, 0x55, 0x2C, 0xA4, 0xF9 },
-  { "CMP #$AA                        ", 0xFA29, 0xAA, 0x55, 0x2C, 0xA4, 0xF9 },
-  { "BNE $FA2E                       ", 0xFA2B, 0xAA, 0x55, 0x2C, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA2D, 0xAA, 0x55, 0x2C, 0x27, 0xF9 },
-  { "LDA #$FF                        ", 0xDE2D, 0xAA, 0x55, 0x2C, 0x27, 0xFB },
-  { "STA $00,X @ 55 = AA             ", 0xDE2F, 0xFF, 0x55, 0x2C, 0xA5, 0xFB },
-  { "STA $01 = FF                    ", 0xDE31, 0xFF, 0x55, 0x2C, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xDE33, 0xFF, 0x55, 0x2C, 0xA5, 0xFB },
-  { "SEC                             ", 0xDE35, 0xFF, 0x55, 0x2C, 0xE5, 0xFB },
-  { "INC $00,X @ 55 = FF             ", 0xDE36, 0xFF, 0x55, 0x2C, 0xE5, 0xFB },
-  { "BNE $DE46                       ", 0xDE38, 0xFF, 0x55, 0x2C, 0x67, 0xFB },
-  { "BMI $DE46                       ", 0xDE3A, 0xFF, 0x55, 0x2C, 0x67, 0xFB },
-  { "BVC $DE46                       ", 0xDE3C, 0xFF, 0x55, 0x2C, 0x67, 0xFB },
-  { "BCC $DE46                       ", 0xDE3E, 0xFF, 0x55, 0x2C, 0x67, 0xFB },
-  { "LDA $00,X @ 55 = 00             ", 0xDE40, 0xFF, 0x55, 0x2C, 0x67, 0xFB },
-  { "CMP #$00                        ", 0xDE42, 0x00, 0x55, 0x2C, 0x67, 0xFB },
-  { "BEQ $DE4A                       ", 0xDE44, 0x00, 0x55, 0x2C, 0x67, 0xFB },
-  { "LDA #$7F                        ", 0xDE4A, 0x00, 0x55, 0x2C, 0x67, 0xFB },
-  { "STA $00,X @ 55 = 00             ", 0xDE4C, 0x7F, 0x55, 0x2C, 0x65, 0xFB },
-  { "CLV                             ", 0xDE4E, 0x7F, 0x55, 0x2C, 0x65, 0xFB },
-  { "CLC                             ", 0xDE4F, 0x7F, 0x55, 0x2C, 0x25, 0xFB },
-  { "INC $00,X @ 55 = 7F             ", 0xDE50, 0x7F, 0x55, 0x2C, 0x24, 0xFB },
-  { "BEQ $DE60                       ", 0xDE52, 0x7F, 0x55, 0x2C, 0xA4, 0xFB },
-  { "BPL $DE60                       ", 0xDE54, 0x7F, 0x55, 0x2C, 0xA4, 0xFB },
-  { "BVS $DE60                       ", 0xDE56, 0x7F, 0x55, 0x2C, 0xA4, 0xFB },
-  { "BCS $DE60                       ", 0xDE58, 0x7F, 0x55, 0x2C, 0xA4, 0xFB },
-  { "LDA $00,X @ 55 = 80             ", 0xDE5A, 0x7F, 0x55, 0x2C, 0xA4, 0xFB },
-  { "CMP #$80                        ", 0xDE5C, 0x80, 0x55, 0x2C, 0xA4, 0xFB },
-  { "BEQ $DE64                       ", 0xDE5E, 0x80, 0x55, 0x2C, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xDE64, 0x80, 0x55, 0x2C, 0x27, 0xFB },
-  { "STA $00,X @ 55 = 80             ", 0xDE66, 0x00, 0x55, 0x2C, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xDE68, 0x00, 0x55, 0x2C, 0x27, 0xFB },
-  { "SEC                             ", 0xDE6A, 0x00, 0x55, 0x2C, 0xE7, 0xFB },
-  { "DEC $00,X @ 55 = 00             ", 0xDE6B, 0x00, 0x55, 0x2C, 0xE7, 0xFB },
-  { "BEQ $DE7B                       ", 0xDE6D, 0x00, 0x55, 0x2C, 0xE5, 0xFB },
-  { "BPL $DE7B                       ", 0xDE6F, 0x00, 0x55, 0x2C, 0xE5, 0xFB },
-  { "BVC $DE7B                       ", 0xDE71, 0x00, 0x55, 0x2C, 0xE5, 0xFB },
-  { "BCC $DE7B                       ", 0xDE73, 0x00, 0x55, 0x2C, 0xE5, 0xFB },
-  { "LDA $00,X @ 55 = FF             ", 0xDE75, 0x00, 0x55, 0x2C, 0xE5, 0xFB },
-  { "CMP #$FF                        ", 0xDE77, 0xFF, 0x55, 0x2C, 0xE5, 0xFB },
-  { "BEQ $DE7F                       ", 0xDE79, 0xFF, 0x55, 0x2C, 0x67, 0xFB },
-  { "LDA #$80                        ", 0xDE7F, 0xFF, 0x55, 0x2C, 0x67, 0xFB },
-  { "STA $00,X @ 55 = FF             ", 0xDE81, 0x80, 0x55, 0x2C, 0xE5, 0xFB },
-  { "CLV                             ", 0xDE83, 0x80, 0x55, 0x2C, 0xE5, 0xFB },
-  { "CLC                             ", 0xDE84, 0x80, 0x55, 0x2C, 0xA5, 0xFB },
-  { "DEC $00,X @ 55 = 80             ", 0xDE85, 0x80, 0x55, 0x2C, 0xA4, 0xFB },
-  { "BEQ $DE95                       ", 0xDE87, 0x80, 0x55, 0x2C, 0x24, 0xFB },
-  { "BMI $DE95                       ", 0xDE89, 0x80, 0x55, 0x2C, 0x24, 0xFB },
-  { "BVS $DE95                       ", 0xDE8B, 0x80, 0x55, 0x2C, 0x24, 0xFB },
-  { "BCS $DE95                       ", 0xDE8D, 0x80, 0x55, 0x2C, 0x24, 0xFB },
-  { "LDA $00,X @ 55 = 7F             ", 0xDE8F, 0x80, 0x55, 0x2C, 0x24, 0xFB },
-  { "CMP #$7F                        ", 0xDE91, 0x7F, 0x55, 0x2C, 0x24, 0xFB },
-  { "BEQ $DE99                       ", 0xDE93, 0x7F, 0x55, 0x2C, 0x27, 0xFB },
-  { "LDA #$01                        ", 0xDE99, 0x7F, 0x55, 0x2C, 0x27, 0xFB },
-  { "STA $00,X @ 55 = 7F             ", 0xDE9B, 0x01, 0x55, 0x2C, 0x25, 0xFB },
-  { "DEC $00,X @ 55 = 01             ", 0xDE9D, 0x01, 0x55, 0x2C, 0x25, 0xFB },
-  { "BEQ $DEA5                       ", 0xDE9F, 0x01, 0x55, 0x2C, 0x27, 0xFB },
-  { "LDA #$33                        ", 0xDEA5, 0x01, 0x55, 0x2C, 0x27, 0xFB },
-  { "STA $78 = 7F                    ", 0xDEA7, 0x33, 0x55, 0x2C, 0x25, 0xFB },
-  { "LDA #$44                        ", 0xDEA9, 0x33, 0x55, 0x2C, 0x25, 0xFB },
-  { "LDY #$78                        ", 0xDEAB, 0x44, 0x55, 0x2C, 0x25, 0xFB },
-  { "LDX #$00                        ", 0xDEAD, 0x44, 0x55, 0x78, 0x25, 0xFB },
-  { "SEC                             ", 0xDEAF, 0x44, 0x00, 0x78, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xDEB0, 0x44, 0x00, 0x78, 0x27, 0xFB },
-  { "LDX $00,Y @ 78 = 33             ", 0xDEB2, 0x44, 0x00, 0x78, 0xE5, 0xFB },
-  { "BCC $DEC8                       ", 0xDEB4, 0x44, 0x33, 0x78, 0x65, 0xFB },
-  { "BVC $DEC8                       ", 0xDEB6, 0x44, 0x33, 0x78, 0x65, 0xFB },
-  { "BMI $DEC8                       ", 0xDEB8, 0x44, 0x33, 0x78, 0x65, 0xFB },
-  { "BEQ $DEC8                       ", 0xDEBA, 0x44, 0x33, 0x78, 0x65, 0xFB },
-  { "CPX #$33                        ", 0xDEBC, 0x44, 0x33, 0x78, 0x65, 0xFB },
-  { "BNE $DEC8                       ", 0xDEBE, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "CPY #$78                        ", 0xDEC0, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "BNE $DEC8                       ", 0xDEC2, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "CMP #$44                        ", 0xDEC4, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "BEQ $DECC                       ", 0xDEC6, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "LDA #$97                        ", 0xDECC, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "STA $7F = 00                    ", 0xDECE, 0x97, 0x33, 0x78, 0xE5, 0xFB },
-  { "LDA #$47                        ", 0xDED0, 0x97, 0x33, 0x78, 0xE5, 0xFB },
-  { "LDY #$FF                        ", 0xDED2, 0x47, 0x33, 0x78, 0x65, 0xFB },
-  { "LDX #$00                        ", 0xDED4, 0x47, 0x33, 0xFF, 0xE5, 0xFB },
-  { "CLC                             ", 0xDED6, 0x47, 0x00, 0xFF, 0x67, 0xFB },
-  { "CLV                             ", 0xDED7, 0x47, 0x00, 0xFF, 0x66, 0xFB },
-  { "LDX $80,Y @ 7F = 97             ", 0xDED8, 0x47, 0x00, 0xFF, 0x26, 0xFB },
-  { "BCS $DEEE                       ", 0xDEDA, 0x47, 0x97, 0xFF, 0xA4, 0xFB },
-  { "BVS $DEEE                       ", 0xDEDC, 0x47, 0x97, 0xFF, 0xA4, 0xFB },
-  { "BPL $DEEE                       ", 0xDEDE, 0x47, 0x97, 0xFF, 0xA4, 0xFB },
-  { "BEQ $DEEE                       ", 0xDEE0, 0x47, 0x97, 0xFF, 0xA4, 0xFB },
-  { "CPX #$97                        ", 0xDEE2, 0x47, 0x97, 0xFF, 0xA4, 0xFB },
-  { "BNE $DEEE                       ", 0xDEE4, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "CPY #$FF                        ", 0xDEE6, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "BNE $DEEE                       ", 0xDEE8, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "CMP #$47                        ", 0xDEEA, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "BEQ $DEF2                       ", 0xDEEC, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xDEF2, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "STA $7F = 97                    ", 0xDEF4, 0x00, 0x97, 0xFF, 0x27, 0xFB },
-  { "LDA #$47                        ", 0xDEF6, 0x00, 0x97, 0xFF, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xDEF8, 0x47, 0x97, 0xFF, 0x25, 0xFB },
-  { "LDX #$69                        ", 0xDEFA, 0x47, 0x97, 0xFF, 0xA5, 0xFB },
-  { "CLC                             ", 0xDEFC, 0x47, 0x69, 0xFF, 0x25, 0xFB },
-  { "CLV                             ", 0xDEFD, 0x47, 0x69, 0xFF, 0x24, 0xFB },
-  { "STX $80,Y @ 7F = 00             ", 0xDEFE, 0x47, 0x69, 0xFF, 0x24, 0xFB },
-  { "BCS $DF1A                       ", 0xDF00, 0x47, 0x69, 0xFF, 0x24, 0xFB },
-  { "BVS $DF1A                       ", 0xDF02, 0x47, 0x69, 0xFF, 0x24, 0xFB },
-  { "BMI $DF1A                       ", 0xDF04, 0x47, 0x69, 0xFF, 0x24, 0xFB },
-  { "BEQ $DF1A                       ", 0xDF06, 0x47, 0x69, 0xFF, 0x24, 0xFB },
-  { "CPX #$69                        ", 0xDF08, 0x47, 0x69, 0xFF, 0x24, 0xFB },
-  { "BNE $DF1A                       ", 0xDF0A, 0x47, 0x69, 0xFF, 0x27, 0xFB },
-  { "CPY #$FF                        ", 0xDF0C, 0x47, 0x69, 0xFF, 0x27, 0xFB },
-  { "BNE $DF1A                       ", 0xDF0E, 0x47, 0x69, 0xFF, 0x27, 0xFB },
-  { "CMP #$47                        ", 0xDF10, 0x47, 0x69, 0xFF, 0x27, 0xFB },
-  { "BNE $DF1A                       ", 0xDF12, 0x47, 0x69, 0xFF, 0x27, 0xFB },
-  { "LDA $7F = 69                    ", 0xDF14, 0x47, 0x69, 0xFF, 0x27, 0xFB },
-  { "CMP #$69                        ", 0xDF16, 0x69, 0x69, 0xFF, 0x25, 0xFB },
-  { "BEQ $DF1E                       ", 0xDF18, 0x69, 0x69, 0xFF, 0x27, 0xFB },
-  { "LDA #$F5                        ", 0xDF1E, 0x69, 0x69, 0xFF, 0x27, 0xFB },
-  { "STA $4F = 00                    ", 0xDF20, 0xF5, 0x69, 0xFF, 0xA5, 0xFB },
-  { "LDA #$47                        ", 0xDF22, 0xF5, 0x69, 0xFF, 0xA5, 0xFB },
-  { "LDY #$4F                        ", 0xDF24, 0x47, 0x69, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xDF26, 0x47, 0x69, 0x4F, 0x25, 0xFB },
-  { "LDX #$00                        ", 0xDF28, 0x47, 0x69, 0x4F, 0xE5, 0xFB },
-  { "SEC                             ", 0xDF2A, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "STX $00,Y @ 4F = F5             ", 0xDF2B, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "BCC $DF45                       ", 0xDF2D, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "BVC $DF45                       ", 0xDF2F, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "BMI $DF45                       ", 0xDF31, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "BNE $DF45                       ", 0xDF33, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "CPX #$00                        ", 0xDF35, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "BNE $DF45                       ", 0xDF37, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "CPY #$4F                        ", 0xDF39, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "BNE $DF45                       ", 0xDF3B, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "CMP #$47                        ", 0xDF3D, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "BNE $DF45                       ", 0xDF3F, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "LDA $4F = 00                    ", 0xDF41, 0x47, 0x00, 0x4F, 0x67, 0xFB },
-  { "BEQ $DF49                       ", 0xDF43, 0x00, 0x00, 0x4F, 0x67, 0xFB },
-  { "RTS                             ", 0xDF49, 0x00, 0x00, 0x4F, 0x67, 0xFB },
-  { "JSR $E1AA                       ", 0xC62C, 0x00, 0x00, 0x4F, 0x67, 0xFD },
-  { "LDA #$FF                        ", 0xE1AA, 0x00, 0x00, 0x4F, 0x67, 0xFB },
-  { "STA $01 = FF                    ", 0xE1AC, 0xFF, 0x00, 0x4F, 0xE5, 0xFB },
-  { "LDA #$AA                        ", 0xE1AE, 0xFF, 0x00, 0x4F, 0xE5, 0xFB },
-  { "STA $0633 = 00                  ", 0xE1B0, 0xAA, 0x00, 0x4F, 0xE5, 0xFB },
-  { "LDA #$BB                        ", 0xE1B3, 0xAA, 0x00, 0x4F, 0xE5, 0xFB },
-  { "STA $0689 = 00                  ", 0xE1B5, 0xBB, 0x00, 0x4F, 0xE5, 0xFB },
-  { "LDX #$00                        ", 0xE1B8, 0xBB, 0x00, 0x4F, 0xE5, 0xFB },
-  { "LDA #$66                        ", 0xE1BA, 0xBB, 0x00, 0x4F, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xE1BC, 0x66, 0x00, 0x4F, 0x65, 0xFB },
-  { "SEC                             ", 0xE1BE, 0x66, 0x00, 0x4F, 0xE5, 0xFB },
-  { "LDY #$00                        ", 0xE1BF, 0x66, 0x00, 0x4F, 0xE5, 0xFB },
-  { "LDY $0633,X @ 0633 = AA         ", 0xE1C1, 0x66, 0x00, 0x00, 0x67, 0xFB },
-  { "BPL $E1D8                       ", 0xE1C4, 0x66, 0x00, 0xAA, 0xE5, 0xFB },
-  { "BEQ $E1D8                       ", 0xE1C6, 0x66, 0x00, 0xAA, 0xE5, 0xFB },
-  { "BVC $E1D8                       ", 0xE1C8, 0x66, 0x00, 0xAA, 0xE5, 0xFB },
-  { "BCC $E1D8                       ", 0xE1CA, 0x66, 0x00, 0xAA, 0xE5, 0xFB },
-  { "CMP #$66                        ", 0xE1CC, 0x66, 0x00, 0xAA, 0xE5, 0xFB },
-  { "BNE $E1D8                       ", 0xE1CE, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "CPX #$00                        ", 0xE1D0, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "BNE $E1D8                       ", 0xE1D2, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "CPY #$AA                        ", 0xE1D4, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "BEQ $E1DC                       ", 0xE1D6, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "LDX #$8A                        ", 0xE1DC, 0x66, 0x00, 0xAA, 0x67, 0xFB },
-  { "LDA #$66                        ", 0xE1DE, 0x66, 0x8A, 0xAA, 0xE5, 0xFB },
-  { "CLV                             ", 0xE1E0, 0x66, 0x8A, 0xAA, 0x65, 0xFB },
-  { "CLC                             ", 0xE1E1, 0x66, 0x8A, 0xAA, 0x25, 0xFB },
-  { "LDY #$00                        ", 0xE1E2, 0x66, 0x8A, 0xAA, 0x24, 0xFB },
-  { "LDY $05FF,X @ 0689 = BB         ", 0xE1E4, 0x66, 0x8A, 0x00, 0x26, 0xFB },
-  { "BPL $E1FB                       ", 0xE1E7, 0x66, 0x8A, 0xBB, 0xA4, 0xFB },
-  { "BEQ $E1FB                       ", 0xE1E9, 0x66, 0x8A, 0xBB, 0xA4, 0xFB },
-  { "BVS $E1FB                       ", 0xE1EB, 0x66, 0x8A, 0xBB, 0xA4, 0xFB },
-  { "BCS $E1FB                       ", 0xE1ED, 0x66, 0x8A, 0xBB, 0xA4, 0xFB },
-  { "CPY #$BB                        ", 0xE1EF, 0x66, 0x8A, 0xBB, 0xA4, 0xFB },
-  { "BNE $E1FB                       ", 0xE1F1, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "CMP #$66                        ", 0xE1F3, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "BNE $E1FB                       ", 0xE1F5, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "CPX #$8A                        ", 0xE1F7, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "BEQ $E1FF                       ", 0xE1F9, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "LDY #$53                        ", 0xE1FF, 0x66, 0x8A, 0xBB, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xE201, 0x66, 0x8A, 0x53, 0x25, 0xFB },
-  { "LDX #$78                        ", 0xE203, 0xAA, 0x8A, 0x53, 0xA5, 0xFB },
-  { "STA $0678 = 00                  ", 0xE205, 0xAA, 0x78, 0x53, 0x25, 0xFB },
-  { "JSR $F7B6                       ", 0xE208, 0xAA, 0x78, 0x53, 0x25, 0xFB },
-  { "CLC                             ", 0xF7B6, 0xAA, 0x78, 0x53, 0x25, 0xF9 },
-  { "LDA #$FF                        ", 0xF7B7, 0xAA, 0x78, 0x53, 0x24, 0xF9 },
-  { "STA $01 = FF                    ", 0xF7B9, 0xFF, 0x78, 0x53, 0xA4, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF7BB, 0xFF, 0x78, 0x53, 0xA4, 0xF9 },
-  { "LDA #$55                        ", 0xF7BD, 0xFF, 0x78, 0x53, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF7BF, 0x55, 0x78, 0x53, 0x64, 0xF9 },
-  { "ORA $0600,X @ 0678 = AA         ", 0xE20B, 0x55, 0x78, 0x53, 0x64, 0xFB },
-  { "JSR $F7C0                       ", 0xE20E, 0xFF, 0x78, 0x53, 0xE4, 0xFB },
-  { "BCS $F7CB                       ", 0xF7C0, 0xFF, 0x78, 0x53, 0xE4, 0xF9 },
-  { "BPL $F7CB                       ", 0xF7C2, 0xFF, 0x78, 0x53, 0xE4, 0xF9 },
-  { "CMP #$FF                        ", 0xF7C4, 0xFF, 0x78, 0x53, 0xE4, 0xF9 },
-  { "BNE $F7CB                       ", 0xF7C6, 0xFF, 0x78, 0x53, 0x67, 0xF9 },
-  { "BVC $F7CB                       ", 0xF7C8, 0xFF, 0x78, 0x53, 0x67, 0xF9 },
-  { "RTS                             ", 0xF7CA, 0xFF, 0x78, 0x53, 0x67, 0xF9 },
-  { "INY                             ", 0xE211, 0xFF, 0x78, 0x53, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xE212, 0xFF, 0x78, 0x54, 0x65, 0xFB },
-  { "STA $0678 = AA                  ", 0xE214, 0x00, 0x78, 0x54, 0x67, 0xFB },
-  { "JSR $F7CE                       ", 0xE217, 0x00, 0x78, 0x54, 0x67, 0xFB },
-  { "SEC                             ", 0xF7CE, 0x00, 0x78, 0x54, 0x67, 0xF9 },
-  { "CLV                             ", 0xF7CF, 0x00, 0x78, 0x54, 0x67, 0xF9 },
-  { "LDA #$00                        ", 0xF7D0, 0x00, 0x78, 0x54, 0x27, 0xF9 },
-  { "RTS                             ", 0xF7D2, 0x00, 0x78, 0x54, 0x27, 0xF9 },
-  { "ORA $0600,X @ 0678 = 00         ", 0xE21A, 0x00, 0x78, 0x54, 0x27, 0xFB },
-  { "JSR $F7D3                       ", 0xE21D, 0x00, 0x78, 0x54, 0x27, 0xFB },
-  { "BNE $F7DC                       ", 0xF7D3, 0x00, 0x78, 0x54, 0x27, 0xF9 },
-  { "BVS $F7DC                       ", 0xF7D5, 0x00, 0x78, 0x54, 0x27, 0xF9 },
-  { "BCC $F7DC                       ", 0xF7D7, 0x00, 0x78, 0x54, 0x27, 0xF9 },
-  { "BMI $F7DC                       ", 0xF7D9, 0x00, 0x78, 0x54, 0x27, 0xF9 },
-  { "RTS                             ", 0xF7DB, 0x00, 0x78, 0x54, 0x27, 0xF9 },
-  { "INY                             ", 0xE220, 0x00, 0x78, 0x54, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xE221, 0x00, 0x78, 0x55, 0x25, 0xFB },
-  { "STA $0678 = 00                  ", 0xE223, 0xAA, 0x78, 0x55, 0xA5, 0xFB },
-  { "JSR $F7DF                       ", 0xE226, 0xAA, 0x78, 0x55, 0xA5, 0xFB },
-  { "CLC                             ", 0xF7DF, 0xAA, 0x78, 0x55, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF7E0, 0xAA, 0x78, 0x55, 0xA4, 0xF9 },
-  { "LDA #$55                        ", 0xF7E2, 0xAA, 0x78, 0x55, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF7E4, 0x55, 0x78, 0x55, 0x64, 0xF9 },
-  { "AND $0600,X @ 0678 = AA         ", 0xE229, 0x55, 0x78, 0x55, 0x64, 0xFB },
-  { "JSR $F7E5                       ", 0xE22C, 0x00, 0x78, 0x55, 0x66, 0xFB },
-  { "BNE $F7EE                       ", 0xF7E5, 0x00, 0x78, 0x55, 0x66, 0xF9 },
-  { "BVC $F7EE                       ", 0xF7E7, 0x00, 0x78, 0x55, 0x66, 0xF9 },
-  { "BCS $F7EE                       ", 0xF7E9, 0x00, 0x78, 0x55, 0x66, 0xF9 },
-  { "BMI $F7EE                       ", 0xF7EB, 0x00, 0x78, 0x55, 0x66, 0xF9 },
-  { "RTS                             ", 0xF7ED, 0x00, 0x78, 0x55, 0x66, 0xF9 },
-  { "INY                             ", 0xE22F, 0x00, 0x78, 0x55, 0x66, 0xFB },
-  { "LDA #$EF                        ", 0xE230, 0x00, 0x78, 0x56, 0x64, 0xFB },
-  { "STA $0678 = AA                  ", 0xE232, 0xEF, 0x78, 0x56, 0xE4, 0xFB },
-  { "JSR $F7F1                       ", 0xE235, 0xEF, 0x78, 0x56, 0xE4, 0xFB },
-  { "SEC                             ", 0xF7F1, 0xEF, 0x78, 0x56, 0xE4, 0xF9 },
-  { "CLV                             ", 0xF7F2, 0xEF, 0x78, 0x56, 0xE5, 0xF9 },
-  { "LDA #$F8                        ", 0xF7F3, 0xEF, 0x78, 0x56, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF7F5, 0xF8, 0x78, 0x56, 0xA5, 0xF9 },
-  { "AND $0600,X @ 0678 = EF         ", 0xE238, 0xF8, 0x78, 0x56, 0xA5, 0xFB },
-  { "JSR $F7F6                       ", 0xE23B, 0xE8, 0x78, 0x56, 0xA5, 0xFB },
-  { "BCC $F801                       ", 0xF7F6, 0xE8, 0x78, 0x56, 0xA5, 0xF9 },
-  { "BPL $F801                       ", 0xF7F8, 0xE8, 0x78, 0x56, 0xA5, 0xF9 },
-  { "CMP #$E8                        ", 0xF7FA, 0xE8, 0x78, 0x56, 0xA5, 0xF9 },
-  { "BNE $F801                       ", 0xF7FC, 0xE8, 0x78, 0x56, 0x27, 0xF9 },
-  { "BVS $F801                       ", 0xF7FE, 0xE8, 0x78, 0x56, 0x27, 0xF9 },
-  { "RTS                             ", 0xF800, 0xE8, 0x78, 0x56, 0x27, 0xF9 },
-  { "INY                             ", 0xE23E, 0xE8, 0x78, 0x56, 0x27, 0xFB },
-  { "LDA #$AA                        ", 0xE23F, 0xE8, 0x78, 0x57, 0x25, 0xFB },
-  { "STA $0678 = EF                  ", 0xE241, 0xAA, 0x78, 0x57, 0xA5, 0xFB },
-  { "JSR $F804                       ", 0xE244, 0xAA, 0x78, 0x57, 0xA5, 0xFB },
-  { "CLC                             ", 0xF804, 0xAA, 0x78, 0x57, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF805, 0xAA, 0x78, 0x57, 0xA4, 0xF9 },
-  { "LDA #$5F                        ", 0xF807, 0xAA, 0x78, 0x57, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF809, 0x5F, 0x78, 0x57, 0x64, 0xF9 },
-  { "EOR $0600,X @ 0678 = AA         ", 0xE247, 0x5F, 0x78, 0x57, 0x64, 0xFB },
-  { "JSR $F80A                       ", 0xE24A, 0xF5, 0x78, 0x57, 0xE4, 0xFB },
-  { "BCS $F815                       ", 0xF80A, 0xF5, 0x78, 0x57, 0xE4, 0xF9 },
-  { "BPL $F815                       ", 0xF80C, 0xF5, 0x78, 0x57, 0xE4, 0xF9 },
-  { "CMP #$F5                        ", 0xF80E, 0xF5, 0x78, 0x57, 0xE4, 0xF9 },
-  { "BNE $F815                       ", 0xF810, 0xF5, 0x78, 0x57, 0x67, 0xF9 },
-  { "BVC $F815                       ", 0xF812, 0xF5, 0x78, 0x57, 0x67, 0xF9 },
-  { "RTS                             ", 0xF814, 0xF5, 0x78, 0x57, 0x67, 0xF9 },
-  { "INY                             ", 0xE24D, 0xF5, 0x78, 0x57, 0x67, 0xFB },
-  { "LDA #$70                        ", 0xE24E, 0xF5, 0x78, 0x58, 0x65, 0xFB },
-  { "STA $0678 = AA                  ", 0xE250, 0x70, 0x78, 0x58, 0x65, 0xFB },
-  { "JSR $F818                       ", 0xE253, 0x70, 0x78, 0x58, 0x65, 0xFB },
-  { "SEC                             ", 0xF818, 0x70, 0x78, 0x58, 0x65, 0xF9 },
-  { "CLV                             ", 0xF819, 0x70, 0x78, 0x58, 0x65, 0xF9 },
-  { "LDA #$70                        ", 0xF81A, 0x70, 0x78, 0x58, 0x25, 0xF9 },
-  { "RTS                             ", 0xF81C, 0x70, 0x78, 0x58, 0x25, 0xF9 },
-  { "EOR $0600,X @ 0678 = 70         ", 0xE256, 0x70, 0x78, 0x58, 0x25, 0xFB },
-  { "JSR $F81D                       ", 0xE259, 0x00, 0x78, 0x58, 0x27, 0xFB },
-  { "BNE $F826                       ", 0xF81D, 0x00, 0x78, 0x58, 0x27, 0xF9 },
-  { "BVS $F826                       ", 0xF81F, 0x00, 0x78, 0x58, 0x27, 0xF9 },
-  { "BCC $F826                       ", 0xF821, 0x00, 0x78, 0x58, 0x27, 0xF9 },
-  { "BMI $F826                       ", 0xF823, 0x00, 0x78, 0x58, 0x27, 0xF9 },
-  { "RTS                             ", 0xF825, 0x00, 0x78, 0x58, 0x27, 0xF9 },
-  { "INY                             ", 0xE25C, 0x00, 0x78, 0x58, 0x27, 0xFB },
-  { "LDA #$69                        ", 0xE25D, 0x00, 0x78, 0x59, 0x25, 0xFB },
-  { "STA $0678 = 70                  ", 0xE25F, 0x69, 0x78, 0x59, 0x25, 0xFB },
-  { "JSR $F829                       ", 0xE262, 0x69, 0x78, 0x59, 0x25, 0xFB },
-  { "CLC                             ", 0xF829, 0x69, 0x78, 0x59, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF82A, 0x69, 0x78, 0x59, 0x24, 0xF9 },
-  { "LDA #$00                        ", 0xF82C, 0x69, 0x78, 0x59, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF82E, 0x00, 0x78, 0x59, 0x66, 0xF9 },
-  { "ADC $0600,X @ 0678 = 69         ", 0xE265, 0x00, 0x78, 0x59, 0x66, 0xFB },
-  { "JSR $F82F                       ", 0xE268, 0x69, 0x78, 0x59, 0x24, 0xFB },
-  { "BMI $F83A                       ", 0xF82F, 0x69, 0x78, 0x59, 0x24, 0xF9 },
-  { "BCS $F83A                       ", 0xF831, 0x69, 0x78, 0x59, 0x24, 0xF9 },
-  { "CMP #$69                        ", 0xF833, 0x69, 0x78, 0x59, 0x24, 0xF9 },
-  { "BNE $F83A                       ", 0xF835, 0x69, 0x78, 0x59, 0x27, 0xF9 },
-  { "BVS $F83A                       ", 0xF837, 0x69, 0x78, 0x59, 0x27, 0xF9 },
-  { "RTS                             ", 0xF839, 0x69, 0x78, 0x59, 0x27, 0xF9 },
-  { "INY                             ", 0xE26B, 0x69, 0x78, 0x59, 0x27, 0xFB },
-  { "JSR $F83D                       ", 0xE26C, 0x69, 0x78, 0x5A, 0x25, 0xFB },
-  { "SEC                             ", 0xF83D, 0x69, 0x78, 0x5A, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF83E, 0x69, 0x78, 0x5A, 0x25, 0xF9 },
-  { "LDA #$00                        ", 0xF840, 0x69, 0x78, 0x5A, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF842, 0x00, 0x78, 0x5A, 0x67, 0xF9 },
-  { "ADC $0600,X @ 0678 = 69         ", 0xE26F, 0x00, 0x78, 0x5A, 0x67, 0xFB },
-  { "JSR $F843                       ", 0xE272, 0x6A, 0x78, 0x5A, 0x24, 0xFB },
-  { "BMI $F84E                       ", 0xF843, 0x6A, 0x78, 0x5A, 0x24, 0xF9 },
-  { "BCS $F84E                       ", 0xF845, 0x6A, 0x78, 0x5A, 0x24, 0xF9 },
-  { "CMP #$6A                        ", 0xF847, 0x6A, 0x78, 0x5A, 0x24, 0xF9 },
-  { "BNE $F84E                       ", 0xF849, 0x6A, 0x78, 0x5A, 0x27, 0xF9 },
-  { "BVS $F84E                       ", 0xF84B, 0x6A, 0x78, 0x5A, 0x27, 0xF9 },
-  { "RTS                             ", 0xF84D, 0x6A, 0x78, 0x5A, 0x27, 0xF9 },
-  { "INY                             ", 0xE275, 0x6A, 0x78, 0x5A, 0x27, 0xFB },
-  { "LDA #$7F                        ", 0xE276, 0x6A, 0x78, 0x5B, 0x25, 0xFB },
-  { "STA $0678 = 69                  ", 0xE278, 0x7F, 0x78, 0x5B, 0x25, 0xFB },
-  { "JSR $F851                       ", 0xE27B, 0x7F, 0x78, 0x5B, 0x25, 0xFB },
-  { "SEC                             ", 0xF851, 0x7F, 0x78, 0x5B, 0x25, 0xF9 },
-  { "CLV                             ", 0xF852, 0x7F, 0x78, 0x5B, 0x25, 0xF9 },
-  { "LDA #$7F                        ", 0xF853, 0x7F, 0x78, 0x5B, 0x25, 0xF9 },
-  { "RTS                             ", 0xF855, 0x7F, 0x78, 0x5B, 0x25, 0xF9 },
-  { "ADC $0600,X @ 0678 = 7F         ", 0xE27E, 0x7F, 0x78, 0x5B, 0x25, 0xFB },
-  { "JSR $F856                       ", 0xE281, 0xFF, 0x78, 0x5B, 0xE4, 0xFB },
-  { "BPL $F861                       ", 0xF856, 0xFF, 0x78, 0x5B, 0xE4, 0xF9 },
-  { "BCS $F861                       ", 0xF858, 0xFF, 0x78, 0x5B, 0xE4, 0xF9 },
-  { "CMP #$FF                        ", 0xF85A, 0xFF, 0x78, 0x5B, 0xE4, 0xF9 },
-  { "BNE $F861                       ", 0xF85C, 0xFF, 0x78, 0x5B, 0x67, 0xF9 },
-  { "BVC $F861                       ", 0xF85E, 0xFF, 0x78, 0x5B, 0x67, 0xF9 },
-  { "RTS                             ", 0xF860, 0xFF, 0x78, 0x5B, 0x67, 0xF9 },
-  { "INY                             ", 0xE284, 0xFF, 0x78, 0x5B, 0x67, 0xFB },
-  { "LDA #$80                        ", 0xE285, 0xFF, 0x78, 0x5C, 0x65, 0xFB },
-  { "STA $0678 = 7F                  ", 0xE287, 0x80, 0x78, 0x5C, 0xE5, 0xFB },
-  { "JSR $F864                       ", 0xE28A, 0x80, 0x78, 0x5C, 0xE5, 0xFB },
-  { "CLC                             ", 0xF864, 0x80, 0x78, 0x5C, 0xE5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF865, 0x80, 0x78, 0x5C, 0xE4, 0xF9 },
-  { "LDA #$7F                        ", 0xF867, 0x80, 0x78, 0x5C, 0xE4, 0xF9 },
-  { "RTS                             ", 0xF869, 0x7F, 0x78, 0x5C, 0x64, 0xF9 },
-  { "ADC $0600,X @ 0678 = 80         ", 0xE28D, 0x7F, 0x78, 0x5C, 0x64, 0xFB },
-  { "JSR $F86A                       ", 0xE290, 0xFF, 0x78, 0x5C, 0xA4, 0xFB },
-  { "BPL $F875                       ", 0xF86A, 0xFF, 0x78, 0x5C, 0xA4, 0xF9 },
-  { "BCS $F875                       ", 0xF86C, 0xFF, 0x78, 0x5C, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF86E, 0xFF, 0x78, 0x5C, 0xA4, 0xF9 },
-  { "BNE $F875                       ", 0xF870, 0xFF, 0x78, 0x5C, 0x27, 0xF9 },
-  { "BVS $F875                       ", 0xF872, 0xFF, 0x78, 0x5C, 0x27, 0xF9 },
-  { "RTS                             ", 0xF874, 0xFF, 0x78, 0x5C, 0x27, 0xF9 },
-  { "INY                             ", 0xE293, 0xFF, 0x78, 0x5C, 0x27, 0xFB },
-  { "JSR $F878                       ", 0xE294, 0xFF, 0x78, 0x5D, 0x25, 0xFB },
-  { "SEC                             ", 0xF878, 0xFF, 0x78, 0x5D, 0x25, 0xF9 },
-  { "CLV                             ", 0xF879, 0xFF, 0x78, 0x5D, 0x25, 0xF9 },
-  { "LDA #$7F                        ", 0xF87A, 0xFF, 0x78, 0x5D, 0x25, 0xF9 },
-  { "RTS                             ", 0xF87C, 0x7F, 0x78, 0x5D, 0x25, 0xF9 },
-  { "ADC $0600,X @ 0678 = 80         ", 0xE297, 0x7F, 0x78, 0x5D, 0x25, 0xFB },
-  { "JSR $F87D                       ", 0xE29A, 0x00, 0x78, 0x5D, 0x27, 0xFB },
-  { "BNE $F886                       ", 0xF87D, 0x00, 0x78, 0x5D, 0x27, 0xF9 },
-  { "BMI $F886                       ", 0xF87F, 0x00, 0x78, 0x5D, 0x27, 0xF9 },
-  { "BVS $F886                       ", 0xF881, 0x00, 0x78, 0x5D, 0x27, 0xF9 },
-  { "BCC $F886                       ", 0xF883, 0x00, 0x78, 0x5D, 0x27, 0xF9 },
-  { "RTS                             ", 0xF885, 0x00, 0x78, 0x5D, 0x27, 0xF9 },
-  { "INY                             ", 0xE29D, 0x00, 0x78, 0x5D, 0x27, 0xFB },
-  { "LDA #$40                        ", 0xE29E, 0x00, 0x78, 0x5E, 0x25, 0xFB },
-  { "STA $0678 = 80                  ", 0xE2A0, 0x40, 0x78, 0x5E, 0x25, 0xFB },
-  { "JSR $F889                       ", 0xE2A3, 0x40, 0x78, 0x5E, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF889, 0x40, 0x78, 0x5E, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF88B, 0x40, 0x78, 0x5E, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF88D, 0x40, 0x78, 0x5E, 0x65, 0xF9 },
-  { "CMP $0600,X @ 0678 = 40         ", 0xE2A6, 0x40, 0x78, 0x5E, 0x65, 0xFB },
-  { "JSR $F88E                       ", 0xE2A9, 0x40, 0x78, 0x5E, 0x67, 0xFB },
-  { "BMI $F897                       ", 0xF88E, 0x40, 0x78, 0x5E, 0x67, 0xF9 },
-  { "BCC $F897                       ", 0xF890, 0x40, 0x78, 0x5E, 0x67, 0xF9 },
-  { "BNE $F897                       ", 0xF892, 0x40, 0x78, 0x5E, 0x67, 0xF9 },
-  { "BVC $F897                       ", 0xF894, 0x40, 0x78, 0x5E, 0x67, 0xF9 },
-  { "RTS                             ", 0xF896, 0x40, 0x78, 0x5E, 0x67, 0xF9 },
-  { "INY                             ", 0xE2AC, 0x40, 0x78, 0x5E, 0x67, 0xFB },
-  { "PHA                             ", 0xE2AD, 0x40, 0x78, 0x5F, 0x65, 0xFB },
-  { "LDA #$3F                        ", 0xE2AE, 0x40, 0x78, 0x5F, 0x65, 0xFA },
-  { "STA $0678 = 40                  ", 0xE2B0, 0x3F, 0x78, 0x5F, 0x65, 0xFA },
-  { "PLA                             ", 0xE2B3, 0x3F, 0x78, 0x5F, 0x65, 0xFA },
-  { "JSR $F89A                       ", 0xE2B4, 0x40, 0x78, 0x5F, 0x65, 0xFB },
-  { "CLV                             ", 0xF89A, 0x40, 0x78, 0x5F, 0x65, 0xF9 },
-  { "RTS                             ", 0xF89B, 0x40, 0x78, 0x5F, 0x25, 0xF9 },
-  { "CMP $0600,X @ 0678 = 3F         ", 0xE2B7, 0x40, 0x78, 0x5F, 0x25, 0xFB },
-  { "JSR $F89C                       ", 0xE2BA, 0x40, 0x78, 0x5F, 0x25, 0xFB },
-  { "BEQ $F8A5                       ", 0xF89C, 0x40, 0x78, 0x5F, 0x25, 0xF9 },
-  { "BMI $F8A5                       ", 0xF89E, 0x40, 0x78, 0x5F, 0x25, 0xF9 },
-  { "BCC $F8A5                       ", 0xF8A0, 0x40, 0x78, 0x5F, 0x25, 0xF9 },
-  { "BVS $F8A5                       ", 0xF8A2, 0x40, 0x78, 0x5F, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8A4, 0x40, 0x78, 0x5F, 0x25, 0xF9 },
-  { "INY                             ", 0xE2BD, 0x40, 0x78, 0x5F, 0x25, 0xFB },
-  { "PHA                             ", 0xE2BE, 0x40, 0x78, 0x60, 0x25, 0xFB },
-  { "LDA #$41                        ", 0xE2BF, 0x40, 0x78, 0x60, 0x25, 0xFA },
-  { "STA $0678 = 3F                  ", 0xE2C1, 0x41, 0x78, 0x60, 0x25, 0xFA },
-  { "PLA                             ", 0xE2C4, 0x41, 0x78, 0x60, 0x25, 0xFA },
-  { "CMP $0600,X @ 0678 = 41         ", 0xE2C5, 0x40, 0x78, 0x60, 0x25, 0xFB },
-  { "JSR $F8A8                       ", 0xE2C8, 0x40, 0x78, 0x60, 0xA4, 0xFB },
-  { "BEQ $F8AF                       ", 0xF8A8, 0x40, 0x78, 0x60, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AA, 0x40, 0x78, 0x60, 0xA4, 0xF9 },
-  { "BPL $F8AF                       ", 0xF8AC, 0x40, 0x78, 0x60, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8AE, 0x40, 0x78, 0x60, 0xA4, 0xF9 },
-  { "INY                             ", 0xE2CB, 0x40, 0x78, 0x60, 0xA4, 0xFB },
-  { "PHA                             ", 0xE2CC, 0x40, 0x78, 0x61, 0x24, 0xFB },
-  { "LDA #$00                        ", 0xE2CD, 0x40, 0x78, 0x61, 0x24, 0xFA },
-  { "STA $0678 = 41                  ", 0xE2CF, 0x00, 0x78, 0x61, 0x26, 0xFA },
-  { "PLA                             ", 0xE2D2, 0x00, 0x78, 0x61, 0x26, 0xFA },
-  { "JSR $F8B2                       ", 0xE2D3, 0x40, 0x78, 0x61, 0x24, 0xFB },
-  { "LDA #$80                        ", 0xF8B2, 0x40, 0x78, 0x61, 0x24, 0xF9 },
-  { "RTS                             ", 0xF8B4, 0x80, 0x78, 0x61, 0xA4, 0xF9 },
-  { "CMP $0600,X @ 0678 = 00         ", 0xE2D6, 0x80, 0x78, 0x61, 0xA4, 0xFB },
-  { "JSR $F8B5                       ", 0xE2D9, 0x80, 0x78, 0x61, 0xA5, 0xFB },
-  { "BEQ $F8BC                       ", 0xF8B5, 0x80, 0x78, 0x61, 0xA5, 0xF9 },
-  { "BPL $F8BC                       ", 0xF8B7, 0x80, 0x78, 0x61, 0xA5, 0xF9 },
-  { "BCC $F8BC                       ", 0xF8B9, 0x80, 0x78, 0x61, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF8BB, 0x80, 0x78, 0x61, 0xA5, 0xF9 },
-  { "INY                             ", 0xE2DC, 0x80, 0x78, 0x61, 0xA5, 0xFB },
-  { "PHA                             ", 0xE2DD, 0x80, 0x78, 0x62, 0x25, 0xFB },
-  { "LDA #$80                        ", 0xE2DE, 0x80, 0x78, 0x62, 0x25, 0xFA },
-  { "STA $0678 = 00                  ", 0xE2E0, 0x80, 0x78, 0x62, 0xA5, 0xFA },
-  { "PLA                             ", 0xE2E3, 0x80, 0x78, 0x62, 0xA5, 0xFA },
-  { "CMP $0600,X @ 0678 = 80         ", 0xE2E4, 0x80, 0x78, 0x62, 0xA5, 0xFB },
-  { "JSR $F8BF                       ", 0xE2E7, 0x80, 0x78, 0x62, 0x27, 0xFB },
-  { "BNE $F8C6                       ", 0xF8BF, 0x80, 0x78, 0x62, 0x27, 0xF9 },
-  { "BMI $F8C6                       ", 0xF8C1, 0x80, 0x78, 0x62, 0x27, 0xF9 },
-  { "BCC $F8C6                       ", 0xF8C3, 0x80, 0x78, 0x62, 0x27, 0xF9 },
-  { "RTS                             ", 0xF8C5, 0x80, 0x78, 0x62, 0x27, 0xF9 },
-  { "INY                             ", 0xE2EA, 0x80, 0x78, 0x62, 0x27, 0xFB },
-  { "PHA                             ", 0xE2EB, 0x80, 0x78, 0x63, 0x25, 0xFB },
-  { "LDA #$81                        ", 0xE2EC, 0x80, 0x78, 0x63, 0x25, 0xFA },
-  { "STA $0678 = 80                  ", 0xE2EE, 0x81, 0x78, 0x63, 0xA5, 0xFA },
-  { "PLA                             ", 0xE2F1, 0x81, 0x78, 0x63, 0xA5, 0xFA },
-  { "CMP $0600,X @ 0678 = 81         ", 0xE2F2, 0x80, 0x78, 0x63, 0xA5, 0xFB },
-  { "JSR $F8C9                       ", 0xE2F5, 0x80, 0x78, 0x63, 0xA4, 0xFB },
-  { "BCS $F8D0                       ", 0xF8C9, 0x80, 0x78, 0x63, 0xA4, 0xF9 },
-  { "BEQ $F8D0                       ", 0xF8CB, 0x80, 0x78, 0x63, 0xA4, 0xF9 },
-  { "BPL $F8D0                       ", 0xF8CD, 0x80, 0x78, 0x63, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF8CF, 0x80, 0x78, 0x63, 0xA4, 0xF9 },
-  { "INY                             ", 0xE2F8, 0x80, 0x78, 0x63, 0xA4, 0xFB },
-  { "PHA                             ", 0xE2F9, 0x80, 0x78, 0x64, 0x24, 0xFB },
-  { "LDA #$7F                        ", 0xE2FA, 0x80, 0x78, 0x64, 0x24, 0xFA },
-  { "STA $0678 = 81                  ", 0xE2FC, 0x7F, 0x78, 0x64, 0x24, 0xFA },
-  { "PLA                             ", 0xE2FF, 0x7F, 0x78, 0x64, 0x24, 0xFA },
-  { "CMP $0600,X @ 0678 = 7F         ", 0xE300, 0x80, 0x78, 0x64, 0xA4, 0xFB },
-  { "JSR $F8D3                       ", 0xE303, 0x80, 0x78, 0x64, 0x25, 0xFB },
-  { "BCC $F8DA                       ", 0xF8D3, 0x80, 0x78, 0x64, 0x25, 0xF9 },
-  { "BEQ $F8DA                       ", 0xF8D5, 0x80, 0x78, 0x64, 0x25, 0xF9 },
-  { "BMI $F8DA                       ", 0xF8D7, 0x80, 0x78, 0x64, 0x25, 0xF9 },
-  { "RTS                             ", 0xF8D9, 0x80, 0x78, 0x64, 0x25, 0xF9 },
-  { "INY                             ", 0xE306, 0x80, 0x78, 0x64, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xE307, 0x80, 0x78, 0x65, 0x25, 0xFB },
-  { "STA $0678 = 7F                  ", 0xE309, 0x40, 0x78, 0x65, 0x25, 0xFB },
-  { "JSR $F931                       ", 0xE30C, 0x40, 0x78, 0x65, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF931, 0x40, 0x78, 0x65, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF933, 0x40, 0x78, 0x65, 0xE5, 0xF9 },
-  { "SEC                             ", 0xF935, 0x40, 0x78, 0x65, 0x65, 0xF9 },
-  { "RTS                             ", 0xF936, 0x40, 0x78, 0x65, 0x65, 0xF9 },
-  { "SBC $0600,X @ 0678 = 40         ", 0xE30F, 0x40, 0x78, 0x65, 0x65, 0xFB },
-  { "JSR $F937                       ", 0xE312, 0x00, 0x78, 0x65, 0x27, 0xFB },
-  { "BMI $F944                       ", 0xF937, 0x00, 0x78, 0x65, 0x27, 0xF9 },
-  { "BCC $F944                       ", 0xF939, 0x00, 0x78, 0x65, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF93B, 0x00, 0x78, 0x65, 0x27, 0xF9 },
-  { "BVS $F944                       ", 0xF93D, 0x00, 0x78, 0x65, 0x27, 0xF9 },
-  { "CMP #$00                        ", 0xF93F, 0x00, 0x78, 0x65, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF941, 0x00, 0x78, 0x65, 0x27, 0xF9 },
-  { "RTS                             ", 0xF943, 0x00, 0x78, 0x65, 0x27, 0xF9 },
-  { "INY                             ", 0xE315, 0x00, 0x78, 0x65, 0x27, 0xFB },
-  { "LDA #$3F                        ", 0xE316, 0x00, 0x78, 0x66, 0x25, 0xFB },
-  { "STA $0678 = 40                  ", 0xE318, 0x3F, 0x78, 0x66, 0x25, 0xFB },
-  { "JSR $F947                       ", 0xE31B, 0x3F, 0x78, 0x66, 0x25, 0xFB },
-  { "CLV                             ", 0xF947, 0x3F, 0x78, 0x66, 0x25, 0xF9 },
-  { "SEC                             ", 0xF948, 0x3F, 0x78, 0x66, 0x25, 0xF9 },
-  { "LDA #$40                        ", 0xF949, 0x3F, 0x78, 0x66, 0x25, 0xF9 },
-  { "RTS                             ", 0xF94B, 0x40, 0x78, 0x66, 0x25, 0xF9 },
-  { "SBC $0600,X @ 0678 = 3F         ", 0xE31E, 0x40, 0x78, 0x66, 0x25, 0xFB },
-  { "JSR $F94C                       ", 0xE321, 0x01, 0x78, 0x66, 0x25, 0xFB },
-  { "BEQ $F959                       ", 0xF94C, 0x01, 0x78, 0x66, 0x25, 0xF9 },
-  { "BMI $F959                       ", 0xF94E, 0x01, 0x78, 0x66, 0x25, 0xF9 },
-  { "BCC $F959                       ", 0xF950, 0x01, 0x78, 0x66, 0x25, 0xF9 },
-  { "BVS $F959                       ", 0xF952, 0x01, 0x78, 0x66, 0x25, 0xF9 },
-  { "CMP #$01                        ", 0xF954, 0x01, 0x78, 0x66, 0x25, 0xF9 },
-  { "BNE $F959                       ", 0xF956, 0x01, 0x78, 0x66, 0x27, 0xF9 },
-  { "RTS                             ", 0xF958, 0x01, 0x78, 0x66, 0x27, 0xF9 },
-  { "INY                             ", 0xE324, 0x01, 0x78, 0x66, 0x27, 0xFB },
-  { "LDA #$41                        ", 0xE325, 0x01, 0x78, 0x67, 0x25, 0xFB },
-  { "STA $0678 = 3F                  ", 0xE327, 0x41, 0x78, 0x67, 0x25, 0xFB },
-  { "JSR $F95C                       ", 0xE32A, 0x41, 0x78, 0x67, 0x25, 0xFB },
-  { "LDA #$40                        ", 0xF95C, 0x41, 0x78, 0x67, 0x25, 0xF9 },
-  { "SEC                             ", 0xF95E, 0x40, 0x78, 0x67, 0x25, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF95F, 0x40, 0x78, 0x67, 0x25, 0xF9 },
-  { "RTS                             ", 0xF961, 0x40, 0x78, 0x67, 0xE5, 0xF9 },
-  { "SBC $0600,X @ 0678 = 41         ", 0xE32D, 0x40, 0x78, 0x67, 0xE5, 0xFB },
-  { "JSR $F962                       ", 0xE330, 0xFF, 0x78, 0x67, 0xA4, 0xFB },
-  { "BCS $F96F                       ", 0xF962, 0xFF, 0x78, 0x67, 0xA4, 0xF9 },
-  { "BEQ $F96F                       ", 0xF964, 0xFF, 0x78, 0x67, 0xA4, 0xF9 },
-  { "BPL $F96F                       ", 0xF966, 0xFF, 0x78, 0x67, 0xA4, 0xF9 },
-  { "BVS $F96F                       ", 0xF968, 0xFF, 0x78, 0x67, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF96A, 0xFF, 0x78, 0x67, 0xA4, 0xF9 },
-  { "BNE $F96F                       ", 0xF96C, 0xFF, 0x78, 0x67, 0x27, 0xF9 },
-  { "RTS                             ", 0xF96E, 0xFF, 0x78, 0x67, 0x27, 0xF9 },
-  { "INY                             ", 0xE333, 0xFF, 0x78, 0x67, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xE334, 0xFF, 0x78, 0x68, 0x25, 0xFB },
-  { "STA $0678 = 41                  ", 0xE336, 0x00, 0x78, 0x68, 0x27, 0xFB },
-  { "JSR $F972                       ", 0xE339, 0x00, 0x78, 0x68, 0x27, 0xFB },
-  { "CLC                             ", 0xF972, 0x00, 0x78, 0x68, 0x27, 0xF9 },
-  { "LDA #$80                        ", 0xF973, 0x00, 0x78, 0x68, 0x26, 0xF9 },
-  { "RTS                             ", 0xF975, 0x80, 0x78, 0x68, 0xA4, 0xF9 },
-  { "SBC $0600,X @ 0678 = 00         ", 0xE33C, 0x80, 0x78, 0x68, 0xA4, 0xFB },
-  { "JSR $F976                       ", 0xE33F, 0x7F, 0x78, 0x68, 0x65, 0xFB },
-  { "BCC $F97D                       ", 0xF976, 0x7F, 0x78, 0x68, 0x65, 0xF9 },
-  { "CMP #$7F                        ", 0xF978, 0x7F, 0x78, 0x68, 0x65, 0xF9 },
-  { "BNE $F97D                       ", 0xF97A, 0x7F, 0x78, 0x68, 0x67, 0xF9 },
-  { "RTS                             ", 0xF97C, 0x7F, 0x78, 0x68, 0x67, 0xF9 },
-  { "INY                             ", 0xE342, 0x7F, 0x78, 0x68, 0x67, 0xFB },
-  { "LDA #$7F                        ", 0xE343, 0x7F, 0x78, 0x69, 0x65, 0xFB },
-  { "STA $0678 = 00                  ", 0xE345, 0x7F, 0x78, 0x69, 0x65, 0xFB },
-  { "JSR $F980                       ", 0xE348, 0x7F, 0x78, 0x69, 0x65, 0xFB },
-  { "SEC                             ", 0xF980, 0x7F, 0x78, 0x69, 0x65, 0xF9 },
-  { "LDA #$81                        ", 0xF981, 0x7F, 0x78, 0x69, 0x65, 0xF9 },
-  { "RTS                             ", 0xF983, 0x81, 0x78, 0x69, 0xE5, 0xF9 },
-  { "SBC $0600,X @ 0678 = 7F         ", 0xE34B, 0x81, 0x78, 0x69, 0xE5, 0xFB },
-  { "JSR $F984                       ", 0xE34E, 0x02, 0x78, 0x69, 0x65, 0xFB },
-  { "BVC $F98D                       ", 0xF984, 0x02, 0x78, 0x69, 0x65, 0xF9 },
-  { "BCC $F98D                       ", 0xF986, 0x02, 0x78, 0x69, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xF988, 0x02, 0x78, 0x69, 0x65, 0xF9 },
-  { "BNE $F98D                       ", 0xF98A, 0x02, 0x78, 0x69, 0x67, 0xF9 },
-  { "RTS                             ", 0xF98C, 0x02, 0x78, 0x69, 0x67, 0xF9 },
-  { "LDA #$AA                        ", 0xE351, 0x02, 0x78, 0x69, 0x67, 0xFB },
-  { "STA $0633 = AA                  ", 0xE353, 0xAA, 0x78, 0x69, 0xE5, 0xFB },
-  { "LDA #$BB                        ", 0xE356, 0xAA, 0x78, 0x69, 0xE5, 0xFB },
-  { "STA $0689 = BB                  ", 0xE358, 0xBB, 0x78, 0x69, 0xE5, 0xFB },
-  { "LDX #$00                        ", 0xE35B, 0xBB, 0x78, 0x69, 0xE5, 0xFB },
-  { "LDY #$66                        ", 0xE35D, 0xBB, 0x00, 0x69, 0x67, 0xFB },
-  { "BIT $01 = FF                    ", 0xE35F, 0xBB, 0x00, 0x66, 0x65, 0xFB },
-  { "SEC                             ", 0xE361, 0xBB, 0x00, 0x66, 0xE5, 0xFB },
-  { "LDA #$00                        ", 0xE362, 0xBB, 0x00, 0x66, 0xE5, 0xFB },
-  { "LDA $0633,X @ 0633 = AA         ", 0xE364, 0x00, 0x00, 0x66, 0x67, 0xFB },
-  { "BPL $E37B                       ", 0xE367, 0xAA, 0x00, 0x66, 0xE5, 0xFB },
-  { "BEQ $E37B                       ", 0xE369, 0xAA, 0x00, 0x66, 0xE5, 0xFB },
-  { "BVC $E37B                       ", 0xE36B, 0xAA, 0x00, 0x66, 0xE5, 0xFB },
-  { "BCC $E37B                       ", 0xE36D, 0xAA, 0x00, 0x66, 0xE5, 0xFB },
-  { "CPY #$66                        ", 0xE36F, 0xAA, 0x00, 0x66, 0xE5, 0xFB },
-  { "BNE $E37B                       ", 0xE371, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "CPX #$00                        ", 0xE373, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "BNE $E37B                       ", 0xE375, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "CMP #$AA                        ", 0xE377, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "BEQ $E37F                       ", 0xE379, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "LDX #$8A                        ", 0xE37F, 0xAA, 0x00, 0x66, 0x67, 0xFB },
-  { "LDY #$66                        ", 0xE381, 0xAA, 0x8A, 0x66, 0xE5, 0xFB },
-  { "CLV                             ", 0xE383, 0xAA, 0x8A, 0x66, 0x65, 0xFB },
-  { "CLC                             ", 0xE384, 0xAA, 0x8A, 0x66, 0x25, 0xFB },
-  { "LDA #$00                        ", 0xE385, 0xAA, 0x8A, 0x66, 0x24, 0xFB },
-  { "LDA $05FF,X @ 0689 = BB         ", 0xE387, 0x00, 0x8A, 0x66, 0x26, 0xFB },
-  { "BPL $E39E                       ", 0xE38A, 0xBB, 0x8A, 0x66, 0xA4, 0xFB },
-  { "BEQ $E39E                       ", 0xE38C, 0xBB, 0x8A, 0x66, 0xA4, 0xFB },
-  { "BVS $E39E                       ", 0xE38E, 0xBB, 0x8A, 0x66, 0xA4, 0xFB },
-  { "BCS $E39E                       ", 0xE390, 0xBB, 0x8A, 0x66, 0xA4, 0xFB },
-  { "CMP #$BB                        ", 0xE392, 0xBB, 0x8A, 0x66, 0xA4, 0xFB },
-  { "BNE $E39E                       ", 0xE394, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "CPY #$66                        ", 0xE396, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "BNE $E39E                       ", 0xE398, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "CPX #$8A                        ", 0xE39A, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "BEQ $E3A2                       ", 0xE39C, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xE3A2, 0xBB, 0x8A, 0x66, 0x27, 0xFB },
-  { "SEC                             ", 0xE3A4, 0xBB, 0x8A, 0x66, 0xE5, 0xFB },
-  { "LDA #$44                        ", 0xE3A5, 0xBB, 0x8A, 0x66, 0xE5, 0xFB },
-  { "LDX #$00                        ", 0xE3A7, 0x44, 0x8A, 0x66, 0x65, 0xFB },
-  { "STA $0633,X @ 0633 = AA         ", 0xE3A9, 0x44, 0x00, 0x66, 0x67, 0xFB },
-  { "LDA $0633 = 44                  ", 0xE3AC, 0x44, 0x00, 0x66, 0x67, 0xFB },
-  { "BCC $E3CB                       ", 0xE3AF, 0x44, 0x00, 0x66, 0x65, 0xFB },
-  { "CMP #$44                        ", 0xE3B1, 0x44, 0x00, 0x66, 0x65, 0xFB },
-  { "BNE $E3CB                       ", 0xE3B3, 0x44, 0x00, 0x66, 0x67, 0xFB },
-  { "BVC $E3CB                       ", 0xE3B5, 0x44, 0x00, 0x66, 0x67, 0xFB },
-  { "CLC                             ", 0xE3B7, 0x44, 0x00, 0x66, 0x67, 0xFB },
-  { "CLV                             ", 0xE3B8, 0x44, 0x00, 0x66, 0x66, 0xFB },
-  { "LDA #$99                        ", 0xE3B9, 0x44, 0x00, 0x66, 0x26, 0xFB },
-  { "LDX #$80                        ", 0xE3BB, 0x99, 0x00, 0x66, 0xA4, 0xFB },
-  { "STA $0585,X @ 0605 = 00         ", 0xE3BD, 0x99, 0x80, 0x66, 0xA4, 0xFB },
-  { "LDA $0605 = 99                  ", 0xE3C0, 0x99, 0x80, 0x66, 0xA4, 0xFB },
-  { "BCS $E3CB                       ", 0xE3C3, 0x99, 0x80, 0x66, 0xA4, 0xFB },
-  { "CMP #$99                        ", 0xE3C5, 0x99, 0x80, 0x66, 0xA4, 0xFB },
-  { "BNE $E3CB                       ", 0xE3C7, 0x99, 0x80, 0x66, 0x27, 0xFB },
-  { "BVC $E3CF                       ", 0xE3C9, 0x99, 0x80, 0x66, 0x27, 0xFB },
-  { "LDY #$6D                        ", 0xE3CF, 0x99, 0x80, 0x66, 0x27, 0xFB },
-  { "LDX #$6D                        ", 0xE3D1, 0x99, 0x80, 0x6D, 0x25, 0xFB },
-  { "JSR $F990                       ", 0xE3D3, 0x99, 0x6D, 0x6D, 0x25, 0xFB },
-  { "LDX #$55                        ", 0xF990, 0x99, 0x6D, 0x6D, 0x25, 0xF9 },
-  { "LDA #$FF                        ", 0xF992, 0x99, 0x55, 0x6D, 0x25, 0xF9 },
-  { "STA $01 = FF                    ", 0xF994, 0xFF, 0x55, 0x6D, 0xA5, 0xF9 },
-  { "NOP                             ", 0xF996, 0xFF, 0x55, 0x6D, 0xA5, 0xF9 },
-  { "BIT $01 = FF                    ", 0xF997, 0xFF, 0x55, 0x6D, 0xA5, 0xF9 },
-  { "SEC                             ", 0xF999, 0xFF, 0x55, 0x6D, 0xE5, 0xF9 },
-  { "LDA #$01                        ", 0xF99A, 0xFF, 0x55, 0x6D, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF99C, 0x01, 0x55, 0x6D, 0x65, 0xF9 },
-  { "STA $0600,X @ 0655 = 00         ", 0xE3D6, 0x01, 0x55, 0x6D, 0x65, 0xFB },
-  { "LSR $0600,X @ 0655 = 01         ", 0xE3D9, 0x01, 0x55, 0x6D, 0x65, 0xFB },
-  { "LDA $0600,X @ 0655 = 00         ", 0xE3DC, 0x01, 0x55, 0x6D, 0x67, 0xFB },
-  { "JSR $F99D                       ", 0xE3DF, 0x00, 0x55, 0x6D, 0x67, 0xFB },
-  { "BCC $F9BA                       ", 0xF99D, 0x00, 0x55, 0x6D, 0x67, 0xF9 },
-  { "BNE $F9BA                       ", 0xF99F, 0x00, 0x55, 0x6D, 0x67, 0xF9 },
-  { "BMI $F9BA                       ", 0xF9A1, 0x00, 0x55, 0x6D, 0x67, 0xF9 },
-  { "BVC $F9BA                       ", 0xF9A3, 0x00, 0x55, 0x6D, 0x67, 0xF9 },
-  { "CMP #$00                        ", 0xF9A5, 0x00, 0x55, 0x6D, 0x67, 0xF9 },
-  { "BNE $F9BA                       ", 0xF9A7, 0x00, 0x55, 0x6D, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9A9, 0x00, 0x55, 0x6D, 0x67, 0xF9 },
-  { "LDA #$AA                        ", 0xF9AA, 0x00, 0x55, 0x6D, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9AC, 0xAA, 0x55, 0x6D, 0xA5, 0xF9 },
-  { "INY                             ", 0xE3E2, 0xAA, 0x55, 0x6D, 0xA5, 0xFB },
-  { "STA $0600,X @ 0655 = 00         ", 0xE3E3, 0xAA, 0x55, 0x6E, 0x25, 0xFB },
-  { "LSR $0600,X @ 0655 = AA         ", 0xE3E6, 0xAA, 0x55, 0x6E, 0x25, 0xFB },
-  { "LDA $0600,X @ 0655 = 55         ", 0xE3E9, 0xAA, 0x55, 0x6E, 0x24, 0xFB },
-  { "JSR $F9AD                       ", 0xE3EC, 0x55, 0x55, 0x6E, 0x24, 0xFB },
-  { "BCS $F9BA                       ", 0xF9AD, 0x55, 0x55, 0x6E, 0x24, 0xF9 },
-  { "BEQ $F9BA                       ", 0xF9AF, 0x55, 0x55, 0x6E, 0x24, 0xF9 },
-  { "BMI $F9BA                       ", 0xF9B1, 0x55, 0x55, 0x6E, 0x24, 0xF9 },
-  { "BVS $F9BA                       ", 0xF9B3, 0x55, 0x55, 0x6E, 0x24, 0xF9 },
-  { "CMP #$55                        ", 0xF9B5, 0x55, 0x55, 0x6E, 0x24, 0xF9 },
-  { "BNE $F9BA                       ", 0xF9B7, 0x55, 0x55, 0x6E, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9B9, 0x55, 0x55, 0x6E, 0x27, 0xF9 },
-  { "INY                             ", 0xE3EF, 0x55, 0x55, 0x6E, 0x27, 0xFB },
-  { "JSR $F9BD                       ", 0xE3F0, 0x55, 0x55, 0x6F, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF9BD, 0x55, 0x55, 0x6F, 0x25, 0xF9 },
-  { "SEC                             ", 0xF9BF, 0x55, 0x55, 0x6F, 0xE5, 0xF9 },
-  { "LDA #$80                        ", 0xF9C0, 0x55, 0x55, 0x6F, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF9C2, 0x80, 0x55, 0x6F, 0xE5, 0xF9 },
-  { "STA $0600,X @ 0655 = 55         ", 0xE3F3, 0x80, 0x55, 0x6F, 0xE5, 0xFB },
-  { "ASL $0600,X @ 0655 = 80         ", 0xE3F6, 0x80, 0x55, 0x6F, 0xE5, 0xFB },
-  { "LDA $0600,X @ 0655 = 00         ", 0xE3F9, 0x80, 0x55, 0x6F, 0x67, 0xFB },
-  { "JSR $F9C3                       ", 0xE3FC, 0x00, 0x55, 0x6F, 0x67, 0xFB },
-  { "BCC $F9E1                       ", 0xF9C3, 0x00, 0x55, 0x6F, 0x67, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9C5, 0x00, 0x55, 0x6F, 0x67, 0xF9 },
-  { "BMI $F9E1                       ", 0xF9C7, 0x00, 0x55, 0x6F, 0x67, 0xF9 },
-  { "BVC $F9E1                       ", 0xF9C9, 0x00, 0x55, 0x6F, 0x67, 0xF9 },
-  { "CMP #$00                        ", 0xF9CB, 0x00, 0x55, 0x6F, 0x67, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9CD, 0x00, 0x55, 0x6F, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9CF, 0x00, 0x55, 0x6F, 0x67, 0xF9 },
-  { "LDA #$55                        ", 0xF9D0, 0x00, 0x55, 0x6F, 0x27, 0xF9 },
-  { "SEC                             ", 0xF9D2, 0x55, 0x55, 0x6F, 0x25, 0xF9 },
-  { "RTS                             ", 0xF9D3, 0x55, 0x55, 0x6F, 0x25, 0xF9 },
-  { "INY                             ", 0xE3FF, 0x55, 0x55, 0x6F, 0x25, 0xFB },
-  { "STA $0600,X @ 0655 = 00         ", 0xE400, 0x55, 0x55, 0x70, 0x25, 0xFB },
-  { "ASL $0600,X @ 0655 = 55         ", 0xE403, 0x55, 0x55, 0x70, 0x25, 0xFB },
-  { "LDA $0600,X @ 0655 = AA         ", 0xE406, 0x55, 0x55, 0x70, 0xA4, 0xFB },
-  { "JSR $F9D4                       ", 0xE409, 0xAA, 0x55, 0x70, 0xA4, 0xFB },
-  { "BCS $F9E1                       ", 0xF9D4, 0xAA, 0x55, 0x70, 0xA4, 0xF9 },
-  { "BEQ $F9E1                       ", 0xF9D6, 0xAA, 0x55, 0x70, 0xA4, 0xF9 },
-  { "BPL $F9E1                       ", 0xF9D8, 0xAA, 0x55, 0x70, 0xA4, 0xF9 },
-  { "BVS $F9E1                       ", 0xF9DA, 0xAA, 0x55, 0x70, 0xA4, 0xF9 },
-  { "CMP #$AA                        ", 0xF9DC, 0xAA, 0x55, 0x70, 0xA4, 0xF9 },
-  { "BNE $F9E1                       ", 0xF9DE, 0xAA, 0x55, 0x70, 0x27, 0xF9 },
-  { "RTS                             ", 0xF9E0, 0xAA, 0x55, 0x70, 0x27, 0xF9 },
-  { "INY                             ", 0xE40C, 0xAA, 0x55, 0x70, 0x27, 0xFB },
-  { "JSR $F9E4                       ", 0xE40D, 0xAA, 0x55, 0x71, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xF9E4, 0xAA, 0x55, 0x71, 0x25, 0xF9 },
-  { "SEC                             ", 0xF9E6, 0xAA, 0x55, 0x71, 0xE5, 0xF9 },
-  { "LDA #$01                        ", 0xF9E7, 0xAA, 0x55, 0x71, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF9E9, 0x01, 0x55, 0x71, 0x65, 0xF9 },
-  { "STA $0600,X @ 0655 = AA         ", 0xE410, 0x01, 0x55, 0x71, 0x65, 0xFB },
-  { "ROR $0600,X @ 0655 = 01         ", 0xE413, 0x01, 0x55, 0x71, 0x65, 0xFB },
-  { "LDA $0600,X @ 0655 = 80         ", 0xE416, 0x01, 0x55, 0x71, 0xE5, 0xFB },
-  { "JSR $F9EA                       ", 0xE419, 0x80, 0x55, 0x71, 0xE5, 0xFB },
-  { "BCC $FA08                       ", 0xF9EA, 0x80, 0x55, 0x71, 0xE5, 0xF9 },
-  { "BEQ $FA08                       ", 0xF9EC, 0x80, 0x55, 0x71, 0xE5, 0xF9 },
-  { "BPL $FA08                       ", 0xF9EE, 0x80, 0x55, 0x71, 0xE5, 0xF9 },
-  { "BVC $FA08                       ", 0xF9F0, 0x80, 0x55, 0x71, 0xE5, 0xF9 },
-  { "CMP #$80                        ", 0xF9F2, 0x80, 0x55, 0x71, 0xE5, 0xF9 },
-  { "BNE $FA08                       ", 0xF9F4, 0x80, 0x55, 0x71, 0x67, 0xF9 },
-  { "CLV                             ", 0xF9F6, 0x80, 0x55, 0x71, 0x67, 0xF9 },
-  { "CLC                             ", 0xF9F7, 0x80, 0x55, 0x71, 0x27, 0xF9 },
-  { "LDA #$55                        ", 0xF9F8, 0x80, 0x55, 0x71, 0x26, 0xF9 },
-  { "RTS                             ", 0xF9FA, 0x55, 0x55, 0x71, 0x24, 0xF9 },
-  { "INY                             ", 0xE41C, 0x55, 0x55, 0x71, 0x24, 0xFB },
-  { "STA $0600,X @ 0655 = 80         ", 0xE41D, 0x55, 0x55, 0x72, 0x24, 0xFB },
-  { "ROR $0600,X @ 0655 = 55         ", 0xE420, 0x55, 0x55, 0x72, 0x24, 0xFB },
-  { "LDA $0600,X @ 0655 = 2A         ", 0xE423, 0x55, 0x55, 0x72, 0x25, 0xFB },
-  { "JSR $F9FB                       ", 0xE426, 0x2A, 0x55, 0x72, 0x25, 0xFB },
-  { "BCC $FA08                       ", 0xF9FB, 0x2A, 0x55, 0x72, 0x25, 0xF9 },
-  { "BEQ $FA08                       ", 0xF9FD, 0x2A, 0x55, 0x72, 0x25, 0xF9 },
-  { "BMI $FA08                       ", 0xF9FF, 0x2A, 0x55, 0x72, 0x25, 0xF9 },
-  { "BVS $FA08                       ", 0xFA01, 0x2A, 0x55, 0x72, 0x25, 0xF9 },
-  { "CMP #$2A                        ", 0xFA03, 0x2A, 0x55, 0x72, 0x25, 0xF9 },
-  { "BNE $FA08                       ", 0xFA05, 0x2A, 0x55, 0x72, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA07, 0x2A, 0x55, 0x72, 0x27, 0xF9 },
-  { "INY                             ", 0xE429, 0x2A, 0x55, 0x72, 0x27, 0xFB },
-  { "JSR $FA0A                       ", 0xE42A, 0x2A, 0x55, 0x73, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA0A, 0x2A, 0x55, 0x73, 0x25, 0xF9 },
-  { "SEC                             ", 0xFA0C, 0x2A, 0x55, 0x73, 0xE5, 0xF9 },
-  { "LDA #$80                        ", 0xFA0D, 0x2A, 0x55, 0x73, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA0F, 0x80, 0x55, 0x73, 0xE5, 0xF9 },
-  { "STA $0600,X @ 0655 = 2A         ", 0xE42D, 0x80, 0x55, 0x73, 0xE5, 0xFB },
-  { "ROL $0600,X @ 0655 = 80         ", 0xE430, 0x80, 0x55, 0x73, 0xE5, 0xFB },
-  { "LDA $0600,X @ 0655 = 01         ", 0xE433, 0x80, 0x55, 0x73, 0x65, 0xFB },
-  { "JSR $FA10                       ", 0xE436, 0x01, 0x55, 0x73, 0x65, 0xFB },
-  { "BCC $FA2E                       ", 0xFA10, 0x01, 0x55, 0x73, 0x65, 0xF9 },
-  { "BEQ $FA2E                       ", 0xFA12, 0x01, 0x55, 0x73, 0x65, 0xF9 },
-  { "BMI $FA2E                       ", 0xFA14, 0x01, 0x55, 0x73, 0x65, 0xF9 },
-  { "BVC $FA2E                       ", 0xFA16, 0x01, 0x55, 0x73, 0x65, 0xF9 },
-  { "CMP #$01                        ", 0xFA18, 0x01, 0x55, 0x73, 0x65, 0xF9 },
-  { "BNE $FA2E                       ", 0xFA1A, 0x01, 0x55, 0x73, 0x67, 0xF9 },
-  { "CLV                             ", 0xFA1C, 0x01, 0x55, 0x73, 0x67, 0xF9 },
-  { "CLC                             ", 0xFA1D, 0x01, 0x55, 0x73, 0x27, 0xF9 },
-  { "LDA #$55                        ", 0xFA1E, 0x01, 0x55, 0x73, 0x26, 0xF9 },
-  { "RTS                             ", 0xFA20, 0x55, 0x55, 0x73, 0x24, 0xF9 },
-  { "INY                             ", 0xE439, 0x55, 0x55, 0x73, 0x24, 0xFB },
-  { "STA $0600,X @ 0655 = 01         ", 0xE43A, 0x55, 0x55, 0x74, 0x24, 0xFB },
-  { "ROL $0600,X @ 0655 = 55         ", 0xE43D, 0x55, 0x55, 0x74, 0x24, 0xFB },
-  { "LDA $0600,X @ 0655 = AA         ", 0xE440, 0x55, 0x55, 0x74, 0xA4, 0xFB },
-  { "JSR $FA21                       ", 0xE443, 0xAA, 0x55, 0x74, 0xA4, 0xFB },
-  { "BCS $FA2E                       ", 0xFA21, 0xAA, 0x55, 0x74, 0xA4, 0xF9 },
-  { "BEQ $FA2E                       ", 0xFA23, 0xAA, 0x55, 0x74, 0xA4, 0xF9 },
-  { "BPL $FA2E                       ", 0xFA25, 0xAA, 0x55, 0x74, 0xA4, 0xF9 },
-  { "BVS $FA2E                       ", 0xFA27, 0xAA, 0x55, 0x74, 0xA4, 0xF9 },
-  { "CMP #$AA                        ", 0xFA29, 0xAA, 0x55, 0x74, 0xA4, 0xF9 },
-  { "BNE $FA2E                       ", 0xFA2B, 0xAA, 0x55, 0x74, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA2D, 0xAA, 0x55, 0x74, 0x27, 0xF9 },
-  { "LDA #$FF                        ", 0xE446, 0xAA, 0x55, 0x74, 0x27, 0xFB },
-  { "STA $0600,X @ 0655 = AA         ", 0xE448, 0xFF, 0x55, 0x74, 0xA5, 0xFB },
-  { "STA $01 = FF                    ", 0xE44B, 0xFF, 0x55, 0x74, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xE44D, 0xFF, 0x55, 0x74, 0xA5, 0xFB },
-  { "SEC                             ", 0xE44F, 0xFF, 0x55, 0x74, 0xE5, 0xFB },
-  { "INC $0600,X @ 0655 = FF         ", 0xE450, 0xFF, 0x55, 0x74, 0xE5, 0xFB },
-  { "BNE $E462                       ", 0xE453, 0xFF, 0x55, 0x74, 0x67, 0xFB },
-  { "BMI $E462                       ", 0xE455, 0xFF, 0x55, 0x74, 0x67, 0xFB },
-  { "BVC $E462                       ", 0xE457, 0xFF, 0x55, 0x74, 0x67, 0xFB },
-  { "BCC $E462                       ", 0xE459, 0xFF, 0x55, 0x74, 0x67, 0xFB },
-  { "LDA $0600,X @ 0655 = 00         ", 0xE45B, 0xFF, 0x55, 0x74, 0x67, 0xFB },
-  { "CMP #$00                        ", 0xE45E, 0x00, 0x55, 0x74, 0x67, 0xFB },
-  { "BEQ $E466                       ", 0xE460, 0x00, 0x55, 0x74, 0x67, 0xFB },
-  { "LDA #$7F                        ", 0xE466, 0x00, 0x55, 0x74, 0x67, 0xFB },
-  { "STA $0600,X @ 0655 = 00         ", 0xE468, 0x7F, 0x55, 0x74, 0x65, 0xFB },
-  { "CLV                             ", 0xE46B, 0x7F, 0x55, 0x74, 0x65, 0xFB },
-  { "CLC                             ", 0xE46C, 0x7F, 0x55, 0x74, 0x25, 0xFB },
-  { "INC $0600,X @ 0655 = 7F         ", 0xE46D, 0x7F, 0x55, 0x74, 0x24, 0xFB },
-  { "BEQ $E47F                       ", 0xE470, 0x7F, 0x55, 0x74, 0xA4, 0xFB },
-  { "BPL $E47F                       ", 0xE472, 0x7F, 0x55, 0x74, 0xA4, 0xFB },
-  { "BVS $E47F                       ", 0xE474, 0x7F, 0x55, 0x74, 0xA4, 0xFB },
-  { "BCS $E47F                       ", 0xE476, 0x7F, 0x55, 0x74, 0xA4, 0xFB },
-  { "LDA $0600,X @ 0655 = 80         ", 0xE478, 0x7F, 0x55, 0x74, 0xA4, 0xFB },
-  { "CMP #$80                        ", 0xE47B, 0x80, 0x55, 0x74, 0xA4, 0xFB },
-  { "BEQ $E483                       ", 0xE47D, 0x80, 0x55, 0x74, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xE483, 0x80, 0x55, 0x74, 0x27, 0xFB },
-  { "STA $0600,X @ 0655 = 80         ", 0xE485, 0x00, 0x55, 0x74, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xE488, 0x00, 0x55, 0x74, 0x27, 0xFB },
-  { "SEC                             ", 0xE48A, 0x00, 0x55, 0x74, 0xE7, 0xFB },
-  { "DEC $0600,X @ 0655 = 00         ", 0xE48B, 0x00, 0x55, 0x74, 0xE7, 0xFB },
-  { "BEQ $E49D                       ", 0xE48E, 0x00, 0x55, 0x74, 0xE5, 0xFB },
-  { "BPL $E49D                       ", 0xE490, 0x00, 0x55, 0x74, 0xE5, 0xFB },
-  { "BVC $E49D                       ", 0xE492, 0x00, 0x55, 0x74, 0xE5, 0xFB },
-  { "BCC $E49D                       ", 0xE494, 0x00, 0x55, 0x74, 0xE5, 0xFB },
-  { "LDA $0600,X @ 0655 = FF         ", 0xE496, 0x00, 0x55, 0x74, 0xE5, 0xFB },
-  { "CMP #$FF                        ", 0xE499, 0xFF, 0x55, 0x74, 0xE5, 0xFB },
-  { "BEQ $E4A1                       ", 0xE49B, 0xFF, 0x55, 0x74, 0x67, 0xFB },
-  { "LDA #$80                        ", 0xE4A1, 0xFF, 0x55, 0x74, 0x67, 0xFB },
-  { "STA $0600,X @ 0655 = FF         ", 0xE4A3, 0x80, 0x55, 0x74, 0xE5, 0xFB },
-  { "CLV                             ", 0xE4A6, 0x80, 0x55, 0x74, 0xE5, 0xFB },
-  { "CLC                             ", 0xE4A7, 0x80, 0x55, 0x74, 0xA5, 0xFB },
-  { "DEC $0600,X @ 0655 = 80         ", 0xE4A8, 0x80, 0x55, 0x74, 0xA4, 0xFB },
-  { "BEQ $E4BA                       ", 0xE4AB, 0x80, 0x55, 0x74, 0x24, 0xFB },
-  { "BMI $E4BA                       ", 0xE4AD, 0x80, 0x55, 0x74, 0x24, 0xFB },
-  { "BVS $E4BA                       ", 0xE4AF, 0x80, 0x55, 0x74, 0x24, 0xFB },
-  { "BCS $E4BA                       ", 0xE4B1, 0x80, 0x55, 0x74, 0x24, 0xFB },
-  { "LDA $0600,X @ 0655 = 7F         ", 0xE4B3, 0x80, 0x55, 0x74, 0x24, 0xFB },
-  { "CMP #$7F                        ", 0xE4B6, 0x7F, 0x55, 0x74, 0x24, 0xFB },
-  { "BEQ $E4BE                       ", 0xE4B8, 0x7F, 0x55, 0x74, 0x27, 0xFB },
-  { "LDA #$01                        ", 0xE4BE, 0x7F, 0x55, 0x74, 0x27, 0xFB },
-  { "STA $0600,X @ 0655 = 7F         ", 0xE4C0, 0x01, 0x55, 0x74, 0x25, 0xFB },
-  { "DEC $0600,X @ 0655 = 01         ", 0xE4C3, 0x01, 0x55, 0x74, 0x25, 0xFB },
-  { "BEQ $E4CC                       ", 0xE4C6, 0x01, 0x55, 0x74, 0x27, 0xFB },
-  { "LDA #$33                        ", 0xE4CC, 0x01, 0x55, 0x74, 0x27, 0xFB },
-  { "STA $0678 = 7F                  ", 0xE4CE, 0x33, 0x55, 0x74, 0x25, 0xFB },
-  { "LDA #$44                        ", 0xE4D1, 0x33, 0x55, 0x74, 0x25, 0xFB },
-  { "LDY #$78                        ", 0xE4D3, 0x44, 0x55, 0x74, 0x25, 0xFB },
-  { "LDX #$00                        ", 0xE4D5, 0x44, 0x55, 0x78, 0x25, 0xFB },
-  { "SEC                             ", 0xE4D7, 0x44, 0x00, 0x78, 0x27, 0xFB },
-  { "BIT $01 = FF                    ", 0xE4D8, 0x44, 0x00, 0x78, 0x27, 0xFB },
-  { "LDX $0600,Y @ 0678 = 33         ", 0xE4DA, 0x44, 0x00, 0x78, 0xE5, 0xFB },
-  { "BCC $E4F1                       ", 0xE4DD, 0x44, 0x33, 0x78, 0x65, 0xFB },
-  { "BVC $E4F1                       ", 0xE4DF, 0x44, 0x33, 0x78, 0x65, 0xFB },
-  { "BMI $E4F1                       ", 0xE4E1, 0x44, 0x33, 0x78, 0x65, 0xFB },
-  { "BEQ $E4F1                       ", 0xE4E3, 0x44, 0x33, 0x78, 0x65, 0xFB },
-  { "CPX #$33                        ", 0xE4E5, 0x44, 0x33, 0x78, 0x65, 0xFB },
-  { "BNE $E4F1                       ", 0xE4E7, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "CPY #$78                        ", 0xE4E9, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "BNE $E4F1                       ", 0xE4EB, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "CMP #$44                        ", 0xE4ED, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "BEQ $E4F5                       ", 0xE4EF, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "LDA #$97                        ", 0xE4F5, 0x44, 0x33, 0x78, 0x67, 0xFB },
-  { "STA $067F = 00                  ", 0xE4F7, 0x97, 0x33, 0x78, 0xE5, 0xFB },
-  { "LDA #$47                        ", 0xE4FA, 0x97, 0x33, 0x78, 0xE5, 0xFB },
-  { "LDY #$FF                        ", 0xE4FC, 0x47, 0x33, 0x78, 0x65, 0xFB },
-  { "LDX #$00                        ", 0xE4FE, 0x47, 0x33, 0xFF, 0xE5, 0xFB },
-  { "CLC                             ", 0xE500, 0x47, 0x00, 0xFF, 0x67, 0xFB },
-  { "CLV                             ", 0xE501, 0x47, 0x00, 0xFF, 0x66, 0xFB },
-  { "LDX $0580,Y @ 067F = 97         ", 0xE502, 0x47, 0x00, 0xFF, 0x26, 0xFB },
-  { "BCS $E519                       ", 0xE505, 0x47, 0x97, 0xFF, 0xA4, 0xFB },
-  { "BVS $E519                       ", 0xE507, 0x47, 0x97, 0xFF, 0xA4, 0xFB },
-  { "BPL $E519                       ", 0xE509, 0x47, 0x97, 0xFF, 0xA4, 0xFB },
-  { "BEQ $E519                       ", 0xE50B, 0x47, 0x97, 0xFF, 0xA4, 0xFB },
-  { "CPX #$97                        ", 0xE50D, 0x47, 0x97, 0xFF, 0xA4, 0xFB },
-  { "BNE $E519                       ", 0xE50F, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "CPY #$FF                        ", 0xE511, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "BNE $E519                       ", 0xE513, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "CMP #$47                        ", 0xE515, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "BEQ $E51D                       ", 0xE517, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "RTS                             ", 0xE51D, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "JSR $C6A3                       ", 0xC62F, 0x47, 0x97, 0xFF, 0x27, 0xFD },
-  { "LDY #$4E                        ", 0xC6A3, 0x47, 0x97, 0xFF, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xC6A5, 0x47, 0x97, 0x4E, 0x25, 0xFB },
-  { "STA $01 = FF                    ", 0xC6A7, 0xFF, 0x97, 0x4E, 0xA5, 0xFB },
-  { "JSR $C6B0                       ", 0xC6A9, 0xFF, 0x97, 0x4E, 0xA5, 0xFB },
-  { "LDA #$FF                        ", 0xC6B0, 0xFF, 0x97, 0x4E, 0xA5, 0xF9 },
-  { "PHA                             ", 0xC6B2, 0xFF, 0x97, 0x4E, 0xA5, 0xF9 },
-  { "LDA #$AA                        ", 0xC6B3, 0xFF, 0x97, 0x4E, 0xA5, 0xF8 },
-  { "BNE $C6BC                       ", 0xC6B5, 0xAA, 0x97, 0x4E, 0xA5, 0xF8 },
-  { "PLP                             ", 0xC6BC, 0xAA, 0x97, 0x4E, 0xA5, 0xF8 },
-  { "NOP $A9 = 00                    ", 0xC6BD, 0xAA, 0x97, 0x4E, 0xEF, 0xF9 },
-  { "NOP $A9 = 00                    ", 0xC6BF, 0xAA, 0x97, 0x4E, 0xEF, 0xF9 },
-  { "NOP $A9 = 00                    ", 0xC6C1, 0xAA, 0x97, 0x4E, 0xEF, 0xF9 },
-  { "NOP                             ", 0xC6C3, 0xAA, 0x97, 0x4E, 0xEF, 0xF9 },
-  { "NOP                             ", 0xC6C4, 0xAA, 0x97, 0x4E, 0xEF, 0xF9 },
-  { "NOP                             ", 0xC6C5, 0xAA, 0x97, 0x4E, 0xEF, 0xF9 },
-  { "NOP                             ", 0xC6C6, 0xAA, 0x97, 0x4E, 0xEF, 0xF9 },
-  { "PHP                             ", 0xC6C7, 0xAA, 0x97, 0x4E, 0xEF, 0xF9 },
-  { "PHA                             ", 0xC6C8, 0xAA, 0x97, 0x4E, 0xEF, 0xF8 },
-  { "NOP $A9A9 = A9                  ", 0xC6C9, 0xAA, 0x97, 0x4E, 0xEF, 0xF7 },
-  { "NOP                             ", 0xC6CC, 0xAA, 0x97, 0x4E, 0xEF, 0xF7 },
-  { "NOP                             ", 0xC6CD, 0xAA, 0x97, 0x4E, 0xEF, 0xF7 },
-  { "NOP                             ", 0xC6CE, 0xAA, 0x97, 0x4E, 0xEF, 0xF7 },
-  { "NOP                             ", 0xC6CF, 0xAA, 0x97, 0x4E, 0xEF, 0xF7 },
-  { "PHP                             ", 0xC6D0, 0xAA, 0x97, 0x4E, 0xEF, 0xF7 },
-  { "PHA                             ", 0xC6D1, 0xAA, 0x97, 0x4E, 0xEF, 0xF6 },
-  { "NOP $A9,X @ 40 = 00             ", 0xC6D2, 0xAA, 0x97, 0x4E, 0xEF, 0xF5 },
-  { "NOP $A9,X @ 40 = 00             ", 0xC6D4, 0xAA, 0x97, 0x4E, 0xEF, 0xF5 },
-  { "NOP $A9,X @ 40 = 00             ", 0xC6D6, 0xAA, 0x97, 0x4E, 0xEF, 0xF5 },
-  { "NOP $A9,X @ 40 = 00             ", 0xC6D8, 0xAA, 0x97, 0x4E, 0xEF, 0xF5 },
-  { "NOP $A9,X @ 40 = 00             ", 0xC6DA, 0xAA, 0x97, 0x4E, 0xEF, 0xF5 },
-  { "NOP $A9,X @ 40 = 00             ", 0xC6DC, 0xAA, 0x97, 0x4E, 0xEF, 0xF5 },
-  { "NOP                             ", 0xC6DE, 0xAA, 0x97, 0x4E, 0xEF, 0xF5 },
-  { "NOP                             ", 0xC6DF, 0xAA, 0x97, 0x4E, 0xEF, 0xF5 },
-  { "NOP                             ", 0xC6E0, 0xAA, 0x97, 0x4E, 0xEF, 0xF5 },
-  { "NOP                             ", 0xC6E1, 0xAA, 0x97, 0x4E, 0xEF, 0xF5 },
-  { "PHP                             ", 0xC6E2, 0xAA, 0x97, 0x4E, 0xEF, 0xF5 },
-  { "PHA                             ", 0xC6E3, 0xAA, 0x97, 0x4E, 0xEF, 0xF4 },
-  { "NOP                             ", 0xC6E4, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "NOP                             ", 0xC6E5, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "NOP                             ", 0xC6E6, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "NOP                             ", 0xC6E7, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "NOP                             ", 0xC6E8, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "NOP                             ", 0xC6E9, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "NOP #$89                        ", 0xC6EA, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "NOP                             ", 0xC6EC, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "NOP                             ", 0xC6ED, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "NOP                             ", 0xC6EE, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "NOP                             ", 0xC6EF, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "PHP                             ", 0xC6F0, 0xAA, 0x97, 0x4E, 0xEF, 0xF3 },
-  { "PHA                             ", 0xC6F1, 0xAA, 0x97, 0x4E, 0xEF, 0xF2 },
-  { "NOP $A9A9,X @ AA40 = 00         ", 0xC6F2, 0xAA, 0x97, 0x4E, 0xEF, 0xF1 },
-  { "NOP $A9A9,X @ AA40 = 00         ", 0xC6F5, 0xAA, 0x97, 0x4E, 0xEF, 0xF1 },
-  { "NOP $A9A9,X @ AA40 = 00         ", 0xC6F8, 0xAA, 0x97, 0x4E, 0xEF, 0xF1 },
-  { "NOP $A9A9,X @ AA40 = 00         ", 0xC6FB, 0xAA, 0x97, 0x4E, 0xEF, 0xF1 },
-  { "NOP $A9A9,X @ AA40 = 00         ", 0xC6FE, 0xAA, 0x97, 0x4E, 0xEF, 0xF1 },
-  { "NOP $A9A9,X @ AA40 = 00         ", 0xC701, 0xAA, 0x97, 0x4E, 0xEF, 0xF1 },
-  { "NOP                             ", 0xC704, 0xAA, 0x97, 0x4E, 0xEF, 0xF1 },
-  { "NOP                             ", 0xC705, 0xAA, 0x97, 0x4E, 0xEF, 0xF1 },
-  { "NOP                             ", 0xC706, 0xAA, 0x97, 0x4E, 0xEF, 0xF1 },
-  { "NOP                             ", 0xC707, 0xAA, 0x97, 0x4E, 0xEF, 0xF1 },
-  { "PHP                             ", 0xC708, 0xAA, 0x97, 0x4E, 0xEF, 0xF1 },
-  { "PHA                             ", 0xC709, 0xAA, 0x97, 0x4E, 0xEF, 0xF0 },
-  { "LDX #$05                        ", 0xC70A, 0xAA, 0x97, 0x4E, 0xEF, 0xEF },
-  { "PLA                             ", 0xC70C, 0xAA, 0x05, 0x4E, 0x6D, 0xEF },
-  { "CMP #$55                        ", 0xC70D, 0xAA, 0x05, 0x4E, 0xED, 0xF0 },
-  { "BEQ $C71B                       ", 0xC70F, 0xAA, 0x05, 0x4E, 0x6D, 0xF0 },
-  { "CMP #$AA                        ", 0xC711, 0xAA, 0x05, 0x4E, 0x6D, 0xF0 },
-  { "BEQ $C71B                       ", 0xC713, 0xAA, 0x05, 0x4E, 0x6F, 0xF0 },
-  { "PLA                             ", 0xC71B, 0xAA, 0x05, 0x4E, 0x6F, 0xF0 },
-  { "AND #$CB                        ", 0xC71C, 0xFF, 0x05, 0x4E, 0xED, 0xF1 },
-  { "CMP #$00                        ", 0xC71E, 0xCB, 0x05, 0x4E, 0xED, 0xF1 },
-  { "BEQ $C728                       ", 0xC720, 0xCB, 0x05, 0x4E, 0xED, 0xF1 },
-  { "CMP #$CB                        ", 0xC722, 0xCB, 0x05, 0x4E, 0xED, 0xF1 },
-  { "BEQ $C728                       ", 0xC724, 0xCB, 0x05, 0x4E, 0x6F, 0xF1 },
-  { "INY                             ", 0xC728, 0xCB, 0x05, 0x4E, 0x6F, 0xF1 },
-  { "DEX                             ", 0xC729, 0xCB, 0x05, 0x4F, 0x6D, 0xF1 },
-  { "BNE $C70C                       ", 0xC72A, 0xCB, 0x04, 0x4F, 0x6D, 0xF1 },
-  { "PLA                             ", 0xC70C, 0xCB, 0x04, 0x4F, 0x6D, 0xF1 },
-  { "CMP #$55                        ", 0xC70D, 0xAA, 0x04, 0x4F, 0xED, 0xF2 },
-  { "BEQ $C71B                       ", 0xC70F, 0xAA, 0x04, 0x4F, 0x6D, 0xF2 },
-  { "CMP #$AA                        ", 0xC711, 0xAA, 0x04, 0x4F, 0x6D, 0xF2 },
-  { "BEQ $C71B                       ", 0xC713, 0xAA, 0x04, 0x4F, 0x6F, 0xF2 },
-  { "PLA                             ", 0xC71B, 0xAA, 0x04, 0x4F, 0x6F, 0xF2 },
-  { "AND #$CB                        ", 0xC71C, 0xFF, 0x04, 0x4F, 0xED, 0xF3 },
-  { "CMP #$00                        ", 0xC71E, 0xCB, 0x04, 0x4F, 0xED, 0xF3 },
-  { "BEQ $C728                       ", 0xC720, 0xCB, 0x04, 0x4F, 0xED, 0xF3 },
-  { "CMP #$CB                        ", 0xC722, 0xCB, 0x04, 0x4F, 0xED, 0xF3 },
-  { "BEQ $C728                       ", 0xC724, 0xCB, 0x04, 0x4F, 0x6F, 0xF3 },
-  { "INY                             ", 0xC728, 0xCB, 0x04, 0x4F, 0x6F, 0xF3 },
-  { "DEX                             ", 0xC729, 0xCB, 0x04, 0x50, 0x6D, 0xF3 },
-  { "BNE $C70C                       ", 0xC72A, 0xCB, 0x03, 0x50, 0x6D, 0xF3 },
-  { "PLA                             ", 0xC70C, 0xCB, 0x03, 0x50, 0x6D, 0xF3 },
-  { "CMP #$55                        ", 0xC70D, 0xAA, 0x03, 0x50, 0xED, 0xF4 },
-  { "BEQ $C71B                       ", 0xC70F, 0xAA, 0x03, 0x50, 0x6D, 0xF4 },
-  { "CMP #$AA                        ", 0xC711, 0xAA, 0x03, 0x50, 0x6D, 0xF4 },
-  { "BEQ $C71B                       ", 0xC713, 0xAA, 0x03, 0x50, 0x6F, 0xF4 },
-  { "PLA                             ", 0xC71B, 0xAA, 0x03, 0x50, 0x6F, 0xF4 },
-  { "AND #$CB                        ", 0xC71C, 0xFF, 0x03, 0x50, 0xED, 0xF5 },
-  { "CMP #$00                        ", 0xC71E, 0xCB, 0x03, 0x50, 0xED, 0xF5 },
-  { "BEQ $C728                       ", 0xC720, 0xCB, 0x03, 0x50, 0xED, 0xF5 },
-  { "CMP #$CB                        ", 0xC722, 0xCB, 0x03, 0x50, 0xED, 0xF5 },
-  { "BEQ $C728                       ", 0xC724, 0xCB, 0x03, 0x50, 0x6F, 0xF5 },
-  { "INY                             ", 0xC728, 0xCB, 0x03, 0x50, 0x6F, 0xF5 },
-  { "DEX                             ", 0xC729, 0xCB, 0x03, 0x51, 0x6D, 0xF5 },
-  { "BNE $C70C                       ", 0xC72A, 0xCB, 0x02, 0x51, 0x6D, 0xF5 },
-  { "PLA                             ", 0xC70C, 0xCB, 0x02, 0x51, 0x6D, 0xF5 },
-  { "CMP #$55                        ", 0xC70D, 0xAA, 0x02, 0x51, 0xED, 0xF6 },
-  { "BEQ $C71B                       ", 0xC70F, 0xAA, 0x02, 0x51, 0x6D, 0xF6 },
-  { "CMP #$AA                        ", 0xC711, 0xAA, 0x02, 0x51, 0x6D, 0xF6 },
-  { "BEQ $C71B                       ", 0xC713, 0xAA, 0x02, 0x51, 0x6F, 0xF6 },
-  { "PLA                             ", 0xC71B, 0xAA, 0x02, 0x51, 0x6F, 0xF6 },
-  { "AND #$CB                        ", 0xC71C, 0xFF, 0x02, 0x51, 0xED, 0xF7 },
-  { "CMP #$00                        ", 0xC71E, 0xCB, 0x02, 0x51, 0xED, 0xF7 },
-  { "BEQ $C728                       ", 0xC720, 0xCB, 0x02, 0x51, 0xED, 0xF7 },
-  { "CMP #$CB                        ", 0xC722, 0xCB, 0x02, 0x51, 0xED, 0xF7 },
-  { "BEQ $C728                       ", 0xC724, 0xCB, 0x02, 0x51, 0x6F, 0xF7 },
-  { "INY                             ", 0xC728, 0xCB, 0x02, 0x51, 0x6F, 0xF7 },
-  { "DEX                             ", 0xC729, 0xCB, 0x02, 0x52, 0x6D, 0xF7 },
-  { "BNE $C70C                       ", 0xC72A, 0xCB, 0x01, 0x52, 0x6D, 0xF7 },
-  { "PLA                             ", 0xC70C, 0xCB, 0x01, 0x52, 0x6D, 0xF7 },
-  { "CMP #$55                        ", 0xC70D, 0xAA, 0x01, 0x52, 0xED, 0xF8 },
-  { "BEQ $C71B                       ", 0xC70F, 0xAA, 0x01, 0x52, 0x6D, 0xF8 },
-  { "CMP #$AA                        ", 0xC711, 0xAA, 0x01, 0x52, 0x6D, 0xF8 },
-  { "BEQ $C71B                       ", 0xC713, 0xAA, 0x01, 0x52, 0x6F, 0xF8 },
-  { "PLA                             ", 0xC71B, 0xAA, 0x01, 0x52, 0x6F, 0xF8 },
-  { "AND #$CB                        ", 0xC71C, 0xFF, 0x01, 0x52, 0xED, 0xF9 },
-  { "CMP #$00                        ", 0xC71E, 0xCB, 0x01, 0x52, 0xED, 0xF9 },
-  { "BEQ $C728                       ", 0xC720, 0xCB, 0x01, 0x52, 0xED, 0xF9 },
-  { "CMP #$CB                        ", 0xC722, 0xCB, 0x01, 0x52, 0xED, 0xF9 },
-  { "BEQ $C728                       ", 0xC724, 0xCB, 0x01, 0x52, 0x6F, 0xF9 },
-  { "INY                             ", 0xC728, 0xCB, 0x01, 0x52, 0x6F, 0xF9 },
-  { "DEX                             ", 0xC729, 0xCB, 0x01, 0x53, 0x6D, 0xF9 },
-  { "BNE $C70C                       ", 0xC72A, 0xCB, 0x00, 0x53, 0x6F, 0xF9 },
-  { "RTS                             ", 0xC72C, 0xCB, 0x00, 0x53, 0x6F, 0xF9 },
-  { "JSR $C6B7                       ", 0xC6AC, 0xCB, 0x00, 0x53, 0x6F, 0xFB },
-  { "LDA #$34                        ", 0xC6B7, 0xCB, 0x00, 0x53, 0x6F, 0xF9 },
-  { "PHA                             ", 0xC6B9, 0x34, 0x00, 0x53, 0x6D, 0xF9 },
-  { "LDA #$55                        ", 0xC6BA, 0x34, 0x00, 0x53, 0x6D, 0xF8 },
-  { "PLP                             ", 0xC6BC, 0x55, 0x00, 0x53, 0x6D, 0xF8 },
-  { "NOP $A9 = 00                    ", 0xC6BD, 0x55, 0x00, 0x53, 0x24, 0xF9 },
-  { "NOP $A9 = 00                    ", 0xC6BF, 0x55, 0x00, 0x53, 0x24, 0xF9 },
-  { "NOP $A9 = 00                    ", 0xC6C1, 0x55, 0x00, 0x53, 0x24, 0xF9 },
-  { "NOP                             ", 0xC6C3, 0x55, 0x00, 0x53, 0x24, 0xF9 },
-  { "NOP                             ", 0xC6C4, 0x55, 0x00, 0x53, 0x24, 0xF9 },
-  { "NOP                             ", 0xC6C5, 0x55, 0x00, 0x53, 0x24, 0xF9 },
-  { "NOP                             ", 0xC6C6, 0x55, 0x00, 0x53, 0x24, 0xF9 },
-  { "PHP                             ", 0xC6C7, 0x55, 0x00, 0x53, 0x24, 0xF9 },
-  { "PHA                             ", 0xC6C8, 0x55, 0x00, 0x53, 0x24, 0xF8 },
-  { "NOP $A9A9 = A9                  ", 0xC6C9, 0x55, 0x00, 0x53, 0x24, 0xF7 },
-  { "NOP                             ", 0xC6CC, 0x55, 0x00, 0x53, 0x24, 0xF7 },
-  { "NOP                             ", 0xC6CD, 0x55, 0x00, 0x53, 0x24, 0xF7 },
-  { "NOP                             ", 0xC6CE, 0x55, 0x00, 0x53, 0x24, 0xF7 },
-  { "NOP                             ", 0xC6CF, 0x55, 0x00, 0x53, 0x24, 0xF7 },
-  { "PHP                             ", 0xC6D0, 0x55, 0x00, 0x53, 0x24, 0xF7 },
-  { "PHA                             ", 0xC6D1, 0x55, 0x00, 0x53, 0x24, 0xF6 },
-  { "NOP $A9,X @ A9 = 00             ", 0xC6D2, 0x55, 0x00, 0x53, 0x24, 0xF5 },
-  { "NOP $A9,X @ A9 = 00             ", 0xC6D4, 0x55, 0x00, 0x53, 0x24, 0xF5 },
-  { "NOP $A9,X @ A9 = 00             ", 0xC6D6, 0x55, 0x00, 0x53, 0x24, 0xF5 },
-  { "NOP $A9,X @ A9 = 00             ", 0xC6D8, 0x55, 0x00, 0x53, 0x24, 0xF5 },
-  { "NOP $A9,X @ A9 = 00             ", 0xC6DA, 0x55, 0x00, 0x53, 0x24, 0xF5 },
-  { "NOP $A9,X @ A9 = 00             ", 0xC6DC, 0x55, 0x00, 0x53, 0x24, 0xF5 },
-  { "NOP                             ", 0xC6DE, 0x55, 0x00, 0x53, 0x24, 0xF5 },
-  { "NOP                             ", 0xC6DF, 0x55, 0x00, 0x53, 0x24, 0xF5 },
-  { "NOP                             ", 0xC6E0, 0x55, 0x00, 0x53, 0x24, 0xF5 },
-  { "NOP                             ", 0xC6E1, 0x55, 0x00, 0x53, 0x24, 0xF5 },
-  { "PHP                             ", 0xC6E2, 0x55, 0x00, 0x53, 0x24, 0xF5 },
-  { "PHA                             ", 0xC6E3, 0x55, 0x00, 0x53, 0x24, 0xF4 },
-  { "NOP                             ", 0xC6E4, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "NOP                             ", 0xC6E5, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "NOP                             ", 0xC6E6, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "NOP                             ", 0xC6E7, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "NOP                             ", 0xC6E8, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "NOP                             ", 0xC6E9, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "NOP #$89                        ", 0xC6EA, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "NOP                             ", 0xC6EC, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "NOP                             ", 0xC6ED, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "NOP                             ", 0xC6EE, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "NOP                             ", 0xC6EF, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "PHP                             ", 0xC6F0, 0x55, 0x00, 0x53, 0x24, 0xF3 },
-  { "PHA                             ", 0xC6F1, 0x55, 0x00, 0x53, 0x24, 0xF2 },
-  { "NOP $A9A9,X @ A9A9 = A9         ", 0xC6F2, 0x55, 0x00, 0x53, 0x24, 0xF1 },
-  { "NOP $A9A9,X @ A9A9 = A9         ", 0xC6F5, 0x55, 0x00, 0x53, 0x24, 0xF1 },
-  { "NOP $A9A9,X @ A9A9 = A9         ", 0xC6F8, 0x55, 0x00, 0x53, 0x24, 0xF1 },
-  { "NOP $A9A9,X @ A9A9 = A9         ", 0xC6FB, 0x55, 0x00, 0x53, 0x24, 0xF1 },
-  { "NOP $A9A9,X @ A9A9 = A9         ", 0xC6FE, 0x55, 0x00, 0x53, 0x24, 0xF1 },
-  { "NOP $A9A9,X @ A9A9 = A9         ", 0xC701, 0x55, 0x00, 0x53, 0x24, 0xF1 },
-  { "NOP                             ", 0xC704, 0x55, 0x00, 0x53, 0x24, 0xF1 },
-  { "NOP                             ", 0xC705, 0x55, 0x00, 0x53, 0x24, 0xF1 },
-  { "NOP                             ", 0xC706, 0x55, 0x00, 0x53, 0x24, 0xF1 },
-  { "NOP                             ", 0xC707, 0x55, 0x00, 0x53, 0x24, 0xF1 },
-  { "PHP                             ", 0xC708, 0x55, 0x00, 0x53, 0x24, 0xF1 },
-  { "PHA                             ", 0xC709, 0x55, 0x00, 0x53, 0x24, 0xF0 },
-  { "LDX #$05                        ", 0xC70A, 0x55, 0x00, 0x53, 0x24, 0xEF },
-  { "PLA                             ", 0xC70C, 0x55, 0x05, 0x53, 0x24, 0xEF },
-  { "CMP #$55                        ", 0xC70D, 0x55, 0x05, 0x53, 0x24, 0xF0 },
-  { "BEQ $C71B                       ", 0xC70F, 0x55, 0x05, 0x53, 0x27, 0xF0 },
-  { "PLA                             ", 0xC71B, 0x55, 0x05, 0x53, 0x27, 0xF0 },
-  { "AND #$CB                        ", 0xC71C, 0x34, 0x05, 0x53, 0x25, 0xF1 },
-  { "CMP #$00                        ", 0xC71E, 0x00, 0x05, 0x53, 0x27, 0xF1 },
-  { "BEQ $C728                       ", 0xC720, 0x00, 0x05, 0x53, 0x27, 0xF1 },
-  { "INY                             ", 0xC728, 0x00, 0x05, 0x53, 0x27, 0xF1 },
-  { "DEX                             ", 0xC729, 0x00, 0x05, 0x54, 0x25, 0xF1 },
-  { "BNE $C70C                       ", 0xC72A, 0x00, 0x04, 0x54, 0x25, 0xF1 },
-  { "PLA                             ", 0xC70C, 0x00, 0x04, 0x54, 0x25, 0xF1 },
-  { "CMP #$55                        ", 0xC70D, 0x55, 0x04, 0x54, 0x25, 0xF2 },
-  { "BEQ $C71B                       ", 0xC70F, 0x55, 0x04, 0x54, 0x27, 0xF2 },
-  { "PLA                             ", 0xC71B, 0x55, 0x04, 0x54, 0x27, 0xF2 },
-  { "AND #$CB                        ", 0xC71C, 0x34, 0x04, 0x54, 0x25, 0xF3 },
-  { "CMP #$00                        ", 0xC71E, 0x00, 0x04, 0x54, 0x27, 0xF3 },
-  { "BEQ $C728                       ", 0xC720, 0x00, 0x04, 0x54, 0x27, 0xF3 },
-  { "INY                             ", 0xC728, 0x00, 0x04, 0x54, 0x27, 0xF3 },
-  { "DEX                             ", 0xC729, 0x00, 0x04, 0x55, 0x25, 0xF3 },
-  { "BNE $C70C                       ", 0xC72A, 0x00, 0x03, 0x55, 0x25, 0xF3 },
-  { "PLA                             ", 0xC70C, 0x00, 0x03, 0x55, 0x25, 0xF3 },
-  { "CMP #$55                        ", 0xC70D, 0x55, 0x03, 0x55, 0x25, 0xF4 },
-  { "BEQ $C71B                       ", 0xC70F, 0x55, 0x03, 0x55, 0x27, 0xF4 },
-  { "PLA                             ", 0xC71B, 0x55, 0x03, 0x55, 0x27, 0xF4 },
-  { "AND #$CB                        ", 0xC71C, 0x34, 0x03, 0x55, 0x25, 0xF5 },
-  { "CMP #$00                        ", 0xC71E, 0x00, 0x03, 0x55, 0x27, 0xF5 },
-  { "BEQ $C728                       ", 0xC720, 0x00, 0x03, 0x55, 0x27, 0xF5 },
-  { "INY                             ", 0xC728, 0x00, 0x03, 0x55, 0x27, 0xF5 },
-  { "DEX                             ", 0xC729, 0x00, 0x03, 0x56, 0x25, 0xF5 },
-  { "BNE $C70C                       ", 0xC72A, 0x00, 0x02, 0x56, 0x25, 0xF5 },
-  { "PLA                             ", 0xC70C, 0x00, 0x02, 0x56, 0x25, 0xF5 },
-  { "CMP #$55                        ", 0xC70D, 0x55, 0x02, 0x56, 0x25, 0xF6 },
-  { "BEQ $C71B                       ", 0xC70F, 0x55, 0x02, 0x56, 0x27, 0xF6 },
-  { "PLA                             ", 0xC71B, 0x55, 0x02, 0x56, 0x27, 0xF6 },
-  { "AND #$CB                        ", 0xC71C, 0x34, 0x02, 0x56, 0x25, 0xF7 },
-  { "CMP #$00                        ", 0xC71E, 0x00, 0x02, 0x56, 0x27, 0xF7 },
-  { "BEQ $C728                       ", 0xC720, 0x00, 0x02, 0x56, 0x27, 0xF7 },
-  { "INY                             ", 0xC728, 0x00, 0x02, 0x56, 0x27, 0xF7 },
-  { "DEX                             ", 0xC729, 0x00, 0x02, 0x57, 0x25, 0xF7 },
-  { "BNE $C70C                       ", 0xC72A, 0x00, 0x01, 0x57, 0x25, 0xF7 },
-  { "PLA                             ", 0xC70C, 0x00, 0x01, 0x57, 0x25, 0xF7 },
-  { "CMP #$55                        ", 0xC70D, 0x55, 0x01, 0x57, 0x25, 0xF8 },
-  { "BEQ $C71B                       ", 0xC70F, 0x55, 0x01, 0x57, 0x27, 0xF8 },
-  { "PLA                             ", 0xC71B, 0x55, 0x01, 0x57, 0x27, 0xF8 },
-  { "AND #$CB                        ", 0xC71C, 0x34, 0x01, 0x57, 0x25, 0xF9 },
-  { "CMP #$00                        ", 0xC71E, 0x00, 0x01, 0x57, 0x27, 0xF9 },
-  { "BEQ $C728                       ", 0xC720, 0x00, 0x01, 0x57, 0x27, 0xF9 },
-  { "INY                             ", 0xC728, 0x00, 0x01, 0x57, 0x27, 0xF9 },
-  { "DEX                             ", 0xC729, 0x00, 0x01, 0x58, 0x25, 0xF9 },
-  { "BNE $C70C                       ", 0xC72A, 0x00, 0x00, 0x58, 0x27, 0xF9 },
-  { "RTS                             ", 0xC72C, 0x00, 0x00, 0x58, 0x27, 0xF9 },
-  { "RTS                             ", 0xC6AF, 0x00, 0x00, 0x58, 0x27, 0xFB },
-  { "JSR $E51E                       ", 0xC632, 0x00, 0x00, 0x58, 0x27, 0xFD },
-  { "LDA #$55                        ", 0xE51E, 0x00, 0x00, 0x58, 0x27, 0xFB },
-  { "STA $0580 = 00                  ", 0xE520, 0x55, 0x00, 0x58, 0x25, 0xFB },
-  { "LDA #$AA                        ", 0xE523, 0x55, 0x00, 0x58, 0x25, 0xFB },
-  { "STA $0432 = 00                  ", 0xE525, 0xAA, 0x00, 0x58, 0xA5, 0xFB },
-  { "LDA #$80                        ", 0xE528, 0xAA, 0x00, 0x58, 0xA5, 0xFB },
-  { "STA $43 = 00                    ", 0xE52A, 0x80, 0x00, 0x58, 0xA5, 0xFB },
-  { "LDA #$05                        ", 0xE52C, 0x80, 0x00, 0x58, 0xA5, 0xFB },
-  { "STA $44 = 00                    ", 0xE52E, 0x05, 0x00, 0x58, 0x25, 0xFB },
-  { "LDA #$32                        ", 0xE530, 0x05, 0x00, 0x58, 0x25, 0xFB },
-  { "STA $45 = 00                    ", 0xE532, 0x32, 0x00, 0x58, 0x25, 0xFB },
-  { "LDA #$04                        ", 0xE534, 0x32, 0x00, 0x58, 0x25, 0xFB },
-  { "STA $46 = 00                    ", 0xE536, 0x04, 0x00, 0x58, 0x25, 0xFB },
-  { "LDX #$03                        ", 0xE538, 0x04, 0x00, 0x58, 0x25, 0xFB },
-  { "LDY #$77                        ", 0xE53A, 0x04, 0x03, 0x58, 0x25, 0xFB },
-  { "LDA #$FF                        ", 0xE53C, 0x04, 0x03, 0x77, 0x25, 0xFB },
-  { "STA $01 = FF                    ", 0xE53E, 0xFF, 0x03, 0x77, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xE540, 0xFF, 0x03, 0x77, 0xA5, 0xFB },
-  { "SEC                             ", 0xE542, 0xFF, 0x03, 0x77, 0xE5, 0xFB },
-  { "LDA #$00                        ", 0xE543, 0xFF, 0x03, 0x77, 0xE5, 0xFB },
-  { "LAX ($40,X) @ 43 = 0580 = 55    ", 0xE545, 0x00, 0x03, 0x77, 0x67, 0xFB },
-  { "NOP                             ", 0xE547, 0x55, 0x55, 0x77, 0x65, 0xFB },
-  { "NOP                             ", 0xE548, 0x55, 0x55, 0x77, 0x65, 0xFB },
-  { "NOP                             ", 0xE549, 0x55, 0x55, 0x77, 0x65, 0xFB },
-  { "NOP                             ", 0xE54A, 0x55, 0x55, 0x77, 0x65, 0xFB },
-  { "BEQ $E55F                       ", 0xE54B, 0x55, 0x55, 0x77, 0x65, 0xFB },
-  { "BMI $E55F                       ", 0xE54D, 0x55, 0x55, 0x77, 0x65, 0xFB },
-  { "BVC $E55F                       ", 0xE54F, 0x55, 0x55, 0x77, 0x65, 0xFB },
-  { "BCC $E55F                       ", 0xE551, 0x55, 0x55, 0x77, 0x65, 0xFB },
-  { "CMP #$55                        ", 0xE553, 0x55, 0x55, 0x77, 0x65, 0xFB },
-  { "BNE $E55F                       ", 0xE555, 0x55, 0x55, 0x77, 0x67, 0xFB },
-  { "CPX #$55                        ", 0xE557, 0x55, 0x55, 0x77, 0x67, 0xFB },
-  { "BNE $E55F                       ", 0xE559, 0x55, 0x55, 0x77, 0x67, 0xFB },
-  { "CPY #$77                        ", 0xE55B, 0x55, 0x55, 0x77, 0x67, 0xFB },
-  { "BEQ $E563                       ", 0xE55D, 0x55, 0x55, 0x77, 0x67, 0xFB },
-  { "LDX #$05                        ", 0xE563, 0x55, 0x55, 0x77, 0x67, 0xFB },
-  { "LDY #$33                        ", 0xE565, 0x55, 0x05, 0x77, 0x65, 0xFB },
-  { "CLV                             ", 0xE567, 0x55, 0x05, 0x33, 0x65, 0xFB },
-  { "CLC                             ", 0xE568, 0x55, 0x05, 0x33, 0x25, 0xFB },
-  { "LDA #$00                        ", 0xE569, 0x55, 0x05, 0x33, 0x24, 0xFB },
-  { "LAX ($40,X) @ 45 = 0432 = AA    ", 0xE56B, 0x00, 0x05, 0x33, 0x26, 0xFB },
-  { "NOP                             ", 0xE56D, 0xAA, 0xAA, 0x33, 0xA4, 0xFB },
-  { "NOP                             ", 0xE56E, 0xAA, 0xAA, 0x33, 0xA4, 0xFB },
-  { "NOP                             ", 0xE56F, 0xAA, 0xAA, 0x33, 0xA4, 0xFB },
-  { "NOP                             ", 0xE570, 0xAA, 0xAA, 0x33, 0xA4, 0xFB },
-  { "BEQ $E585                       ", 0xE571, 0xAA, 0xAA, 0x33, 0xA4, 0xFB },
-  { "BPL $E585                       ", 0xE573, 0xAA, 0xAA, 0x33, 0xA4, 0xFB },
-  { "BVS $E585                       ", 0xE575, 0xAA, 0xAA, 0x33, 0xA4, 0xFB },
-  { "BCS $E585                       ", 0xE577, 0xAA, 0xAA, 0x33, 0xA4, 0xFB },
-  { "CMP #$AA                        ", 0xE579, 0xAA, 0xAA, 0x33, 0xA4, 0xFB },
-  { "BNE $E585                       ", 0xE57B, 0xAA, 0xAA, 0x33, 0x27, 0xFB },
-  { "CPX #$AA                        ", 0xE57D, 0xAA, 0xAA, 0x33, 0x27, 0xFB },
-  { "BNE $E585                       ", 0xE57F, 0xAA, 0xAA, 0x33, 0x27, 0xFB },
-  { "CPY #$33                        ", 0xE581, 0xAA, 0xAA, 0x33, 0x27, 0xFB },
-  { "BEQ $E589                       ", 0xE583, 0xAA, 0xAA, 0x33, 0x27, 0xFB },
-  { "LDA #$87                        ", 0xE589, 0xAA, 0xAA, 0x33, 0x27, 0xFB },
-  { "STA $67 = 00                    ", 0xE58B, 0x87, 0xAA, 0x33, 0xA5, 0xFB },
-  { "LDA #$32                        ", 0xE58D, 0x87, 0xAA, 0x33, 0xA5, 0xFB },
-  { "STA $68 = 00                    ", 0xE58F, 0x32, 0xAA, 0x33, 0x25, 0xFB },
-  { "LDY #$57                        ", 0xE591, 0x32, 0xAA, 0x33, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xE593, 0x32, 0xAA, 0x57, 0x25, 0xFB },
-  { "SEC                             ", 0xE595, 0x32, 0xAA, 0x57, 0xE5, 0xFB },
-  { "LDA #$00                        ", 0xE596, 0x32, 0xAA, 0x57, 0xE5, 0xFB },
-  { "LAX $67 = 87                    ", 0xE598, 0x00, 0xAA, 0x57, 0x67, 0xFB },
-  { "NOP                             ", 0xE59A, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "NOP                             ", 0xE59B, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "NOP                             ", 0xE59C, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "NOP                             ", 0xE59D, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BEQ $E5B2                       ", 0xE59E, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BPL $E5B2                       ", 0xE5A0, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BVC $E5B2                       ", 0xE5A2, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BCC $E5B2                       ", 0xE5A4, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "CMP #$87                        ", 0xE5A6, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BNE $E5B2                       ", 0xE5A8, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "CPX #$87                        ", 0xE5AA, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "BNE $E5B2                       ", 0xE5AC, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "CPY #$57                        ", 0xE5AE, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "BEQ $E5B6                       ", 0xE5B0, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "LDY #$53                        ", 0xE5B6, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "CLV                             ", 0xE5B8, 0x87, 0x87, 0x53, 0x65, 0xFB },
-  { "CLC                             ", 0xE5B9, 0x87, 0x87, 0x53, 0x25, 0xFB },
-  { "LDA #$00                        ", 0xE5BA, 0x87, 0x87, 0x53, 0x24, 0xFB },
-  { "LAX $68 = 32                    ", 0xE5BC, 0x00, 0x87, 0x53, 0x26, 0xFB },
-  { "NOP                             ", 0xE5BE, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "NOP                             ", 0xE5BF, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "NOP                             ", 0xE5C0, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "NOP                             ", 0xE5C1, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "BEQ $E5D6                       ", 0xE5C2, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "BMI $E5D6                       ", 0xE5C4, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "BVS $E5D6                       ", 0xE5C6, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "BCS $E5D6                       ", 0xE5C8, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "CMP #$32                        ", 0xE5CA, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "BNE $E5D6                       ", 0xE5CC, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "CPX #$32                        ", 0xE5CE, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "BNE $E5D6                       ", 0xE5D0, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "CPY #$53                        ", 0xE5D2, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "BEQ $E5DA                       ", 0xE5D4, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "LDA #$87                        ", 0xE5DA, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "STA $0577 = 00                  ", 0xE5DC, 0x87, 0x32, 0x53, 0xA5, 0xFB },
-  { "LDA #$32                        ", 0xE5DF, 0x87, 0x32, 0x53, 0xA5, 0xFB },
-  { "STA $0578 = 00                  ", 0xE5E1, 0x32, 0x32, 0x53, 0x25, 0xFB },
-  { "LDY #$57                        ", 0xE5E4, 0x32, 0x32, 0x53, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xE5E6, 0x32, 0x32, 0x57, 0x25, 0xFB },
-  { "SEC                             ", 0xE5E8, 0x32, 0x32, 0x57, 0xE5, 0xFB },
-  { "LDA #$00                        ", 0xE5E9, 0x32, 0x32, 0x57, 0xE5, 0xFB },
-  { "LAX $0577 = 87                  ", 0xE5EB, 0x00, 0x32, 0x57, 0x67, 0xFB },
-  { "NOP                             ", 0xE5EE, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "NOP                             ", 0xE5EF, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "NOP                             ", 0xE5F0, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "NOP                             ", 0xE5F1, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BEQ $E606                       ", 0xE5F2, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BPL $E606                       ", 0xE5F4, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BVC $E606                       ", 0xE5F6, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BCC $E606                       ", 0xE5F8, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "CMP #$87                        ", 0xE5FA, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BNE $E606                       ", 0xE5FC, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "CPX #$87                        ", 0xE5FE, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "BNE $E606                       ", 0xE600, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "CPY #$57                        ", 0xE602, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "BEQ $E60A                       ", 0xE604, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "LDY #$53                        ", 0xE60A, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "CLV                             ", 0xE60C, 0x87, 0x87, 0x53, 0x65, 0xFB },
-  { "CLC                             ", 0xE60D, 0x87, 0x87, 0x53, 0x25, 0xFB },
-  { "LDA #$00                        ", 0xE60E, 0x87, 0x87, 0x53, 0x24, 0xFB },
-  { "LAX $0578 = 32                  ", 0xE610, 0x00, 0x87, 0x53, 0x26, 0xFB },
-  { "NOP                             ", 0xE613, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "NOP                             ", 0xE614, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "NOP                             ", 0xE615, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "NOP                             ", 0xE616, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "BEQ $E62B                       ", 0xE617, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "BMI $E62B                       ", 0xE619, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "BVS $E62B                       ", 0xE61B, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "BCS $E62B                       ", 0xE61D, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "CMP #$32                        ", 0xE61F, 0x32, 0x32, 0x53, 0x24, 0xFB },
-  { "BNE $E62B                       ", 0xE621, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "CPX #$32                        ", 0xE623, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "BNE $E62B                       ", 0xE625, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "CPY #$53                        ", 0xE627, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "BEQ $E62F                       ", 0xE629, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xE62F, 0x32, 0x32, 0x53, 0x27, 0xFB },
-  { "STA $43 = 80                    ", 0xE631, 0xFF, 0x32, 0x53, 0xA5, 0xFB },
-  { "LDA #$04                        ", 0xE633, 0xFF, 0x32, 0x53, 0xA5, 0xFB },
-  { "STA $44 = 05                    ", 0xE635, 0x04, 0x32, 0x53, 0x25, 0xFB },
-  { "LDA #$32                        ", 0xE637, 0x04, 0x32, 0x53, 0x25, 0xFB },
-  { "STA $45 = 32                    ", 0xE639, 0x32, 0x32, 0x53, 0x25, 0xFB },
-  { "LDA #$04                        ", 0xE63B, 0x32, 0x32, 0x53, 0x25, 0xFB },
-  { "STA $46 = 04                    ", 0xE63D, 0x04, 0x32, 0x53, 0x25, 0xFB },
-  { "LDA #$55                        ", 0xE63F, 0x04, 0x32, 0x53, 0x25, 0xFB },
-  { "STA $0580 = 55                  ", 0xE641, 0x55, 0x32, 0x53, 0x25, 0xFB },
-  { "LDA #$AA                        ", 0xE644, 0x55, 0x32, 0x53, 0x25, 0xFB },
-  { "STA $0432 = AA                  ", 0xE646, 0xAA, 0x32, 0x53, 0xA5, 0xFB },
-  { "LDX #$03                        ", 0xE649, 0xAA, 0x32, 0x53, 0xA5, 0xFB },
-  { "LDY #$81                        ", 0xE64B, 0xAA, 0x03, 0x53, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xE64D, 0xAA, 0x03, 0x81, 0xA5, 0xFB },
-  { "SEC                             ", 0xE64F, 0xAA, 0x03, 0x81, 0xE5, 0xFB },
-  { "LDA #$00                        ", 0xE650, 0xAA, 0x03, 0x81, 0xE5, 0xFB },
-  { "LAX ($43),Y = 04FF @ 0580 = 55  ", 0xE652, 0x00, 0x03, 0x81, 0x67, 0xFB },
-  { "NOP                             ", 0xE654, 0x55, 0x55, 0x81, 0x65, 0xFB },
-  { "NOP                             ", 0xE655, 0x55, 0x55, 0x81, 0x65, 0xFB },
-  { "NOP                             ", 0xE656, 0x55, 0x55, 0x81, 0x65, 0xFB },
-  { "NOP                             ", 0xE657, 0x55, 0x55, 0x81, 0x65, 0xFB },
-  { "BEQ $E66C                       ", 0xE658, 0x55, 0x55, 0x81, 0x65, 0xFB },
-  { "BMI $E66C                       ", 0xE65A, 0x55, 0x55, 0x81, 0x65, 0xFB },
-  { "BVC $E66C                       ", 0xE65C, 0x55, 0x55, 0x81, 0x65, 0xFB },
-  { "BCC $E66C                       ", 0xE65E, 0x55, 0x55, 0x81, 0x65, 0xFB },
-  { "CMP #$55                        ", 0xE660, 0x55, 0x55, 0x81, 0x65, 0xFB },
-  { "BNE $E66C                       ", 0xE662, 0x55, 0x55, 0x81, 0x67, 0xFB },
-  { "CPX #$55                        ", 0xE664, 0x55, 0x55, 0x81, 0x67, 0xFB },
-  { "BNE $E66C                       ", 0xE666, 0x55, 0x55, 0x81, 0x67, 0xFB },
-  { "CPY #$81                        ", 0xE668, 0x55, 0x55, 0x81, 0x67, 0xFB },
-  { "BEQ $E670                       ", 0xE66A, 0x55, 0x55, 0x81, 0x67, 0xFB },
-  { "LDX #$05                        ", 0xE670, 0x55, 0x55, 0x81, 0x67, 0xFB },
-  { "LDY #$00                        ", 0xE672, 0x55, 0x05, 0x81, 0x65, 0xFB },
-  { "CLV                             ", 0xE674, 0x55, 0x05, 0x00, 0x67, 0xFB },
-  { "CLC                             ", 0xE675, 0x55, 0x05, 0x00, 0x27, 0xFB },
-  { "LDA #$00                        ", 0xE676, 0x55, 0x05, 0x00, 0x26, 0xFB },
-  { "LAX ($45),Y = 0432 @ 0432 = AA  ", 0xE678, 0x00, 0x05, 0x00, 0x26, 0xFB },
-  { "NOP                             ", 0xE67A, 0xAA, 0xAA, 0x00, 0xA4, 0xFB },
-  { "NOP                             ", 0xE67B, 0xAA, 0xAA, 0x00, 0xA4, 0xFB },
-  { "NOP                             ", 0xE67C, 0xAA, 0xAA, 0x00, 0xA4, 0xFB },
-  { "NOP                             ", 0xE67D, 0xAA, 0xAA, 0x00, 0xA4, 0xFB },
-  { "BEQ $E692                       ", 0xE67E, 0xAA, 0xAA, 0x00, 0xA4, 0xFB },
-  { "BPL $E692                       ", 0xE680, 0xAA, 0xAA, 0x00, 0xA4, 0xFB },
-  { "BVS $E692                       ", 0xE682, 0xAA, 0xAA, 0x00, 0xA4, 0xFB },
-  { "BCS $E692                       ", 0xE684, 0xAA, 0xAA, 0x00, 0xA4, 0xFB },
-  { "CMP #$AA                        ", 0xE686, 0xAA, 0xAA, 0x00, 0xA4, 0xFB },
-  { "BNE $E692                       ", 0xE688, 0xAA, 0xAA, 0x00, 0x27, 0xFB },
-  { "CPX #$AA                        ", 0xE68A, 0xAA, 0xAA, 0x00, 0x27, 0xFB },
-  { "BNE $E692                       ", 0xE68C, 0xAA, 0xAA, 0x00, 0x27, 0xFB },
-  { "CPY #$00                        ", 0xE68E, 0xAA, 0xAA, 0x00, 0x27, 0xFB },
-  { "BEQ $E696                       ", 0xE690, 0xAA, 0xAA, 0x00, 0x27, 0xFB },
-  { "LDA #$87                        ", 0xE696, 0xAA, 0xAA, 0x00, 0x27, 0xFB },
-  { "STA $67 = 87                    ", 0xE698, 0x87, 0xAA, 0x00, 0xA5, 0xFB },
-  { "LDA #$32                        ", 0xE69A, 0x87, 0xAA, 0x00, 0xA5, 0xFB },
-  { "STA $68 = 32                    ", 0xE69C, 0x32, 0xAA, 0x00, 0x25, 0xFB },
-  { "LDY #$57                        ", 0xE69E, 0x32, 0xAA, 0x00, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xE6A0, 0x32, 0xAA, 0x57, 0x25, 0xFB },
-  { "SEC                             ", 0xE6A2, 0x32, 0xAA, 0x57, 0xE5, 0xFB },
-  { "LDA #$00                        ", 0xE6A3, 0x32, 0xAA, 0x57, 0xE5, 0xFB },
-  { "LAX $10,Y @ 67 = 87             ", 0xE6A5, 0x00, 0xAA, 0x57, 0x67, 0xFB },
-  { "NOP                             ", 0xE6A7, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "NOP                             ", 0xE6A8, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "NOP                             ", 0xE6A9, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "NOP                             ", 0xE6AA, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BEQ $E6BF                       ", 0xE6AB, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BPL $E6BF                       ", 0xE6AD, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BVC $E6BF                       ", 0xE6AF, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BCC $E6BF                       ", 0xE6B1, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "CMP #$87                        ", 0xE6B3, 0x87, 0x87, 0x57, 0xE5, 0xFB },
-  { "BNE $E6BF                       ", 0xE6B5, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "CPX #$87                        ", 0xE6B7, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "BNE $E6BF                       ", 0xE6B9, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "CPY #$57                        ", 0xE6BB, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "BEQ $E6C3                       ", 0xE6BD, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "LDY #$FF                        ", 0xE6C3, 0x87, 0x87, 0x57, 0x67, 0xFB },
-  { "CLV                             ", 0xE6C5, 0x87, 0x87, 0xFF, 0xE5, 0xFB },
-  { "CLC                             ", 0xE6C6, 0x87, 0x87, 0xFF, 0xA5, 0xFB },
-  { "LDA #$00                        ", 0xE6C7, 0x87, 0x87, 0xFF, 0xA4, 0xFB },
-  { "LAX $69,Y @ 68 = 32             ", 0xE6C9, 0x00, 0x87, 0xFF, 0x26, 0xFB },
-  { "NOP                             ", 0xE6CB, 0x32, 0x32, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xE6CC, 0x32, 0x32, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xE6CD, 0x32, 0x32, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xE6CE, 0x32, 0x32, 0xFF, 0x24, 0xFB },
-  { "BEQ $E6E3                       ", 0xE6CF, 0x32, 0x32, 0xFF, 0x24, 0xFB },
-  { "BMI $E6E3                       ", 0xE6D1, 0x32, 0x32, 0xFF, 0x24, 0xFB },
-  { "BVS $E6E3                       ", 0xE6D3, 0x32, 0x32, 0xFF, 0x24, 0xFB },
-  { "BCS $E6E3                       ", 0xE6D5, 0x32, 0x32, 0xFF, 0x24, 0xFB },
-  { "CMP #$32                        ", 0xE6D7, 0x32, 0x32, 0xFF, 0x24, 0xFB },
-  { "BNE $E6E3                       ", 0xE6D9, 0x32, 0x32, 0xFF, 0x27, 0xFB },
-  { "CPX #$32                        ", 0xE6DB, 0x32, 0x32, 0xFF, 0x27, 0xFB },
-  { "BNE $E6E3                       ", 0xE6DD, 0x32, 0x32, 0xFF, 0x27, 0xFB },
-  { "CPY #$FF                        ", 0xE6DF, 0x32, 0x32, 0xFF, 0x27, 0xFB },
-  { "BEQ $E6E7                       ", 0xE6E1, 0x32, 0x32, 0xFF, 0x27, 0xFB },
-  { "LDA #$87                        ", 0xE6E7, 0x32, 0x32, 0xFF, 0x27, 0xFB },
-  { "STA $0587 = 00                  ", 0xE6E9, 0x87, 0x32, 0xFF, 0xA5, 0xFB },
-  { "LDA #$32                        ", 0xE6EC, 0x87, 0x32, 0xFF, 0xA5, 0xFB },
-  { "STA $0588 = 00                  ", 0xE6EE, 0x32, 0x32, 0xFF, 0x25, 0xFB },
-  { "LDY #$30                        ", 0xE6F1, 0x32, 0x32, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xE6F3, 0x32, 0x32, 0x30, 0x25, 0xFB },
-  { "SEC                             ", 0xE6F5, 0x32, 0x32, 0x30, 0xE5, 0xFB },
-  { "LDA #$00                        ", 0xE6F6, 0x32, 0x32, 0x30, 0xE5, 0xFB },
-  { "LAX $0557,Y @ 0587 = 87         ", 0xE6F8, 0x00, 0x32, 0x30, 0x67, 0xFB },
-  { "NOP                             ", 0xE6FB, 0x87, 0x87, 0x30, 0xE5, 0xFB },
-  { "NOP                             ", 0xE6FC, 0x87, 0x87, 0x30, 0xE5, 0xFB },
-  { "NOP                             ", 0xE6FD, 0x87, 0x87, 0x30, 0xE5, 0xFB },
-  { "NOP                             ", 0xE6FE, 0x87, 0x87, 0x30, 0xE5, 0xFB },
-  { "BEQ $E713                       ", 0xE6FF, 0x87, 0x87, 0x30, 0xE5, 0xFB },
-  { "BPL $E713                       ", 0xE701, 0x87, 0x87, 0x30, 0xE5, 0xFB },
-  { "BVC $E713                       ", 0xE703, 0x87, 0x87, 0x30, 0xE5, 0xFB },
-  { "BCC $E713                       ", 0xE705, 0x87, 0x87, 0x30, 0xE5, 0xFB },
-  { "CMP #$87                        ", 0xE707, 0x87, 0x87, 0x30, 0xE5, 0xFB },
-  { "BNE $E713                       ", 0xE709, 0x87, 0x87, 0x30, 0x67, 0xFB },
-  { "CPX #$87                        ", 0xE70B, 0x87, 0x87, 0x30, 0x67, 0xFB },
-  { "BNE $E713                       ", 0xE70D, 0x87, 0x87, 0x30, 0x67, 0xFB },
-  { "CPY #$30                        ", 0xE70F, 0x87, 0x87, 0x30, 0x67, 0xFB },
-  { "BEQ $E717                       ", 0xE711, 0x87, 0x87, 0x30, 0x67, 0xFB },
-  { "LDY #$40                        ", 0xE717, 0x87, 0x87, 0x30, 0x67, 0xFB },
-  { "CLV                             ", 0xE719, 0x87, 0x87, 0x40, 0x65, 0xFB },
-  { "CLC                             ", 0xE71A, 0x87, 0x87, 0x40, 0x25, 0xFB },
-  { "LDA #$00                        ", 0xE71B, 0x87, 0x87, 0x40, 0x24, 0xFB },
-  { "LAX $0548,Y @ 0588 = 32         ", 0xE71D, 0x00, 0x87, 0x40, 0x26, 0xFB },
-  { "NOP                             ", 0xE720, 0x32, 0x32, 0x40, 0x24, 0xFB },
-  { "NOP                             ", 0xE721, 0x32, 0x32, 0x40, 0x24, 0xFB },
-  { "NOP                             ", 0xE722, 0x32, 0x32, 0x40, 0x24, 0xFB },
-  { "NOP                             ", 0xE723, 0x32, 0x32, 0x40, 0x24, 0xFB },
-  { "BEQ $E738                       ", 0xE724, 0x32, 0x32, 0x40, 0x24, 0xFB },
-  { "BMI $E738                       ", 0xE726, 0x32, 0x32, 0x40, 0x24, 0xFB },
-  { "BVS $E738                       ", 0xE728, 0x32, 0x32, 0x40, 0x24, 0xFB },
-  { "BCS $E738                       ", 0xE72A, 0x32, 0x32, 0x40, 0x24, 0xFB },
-  { "CMP #$32                        ", 0xE72C, 0x32, 0x32, 0x40, 0x24, 0xFB },
-  { "BNE $E738                       ", 0xE72E, 0x32, 0x32, 0x40, 0x27, 0xFB },
-  { "CPX #$32                        ", 0xE730, 0x32, 0x32, 0x40, 0x27, 0xFB },
-  { "BNE $E738                       ", 0xE732, 0x32, 0x32, 0x40, 0x27, 0xFB },
-  { "CPY #$40                        ", 0xE734, 0x32, 0x32, 0x40, 0x27, 0xFB },
-  { "BEQ $E73C                       ", 0xE736, 0x32, 0x32, 0x40, 0x27, 0xFB },
-  { "RTS                             ", 0xE73C, 0x32, 0x32, 0x40, 0x27, 0xFB },
-  { "JSR $E73D                       ", 0xC635, 0x32, 0x32, 0x40, 0x27, 0xFD },
-  { "LDA #$C0                        ", 0xE73D, 0x32, 0x32, 0x40, 0x27, 0xFB },
-  { "STA $01 = FF                    ", 0xE73F, 0xC0, 0x32, 0x40, 0xA5, 0xFB },
-  { "LDA #$00                        ", 0xE741, 0xC0, 0x32, 0x40, 0xA5, 0xFB },
-  { "STA $0489 = 00                  ", 0xE743, 0x00, 0x32, 0x40, 0x27, 0xFB },
-  { "LDA #$89                        ", 0xE746, 0x00, 0x32, 0x40, 0x27, 0xFB },
-  { "STA $60 = 00                    ", 0xE748, 0x89, 0x32, 0x40, 0xA5, 0xFB },
-  { "LDA #$04                        ", 0xE74A, 0x89, 0x32, 0x40, 0xA5, 0xFB },
-  { "STA $61 = 00                    ", 0xE74C, 0x04, 0x32, 0x40, 0x25, 0xFB },
-  { "LDY #$44                        ", 0xE74E, 0x04, 0x32, 0x40, 0x25, 0xFB },
-  { "LDX #$17                        ", 0xE750, 0x04, 0x32, 0x44, 0x25, 0xFB },
-  { "LDA #$3E                        ", 0xE752, 0x04, 0x17, 0x44, 0x25, 0xFB },
-  { "BIT $01 = C0                    ", 0xE754, 0x3E, 0x17, 0x44, 0x25, 0xFB },
-  { "CLC                             ", 0xE756, 0x3E, 0x17, 0x44, 0xE7, 0xFB },
-  { "SAX ($49,X) @ 60 = 0489 = 00    ", 0xE757, 0x3E, 0x17, 0x44, 0xE6, 0xFB },
-  { "NOP                             ", 0xE759, 0x3E, 0x17, 0x44, 0xE6, 0xFB },
-  { "NOP                             ", 0xE75A, 0x3E, 0x17, 0x44, 0xE6, 0xFB },
-  { "NOP                             ", 0xE75B, 0x3E, 0x17, 0x44, 0xE6, 0xFB },
-  { "NOP                             ", 0xE75C, 0x3E, 0x17, 0x44, 0xE6, 0xFB },
-  { "BNE $E778                       ", 0xE75D, 0x3E, 0x17, 0x44, 0xE6, 0xFB },
-  { "BCS $E778                       ", 0xE75F, 0x3E, 0x17, 0x44, 0xE6, 0xFB },
-  { "BVC $E778                       ", 0xE761, 0x3E, 0x17, 0x44, 0xE6, 0xFB },
-  { "BPL $E778                       ", 0xE763, 0x3E, 0x17, 0x44, 0xE6, 0xFB },
-  { "CMP #$3E                        ", 0xE765, 0x3E, 0x17, 0x44, 0xE6, 0xFB },
-  { "BNE $E778                       ", 0xE767, 0x3E, 0x17, 0x44, 0x67, 0xFB },
-  { "CPY #$44                        ", 0xE769, 0x3E, 0x17, 0x44, 0x67, 0xFB },
-  { "BNE $E778                       ", 0xE76B, 0x3E, 0x17, 0x44, 0x67, 0xFB },
-  { "CPX #$17                        ", 0xE76D, 0x3E, 0x17, 0x44, 0x67, 0xFB },
-  { "BNE $E778                       ", 0xE76F, 0x3E, 0x17, 0x44, 0x67, 0xFB },
-  { "LDA $0489 = 16                  ", 0xE771, 0x3E, 0x17, 0x44, 0x67, 0xFB },
-  { "CMP #$16                        ", 0xE774, 0x16, 0x17, 0x44, 0x65, 0xFB },
-  { "BEQ $E77C                       ", 0xE776, 0x16, 0x17, 0x44, 0x67, 0xFB },
-  { "LDY #$44                        ", 0xE77C, 0x16, 0x17, 0x44, 0x67, 0xFB },
-  { "LDX #$7A                        ", 0xE77E, 0x16, 0x17, 0x44, 0x65, 0xFB },
-  { "LDA #$66                        ", 0xE780, 0x16, 0x7A, 0x44, 0x65, 0xFB },
-  { "SEC                             ", 0xE782, 0x66, 0x7A, 0x44, 0x65, 0xFB },
-  { "CLV                             ", 0xE783, 0x66, 0x7A, 0x44, 0x65, 0xFB },
-  { "SAX ($E6,X) @ 60 = 0489 = 16    ", 0xE784, 0x66, 0x7A, 0x44, 0x25, 0xFB },
-  { "NOP                             ", 0xE786, 0x66, 0x7A, 0x44, 0x25, 0xFB },
-  { "NOP                             ", 0xE787, 0x66, 0x7A, 0x44, 0x25, 0xFB },
-  { "NOP                             ", 0xE788, 0x66, 0x7A, 0x44, 0x25, 0xFB },
-  { "NOP                             ", 0xE789, 0x66, 0x7A, 0x44, 0x25, 0xFB },
-  { "BEQ $E7A5                       ", 0xE78A, 0x66, 0x7A, 0x44, 0x25, 0xFB },
-  { "BCC $E7A5                       ", 0xE78C, 0x66, 0x7A, 0x44, 0x25, 0xFB },
-  { "BVS $E7A5                       ", 0xE78E, 0x66, 0x7A, 0x44, 0x25, 0xFB },
-  { "BMI $E7A5                       ", 0xE790, 0x66, 0x7A, 0x44, 0x25, 0xFB },
-  { "CMP #$66                        ", 0xE792, 0x66, 0x7A, 0x44, 0x25, 0xFB },
-  { "BNE $E7A5                       ", 0xE794, 0x66, 0x7A, 0x44, 0x27, 0xFB },
-  { "CPY #$44                        ", 0xE796, 0x66, 0x7A, 0x44, 0x27, 0xFB },
-  { "BNE $E7A5                       ", 0xE798, 0x66, 0x7A, 0x44, 0x27, 0xFB },
-  { "CPX #$7A                        ", 0xE79A, 0x66, 0x7A, 0x44, 0x27, 0xFB },
-  { "BNE $E7A5                       ", 0xE79C, 0x66, 0x7A, 0x44, 0x27, 0xFB },
-  { "LDA $0489 = 62                  ", 0xE79E, 0x66, 0x7A, 0x44, 0x27, 0xFB },
-  { "CMP #$62                        ", 0xE7A1, 0x62, 0x7A, 0x44, 0x25, 0xFB },
-  { "BEQ $E7A9                       ", 0xE7A3, 0x62, 0x7A, 0x44, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xE7A9, 0x62, 0x7A, 0x44, 0x27, 0xFB },
-  { "STA $49 = 00                    ", 0xE7AB, 0xFF, 0x7A, 0x44, 0xA5, 0xFB },
-  { "LDY #$44                        ", 0xE7AD, 0xFF, 0x7A, 0x44, 0xA5, 0xFB },
-  { "LDX #$AA                        ", 0xE7AF, 0xFF, 0x7A, 0x44, 0x25, 0xFB },
-  { "LDA #$55                        ", 0xE7B1, 0xFF, 0xAA, 0x44, 0xA5, 0xFB },
-  { "BIT $01 = C0                    ", 0xE7B3, 0x55, 0xAA, 0x44, 0x25, 0xFB },
-  { "CLC                             ", 0xE7B5, 0x55, 0xAA, 0x44, 0xE5, 0xFB },
-  { "SAX $49 = FF                    ", 0xE7B6, 0x55, 0xAA, 0x44, 0xE4, 0xFB },
-  { "NOP                             ", 0xE7B8, 0x55, 0xAA, 0x44, 0xE4, 0xFB },
-  { "NOP                             ", 0xE7B9, 0x55, 0xAA, 0x44, 0xE4, 0xFB },
-  { "NOP                             ", 0xE7BA, 0x55, 0xAA, 0x44, 0xE4, 0xFB },
-  { "NOP                             ", 0xE7BB, 0x55, 0xAA, 0x44, 0xE4, 0xFB },
-  { "BEQ $E7D6                       ", 0xE7BC, 0x55, 0xAA, 0x44, 0xE4, 0xFB },
-  { "BCS $E7D6                       ", 0xE7BE, 0x55, 0xAA, 0x44, 0xE4, 0xFB },
-  { "BVC $E7D6                       ", 0xE7C0, 0x55, 0xAA, 0x44, 0xE4, 0xFB },
-  { "BPL $E7D6                       ", 0xE7C2, 0x55, 0xAA, 0x44, 0xE4, 0xFB },
-  { "CMP #$55                        ", 0xE7C4, 0x55, 0xAA, 0x44, 0xE4, 0xFB },
-  { "BNE $E7D6                       ", 0xE7C6, 0x55, 0xAA, 0x44, 0x67, 0xFB },
-  { "CPY #$44                        ", 0xE7C8, 0x55, 0xAA, 0x44, 0x67, 0xFB },
-  { "BNE $E7D6                       ", 0xE7CA, 0x55, 0xAA, 0x44, 0x67, 0xFB },
-  { "CPX #$AA                        ", 0xE7CC, 0x55, 0xAA, 0x44, 0x67, 0xFB },
-  { "BNE $E7D6                       ", 0xE7CE, 0x55, 0xAA, 0x44, 0x67, 0xFB },
-  { "LDA $49 = 00                    ", 0xE7D0, 0x55, 0xAA, 0x44, 0x67, 0xFB },
-  { "CMP #$00                        ", 0xE7D2, 0x00, 0xAA, 0x44, 0x67, 0xFB },
-  { "BEQ $E7DA                       ", 0xE7D4, 0x00, 0xAA, 0x44, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xE7DA, 0x00, 0xAA, 0x44, 0x67, 0xFB },
-  { "STA $56 = 00                    ", 0xE7DC, 0x00, 0xAA, 0x44, 0x67, 0xFB },
-  { "LDY #$58                        ", 0xE7DE, 0x00, 0xAA, 0x44, 0x67, 0xFB },
-  { "LDX #$EF                        ", 0xE7E0, 0x00, 0xAA, 0x58, 0x65, 0xFB },
-  { "LDA #$66                        ", 0xE7E2, 0x00, 0xEF, 0x58, 0xE5, 0xFB },
-  { "SEC                             ", 0xE7E4, 0x66, 0xEF, 0x58, 0x65, 0xFB },
-  { "CLV                             ", 0xE7E5, 0x66, 0xEF, 0x58, 0x65, 0xFB },
-  { "SAX $56 = 00                    ", 0xE7E6, 0x66, 0xEF, 0x58, 0x25, 0xFB },
-  { "NOP                             ", 0xE7E8, 0x66, 0xEF, 0x58, 0x25, 0xFB },
-  { "NOP                             ", 0xE7E9, 0x66, 0xEF, 0x58, 0x25, 0xFB },
-  { "NOP                             ", 0xE7EA, 0x66, 0xEF, 0x58, 0x25, 0xFB },
-  { "NOP                             ", 0xE7EB, 0x66, 0xEF, 0x58, 0x25, 0xFB },
-  { "BEQ $E806                       ", 0xE7EC, 0x66, 0xEF, 0x58, 0x25, 0xFB },
-  { "BCC $E806                       ", 0xE7EE, 0x66, 0xEF, 0x58, 0x25, 0xFB },
-  { "BVS $E806                       ", 0xE7F0, 0x66, 0xEF, 0x58, 0x25, 0xFB },
-  { "BMI $E806                       ", 0xE7F2, 0x66, 0xEF, 0x58, 0x25, 0xFB },
-  { "CMP #$66                        ", 0xE7F4, 0x66, 0xEF, 0x58, 0x25, 0xFB },
-  { "BNE $E806                       ", 0xE7F6, 0x66, 0xEF, 0x58, 0x27, 0xFB },
-  { "CPY #$58                        ", 0xE7F8, 0x66, 0xEF, 0x58, 0x27, 0xFB },
-  { "BNE $E806                       ", 0xE7FA, 0x66, 0xEF, 0x58, 0x27, 0xFB },
-  { "CPX #$EF                        ", 0xE7FC, 0x66, 0xEF, 0x58, 0x27, 0xFB },
-  { "BNE $E806                       ", 0xE7FE, 0x66, 0xEF, 0x58, 0x27, 0xFB },
-  { "LDA $56 = 66                    ", 0xE800, 0x66, 0xEF, 0x58, 0x27, 0xFB },
-  { "CMP #$66                        ", 0xE802, 0x66, 0xEF, 0x58, 0x25, 0xFB },
-  { "BEQ $E80A                       ", 0xE804, 0x66, 0xEF, 0x58, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xE80A, 0x66, 0xEF, 0x58, 0x27, 0xFB },
-  { "STA $0549 = 00                  ", 0xE80C, 0xFF, 0xEF, 0x58, 0xA5, 0xFB },
-  { "LDY #$E5                        ", 0xE80F, 0xFF, 0xEF, 0x58, 0xA5, 0xFB },
-  { "LDX #$AF                        ", 0xE811, 0xFF, 0xEF, 0xE5, 0xA5, 0xFB },
-  { "LDA #$F5                        ", 0xE813, 0xFF, 0xAF, 0xE5, 0xA5, 0xFB },
-  { "BIT $01 = C0                    ", 0xE815, 0xF5, 0xAF, 0xE5, 0xA5, 0xFB },
-  { "CLC                             ", 0xE817, 0xF5, 0xAF, 0xE5, 0xE5, 0xFB },
-  { "SAX $0549 = FF                  ", 0xE818, 0xF5, 0xAF, 0xE5, 0xE4, 0xFB },
-  { "NOP                             ", 0xE81B, 0xF5, 0xAF, 0xE5, 0xE4, 0xFB },
-  { "NOP                             ", 0xE81C, 0xF5, 0xAF, 0xE5, 0xE4, 0xFB },
-  { "NOP                             ", 0xE81D, 0xF5, 0xAF, 0xE5, 0xE4, 0xFB },
-  { "NOP                             ", 0xE81E, 0xF5, 0xAF, 0xE5, 0xE4, 0xFB },
-  { "BEQ $E83A                       ", 0xE81F, 0xF5, 0xAF, 0xE5, 0xE4, 0xFB },
-  { "BCS $E83A                       ", 0xE821, 0xF5, 0xAF, 0xE5, 0xE4, 0xFB },
-  { "BVC $E83A                       ", 0xE823, 0xF5, 0xAF, 0xE5, 0xE4, 0xFB },
-  { "BPL $E83A                       ", 0xE825, 0xF5, 0xAF, 0xE5, 0xE4, 0xFB },
-  { "CMP #$F5                        ", 0xE827, 0xF5, 0xAF, 0xE5, 0xE4, 0xFB },
-  { "BNE $E83A                       ", 0xE829, 0xF5, 0xAF, 0xE5, 0x67, 0xFB },
-  { "CPY #$E5                        ", 0xE82B, 0xF5, 0xAF, 0xE5, 0x67, 0xFB },
-  { "BNE $E83A                       ", 0xE82D, 0xF5, 0xAF, 0xE5, 0x67, 0xFB },
-  { "CPX #$AF                        ", 0xE82F, 0xF5, 0xAF, 0xE5, 0x67, 0xFB },
-  { "BNE $E83A                       ", 0xE831, 0xF5, 0xAF, 0xE5, 0x67, 0xFB },
-  { "LDA $0549 = A5                  ", 0xE833, 0xF5, 0xAF, 0xE5, 0x67, 0xFB },
-  { "CMP #$A5                        ", 0xE836, 0xA5, 0xAF, 0xE5, 0xE5, 0xFB },
-  { "BEQ $E83E                       ", 0xE838, 0xA5, 0xAF, 0xE5, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xE83E, 0xA5, 0xAF, 0xE5, 0x67, 0xFB },
-  { "STA $0556 = 00                  ", 0xE840, 0x00, 0xAF, 0xE5, 0x67, 0xFB },
-  { "LDY #$58                        ", 0xE843, 0x00, 0xAF, 0xE5, 0x67, 0xFB },
-  { "LDX #$B3                        ", 0xE845, 0x00, 0xAF, 0x58, 0x65, 0xFB },
-  { "LDA #$97                        ", 0xE847, 0x00, 0xB3, 0x58, 0xE5, 0xFB },
-  { "SEC                             ", 0xE849, 0x97, 0xB3, 0x58, 0xE5, 0xFB },
-  { "CLV                             ", 0xE84A, 0x97, 0xB3, 0x58, 0xE5, 0xFB },
-  { "SAX $0556 = 00                  ", 0xE84B, 0x97, 0xB3, 0x58, 0xA5, 0xFB },
-  { "NOP                             ", 0xE84E, 0x97, 0xB3, 0x58, 0xA5, 0xFB },
-  { "NOP                             ", 0xE84F, 0x97, 0xB3, 0x58, 0xA5, 0xFB },
-  { "NOP                             ", 0xE850, 0x97, 0xB3, 0x58, 0xA5, 0xFB },
-  { "NOP                             ", 0xE851, 0x97, 0xB3, 0x58, 0xA5, 0xFB },
-  { "BEQ $E86D                       ", 0xE852, 0x97, 0xB3, 0x58, 0xA5, 0xFB },
-  { "BCC $E86D                       ", 0xE854, 0x97, 0xB3, 0x58, 0xA5, 0xFB },
-  { "BVS $E86D                       ", 0xE856, 0x97, 0xB3, 0x58, 0xA5, 0xFB },
-  { "BPL $E86D                       ", 0xE858, 0x97, 0xB3, 0x58, 0xA5, 0xFB },
-  { "CMP #$97                        ", 0xE85A, 0x97, 0xB3, 0x58, 0xA5, 0xFB },
-  { "BNE $E86D                       ", 0xE85C, 0x97, 0xB3, 0x58, 0x27, 0xFB },
-  { "CPY #$58                        ", 0xE85E, 0x97, 0xB3, 0x58, 0x27, 0xFB },
-  { "BNE $E86D                       ", 0xE860, 0x97, 0xB3, 0x58, 0x27, 0xFB },
-  { "CPX #$B3                        ", 0xE862, 0x97, 0xB3, 0x58, 0x27, 0xFB },
-  { "BNE $E86D                       ", 0xE864, 0x97, 0xB3, 0x58, 0x27, 0xFB },
-  { "LDA $0556 = 93                  ", 0xE866, 0x97, 0xB3, 0x58, 0x27, 0xFB },
-  { "CMP #$93                        ", 0xE869, 0x93, 0xB3, 0x58, 0xA5, 0xFB },
-  { "BEQ $E871                       ", 0xE86B, 0x93, 0xB3, 0x58, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xE871, 0x93, 0xB3, 0x58, 0x27, 0xFB },
-  { "STA $49 = 00                    ", 0xE873, 0xFF, 0xB3, 0x58, 0xA5, 0xFB },
-  { "LDY #$FF                        ", 0xE875, 0xFF, 0xB3, 0x58, 0xA5, 0xFB },
-  { "LDX #$AA                        ", 0xE877, 0xFF, 0xB3, 0xFF, 0xA5, 0xFB },
-  { "LDA #$55                        ", 0xE879, 0xFF, 0xAA, 0xFF, 0xA5, 0xFB },
-  { "BIT $01 = C0                    ", 0xE87B, 0x55, 0xAA, 0xFF, 0x25, 0xFB },
-  { "CLC                             ", 0xE87D, 0x55, 0xAA, 0xFF, 0xE5, 0xFB },
-  { "SAX $4A,Y @ 49 = FF             ", 0xE87E, 0x55, 0xAA, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xE880, 0x55, 0xAA, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xE881, 0x55, 0xAA, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xE882, 0x55, 0xAA, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xE883, 0x55, 0xAA, 0xFF, 0xE4, 0xFB },
-  { "BEQ $E89E                       ", 0xE884, 0x55, 0xAA, 0xFF, 0xE4, 0xFB },
-  { "BCS $E89E                       ", 0xE886, 0x55, 0xAA, 0xFF, 0xE4, 0xFB },
-  { "BVC $E89E                       ", 0xE888, 0x55, 0xAA, 0xFF, 0xE4, 0xFB },
-  { "BPL $E89E                       ", 0xE88A, 0x55, 0xAA, 0xFF, 0xE4, 0xFB },
-  { "CMP #$55                        ", 0xE88C, 0x55, 0xAA, 0xFF, 0xE4, 0xFB },
-  { "BNE $E89E                       ", 0xE88E, 0x55, 0xAA, 0xFF, 0x67, 0xFB },
-  { "CPY #$FF                        ", 0xE890, 0x55, 0xAA, 0xFF, 0x67, 0xFB },
-  { "BNE $E89E                       ", 0xE892, 0x55, 0xAA, 0xFF, 0x67, 0xFB },
-  { "CPX #$AA                        ", 0xE894, 0x55, 0xAA, 0xFF, 0x67, 0xFB },
-  { "BNE $E89E                       ", 0xE896, 0x55, 0xAA, 0xFF, 0x67, 0xFB },
-  { "LDA $49 = 00                    ", 0xE898, 0x55, 0xAA, 0xFF, 0x67, 0xFB },
-  { "CMP #$00                        ", 0xE89A, 0x00, 0xAA, 0xFF, 0x67, 0xFB },
-  { "BEQ $E8A2                       ", 0xE89C, 0x00, 0xAA, 0xFF, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xE8A2, 0x00, 0xAA, 0xFF, 0x67, 0xFB },
-  { "STA $56 = 66                    ", 0xE8A4, 0x00, 0xAA, 0xFF, 0x67, 0xFB },
-  { "LDY #$06                        ", 0xE8A6, 0x00, 0xAA, 0xFF, 0x67, 0xFB },
-  { "LDX #$EF                        ", 0xE8A8, 0x00, 0xAA, 0x06, 0x65, 0xFB },
-  { "LDA #$66                        ", 0xE8AA, 0x00, 0xEF, 0x06, 0xE5, 0xFB },
-  { "SEC                             ", 0xE8AC, 0x66, 0xEF, 0x06, 0x65, 0xFB },
-  { "CLV                             ", 0xE8AD, 0x66, 0xEF, 0x06, 0x65, 0xFB },
-  { "SAX $50,Y @ 56 = 00             ", 0xE8AE, 0x66, 0xEF, 0x06, 0x25, 0xFB },
-  { "NOP                             ", 0xE8B0, 0x66, 0xEF, 0x06, 0x25, 0xFB },
-  { "NOP                             ", 0xE8B1, 0x66, 0xEF, 0x06, 0x25, 0xFB },
-  { "NOP                             ", 0xE8B2, 0x66, 0xEF, 0x06, 0x25, 0xFB },
-  { "NOP                             ", 0xE8B3, 0x66, 0xEF, 0x06, 0x25, 0xFB },
-  { "BEQ $E8CE                       ", 0xE8B4, 0x66, 0xEF, 0x06, 0x25, 0xFB },
-  { "BCC $E8CE                       ", 0xE8B6, 0x66, 0xEF, 0x06, 0x25, 0xFB },
-  { "BVS $E8CE                       ", 0xE8B8, 0x66, 0xEF, 0x06, 0x25, 0xFB },
-  { "BMI $E8CE                       ", 0xE8BA, 0x66, 0xEF, 0x06, 0x25, 0xFB },
-  { "CMP #$66                        ", 0xE8BC, 0x66, 0xEF, 0x06, 0x25, 0xFB },
-  { "BNE $E8CE                       ", 0xE8BE, 0x66, 0xEF, 0x06, 0x27, 0xFB },
-  { "CPY #$06                        ", 0xE8C0, 0x66, 0xEF, 0x06, 0x27, 0xFB },
-  { "BNE $E8CE                       ", 0xE8C2, 0x66, 0xEF, 0x06, 0x27, 0xFB },
-  { "CPX #$EF                        ", 0xE8C4, 0x66, 0xEF, 0x06, 0x27, 0xFB },
-  { "BNE $E8CE                       ", 0xE8C6, 0x66, 0xEF, 0x06, 0x27, 0xFB },
-  { "LDA $56 = 66                    ", 0xE8C8, 0x66, 0xEF, 0x06, 0x27, 0xFB },
-  { "CMP #$66                        ", 0xE8CA, 0x66, 0xEF, 0x06, 0x25, 0xFB },
-  { "BEQ $E8D2                       ", 0xE8CC, 0x66, 0xEF, 0x06, 0x27, 0xFB },
-  { "RTS                             ", 0xE8D2, 0x66, 0xEF, 0x06, 0x27, 0xFB },
-  { "JSR $E8D3                       ", 0xC638, 0x66, 0xEF, 0x06, 0x27, 0xFD },
-  { "LDY #$90                        ", 0xE8D3, 0x66, 0xEF, 0x06, 0x27, 0xFB },
-  { "JSR $F931                       ", 0xE8D5, 0x66, 0xEF, 0x90, 0xA5, 0xFB },
-  { "BIT $01 = C0                    ", 0xF931, 0x66, 0xEF, 0x90, 0xA5, 0xF9 },
-  { "LDA #$40                        ", 0xF933, 0x66, 0xEF, 0x90, 0xE5, 0xF9 },
-  { "SEC                             ", 0xF935, 0x40, 0xEF, 0x90, 0x65, 0xF9 },
-  { "RTS                             ", 0xF936, 0x40, 0xEF, 0x90, 0x65, 0xF9 },
-  { "SBC #$40                        ", 0xE8D8, 0x40, 0xEF, 0x90, 0x65, 0xFB },
-  { "NOP                             ", 0xE8DA, 0x00, 0xEF, 0x90, 0x27, 0xFB },
-  { "NOP                             ", 0xE8DB, 0x00, 0xEF, 0x90, 0x27, 0xFB },
-  { "NOP                             ", 0xE8DC, 0x00, 0xEF, 0x90, 0x27, 0xFB },
-  { "NOP                             ", 0xE8DD, 0x00, 0xEF, 0x90, 0x27, 0xFB },
-  { "JSR $F937                       ", 0xE8DE, 0x00, 0xEF, 0x90, 0x27, 0xFB },
-  { "BMI $F944                       ", 0xF937, 0x00, 0xEF, 0x90, 0x27, 0xF9 },
-  { "BCC $F944                       ", 0xF939, 0x00, 0xEF, 0x90, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF93B, 0x00, 0xEF, 0x90, 0x27, 0xF9 },
-  { "BVS $F944                       ", 0xF93D, 0x00, 0xEF, 0x90, 0x27, 0xF9 },
-  { "CMP #$00                        ", 0xF93F, 0x00, 0xEF, 0x90, 0x27, 0xF9 },
-  { "BNE $F944                       ", 0xF941, 0x00, 0xEF, 0x90, 0x27, 0xF9 },
-  { "RTS                             ", 0xF943, 0x00, 0xEF, 0x90, 0x27, 0xF9 },
-  { "INY                             ", 0xE8E1, 0x00, 0xEF, 0x90, 0x27, 0xFB },
-  { "JSR $F947                       ", 0xE8E2, 0x00, 0xEF, 0x91, 0xA5, 0xFB },
-  { "CLV                             ", 0xF947, 0x00, 0xEF, 0x91, 0xA5, 0xF9 },
-  { "SEC                             ", 0xF948, 0x00, 0xEF, 0x91, 0xA5, 0xF9 },
-  { "LDA #$40                        ", 0xF949, 0x00, 0xEF, 0x91, 0xA5, 0xF9 },
-  { "RTS                             ", 0xF94B, 0x40, 0xEF, 0x91, 0x25, 0xF9 },
-  { "SBC #$3F                        ", 0xE8E5, 0x40, 0xEF, 0x91, 0x25, 0xFB },
-  { "NOP                             ", 0xE8E7, 0x01, 0xEF, 0x91, 0x25, 0xFB },
-  { "NOP                             ", 0xE8E8, 0x01, 0xEF, 0x91, 0x25, 0xFB },
-  { "NOP                             ", 0xE8E9, 0x01, 0xEF, 0x91, 0x25, 0xFB },
-  { "NOP                             ", 0xE8EA, 0x01, 0xEF, 0x91, 0x25, 0xFB },
-  { "JSR $F94C                       ", 0xE8EB, 0x01, 0xEF, 0x91, 0x25, 0xFB },
-  { "BEQ $F959                       ", 0xF94C, 0x01, 0xEF, 0x91, 0x25, 0xF9 },
-  { "BMI $F959                       ", 0xF94E, 0x01, 0xEF, 0x91, 0x25, 0xF9 },
-  { "BCC $F959                       ", 0xF950, 0x01, 0xEF, 0x91, 0x25, 0xF9 },
-  { "BVS $F959                       ", 0xF952, 0x01, 0xEF, 0x91, 0x25, 0xF9 },
-  { "CMP #$01                        ", 0xF954, 0x01, 0xEF, 0x91, 0x25, 0xF9 },
-  { "BNE $F959                       ", 0xF956, 0x01, 0xEF, 0x91, 0x27, 0xF9 },
-  { "RTS                             ", 0xF958, 0x01, 0xEF, 0x91, 0x27, 0xF9 },
-  { "INY                             ", 0xE8EE, 0x01, 0xEF, 0x91, 0x27, 0xFB },
-  { "JSR $F95C                       ", 0xE8EF, 0x01, 0xEF, 0x92, 0xA5, 0xFB },
-  { "LDA #$40                        ", 0xF95C, 0x01, 0xEF, 0x92, 0xA5, 0xF9 },
-  { "SEC                             ", 0xF95E, 0x40, 0xEF, 0x92, 0x25, 0xF9 },
-  { "BIT $01 = C0                    ", 0xF95F, 0x40, 0xEF, 0x92, 0x25, 0xF9 },
-  { "RTS                             ", 0xF961, 0x40, 0xEF, 0x92, 0xE5, 0xF9 },
-  { "SBC #$41                        ", 0xE8F2, 0x40, 0xEF, 0x92, 0xE5, 0xFB },
-  { "NOP                             ", 0xE8F4, 0xFF, 0xEF, 0x92, 0xA4, 0xFB },
-  { "NOP                             ", 0xE8F5, 0xFF, 0xEF, 0x92, 0xA4, 0xFB },
-  { "NOP                             ", 0xE8F6, 0xFF, 0xEF, 0x92, 0xA4, 0xFB },
-  { "NOP                             ", 0xE8F7, 0xFF, 0xEF, 0x92, 0xA4, 0xFB },
-  { "JSR $F962                       ", 0xE8F8, 0xFF, 0xEF, 0x92, 0xA4, 0xFB },
-  { "BCS $F96F                       ", 0xF962, 0xFF, 0xEF, 0x92, 0xA4, 0xF9 },
-  { "BEQ $F96F                       ", 0xF964, 0xFF, 0xEF, 0x92, 0xA4, 0xF9 },
-  { "BPL $F96F                       ", 0xF966, 0xFF, 0xEF, 0x92, 0xA4, 0xF9 },
-  { "BVS $F96F                       ", 0xF968, 0xFF, 0xEF, 0x92, 0xA4, 0xF9 },
-  { "CMP #$FF                        ", 0xF96A, 0xFF, 0xEF, 0x92, 0xA4, 0xF9 },
-  { "BNE $F96F                       ", 0xF96C, 0xFF, 0xEF, 0x92, 0x27, 0xF9 },
-  { "RTS                             ", 0xF96E, 0xFF, 0xEF, 0x92, 0x27, 0xF9 },
-  { "INY                             ", 0xE8FB, 0xFF, 0xEF, 0x92, 0x27, 0xFB },
-  { "JSR $F972                       ", 0xE8FC, 0xFF, 0xEF, 0x93, 0xA5, 0xFB },
-  { "CLC                             ", 0xF972, 0xFF, 0xEF, 0x93, 0xA5, 0xF9 },
-  { "LDA #$80                        ", 0xF973, 0xFF, 0xEF, 0x93, 0xA4, 0xF9 },
-  { "RTS                             ", 0xF975, 0x80, 0xEF, 0x93, 0xA4, 0xF9 },
-  { "SBC #$00                        ", 0xE8FF, 0x80, 0xEF, 0x93, 0xA4, 0xFB },
-  { "NOP                             ", 0xE901, 0x7F, 0xEF, 0x93, 0x65, 0xFB },
-  { "NOP                             ", 0xE902, 0x7F, 0xEF, 0x93, 0x65, 0xFB },
-  { "NOP                             ", 0xE903, 0x7F, 0xEF, 0x93, 0x65, 0xFB },
-  { "NOP                             ", 0xE904, 0x7F, 0xEF, 0x93, 0x65, 0xFB },
-  { "JSR $F976                       ", 0xE905, 0x7F, 0xEF, 0x93, 0x65, 0xFB },
-  { "BCC $F97D                       ", 0xF976, 0x7F, 0xEF, 0x93, 0x65, 0xF9 },
-  { "CMP #$7F                        ", 0xF978, 0x7F, 0xEF, 0x93, 0x65, 0xF9 },
-  { "BNE $F97D                       ", 0xF97A, 0x7F, 0xEF, 0x93, 0x67, 0xF9 },
-  { "RTS                             ", 0xF97C, 0x7F, 0xEF, 0x93, 0x67, 0xF9 },
-  { "INY                             ", 0xE908, 0x7F, 0xEF, 0x93, 0x67, 0xFB },
-  { "JSR $F980                       ", 0xE909, 0x7F, 0xEF, 0x94, 0xE5, 0xFB },
-  { "SEC                             ", 0xF980, 0x7F, 0xEF, 0x94, 0xE5, 0xF9 },
-  { "LDA #$81                        ", 0xF981, 0x7F, 0xEF, 0x94, 0xE5, 0xF9 },
-  { "RTS                             ", 0xF983, 0x81, 0xEF, 0x94, 0xE5, 0xF9 },
-  { "SBC #$7F                        ", 0xE90C, 0x81, 0xEF, 0x94, 0xE5, 0xFB },
-  { "NOP                             ", 0xE90E, 0x02, 0xEF, 0x94, 0x65, 0xFB },
-  { "NOP                             ", 0xE90F, 0x02, 0xEF, 0x94, 0x65, 0xFB },
-  { "NOP                             ", 0xE910, 0x02, 0xEF, 0x94, 0x65, 0xFB },
-  { "NOP                             ", 0xE911, 0x02, 0xEF, 0x94, 0x65, 0xFB },
-  { "JSR $F984                       ", 0xE912, 0x02, 0xEF, 0x94, 0x65, 0xFB },
-  { "BVC $F98D                       ", 0xF984, 0x02, 0xEF, 0x94, 0x65, 0xF9 },
-  { "BCC $F98D                       ", 0xF986, 0x02, 0xEF, 0x94, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xF988, 0x02, 0xEF, 0x94, 0x65, 0xF9 },
-  { "BNE $F98D                       ", 0xF98A, 0x02, 0xEF, 0x94, 0x67, 0xF9 },
-  { "RTS                             ", 0xF98C, 0x02, 0xEF, 0x94, 0x67, 0xF9 },
-  { "RTS                             ", 0xE915, 0x02, 0xEF, 0x94, 0x67, 0xFB },
-  { "JSR $E916                       ", 0xC63B, 0x02, 0xEF, 0x94, 0x67, 0xFD },
-  { "LDA #$FF                        ", 0xE916, 0x02, 0xEF, 0x94, 0x67, 0xFB },
-  { "STA $01 = C0                    ", 0xE918, 0xFF, 0xEF, 0x94, 0xE5, 0xFB },
-  { "LDY #$95                        ", 0xE91A, 0xFF, 0xEF, 0x94, 0xE5, 0xFB },
-  { "LDX #$02                        ", 0xE91C, 0xFF, 0xEF, 0x95, 0xE5, 0xFB },
-  { "LDA #$47                        ", 0xE91E, 0xFF, 0x02, 0x95, 0x65, 0xFB },
-  { "STA $47 = 00                    ", 0xE920, 0x47, 0x02, 0x95, 0x65, 0xFB },
-  { "LDA #$06                        ", 0xE922, 0x47, 0x02, 0x95, 0x65, 0xFB },
-  { "STA $48 = 00                    ", 0xE924, 0x06, 0x02, 0x95, 0x65, 0xFB },
-  { "LDA #$EB                        ", 0xE926, 0x06, 0x02, 0x95, 0x65, 0xFB },
-  { "STA $0647 = 00                  ", 0xE928, 0xEB, 0x02, 0x95, 0xE5, 0xFB },
-  { "JSR $FA31                       ", 0xE92B, 0xEB, 0x02, 0x95, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA31, 0xEB, 0x02, 0x95, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA33, 0xEB, 0x02, 0x95, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFA34, 0xEB, 0x02, 0x95, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA36, 0x40, 0x02, 0x95, 0x64, 0xF9 },
-  { "DCP ($45,X) @ 47 = 0647 = EB    ", 0xE92E, 0x40, 0x02, 0x95, 0x64, 0xFB },
-  { "NOP                             ", 0xE930, 0x40, 0x02, 0x95, 0x64, 0xFB },
-  { "NOP                             ", 0xE931, 0x40, 0x02, 0x95, 0x64, 0xFB },
-  { "NOP                             ", 0xE932, 0x40, 0x02, 0x95, 0x64, 0xFB },
-  { "NOP                             ", 0xE933, 0x40, 0x02, 0x95, 0x64, 0xFB },
-  { "JSR $FA37                       ", 0xE934, 0x40, 0x02, 0x95, 0x64, 0xFB },
-  { "BVC $FA65                       ", 0xFA37, 0x40, 0x02, 0x95, 0x64, 0xF9 },
-  { "BCS $FA65                       ", 0xFA39, 0x40, 0x02, 0x95, 0x64, 0xF9 },
-  { "BMI $FA65                       ", 0xFA3B, 0x40, 0x02, 0x95, 0x64, 0xF9 },
-  { "CMP #$40                        ", 0xFA3D, 0x40, 0x02, 0x95, 0x64, 0xF9 },
-  { "BNE $FA65                       ", 0xFA3F, 0x40, 0x02, 0x95, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA41, 0x40, 0x02, 0x95, 0x67, 0xF9 },
-  { "LDA $0647 = EA                  ", 0xE937, 0x40, 0x02, 0x95, 0x67, 0xFB },
-  { "CMP #$EA                        ", 0xE93A, 0xEA, 0x02, 0x95, 0xE5, 0xFB },
-  { "BEQ $E940                       ", 0xE93C, 0xEA, 0x02, 0x95, 0x67, 0xFB },
-  { "INY                             ", 0xE940, 0xEA, 0x02, 0x95, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xE941, 0xEA, 0x02, 0x96, 0xE5, 0xFB },
-  { "STA $0647 = EA                  ", 0xE943, 0x00, 0x02, 0x96, 0x67, 0xFB },
-  { "JSR $FA42                       ", 0xE946, 0x00, 0x02, 0x96, 0x67, 0xFB },
-  { "CLV                             ", 0xFA42, 0x00, 0x02, 0x96, 0x67, 0xF9 },
-  { "SEC                             ", 0xFA43, 0x00, 0x02, 0x96, 0x27, 0xF9 },
-  { "LDA #$FF                        ", 0xFA44, 0x00, 0x02, 0x96, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA46, 0xFF, 0x02, 0x96, 0xA5, 0xF9 },
-  { "DCP ($45,X) @ 47 = 0647 = 00    ", 0xE949, 0xFF, 0x02, 0x96, 0xA5, 0xFB },
-  { "NOP                             ", 0xE94B, 0xFF, 0x02, 0x96, 0x27, 0xFB },
-  { "NOP                             ", 0xE94C, 0xFF, 0x02, 0x96, 0x27, 0xFB },
-  { "NOP                             ", 0xE94D, 0xFF, 0x02, 0x96, 0x27, 0xFB },
-  { "NOP                             ", 0xE94E, 0xFF, 0x02, 0x96, 0x27, 0xFB },
-  { "JSR $FA47                       ", 0xE94F, 0xFF, 0x02, 0x96, 0x27, 0xFB },
-  { "BVS $FA65                       ", 0xFA47, 0xFF, 0x02, 0x96, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA49, 0xFF, 0x02, 0x96, 0x27, 0xF9 },
-  { "BMI $FA65                       ", 0xFA4B, 0xFF, 0x02, 0x96, 0x27, 0xF9 },
-  { "BCC $FA65                       ", 0xFA4D, 0xFF, 0x02, 0x96, 0x27, 0xF9 },
-  { "CMP #$FF                        ", 0xFA4F, 0xFF, 0x02, 0x96, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA51, 0xFF, 0x02, 0x96, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA53, 0xFF, 0x02, 0x96, 0x27, 0xF9 },
-  { "LDA $0647 = FF                  ", 0xE952, 0xFF, 0x02, 0x96, 0x27, 0xFB },
-  { "CMP #$FF                        ", 0xE955, 0xFF, 0x02, 0x96, 0xA5, 0xFB },
-  { "BEQ $E95B                       ", 0xE957, 0xFF, 0x02, 0x96, 0x27, 0xFB },
-  { "INY                             ", 0xE95B, 0xFF, 0x02, 0x96, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xE95C, 0xFF, 0x02, 0x97, 0xA5, 0xFB },
-  { "STA $0647 = FF                  ", 0xE95E, 0x37, 0x02, 0x97, 0x25, 0xFB },
-  { "JSR $FA54                       ", 0xE961, 0x37, 0x02, 0x97, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA54, 0x37, 0x02, 0x97, 0x25, 0xF9 },
-  { "LDA #$F0                        ", 0xFA56, 0x37, 0x02, 0x97, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA58, 0xF0, 0x02, 0x97, 0xE5, 0xF9 },
-  { "DCP ($45,X) @ 47 = 0647 = 37    ", 0xE964, 0xF0, 0x02, 0x97, 0xE5, 0xFB },
-  { "NOP                             ", 0xE966, 0xF0, 0x02, 0x97, 0xE5, 0xFB },
-  { "NOP                             ", 0xE967, 0xF0, 0x02, 0x97, 0xE5, 0xFB },
-  { "NOP                             ", 0xE968, 0xF0, 0x02, 0x97, 0xE5, 0xFB },
-  { "NOP                             ", 0xE969, 0xF0, 0x02, 0x97, 0xE5, 0xFB },
-  { "JSR $FA59                       ", 0xE96A, 0xF0, 0x02, 0x97, 0xE5, 0xFB },
-  { "BVC $FA65                       ", 0xFA59, 0xF0, 0x02, 0x97, 0xE5, 0xF9 },
-  { "BEQ $FA65                       ", 0xFA5B, 0xF0, 0x02, 0x97, 0xE5, 0xF9 },
-  { "BPL $FA65                       ", 0xFA5D, 0xF0, 0x02, 0x97, 0xE5, 0xF9 },
-  { "BCC $FA65                       ", 0xFA5F, 0xF0, 0x02, 0x97, 0xE5, 0xF9 },
-  { "CMP #$F0                        ", 0xFA61, 0xF0, 0x02, 0x97, 0xE5, 0xF9 },
-  { "BEQ $FA67                       ", 0xFA63, 0xF0, 0x02, 0x97, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA67, 0xF0, 0x02, 0x97, 0x67, 0xF9 },
-  { "LDA $0647 = 36                  ", 0xE96D, 0xF0, 0x02, 0x97, 0x67, 0xFB },
-  { "CMP #$36                        ", 0xE970, 0x36, 0x02, 0x97, 0x65, 0xFB },
-  { "BEQ $E976                       ", 0xE972, 0x36, 0x02, 0x97, 0x67, 0xFB },
-  { "INY                             ", 0xE976, 0x36, 0x02, 0x97, 0x67, 0xFB },
-  { "LDA #$EB                        ", 0xE977, 0x36, 0x02, 0x98, 0xE5, 0xFB },
-  { "STA $47 = 47                    ", 0xE979, 0xEB, 0x02, 0x98, 0xE5, 0xFB },
-  { "JSR $FA31                       ", 0xE97B, 0xEB, 0x02, 0x98, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA31, 0xEB, 0x02, 0x98, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA33, 0xEB, 0x02, 0x98, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFA34, 0xEB, 0x02, 0x98, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA36, 0x40, 0x02, 0x98, 0x64, 0xF9 },
-  { "DCP $47 = EB                    ", 0xE97E, 0x40, 0x02, 0x98, 0x64, 0xFB },
-  { "NOP                             ", 0xE980, 0x40, 0x02, 0x98, 0x64, 0xFB },
-  { "NOP                             ", 0xE981, 0x40, 0x02, 0x98, 0x64, 0xFB },
-  { "NOP                             ", 0xE982, 0x40, 0x02, 0x98, 0x64, 0xFB },
-  { "NOP                             ", 0xE983, 0x40, 0x02, 0x98, 0x64, 0xFB },
-  { "JSR $FA37                       ", 0xE984, 0x40, 0x02, 0x98, 0x64, 0xFB },
-  { "BVC $FA65                       ", 0xFA37, 0x40, 0x02, 0x98, 0x64, 0xF9 },
-  { "BCS $FA65                       ", 0xFA39, 0x40, 0x02, 0x98, 0x64, 0xF9 },
-  { "BMI $FA65                       ", 0xFA3B, 0x40, 0x02, 0x98, 0x64, 0xF9 },
-  { "CMP #$40                        ", 0xFA3D, 0x40, 0x02, 0x98, 0x64, 0xF9 },
-  { "BNE $FA65                       ", 0xFA3F, 0x40, 0x02, 0x98, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA41, 0x40, 0x02, 0x98, 0x67, 0xF9 },
-  { "LDA $47 = EA                    ", 0xE987, 0x40, 0x02, 0x98, 0x67, 0xFB },
-  { "CMP #$EA                        ", 0xE989, 0xEA, 0x02, 0x98, 0xE5, 0xFB },
-  { "BEQ $E98F                       ", 0xE98B, 0xEA, 0x02, 0x98, 0x67, 0xFB },
-  { "INY                             ", 0xE98F, 0xEA, 0x02, 0x98, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xE990, 0xEA, 0x02, 0x99, 0xE5, 0xFB },
-  { "STA $47 = EA                    ", 0xE992, 0x00, 0x02, 0x99, 0x67, 0xFB },
-  { "JSR $FA42                       ", 0xE994, 0x00, 0x02, 0x99, 0x67, 0xFB },
-  { "CLV                             ", 0xFA42, 0x00, 0x02, 0x99, 0x67, 0xF9 },
-  { "SEC                             ", 0xFA43, 0x00, 0x02, 0x99, 0x27, 0xF9 },
-  { "LDA #$FF                        ", 0xFA44, 0x00, 0x02, 0x99, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA46, 0xFF, 0x02, 0x99, 0xA5, 0xF9 },
-  { "DCP $47 = 00                    ", 0xE997, 0xFF, 0x02, 0x99, 0xA5, 0xFB },
-  { "NOP                             ", 0xE999, 0xFF, 0x02, 0x99, 0x27, 0xFB },
-  { "NOP                             ", 0xE99A, 0xFF, 0x02, 0x99, 0x27, 0xFB },
-  { "NOP                             ", 0xE99B, 0xFF, 0x02, 0x99, 0x27, 0xFB },
-  { "NOP                             ", 0xE99C, 0xFF, 0x02, 0x99, 0x27, 0xFB },
-  { "JSR $FA47                       ", 0xE99D, 0xFF, 0x02, 0x99, 0x27, 0xFB },
-  { "BVS $FA65                       ", 0xFA47, 0xFF, 0x02, 0x99, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA49, 0xFF, 0x02, 0x99, 0x27, 0xF9 },
-  { "BMI $FA65                       ", 0xFA4B, 0xFF, 0x02, 0x99, 0x27, 0xF9 },
-  { "BCC $FA65                       ", 0xFA4D, 0xFF, 0x02, 0x99, 0x27, 0xF9 },
-  { "CMP #$FF                        ", 0xFA4F, 0xFF, 0x02, 0x99, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA51, 0xFF, 0x02, 0x99, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA53, 0xFF, 0x02, 0x99, 0x27, 0xF9 },
-  { "LDA $47 = FF                    ", 0xE9A0, 0xFF, 0x02, 0x99, 0x27, 0xFB },
-  { "CMP #$FF                        ", 0xE9A2, 0xFF, 0x02, 0x99, 0xA5, 0xFB },
-  { "BEQ $E9A8                       ", 0xE9A4, 0xFF, 0x02, 0x99, 0x27, 0xFB },
-  { "INY                             ", 0xE9A8, 0xFF, 0x02, 0x99, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xE9A9, 0xFF, 0x02, 0x9A, 0xA5, 0xFB },
-  { "STA $47 = FF                    ", 0xE9AB, 0x37, 0x02, 0x9A, 0x25, 0xFB },
-  { "JSR $FA54                       ", 0xE9AD, 0x37, 0x02, 0x9A, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA54, 0x37, 0x02, 0x9A, 0x25, 0xF9 },
-  { "LDA #$F0                        ", 0xFA56, 0x37, 0x02, 0x9A, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA58, 0xF0, 0x02, 0x9A, 0xE5, 0xF9 },
-  { "DCP $47 = 37                    ", 0xE9B0, 0xF0, 0x02, 0x9A, 0xE5, 0xFB },
-  { "NOP                             ", 0xE9B2, 0xF0, 0x02, 0x9A, 0xE5, 0xFB },
-  { "NOP                             ", 0xE9B3, 0xF0, 0x02, 0x9A, 0xE5, 0xFB },
-  { "NOP                             ", 0xE9B4, 0xF0, 0x02, 0x9A, 0xE5, 0xFB },
-  { "NOP                             ", 0xE9B5, 0xF0, 0x02, 0x9A, 0xE5, 0xFB },
-  { "JSR $FA59                       ", 0xE9B6, 0xF0, 0x02, 0x9A, 0xE5, 0xFB },
-  { "BVC $FA65                       ", 0xFA59, 0xF0, 0x02, 0x9A, 0xE5, 0xF9 },
-  { "BEQ $FA65                       ", 0xFA5B, 0xF0, 0x02, 0x9A, 0xE5, 0xF9 },
-  { "BPL $FA65                       ", 0xFA5D, 0xF0, 0x02, 0x9A, 0xE5, 0xF9 },
-  { "BCC $FA65                       ", 0xFA5F, 0xF0, 0x02, 0x9A, 0xE5, 0xF9 },
-  { "CMP #$F0                        ", 0xFA61, 0xF0, 0x02, 0x9A, 0xE5, 0xF9 },
-  { "BEQ $FA67                       ", 0xFA63, 0xF0, 0x02, 0x9A, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA67, 0xF0, 0x02, 0x9A, 0x67, 0xF9 },
-  { "LDA $47 = 36                    ", 0xE9B9, 0xF0, 0x02, 0x9A, 0x67, 0xFB },
-  { "CMP #$36                        ", 0xE9BB, 0x36, 0x02, 0x9A, 0x65, 0xFB },
-  { "BEQ $E9C1                       ", 0xE9BD, 0x36, 0x02, 0x9A, 0x67, 0xFB },
-  { "INY                             ", 0xE9C1, 0x36, 0x02, 0x9A, 0x67, 0xFB },
-  { "LDA #$EB                        ", 0xE9C2, 0x36, 0x02, 0x9B, 0xE5, 0xFB },
-  { "STA $0647 = 36                  ", 0xE9C4, 0xEB, 0x02, 0x9B, 0xE5, 0xFB },
-  { "JSR $FA31                       ", 0xE9C7, 0xEB, 0x02, 0x9B, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA31, 0xEB, 0x02, 0x9B, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA33, 0xEB, 0x02, 0x9B, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFA34, 0xEB, 0x02, 0x9B, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA36, 0x40, 0x02, 0x9B, 0x64, 0xF9 },
-  { "DCP $0647 = EB                  ", 0xE9CA, 0x40, 0x02, 0x9B, 0x64, 0xFB },
-  { "NOP                             ", 0xE9CD, 0x40, 0x02, 0x9B, 0x64, 0xFB },
-  { "NOP                             ", 0xE9CE, 0x40, 0x02, 0x9B, 0x64, 0xFB },
-  { "NOP                             ", 0xE9CF, 0x40, 0x02, 0x9B, 0x64, 0xFB },
-  { "NOP                             ", 0xE9D0, 0x40, 0x02, 0x9B, 0x64, 0xFB },
-  { "JSR $FA37                       ", 0xE9D1, 0x40, 0x02, 0x9B, 0x64, 0xFB },
-  { "BVC $FA65                       ", 0xFA37, 0x40, 0x02, 0x9B, 0x64, 0xF9 },
-  { "BCS $FA65                       ", 0xFA39, 0x40, 0x02, 0x9B, 0x64, 0xF9 },
-  { "BMI $FA65                       ", 0xFA3B, 0x40, 0x02, 0x9B, 0x64, 0xF9 },
-  { "CMP #$40                        ", 0xFA3D, 0x40, 0x02, 0x9B, 0x64, 0xF9 },
-  { "BNE $FA65                       ", 0xFA3F, 0x40, 0x02, 0x9B, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA41, 0x40, 0x02, 0x9B, 0x67, 0xF9 },
-  { "LDA $0647 = EA                  ", 0xE9D4, 0x40, 0x02, 0x9B, 0x67, 0xFB },
-  { "CMP #$EA                        ", 0xE9D7, 0xEA, 0x02, 0x9B, 0xE5, 0xFB },
-  { "BEQ $E9DD                       ", 0xE9D9, 0xEA, 0x02, 0x9B, 0x67, 0xFB },
-  { "INY                             ", 0xE9DD, 0xEA, 0x02, 0x9B, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xE9DE, 0xEA, 0x02, 0x9C, 0xE5, 0xFB },
-  { "STA $0647 = EA                  ", 0xE9E0, 0x00, 0x02, 0x9C, 0x67, 0xFB },
-  { "JSR $FA42                       ", 0xE9E3, 0x00, 0x02, 0x9C, 0x67, 0xFB },
-  { "CLV                             ", 0xFA42, 0x00, 0x02, 0x9C, 0x67, 0xF9 },
-  { "SEC                             ", 0xFA43, 0x00, 0x02, 0x9C, 0x27, 0xF9 },
-  { "LDA #$FF                        ", 0xFA44, 0x00, 0x02, 0x9C, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA46, 0xFF, 0x02, 0x9C, 0xA5, 0xF9 },
-  { "DCP $0647 = 00                  ", 0xE9E6, 0xFF, 0x02, 0x9C, 0xA5, 0xFB },
-  { "NOP                             ", 0xE9E9, 0xFF, 0x02, 0x9C, 0x27, 0xFB },
-  { "NOP                             ", 0xE9EA, 0xFF, 0x02, 0x9C, 0x27, 0xFB },
-  { "NOP                             ", 0xE9EB, 0xFF, 0x02, 0x9C, 0x27, 0xFB },
-  { "NOP                             ", 0xE9EC, 0xFF, 0x02, 0x9C, 0x27, 0xFB },
-  { "JSR $FA47                       ", 0xE9ED, 0xFF, 0x02, 0x9C, 0x27, 0xFB },
-  { "BVS $FA65                       ", 0xFA47, 0xFF, 0x02, 0x9C, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA49, 0xFF, 0x02, 0x9C, 0x27, 0xF9 },
-  { "BMI $FA65                       ", 0xFA4B, 0xFF, 0x02, 0x9C, 0x27, 0xF9 },
-  { "BCC $FA65                       ", 0xFA4D, 0xFF, 0x02, 0x9C, 0x27, 0xF9 },
-  { "CMP #$FF                        ", 0xFA4F, 0xFF, 0x02, 0x9C, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA51, 0xFF, 0x02, 0x9C, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA53, 0xFF, 0x02, 0x9C, 0x27, 0xF9 },
-  { "LDA $0647 = FF                  ", 0xE9F0, 0xFF, 0x02, 0x9C, 0x27, 0xFB },
-  { "CMP #$FF                        ", 0xE9F3, 0xFF, 0x02, 0x9C, 0xA5, 0xFB },
-  { "BEQ $E9F9                       ", 0xE9F5, 0xFF, 0x02, 0x9C, 0x27, 0xFB },
-  { "INY                             ", 0xE9F9, 0xFF, 0x02, 0x9C, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xE9FA, 0xFF, 0x02, 0x9D, 0xA5, 0xFB },
-  { "STA $0647 = FF                  ", 0xE9FC, 0x37, 0x02, 0x9D, 0x25, 0xFB },
-  { "JSR $FA54                       ", 0xE9FF, 0x37, 0x02, 0x9D, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA54, 0x37, 0x02, 0x9D, 0x25, 0xF9 },
-  { "LDA #$F0                        ", 0xFA56, 0x37, 0x02, 0x9D, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA58, 0xF0, 0x02, 0x9D, 0xE5, 0xF9 },
-  { "DCP $0647 = 37                  ", 0xEA02, 0xF0, 0x02, 0x9D, 0xE5, 0xFB },
-  { "NOP                             ", 0xEA05, 0xF0, 0x02, 0x9D, 0xE5, 0xFB },
-  { "NOP                             ", 0xEA06, 0xF0, 0x02, 0x9D, 0xE5, 0xFB },
-  { "NOP                             ", 0xEA07, 0xF0, 0x02, 0x9D, 0xE5, 0xFB },
-  { "NOP                             ", 0xEA08, 0xF0, 0x02, 0x9D, 0xE5, 0xFB },
-  { "JSR $FA59                       ", 0xEA09, 0xF0, 0x02, 0x9D, 0xE5, 0xFB },
-  { "BVC $FA65                       ", 0xFA59, 0xF0, 0x02, 0x9D, 0xE5, 0xF9 },
-  { "BEQ $FA65                       ", 0xFA5B, 0xF0, 0x02, 0x9D, 0xE5, 0xF9 },
-  { "BPL $FA65                       ", 0xFA5D, 0xF0, 0x02, 0x9D, 0xE5, 0xF9 },
-  { "BCC $FA65                       ", 0xFA5F, 0xF0, 0x02, 0x9D, 0xE5, 0xF9 },
-  { "CMP #$F0                        ", 0xFA61, 0xF0, 0x02, 0x9D, 0xE5, 0xF9 },
-  { "BEQ $FA67                       ", 0xFA63, 0xF0, 0x02, 0x9D, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA67, 0xF0, 0x02, 0x9D, 0x67, 0xF9 },
-  { "LDA $0647 = 36                  ", 0xEA0C, 0xF0, 0x02, 0x9D, 0x67, 0xFB },
-  { "CMP #$36                        ", 0xEA0F, 0x36, 0x02, 0x9D, 0x65, 0xFB },
-  { "BEQ $EA15                       ", 0xEA11, 0x36, 0x02, 0x9D, 0x67, 0xFB },
-  { "LDA #$EB                        ", 0xEA15, 0x36, 0x02, 0x9D, 0x67, 0xFB },
-  { "STA $0647 = 36                  ", 0xEA17, 0xEB, 0x02, 0x9D, 0xE5, 0xFB },
-  { "LDA #$48                        ", 0xEA1A, 0xEB, 0x02, 0x9D, 0xE5, 0xFB },
-  { "STA $45 = 32                    ", 0xEA1C, 0x48, 0x02, 0x9D, 0x65, 0xFB },
-  { "LDA #$05                        ", 0xEA1E, 0x48, 0x02, 0x9D, 0x65, 0xFB },
-  { "STA $46 = 04                    ", 0xEA20, 0x05, 0x02, 0x9D, 0x65, 0xFB },
-  { "LDY #$FF                        ", 0xEA22, 0x05, 0x02, 0x9D, 0x65, 0xFB },
-  { "JSR $FA31                       ", 0xEA24, 0x05, 0x02, 0xFF, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA31, 0x05, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA33, 0x05, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFA34, 0x05, 0x02, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA36, 0x40, 0x02, 0xFF, 0x64, 0xF9 },
-  { "DCP ($45),Y = 0548 @ 0647 = EB  ", 0xEA27, 0x40, 0x02, 0xFF, 0x64, 0xFB },
-  { "NOP                             ", 0xEA29, 0x40, 0x02, 0xFF, 0x64, 0xFB },
-  { "NOP                             ", 0xEA2A, 0x40, 0x02, 0xFF, 0x64, 0xFB },
-  { "PHP                             ", 0xEA2B, 0x40, 0x02, 0xFF, 0x64, 0xFB },
-  { "PHA                             ", 0xEA2C, 0x40, 0x02, 0xFF, 0x64, 0xFA },
-  { "LDY #$9E                        ", 0xEA2D, 0x40, 0x02, 0xFF, 0x64, 0xF9 },
-  { "PLA                             ", 0xEA2F, 0x40, 0x02, 0x9E, 0xE4, 0xF9 },
-  { "PLP                             ", 0xEA30, 0x40, 0x02, 0x9E, 0x64, 0xFA },
-  { "JSR $FA37                       ", 0xEA31, 0x40, 0x02, 0x9E, 0x64, 0xFB },
-  { "BVC $FA65                       ", 0xFA37, 0x40, 0x02, 0x9E, 0x64, 0xF9 },
-  { "BCS $FA65                       ", 0xFA39, 0x40, 0x02, 0x9E, 0x64, 0xF9 },
-  { "BMI $FA65                       ", 0xFA3B, 0x40, 0x02, 0x9E, 0x64, 0xF9 },
-  { "CMP #$40                        ", 0xFA3D, 0x40, 0x02, 0x9E, 0x64, 0xF9 },
-  { "BNE $FA65                       ", 0xFA3F, 0x40, 0x02, 0x9E, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA41, 0x40, 0x02, 0x9E, 0x67, 0xF9 },
-  { "LDA $0647 = EA                  ", 0xEA34, 0x40, 0x02, 0x9E, 0x67, 0xFB },
-  { "CMP #$EA                        ", 0xEA37, 0xEA, 0x02, 0x9E, 0xE5, 0xFB },
-  { "BEQ $EA3D                       ", 0xEA39, 0xEA, 0x02, 0x9E, 0x67, 0xFB },
-  { "LDY #$FF                        ", 0xEA3D, 0xEA, 0x02, 0x9E, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xEA3F, 0xEA, 0x02, 0xFF, 0xE5, 0xFB },
-  { "STA $0647 = EA                  ", 0xEA41, 0x00, 0x02, 0xFF, 0x67, 0xFB },
-  { "JSR $FA42                       ", 0xEA44, 0x00, 0x02, 0xFF, 0x67, 0xFB },
-  { "CLV                             ", 0xFA42, 0x00, 0x02, 0xFF, 0x67, 0xF9 },
-  { "SEC                             ", 0xFA43, 0x00, 0x02, 0xFF, 0x27, 0xF9 },
-  { "LDA #$FF                        ", 0xFA44, 0x00, 0x02, 0xFF, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA46, 0xFF, 0x02, 0xFF, 0xA5, 0xF9 },
-  { "DCP ($45),Y = 0548 @ 0647 = 00  ", 0xEA47, 0xFF, 0x02, 0xFF, 0xA5, 0xFB },
-  { "NOP                             ", 0xEA49, 0xFF, 0x02, 0xFF, 0x27, 0xFB },
-  { "NOP                             ", 0xEA4A, 0xFF, 0x02, 0xFF, 0x27, 0xFB },
-  { "PHP                             ", 0xEA4B, 0xFF, 0x02, 0xFF, 0x27, 0xFB },
-  { "PHA                             ", 0xEA4C, 0xFF, 0x02, 0xFF, 0x27, 0xFA },
-  { "LDY #$9F                        ", 0xEA4D, 0xFF, 0x02, 0xFF, 0x27, 0xF9 },
-  { "PLA                             ", 0xEA4F, 0xFF, 0x02, 0x9F, 0xA5, 0xF9 },
-  { "PLP                             ", 0xEA50, 0xFF, 0x02, 0x9F, 0xA5, 0xFA },
-  { "JSR $FA47                       ", 0xEA51, 0xFF, 0x02, 0x9F, 0x27, 0xFB },
-  { "BVS $FA65                       ", 0xFA47, 0xFF, 0x02, 0x9F, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA49, 0xFF, 0x02, 0x9F, 0x27, 0xF9 },
-  { "BMI $FA65                       ", 0xFA4B, 0xFF, 0x02, 0x9F, 0x27, 0xF9 },
-  { "BCC $FA65                       ", 0xFA4D, 0xFF, 0x02, 0x9F, 0x27, 0xF9 },
-  { "CMP #$FF                        ", 0xFA4F, 0xFF, 0x02, 0x9F, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA51, 0xFF, 0x02, 0x9F, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA53, 0xFF, 0x02, 0x9F, 0x27, 0xF9 },
-  { "LDA $0647 = FF                  ", 0xEA54, 0xFF, 0x02, 0x9F, 0x27, 0xFB },
-  { "CMP #$FF                        ", 0xEA57, 0xFF, 0x02, 0x9F, 0xA5, 0xFB },
-  { "BEQ $EA5D                       ", 0xEA59, 0xFF, 0x02, 0x9F, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xEA5D, 0xFF, 0x02, 0x9F, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEA5F, 0xFF, 0x02, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = FF                  ", 0xEA61, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "JSR $FA54                       ", 0xEA64, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA54, 0x37, 0x02, 0xFF, 0x25, 0xF9 },
-  { "LDA #$F0                        ", 0xFA56, 0x37, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA58, 0xF0, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "DCP ($45),Y = 0548 @ 0647 = 37  ", 0xEA67, 0xF0, 0x02, 0xFF, 0xE5, 0xFB },
-  { "NOP                             ", 0xEA69, 0xF0, 0x02, 0xFF, 0xE5, 0xFB },
-  { "NOP                             ", 0xEA6A, 0xF0, 0x02, 0xFF, 0xE5, 0xFB },
-  { "PHP                             ", 0xEA6B, 0xF0, 0x02, 0xFF, 0xE5, 0xFB },
-  { "PHA                             ", 0xEA6C, 0xF0, 0x02, 0xFF, 0xE5, 0xFA },
-  { "LDY #$A0                        ", 0xEA6D, 0xF0, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "PLA                             ", 0xEA6F, 0xF0, 0x02, 0xA0, 0xE5, 0xF9 },
-  { "PLP                             ", 0xEA70, 0xF0, 0x02, 0xA0, 0xE5, 0xFA },
-  { "JSR $FA59                       ", 0xEA71, 0xF0, 0x02, 0xA0, 0xE5, 0xFB },
-  { "BVC $FA65                       ", 0xFA59, 0xF0, 0x02, 0xA0, 0xE5, 0xF9 },
-  { "BEQ $FA65                       ", 0xFA5B, 0xF0, 0x02, 0xA0, 0xE5, 0xF9 },
-  { "BPL $FA65                       ", 0xFA5D, 0xF0, 0x02, 0xA0, 0xE5, 0xF9 },
-  { "BCC $FA65                       ", 0xFA5F, 0xF0, 0x02, 0xA0, 0xE5, 0xF9 },
-  { "CMP #$F0                        ", 0xFA61, 0xF0, 0x02, 0xA0, 0xE5, 0xF9 },
-  { "BEQ $FA67                       ", 0xFA63, 0xF0, 0x02, 0xA0, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA67, 0xF0, 0x02, 0xA0, 0x67, 0xF9 },
-  { "LDA $0647 = 36                  ", 0xEA74, 0xF0, 0x02, 0xA0, 0x67, 0xFB },
-  { "CMP #$36                        ", 0xEA77, 0x36, 0x02, 0xA0, 0x65, 0xFB },
-  { "BEQ $EA7D                       ", 0xEA79, 0x36, 0x02, 0xA0, 0x67, 0xFB },
-  { "LDY #$A1                        ", 0xEA7D, 0x36, 0x02, 0xA0, 0x67, 0xFB },
-  { "LDX #$FF                        ", 0xEA7F, 0x36, 0x02, 0xA1, 0xE5, 0xFB },
-  { "LDA #$EB                        ", 0xEA81, 0x36, 0xFF, 0xA1, 0xE5, 0xFB },
-  { "STA $47 = 36                    ", 0xEA83, 0xEB, 0xFF, 0xA1, 0xE5, 0xFB },
-  { "JSR $FA31                       ", 0xEA85, 0xEB, 0xFF, 0xA1, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA31, 0xEB, 0xFF, 0xA1, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA33, 0xEB, 0xFF, 0xA1, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFA34, 0xEB, 0xFF, 0xA1, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA36, 0x40, 0xFF, 0xA1, 0x64, 0xF9 },
-  { "DCP $48,X @ 47 = EB             ", 0xEA88, 0x40, 0xFF, 0xA1, 0x64, 0xFB },
-  { "NOP                             ", 0xEA8A, 0x40, 0xFF, 0xA1, 0x64, 0xFB },
-  { "NOP                             ", 0xEA8B, 0x40, 0xFF, 0xA1, 0x64, 0xFB },
-  { "NOP                             ", 0xEA8C, 0x40, 0xFF, 0xA1, 0x64, 0xFB },
-  { "NOP                             ", 0xEA8D, 0x40, 0xFF, 0xA1, 0x64, 0xFB },
-  { "JSR $FA37                       ", 0xEA8E, 0x40, 0xFF, 0xA1, 0x64, 0xFB },
-  { "BVC $FA65                       ", 0xFA37, 0x40, 0xFF, 0xA1, 0x64, 0xF9 },
-  { "BCS $FA65                       ", 0xFA39, 0x40, 0xFF, 0xA1, 0x64, 0xF9 },
-  { "BMI $FA65                       ", 0xFA3B, 0x40, 0xFF, 0xA1, 0x64, 0xF9 },
-  { "CMP #$40                        ", 0xFA3D, 0x40, 0xFF, 0xA1, 0x64, 0xF9 },
-  { "BNE $FA65                       ", 0xFA3F, 0x40, 0xFF, 0xA1, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA41, 0x40, 0xFF, 0xA1, 0x67, 0xF9 },
-  { "LDA $47 = EA                    ", 0xEA91, 0x40, 0xFF, 0xA1, 0x67, 0xFB },
-  { "CMP #$EA                        ", 0xEA93, 0xEA, 0xFF, 0xA1, 0xE5, 0xFB },
-  { "BEQ $EA99                       ", 0xEA95, 0xEA, 0xFF, 0xA1, 0x67, 0xFB },
-  { "INY                             ", 0xEA99, 0xEA, 0xFF, 0xA1, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xEA9A, 0xEA, 0xFF, 0xA2, 0xE5, 0xFB },
-  { "STA $47 = EA                    ", 0xEA9C, 0x00, 0xFF, 0xA2, 0x67, 0xFB },
-  { "JSR $FA42                       ", 0xEA9E, 0x00, 0xFF, 0xA2, 0x67, 0xFB },
-  { "CLV                             ", 0xFA42, 0x00, 0xFF, 0xA2, 0x67, 0xF9 },
-  { "SEC                             ", 0xFA43, 0x00, 0xFF, 0xA2, 0x27, 0xF9 },
-  { "LDA #$FF                        ", 0xFA44, 0x00, 0xFF, 0xA2, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA46, 0xFF, 0xFF, 0xA2, 0xA5, 0xF9 },
-  { "DCP $48,X @ 47 = 00             ", 0xEAA1, 0xFF, 0xFF, 0xA2, 0xA5, 0xFB },
-  { "NOP                             ", 0xEAA3, 0xFF, 0xFF, 0xA2, 0x27, 0xFB },
-  { "NOP                             ", 0xEAA4, 0xFF, 0xFF, 0xA2, 0x27, 0xFB },
-  { "NOP                             ", 0xEAA5, 0xFF, 0xFF, 0xA2, 0x27, 0xFB },
-  { "NOP                             ", 0xEAA6, 0xFF, 0xFF, 0xA2, 0x27, 0xFB },
-  { "JSR $FA47                       ", 0xEAA7, 0xFF, 0xFF, 0xA2, 0x27, 0xFB },
-  { "BVS $FA65                       ", 0xFA47, 0xFF, 0xFF, 0xA2, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA49, 0xFF, 0xFF, 0xA2, 0x27, 0xF9 },
-  { "BMI $FA65                       ", 0xFA4B, 0xFF, 0xFF, 0xA2, 0x27, 0xF9 },
-  { "BCC $FA65                       ", 0xFA4D, 0xFF, 0xFF, 0xA2, 0x27, 0xF9 },
-  { "CMP #$FF                        ", 0xFA4F, 0xFF, 0xFF, 0xA2, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA51, 0xFF, 0xFF, 0xA2, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA53, 0xFF, 0xFF, 0xA2, 0x27, 0xF9 },
-  { "LDA $47 = FF                    ", 0xEAAA, 0xFF, 0xFF, 0xA2, 0x27, 0xFB },
-  { "CMP #$FF                        ", 0xEAAC, 0xFF, 0xFF, 0xA2, 0xA5, 0xFB },
-  { "BEQ $EAB2                       ", 0xEAAE, 0xFF, 0xFF, 0xA2, 0x27, 0xFB },
-  { "INY                             ", 0xEAB2, 0xFF, 0xFF, 0xA2, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEAB3, 0xFF, 0xFF, 0xA3, 0xA5, 0xFB },
-  { "STA $47 = FF                    ", 0xEAB5, 0x37, 0xFF, 0xA3, 0x25, 0xFB },
-  { "JSR $FA54                       ", 0xEAB7, 0x37, 0xFF, 0xA3, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA54, 0x37, 0xFF, 0xA3, 0x25, 0xF9 },
-  { "LDA #$F0                        ", 0xFA56, 0x37, 0xFF, 0xA3, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA58, 0xF0, 0xFF, 0xA3, 0xE5, 0xF9 },
-  { "DCP $48,X @ 47 = 37             ", 0xEABA, 0xF0, 0xFF, 0xA3, 0xE5, 0xFB },
-  { "NOP                             ", 0xEABC, 0xF0, 0xFF, 0xA3, 0xE5, 0xFB },
-  { "NOP                             ", 0xEABD, 0xF0, 0xFF, 0xA3, 0xE5, 0xFB },
-  { "NOP                             ", 0xEABE, 0xF0, 0xFF, 0xA3, 0xE5, 0xFB },
-  { "NOP                             ", 0xEABF, 0xF0, 0xFF, 0xA3, 0xE5, 0xFB },
-  { "JSR $FA59                       ", 0xEAC0, 0xF0, 0xFF, 0xA3, 0xE5, 0xFB },
-  { "BVC $FA65                       ", 0xFA59, 0xF0, 0xFF, 0xA3, 0xE5, 0xF9 },
-  { "BEQ $FA65                       ", 0xFA5B, 0xF0, 0xFF, 0xA3, 0xE5, 0xF9 },
-  { "BPL $FA65                       ", 0xFA5D, 0xF0, 0xFF, 0xA3, 0xE5, 0xF9 },
-  { "BCC $FA65                       ", 0xFA5F, 0xF0, 0xFF, 0xA3, 0xE5, 0xF9 },
-  { "CMP #$F0                        ", 0xFA61, 0xF0, 0xFF, 0xA3, 0xE5, 0xF9 },
-  { "BEQ $FA67                       ", 0xFA63, 0xF0, 0xFF, 0xA3, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA67, 0xF0, 0xFF, 0xA3, 0x67, 0xF9 },
-  { "LDA $47 = 36                    ", 0xEAC3, 0xF0, 0xFF, 0xA3, 0x67, 0xFB },
-  { "CMP #$36                        ", 0xEAC5, 0x36, 0xFF, 0xA3, 0x65, 0xFB },
-  { "BEQ $EACB                       ", 0xEAC7, 0x36, 0xFF, 0xA3, 0x67, 0xFB },
-  { "LDA #$EB                        ", 0xEACB, 0x36, 0xFF, 0xA3, 0x67, 0xFB },
-  { "STA $0647 = 36                  ", 0xEACD, 0xEB, 0xFF, 0xA3, 0xE5, 0xFB },
-  { "LDY #$FF                        ", 0xEAD0, 0xEB, 0xFF, 0xA3, 0xE5, 0xFB },
-  { "JSR $FA31                       ", 0xEAD2, 0xEB, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA31, 0xEB, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA33, 0xEB, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFA34, 0xEB, 0xFF, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA36, 0x40, 0xFF, 0xFF, 0x64, 0xF9 },
-  { "DCP $0548,Y @ 0647 = EB         ", 0xEAD5, 0x40, 0xFF, 0xFF, 0x64, 0xFB },
-  { "NOP                             ", 0xEAD8, 0x40, 0xFF, 0xFF, 0x64, 0xFB },
-  { "NOP                             ", 0xEAD9, 0x40, 0xFF, 0xFF, 0x64, 0xFB },
-  { "PHP                             ", 0xEADA, 0x40, 0xFF, 0xFF, 0x64, 0xFB },
-  { "PHA                             ", 0xEADB, 0x40, 0xFF, 0xFF, 0x64, 0xFA },
-  { "LDY #$A4                        ", 0xEADC, 0x40, 0xFF, 0xFF, 0x64, 0xF9 },
-  { "PLA                             ", 0xEADE, 0x40, 0xFF, 0xA4, 0xE4, 0xF9 },
-  { "PLP                             ", 0xEADF, 0x40, 0xFF, 0xA4, 0x64, 0xFA },
-  { "JSR $FA37                       ", 0xEAE0, 0x40, 0xFF, 0xA4, 0x64, 0xFB },
-  { "BVC $FA65                       ", 0xFA37, 0x40, 0xFF, 0xA4, 0x64, 0xF9 },
-  { "BCS $FA65                       ", 0xFA39, 0x40, 0xFF, 0xA4, 0x64, 0xF9 },
-  { "BMI $FA65                       ", 0xFA3B, 0x40, 0xFF, 0xA4, 0x64, 0xF9 },
-  { "CMP #$40                        ", 0xFA3D, 0x40, 0xFF, 0xA4, 0x64, 0xF9 },
-  { "BNE $FA65                       ", 0xFA3F, 0x40, 0xFF, 0xA4, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA41, 0x40, 0xFF, 0xA4, 0x67, 0xF9 },
-  { "LDA $0647 = EA                  ", 0xEAE3, 0x40, 0xFF, 0xA4, 0x67, 0xFB },
-  { "CMP #$EA                        ", 0xEAE6, 0xEA, 0xFF, 0xA4, 0xE5, 0xFB },
-  { "BEQ $EAEC                       ", 0xEAE8, 0xEA, 0xFF, 0xA4, 0x67, 0xFB },
-  { "LDY #$FF                        ", 0xEAEC, 0xEA, 0xFF, 0xA4, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xEAEE, 0xEA, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "STA $0647 = EA                  ", 0xEAF0, 0x00, 0xFF, 0xFF, 0x67, 0xFB },
-  { "JSR $FA42                       ", 0xEAF3, 0x00, 0xFF, 0xFF, 0x67, 0xFB },
-  { "CLV                             ", 0xFA42, 0x00, 0xFF, 0xFF, 0x67, 0xF9 },
-  { "SEC                             ", 0xFA43, 0x00, 0xFF, 0xFF, 0x27, 0xF9 },
-  { "LDA #$FF                        ", 0xFA44, 0x00, 0xFF, 0xFF, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA46, 0xFF, 0xFF, 0xFF, 0xA5, 0xF9 },
-  { "DCP $0548,Y @ 0647 = 00         ", 0xEAF6, 0xFF, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "NOP                             ", 0xEAF9, 0xFF, 0xFF, 0xFF, 0x27, 0xFB },
-  { "NOP                             ", 0xEAFA, 0xFF, 0xFF, 0xFF, 0x27, 0xFB },
-  { "PHP                             ", 0xEAFB, 0xFF, 0xFF, 0xFF, 0x27, 0xFB },
-  { "PHA                             ", 0xEAFC, 0xFF, 0xFF, 0xFF, 0x27, 0xFA },
-  { "LDY #$A5                        ", 0xEAFD, 0xFF, 0xFF, 0xFF, 0x27, 0xF9 },
-  { "PLA                             ", 0xEAFF, 0xFF, 0xFF, 0xA5, 0xA5, 0xF9 },
-  { "PLP                             ", 0xEB00, 0xFF, 0xFF, 0xA5, 0xA5, 0xFA },
-  { "JSR $FA47                       ", 0xEB01, 0xFF, 0xFF, 0xA5, 0x27, 0xFB },
-  { "BVS $FA65                       ", 0xFA47, 0xFF, 0xFF, 0xA5, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA49, 0xFF, 0xFF, 0xA5, 0x27, 0xF9 },
-  { "BMI $FA65                       ", 0xFA4B, 0xFF, 0xFF, 0xA5, 0x27, 0xF9 },
-  { "BCC $FA65                       ", 0xFA4D, 0xFF, 0xFF, 0xA5, 0x27, 0xF9 },
-  { "CMP #$FF                        ", 0xFA4F, 0xFF, 0xFF, 0xA5, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA51, 0xFF, 0xFF, 0xA5, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA53, 0xFF, 0xFF, 0xA5, 0x27, 0xF9 },
-  { "LDA $0647 = FF                  ", 0xEB04, 0xFF, 0xFF, 0xA5, 0x27, 0xFB },
-  { "CMP #$FF                        ", 0xEB07, 0xFF, 0xFF, 0xA5, 0xA5, 0xFB },
-  { "BEQ $EB0D                       ", 0xEB09, 0xFF, 0xFF, 0xA5, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xEB0D, 0xFF, 0xFF, 0xA5, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEB0F, 0xFF, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = FF                  ", 0xEB11, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "JSR $FA54                       ", 0xEB14, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA54, 0x37, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "LDA #$F0                        ", 0xFA56, 0x37, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA58, 0xF0, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "DCP $0548,Y @ 0647 = 37         ", 0xEB17, 0xF0, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "NOP                             ", 0xEB1A, 0xF0, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "NOP                             ", 0xEB1B, 0xF0, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "PHP                             ", 0xEB1C, 0xF0, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "PHA                             ", 0xEB1D, 0xF0, 0xFF, 0xFF, 0xE5, 0xFA },
-  { "LDY #$A6                        ", 0xEB1E, 0xF0, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "PLA                             ", 0xEB20, 0xF0, 0xFF, 0xA6, 0xE5, 0xF9 },
-  { "PLP                             ", 0xEB21, 0xF0, 0xFF, 0xA6, 0xE5, 0xFA },
-  { "JSR $FA59                       ", 0xEB22, 0xF0, 0xFF, 0xA6, 0xE5, 0xFB },
-  { "BVC $FA65                       ", 0xFA59, 0xF0, 0xFF, 0xA6, 0xE5, 0xF9 },
-  { "BEQ $FA65                       ", 0xFA5B, 0xF0, 0xFF, 0xA6, 0xE5, 0xF9 },
-  { "BPL $FA65                       ", 0xFA5D, 0xF0, 0xFF, 0xA6, 0xE5, 0xF9 },
-  { "BCC $FA65                       ", 0xFA5F, 0xF0, 0xFF, 0xA6, 0xE5, 0xF9 },
-  { "CMP #$F0                        ", 0xFA61, 0xF0, 0xFF, 0xA6, 0xE5, 0xF9 },
-  { "BEQ $FA67                       ", 0xFA63, 0xF0, 0xFF, 0xA6, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA67, 0xF0, 0xFF, 0xA6, 0x67, 0xF9 },
-  { "LDA $0647 = 36                  ", 0xEB25, 0xF0, 0xFF, 0xA6, 0x67, 0xFB },
-  { "CMP #$36                        ", 0xEB28, 0x36, 0xFF, 0xA6, 0x65, 0xFB },
-  { "BEQ $EB2E                       ", 0xEB2A, 0x36, 0xFF, 0xA6, 0x67, 0xFB },
-  { "LDY #$A7                        ", 0xEB2E, 0x36, 0xFF, 0xA6, 0x67, 0xFB },
-  { "LDX #$FF                        ", 0xEB30, 0x36, 0xFF, 0xA7, 0xE5, 0xFB },
-  { "LDA #$EB                        ", 0xEB32, 0x36, 0xFF, 0xA7, 0xE5, 0xFB },
-  { "STA $0647 = 36                  ", 0xEB34, 0xEB, 0xFF, 0xA7, 0xE5, 0xFB },
-  { "JSR $FA31                       ", 0xEB37, 0xEB, 0xFF, 0xA7, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA31, 0xEB, 0xFF, 0xA7, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA33, 0xEB, 0xFF, 0xA7, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFA34, 0xEB, 0xFF, 0xA7, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA36, 0x40, 0xFF, 0xA7, 0x64, 0xF9 },
-  { "DCP $0548,X @ 0647 = EB         ", 0xEB3A, 0x40, 0xFF, 0xA7, 0x64, 0xFB },
-  { "NOP                             ", 0xEB3D, 0x40, 0xFF, 0xA7, 0x64, 0xFB },
-  { "NOP                             ", 0xEB3E, 0x40, 0xFF, 0xA7, 0x64, 0xFB },
-  { "NOP                             ", 0xEB3F, 0x40, 0xFF, 0xA7, 0x64, 0xFB },
-  { "NOP                             ", 0xEB40, 0x40, 0xFF, 0xA7, 0x64, 0xFB },
-  { "JSR $FA37                       ", 0xEB41, 0x40, 0xFF, 0xA7, 0x64, 0xFB },
-  { "BVC $FA65                       ", 0xFA37, 0x40, 0xFF, 0xA7, 0x64, 0xF9 },
-  { "BCS $FA65                       ", 0xFA39, 0x40, 0xFF, 0xA7, 0x64, 0xF9 },
-  { "BMI $FA65                       ", 0xFA3B, 0x40, 0xFF, 0xA7, 0x64, 0xF9 },
-  { "CMP #$40                        ", 0xFA3D, 0x40, 0xFF, 0xA7, 0x64, 0xF9 },
-  { "BNE $FA65                       ", 0xFA3F, 0x40, 0xFF, 0xA7, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA41, 0x40, 0xFF, 0xA7, 0x67, 0xF9 },
-  { "LDA $0647 = EA                  ", 0xEB44, 0x40, 0xFF, 0xA7, 0x67, 0xFB },
-  { "CMP #$EA                        ", 0xEB47, 0xEA, 0xFF, 0xA7, 0xE5, 0xFB },
-  { "BEQ $EB4D                       ", 0xEB49, 0xEA, 0xFF, 0xA7, 0x67, 0xFB },
-  { "INY                             ", 0xEB4D, 0xEA, 0xFF, 0xA7, 0x67, 0xFB },
-  { "LDA #$00                        ", 0xEB4E, 0xEA, 0xFF, 0xA8, 0xE5, 0xFB },
-  { "STA $0647 = EA                  ", 0xEB50, 0x00, 0xFF, 0xA8, 0x67, 0xFB },
-  { "JSR $FA42                       ", 0xEB53, 0x00, 0xFF, 0xA8, 0x67, 0xFB },
-  { "CLV                             ", 0xFA42, 0x00, 0xFF, 0xA8, 0x67, 0xF9 },
-  { "SEC                             ", 0xFA43, 0x00, 0xFF, 0xA8, 0x27, 0xF9 },
-  { "LDA #$FF                        ", 0xFA44, 0x00, 0xFF, 0xA8, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA46, 0xFF, 0xFF, 0xA8, 0xA5, 0xF9 },
-  { "DCP $0548,X @ 0647 = 00         ", 0xEB56, 0xFF, 0xFF, 0xA8, 0xA5, 0xFB },
-  { "NOP                             ", 0xEB59, 0xFF, 0xFF, 0xA8, 0x27, 0xFB },
-  { "NOP                             ", 0xEB5A, 0xFF, 0xFF, 0xA8, 0x27, 0xFB },
-  { "NOP                             ", 0xEB5B, 0xFF, 0xFF, 0xA8, 0x27, 0xFB },
-  { "NOP                             ", 0xEB5C, 0xFF, 0xFF, 0xA8, 0x27, 0xFB },
-  { "JSR $FA47                       ", 0xEB5D, 0xFF, 0xFF, 0xA8, 0x27, 0xFB },
-  { "BVS $FA65                       ", 0xFA47, 0xFF, 0xFF, 0xA8, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA49, 0xFF, 0xFF, 0xA8, 0x27, 0xF9 },
-  { "BMI $FA65                       ", 0xFA4B, 0xFF, 0xFF, 0xA8, 0x27, 0xF9 },
-  { "BCC $FA65                       ", 0xFA4D, 0xFF, 0xFF, 0xA8, 0x27, 0xF9 },
-  { "CMP #$FF                        ", 0xFA4F, 0xFF, 0xFF, 0xA8, 0x27, 0xF9 },
-  { "BNE $FA65                       ", 0xFA51, 0xFF, 0xFF, 0xA8, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA53, 0xFF, 0xFF, 0xA8, 0x27, 0xF9 },
-  { "LDA $0647 = FF                  ", 0xEB60, 0xFF, 0xFF, 0xA8, 0x27, 0xFB },
-  { "CMP #$FF                        ", 0xEB63, 0xFF, 0xFF, 0xA8, 0xA5, 0xFB },
-  { "BEQ $EB69                       ", 0xEB65, 0xFF, 0xFF, 0xA8, 0x27, 0xFB },
-  { "INY                             ", 0xEB69, 0xFF, 0xFF, 0xA8, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEB6A, 0xFF, 0xFF, 0xA9, 0xA5, 0xFB },
-  { "STA $0647 = FF                  ", 0xEB6C, 0x37, 0xFF, 0xA9, 0x25, 0xFB },
-  { "JSR $FA54                       ", 0xEB6F, 0x37, 0xFF, 0xA9, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA54, 0x37, 0xFF, 0xA9, 0x25, 0xF9 },
-  { "LDA #$F0                        ", 0xFA56, 0x37, 0xFF, 0xA9, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA58, 0xF0, 0xFF, 0xA9, 0xE5, 0xF9 },
-  { "DCP $0548,X @ 0647 = 37         ", 0xEB72, 0xF0, 0xFF, 0xA9, 0xE5, 0xFB },
-  { "NOP                             ", 0xEB75, 0xF0, 0xFF, 0xA9, 0xE5, 0xFB },
-  { "NOP                             ", 0xEB76, 0xF0, 0xFF, 0xA9, 0xE5, 0xFB },
-  { "NOP                             ", 0xEB77, 0xF0, 0xFF, 0xA9, 0xE5, 0xFB },
-  { "NOP                             ", 0xEB78, 0xF0, 0xFF, 0xA9, 0xE5, 0xFB },
-  { "JSR $FA59                       ", 0xEB79, 0xF0, 0xFF, 0xA9, 0xE5, 0xFB },
-  { "BVC $FA65                       ", 0xFA59, 0xF0, 0xFF, 0xA9, 0xE5, 0xF9 },
-  { "BEQ $FA65                       ", 0xFA5B, 0xF0, 0xFF, 0xA9, 0xE5, 0xF9 },
-  { "BPL $FA65                       ", 0xFA5D, 0xF0, 0xFF, 0xA9, 0xE5, 0xF9 },
-  { "BCC $FA65                       ", 0xFA5F, 0xF0, 0xFF, 0xA9, 0xE5, 0xF9 },
-  { "CMP #$F0                        ", 0xFA61, 0xF0, 0xFF, 0xA9, 0xE5, 0xF9 },
-  { "BEQ $FA67                       ", 0xFA63, 0xF0, 0xFF, 0xA9, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA67, 0xF0, 0xFF, 0xA9, 0x67, 0xF9 },
-  { "LDA $0647 = 36                  ", 0xEB7C, 0xF0, 0xFF, 0xA9, 0x67, 0xFB },
-  { "CMP #$36                        ", 0xEB7F, 0x36, 0xFF, 0xA9, 0x65, 0xFB },
-  { "BEQ $EB85                       ", 0xEB81, 0x36, 0xFF, 0xA9, 0x67, 0xFB },
-  { "RTS                             ", 0xEB85, 0x36, 0xFF, 0xA9, 0x67, 0xFB },
-  { "JSR $EB86                       ", 0xC63E, 0x36, 0xFF, 0xA9, 0x67, 0xFD },
-  { "LDA #$FF                        ", 0xEB86, 0x36, 0xFF, 0xA9, 0x67, 0xFB },
-  { "STA $01 = FF                    ", 0xEB88, 0xFF, 0xFF, 0xA9, 0xE5, 0xFB },
-  { "LDY #$AA                        ", 0xEB8A, 0xFF, 0xFF, 0xA9, 0xE5, 0xFB },
-  { "LDX #$02                        ", 0xEB8C, 0xFF, 0xFF, 0xAA, 0xE5, 0xFB },
-  { "LDA #$47                        ", 0xEB8E, 0xFF, 0x02, 0xAA, 0x65, 0xFB },
-  { "STA $47 = 36                    ", 0xEB90, 0x47, 0x02, 0xAA, 0x65, 0xFB },
-  { "LDA #$06                        ", 0xEB92, 0x47, 0x02, 0xAA, 0x65, 0xFB },
-  { "STA $48 = 06                    ", 0xEB94, 0x06, 0x02, 0xAA, 0x65, 0xFB },
-  { "LDA #$EB                        ", 0xEB96, 0x06, 0x02, 0xAA, 0x65, 0xFB },
-  { "STA $0647 = 36                  ", 0xEB98, 0xEB, 0x02, 0xAA, 0xE5, 0xFB },
-  { "JSR $FAB1                       ", 0xEB9B, 0xEB, 0x02, 0xAA, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAB1, 0xEB, 0x02, 0xAA, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFAB3, 0xEB, 0x02, 0xAA, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFAB4, 0xEB, 0x02, 0xAA, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAB6, 0x40, 0x02, 0xAA, 0x64, 0xF9 },
-  { "ISB ($45,X) @ 47 = 0647 = EB    ", 0xEB9E, 0x40, 0x02, 0xAA, 0x64, 0xFB },
-  { "NOP                             ", 0xEBA0, 0x53, 0x02, 0xAA, 0x24, 0xFB },
-  { "NOP                             ", 0xEBA1, 0x53, 0x02, 0xAA, 0x24, 0xFB },
-  { "NOP                             ", 0xEBA2, 0x53, 0x02, 0xAA, 0x24, 0xFB },
-  { "NOP                             ", 0xEBA3, 0x53, 0x02, 0xAA, 0x24, 0xFB },
-  { "JSR $FAB7                       ", 0xEBA4, 0x53, 0x02, 0xAA, 0x24, 0xFB },
-  { "BVS $FAE6                       ", 0xFAB7, 0x53, 0x02, 0xAA, 0x24, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAB9, 0x53, 0x02, 0xAA, 0x24, 0xF9 },
-  { "BMI $FAE6                       ", 0xFABB, 0x53, 0x02, 0xAA, 0x24, 0xF9 },
-  { "CMP #$53                        ", 0xFABD, 0x53, 0x02, 0xAA, 0x24, 0xF9 },
-  { "BNE $FAE6                       ", 0xFABF, 0x53, 0x02, 0xAA, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAC1, 0x53, 0x02, 0xAA, 0x27, 0xF9 },
-  { "LDA $0647 = EC                  ", 0xEBA7, 0x53, 0x02, 0xAA, 0x27, 0xFB },
-  { "CMP #$EC                        ", 0xEBAA, 0xEC, 0x02, 0xAA, 0xA5, 0xFB },
-  { "BEQ $EBB0                       ", 0xEBAC, 0xEC, 0x02, 0xAA, 0x27, 0xFB },
-  { "INY                             ", 0xEBB0, 0xEC, 0x02, 0xAA, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xEBB1, 0xEC, 0x02, 0xAB, 0xA5, 0xFB },
-  { "STA $0647 = EC                  ", 0xEBB3, 0xFF, 0x02, 0xAB, 0xA5, 0xFB },
-  { "JSR $FAC2                       ", 0xEBB6, 0xFF, 0x02, 0xAB, 0xA5, 0xFB },
-  { "CLV                             ", 0xFAC2, 0xFF, 0x02, 0xAB, 0xA5, 0xF9 },
-  { "SEC                             ", 0xFAC3, 0xFF, 0x02, 0xAB, 0xA5, 0xF9 },
-  { "LDA #$FF                        ", 0xFAC4, 0xFF, 0x02, 0xAB, 0xA5, 0xF9 },
-  { "RTS                             ", 0xFAC6, 0xFF, 0x02, 0xAB, 0xA5, 0xF9 },
-  { "ISB ($45,X) @ 47 = 0647 = FF    ", 0xEBB9, 0xFF, 0x02, 0xAB, 0xA5, 0xFB },
-  { "NOP                             ", 0xEBBB, 0xFF, 0x02, 0xAB, 0xA5, 0xFB },
-  { "NOP                             ", 0xEBBC, 0xFF, 0x02, 0xAB, 0xA5, 0xFB },
-  { "NOP                             ", 0xEBBD, 0xFF, 0x02, 0xAB, 0xA5, 0xFB },
-  { "NOP                             ", 0xEBBE, 0xFF, 0x02, 0xAB, 0xA5, 0xFB },
-  { "JSR $FAC7                       ", 0xEBBF, 0xFF, 0x02, 0xAB, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFAC7, 0xFF, 0x02, 0xAB, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAC9, 0xFF, 0x02, 0xAB, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFACB, 0xFF, 0x02, 0xAB, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFACD, 0xFF, 0x02, 0xAB, 0xA5, 0xF9 },
-  { "CMP #$FF                        ", 0xFACF, 0xFF, 0x02, 0xAB, 0xA5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAD1, 0xFF, 0x02, 0xAB, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAD3, 0xFF, 0x02, 0xAB, 0x27, 0xF9 },
-  { "LDA $0647 = 00                  ", 0xEBC2, 0xFF, 0x02, 0xAB, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xEBC5, 0x00, 0x02, 0xAB, 0x27, 0xFB },
-  { "BEQ $EBCB                       ", 0xEBC7, 0x00, 0x02, 0xAB, 0x27, 0xFB },
-  { "INY                             ", 0xEBCB, 0x00, 0x02, 0xAB, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEBCC, 0x00, 0x02, 0xAC, 0xA5, 0xFB },
-  { "STA $0647 = 00                  ", 0xEBCE, 0x37, 0x02, 0xAC, 0x25, 0xFB },
-  { "JSR $FAD4                       ", 0xEBD1, 0x37, 0x02, 0xAC, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAD4, 0x37, 0x02, 0xAC, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAD6, 0x37, 0x02, 0xAC, 0xE5, 0xF9 },
-  { "LDA #$F0                        ", 0xFAD7, 0x37, 0x02, 0xAC, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAD9, 0xF0, 0x02, 0xAC, 0xE5, 0xF9 },
-  { "ISB ($45,X) @ 47 = 0647 = 37    ", 0xEBD4, 0xF0, 0x02, 0xAC, 0xE5, 0xFB },
-  { "NOP                             ", 0xEBD6, 0xB8, 0x02, 0xAC, 0xA5, 0xFB },
-  { "NOP                             ", 0xEBD7, 0xB8, 0x02, 0xAC, 0xA5, 0xFB },
-  { "NOP                             ", 0xEBD8, 0xB8, 0x02, 0xAC, 0xA5, 0xFB },
-  { "NOP                             ", 0xEBD9, 0xB8, 0x02, 0xAC, 0xA5, 0xFB },
-  { "JSR $FADA                       ", 0xEBDA, 0xB8, 0x02, 0xAC, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFADA, 0xB8, 0x02, 0xAC, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFADC, 0xB8, 0x02, 0xAC, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFADE, 0xB8, 0x02, 0xAC, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFAE0, 0xB8, 0x02, 0xAC, 0xA5, 0xF9 },
-  { "CMP #$B8                        ", 0xFAE2, 0xB8, 0x02, 0xAC, 0xA5, 0xF9 },
-  { "BEQ $FAE8                       ", 0xFAE4, 0xB8, 0x02, 0xAC, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAE8, 0xB8, 0x02, 0xAC, 0x27, 0xF9 },
-  { "LDA $0647 = 38                  ", 0xEBDD, 0xB8, 0x02, 0xAC, 0x27, 0xFB },
-  { "CMP #$38                        ", 0xEBE0, 0x38, 0x02, 0xAC, 0x25, 0xFB },
-  { "BEQ $EBE6                       ", 0xEBE2, 0x38, 0x02, 0xAC, 0x27, 0xFB },
-  { "INY                             ", 0xEBE6, 0x38, 0x02, 0xAC, 0x27, 0xFB },
-  { "LDA #$EB                        ", 0xEBE7, 0x38, 0x02, 0xAD, 0xA5, 0xFB },
-  { "STA $47 = 47                    ", 0xEBE9, 0xEB, 0x02, 0xAD, 0xA5, 0xFB },
-  { "JSR $FAB1                       ", 0xEBEB, 0xEB, 0x02, 0xAD, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAB1, 0xEB, 0x02, 0xAD, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAB3, 0xEB, 0x02, 0xAD, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFAB4, 0xEB, 0x02, 0xAD, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAB6, 0x40, 0x02, 0xAD, 0x64, 0xF9 },
-  { "ISB $47 = EB                    ", 0xEBEE, 0x40, 0x02, 0xAD, 0x64, 0xFB },
-  { "NOP                             ", 0xEBF0, 0x53, 0x02, 0xAD, 0x24, 0xFB },
-  { "NOP                             ", 0xEBF1, 0x53, 0x02, 0xAD, 0x24, 0xFB },
-  { "NOP                             ", 0xEBF2, 0x53, 0x02, 0xAD, 0x24, 0xFB },
-  { "NOP                             ", 0xEBF3, 0x53, 0x02, 0xAD, 0x24, 0xFB },
-  { "JSR $FAB7                       ", 0xEBF4, 0x53, 0x02, 0xAD, 0x24, 0xFB },
-  { "BVS $FAE6                       ", 0xFAB7, 0x53, 0x02, 0xAD, 0x24, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAB9, 0x53, 0x02, 0xAD, 0x24, 0xF9 },
-  { "BMI $FAE6                       ", 0xFABB, 0x53, 0x02, 0xAD, 0x24, 0xF9 },
-  { "CMP #$53                        ", 0xFABD, 0x53, 0x02, 0xAD, 0x24, 0xF9 },
-  { "BNE $FAE6                       ", 0xFABF, 0x53, 0x02, 0xAD, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAC1, 0x53, 0x02, 0xAD, 0x27, 0xF9 },
-  { "LDA $47 = EC                    ", 0xEBF7, 0x53, 0x02, 0xAD, 0x27, 0xFB },
-  { "CMP #$EC                        ", 0xEBF9, 0xEC, 0x02, 0xAD, 0xA5, 0xFB },
-  { "BEQ $EBFF                       ", 0xEBFB, 0xEC, 0x02, 0xAD, 0x27, 0xFB },
-  { "INY                             ", 0xEBFF, 0xEC, 0x02, 0xAD, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xEC00, 0xEC, 0x02, 0xAE, 0xA5, 0xFB },
-  { "STA $47 = EC                    ", 0xEC02, 0xFF, 0x02, 0xAE, 0xA5, 0xFB },
-  { "JSR $FAC2                       ", 0xEC04, 0xFF, 0x02, 0xAE, 0xA5, 0xFB },
-  { "CLV                             ", 0xFAC2, 0xFF, 0x02, 0xAE, 0xA5, 0xF9 },
-  { "SEC                             ", 0xFAC3, 0xFF, 0x02, 0xAE, 0xA5, 0xF9 },
-  { "LDA #$FF                        ", 0xFAC4, 0xFF, 0x02, 0xAE, 0xA5, 0xF9 },
-  { "RTS                             ", 0xFAC6, 0xFF, 0x02, 0xAE, 0xA5, 0xF9 },
-  { "ISB $47 = FF                    ", 0xEC07, 0xFF, 0x02, 0xAE, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC09, 0xFF, 0x02, 0xAE, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC0A, 0xFF, 0x02, 0xAE, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC0B, 0xFF, 0x02, 0xAE, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC0C, 0xFF, 0x02, 0xAE, 0xA5, 0xFB },
-  { "JSR $FAC7                       ", 0xEC0D, 0xFF, 0x02, 0xAE, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFAC7, 0xFF, 0x02, 0xAE, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAC9, 0xFF, 0x02, 0xAE, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFACB, 0xFF, 0x02, 0xAE, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFACD, 0xFF, 0x02, 0xAE, 0xA5, 0xF9 },
-  { "CMP #$FF                        ", 0xFACF, 0xFF, 0x02, 0xAE, 0xA5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAD1, 0xFF, 0x02, 0xAE, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAD3, 0xFF, 0x02, 0xAE, 0x27, 0xF9 },
-  { "LDA $47 = 00                    ", 0xEC10, 0xFF, 0x02, 0xAE, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xEC12, 0x00, 0x02, 0xAE, 0x27, 0xFB },
-  { "BEQ $EC18                       ", 0xEC14, 0x00, 0x02, 0xAE, 0x27, 0xFB },
-  { "INY                             ", 0xEC18, 0x00, 0x02, 0xAE, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEC19, 0x00, 0x02, 0xAF, 0xA5, 0xFB },
-  { "STA $47 = 00                    ", 0xEC1B, 0x37, 0x02, 0xAF, 0x25, 0xFB },
-  { "JSR $FAD4                       ", 0xEC1D, 0x37, 0x02, 0xAF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAD4, 0x37, 0x02, 0xAF, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAD6, 0x37, 0x02, 0xAF, 0xE5, 0xF9 },
-  { "LDA #$F0                        ", 0xFAD7, 0x37, 0x02, 0xAF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAD9, 0xF0, 0x02, 0xAF, 0xE5, 0xF9 },
-  { "ISB $47 = 37                    ", 0xEC20, 0xF0, 0x02, 0xAF, 0xE5, 0xFB },
-  { "NOP                             ", 0xEC22, 0xB8, 0x02, 0xAF, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC23, 0xB8, 0x02, 0xAF, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC24, 0xB8, 0x02, 0xAF, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC25, 0xB8, 0x02, 0xAF, 0xA5, 0xFB },
-  { "JSR $FADA                       ", 0xEC26, 0xB8, 0x02, 0xAF, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFADA, 0xB8, 0x02, 0xAF, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFADC, 0xB8, 0x02, 0xAF, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFADE, 0xB8, 0x02, 0xAF, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFAE0, 0xB8, 0x02, 0xAF, 0xA5, 0xF9 },
-  { "CMP #$B8                        ", 0xFAE2, 0xB8, 0x02, 0xAF, 0xA5, 0xF9 },
-  { "BEQ $FAE8                       ", 0xFAE4, 0xB8, 0x02, 0xAF, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAE8, 0xB8, 0x02, 0xAF, 0x27, 0xF9 },
-  { "LDA $47 = 38                    ", 0xEC29, 0xB8, 0x02, 0xAF, 0x27, 0xFB },
-  { "CMP #$38                        ", 0xEC2B, 0x38, 0x02, 0xAF, 0x25, 0xFB },
-  { "BEQ $EC31                       ", 0xEC2D, 0x38, 0x02, 0xAF, 0x27, 0xFB },
-  { "INY                             ", 0xEC31, 0x38, 0x02, 0xAF, 0x27, 0xFB },
-  { "LDA #$EB                        ", 0xEC32, 0x38, 0x02, 0xB0, 0xA5, 0xFB },
-  { "STA $0647 = 38                  ", 0xEC34, 0xEB, 0x02, 0xB0, 0xA5, 0xFB },
-  { "JSR $FAB1                       ", 0xEC37, 0xEB, 0x02, 0xB0, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAB1, 0xEB, 0x02, 0xB0, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAB3, 0xEB, 0x02, 0xB0, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFAB4, 0xEB, 0x02, 0xB0, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAB6, 0x40, 0x02, 0xB0, 0x64, 0xF9 },
-  { "ISB $0647 = EB                  ", 0xEC3A, 0x40, 0x02, 0xB0, 0x64, 0xFB },
-  { "NOP                             ", 0xEC3D, 0x53, 0x02, 0xB0, 0x24, 0xFB },
-  { "NOP                             ", 0xEC3E, 0x53, 0x02, 0xB0, 0x24, 0xFB },
-  { "NOP                             ", 0xEC3F, 0x53, 0x02, 0xB0, 0x24, 0xFB },
-  { "NOP                             ", 0xEC40, 0x53, 0x02, 0xB0, 0x24, 0xFB },
-  { "JSR $FAB7                       ", 0xEC41, 0x53, 0x02, 0xB0, 0x24, 0xFB },
-  { "BVS $FAE6                       ", 0xFAB7, 0x53, 0x02, 0xB0, 0x24, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAB9, 0x53, 0x02, 0xB0, 0x24, 0xF9 },
-  { "BMI $FAE6                       ", 0xFABB, 0x53, 0x02, 0xB0, 0x24, 0xF9 },
-  { "CMP #$53                        ", 0xFABD, 0x53, 0x02, 0xB0, 0x24, 0xF9 },
-  { "BNE $FAE6                       ", 0xFABF, 0x53, 0x02, 0xB0, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAC1, 0x53, 0x02, 0xB0, 0x27, 0xF9 },
-  { "LDA $0647 = EC                  ", 0xEC44, 0x53, 0x02, 0xB0, 0x27, 0xFB },
-  { "CMP #$EC                        ", 0xEC47, 0xEC, 0x02, 0xB0, 0xA5, 0xFB },
-  { "BEQ $EC4D                       ", 0xEC49, 0xEC, 0x02, 0xB0, 0x27, 0xFB },
-  { "INY                             ", 0xEC4D, 0xEC, 0x02, 0xB0, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xEC4E, 0xEC, 0x02, 0xB1, 0xA5, 0xFB },
-  { "STA $0647 = EC                  ", 0xEC50, 0xFF, 0x02, 0xB1, 0xA5, 0xFB },
-  { "JSR $FAC2                       ", 0xEC53, 0xFF, 0x02, 0xB1, 0xA5, 0xFB },
-  { "CLV                             ", 0xFAC2, 0xFF, 0x02, 0xB1, 0xA5, 0xF9 },
-  { "SEC                             ", 0xFAC3, 0xFF, 0x02, 0xB1, 0xA5, 0xF9 },
-  { "LDA #$FF                        ", 0xFAC4, 0xFF, 0x02, 0xB1, 0xA5, 0xF9 },
-  { "RTS                             ", 0xFAC6, 0xFF, 0x02, 0xB1, 0xA5, 0xF9 },
-  { "ISB $0647 = FF                  ", 0xEC56, 0xFF, 0x02, 0xB1, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC59, 0xFF, 0x02, 0xB1, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC5A, 0xFF, 0x02, 0xB1, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC5B, 0xFF, 0x02, 0xB1, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC5C, 0xFF, 0x02, 0xB1, 0xA5, 0xFB },
-  { "JSR $FAC7                       ", 0xEC5D, 0xFF, 0x02, 0xB1, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFAC7, 0xFF, 0x02, 0xB1, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAC9, 0xFF, 0x02, 0xB1, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFACB, 0xFF, 0x02, 0xB1, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFACD, 0xFF, 0x02, 0xB1, 0xA5, 0xF9 },
-  { "CMP #$FF                        ", 0xFACF, 0xFF, 0x02, 0xB1, 0xA5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAD1, 0xFF, 0x02, 0xB1, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAD3, 0xFF, 0x02, 0xB1, 0x27, 0xF9 },
-  { "LDA $0647 = 00                  ", 0xEC60, 0xFF, 0x02, 0xB1, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xEC63, 0x00, 0x02, 0xB1, 0x27, 0xFB },
-  { "BEQ $EC69                       ", 0xEC65, 0x00, 0x02, 0xB1, 0x27, 0xFB },
-  { "INY                             ", 0xEC69, 0x00, 0x02, 0xB1, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEC6A, 0x00, 0x02, 0xB2, 0xA5, 0xFB },
-  { "STA $0647 = 00                  ", 0xEC6C, 0x37, 0x02, 0xB2, 0x25, 0xFB },
-  { "JSR $FAD4                       ", 0xEC6F, 0x37, 0x02, 0xB2, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAD4, 0x37, 0x02, 0xB2, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAD6, 0x37, 0x02, 0xB2, 0xE5, 0xF9 },
-  { "LDA #$F0                        ", 0xFAD7, 0x37, 0x02, 0xB2, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAD9, 0xF0, 0x02, 0xB2, 0xE5, 0xF9 },
-  { "ISB $0647 = 37                  ", 0xEC72, 0xF0, 0x02, 0xB2, 0xE5, 0xFB },
-  { "NOP                             ", 0xEC75, 0xB8, 0x02, 0xB2, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC76, 0xB8, 0x02, 0xB2, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC77, 0xB8, 0x02, 0xB2, 0xA5, 0xFB },
-  { "NOP                             ", 0xEC78, 0xB8, 0x02, 0xB2, 0xA5, 0xFB },
-  { "JSR $FADA                       ", 0xEC79, 0xB8, 0x02, 0xB2, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFADA, 0xB8, 0x02, 0xB2, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFADC, 0xB8, 0x02, 0xB2, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFADE, 0xB8, 0x02, 0xB2, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFAE0, 0xB8, 0x02, 0xB2, 0xA5, 0xF9 },
-  { "CMP #$B8                        ", 0xFAE2, 0xB8, 0x02, 0xB2, 0xA5, 0xF9 },
-  { "BEQ $FAE8                       ", 0xFAE4, 0xB8, 0x02, 0xB2, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAE8, 0xB8, 0x02, 0xB2, 0x27, 0xF9 },
-  { "LDA $0647 = 38                  ", 0xEC7C, 0xB8, 0x02, 0xB2, 0x27, 0xFB },
-  { "CMP #$38                        ", 0xEC7F, 0x38, 0x02, 0xB2, 0x25, 0xFB },
-  { "BEQ $EC85                       ", 0xEC81, 0x38, 0x02, 0xB2, 0x27, 0xFB },
-  { "LDA #$EB                        ", 0xEC85, 0x38, 0x02, 0xB2, 0x27, 0xFB },
-  { "STA $0647 = 38                  ", 0xEC87, 0xEB, 0x02, 0xB2, 0xA5, 0xFB },
-  { "LDA #$48                        ", 0xEC8A, 0xEB, 0x02, 0xB2, 0xA5, 0xFB },
-  { "STA $45 = 48                    ", 0xEC8C, 0x48, 0x02, 0xB2, 0x25, 0xFB },
-  { "LDA #$05                        ", 0xEC8E, 0x48, 0x02, 0xB2, 0x25, 0xFB },
-  { "STA $46 = 05                    ", 0xEC90, 0x05, 0x02, 0xB2, 0x25, 0xFB },
-  { "LDY #$FF                        ", 0xEC92, 0x05, 0x02, 0xB2, 0x25, 0xFB },
-  { "JSR $FAB1                       ", 0xEC94, 0x05, 0x02, 0xFF, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAB1, 0x05, 0x02, 0xFF, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAB3, 0x05, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFAB4, 0x05, 0x02, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAB6, 0x40, 0x02, 0xFF, 0x64, 0xF9 },
-  { "ISB ($45),Y = 0548 @ 0647 = EB  ", 0xEC97, 0x40, 0x02, 0xFF, 0x64, 0xFB },
-  { "NOP                             ", 0xEC99, 0x53, 0x02, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xEC9A, 0x53, 0x02, 0xFF, 0x24, 0xFB },
-  { "PHP                             ", 0xEC9B, 0x53, 0x02, 0xFF, 0x24, 0xFB },
-  { "PHA                             ", 0xEC9C, 0x53, 0x02, 0xFF, 0x24, 0xFA },
-  { "LDY #$B3                        ", 0xEC9D, 0x53, 0x02, 0xFF, 0x24, 0xF9 },
-  { "PLA                             ", 0xEC9F, 0x53, 0x02, 0xB3, 0xA4, 0xF9 },
-  { "PLP                             ", 0xECA0, 0x53, 0x02, 0xB3, 0x24, 0xFA },
-  { "JSR $FAB7                       ", 0xECA1, 0x53, 0x02, 0xB3, 0x24, 0xFB },
-  { "BVS $FAE6                       ", 0xFAB7, 0x53, 0x02, 0xB3, 0x24, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAB9, 0x53, 0x02, 0xB3, 0x24, 0xF9 },
-  { "BMI $FAE6                       ", 0xFABB, 0x53, 0x02, 0xB3, 0x24, 0xF9 },
-  { "CMP #$53                        ", 0xFABD, 0x53, 0x02, 0xB3, 0x24, 0xF9 },
-  { "BNE $FAE6                       ", 0xFABF, 0x53, 0x02, 0xB3, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAC1, 0x53, 0x02, 0xB3, 0x27, 0xF9 },
-  { "LDA $0647 = EC                  ", 0xECA4, 0x53, 0x02, 0xB3, 0x27, 0xFB },
-  { "CMP #$EC                        ", 0xECA7, 0xEC, 0x02, 0xB3, 0xA5, 0xFB },
-  { "BEQ $ECAD                       ", 0xECA9, 0xEC, 0x02, 0xB3, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xECAD, 0xEC, 0x02, 0xB3, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xECAF, 0xEC, 0x02, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = EC                  ", 0xECB1, 0xFF, 0x02, 0xFF, 0xA5, 0xFB },
-  { "JSR $FAC2                       ", 0xECB4, 0xFF, 0x02, 0xFF, 0xA5, 0xFB },
-  { "CLV                             ", 0xFAC2, 0xFF, 0x02, 0xFF, 0xA5, 0xF9 },
-  { "SEC                             ", 0xFAC3, 0xFF, 0x02, 0xFF, 0xA5, 0xF9 },
-  { "LDA #$FF                        ", 0xFAC4, 0xFF, 0x02, 0xFF, 0xA5, 0xF9 },
-  { "RTS                             ", 0xFAC6, 0xFF, 0x02, 0xFF, 0xA5, 0xF9 },
-  { "ISB ($45),Y = 0548 @ 0647 = FF  ", 0xECB7, 0xFF, 0x02, 0xFF, 0xA5, 0xFB },
-  { "NOP                             ", 0xECB9, 0xFF, 0x02, 0xFF, 0xA5, 0xFB },
-  { "NOP                             ", 0xECBA, 0xFF, 0x02, 0xFF, 0xA5, 0xFB },
-  { "PHP                             ", 0xECBB, 0xFF, 0x02, 0xFF, 0xA5, 0xFB },
-  { "PHA                             ", 0xECBC, 0xFF, 0x02, 0xFF, 0xA5, 0xFA },
-  { "LDY #$B4                        ", 0xECBD, 0xFF, 0x02, 0xFF, 0xA5, 0xF9 },
-  { "PLA                             ", 0xECBF, 0xFF, 0x02, 0xB4, 0xA5, 0xF9 },
-  { "PLP                             ", 0xECC0, 0xFF, 0x02, 0xB4, 0xA5, 0xFA },
-  { "JSR $FAC7                       ", 0xECC1, 0xFF, 0x02, 0xB4, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFAC7, 0xFF, 0x02, 0xB4, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAC9, 0xFF, 0x02, 0xB4, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFACB, 0xFF, 0x02, 0xB4, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFACD, 0xFF, 0x02, 0xB4, 0xA5, 0xF9 },
-  { "CMP #$FF                        ", 0xFACF, 0xFF, 0x02, 0xB4, 0xA5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAD1, 0xFF, 0x02, 0xB4, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAD3, 0xFF, 0x02, 0xB4, 0x27, 0xF9 },
-  { "LDA $0647 = 00                  ", 0xECC4, 0xFF, 0x02, 0xB4, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xECC7, 0x00, 0x02, 0xB4, 0x27, 0xFB },
-  { "BEQ $ECCD                       ", 0xECC9, 0x00, 0x02, 0xB4, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xECCD, 0x00, 0x02, 0xB4, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xECCF, 0x00, 0x02, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 00                  ", 0xECD1, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "JSR $FAD4                       ", 0xECD4, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAD4, 0x37, 0x02, 0xFF, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAD6, 0x37, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$F0                        ", 0xFAD7, 0x37, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAD9, 0xF0, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "ISB ($45),Y = 0548 @ 0647 = 37  ", 0xECD7, 0xF0, 0x02, 0xFF, 0xE5, 0xFB },
-  { "NOP                             ", 0xECD9, 0xB8, 0x02, 0xFF, 0xA5, 0xFB },
-  { "NOP                             ", 0xECDA, 0xB8, 0x02, 0xFF, 0xA5, 0xFB },
-  { "PHP                             ", 0xECDB, 0xB8, 0x02, 0xFF, 0xA5, 0xFB },
-  { "PHA                             ", 0xECDC, 0xB8, 0x02, 0xFF, 0xA5, 0xFA },
-  { "LDY #$B5                        ", 0xECDD, 0xB8, 0x02, 0xFF, 0xA5, 0xF9 },
-  { "PLA                             ", 0xECDF, 0xB8, 0x02, 0xB5, 0xA5, 0xF9 },
-  { "PLP                             ", 0xECE0, 0xB8, 0x02, 0xB5, 0xA5, 0xFA },
-  { "JSR $FADA                       ", 0xECE1, 0xB8, 0x02, 0xB5, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFADA, 0xB8, 0x02, 0xB5, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFADC, 0xB8, 0x02, 0xB5, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFADE, 0xB8, 0x02, 0xB5, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFAE0, 0xB8, 0x02, 0xB5, 0xA5, 0xF9 },
-  { "CMP #$B8                        ", 0xFAE2, 0xB8, 0x02, 0xB5, 0xA5, 0xF9 },
-  { "BEQ $FAE8                       ", 0xFAE4, 0xB8, 0x02, 0xB5, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAE8, 0xB8, 0x02, 0xB5, 0x27, 0xF9 },
-  { "LDA $0647 = 38                  ", 0xECE4, 0xB8, 0x02, 0xB5, 0x27, 0xFB },
-  { "CMP #$38                        ", 0xECE7, 0x38, 0x02, 0xB5, 0x25, 0xFB },
-  { "BEQ $ECED                       ", 0xECE9, 0x38, 0x02, 0xB5, 0x27, 0xFB },
-  { "LDY #$B6                        ", 0xECED, 0x38, 0x02, 0xB5, 0x27, 0xFB },
-  { "LDX #$FF                        ", 0xECEF, 0x38, 0x02, 0xB6, 0xA5, 0xFB },
-  { "LDA #$EB                        ", 0xECF1, 0x38, 0xFF, 0xB6, 0xA5, 0xFB },
-  { "STA $47 = 38                    ", 0xECF3, 0xEB, 0xFF, 0xB6, 0xA5, 0xFB },
-  { "JSR $FAB1                       ", 0xECF5, 0xEB, 0xFF, 0xB6, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAB1, 0xEB, 0xFF, 0xB6, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAB3, 0xEB, 0xFF, 0xB6, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFAB4, 0xEB, 0xFF, 0xB6, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAB6, 0x40, 0xFF, 0xB6, 0x64, 0xF9 },
-  { "ISB $48,X @ 47 = EB             ", 0xECF8, 0x40, 0xFF, 0xB6, 0x64, 0xFB },
-  { "NOP                             ", 0xECFA, 0x53, 0xFF, 0xB6, 0x24, 0xFB },
-  { "NOP                             ", 0xECFB, 0x53, 0xFF, 0xB6, 0x24, 0xFB },
-  { "NOP                             ", 0xECFC, 0x53, 0xFF, 0xB6, 0x24, 0xFB },
-  { "NOP                             ", 0xECFD, 0x53, 0xFF, 0xB6, 0x24, 0xFB },
-  { "JSR $FAB7                       ", 0xECFE, 0x53, 0xFF, 0xB6, 0x24, 0xFB },
-  { "BVS $FAE6                       ", 0xFAB7, 0x53, 0xFF, 0xB6, 0x24, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAB9, 0x53, 0xFF, 0xB6, 0x24, 0xF9 },
-  { "BMI $FAE6                       ", 0xFABB, 0x53, 0xFF, 0xB6, 0x24, 0xF9 },
-  { "CMP #$53                        ", 0xFABD, 0x53, 0xFF, 0xB6, 0x24, 0xF9 },
-  { "BNE $FAE6                       ", 0xFABF, 0x53, 0xFF, 0xB6, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAC1, 0x53, 0xFF, 0xB6, 0x27, 0xF9 },
-  { "LDA $47 = EC                    ", 0xED01, 0x53, 0xFF, 0xB6, 0x27, 0xFB },
-  { "CMP #$EC                        ", 0xED03, 0xEC, 0xFF, 0xB6, 0xA5, 0xFB },
-  { "BEQ $ED09                       ", 0xED05, 0xEC, 0xFF, 0xB6, 0x27, 0xFB },
-  { "INY                             ", 0xED09, 0xEC, 0xFF, 0xB6, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xED0A, 0xEC, 0xFF, 0xB7, 0xA5, 0xFB },
-  { "STA $47 = EC                    ", 0xED0C, 0xFF, 0xFF, 0xB7, 0xA5, 0xFB },
-  { "JSR $FAC2                       ", 0xED0E, 0xFF, 0xFF, 0xB7, 0xA5, 0xFB },
-  { "CLV                             ", 0xFAC2, 0xFF, 0xFF, 0xB7, 0xA5, 0xF9 },
-  { "SEC                             ", 0xFAC3, 0xFF, 0xFF, 0xB7, 0xA5, 0xF9 },
-  { "LDA #$FF                        ", 0xFAC4, 0xFF, 0xFF, 0xB7, 0xA5, 0xF9 },
-  { "RTS                             ", 0xFAC6, 0xFF, 0xFF, 0xB7, 0xA5, 0xF9 },
-  { "ISB $48,X @ 47 = FF             ", 0xED11, 0xFF, 0xFF, 0xB7, 0xA5, 0xFB },
-  { "NOP                             ", 0xED13, 0xFF, 0xFF, 0xB7, 0xA5, 0xFB },
-  { "NOP                             ", 0xED14, 0xFF, 0xFF, 0xB7, 0xA5, 0xFB },
-  { "NOP                             ", 0xED15, 0xFF, 0xFF, 0xB7, 0xA5, 0xFB },
-  { "NOP                             ", 0xED16, 0xFF, 0xFF, 0xB7, 0xA5, 0xFB },
-  { "JSR $FAC7                       ", 0xED17, 0xFF, 0xFF, 0xB7, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFAC7, 0xFF, 0xFF, 0xB7, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAC9, 0xFF, 0xFF, 0xB7, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFACB, 0xFF, 0xFF, 0xB7, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFACD, 0xFF, 0xFF, 0xB7, 0xA5, 0xF9 },
-  { "CMP #$FF                        ", 0xFACF, 0xFF, 0xFF, 0xB7, 0xA5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAD1, 0xFF, 0xFF, 0xB7, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAD3, 0xFF, 0xFF, 0xB7, 0x27, 0xF9 },
-  { "LDA $47 = 00                    ", 0xED1A, 0xFF, 0xFF, 0xB7, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xED1C, 0x00, 0xFF, 0xB7, 0x27, 0xFB },
-  { "BEQ $ED22                       ", 0xED1E, 0x00, 0xFF, 0xB7, 0x27, 0xFB },
-  { "INY                             ", 0xED22, 0x00, 0xFF, 0xB7, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xED23, 0x00, 0xFF, 0xB8, 0xA5, 0xFB },
-  { "STA $47 = 00                    ", 0xED25, 0x37, 0xFF, 0xB8, 0x25, 0xFB },
-  { "JSR $FAD4                       ", 0xED27, 0x37, 0xFF, 0xB8, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAD4, 0x37, 0xFF, 0xB8, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAD6, 0x37, 0xFF, 0xB8, 0xE5, 0xF9 },
-  { "LDA #$F0                        ", 0xFAD7, 0x37, 0xFF, 0xB8, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAD9, 0xF0, 0xFF, 0xB8, 0xE5, 0xF9 },
-  { "ISB $48,X @ 47 = 37             ", 0xED2A, 0xF0, 0xFF, 0xB8, 0xE5, 0xFB },
-  { "NOP                             ", 0xED2C, 0xB8, 0xFF, 0xB8, 0xA5, 0xFB },
-  { "NOP                             ", 0xED2D, 0xB8, 0xFF, 0xB8, 0xA5, 0xFB },
-  { "NOP                             ", 0xED2E, 0xB8, 0xFF, 0xB8, 0xA5, 0xFB },
-  { "NOP                             ", 0xED2F, 0xB8, 0xFF, 0xB8, 0xA5, 0xFB },
-  { "JSR $FADA                       ", 0xED30, 0xB8, 0xFF, 0xB8, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFADA, 0xB8, 0xFF, 0xB8, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFADC, 0xB8, 0xFF, 0xB8, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFADE, 0xB8, 0xFF, 0xB8, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFAE0, 0xB8, 0xFF, 0xB8, 0xA5, 0xF9 },
-  { "CMP #$B8                        ", 0xFAE2, 0xB8, 0xFF, 0xB8, 0xA5, 0xF9 },
-  { "BEQ $FAE8                       ", 0xFAE4, 0xB8, 0xFF, 0xB8, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAE8, 0xB8, 0xFF, 0xB8, 0x27, 0xF9 },
-  { "LDA $47 = 38                    ", 0xED33, 0xB8, 0xFF, 0xB8, 0x27, 0xFB },
-  { "CMP #$38                        ", 0xED35, 0x38, 0xFF, 0xB8, 0x25, 0xFB },
-  { "BEQ $ED3B                       ", 0xED37, 0x38, 0xFF, 0xB8, 0x27, 0xFB },
-  { "LDA #$EB                        ", 0xED3B, 0x38, 0xFF, 0xB8, 0x27, 0xFB },
-  { "STA $0647 = 38                  ", 0xED3D, 0xEB, 0xFF, 0xB8, 0xA5, 0xFB },
-  { "LDY #$FF                        ", 0xED40, 0xEB, 0xFF, 0xB8, 0xA5, 0xFB },
-  { "JSR $FAB1                       ", 0xED42, 0xEB, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAB1, 0xEB, 0xFF, 0xFF, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAB3, 0xEB, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFAB4, 0xEB, 0xFF, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAB6, 0x40, 0xFF, 0xFF, 0x64, 0xF9 },
-  { "ISB $0548,Y @ 0647 = EB         ", 0xED45, 0x40, 0xFF, 0xFF, 0x64, 0xFB },
-  { "NOP                             ", 0xED48, 0x53, 0xFF, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xED49, 0x53, 0xFF, 0xFF, 0x24, 0xFB },
-  { "PHP                             ", 0xED4A, 0x53, 0xFF, 0xFF, 0x24, 0xFB },
-  { "PHA                             ", 0xED4B, 0x53, 0xFF, 0xFF, 0x24, 0xFA },
-  { "LDY #$B9                        ", 0xED4C, 0x53, 0xFF, 0xFF, 0x24, 0xF9 },
-  { "PLA                             ", 0xED4E, 0x53, 0xFF, 0xB9, 0xA4, 0xF9 },
-  { "PLP                             ", 0xED4F, 0x53, 0xFF, 0xB9, 0x24, 0xFA },
-  { "JSR $FAB7                       ", 0xED50, 0x53, 0xFF, 0xB9, 0x24, 0xFB },
-  { "BVS $FAE6                       ", 0xFAB7, 0x53, 0xFF, 0xB9, 0x24, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAB9, 0x53, 0xFF, 0xB9, 0x24, 0xF9 },
-  { "BMI $FAE6                       ", 0xFABB, 0x53, 0xFF, 0xB9, 0x24, 0xF9 },
-  { "CMP #$53                        ", 0xFABD, 0x53, 0xFF, 0xB9, 0x24, 0xF9 },
-  { "BNE $FAE6                       ", 0xFABF, 0x53, 0xFF, 0xB9, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAC1, 0x53, 0xFF, 0xB9, 0x27, 0xF9 },
-  { "LDA $0647 = EC                  ", 0xED53, 0x53, 0xFF, 0xB9, 0x27, 0xFB },
-  { "CMP #$EC                        ", 0xED56, 0xEC, 0xFF, 0xB9, 0xA5, 0xFB },
-  { "BEQ $ED5C                       ", 0xED58, 0xEC, 0xFF, 0xB9, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xED5C, 0xEC, 0xFF, 0xB9, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xED5E, 0xEC, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = EC                  ", 0xED60, 0xFF, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "JSR $FAC2                       ", 0xED63, 0xFF, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "CLV                             ", 0xFAC2, 0xFF, 0xFF, 0xFF, 0xA5, 0xF9 },
-  { "SEC                             ", 0xFAC3, 0xFF, 0xFF, 0xFF, 0xA5, 0xF9 },
-  { "LDA #$FF                        ", 0xFAC4, 0xFF, 0xFF, 0xFF, 0xA5, 0xF9 },
-  { "RTS                             ", 0xFAC6, 0xFF, 0xFF, 0xFF, 0xA5, 0xF9 },
-  { "ISB $0548,Y @ 0647 = FF         ", 0xED66, 0xFF, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "NOP                             ", 0xED69, 0xFF, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "NOP                             ", 0xED6A, 0xFF, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "PHP                             ", 0xED6B, 0xFF, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "PHA                             ", 0xED6C, 0xFF, 0xFF, 0xFF, 0xA5, 0xFA },
-  { "LDY #$BA                        ", 0xED6D, 0xFF, 0xFF, 0xFF, 0xA5, 0xF9 },
-  { "PLA                             ", 0xED6F, 0xFF, 0xFF, 0xBA, 0xA5, 0xF9 },
-  { "PLP                             ", 0xED70, 0xFF, 0xFF, 0xBA, 0xA5, 0xFA },
-  { "JSR $FAC7                       ", 0xED71, 0xFF, 0xFF, 0xBA, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFAC7, 0xFF, 0xFF, 0xBA, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAC9, 0xFF, 0xFF, 0xBA, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFACB, 0xFF, 0xFF, 0xBA, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFACD, 0xFF, 0xFF, 0xBA, 0xA5, 0xF9 },
-  { "CMP #$FF                        ", 0xFACF, 0xFF, 0xFF, 0xBA, 0xA5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAD1, 0xFF, 0xFF, 0xBA, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAD3, 0xFF, 0xFF, 0xBA, 0x27, 0xF9 },
-  { "LDA $0647 = 00                  ", 0xED74, 0xFF, 0xFF, 0xBA, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xED77, 0x00, 0xFF, 0xBA, 0x27, 0xFB },
-  { "BEQ $ED7D                       ", 0xED79, 0x00, 0xFF, 0xBA, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xED7D, 0x00, 0xFF, 0xBA, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xED7F, 0x00, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 00                  ", 0xED81, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "JSR $FAD4                       ", 0xED84, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAD4, 0x37, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAD6, 0x37, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$F0                        ", 0xFAD7, 0x37, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAD9, 0xF0, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "ISB $0548,Y @ 0647 = 37         ", 0xED87, 0xF0, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "NOP                             ", 0xED8A, 0xB8, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "NOP                             ", 0xED8B, 0xB8, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "PHP                             ", 0xED8C, 0xB8, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "PHA                             ", 0xED8D, 0xB8, 0xFF, 0xFF, 0xA5, 0xFA },
-  { "LDY #$BB                        ", 0xED8E, 0xB8, 0xFF, 0xFF, 0xA5, 0xF9 },
-  { "PLA                             ", 0xED90, 0xB8, 0xFF, 0xBB, 0xA5, 0xF9 },
-  { "PLP                             ", 0xED91, 0xB8, 0xFF, 0xBB, 0xA5, 0xFA },
-  { "JSR $FADA                       ", 0xED92, 0xB8, 0xFF, 0xBB, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFADA, 0xB8, 0xFF, 0xBB, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFADC, 0xB8, 0xFF, 0xBB, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFADE, 0xB8, 0xFF, 0xBB, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFAE0, 0xB8, 0xFF, 0xBB, 0xA5, 0xF9 },
-  { "CMP #$B8                        ", 0xFAE2, 0xB8, 0xFF, 0xBB, 0xA5, 0xF9 },
-  { "BEQ $FAE8                       ", 0xFAE4, 0xB8, 0xFF, 0xBB, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAE8, 0xB8, 0xFF, 0xBB, 0x27, 0xF9 },
-  { "LDA $0647 = 38                  ", 0xED95, 0xB8, 0xFF, 0xBB, 0x27, 0xFB },
-  { "CMP #$38                        ", 0xED98, 0x38, 0xFF, 0xBB, 0x25, 0xFB },
-  { "BEQ $ED9E                       ", 0xED9A, 0x38, 0xFF, 0xBB, 0x27, 0xFB },
-  { "LDY #$BC                        ", 0xED9E, 0x38, 0xFF, 0xBB, 0x27, 0xFB },
-  { "LDX #$FF                        ", 0xEDA0, 0x38, 0xFF, 0xBC, 0xA5, 0xFB },
-  { "LDA #$EB                        ", 0xEDA2, 0x38, 0xFF, 0xBC, 0xA5, 0xFB },
-  { "STA $0647 = 38                  ", 0xEDA4, 0xEB, 0xFF, 0xBC, 0xA5, 0xFB },
-  { "JSR $FAB1                       ", 0xEDA7, 0xEB, 0xFF, 0xBC, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAB1, 0xEB, 0xFF, 0xBC, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAB3, 0xEB, 0xFF, 0xBC, 0xE5, 0xF9 },
-  { "LDA #$40                        ", 0xFAB4, 0xEB, 0xFF, 0xBC, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAB6, 0x40, 0xFF, 0xBC, 0x64, 0xF9 },
-  { "ISB $0548,X @ 0647 = EB         ", 0xEDAA, 0x40, 0xFF, 0xBC, 0x64, 0xFB },
-  { "NOP                             ", 0xEDAD, 0x53, 0xFF, 0xBC, 0x24, 0xFB },
-  { "NOP                             ", 0xEDAE, 0x53, 0xFF, 0xBC, 0x24, 0xFB },
-  { "NOP                             ", 0xEDAF, 0x53, 0xFF, 0xBC, 0x24, 0xFB },
-  { "NOP                             ", 0xEDB0, 0x53, 0xFF, 0xBC, 0x24, 0xFB },
-  { "JSR $FAB7                       ", 0xEDB1, 0x53, 0xFF, 0xBC, 0x24, 0xFB },
-  { "BVS $FAE6                       ", 0xFAB7, 0x53, 0xFF, 0xBC, 0x24, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAB9, 0x53, 0xFF, 0xBC, 0x24, 0xF9 },
-  { "BMI $FAE6                       ", 0xFABB, 0x53, 0xFF, 0xBC, 0x24, 0xF9 },
-  { "CMP #$53                        ", 0xFABD, 0x53, 0xFF, 0xBC, 0x24, 0xF9 },
-  { "BNE $FAE6                       ", 0xFABF, 0x53, 0xFF, 0xBC, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAC1, 0x53, 0xFF, 0xBC, 0x27, 0xF9 },
-  { "LDA $0647 = EC                  ", 0xEDB4, 0x53, 0xFF, 0xBC, 0x27, 0xFB },
-  { "CMP #$EC                        ", 0xEDB7, 0xEC, 0xFF, 0xBC, 0xA5, 0xFB },
-  { "BEQ $EDBD                       ", 0xEDB9, 0xEC, 0xFF, 0xBC, 0x27, 0xFB },
-  { "INY                             ", 0xEDBD, 0xEC, 0xFF, 0xBC, 0x27, 0xFB },
-  { "LDA #$FF                        ", 0xEDBE, 0xEC, 0xFF, 0xBD, 0xA5, 0xFB },
-  { "STA $0647 = EC                  ", 0xEDC0, 0xFF, 0xFF, 0xBD, 0xA5, 0xFB },
-  { "JSR $FAC2                       ", 0xEDC3, 0xFF, 0xFF, 0xBD, 0xA5, 0xFB },
-  { "CLV                             ", 0xFAC2, 0xFF, 0xFF, 0xBD, 0xA5, 0xF9 },
-  { "SEC                             ", 0xFAC3, 0xFF, 0xFF, 0xBD, 0xA5, 0xF9 },
-  { "LDA #$FF                        ", 0xFAC4, 0xFF, 0xFF, 0xBD, 0xA5, 0xF9 },
-  { "RTS                             ", 0xFAC6, 0xFF, 0xFF, 0xBD, 0xA5, 0xF9 },
-  { "ISB $0548,X @ 0647 = FF         ", 0xEDC6, 0xFF, 0xFF, 0xBD, 0xA5, 0xFB },
-  { "NOP                             ", 0xEDC9, 0xFF, 0xFF, 0xBD, 0xA5, 0xFB },
-  { "NOP                             ", 0xEDCA, 0xFF, 0xFF, 0xBD, 0xA5, 0xFB },
-  { "NOP                             ", 0xEDCB, 0xFF, 0xFF, 0xBD, 0xA5, 0xFB },
-  { "NOP                             ", 0xEDCC, 0xFF, 0xFF, 0xBD, 0xA5, 0xFB },
-  { "JSR $FAC7                       ", 0xEDCD, 0xFF, 0xFF, 0xBD, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFAC7, 0xFF, 0xFF, 0xBD, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAC9, 0xFF, 0xFF, 0xBD, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFACB, 0xFF, 0xFF, 0xBD, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFACD, 0xFF, 0xFF, 0xBD, 0xA5, 0xF9 },
-  { "CMP #$FF                        ", 0xFACF, 0xFF, 0xFF, 0xBD, 0xA5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAD1, 0xFF, 0xFF, 0xBD, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAD3, 0xFF, 0xFF, 0xBD, 0x27, 0xF9 },
-  { "LDA $0647 = 00                  ", 0xEDD0, 0xFF, 0xFF, 0xBD, 0x27, 0xFB },
-  { "CMP #$00                        ", 0xEDD3, 0x00, 0xFF, 0xBD, 0x27, 0xFB },
-  { "BEQ $EDD9                       ", 0xEDD5, 0x00, 0xFF, 0xBD, 0x27, 0xFB },
-  { "INY                             ", 0xEDD9, 0x00, 0xFF, 0xBD, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEDDA, 0x00, 0xFF, 0xBE, 0xA5, 0xFB },
-  { "STA $0647 = 00                  ", 0xEDDC, 0x37, 0xFF, 0xBE, 0x25, 0xFB },
-  { "JSR $FAD4                       ", 0xEDDF, 0x37, 0xFF, 0xBE, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAD4, 0x37, 0xFF, 0xBE, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAD6, 0x37, 0xFF, 0xBE, 0xE5, 0xF9 },
-  { "LDA #$F0                        ", 0xFAD7, 0x37, 0xFF, 0xBE, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAD9, 0xF0, 0xFF, 0xBE, 0xE5, 0xF9 },
-  { "ISB $0548,X @ 0647 = 37         ", 0xEDE2, 0xF0, 0xFF, 0xBE, 0xE5, 0xFB },
-  { "NOP                             ", 0xEDE5, 0xB8, 0xFF, 0xBE, 0xA5, 0xFB },
-  { "NOP                             ", 0xEDE6, 0xB8, 0xFF, 0xBE, 0xA5, 0xFB },
-  { "NOP                             ", 0xEDE7, 0xB8, 0xFF, 0xBE, 0xA5, 0xFB },
-  { "NOP                             ", 0xEDE8, 0xB8, 0xFF, 0xBE, 0xA5, 0xFB },
-  { "JSR $FADA                       ", 0xEDE9, 0xB8, 0xFF, 0xBE, 0xA5, 0xFB },
-  { "BVS $FAE6                       ", 0xFADA, 0xB8, 0xFF, 0xBE, 0xA5, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFADC, 0xB8, 0xFF, 0xBE, 0xA5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFADE, 0xB8, 0xFF, 0xBE, 0xA5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFAE0, 0xB8, 0xFF, 0xBE, 0xA5, 0xF9 },
-  { "CMP #$B8                        ", 0xFAE2, 0xB8, 0xFF, 0xBE, 0xA5, 0xF9 },
-  { "BEQ $FAE8                       ", 0xFAE4, 0xB8, 0xFF, 0xBE, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAE8, 0xB8, 0xFF, 0xBE, 0x27, 0xF9 },
-  { "LDA $0647 = 38                  ", 0xEDEC, 0xB8, 0xFF, 0xBE, 0x27, 0xFB },
-  { "CMP #$38                        ", 0xEDEF, 0x38, 0xFF, 0xBE, 0x25, 0xFB },
-  { "BEQ $EDF5                       ", 0xEDF1, 0x38, 0xFF, 0xBE, 0x27, 0xFB },
-  { "RTS                             ", 0xEDF5, 0x38, 0xFF, 0xBE, 0x27, 0xFB },
-  { "JSR $EDF6                       ", 0xC641, 0x38, 0xFF, 0xBE, 0x27, 0xFD },
-  { "LDA #$FF                        ", 0xEDF6, 0x38, 0xFF, 0xBE, 0x27, 0xFB },
-  { "STA $01 = FF                    ", 0xEDF8, 0xFF, 0xFF, 0xBE, 0xA5, 0xFB },
-  { "LDY #$BF                        ", 0xEDFA, 0xFF, 0xFF, 0xBE, 0xA5, 0xFB },
-  { "LDX #$02                        ", 0xEDFC, 0xFF, 0xFF, 0xBF, 0xA5, 0xFB },
-  { "LDA #$47                        ", 0xEDFE, 0xFF, 0x02, 0xBF, 0x25, 0xFB },
-  { "STA $47 = 38                    ", 0xEE00, 0x47, 0x02, 0xBF, 0x25, 0xFB },
-  { "LDA #$06                        ", 0xEE02, 0x47, 0x02, 0xBF, 0x25, 0xFB },
-  { "STA $48 = 06                    ", 0xEE04, 0x06, 0x02, 0xBF, 0x25, 0xFB },
-  { "LDA #$A5                        ", 0xEE06, 0x06, 0x02, 0xBF, 0x25, 0xFB },
-  { "STA $0647 = 38                  ", 0xEE08, 0xA5, 0x02, 0xBF, 0xA5, 0xFB },
-  { "JSR $FA7B                       ", 0xEE0B, 0xA5, 0x02, 0xBF, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA7B, 0xA5, 0x02, 0xBF, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFA7D, 0xA5, 0x02, 0xBF, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFA7E, 0xA5, 0x02, 0xBF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA80, 0xB3, 0x02, 0xBF, 0xE4, 0xF9 },
-  { "SLO ($45,X) @ 47 = 0647 = A5    ", 0xEE0E, 0xB3, 0x02, 0xBF, 0xE4, 0xFB },
-  { "NOP                             ", 0xEE10, 0xFB, 0x02, 0xBF, 0xE5, 0xFB },
-  { "NOP                             ", 0xEE11, 0xFB, 0x02, 0xBF, 0xE5, 0xFB },
-  { "NOP                             ", 0xEE12, 0xFB, 0x02, 0xBF, 0xE5, 0xFB },
-  { "NOP                             ", 0xEE13, 0xFB, 0x02, 0xBF, 0xE5, 0xFB },
-  { "JSR $FA81                       ", 0xEE14, 0xFB, 0x02, 0xBF, 0xE5, 0xFB },
-  { "BVC $FAE6                       ", 0xFA81, 0xFB, 0x02, 0xBF, 0xE5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFA83, 0xFB, 0x02, 0xBF, 0xE5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA85, 0xFB, 0x02, 0xBF, 0xE5, 0xF9 },
-  { "CMP #$FB                        ", 0xFA87, 0xFB, 0x02, 0xBF, 0xE5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA89, 0xFB, 0x02, 0xBF, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA8B, 0xFB, 0x02, 0xBF, 0x67, 0xF9 },
-  { "LDA $0647 = 4A                  ", 0xEE17, 0xFB, 0x02, 0xBF, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xEE1A, 0x4A, 0x02, 0xBF, 0x65, 0xFB },
-  { "BEQ $EE20                       ", 0xEE1C, 0x4A, 0x02, 0xBF, 0x67, 0xFB },
-  { "INY                             ", 0xEE20, 0x4A, 0x02, 0xBF, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xEE21, 0x4A, 0x02, 0xC0, 0xE5, 0xFB },
-  { "STA $0647 = 4A                  ", 0xEE23, 0x29, 0x02, 0xC0, 0x65, 0xFB },
-  { "JSR $FA8C                       ", 0xEE26, 0x29, 0x02, 0xC0, 0x65, 0xFB },
-  { "CLV                             ", 0xFA8C, 0x29, 0x02, 0xC0, 0x65, 0xF9 },
-  { "CLC                             ", 0xFA8D, 0x29, 0x02, 0xC0, 0x25, 0xF9 },
-  { "LDA #$C3                        ", 0xFA8E, 0x29, 0x02, 0xC0, 0x24, 0xF9 },
-  { "RTS                             ", 0xFA90, 0xC3, 0x02, 0xC0, 0xA4, 0xF9 },
-  { "SLO ($45,X) @ 47 = 0647 = 29    ", 0xEE29, 0xC3, 0x02, 0xC0, 0xA4, 0xFB },
-  { "NOP                             ", 0xEE2B, 0xD3, 0x02, 0xC0, 0xA4, 0xFB },
-  { "NOP                             ", 0xEE2C, 0xD3, 0x02, 0xC0, 0xA4, 0xFB },
-  { "NOP                             ", 0xEE2D, 0xD3, 0x02, 0xC0, 0xA4, 0xFB },
-  { "NOP                             ", 0xEE2E, 0xD3, 0x02, 0xC0, 0xA4, 0xFB },
-  { "JSR $FA91                       ", 0xEE2F, 0xD3, 0x02, 0xC0, 0xA4, 0xFB },
-  { "BVS $FAE6                       ", 0xFA91, 0xD3, 0x02, 0xC0, 0xA4, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA93, 0xD3, 0x02, 0xC0, 0xA4, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA95, 0xD3, 0x02, 0xC0, 0xA4, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA97, 0xD3, 0x02, 0xC0, 0xA4, 0xF9 },
-  { "CMP #$D3                        ", 0xFA99, 0xD3, 0x02, 0xC0, 0xA4, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA9B, 0xD3, 0x02, 0xC0, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA9D, 0xD3, 0x02, 0xC0, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xEE32, 0xD3, 0x02, 0xC0, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xEE35, 0x52, 0x02, 0xC0, 0x25, 0xFB },
-  { "BEQ $EE3B                       ", 0xEE37, 0x52, 0x02, 0xC0, 0x27, 0xFB },
-  { "INY                             ", 0xEE3B, 0x52, 0x02, 0xC0, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEE3C, 0x52, 0x02, 0xC1, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xEE3E, 0x37, 0x02, 0xC1, 0x25, 0xFB },
-  { "JSR $FA9E                       ", 0xEE41, 0x37, 0x02, 0xC1, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA9E, 0x37, 0x02, 0xC1, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAA0, 0x37, 0x02, 0xC1, 0xE5, 0xF9 },
-  { "LDA #$10                        ", 0xFAA1, 0x37, 0x02, 0xC1, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAA3, 0x10, 0x02, 0xC1, 0x65, 0xF9 },
-  { "SLO ($45,X) @ 47 = 0647 = 37    ", 0xEE44, 0x10, 0x02, 0xC1, 0x65, 0xFB },
-  { "NOP                             ", 0xEE46, 0x7E, 0x02, 0xC1, 0x64, 0xFB },
-  { "NOP                             ", 0xEE47, 0x7E, 0x02, 0xC1, 0x64, 0xFB },
-  { "NOP                             ", 0xEE48, 0x7E, 0x02, 0xC1, 0x64, 0xFB },
-  { "NOP                             ", 0xEE49, 0x7E, 0x02, 0xC1, 0x64, 0xFB },
-  { "JSR $FAA4                       ", 0xEE4A, 0x7E, 0x02, 0xC1, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFAA4, 0x7E, 0x02, 0xC1, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAA6, 0x7E, 0x02, 0xC1, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFAA8, 0x7E, 0x02, 0xC1, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAAA, 0x7E, 0x02, 0xC1, 0x64, 0xF9 },
-  { "CMP #$7E                        ", 0xFAAC, 0x7E, 0x02, 0xC1, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAAE, 0x7E, 0x02, 0xC1, 0x67, 0xF9 },
-  { "RTS                             ", 0xFAB0, 0x7E, 0x02, 0xC1, 0x67, 0xF9 },
-  { "LDA $0647 = 6E                  ", 0xEE4D, 0x7E, 0x02, 0xC1, 0x67, 0xFB },
-  { "CMP #$6E                        ", 0xEE50, 0x6E, 0x02, 0xC1, 0x65, 0xFB },
-  { "BEQ $EE56                       ", 0xEE52, 0x6E, 0x02, 0xC1, 0x67, 0xFB },
-  { "INY                             ", 0xEE56, 0x6E, 0x02, 0xC1, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xEE57, 0x6E, 0x02, 0xC2, 0xE5, 0xFB },
-  { "STA $47 = 47                    ", 0xEE59, 0xA5, 0x02, 0xC2, 0xE5, 0xFB },
-  { "JSR $FA7B                       ", 0xEE5B, 0xA5, 0x02, 0xC2, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA7B, 0xA5, 0x02, 0xC2, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA7D, 0xA5, 0x02, 0xC2, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFA7E, 0xA5, 0x02, 0xC2, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA80, 0xB3, 0x02, 0xC2, 0xE4, 0xF9 },
-  { "SLO $47 = A5                    ", 0xEE5E, 0xB3, 0x02, 0xC2, 0xE4, 0xFB },
-  { "NOP                             ", 0xEE60, 0xFB, 0x02, 0xC2, 0xE5, 0xFB },
-  { "NOP                             ", 0xEE61, 0xFB, 0x02, 0xC2, 0xE5, 0xFB },
-  { "NOP                             ", 0xEE62, 0xFB, 0x02, 0xC2, 0xE5, 0xFB },
-  { "NOP                             ", 0xEE63, 0xFB, 0x02, 0xC2, 0xE5, 0xFB },
-  { "JSR $FA81                       ", 0xEE64, 0xFB, 0x02, 0xC2, 0xE5, 0xFB },
-  { "BVC $FAE6                       ", 0xFA81, 0xFB, 0x02, 0xC2, 0xE5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFA83, 0xFB, 0x02, 0xC2, 0xE5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA85, 0xFB, 0x02, 0xC2, 0xE5, 0xF9 },
-  { "CMP #$FB                        ", 0xFA87, 0xFB, 0x02, 0xC2, 0xE5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA89, 0xFB, 0x02, 0xC2, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA8B, 0xFB, 0x02, 0xC2, 0x67, 0xF9 },
-  { "LDA $47 = 4A                    ", 0xEE67, 0xFB, 0x02, 0xC2, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xEE69, 0x4A, 0x02, 0xC2, 0x65, 0xFB },
-  { "BEQ $EE6F                       ", 0xEE6B, 0x4A, 0x02, 0xC2, 0x67, 0xFB },
-  { "INY                             ", 0xEE6F, 0x4A, 0x02, 0xC2, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xEE70, 0x4A, 0x02, 0xC3, 0xE5, 0xFB },
-  { "STA $47 = 4A                    ", 0xEE72, 0x29, 0x02, 0xC3, 0x65, 0xFB },
-  { "JSR $FA8C                       ", 0xEE74, 0x29, 0x02, 0xC3, 0x65, 0xFB },
-  { "CLV                             ", 0xFA8C, 0x29, 0x02, 0xC3, 0x65, 0xF9 },
-  { "CLC                             ", 0xFA8D, 0x29, 0x02, 0xC3, 0x25, 0xF9 },
-  { "LDA #$C3                        ", 0xFA8E, 0x29, 0x02, 0xC3, 0x24, 0xF9 },
-  { "RTS                             ", 0xFA90, 0xC3, 0x02, 0xC3, 0xA4, 0xF9 },
-  { "SLO $47 = 29                    ", 0xEE77, 0xC3, 0x02, 0xC3, 0xA4, 0xFB },
-  { "NOP                             ", 0xEE79, 0xD3, 0x02, 0xC3, 0xA4, 0xFB },
-  { "NOP                             ", 0xEE7A, 0xD3, 0x02, 0xC3, 0xA4, 0xFB },
-  { "NOP                             ", 0xEE7B, 0xD3, 0x02, 0xC3, 0xA4, 0xFB },
-  { "NOP                             ", 0xEE7C, 0xD3, 0x02, 0xC3, 0xA4, 0xFB },
-  { "JSR $FA91                       ", 0xEE7D, 0xD3, 0x02, 0xC3, 0xA4, 0xFB },
-  { "BVS $FAE6                       ", 0xFA91, 0xD3, 0x02, 0xC3, 0xA4, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA93, 0xD3, 0x02, 0xC3, 0xA4, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA95, 0xD3, 0x02, 0xC3, 0xA4, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA97, 0xD3, 0x02, 0xC3, 0xA4, 0xF9 },
-  { "CMP #$D3                        ", 0xFA99, 0xD3, 0x02, 0xC3, 0xA4, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA9B, 0xD3, 0x02, 0xC3, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA9D, 0xD3, 0x02, 0xC3, 0x27, 0xF9 },
-  { "LDA $47 = 52                    ", 0xEE80, 0xD3, 0x02, 0xC3, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xEE82, 0x52, 0x02, 0xC3, 0x25, 0xFB },
-  { "BEQ $EE88                       ", 0xEE84, 0x52, 0x02, 0xC3, 0x27, 0xFB },
-  { "INY                             ", 0xEE88, 0x52, 0x02, 0xC3, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEE89, 0x52, 0x02, 0xC4, 0xA5, 0xFB },
-  { "STA $47 = 52                    ", 0xEE8B, 0x37, 0x02, 0xC4, 0x25, 0xFB },
-  { "JSR $FA9E                       ", 0xEE8D, 0x37, 0x02, 0xC4, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA9E, 0x37, 0x02, 0xC4, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAA0, 0x37, 0x02, 0xC4, 0xE5, 0xF9 },
-  { "LDA #$10                        ", 0xFAA1, 0x37, 0x02, 0xC4, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAA3, 0x10, 0x02, 0xC4, 0x65, 0xF9 },
-  { "SLO $47 = 37                    ", 0xEE90, 0x10, 0x02, 0xC4, 0x65, 0xFB },
-  { "NOP                             ", 0xEE92, 0x7E, 0x02, 0xC4, 0x64, 0xFB },
-  { "NOP                             ", 0xEE93, 0x7E, 0x02, 0xC4, 0x64, 0xFB },
-  { "NOP                             ", 0xEE94, 0x7E, 0x02, 0xC4, 0x64, 0xFB },
-  { "NOP                             ", 0xEE95, 0x7E, 0x02, 0xC4, 0x64, 0xFB },
-  { "JSR $FAA4                       ", 0xEE96, 0x7E, 0x02, 0xC4, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFAA4, 0x7E, 0x02, 0xC4, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAA6, 0x7E, 0x02, 0xC4, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFAA8, 0x7E, 0x02, 0xC4, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAAA, 0x7E, 0x02, 0xC4, 0x64, 0xF9 },
-  { "CMP #$7E                        ", 0xFAAC, 0x7E, 0x02, 0xC4, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAAE, 0x7E, 0x02, 0xC4, 0x67, 0xF9 },
-  { "RTS                             ", 0xFAB0, 0x7E, 0x02, 0xC4, 0x67, 0xF9 },
-  { "LDA $47 = 6E                    ", 0xEE99, 0x7E, 0x02, 0xC4, 0x67, 0xFB },
-  { "CMP #$6E                        ", 0xEE9B, 0x6E, 0x02, 0xC4, 0x65, 0xFB },
-  { "BEQ $EEA1                       ", 0xEE9D, 0x6E, 0x02, 0xC4, 0x67, 0xFB },
-  { "INY                             ", 0xEEA1, 0x6E, 0x02, 0xC4, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xEEA2, 0x6E, 0x02, 0xC5, 0xE5, 0xFB },
-  { "STA $0647 = 6E                  ", 0xEEA4, 0xA5, 0x02, 0xC5, 0xE5, 0xFB },
-  { "JSR $FA7B                       ", 0xEEA7, 0xA5, 0x02, 0xC5, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA7B, 0xA5, 0x02, 0xC5, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA7D, 0xA5, 0x02, 0xC5, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFA7E, 0xA5, 0x02, 0xC5, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA80, 0xB3, 0x02, 0xC5, 0xE4, 0xF9 },
-  { "SLO $0647 = A5                  ", 0xEEAA, 0xB3, 0x02, 0xC5, 0xE4, 0xFB },
-  { "NOP                             ", 0xEEAD, 0xFB, 0x02, 0xC5, 0xE5, 0xFB },
-  { "NOP                             ", 0xEEAE, 0xFB, 0x02, 0xC5, 0xE5, 0xFB },
-  { "NOP                             ", 0xEEAF, 0xFB, 0x02, 0xC5, 0xE5, 0xFB },
-  { "NOP                             ", 0xEEB0, 0xFB, 0x02, 0xC5, 0xE5, 0xFB },
-  { "JSR $FA81                       ", 0xEEB1, 0xFB, 0x02, 0xC5, 0xE5, 0xFB },
-  { "BVC $FAE6                       ", 0xFA81, 0xFB, 0x02, 0xC5, 0xE5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFA83, 0xFB, 0x02, 0xC5, 0xE5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA85, 0xFB, 0x02, 0xC5, 0xE5, 0xF9 },
-  { "CMP #$FB                        ", 0xFA87, 0xFB, 0x02, 0xC5, 0xE5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA89, 0xFB, 0x02, 0xC5, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA8B, 0xFB, 0x02, 0xC5, 0x67, 0xF9 },
-  { "LDA $0647 = 4A                  ", 0xEEB4, 0xFB, 0x02, 0xC5, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xEEB7, 0x4A, 0x02, 0xC5, 0x65, 0xFB },
-  { "BEQ $EEBD                       ", 0xEEB9, 0x4A, 0x02, 0xC5, 0x67, 0xFB },
-  { "INY                             ", 0xEEBD, 0x4A, 0x02, 0xC5, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xEEBE, 0x4A, 0x02, 0xC6, 0xE5, 0xFB },
-  { "STA $0647 = 4A                  ", 0xEEC0, 0x29, 0x02, 0xC6, 0x65, 0xFB },
-  { "JSR $FA8C                       ", 0xEEC3, 0x29, 0x02, 0xC6, 0x65, 0xFB },
-  { "CLV                             ", 0xFA8C, 0x29, 0x02, 0xC6, 0x65, 0xF9 },
-  { "CLC                             ", 0xFA8D, 0x29, 0x02, 0xC6, 0x25, 0xF9 },
-  { "LDA #$C3                        ", 0xFA8E, 0x29, 0x02, 0xC6, 0x24, 0xF9 },
-  { "RTS                             ", 0xFA90, 0xC3, 0x02, 0xC6, 0xA4, 0xF9 },
-  { "SLO $0647 = 29                  ", 0xEEC6, 0xC3, 0x02, 0xC6, 0xA4, 0xFB },
-  { "NOP                             ", 0xEEC9, 0xD3, 0x02, 0xC6, 0xA4, 0xFB },
-  { "NOP                             ", 0xEECA, 0xD3, 0x02, 0xC6, 0xA4, 0xFB },
-  { "NOP                             ", 0xEECB, 0xD3, 0x02, 0xC6, 0xA4, 0xFB },
-  { "NOP                             ", 0xEECC, 0xD3, 0x02, 0xC6, 0xA4, 0xFB },
-  { "JSR $FA91                       ", 0xEECD, 0xD3, 0x02, 0xC6, 0xA4, 0xFB },
-  { "BVS $FAE6                       ", 0xFA91, 0xD3, 0x02, 0xC6, 0xA4, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA93, 0xD3, 0x02, 0xC6, 0xA4, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA95, 0xD3, 0x02, 0xC6, 0xA4, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA97, 0xD3, 0x02, 0xC6, 0xA4, 0xF9 },
-  { "CMP #$D3                        ", 0xFA99, 0xD3, 0x02, 0xC6, 0xA4, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA9B, 0xD3, 0x02, 0xC6, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA9D, 0xD3, 0x02, 0xC6, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xEED0, 0xD3, 0x02, 0xC6, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xEED3, 0x52, 0x02, 0xC6, 0x25, 0xFB },
-  { "BEQ $EED9                       ", 0xEED5, 0x52, 0x02, 0xC6, 0x27, 0xFB },
-  { "INY                             ", 0xEED9, 0x52, 0x02, 0xC6, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEEDA, 0x52, 0x02, 0xC7, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xEEDC, 0x37, 0x02, 0xC7, 0x25, 0xFB },
-  { "JSR $FA9E                       ", 0xEEDF, 0x37, 0x02, 0xC7, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA9E, 0x37, 0x02, 0xC7, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAA0, 0x37, 0x02, 0xC7, 0xE5, 0xF9 },
-  { "LDA #$10                        ", 0xFAA1, 0x37, 0x02, 0xC7, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAA3, 0x10, 0x02, 0xC7, 0x65, 0xF9 },
-  { "SLO $0647 = 37                  ", 0xEEE2, 0x10, 0x02, 0xC7, 0x65, 0xFB },
-  { "NOP                             ", 0xEEE5, 0x7E, 0x02, 0xC7, 0x64, 0xFB },
-  { "NOP                             ", 0xEEE6, 0x7E, 0x02, 0xC7, 0x64, 0xFB },
-  { "NOP                             ", 0xEEE7, 0x7E, 0x02, 0xC7, 0x64, 0xFB },
-  { "NOP                             ", 0xEEE8, 0x7E, 0x02, 0xC7, 0x64, 0xFB },
-  { "JSR $FAA4                       ", 0xEEE9, 0x7E, 0x02, 0xC7, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFAA4, 0x7E, 0x02, 0xC7, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAA6, 0x7E, 0x02, 0xC7, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFAA8, 0x7E, 0x02, 0xC7, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAAA, 0x7E, 0x02, 0xC7, 0x64, 0xF9 },
-  { "CMP #$7E                        ", 0xFAAC, 0x7E, 0x02, 0xC7, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAAE, 0x7E, 0x02, 0xC7, 0x67, 0xF9 },
-  { "RTS                             ", 0xFAB0, 0x7E, 0x02, 0xC7, 0x67, 0xF9 },
-  { "LDA $0647 = 6E                  ", 0xEEEC, 0x7E, 0x02, 0xC7, 0x67, 0xFB },
-  { "CMP #$6E                        ", 0xEEEF, 0x6E, 0x02, 0xC7, 0x65, 0xFB },
-  { "BEQ $EEF5                       ", 0xEEF1, 0x6E, 0x02, 0xC7, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xEEF5, 0x6E, 0x02, 0xC7, 0x67, 0xFB },
-  { "STA $0647 = 6E                  ", 0xEEF7, 0xA5, 0x02, 0xC7, 0xE5, 0xFB },
-  { "LDA #$48                        ", 0xEEFA, 0xA5, 0x02, 0xC7, 0xE5, 0xFB },
-  { "STA $45 = 48                    ", 0xEEFC, 0x48, 0x02, 0xC7, 0x65, 0xFB },
-  { "LDA #$05                        ", 0xEEFE, 0x48, 0x02, 0xC7, 0x65, 0xFB },
-  { "STA $46 = 05                    ", 0xEF00, 0x05, 0x02, 0xC7, 0x65, 0xFB },
-  { "LDY #$FF                        ", 0xEF02, 0x05, 0x02, 0xC7, 0x65, 0xFB },
-  { "JSR $FA7B                       ", 0xEF04, 0x05, 0x02, 0xFF, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA7B, 0x05, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA7D, 0x05, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFA7E, 0x05, 0x02, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA80, 0xB3, 0x02, 0xFF, 0xE4, 0xF9 },
-  { "SLO ($45),Y = 0548 @ 0647 = A5  ", 0xEF07, 0xB3, 0x02, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xEF09, 0xFB, 0x02, 0xFF, 0xE5, 0xFB },
-  { "NOP                             ", 0xEF0A, 0xFB, 0x02, 0xFF, 0xE5, 0xFB },
-  { "PHP                             ", 0xEF0B, 0xFB, 0x02, 0xFF, 0xE5, 0xFB },
-  { "PHA                             ", 0xEF0C, 0xFB, 0x02, 0xFF, 0xE5, 0xFA },
-  { "LDY #$C8                        ", 0xEF0D, 0xFB, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "PLA                             ", 0xEF0F, 0xFB, 0x02, 0xC8, 0xE5, 0xF9 },
-  { "PLP                             ", 0xEF10, 0xFB, 0x02, 0xC8, 0xE5, 0xFA },
-  { "JSR $FA81                       ", 0xEF11, 0xFB, 0x02, 0xC8, 0xE5, 0xFB },
-  { "BVC $FAE6                       ", 0xFA81, 0xFB, 0x02, 0xC8, 0xE5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFA83, 0xFB, 0x02, 0xC8, 0xE5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA85, 0xFB, 0x02, 0xC8, 0xE5, 0xF9 },
-  { "CMP #$FB                        ", 0xFA87, 0xFB, 0x02, 0xC8, 0xE5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA89, 0xFB, 0x02, 0xC8, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA8B, 0xFB, 0x02, 0xC8, 0x67, 0xF9 },
-  { "LDA $0647 = 4A                  ", 0xEF14, 0xFB, 0x02, 0xC8, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xEF17, 0x4A, 0x02, 0xC8, 0x65, 0xFB },
-  { "BEQ $EF1D                       ", 0xEF19, 0x4A, 0x02, 0xC8, 0x67, 0xFB },
-  { "LDY #$FF                        ", 0xEF1D, 0x4A, 0x02, 0xC8, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xEF1F, 0x4A, 0x02, 0xFF, 0xE5, 0xFB },
-  { "STA $0647 = 4A                  ", 0xEF21, 0x29, 0x02, 0xFF, 0x65, 0xFB },
-  { "JSR $FA8C                       ", 0xEF24, 0x29, 0x02, 0xFF, 0x65, 0xFB },
-  { "CLV                             ", 0xFA8C, 0x29, 0x02, 0xFF, 0x65, 0xF9 },
-  { "CLC                             ", 0xFA8D, 0x29, 0x02, 0xFF, 0x25, 0xF9 },
-  { "LDA #$C3                        ", 0xFA8E, 0x29, 0x02, 0xFF, 0x24, 0xF9 },
-  { "RTS                             ", 0xFA90, 0xC3, 0x02, 0xFF, 0xA4, 0xF9 },
-  { "SLO ($45),Y = 0548 @ 0647 = 29  ", 0xEF27, 0xC3, 0x02, 0xFF, 0xA4, 0xFB },
-  { "NOP                             ", 0xEF29, 0xD3, 0x02, 0xFF, 0xA4, 0xFB },
-  { "NOP                             ", 0xEF2A, 0xD3, 0x02, 0xFF, 0xA4, 0xFB },
-  { "PHP                             ", 0xEF2B, 0xD3, 0x02, 0xFF, 0xA4, 0xFB },
-  { "PHA                             ", 0xEF2C, 0xD3, 0x02, 0xFF, 0xA4, 0xFA },
-  { "LDY #$C9                        ", 0xEF2D, 0xD3, 0x02, 0xFF, 0xA4, 0xF9 },
-  { "PLA                             ", 0xEF2F, 0xD3, 0x02, 0xC9, 0xA4, 0xF9 },
-  { "PLP                             ", 0xEF30, 0xD3, 0x02, 0xC9, 0xA4, 0xFA },
-  { "JSR $FA91                       ", 0xEF31, 0xD3, 0x02, 0xC9, 0xA4, 0xFB },
-  { "BVS $FAE6                       ", 0xFA91, 0xD3, 0x02, 0xC9, 0xA4, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA93, 0xD3, 0x02, 0xC9, 0xA4, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA95, 0xD3, 0x02, 0xC9, 0xA4, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA97, 0xD3, 0x02, 0xC9, 0xA4, 0xF9 },
-  { "CMP #$D3                        ", 0xFA99, 0xD3, 0x02, 0xC9, 0xA4, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA9B, 0xD3, 0x02, 0xC9, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA9D, 0xD3, 0x02, 0xC9, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xEF34, 0xD3, 0x02, 0xC9, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xEF37, 0x52, 0x02, 0xC9, 0x25, 0xFB },
-  { "BEQ $EF3D                       ", 0xEF39, 0x52, 0x02, 0xC9, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xEF3D, 0x52, 0x02, 0xC9, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEF3F, 0x52, 0x02, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xEF41, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "JSR $FA9E                       ", 0xEF44, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA9E, 0x37, 0x02, 0xFF, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAA0, 0x37, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$10                        ", 0xFAA1, 0x37, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAA3, 0x10, 0x02, 0xFF, 0x65, 0xF9 },
-  { "SLO ($45),Y = 0548 @ 0647 = 37  ", 0xEF47, 0x10, 0x02, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xEF49, 0x7E, 0x02, 0xFF, 0x64, 0xFB },
-  { "NOP                             ", 0xEF4A, 0x7E, 0x02, 0xFF, 0x64, 0xFB },
-  { "PHP                             ", 0xEF4B, 0x7E, 0x02, 0xFF, 0x64, 0xFB },
-  { "PHA                             ", 0xEF4C, 0x7E, 0x02, 0xFF, 0x64, 0xFA },
-  { "LDY #$CA                        ", 0xEF4D, 0x7E, 0x02, 0xFF, 0x64, 0xF9 },
-  { "PLA                             ", 0xEF4F, 0x7E, 0x02, 0xCA, 0xE4, 0xF9 },
-  { "PLP                             ", 0xEF50, 0x7E, 0x02, 0xCA, 0x64, 0xFA },
-  { "JSR $FAA4                       ", 0xEF51, 0x7E, 0x02, 0xCA, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFAA4, 0x7E, 0x02, 0xCA, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAA6, 0x7E, 0x02, 0xCA, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFAA8, 0x7E, 0x02, 0xCA, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAAA, 0x7E, 0x02, 0xCA, 0x64, 0xF9 },
-  { "CMP #$7E                        ", 0xFAAC, 0x7E, 0x02, 0xCA, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAAE, 0x7E, 0x02, 0xCA, 0x67, 0xF9 },
-  { "RTS                             ", 0xFAB0, 0x7E, 0x02, 0xCA, 0x67, 0xF9 },
-  { "LDA $0647 = 6E                  ", 0xEF54, 0x7E, 0x02, 0xCA, 0x67, 0xFB },
-  { "CMP #$6E                        ", 0xEF57, 0x6E, 0x02, 0xCA, 0x65, 0xFB },
-  { "BEQ $EF5D                       ", 0xEF59, 0x6E, 0x02, 0xCA, 0x67, 0xFB },
-  { "LDY #$CB                        ", 0xEF5D, 0x6E, 0x02, 0xCA, 0x67, 0xFB },
-  { "LDX #$FF                        ", 0xEF5F, 0x6E, 0x02, 0xCB, 0xE5, 0xFB },
-  { "LDA #$A5                        ", 0xEF61, 0x6E, 0xFF, 0xCB, 0xE5, 0xFB },
-  { "STA $47 = 6E                    ", 0xEF63, 0xA5, 0xFF, 0xCB, 0xE5, 0xFB },
-  { "JSR $FA7B                       ", 0xEF65, 0xA5, 0xFF, 0xCB, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA7B, 0xA5, 0xFF, 0xCB, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA7D, 0xA5, 0xFF, 0xCB, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFA7E, 0xA5, 0xFF, 0xCB, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA80, 0xB3, 0xFF, 0xCB, 0xE4, 0xF9 },
-  { "SLO $48,X @ 47 = A5             ", 0xEF68, 0xB3, 0xFF, 0xCB, 0xE4, 0xFB },
-  { "NOP                             ", 0xEF6A, 0xFB, 0xFF, 0xCB, 0xE5, 0xFB },
-  { "NOP                             ", 0xEF6B, 0xFB, 0xFF, 0xCB, 0xE5, 0xFB },
-  { "NOP                             ", 0xEF6C, 0xFB, 0xFF, 0xCB, 0xE5, 0xFB },
-  { "NOP                             ", 0xEF6D, 0xFB, 0xFF, 0xCB, 0xE5, 0xFB },
-  { "JSR $FA81                       ", 0xEF6E, 0xFB, 0xFF, 0xCB, 0xE5, 0xFB },
-  { "BVC $FAE6                       ", 0xFA81, 0xFB, 0xFF, 0xCB, 0xE5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFA83, 0xFB, 0xFF, 0xCB, 0xE5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA85, 0xFB, 0xFF, 0xCB, 0xE5, 0xF9 },
-  { "CMP #$FB                        ", 0xFA87, 0xFB, 0xFF, 0xCB, 0xE5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA89, 0xFB, 0xFF, 0xCB, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA8B, 0xFB, 0xFF, 0xCB, 0x67, 0xF9 },
-  { "LDA $47 = 4A                    ", 0xEF71, 0xFB, 0xFF, 0xCB, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xEF73, 0x4A, 0xFF, 0xCB, 0x65, 0xFB },
-  { "BEQ $EF79                       ", 0xEF75, 0x4A, 0xFF, 0xCB, 0x67, 0xFB },
-  { "INY                             ", 0xEF79, 0x4A, 0xFF, 0xCB, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xEF7A, 0x4A, 0xFF, 0xCC, 0xE5, 0xFB },
-  { "STA $47 = 4A                    ", 0xEF7C, 0x29, 0xFF, 0xCC, 0x65, 0xFB },
-  { "JSR $FA8C                       ", 0xEF7E, 0x29, 0xFF, 0xCC, 0x65, 0xFB },
-  { "CLV                             ", 0xFA8C, 0x29, 0xFF, 0xCC, 0x65, 0xF9 },
-  { "CLC                             ", 0xFA8D, 0x29, 0xFF, 0xCC, 0x25, 0xF9 },
-  { "LDA #$C3                        ", 0xFA8E, 0x29, 0xFF, 0xCC, 0x24, 0xF9 },
-  { "RTS                             ", 0xFA90, 0xC3, 0xFF, 0xCC, 0xA4, 0xF9 },
-  { "SLO $48,X @ 47 = 29             ", 0xEF81, 0xC3, 0xFF, 0xCC, 0xA4, 0xFB },
-  { "NOP                             ", 0xEF83, 0xD3, 0xFF, 0xCC, 0xA4, 0xFB },
-  { "NOP                             ", 0xEF84, 0xD3, 0xFF, 0xCC, 0xA4, 0xFB },
-  { "NOP                             ", 0xEF85, 0xD3, 0xFF, 0xCC, 0xA4, 0xFB },
-  { "NOP                             ", 0xEF86, 0xD3, 0xFF, 0xCC, 0xA4, 0xFB },
-  { "JSR $FA91                       ", 0xEF87, 0xD3, 0xFF, 0xCC, 0xA4, 0xFB },
-  { "BVS $FAE6                       ", 0xFA91, 0xD3, 0xFF, 0xCC, 0xA4, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA93, 0xD3, 0xFF, 0xCC, 0xA4, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA95, 0xD3, 0xFF, 0xCC, 0xA4, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA97, 0xD3, 0xFF, 0xCC, 0xA4, 0xF9 },
-  { "CMP #$D3                        ", 0xFA99, 0xD3, 0xFF, 0xCC, 0xA4, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA9B, 0xD3, 0xFF, 0xCC, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA9D, 0xD3, 0xFF, 0xCC, 0x27, 0xF9 },
-  { "LDA $47 = 52                    ", 0xEF8A, 0xD3, 0xFF, 0xCC, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xEF8C, 0x52, 0xFF, 0xCC, 0x25, 0xFB },
-  { "BEQ $EF92                       ", 0xEF8E, 0x52, 0xFF, 0xCC, 0x27, 0xFB },
-  { "INY                             ", 0xEF92, 0x52, 0xFF, 0xCC, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEF93, 0x52, 0xFF, 0xCD, 0xA5, 0xFB },
-  { "STA $47 = 52                    ", 0xEF95, 0x37, 0xFF, 0xCD, 0x25, 0xFB },
-  { "JSR $FA9E                       ", 0xEF97, 0x37, 0xFF, 0xCD, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA9E, 0x37, 0xFF, 0xCD, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAA0, 0x37, 0xFF, 0xCD, 0xE5, 0xF9 },
-  { "LDA #$10                        ", 0xFAA1, 0x37, 0xFF, 0xCD, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAA3, 0x10, 0xFF, 0xCD, 0x65, 0xF9 },
-  { "SLO $48,X @ 47 = 37             ", 0xEF9A, 0x10, 0xFF, 0xCD, 0x65, 0xFB },
-  { "NOP                             ", 0xEF9C, 0x7E, 0xFF, 0xCD, 0x64, 0xFB },
-  { "NOP                             ", 0xEF9D, 0x7E, 0xFF, 0xCD, 0x64, 0xFB },
-  { "NOP                             ", 0xEF9E, 0x7E, 0xFF, 0xCD, 0x64, 0xFB },
-  { "NOP                             ", 0xEF9F, 0x7E, 0xFF, 0xCD, 0x64, 0xFB },
-  { "JSR $FAA4                       ", 0xEFA0, 0x7E, 0xFF, 0xCD, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFAA4, 0x7E, 0xFF, 0xCD, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAA6, 0x7E, 0xFF, 0xCD, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFAA8, 0x7E, 0xFF, 0xCD, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAAA, 0x7E, 0xFF, 0xCD, 0x64, 0xF9 },
-  { "CMP #$7E                        ", 0xFAAC, 0x7E, 0xFF, 0xCD, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAAE, 0x7E, 0xFF, 0xCD, 0x67, 0xF9 },
-  { "RTS                             ", 0xFAB0, 0x7E, 0xFF, 0xCD, 0x67, 0xF9 },
-  { "LDA $47 = 6E                    ", 0xEFA3, 0x7E, 0xFF, 0xCD, 0x67, 0xFB },
-  { "CMP #$6E                        ", 0xEFA5, 0x6E, 0xFF, 0xCD, 0x65, 0xFB },
-  { "BEQ $EFAB                       ", 0xEFA7, 0x6E, 0xFF, 0xCD, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xEFAB, 0x6E, 0xFF, 0xCD, 0x67, 0xFB },
-  { "STA $0647 = 6E                  ", 0xEFAD, 0xA5, 0xFF, 0xCD, 0xE5, 0xFB },
-  { "LDY #$FF                        ", 0xEFB0, 0xA5, 0xFF, 0xCD, 0xE5, 0xFB },
-  { "JSR $FA7B                       ", 0xEFB2, 0xA5, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA7B, 0xA5, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA7D, 0xA5, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFA7E, 0xA5, 0xFF, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA80, 0xB3, 0xFF, 0xFF, 0xE4, 0xF9 },
-  { "SLO $0548,Y @ 0647 = A5         ", 0xEFB5, 0xB3, 0xFF, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xEFB8, 0xFB, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "NOP                             ", 0xEFB9, 0xFB, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "PHP                             ", 0xEFBA, 0xFB, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "PHA                             ", 0xEFBB, 0xFB, 0xFF, 0xFF, 0xE5, 0xFA },
-  { "LDY #$CE                        ", 0xEFBC, 0xFB, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "PLA                             ", 0xEFBE, 0xFB, 0xFF, 0xCE, 0xE5, 0xF9 },
-  { "PLP                             ", 0xEFBF, 0xFB, 0xFF, 0xCE, 0xE5, 0xFA },
-  { "JSR $FA81                       ", 0xEFC0, 0xFB, 0xFF, 0xCE, 0xE5, 0xFB },
-  { "BVC $FAE6                       ", 0xFA81, 0xFB, 0xFF, 0xCE, 0xE5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFA83, 0xFB, 0xFF, 0xCE, 0xE5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA85, 0xFB, 0xFF, 0xCE, 0xE5, 0xF9 },
-  { "CMP #$FB                        ", 0xFA87, 0xFB, 0xFF, 0xCE, 0xE5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA89, 0xFB, 0xFF, 0xCE, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA8B, 0xFB, 0xFF, 0xCE, 0x67, 0xF9 },
-  { "LDA $0647 = 4A                  ", 0xEFC3, 0xFB, 0xFF, 0xCE, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xEFC6, 0x4A, 0xFF, 0xCE, 0x65, 0xFB },
-  { "BEQ $EFCC                       ", 0xEFC8, 0x4A, 0xFF, 0xCE, 0x67, 0xFB },
-  { "LDY #$FF                        ", 0xEFCC, 0x4A, 0xFF, 0xCE, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xEFCE, 0x4A, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "STA $0647 = 4A                  ", 0xEFD0, 0x29, 0xFF, 0xFF, 0x65, 0xFB },
-  { "JSR $FA8C                       ", 0xEFD3, 0x29, 0xFF, 0xFF, 0x65, 0xFB },
-  { "CLV                             ", 0xFA8C, 0x29, 0xFF, 0xFF, 0x65, 0xF9 },
-  { "CLC                             ", 0xFA8D, 0x29, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "LDA #$C3                        ", 0xFA8E, 0x29, 0xFF, 0xFF, 0x24, 0xF9 },
-  { "RTS                             ", 0xFA90, 0xC3, 0xFF, 0xFF, 0xA4, 0xF9 },
-  { "SLO $0548,Y @ 0647 = 29         ", 0xEFD6, 0xC3, 0xFF, 0xFF, 0xA4, 0xFB },
-  { "NOP                             ", 0xEFD9, 0xD3, 0xFF, 0xFF, 0xA4, 0xFB },
-  { "NOP                             ", 0xEFDA, 0xD3, 0xFF, 0xFF, 0xA4, 0xFB },
-  { "PHP                             ", 0xEFDB, 0xD3, 0xFF, 0xFF, 0xA4, 0xFB },
-  { "PHA                             ", 0xEFDC, 0xD3, 0xFF, 0xFF, 0xA4, 0xFA },
-  { "LDY #$CF                        ", 0xEFDD, 0xD3, 0xFF, 0xFF, 0xA4, 0xF9 },
-  { "PLA                             ", 0xEFDF, 0xD3, 0xFF, 0xCF, 0xA4, 0xF9 },
-  { "PLP                             ", 0xEFE0, 0xD3, 0xFF, 0xCF, 0xA4, 0xFA },
-  { "JSR $FA91                       ", 0xEFE1, 0xD3, 0xFF, 0xCF, 0xA4, 0xFB },
-  { "BVS $FAE6                       ", 0xFA91, 0xD3, 0xFF, 0xCF, 0xA4, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA93, 0xD3, 0xFF, 0xCF, 0xA4, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA95, 0xD3, 0xFF, 0xCF, 0xA4, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA97, 0xD3, 0xFF, 0xCF, 0xA4, 0xF9 },
-  { "CMP #$D3                        ", 0xFA99, 0xD3, 0xFF, 0xCF, 0xA4, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA9B, 0xD3, 0xFF, 0xCF, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA9D, 0xD3, 0xFF, 0xCF, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xEFE4, 0xD3, 0xFF, 0xCF, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xEFE7, 0x52, 0xFF, 0xCF, 0x25, 0xFB },
-  { "BEQ $EFED                       ", 0xEFE9, 0x52, 0xFF, 0xCF, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xEFED, 0x52, 0xFF, 0xCF, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xEFEF, 0x52, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xEFF1, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "JSR $FA9E                       ", 0xEFF4, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA9E, 0x37, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAA0, 0x37, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$10                        ", 0xFAA1, 0x37, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAA3, 0x10, 0xFF, 0xFF, 0x65, 0xF9 },
-  { "SLO $0548,Y @ 0647 = 37         ", 0xEFF7, 0x10, 0xFF, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xEFFA, 0x7E, 0xFF, 0xFF, 0x64, 0xFB },
-  { "NOP                             ", 0xEFFB, 0x7E, 0xFF, 0xFF, 0x64, 0xFB },
-  { "PHP                             ", 0xEFFC, 0x7E, 0xFF, 0xFF, 0x64, 0xFB },
-  { "PHA                             ", 0xEFFD, 0x7E, 0xFF, 0xFF, 0x64, 0xFA },
-  { "LDY #$D0                        ", 0xEFFE, 0x7E, 0xFF, 0xFF, 0x64, 0xF9 },
-  { "PLA                             ", 0xF000, 0x7E, 0xFF, 0xD0, 0xE4, 0xF9 },
-  { "PLP                             ", 0xF001, 0x7E, 0xFF, 0xD0, 0x64, 0xFA },
-  { "JSR $FAA4                       ", 0xF002, 0x7E, 0xFF, 0xD0, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFAA4, 0x7E, 0xFF, 0xD0, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAA6, 0x7E, 0xFF, 0xD0, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFAA8, 0x7E, 0xFF, 0xD0, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAAA, 0x7E, 0xFF, 0xD0, 0x64, 0xF9 },
-  { "CMP #$7E                        ", 0xFAAC, 0x7E, 0xFF, 0xD0, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAAE, 0x7E, 0xFF, 0xD0, 0x67, 0xF9 },
-  { "RTS                             ", 0xFAB0, 0x7E, 0xFF, 0xD0, 0x67, 0xF9 },
-  { "LDA $0647 = 6E                  ", 0xF005, 0x7E, 0xFF, 0xD0, 0x67, 0xFB },
-  { "CMP #$6E                        ", 0xF008, 0x6E, 0xFF, 0xD0, 0x65, 0xFB },
-  { "BEQ $F00E                       ", 0xF00A, 0x6E, 0xFF, 0xD0, 0x67, 0xFB },
-  { "LDY #$D1                        ", 0xF00E, 0x6E, 0xFF, 0xD0, 0x67, 0xFB },
-  { "LDX #$FF                        ", 0xF010, 0x6E, 0xFF, 0xD1, 0xE5, 0xFB },
-  { "LDA #$A5                        ", 0xF012, 0x6E, 0xFF, 0xD1, 0xE5, 0xFB },
-  { "STA $0647 = 6E                  ", 0xF014, 0xA5, 0xFF, 0xD1, 0xE5, 0xFB },
-  { "JSR $FA7B                       ", 0xF017, 0xA5, 0xFF, 0xD1, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA7B, 0xA5, 0xFF, 0xD1, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFA7D, 0xA5, 0xFF, 0xD1, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFA7E, 0xA5, 0xFF, 0xD1, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFA80, 0xB3, 0xFF, 0xD1, 0xE4, 0xF9 },
-  { "SLO $0548,X @ 0647 = A5         ", 0xF01A, 0xB3, 0xFF, 0xD1, 0xE4, 0xFB },
-  { "NOP                             ", 0xF01D, 0xFB, 0xFF, 0xD1, 0xE5, 0xFB },
-  { "NOP                             ", 0xF01E, 0xFB, 0xFF, 0xD1, 0xE5, 0xFB },
-  { "NOP                             ", 0xF01F, 0xFB, 0xFF, 0xD1, 0xE5, 0xFB },
-  { "NOP                             ", 0xF020, 0xFB, 0xFF, 0xD1, 0xE5, 0xFB },
-  { "JSR $FA81                       ", 0xF021, 0xFB, 0xFF, 0xD1, 0xE5, 0xFB },
-  { "BVC $FAE6                       ", 0xFA81, 0xFB, 0xFF, 0xD1, 0xE5, 0xF9 },
-  { "BCC $FAE6                       ", 0xFA83, 0xFB, 0xFF, 0xD1, 0xE5, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA85, 0xFB, 0xFF, 0xD1, 0xE5, 0xF9 },
-  { "CMP #$FB                        ", 0xFA87, 0xFB, 0xFF, 0xD1, 0xE5, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA89, 0xFB, 0xFF, 0xD1, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA8B, 0xFB, 0xFF, 0xD1, 0x67, 0xF9 },
-  { "LDA $0647 = 4A                  ", 0xF024, 0xFB, 0xFF, 0xD1, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xF027, 0x4A, 0xFF, 0xD1, 0x65, 0xFB },
-  { "BEQ $F02D                       ", 0xF029, 0x4A, 0xFF, 0xD1, 0x67, 0xFB },
-  { "INY                             ", 0xF02D, 0x4A, 0xFF, 0xD1, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF02E, 0x4A, 0xFF, 0xD2, 0xE5, 0xFB },
-  { "STA $0647 = 4A                  ", 0xF030, 0x29, 0xFF, 0xD2, 0x65, 0xFB },
-  { "JSR $FA8C                       ", 0xF033, 0x29, 0xFF, 0xD2, 0x65, 0xFB },
-  { "CLV                             ", 0xFA8C, 0x29, 0xFF, 0xD2, 0x65, 0xF9 },
-  { "CLC                             ", 0xFA8D, 0x29, 0xFF, 0xD2, 0x25, 0xF9 },
-  { "LDA #$C3                        ", 0xFA8E, 0x29, 0xFF, 0xD2, 0x24, 0xF9 },
-  { "RTS                             ", 0xFA90, 0xC3, 0xFF, 0xD2, 0xA4, 0xF9 },
-  { "SLO $0548,X @ 0647 = 29         ", 0xF036, 0xC3, 0xFF, 0xD2, 0xA4, 0xFB },
-  { "NOP                             ", 0xF039, 0xD3, 0xFF, 0xD2, 0xA4, 0xFB },
-  { "NOP                             ", 0xF03A, 0xD3, 0xFF, 0xD2, 0xA4, 0xFB },
-  { "NOP                             ", 0xF03B, 0xD3, 0xFF, 0xD2, 0xA4, 0xFB },
-  { "NOP                             ", 0xF03C, 0xD3, 0xFF, 0xD2, 0xA4, 0xFB },
-  { "JSR $FA91                       ", 0xF03D, 0xD3, 0xFF, 0xD2, 0xA4, 0xFB },
-  { "BVS $FAE6                       ", 0xFA91, 0xD3, 0xFF, 0xD2, 0xA4, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA93, 0xD3, 0xFF, 0xD2, 0xA4, 0xF9 },
-  { "BPL $FAE6                       ", 0xFA95, 0xD3, 0xFF, 0xD2, 0xA4, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA97, 0xD3, 0xFF, 0xD2, 0xA4, 0xF9 },
-  { "CMP #$D3                        ", 0xFA99, 0xD3, 0xFF, 0xD2, 0xA4, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA9B, 0xD3, 0xFF, 0xD2, 0x27, 0xF9 },
-  { "RTS                             ", 0xFA9D, 0xD3, 0xFF, 0xD2, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF040, 0xD3, 0xFF, 0xD2, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF043, 0x52, 0xFF, 0xD2, 0x25, 0xFB },
-  { "BEQ $F049                       ", 0xF045, 0x52, 0xFF, 0xD2, 0x27, 0xFB },
-  { "INY                             ", 0xF049, 0x52, 0xFF, 0xD2, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF04A, 0x52, 0xFF, 0xD3, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF04C, 0x37, 0xFF, 0xD3, 0x25, 0xFB },
-  { "JSR $FA9E                       ", 0xF04F, 0x37, 0xFF, 0xD3, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA9E, 0x37, 0xFF, 0xD3, 0x25, 0xF9 },
-  { "SEC                             ", 0xFAA0, 0x37, 0xFF, 0xD3, 0xE5, 0xF9 },
-  { "LDA #$10                        ", 0xFAA1, 0x37, 0xFF, 0xD3, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFAA3, 0x10, 0xFF, 0xD3, 0x65, 0xF9 },
-  { "SLO $0548,X @ 0647 = 37         ", 0xF052, 0x10, 0xFF, 0xD3, 0x65, 0xFB },
-  { "NOP                             ", 0xF055, 0x7E, 0xFF, 0xD3, 0x64, 0xFB },
-  { "NOP                             ", 0xF056, 0x7E, 0xFF, 0xD3, 0x64, 0xFB },
-  { "NOP                             ", 0xF057, 0x7E, 0xFF, 0xD3, 0x64, 0xFB },
-  { "NOP                             ", 0xF058, 0x7E, 0xFF, 0xD3, 0x64, 0xFB },
-  { "JSR $FAA4                       ", 0xF059, 0x7E, 0xFF, 0xD3, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFAA4, 0x7E, 0xFF, 0xD3, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFAA6, 0x7E, 0xFF, 0xD3, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFAA8, 0x7E, 0xFF, 0xD3, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFAAA, 0x7E, 0xFF, 0xD3, 0x64, 0xF9 },
-  { "CMP #$7E                        ", 0xFAAC, 0x7E, 0xFF, 0xD3, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFAAE, 0x7E, 0xFF, 0xD3, 0x67, 0xF9 },
-  { "RTS                             ", 0xFAB0, 0x7E, 0xFF, 0xD3, 0x67, 0xF9 },
-  { "LDA $0647 = 6E                  ", 0xF05C, 0x7E, 0xFF, 0xD3, 0x67, 0xFB },
-  { "CMP #$6E                        ", 0xF05F, 0x6E, 0xFF, 0xD3, 0x65, 0xFB },
-  { "BEQ $F065                       ", 0xF061, 0x6E, 0xFF, 0xD3, 0x67, 0xFB },
-  { "RTS                             ", 0xF065, 0x6E, 0xFF, 0xD3, 0x67, 0xFB },
-  { "JSR $F066                       ", 0xC644, 0x6E, 0xFF, 0xD3, 0x67, 0xFD },
-  { "LDA #$FF                        ", 0xF066, 0x6E, 0xFF, 0xD3, 0x67, 0xFB },
-  { "STA $01 = FF                    ", 0xF068, 0xFF, 0xFF, 0xD3, 0xE5, 0xFB },
-  { "LDY #$D4                        ", 0xF06A, 0xFF, 0xFF, 0xD3, 0xE5, 0xFB },
-  { "LDX #$02                        ", 0xF06C, 0xFF, 0xFF, 0xD4, 0xE5, 0xFB },
-  { "LDA #$47                        ", 0xF06E, 0xFF, 0x02, 0xD4, 0x65, 0xFB },
-  { "STA $47 = 6E                    ", 0xF070, 0x47, 0x02, 0xD4, 0x65, 0xFB },
-  { "LDA #$06                        ", 0xF072, 0x47, 0x02, 0xD4, 0x65, 0xFB },
-  { "STA $48 = 06                    ", 0xF074, 0x06, 0x02, 0xD4, 0x65, 0xFB },
-  { "LDA #$A5                        ", 0xF076, 0x06, 0x02, 0xD4, 0x65, 0xFB },
-  { "STA $0647 = 6E                  ", 0xF078, 0xA5, 0x02, 0xD4, 0xE5, 0xFB },
-  { "JSR $FB53                       ", 0xF07B, 0xA5, 0x02, 0xD4, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB53, 0xA5, 0x02, 0xD4, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB55, 0xA5, 0x02, 0xD4, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB56, 0xA5, 0x02, 0xD4, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB58, 0xB3, 0x02, 0xD4, 0xE4, 0xF9 },
-  { "RLA ($45,X) @ 47 = 0647 = A5    ", 0xF07E, 0xB3, 0x02, 0xD4, 0xE4, 0xFB },
-  { "NOP                             ", 0xF080, 0x02, 0x02, 0xD4, 0x65, 0xFB },
-  { "NOP                             ", 0xF081, 0x02, 0x02, 0xD4, 0x65, 0xFB },
-  { "NOP                             ", 0xF082, 0x02, 0x02, 0xD4, 0x65, 0xFB },
-  { "NOP                             ", 0xF083, 0x02, 0x02, 0xD4, 0x65, 0xFB },
-  { "JSR $FB59                       ", 0xF084, 0x02, 0x02, 0xD4, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB59, 0x02, 0x02, 0xD4, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB5B, 0x02, 0x02, 0xD4, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB5D, 0x02, 0x02, 0xD4, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xFB5F, 0x02, 0x02, 0xD4, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB61, 0x02, 0x02, 0xD4, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB63, 0x02, 0x02, 0xD4, 0x67, 0xF9 },
-  { "LDA $0647 = 4A                  ", 0xF087, 0x02, 0x02, 0xD4, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xF08A, 0x4A, 0x02, 0xD4, 0x65, 0xFB },
-  { "BEQ $F090                       ", 0xF08C, 0x4A, 0x02, 0xD4, 0x67, 0xFB },
-  { "INY                             ", 0xF090, 0x4A, 0x02, 0xD4, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF091, 0x4A, 0x02, 0xD5, 0xE5, 0xFB },
-  { "STA $0647 = 4A                  ", 0xF093, 0x29, 0x02, 0xD5, 0x65, 0xFB },
-  { "JSR $FB64                       ", 0xF096, 0x29, 0x02, 0xD5, 0x65, 0xFB },
-  { "CLV                             ", 0xFB64, 0x29, 0x02, 0xD5, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB65, 0x29, 0x02, 0xD5, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB66, 0x29, 0x02, 0xD5, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB68, 0x42, 0x02, 0xD5, 0x24, 0xF9 },
-  { "RLA ($45,X) @ 47 = 0647 = 29    ", 0xF099, 0x42, 0x02, 0xD5, 0x24, 0xFB },
-  { "NOP                             ", 0xF09B, 0x42, 0x02, 0xD5, 0x24, 0xFB },
-  { "NOP                             ", 0xF09C, 0x42, 0x02, 0xD5, 0x24, 0xFB },
-  { "NOP                             ", 0xF09D, 0x42, 0x02, 0xD5, 0x24, 0xFB },
-  { "NOP                             ", 0xF09E, 0x42, 0x02, 0xD5, 0x24, 0xFB },
-  { "JSR $FB69                       ", 0xF09F, 0x42, 0x02, 0xD5, 0x24, 0xFB },
-  { "BVS $FB75                       ", 0xFB69, 0x42, 0x02, 0xD5, 0x24, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB6B, 0x42, 0x02, 0xD5, 0x24, 0xF9 },
-  { "BMI $FB75                       ", 0xFB6D, 0x42, 0x02, 0xD5, 0x24, 0xF9 },
-  { "BCS $FB75                       ", 0xFB6F, 0x42, 0x02, 0xD5, 0x24, 0xF9 },
-  { "CMP #$42                        ", 0xFB71, 0x42, 0x02, 0xD5, 0x24, 0xF9 },
-  { "BEQ $FB77                       ", 0xFB73, 0x42, 0x02, 0xD5, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB77, 0x42, 0x02, 0xD5, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF0A2, 0x42, 0x02, 0xD5, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF0A5, 0x52, 0x02, 0xD5, 0x25, 0xFB },
-  { "BEQ $F0AB                       ", 0xF0A7, 0x52, 0x02, 0xD5, 0x27, 0xFB },
-  { "INY                             ", 0xF0AB, 0x52, 0x02, 0xD5, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF0AC, 0x52, 0x02, 0xD6, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF0AE, 0x37, 0x02, 0xD6, 0x25, 0xFB },
-  { "JSR $FA68                       ", 0xF0B1, 0x37, 0x02, 0xD6, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA68, 0x37, 0x02, 0xD6, 0x25, 0xF9 },
-  { "SEC                             ", 0xFA6A, 0x37, 0x02, 0xD6, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFA6B, 0x37, 0x02, 0xD6, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA6D, 0x75, 0x02, 0xD6, 0x65, 0xF9 },
-  { "RLA ($45,X) @ 47 = 0647 = 37    ", 0xF0B4, 0x75, 0x02, 0xD6, 0x65, 0xFB },
-  { "NOP                             ", 0xF0B6, 0x65, 0x02, 0xD6, 0x64, 0xFB },
-  { "NOP                             ", 0xF0B7, 0x65, 0x02, 0xD6, 0x64, 0xFB },
-  { "NOP                             ", 0xF0B8, 0x65, 0x02, 0xD6, 0x64, 0xFB },
-  { "NOP                             ", 0xF0B9, 0x65, 0x02, 0xD6, 0x64, 0xFB },
-  { "JSR $FA6E                       ", 0xF0BA, 0x65, 0x02, 0xD6, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFA6E, 0x65, 0x02, 0xD6, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA70, 0x65, 0x02, 0xD6, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFA72, 0x65, 0x02, 0xD6, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA74, 0x65, 0x02, 0xD6, 0x64, 0xF9 },
-  { "CMP #$65                        ", 0xFA76, 0x65, 0x02, 0xD6, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA78, 0x65, 0x02, 0xD6, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA7A, 0x65, 0x02, 0xD6, 0x67, 0xF9 },
-  { "LDA $0647 = 6F                  ", 0xF0BD, 0x65, 0x02, 0xD6, 0x67, 0xFB },
-  { "CMP #$6F                        ", 0xF0C0, 0x6F, 0x02, 0xD6, 0x65, 0xFB },
-  { "BEQ $F0C6                       ", 0xF0C2, 0x6F, 0x02, 0xD6, 0x67, 0xFB },
-  { "INY                             ", 0xF0C6, 0x6F, 0x02, 0xD6, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xF0C7, 0x6F, 0x02, 0xD7, 0xE5, 0xFB },
-  { "STA $47 = 47                    ", 0xF0C9, 0xA5, 0x02, 0xD7, 0xE5, 0xFB },
-  { "JSR $FB53                       ", 0xF0CB, 0xA5, 0x02, 0xD7, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB53, 0xA5, 0x02, 0xD7, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB55, 0xA5, 0x02, 0xD7, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB56, 0xA5, 0x02, 0xD7, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB58, 0xB3, 0x02, 0xD7, 0xE4, 0xF9 },
-  { "RLA $47 = A5                    ", 0xF0CE, 0xB3, 0x02, 0xD7, 0xE4, 0xFB },
-  { "NOP                             ", 0xF0D0, 0x02, 0x02, 0xD7, 0x65, 0xFB },
-  { "NOP                             ", 0xF0D1, 0x02, 0x02, 0xD7, 0x65, 0xFB },
-  { "NOP                             ", 0xF0D2, 0x02, 0x02, 0xD7, 0x65, 0xFB },
-  { "NOP                             ", 0xF0D3, 0x02, 0x02, 0xD7, 0x65, 0xFB },
-  { "JSR $FB59                       ", 0xF0D4, 0x02, 0x02, 0xD7, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB59, 0x02, 0x02, 0xD7, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB5B, 0x02, 0x02, 0xD7, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB5D, 0x02, 0x02, 0xD7, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xFB5F, 0x02, 0x02, 0xD7, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB61, 0x02, 0x02, 0xD7, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB63, 0x02, 0x02, 0xD7, 0x67, 0xF9 },
-  { "LDA $47 = 4A                    ", 0xF0D7, 0x02, 0x02, 0xD7, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xF0D9, 0x4A, 0x02, 0xD7, 0x65, 0xFB },
-  { "BEQ $F0DF                       ", 0xF0DB, 0x4A, 0x02, 0xD7, 0x67, 0xFB },
-  { "INY                             ", 0xF0DF, 0x4A, 0x02, 0xD7, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF0E0, 0x4A, 0x02, 0xD8, 0xE5, 0xFB },
-  { "STA $47 = 4A                    ", 0xF0E2, 0x29, 0x02, 0xD8, 0x65, 0xFB },
-  { "JSR $FB64                       ", 0xF0E4, 0x29, 0x02, 0xD8, 0x65, 0xFB },
-  { "CLV                             ", 0xFB64, 0x29, 0x02, 0xD8, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB65, 0x29, 0x02, 0xD8, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB66, 0x29, 0x02, 0xD8, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB68, 0x42, 0x02, 0xD8, 0x24, 0xF9 },
-  { "RLA $47 = 29                    ", 0xF0E7, 0x42, 0x02, 0xD8, 0x24, 0xFB },
-  { "NOP                             ", 0xF0E9, 0x42, 0x02, 0xD8, 0x24, 0xFB },
-  { "NOP                             ", 0xF0EA, 0x42, 0x02, 0xD8, 0x24, 0xFB },
-  { "NOP                             ", 0xF0EB, 0x42, 0x02, 0xD8, 0x24, 0xFB },
-  { "NOP                             ", 0xF0EC, 0x42, 0x02, 0xD8, 0x24, 0xFB },
-  { "JSR $FB69                       ", 0xF0ED, 0x42, 0x02, 0xD8, 0x24, 0xFB },
-  { "BVS $FB75                       ", 0xFB69, 0x42, 0x02, 0xD8, 0x24, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB6B, 0x42, 0x02, 0xD8, 0x24, 0xF9 },
-  { "BMI $FB75                       ", 0xFB6D, 0x42, 0x02, 0xD8, 0x24, 0xF9 },
-  { "BCS $FB75                       ", 0xFB6F, 0x42, 0x02, 0xD8, 0x24, 0xF9 },
-  { "CMP #$42                        ", 0xFB71, 0x42, 0x02, 0xD8, 0x24, 0xF9 },
-  { "BEQ $FB77                       ", 0xFB73, 0x42, 0x02, 0xD8, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB77, 0x42, 0x02, 0xD8, 0x27, 0xF9 },
-  { "LDA $47 = 52                    ", 0xF0F0, 0x42, 0x02, 0xD8, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF0F2, 0x52, 0x02, 0xD8, 0x25, 0xFB },
-  { "BEQ $F0F8                       ", 0xF0F4, 0x52, 0x02, 0xD8, 0x27, 0xFB },
-  { "INY                             ", 0xF0F8, 0x52, 0x02, 0xD8, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF0F9, 0x52, 0x02, 0xD9, 0xA5, 0xFB },
-  { "STA $47 = 52                    ", 0xF0FB, 0x37, 0x02, 0xD9, 0x25, 0xFB },
-  { "JSR $FA68                       ", 0xF0FD, 0x37, 0x02, 0xD9, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA68, 0x37, 0x02, 0xD9, 0x25, 0xF9 },
-  { "SEC                             ", 0xFA6A, 0x37, 0x02, 0xD9, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFA6B, 0x37, 0x02, 0xD9, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA6D, 0x75, 0x02, 0xD9, 0x65, 0xF9 },
-  { "RLA $47 = 37                    ", 0xF100, 0x75, 0x02, 0xD9, 0x65, 0xFB },
-  { "NOP                             ", 0xF102, 0x65, 0x02, 0xD9, 0x64, 0xFB },
-  { "NOP                             ", 0xF103, 0x65, 0x02, 0xD9, 0x64, 0xFB },
-  { "NOP                             ", 0xF104, 0x65, 0x02, 0xD9, 0x64, 0xFB },
-  { "NOP                             ", 0xF105, 0x65, 0x02, 0xD9, 0x64, 0xFB },
-  { "JSR $FA6E                       ", 0xF106, 0x65, 0x02, 0xD9, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFA6E, 0x65, 0x02, 0xD9, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA70, 0x65, 0x02, 0xD9, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFA72, 0x65, 0x02, 0xD9, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA74, 0x65, 0x02, 0xD9, 0x64, 0xF9 },
-  { "CMP #$65                        ", 0xFA76, 0x65, 0x02, 0xD9, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA78, 0x65, 0x02, 0xD9, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA7A, 0x65, 0x02, 0xD9, 0x67, 0xF9 },
-  { "LDA $47 = 6F                    ", 0xF109, 0x65, 0x02, 0xD9, 0x67, 0xFB },
-  { "CMP #$6F                        ", 0xF10B, 0x6F, 0x02, 0xD9, 0x65, 0xFB },
-  { "BEQ $F111                       ", 0xF10D, 0x6F, 0x02, 0xD9, 0x67, 0xFB },
-  { "INY                             ", 0xF111, 0x6F, 0x02, 0xD9, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xF112, 0x6F, 0x02, 0xDA, 0xE5, 0xFB },
-  { "STA $0647 = 6F                  ", 0xF114, 0xA5, 0x02, 0xDA, 0xE5, 0xFB },
-  { "JSR $FB53                       ", 0xF117, 0xA5, 0x02, 0xDA, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB53, 0xA5, 0x02, 0xDA, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB55, 0xA5, 0x02, 0xDA, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB56, 0xA5, 0x02, 0xDA, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB58, 0xB3, 0x02, 0xDA, 0xE4, 0xF9 },
-  { "RLA $0647 = A5                  ", 0xF11A, 0xB3, 0x02, 0xDA, 0xE4, 0xFB },
-  { "NOP                             ", 0xF11D, 0x02, 0x02, 0xDA, 0x65, 0xFB },
-  { "NOP                             ", 0xF11E, 0x02, 0x02, 0xDA, 0x65, 0xFB },
-  { "NOP                             ", 0xF11F, 0x02, 0x02, 0xDA, 0x65, 0xFB },
-  { "NOP                             ", 0xF120, 0x02, 0x02, 0xDA, 0x65, 0xFB },
-  { "JSR $FB59                       ", 0xF121, 0x02, 0x02, 0xDA, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB59, 0x02, 0x02, 0xDA, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB5B, 0x02, 0x02, 0xDA, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB5D, 0x02, 0x02, 0xDA, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xFB5F, 0x02, 0x02, 0xDA, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB61, 0x02, 0x02, 0xDA, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB63, 0x02, 0x02, 0xDA, 0x67, 0xF9 },
-  { "LDA $0647 = 4A                  ", 0xF124, 0x02, 0x02, 0xDA, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xF127, 0x4A, 0x02, 0xDA, 0x65, 0xFB },
-  { "BEQ $F12D                       ", 0xF129, 0x4A, 0x02, 0xDA, 0x67, 0xFB },
-  { "INY                             ", 0xF12D, 0x4A, 0x02, 0xDA, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF12E, 0x4A, 0x02, 0xDB, 0xE5, 0xFB },
-  { "STA $0647 = 4A                  ", 0xF130, 0x29, 0x02, 0xDB, 0x65, 0xFB },
-  { "JSR $FB64                       ", 0xF133, 0x29, 0x02, 0xDB, 0x65, 0xFB },
-  { "CLV                             ", 0xFB64, 0x29, 0x02, 0xDB, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB65, 0x29, 0x02, 0xDB, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB66, 0x29, 0x02, 0xDB, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB68, 0x42, 0x02, 0xDB, 0x24, 0xF9 },
-  { "RLA $0647 = 29                  ", 0xF136, 0x42, 0x02, 0xDB, 0x24, 0xFB },
-  { "NOP                             ", 0xF139, 0x42, 0x02, 0xDB, 0x24, 0xFB },
-  { "NOP                             ", 0xF13A, 0x42, 0x02, 0xDB, 0x24, 0xFB },
-  { "NOP                             ", 0xF13B, 0x42, 0x02, 0xDB, 0x24, 0xFB },
-  { "NOP                             ", 0xF13C, 0x42, 0x02, 0xDB, 0x24, 0xFB },
-  { "JSR $FB69                       ", 0xF13D, 0x42, 0x02, 0xDB, 0x24, 0xFB },
-  { "BVS $FB75                       ", 0xFB69, 0x42, 0x02, 0xDB, 0x24, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB6B, 0x42, 0x02, 0xDB, 0x24, 0xF9 },
-  { "BMI $FB75                       ", 0xFB6D, 0x42, 0x02, 0xDB, 0x24, 0xF9 },
-  { "BCS $FB75                       ", 0xFB6F, 0x42, 0x02, 0xDB, 0x24, 0xF9 },
-  { "CMP #$42                        ", 0xFB71, 0x42, 0x02, 0xDB, 0x24, 0xF9 },
-  { "BEQ $FB77                       ", 0xFB73, 0x42, 0x02, 0xDB, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB77, 0x42, 0x02, 0xDB, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF140, 0x42, 0x02, 0xDB, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF143, 0x52, 0x02, 0xDB, 0x25, 0xFB },
-  { "BEQ $F149                       ", 0xF145, 0x52, 0x02, 0xDB, 0x27, 0xFB },
-  { "INY                             ", 0xF149, 0x52, 0x02, 0xDB, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF14A, 0x52, 0x02, 0xDC, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF14C, 0x37, 0x02, 0xDC, 0x25, 0xFB },
-  { "JSR $FA68                       ", 0xF14F, 0x37, 0x02, 0xDC, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA68, 0x37, 0x02, 0xDC, 0x25, 0xF9 },
-  { "SEC                             ", 0xFA6A, 0x37, 0x02, 0xDC, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFA6B, 0x37, 0x02, 0xDC, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA6D, 0x75, 0x02, 0xDC, 0x65, 0xF9 },
-  { "RLA $0647 = 37                  ", 0xF152, 0x75, 0x02, 0xDC, 0x65, 0xFB },
-  { "NOP                             ", 0xF155, 0x65, 0x02, 0xDC, 0x64, 0xFB },
-  { "NOP                             ", 0xF156, 0x65, 0x02, 0xDC, 0x64, 0xFB },
-  { "NOP                             ", 0xF157, 0x65, 0x02, 0xDC, 0x64, 0xFB },
-  { "NOP                             ", 0xF158, 0x65, 0x02, 0xDC, 0x64, 0xFB },
-  { "JSR $FA6E                       ", 0xF159, 0x65, 0x02, 0xDC, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFA6E, 0x65, 0x02, 0xDC, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA70, 0x65, 0x02, 0xDC, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFA72, 0x65, 0x02, 0xDC, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA74, 0x65, 0x02, 0xDC, 0x64, 0xF9 },
-  { "CMP #$65                        ", 0xFA76, 0x65, 0x02, 0xDC, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA78, 0x65, 0x02, 0xDC, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA7A, 0x65, 0x02, 0xDC, 0x67, 0xF9 },
-  { "LDA $0647 = 6F                  ", 0xF15C, 0x65, 0x02, 0xDC, 0x67, 0xFB },
-  { "CMP #$6F                        ", 0xF15F, 0x6F, 0x02, 0xDC, 0x65, 0xFB },
-  { "BEQ $F165                       ", 0xF161, 0x6F, 0x02, 0xDC, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xF165, 0x6F, 0x02, 0xDC, 0x67, 0xFB },
-  { "STA $0647 = 6F                  ", 0xF167, 0xA5, 0x02, 0xDC, 0xE5, 0xFB },
-  { "LDA #$48                        ", 0xF16A, 0xA5, 0x02, 0xDC, 0xE5, 0xFB },
-  { "STA $45 = 48                    ", 0xF16C, 0x48, 0x02, 0xDC, 0x65, 0xFB },
-  { "LDA #$05                        ", 0xF16E, 0x48, 0x02, 0xDC, 0x65, 0xFB },
-  { "STA $46 = 05                    ", 0xF170, 0x05, 0x02, 0xDC, 0x65, 0xFB },
-  { "LDY #$FF                        ", 0xF172, 0x05, 0x02, 0xDC, 0x65, 0xFB },
-  { "JSR $FB53                       ", 0xF174, 0x05, 0x02, 0xFF, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB53, 0x05, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB55, 0x05, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB56, 0x05, 0x02, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB58, 0xB3, 0x02, 0xFF, 0xE4, 0xF9 },
-  { "RLA ($45),Y = 0548 @ 0647 = A5  ", 0xF177, 0xB3, 0x02, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xF179, 0x02, 0x02, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xF17A, 0x02, 0x02, 0xFF, 0x65, 0xFB },
-  { "PHP                             ", 0xF17B, 0x02, 0x02, 0xFF, 0x65, 0xFB },
-  { "PHA                             ", 0xF17C, 0x02, 0x02, 0xFF, 0x65, 0xFA },
-  { "LDY #$DD                        ", 0xF17D, 0x02, 0x02, 0xFF, 0x65, 0xF9 },
-  { "PLA                             ", 0xF17F, 0x02, 0x02, 0xDD, 0xE5, 0xF9 },
-  { "PLP                             ", 0xF180, 0x02, 0x02, 0xDD, 0x65, 0xFA },
-  { "JSR $FB59                       ", 0xF181, 0x02, 0x02, 0xDD, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB59, 0x02, 0x02, 0xDD, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB5B, 0x02, 0x02, 0xDD, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB5D, 0x02, 0x02, 0xDD, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xFB5F, 0x02, 0x02, 0xDD, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB61, 0x02, 0x02, 0xDD, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB63, 0x02, 0x02, 0xDD, 0x67, 0xF9 },
-  { "LDA $0647 = 4A                  ", 0xF184, 0x02, 0x02, 0xDD, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xF187, 0x4A, 0x02, 0xDD, 0x65, 0xFB },
-  { "BEQ $F18D                       ", 0xF189, 0x4A, 0x02, 0xDD, 0x67, 0xFB },
-  { "LDY #$FF                        ", 0xF18D, 0x4A, 0x02, 0xDD, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF18F, 0x4A, 0x02, 0xFF, 0xE5, 0xFB },
-  { "STA $0647 = 4A                  ", 0xF191, 0x29, 0x02, 0xFF, 0x65, 0xFB },
-  { "JSR $FB64                       ", 0xF194, 0x29, 0x02, 0xFF, 0x65, 0xFB },
-  { "CLV                             ", 0xFB64, 0x29, 0x02, 0xFF, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB65, 0x29, 0x02, 0xFF, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB66, 0x29, 0x02, 0xFF, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB68, 0x42, 0x02, 0xFF, 0x24, 0xF9 },
-  { "RLA ($45),Y = 0548 @ 0647 = 29  ", 0xF197, 0x42, 0x02, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xF199, 0x42, 0x02, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xF19A, 0x42, 0x02, 0xFF, 0x24, 0xFB },
-  { "PHP                             ", 0xF19B, 0x42, 0x02, 0xFF, 0x24, 0xFB },
-  { "PHA                             ", 0xF19C, 0x42, 0x02, 0xFF, 0x24, 0xFA },
-  { "LDY #$DE                        ", 0xF19D, 0x42, 0x02, 0xFF, 0x24, 0xF9 },
-  { "PLA                             ", 0xF19F, 0x42, 0x02, 0xDE, 0xA4, 0xF9 },
-  { "PLP                             ", 0xF1A0, 0x42, 0x02, 0xDE, 0x24, 0xFA },
-  { "JSR $FB69                       ", 0xF1A1, 0x42, 0x02, 0xDE, 0x24, 0xFB },
-  { "BVS $FB75                       ", 0xFB69, 0x42, 0x02, 0xDE, 0x24, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB6B, 0x42, 0x02, 0xDE, 0x24, 0xF9 },
-  { "BMI $FB75                       ", 0xFB6D, 0x42, 0x02, 0xDE, 0x24, 0xF9 },
-  { "BCS $FB75                       ", 0xFB6F, 0x42, 0x02, 0xDE, 0x24, 0xF9 },
-  { "CMP #$42                        ", 0xFB71, 0x42, 0x02, 0xDE, 0x24, 0xF9 },
-  { "BEQ $FB77                       ", 0xFB73, 0x42, 0x02, 0xDE, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB77, 0x42, 0x02, 0xDE, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF1A4, 0x42, 0x02, 0xDE, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF1A7, 0x52, 0x02, 0xDE, 0x25, 0xFB },
-  { "BEQ $F1AD                       ", 0xF1A9, 0x52, 0x02, 0xDE, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xF1AD, 0x52, 0x02, 0xDE, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF1AF, 0x52, 0x02, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF1B1, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "JSR $FA68                       ", 0xF1B4, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA68, 0x37, 0x02, 0xFF, 0x25, 0xF9 },
-  { "SEC                             ", 0xFA6A, 0x37, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFA6B, 0x37, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA6D, 0x75, 0x02, 0xFF, 0x65, 0xF9 },
-  { "RLA ($45),Y = 0548 @ 0647 = 37  ", 0xF1B7, 0x75, 0x02, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xF1B9, 0x65, 0x02, 0xFF, 0x64, 0xFB },
-  { "NOP                             ", 0xF1BA, 0x65, 0x02, 0xFF, 0x64, 0xFB },
-  { "PHP                             ", 0xF1BB, 0x65, 0x02, 0xFF, 0x64, 0xFB },
-  { "PHA                             ", 0xF1BC, 0x65, 0x02, 0xFF, 0x64, 0xFA },
-  { "LDY #$DF                        ", 0xF1BD, 0x65, 0x02, 0xFF, 0x64, 0xF9 },
-  { "PLA                             ", 0xF1BF, 0x65, 0x02, 0xDF, 0xE4, 0xF9 },
-  { "PLP                             ", 0xF1C0, 0x65, 0x02, 0xDF, 0x64, 0xFA },
-  { "JSR $FA6E                       ", 0xF1C1, 0x65, 0x02, 0xDF, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFA6E, 0x65, 0x02, 0xDF, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA70, 0x65, 0x02, 0xDF, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFA72, 0x65, 0x02, 0xDF, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA74, 0x65, 0x02, 0xDF, 0x64, 0xF9 },
-  { "CMP #$65                        ", 0xFA76, 0x65, 0x02, 0xDF, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA78, 0x65, 0x02, 0xDF, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA7A, 0x65, 0x02, 0xDF, 0x67, 0xF9 },
-  { "LDA $0647 = 6F                  ", 0xF1C4, 0x65, 0x02, 0xDF, 0x67, 0xFB },
-  { "CMP #$6F                        ", 0xF1C7, 0x6F, 0x02, 0xDF, 0x65, 0xFB },
-  { "BEQ $F1CD                       ", 0xF1C9, 0x6F, 0x02, 0xDF, 0x67, 0xFB },
-  { "LDY #$E0                        ", 0xF1CD, 0x6F, 0x02, 0xDF, 0x67, 0xFB },
-  { "LDX #$FF                        ", 0xF1CF, 0x6F, 0x02, 0xE0, 0xE5, 0xFB },
-  { "LDA #$A5                        ", 0xF1D1, 0x6F, 0xFF, 0xE0, 0xE5, 0xFB },
-  { "STA $47 = 6F                    ", 0xF1D3, 0xA5, 0xFF, 0xE0, 0xE5, 0xFB },
-  { "JSR $FB53                       ", 0xF1D5, 0xA5, 0xFF, 0xE0, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB53, 0xA5, 0xFF, 0xE0, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB55, 0xA5, 0xFF, 0xE0, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB56, 0xA5, 0xFF, 0xE0, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB58, 0xB3, 0xFF, 0xE0, 0xE4, 0xF9 },
-  { "RLA $48,X @ 47 = A5             ", 0xF1D8, 0xB3, 0xFF, 0xE0, 0xE4, 0xFB },
-  { "NOP                             ", 0xF1DA, 0x02, 0xFF, 0xE0, 0x65, 0xFB },
-  { "NOP                             ", 0xF1DB, 0x02, 0xFF, 0xE0, 0x65, 0xFB },
-  { "NOP                             ", 0xF1DC, 0x02, 0xFF, 0xE0, 0x65, 0xFB },
-  { "NOP                             ", 0xF1DD, 0x02, 0xFF, 0xE0, 0x65, 0xFB },
-  { "JSR $FB59                       ", 0xF1DE, 0x02, 0xFF, 0xE0, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB59, 0x02, 0xFF, 0xE0, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB5B, 0x02, 0xFF, 0xE0, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB5D, 0x02, 0xFF, 0xE0, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xFB5F, 0x02, 0xFF, 0xE0, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB61, 0x02, 0xFF, 0xE0, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB63, 0x02, 0xFF, 0xE0, 0x67, 0xF9 },
-  { "LDA $47 = 4A                    ", 0xF1E1, 0x02, 0xFF, 0xE0, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xF1E3, 0x4A, 0xFF, 0xE0, 0x65, 0xFB },
-  { "BEQ $F1E9                       ", 0xF1E5, 0x4A, 0xFF, 0xE0, 0x67, 0xFB },
-  { "INY                             ", 0xF1E9, 0x4A, 0xFF, 0xE0, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF1EA, 0x4A, 0xFF, 0xE1, 0xE5, 0xFB },
-  { "STA $47 = 4A                    ", 0xF1EC, 0x29, 0xFF, 0xE1, 0x65, 0xFB },
-  { "JSR $FB64                       ", 0xF1EE, 0x29, 0xFF, 0xE1, 0x65, 0xFB },
-  { "CLV                             ", 0xFB64, 0x29, 0xFF, 0xE1, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB65, 0x29, 0xFF, 0xE1, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB66, 0x29, 0xFF, 0xE1, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB68, 0x42, 0xFF, 0xE1, 0x24, 0xF9 },
-  { "RLA $48,X @ 47 = 29             ", 0xF1F1, 0x42, 0xFF, 0xE1, 0x24, 0xFB },
-  { "NOP                             ", 0xF1F3, 0x42, 0xFF, 0xE1, 0x24, 0xFB },
-  { "NOP                             ", 0xF1F4, 0x42, 0xFF, 0xE1, 0x24, 0xFB },
-  { "NOP                             ", 0xF1F5, 0x42, 0xFF, 0xE1, 0x24, 0xFB },
-  { "NOP                             ", 0xF1F6, 0x42, 0xFF, 0xE1, 0x24, 0xFB },
-  { "JSR $FB69                       ", 0xF1F7, 0x42, 0xFF, 0xE1, 0x24, 0xFB },
-  { "BVS $FB75                       ", 0xFB69, 0x42, 0xFF, 0xE1, 0x24, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB6B, 0x42, 0xFF, 0xE1, 0x24, 0xF9 },
-  { "BMI $FB75                       ", 0xFB6D, 0x42, 0xFF, 0xE1, 0x24, 0xF9 },
-  { "BCS $FB75                       ", 0xFB6F, 0x42, 0xFF, 0xE1, 0x24, 0xF9 },
-  { "CMP #$42                        ", 0xFB71, 0x42, 0xFF, 0xE1, 0x24, 0xF9 },
-  { "BEQ $FB77                       ", 0xFB73, 0x42, 0xFF, 0xE1, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB77, 0x42, 0xFF, 0xE1, 0x27, 0xF9 },
-  { "LDA $47 = 52                    ", 0xF1FA, 0x42, 0xFF, 0xE1, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF1FC, 0x52, 0xFF, 0xE1, 0x25, 0xFB },
-  { "BEQ $F202                       ", 0xF1FE, 0x52, 0xFF, 0xE1, 0x27, 0xFB },
-  { "INY                             ", 0xF202, 0x52, 0xFF, 0xE1, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF203, 0x52, 0xFF, 0xE2, 0xA5, 0xFB },
-  { "STA $47 = 52                    ", 0xF205, 0x37, 0xFF, 0xE2, 0x25, 0xFB },
-  { "JSR $FA68                       ", 0xF207, 0x37, 0xFF, 0xE2, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA68, 0x37, 0xFF, 0xE2, 0x25, 0xF9 },
-  { "SEC                             ", 0xFA6A, 0x37, 0xFF, 0xE2, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFA6B, 0x37, 0xFF, 0xE2, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA6D, 0x75, 0xFF, 0xE2, 0x65, 0xF9 },
-  { "RLA $48,X @ 47 = 37             ", 0xF20A, 0x75, 0xFF, 0xE2, 0x65, 0xFB },
-  { "NOP                             ", 0xF20C, 0x65, 0xFF, 0xE2, 0x64, 0xFB },
-  { "NOP                             ", 0xF20D, 0x65, 0xFF, 0xE2, 0x64, 0xFB },
-  { "NOP                             ", 0xF20E, 0x65, 0xFF, 0xE2, 0x64, 0xFB },
-  { "NOP                             ", 0xF20F, 0x65, 0xFF, 0xE2, 0x64, 0xFB },
-  { "JSR $FA6E                       ", 0xF210, 0x65, 0xFF, 0xE2, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFA6E, 0x65, 0xFF, 0xE2, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA70, 0x65, 0xFF, 0xE2, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFA72, 0x65, 0xFF, 0xE2, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA74, 0x65, 0xFF, 0xE2, 0x64, 0xF9 },
-  { "CMP #$65                        ", 0xFA76, 0x65, 0xFF, 0xE2, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA78, 0x65, 0xFF, 0xE2, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA7A, 0x65, 0xFF, 0xE2, 0x67, 0xF9 },
-  { "LDA $47 = 6F                    ", 0xF213, 0x65, 0xFF, 0xE2, 0x67, 0xFB },
-  { "CMP #$6F                        ", 0xF215, 0x6F, 0xFF, 0xE2, 0x65, 0xFB },
-  { "BEQ $F21B                       ", 0xF217, 0x6F, 0xFF, 0xE2, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xF21B, 0x6F, 0xFF, 0xE2, 0x67, 0xFB },
-  { "STA $0647 = 6F                  ", 0xF21D, 0xA5, 0xFF, 0xE2, 0xE5, 0xFB },
-  { "LDY #$FF                        ", 0xF220, 0xA5, 0xFF, 0xE2, 0xE5, 0xFB },
-  { "JSR $FB53                       ", 0xF222, 0xA5, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB53, 0xA5, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB55, 0xA5, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB56, 0xA5, 0xFF, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB58, 0xB3, 0xFF, 0xFF, 0xE4, 0xF9 },
-  { "RLA $0548,Y @ 0647 = A5         ", 0xF225, 0xB3, 0xFF, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xF228, 0x02, 0xFF, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xF229, 0x02, 0xFF, 0xFF, 0x65, 0xFB },
-  { "PHP                             ", 0xF22A, 0x02, 0xFF, 0xFF, 0x65, 0xFB },
-  { "PHA                             ", 0xF22B, 0x02, 0xFF, 0xFF, 0x65, 0xFA },
-  { "LDY #$E3                        ", 0xF22C, 0x02, 0xFF, 0xFF, 0x65, 0xF9 },
-  { "PLA                             ", 0xF22E, 0x02, 0xFF, 0xE3, 0xE5, 0xF9 },
-  { "PLP                             ", 0xF22F, 0x02, 0xFF, 0xE3, 0x65, 0xFA },
-  { "JSR $FB59                       ", 0xF230, 0x02, 0xFF, 0xE3, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB59, 0x02, 0xFF, 0xE3, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB5B, 0x02, 0xFF, 0xE3, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB5D, 0x02, 0xFF, 0xE3, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xFB5F, 0x02, 0xFF, 0xE3, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB61, 0x02, 0xFF, 0xE3, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB63, 0x02, 0xFF, 0xE3, 0x67, 0xF9 },
-  { "LDA $0647 = 4A                  ", 0xF233, 0x02, 0xFF, 0xE3, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xF236, 0x4A, 0xFF, 0xE3, 0x65, 0xFB },
-  { "BEQ $F23C                       ", 0xF238, 0x4A, 0xFF, 0xE3, 0x67, 0xFB },
-  { "LDY #$FF                        ", 0xF23C, 0x4A, 0xFF, 0xE3, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF23E, 0x4A, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "STA $0647 = 4A                  ", 0xF240, 0x29, 0xFF, 0xFF, 0x65, 0xFB },
-  { "JSR $FB64                       ", 0xF243, 0x29, 0xFF, 0xFF, 0x65, 0xFB },
-  { "CLV                             ", 0xFB64, 0x29, 0xFF, 0xFF, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB65, 0x29, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB66, 0x29, 0xFF, 0xFF, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB68, 0x42, 0xFF, 0xFF, 0x24, 0xF9 },
-  { "RLA $0548,Y @ 0647 = 29         ", 0xF246, 0x42, 0xFF, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xF249, 0x42, 0xFF, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xF24A, 0x42, 0xFF, 0xFF, 0x24, 0xFB },
-  { "PHP                             ", 0xF24B, 0x42, 0xFF, 0xFF, 0x24, 0xFB },
-  { "PHA                             ", 0xF24C, 0x42, 0xFF, 0xFF, 0x24, 0xFA },
-  { "LDY #$E4                        ", 0xF24D, 0x42, 0xFF, 0xFF, 0x24, 0xF9 },
-  { "PLA                             ", 0xF24F, 0x42, 0xFF, 0xE4, 0xA4, 0xF9 },
-  { "PLP                             ", 0xF250, 0x42, 0xFF, 0xE4, 0x24, 0xFA },
-  { "JSR $FB69                       ", 0xF251, 0x42, 0xFF, 0xE4, 0x24, 0xFB },
-  { "BVS $FB75                       ", 0xFB69, 0x42, 0xFF, 0xE4, 0x24, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB6B, 0x42, 0xFF, 0xE4, 0x24, 0xF9 },
-  { "BMI $FB75                       ", 0xFB6D, 0x42, 0xFF, 0xE4, 0x24, 0xF9 },
-  { "BCS $FB75                       ", 0xFB6F, 0x42, 0xFF, 0xE4, 0x24, 0xF9 },
-  { "CMP #$42                        ", 0xFB71, 0x42, 0xFF, 0xE4, 0x24, 0xF9 },
-  { "BEQ $FB77                       ", 0xFB73, 0x42, 0xFF, 0xE4, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB77, 0x42, 0xFF, 0xE4, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF254, 0x42, 0xFF, 0xE4, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF257, 0x52, 0xFF, 0xE4, 0x25, 0xFB },
-  { "BEQ $F25D                       ", 0xF259, 0x52, 0xFF, 0xE4, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xF25D, 0x52, 0xFF, 0xE4, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF25F, 0x52, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF261, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "JSR $FA68                       ", 0xF264, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA68, 0x37, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "SEC                             ", 0xFA6A, 0x37, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFA6B, 0x37, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA6D, 0x75, 0xFF, 0xFF, 0x65, 0xF9 },
-  { "RLA $0548,Y @ 0647 = 37         ", 0xF267, 0x75, 0xFF, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xF26A, 0x65, 0xFF, 0xFF, 0x64, 0xFB },
-  { "NOP                             ", 0xF26B, 0x65, 0xFF, 0xFF, 0x64, 0xFB },
-  { "PHP                             ", 0xF26C, 0x65, 0xFF, 0xFF, 0x64, 0xFB },
-  { "PHA                             ", 0xF26D, 0x65, 0xFF, 0xFF, 0x64, 0xFA },
-  { "LDY #$E5                        ", 0xF26E, 0x65, 0xFF, 0xFF, 0x64, 0xF9 },
-  { "PLA                             ", 0xF270, 0x65, 0xFF, 0xE5, 0xE4, 0xF9 },
-  { "PLP                             ", 0xF271, 0x65, 0xFF, 0xE5, 0x64, 0xFA },
-  { "JSR $FA6E                       ", 0xF272, 0x65, 0xFF, 0xE5, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFA6E, 0x65, 0xFF, 0xE5, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA70, 0x65, 0xFF, 0xE5, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFA72, 0x65, 0xFF, 0xE5, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA74, 0x65, 0xFF, 0xE5, 0x64, 0xF9 },
-  { "CMP #$65                        ", 0xFA76, 0x65, 0xFF, 0xE5, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA78, 0x65, 0xFF, 0xE5, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA7A, 0x65, 0xFF, 0xE5, 0x67, 0xF9 },
-  { "LDA $0647 = 6F                  ", 0xF275, 0x65, 0xFF, 0xE5, 0x67, 0xFB },
-  { "CMP #$6F                        ", 0xF278, 0x6F, 0xFF, 0xE5, 0x65, 0xFB },
-  { "BEQ $F27E                       ", 0xF27A, 0x6F, 0xFF, 0xE5, 0x67, 0xFB },
-  { "LDY #$E6                        ", 0xF27E, 0x6F, 0xFF, 0xE5, 0x67, 0xFB },
-  { "LDX #$FF                        ", 0xF280, 0x6F, 0xFF, 0xE6, 0xE5, 0xFB },
-  { "LDA #$A5                        ", 0xF282, 0x6F, 0xFF, 0xE6, 0xE5, 0xFB },
-  { "STA $0647 = 6F                  ", 0xF284, 0xA5, 0xFF, 0xE6, 0xE5, 0xFB },
-  { "JSR $FB53                       ", 0xF287, 0xA5, 0xFF, 0xE6, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB53, 0xA5, 0xFF, 0xE6, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB55, 0xA5, 0xFF, 0xE6, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB56, 0xA5, 0xFF, 0xE6, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB58, 0xB3, 0xFF, 0xE6, 0xE4, 0xF9 },
-  { "RLA $0548,X @ 0647 = A5         ", 0xF28A, 0xB3, 0xFF, 0xE6, 0xE4, 0xFB },
-  { "NOP                             ", 0xF28D, 0x02, 0xFF, 0xE6, 0x65, 0xFB },
-  { "NOP                             ", 0xF28E, 0x02, 0xFF, 0xE6, 0x65, 0xFB },
-  { "NOP                             ", 0xF28F, 0x02, 0xFF, 0xE6, 0x65, 0xFB },
-  { "NOP                             ", 0xF290, 0x02, 0xFF, 0xE6, 0x65, 0xFB },
-  { "JSR $FB59                       ", 0xF291, 0x02, 0xFF, 0xE6, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB59, 0x02, 0xFF, 0xE6, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB5B, 0x02, 0xFF, 0xE6, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB5D, 0x02, 0xFF, 0xE6, 0x65, 0xF9 },
-  { "CMP #$02                        ", 0xFB5F, 0x02, 0xFF, 0xE6, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB61, 0x02, 0xFF, 0xE6, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB63, 0x02, 0xFF, 0xE6, 0x67, 0xF9 },
-  { "LDA $0647 = 4A                  ", 0xF294, 0x02, 0xFF, 0xE6, 0x67, 0xFB },
-  { "CMP #$4A                        ", 0xF297, 0x4A, 0xFF, 0xE6, 0x65, 0xFB },
-  { "BEQ $F29D                       ", 0xF299, 0x4A, 0xFF, 0xE6, 0x67, 0xFB },
-  { "INY                             ", 0xF29D, 0x4A, 0xFF, 0xE6, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF29E, 0x4A, 0xFF, 0xE7, 0xE5, 0xFB },
-  { "STA $0647 = 4A                  ", 0xF2A0, 0x29, 0xFF, 0xE7, 0x65, 0xFB },
-  { "JSR $FB64                       ", 0xF2A3, 0x29, 0xFF, 0xE7, 0x65, 0xFB },
-  { "CLV                             ", 0xFB64, 0x29, 0xFF, 0xE7, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB65, 0x29, 0xFF, 0xE7, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB66, 0x29, 0xFF, 0xE7, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB68, 0x42, 0xFF, 0xE7, 0x24, 0xF9 },
-  { "RLA $0548,X @ 0647 = 29         ", 0xF2A6, 0x42, 0xFF, 0xE7, 0x24, 0xFB },
-  { "NOP                             ", 0xF2A9, 0x42, 0xFF, 0xE7, 0x24, 0xFB },
-  { "NOP                             ", 0xF2AA, 0x42, 0xFF, 0xE7, 0x24, 0xFB },
-  { "NOP                             ", 0xF2AB, 0x42, 0xFF, 0xE7, 0x24, 0xFB },
-  { "NOP                             ", 0xF2AC, 0x42, 0xFF, 0xE7, 0x24, 0xFB },
-  { "JSR $FB69                       ", 0xF2AD, 0x42, 0xFF, 0xE7, 0x24, 0xFB },
-  { "BVS $FB75                       ", 0xFB69, 0x42, 0xFF, 0xE7, 0x24, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB6B, 0x42, 0xFF, 0xE7, 0x24, 0xF9 },
-  { "BMI $FB75                       ", 0xFB6D, 0x42, 0xFF, 0xE7, 0x24, 0xF9 },
-  { "BCS $FB75                       ", 0xFB6F, 0x42, 0xFF, 0xE7, 0x24, 0xF9 },
-  { "CMP #$42                        ", 0xFB71, 0x42, 0xFF, 0xE7, 0x24, 0xF9 },
-  { "BEQ $FB77                       ", 0xFB73, 0x42, 0xFF, 0xE7, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB77, 0x42, 0xFF, 0xE7, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF2B0, 0x42, 0xFF, 0xE7, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF2B3, 0x52, 0xFF, 0xE7, 0x25, 0xFB },
-  { "BEQ $F2B9                       ", 0xF2B5, 0x52, 0xFF, 0xE7, 0x27, 0xFB },
-  { "INY                             ", 0xF2B9, 0x52, 0xFF, 0xE7, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF2BA, 0x52, 0xFF, 0xE8, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF2BC, 0x37, 0xFF, 0xE8, 0x25, 0xFB },
-  { "JSR $FA68                       ", 0xF2BF, 0x37, 0xFF, 0xE8, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFA68, 0x37, 0xFF, 0xE8, 0x25, 0xF9 },
-  { "SEC                             ", 0xFA6A, 0x37, 0xFF, 0xE8, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFA6B, 0x37, 0xFF, 0xE8, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFA6D, 0x75, 0xFF, 0xE8, 0x65, 0xF9 },
-  { "RLA $0548,X @ 0647 = 37         ", 0xF2C2, 0x75, 0xFF, 0xE8, 0x65, 0xFB },
-  { "NOP                             ", 0xF2C5, 0x65, 0xFF, 0xE8, 0x64, 0xFB },
-  { "NOP                             ", 0xF2C6, 0x65, 0xFF, 0xE8, 0x64, 0xFB },
-  { "NOP                             ", 0xF2C7, 0x65, 0xFF, 0xE8, 0x64, 0xFB },
-  { "NOP                             ", 0xF2C8, 0x65, 0xFF, 0xE8, 0x64, 0xFB },
-  { "JSR $FA6E                       ", 0xF2C9, 0x65, 0xFF, 0xE8, 0x64, 0xFB },
-  { "BVC $FAE6                       ", 0xFA6E, 0x65, 0xFF, 0xE8, 0x64, 0xF9 },
-  { "BEQ $FAE6                       ", 0xFA70, 0x65, 0xFF, 0xE8, 0x64, 0xF9 },
-  { "BMI $FAE6                       ", 0xFA72, 0x65, 0xFF, 0xE8, 0x64, 0xF9 },
-  { "BCS $FAE6                       ", 0xFA74, 0x65, 0xFF, 0xE8, 0x64, 0xF9 },
-  { "CMP #$65                        ", 0xFA76, 0x65, 0xFF, 0xE8, 0x64, 0xF9 },
-  { "BNE $FAE6                       ", 0xFA78, 0x65, 0xFF, 0xE8, 0x67, 0xF9 },
-  { "RTS                             ", 0xFA7A, 0x65, 0xFF, 0xE8, 0x67, 0xF9 },
-  { "LDA $0647 = 6F                  ", 0xF2CC, 0x65, 0xFF, 0xE8, 0x67, 0xFB },
-  { "CMP #$6F                        ", 0xF2CF, 0x6F, 0xFF, 0xE8, 0x65, 0xFB },
-  { "BEQ $F2D5                       ", 0xF2D1, 0x6F, 0xFF, 0xE8, 0x67, 0xFB },
-  { "RTS                             ", 0xF2D5, 0x6F, 0xFF, 0xE8, 0x67, 0xFB },
-  { "JSR $F2D6                       ", 0xC647, 0x6F, 0xFF, 0xE8, 0x67, 0xFD },
-  { "LDA #$FF                        ", 0xF2D6, 0x6F, 0xFF, 0xE8, 0x67, 0xFB },
-  { "STA $01 = FF                    ", 0xF2D8, 0xFF, 0xFF, 0xE8, 0xE5, 0xFB },
-  { "LDY #$E9                        ", 0xF2DA, 0xFF, 0xFF, 0xE8, 0xE5, 0xFB },
-  { "LDX #$02                        ", 0xF2DC, 0xFF, 0xFF, 0xE9, 0xE5, 0xFB },
-  { "LDA #$47                        ", 0xF2DE, 0xFF, 0x02, 0xE9, 0x65, 0xFB },
-  { "STA $47 = 6F                    ", 0xF2E0, 0x47, 0x02, 0xE9, 0x65, 0xFB },
-  { "LDA #$06                        ", 0xF2E2, 0x47, 0x02, 0xE9, 0x65, 0xFB },
-  { "STA $48 = 06                    ", 0xF2E4, 0x06, 0x02, 0xE9, 0x65, 0xFB },
-  { "LDA #$A5                        ", 0xF2E6, 0x06, 0x02, 0xE9, 0x65, 0xFB },
-  { "STA $0647 = 6F                  ", 0xF2E8, 0xA5, 0x02, 0xE9, 0xE5, 0xFB },
-  { "JSR $FB1D                       ", 0xF2EB, 0xA5, 0x02, 0xE9, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB1D, 0xA5, 0x02, 0xE9, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB1F, 0xA5, 0x02, 0xE9, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB20, 0xA5, 0x02, 0xE9, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB22, 0xB3, 0x02, 0xE9, 0xE4, 0xF9 },
-  { "SRE ($45,X) @ 47 = 0647 = A5    ", 0xF2EE, 0xB3, 0x02, 0xE9, 0xE4, 0xFB },
-  { "NOP                             ", 0xF2F0, 0xE1, 0x02, 0xE9, 0xE5, 0xFB },
-  { "NOP                             ", 0xF2F1, 0xE1, 0x02, 0xE9, 0xE5, 0xFB },
-  { "NOP                             ", 0xF2F2, 0xE1, 0x02, 0xE9, 0xE5, 0xFB },
-  { "NOP                             ", 0xF2F3, 0xE1, 0x02, 0xE9, 0xE5, 0xFB },
-  { "JSR $FB23                       ", 0xF2F4, 0xE1, 0x02, 0xE9, 0xE5, 0xFB },
-  { "BVC $FB75                       ", 0xFB23, 0xE1, 0x02, 0xE9, 0xE5, 0xF9 },
-  { "BCC $FB75                       ", 0xFB25, 0xE1, 0x02, 0xE9, 0xE5, 0xF9 },
-  { "BPL $FB75                       ", 0xFB27, 0xE1, 0x02, 0xE9, 0xE5, 0xF9 },
-  { "CMP #$E1                        ", 0xFB29, 0xE1, 0x02, 0xE9, 0xE5, 0xF9 },
-  { "BNE $FB75                       ", 0xFB2B, 0xE1, 0x02, 0xE9, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB2D, 0xE1, 0x02, 0xE9, 0x67, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF2F7, 0xE1, 0x02, 0xE9, 0x67, 0xFB },
-  { "CMP #$52                        ", 0xF2FA, 0x52, 0x02, 0xE9, 0x65, 0xFB },
-  { "BEQ $F300                       ", 0xF2FC, 0x52, 0x02, 0xE9, 0x67, 0xFB },
-  { "INY                             ", 0xF300, 0x52, 0x02, 0xE9, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF301, 0x52, 0x02, 0xEA, 0xE5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF303, 0x29, 0x02, 0xEA, 0x65, 0xFB },
-  { "JSR $FB2E                       ", 0xF306, 0x29, 0x02, 0xEA, 0x65, 0xFB },
-  { "CLV                             ", 0xFB2E, 0x29, 0x02, 0xEA, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB2F, 0x29, 0x02, 0xEA, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB30, 0x29, 0x02, 0xEA, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB32, 0x42, 0x02, 0xEA, 0x24, 0xF9 },
-  { "SRE ($45,X) @ 47 = 0647 = 29    ", 0xF309, 0x42, 0x02, 0xEA, 0x24, 0xFB },
-  { "NOP                             ", 0xF30B, 0x56, 0x02, 0xEA, 0x25, 0xFB },
-  { "NOP                             ", 0xF30C, 0x56, 0x02, 0xEA, 0x25, 0xFB },
-  { "NOP                             ", 0xF30D, 0x56, 0x02, 0xEA, 0x25, 0xFB },
-  { "NOP                             ", 0xF30E, 0x56, 0x02, 0xEA, 0x25, 0xFB },
-  { "JSR $FB33                       ", 0xF30F, 0x56, 0x02, 0xEA, 0x25, 0xFB },
-  { "BVS $FB75                       ", 0xFB33, 0x56, 0x02, 0xEA, 0x25, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB35, 0x56, 0x02, 0xEA, 0x25, 0xF9 },
-  { "BMI $FB75                       ", 0xFB37, 0x56, 0x02, 0xEA, 0x25, 0xF9 },
-  { "BCC $FB75                       ", 0xFB39, 0x56, 0x02, 0xEA, 0x25, 0xF9 },
-  { "CMP #$56                        ", 0xFB3B, 0x56, 0x02, 0xEA, 0x25, 0xF9 },
-  { "BNE $FB75                       ", 0xFB3D, 0x56, 0x02, 0xEA, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB3F, 0x56, 0x02, 0xEA, 0x27, 0xF9 },
-  { "LDA $0647 = 14                  ", 0xF312, 0x56, 0x02, 0xEA, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF315, 0x14, 0x02, 0xEA, 0x25, 0xFB },
-  { "BEQ $F31B                       ", 0xF317, 0x14, 0x02, 0xEA, 0x27, 0xFB },
-  { "INY                             ", 0xF31B, 0x14, 0x02, 0xEA, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF31C, 0x14, 0x02, 0xEB, 0xA5, 0xFB },
-  { "STA $0647 = 14                  ", 0xF31E, 0x37, 0x02, 0xEB, 0x25, 0xFB },
-  { "JSR $FB40                       ", 0xF321, 0x37, 0x02, 0xEB, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB40, 0x37, 0x02, 0xEB, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB42, 0x37, 0x02, 0xEB, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB43, 0x37, 0x02, 0xEB, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB45, 0x75, 0x02, 0xEB, 0x65, 0xF9 },
-  { "SRE ($45,X) @ 47 = 0647 = 37    ", 0xF324, 0x75, 0x02, 0xEB, 0x65, 0xFB },
-  { "NOP                             ", 0xF326, 0x6E, 0x02, 0xEB, 0x65, 0xFB },
-  { "NOP                             ", 0xF327, 0x6E, 0x02, 0xEB, 0x65, 0xFB },
-  { "NOP                             ", 0xF328, 0x6E, 0x02, 0xEB, 0x65, 0xFB },
-  { "NOP                             ", 0xF329, 0x6E, 0x02, 0xEB, 0x65, 0xFB },
-  { "JSR $FB46                       ", 0xF32A, 0x6E, 0x02, 0xEB, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB46, 0x6E, 0x02, 0xEB, 0x65, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB48, 0x6E, 0x02, 0xEB, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB4A, 0x6E, 0x02, 0xEB, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB4C, 0x6E, 0x02, 0xEB, 0x65, 0xF9 },
-  { "CMP #$6E                        ", 0xFB4E, 0x6E, 0x02, 0xEB, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB50, 0x6E, 0x02, 0xEB, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB52, 0x6E, 0x02, 0xEB, 0x67, 0xF9 },
-  { "LDA $0647 = 1B                  ", 0xF32D, 0x6E, 0x02, 0xEB, 0x67, 0xFB },
-  { "CMP #$1B                        ", 0xF330, 0x1B, 0x02, 0xEB, 0x65, 0xFB },
-  { "BEQ $F336                       ", 0xF332, 0x1B, 0x02, 0xEB, 0x67, 0xFB },
-  { "INY                             ", 0xF336, 0x1B, 0x02, 0xEB, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xF337, 0x1B, 0x02, 0xEC, 0xE5, 0xFB },
-  { "STA $47 = 47                    ", 0xF339, 0xA5, 0x02, 0xEC, 0xE5, 0xFB },
-  { "JSR $FB1D                       ", 0xF33B, 0xA5, 0x02, 0xEC, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB1D, 0xA5, 0x02, 0xEC, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB1F, 0xA5, 0x02, 0xEC, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB20, 0xA5, 0x02, 0xEC, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB22, 0xB3, 0x02, 0xEC, 0xE4, 0xF9 },
-  { "SRE $47 = A5                    ", 0xF33E, 0xB3, 0x02, 0xEC, 0xE4, 0xFB },
-  { "NOP                             ", 0xF340, 0xE1, 0x02, 0xEC, 0xE5, 0xFB },
-  { "NOP                             ", 0xF341, 0xE1, 0x02, 0xEC, 0xE5, 0xFB },
-  { "NOP                             ", 0xF342, 0xE1, 0x02, 0xEC, 0xE5, 0xFB },
-  { "NOP                             ", 0xF343, 0xE1, 0x02, 0xEC, 0xE5, 0xFB },
-  { "JSR $FB23                       ", 0xF344, 0xE1, 0x02, 0xEC, 0xE5, 0xFB },
-  { "BVC $FB75                       ", 0xFB23, 0xE1, 0x02, 0xEC, 0xE5, 0xF9 },
-  { "BCC $FB75                       ", 0xFB25, 0xE1, 0x02, 0xEC, 0xE5, 0xF9 },
-  { "BPL $FB75                       ", 0xFB27, 0xE1, 0x02, 0xEC, 0xE5, 0xF9 },
-  { "CMP #$E1                        ", 0xFB29, 0xE1, 0x02, 0xEC, 0xE5, 0xF9 },
-  { "BNE $FB75                       ", 0xFB2B, 0xE1, 0x02, 0xEC, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB2D, 0xE1, 0x02, 0xEC, 0x67, 0xF9 },
-  { "LDA $47 = 52                    ", 0xF347, 0xE1, 0x02, 0xEC, 0x67, 0xFB },
-  { "CMP #$52                        ", 0xF349, 0x52, 0x02, 0xEC, 0x65, 0xFB },
-  { "BEQ $F34F                       ", 0xF34B, 0x52, 0x02, 0xEC, 0x67, 0xFB },
-  { "INY                             ", 0xF34F, 0x52, 0x02, 0xEC, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF350, 0x52, 0x02, 0xED, 0xE5, 0xFB },
-  { "STA $47 = 52                    ", 0xF352, 0x29, 0x02, 0xED, 0x65, 0xFB },
-  { "JSR $FB2E                       ", 0xF354, 0x29, 0x02, 0xED, 0x65, 0xFB },
-  { "CLV                             ", 0xFB2E, 0x29, 0x02, 0xED, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB2F, 0x29, 0x02, 0xED, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB30, 0x29, 0x02, 0xED, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB32, 0x42, 0x02, 0xED, 0x24, 0xF9 },
-  { "SRE $47 = 29                    ", 0xF357, 0x42, 0x02, 0xED, 0x24, 0xFB },
-  { "NOP                             ", 0xF359, 0x56, 0x02, 0xED, 0x25, 0xFB },
-  { "NOP                             ", 0xF35A, 0x56, 0x02, 0xED, 0x25, 0xFB },
-  { "NOP                             ", 0xF35B, 0x56, 0x02, 0xED, 0x25, 0xFB },
-  { "NOP                             ", 0xF35C, 0x56, 0x02, 0xED, 0x25, 0xFB },
-  { "JSR $FB33                       ", 0xF35D, 0x56, 0x02, 0xED, 0x25, 0xFB },
-  { "BVS $FB75                       ", 0xFB33, 0x56, 0x02, 0xED, 0x25, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB35, 0x56, 0x02, 0xED, 0x25, 0xF9 },
-  { "BMI $FB75                       ", 0xFB37, 0x56, 0x02, 0xED, 0x25, 0xF9 },
-  { "BCC $FB75                       ", 0xFB39, 0x56, 0x02, 0xED, 0x25, 0xF9 },
-  { "CMP #$56                        ", 0xFB3B, 0x56, 0x02, 0xED, 0x25, 0xF9 },
-  { "BNE $FB75                       ", 0xFB3D, 0x56, 0x02, 0xED, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB3F, 0x56, 0x02, 0xED, 0x27, 0xF9 },
-  { "LDA $47 = 14                    ", 0xF360, 0x56, 0x02, 0xED, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF362, 0x14, 0x02, 0xED, 0x25, 0xFB },
-  { "BEQ $F368                       ", 0xF364, 0x14, 0x02, 0xED, 0x27, 0xFB },
-  { "INY                             ", 0xF368, 0x14, 0x02, 0xED, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF369, 0x14, 0x02, 0xEE, 0xA5, 0xFB },
-  { "STA $47 = 14                    ", 0xF36B, 0x37, 0x02, 0xEE, 0x25, 0xFB },
-  { "JSR $FB40                       ", 0xF36D, 0x37, 0x02, 0xEE, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB40, 0x37, 0x02, 0xEE, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB42, 0x37, 0x02, 0xEE, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB43, 0x37, 0x02, 0xEE, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB45, 0x75, 0x02, 0xEE, 0x65, 0xF9 },
-  { "SRE $47 = 37                    ", 0xF370, 0x75, 0x02, 0xEE, 0x65, 0xFB },
-  { "NOP                             ", 0xF372, 0x6E, 0x02, 0xEE, 0x65, 0xFB },
-  { "NOP                             ", 0xF373, 0x6E, 0x02, 0xEE, 0x65, 0xFB },
-  { "NOP                             ", 0xF374, 0x6E, 0x02, 0xEE, 0x65, 0xFB },
-  { "NOP                             ", 0xF375, 0x6E, 0x02, 0xEE, 0x65, 0xFB },
-  { "JSR $FB46                       ", 0xF376, 0x6E, 0x02, 0xEE, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB46, 0x6E, 0x02, 0xEE, 0x65, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB48, 0x6E, 0x02, 0xEE, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB4A, 0x6E, 0x02, 0xEE, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB4C, 0x6E, 0x02, 0xEE, 0x65, 0xF9 },
-  { "CMP #$6E                        ", 0xFB4E, 0x6E, 0x02, 0xEE, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB50, 0x6E, 0x02, 0xEE, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB52, 0x6E, 0x02, 0xEE, 0x67, 0xF9 },
-  { "LDA $47 = 1B                    ", 0xF379, 0x6E, 0x02, 0xEE, 0x67, 0xFB },
-  { "CMP #$1B                        ", 0xF37B, 0x1B, 0x02, 0xEE, 0x65, 0xFB },
-  { "BEQ $F381                       ", 0xF37D, 0x1B, 0x02, 0xEE, 0x67, 0xFB },
-  { "INY                             ", 0xF381, 0x1B, 0x02, 0xEE, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xF382, 0x1B, 0x02, 0xEF, 0xE5, 0xFB },
-  { "STA $0647 = 1B                  ", 0xF384, 0xA5, 0x02, 0xEF, 0xE5, 0xFB },
-  { "JSR $FB1D                       ", 0xF387, 0xA5, 0x02, 0xEF, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB1D, 0xA5, 0x02, 0xEF, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB1F, 0xA5, 0x02, 0xEF, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB20, 0xA5, 0x02, 0xEF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB22, 0xB3, 0x02, 0xEF, 0xE4, 0xF9 },
-  { "SRE $0647 = A5                  ", 0xF38A, 0xB3, 0x02, 0xEF, 0xE4, 0xFB },
-  { "NOP                             ", 0xF38D, 0xE1, 0x02, 0xEF, 0xE5, 0xFB },
-  { "NOP                             ", 0xF38E, 0xE1, 0x02, 0xEF, 0xE5, 0xFB },
-  { "NOP                             ", 0xF38F, 0xE1, 0x02, 0xEF, 0xE5, 0xFB },
-  { "NOP                             ", 0xF390, 0xE1, 0x02, 0xEF, 0xE5, 0xFB },
-  { "JSR $FB23                       ", 0xF391, 0xE1, 0x02, 0xEF, 0xE5, 0xFB },
-  { "BVC $FB75                       ", 0xFB23, 0xE1, 0x02, 0xEF, 0xE5, 0xF9 },
-  { "BCC $FB75                       ", 0xFB25, 0xE1, 0x02, 0xEF, 0xE5, 0xF9 },
-  { "BPL $FB75                       ", 0xFB27, 0xE1, 0x02, 0xEF, 0xE5, 0xF9 },
-  { "CMP #$E1                        ", 0xFB29, 0xE1, 0x02, 0xEF, 0xE5, 0xF9 },
-  { "BNE $FB75                       ", 0xFB2B, 0xE1, 0x02, 0xEF, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB2D, 0xE1, 0x02, 0xEF, 0x67, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF394, 0xE1, 0x02, 0xEF, 0x67, 0xFB },
-  { "CMP #$52                        ", 0xF397, 0x52, 0x02, 0xEF, 0x65, 0xFB },
-  { "BEQ $F39D                       ", 0xF399, 0x52, 0x02, 0xEF, 0x67, 0xFB },
-  { "INY                             ", 0xF39D, 0x52, 0x02, 0xEF, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF39E, 0x52, 0x02, 0xF0, 0xE5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF3A0, 0x29, 0x02, 0xF0, 0x65, 0xFB },
-  { "JSR $FB2E                       ", 0xF3A3, 0x29, 0x02, 0xF0, 0x65, 0xFB },
-  { "CLV                             ", 0xFB2E, 0x29, 0x02, 0xF0, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB2F, 0x29, 0x02, 0xF0, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB30, 0x29, 0x02, 0xF0, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB32, 0x42, 0x02, 0xF0, 0x24, 0xF9 },
-  { "SRE $0647 = 29                  ", 0xF3A6, 0x42, 0x02, 0xF0, 0x24, 0xFB },
-  { "NOP                             ", 0xF3A9, 0x56, 0x02, 0xF0, 0x25, 0xFB },
-  { "NOP                             ", 0xF3AA, 0x56, 0x02, 0xF0, 0x25, 0xFB },
-  { "NOP                             ", 0xF3AB, 0x56, 0x02, 0xF0, 0x25, 0xFB },
-  { "NOP                             ", 0xF3AC, 0x56, 0x02, 0xF0, 0x25, 0xFB },
-  { "JSR $FB33                       ", 0xF3AD, 0x56, 0x02, 0xF0, 0x25, 0xFB },
-  { "BVS $FB75                       ", 0xFB33, 0x56, 0x02, 0xF0, 0x25, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB35, 0x56, 0x02, 0xF0, 0x25, 0xF9 },
-  { "BMI $FB75                       ", 0xFB37, 0x56, 0x02, 0xF0, 0x25, 0xF9 },
-  { "BCC $FB75                       ", 0xFB39, 0x56, 0x02, 0xF0, 0x25, 0xF9 },
-  { "CMP #$56                        ", 0xFB3B, 0x56, 0x02, 0xF0, 0x25, 0xF9 },
-  { "BNE $FB75                       ", 0xFB3D, 0x56, 0x02, 0xF0, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB3F, 0x56, 0x02, 0xF0, 0x27, 0xF9 },
-  { "LDA $0647 = 14                  ", 0xF3B0, 0x56, 0x02, 0xF0, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF3B3, 0x14, 0x02, 0xF0, 0x25, 0xFB },
-  { "BEQ $F3B9                       ", 0xF3B5, 0x14, 0x02, 0xF0, 0x27, 0xFB },
-  { "INY                             ", 0xF3B9, 0x14, 0x02, 0xF0, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF3BA, 0x14, 0x02, 0xF1, 0xA5, 0xFB },
-  { "STA $0647 = 14                  ", 0xF3BC, 0x37, 0x02, 0xF1, 0x25, 0xFB },
-  { "JSR $FB40                       ", 0xF3BF, 0x37, 0x02, 0xF1, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB40, 0x37, 0x02, 0xF1, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB42, 0x37, 0x02, 0xF1, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB43, 0x37, 0x02, 0xF1, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB45, 0x75, 0x02, 0xF1, 0x65, 0xF9 },
-  { "SRE $0647 = 37                  ", 0xF3C2, 0x75, 0x02, 0xF1, 0x65, 0xFB },
-  { "NOP                             ", 0xF3C5, 0x6E, 0x02, 0xF1, 0x65, 0xFB },
-  { "NOP                             ", 0xF3C6, 0x6E, 0x02, 0xF1, 0x65, 0xFB },
-  { "NOP                             ", 0xF3C7, 0x6E, 0x02, 0xF1, 0x65, 0xFB },
-  { "NOP                             ", 0xF3C8, 0x6E, 0x02, 0xF1, 0x65, 0xFB },
-  { "JSR $FB46                       ", 0xF3C9, 0x6E, 0x02, 0xF1, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB46, 0x6E, 0x02, 0xF1, 0x65, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB48, 0x6E, 0x02, 0xF1, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB4A, 0x6E, 0x02, 0xF1, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB4C, 0x6E, 0x02, 0xF1, 0x65, 0xF9 },
-  { "CMP #$6E                        ", 0xFB4E, 0x6E, 0x02, 0xF1, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB50, 0x6E, 0x02, 0xF1, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB52, 0x6E, 0x02, 0xF1, 0x67, 0xF9 },
-  { "LDA $0647 = 1B                  ", 0xF3CC, 0x6E, 0x02, 0xF1, 0x67, 0xFB },
-  { "CMP #$1B                        ", 0xF3CF, 0x1B, 0x02, 0xF1, 0x65, 0xFB },
-  { "BEQ $F3D5                       ", 0xF3D1, 0x1B, 0x02, 0xF1, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xF3D5, 0x1B, 0x02, 0xF1, 0x67, 0xFB },
-  { "STA $0647 = 1B                  ", 0xF3D7, 0xA5, 0x02, 0xF1, 0xE5, 0xFB },
-  { "LDA #$48                        ", 0xF3DA, 0xA5, 0x02, 0xF1, 0xE5, 0xFB },
-  { "STA $45 = 48                    ", 0xF3DC, 0x48, 0x02, 0xF1, 0x65, 0xFB },
-  { "LDA #$05                        ", 0xF3DE, 0x48, 0x02, 0xF1, 0x65, 0xFB },
-  { "STA $46 = 05                    ", 0xF3E0, 0x05, 0x02, 0xF1, 0x65, 0xFB },
-  { "LDY #$FF                        ", 0xF3E2, 0x05, 0x02, 0xF1, 0x65, 0xFB },
-  { "JSR $FB1D                       ", 0xF3E4, 0x05, 0x02, 0xFF, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB1D, 0x05, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB1F, 0x05, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB20, 0x05, 0x02, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB22, 0xB3, 0x02, 0xFF, 0xE4, 0xF9 },
-  { "SRE ($45),Y = 0548 @ 0647 = A5  ", 0xF3E7, 0xB3, 0x02, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xF3E9, 0xE1, 0x02, 0xFF, 0xE5, 0xFB },
-  { "NOP                             ", 0xF3EA, 0xE1, 0x02, 0xFF, 0xE5, 0xFB },
-  { "PHP                             ", 0xF3EB, 0xE1, 0x02, 0xFF, 0xE5, 0xFB },
-  { "PHA                             ", 0xF3EC, 0xE1, 0x02, 0xFF, 0xE5, 0xFA },
-  { "LDY #$F2                        ", 0xF3ED, 0xE1, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "PLA                             ", 0xF3EF, 0xE1, 0x02, 0xF2, 0xE5, 0xF9 },
-  { "PLP                             ", 0xF3F0, 0xE1, 0x02, 0xF2, 0xE5, 0xFA },
-  { "JSR $FB23                       ", 0xF3F1, 0xE1, 0x02, 0xF2, 0xE5, 0xFB },
-  { "BVC $FB75                       ", 0xFB23, 0xE1, 0x02, 0xF2, 0xE5, 0xF9 },
-  { "BCC $FB75                       ", 0xFB25, 0xE1, 0x02, 0xF2, 0xE5, 0xF9 },
-  { "BPL $FB75                       ", 0xFB27, 0xE1, 0x02, 0xF2, 0xE5, 0xF9 },
-  { "CMP #$E1                        ", 0xFB29, 0xE1, 0x02, 0xF2, 0xE5, 0xF9 },
-  { "BNE $FB75                       ", 0xFB2B, 0xE1, 0x02, 0xF2, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB2D, 0xE1, 0x02, 0xF2, 0x67, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF3F4, 0xE1, 0x02, 0xF2, 0x67, 0xFB },
-  { "CMP #$52                        ", 0xF3F7, 0x52, 0x02, 0xF2, 0x65, 0xFB },
-  { "BEQ $F3FD                       ", 0xF3F9, 0x52, 0x02, 0xF2, 0x67, 0xFB },
-  { "LDY #$FF                        ", 0xF3FD, 0x52, 0x02, 0xF2, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF3FF, 0x52, 0x02, 0xFF, 0xE5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF401, 0x29, 0x02, 0xFF, 0x65, 0xFB },
-  { "JSR $FB2E                       ", 0xF404, 0x29, 0x02, 0xFF, 0x65, 0xFB },
-  { "CLV                             ", 0xFB2E, 0x29, 0x02, 0xFF, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB2F, 0x29, 0x02, 0xFF, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB30, 0x29, 0x02, 0xFF, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB32, 0x42, 0x02, 0xFF, 0x24, 0xF9 },
-  { "SRE ($45),Y = 0548 @ 0647 = 29  ", 0xF407, 0x42, 0x02, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xF409, 0x56, 0x02, 0xFF, 0x25, 0xFB },
-  { "NOP                             ", 0xF40A, 0x56, 0x02, 0xFF, 0x25, 0xFB },
-  { "PHP                             ", 0xF40B, 0x56, 0x02, 0xFF, 0x25, 0xFB },
-  { "PHA                             ", 0xF40C, 0x56, 0x02, 0xFF, 0x25, 0xFA },
-  { "LDY #$F3                        ", 0xF40D, 0x56, 0x02, 0xFF, 0x25, 0xF9 },
-  { "PLA                             ", 0xF40F, 0x56, 0x02, 0xF3, 0xA5, 0xF9 },
-  { "PLP                             ", 0xF410, 0x56, 0x02, 0xF3, 0x25, 0xFA },
-  { "JSR $FB33                       ", 0xF411, 0x56, 0x02, 0xF3, 0x25, 0xFB },
-  { "BVS $FB75                       ", 0xFB33, 0x56, 0x02, 0xF3, 0x25, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB35, 0x56, 0x02, 0xF3, 0x25, 0xF9 },
-  { "BMI $FB75                       ", 0xFB37, 0x56, 0x02, 0xF3, 0x25, 0xF9 },
-  { "BCC $FB75                       ", 0xFB39, 0x56, 0x02, 0xF3, 0x25, 0xF9 },
-  { "CMP #$56                        ", 0xFB3B, 0x56, 0x02, 0xF3, 0x25, 0xF9 },
-  { "BNE $FB75                       ", 0xFB3D, 0x56, 0x02, 0xF3, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB3F, 0x56, 0x02, 0xF3, 0x27, 0xF9 },
-  { "LDA $0647 = 14                  ", 0xF414, 0x56, 0x02, 0xF3, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF417, 0x14, 0x02, 0xF3, 0x25, 0xFB },
-  { "BEQ $F41D                       ", 0xF419, 0x14, 0x02, 0xF3, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xF41D, 0x14, 0x02, 0xF3, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF41F, 0x14, 0x02, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 14                  ", 0xF421, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "JSR $FB40                       ", 0xF424, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB40, 0x37, 0x02, 0xFF, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB42, 0x37, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB43, 0x37, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB45, 0x75, 0x02, 0xFF, 0x65, 0xF9 },
-  { "SRE ($45),Y = 0548 @ 0647 = 37  ", 0xF427, 0x75, 0x02, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xF429, 0x6E, 0x02, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xF42A, 0x6E, 0x02, 0xFF, 0x65, 0xFB },
-  { "PHP                             ", 0xF42B, 0x6E, 0x02, 0xFF, 0x65, 0xFB },
-  { "PHA                             ", 0xF42C, 0x6E, 0x02, 0xFF, 0x65, 0xFA },
-  { "LDY #$F4                        ", 0xF42D, 0x6E, 0x02, 0xFF, 0x65, 0xF9 },
-  { "PLA                             ", 0xF42F, 0x6E, 0x02, 0xF4, 0xE5, 0xF9 },
-  { "PLP                             ", 0xF430, 0x6E, 0x02, 0xF4, 0x65, 0xFA },
-  { "JSR $FB46                       ", 0xF431, 0x6E, 0x02, 0xF4, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB46, 0x6E, 0x02, 0xF4, 0x65, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB48, 0x6E, 0x02, 0xF4, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB4A, 0x6E, 0x02, 0xF4, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB4C, 0x6E, 0x02, 0xF4, 0x65, 0xF9 },
-  { "CMP #$6E                        ", 0xFB4E, 0x6E, 0x02, 0xF4, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB50, 0x6E, 0x02, 0xF4, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB52, 0x6E, 0x02, 0xF4, 0x67, 0xF9 },
-  { "LDA $0647 = 1B                  ", 0xF434, 0x6E, 0x02, 0xF4, 0x67, 0xFB },
-  { "CMP #$1B                        ", 0xF437, 0x1B, 0x02, 0xF4, 0x65, 0xFB },
-  { "BEQ $F43D                       ", 0xF439, 0x1B, 0x02, 0xF4, 0x67, 0xFB },
-  { "LDY #$F5                        ", 0xF43D, 0x1B, 0x02, 0xF4, 0x67, 0xFB },
-  { "LDX #$FF                        ", 0xF43F, 0x1B, 0x02, 0xF5, 0xE5, 0xFB },
-  { "LDA #$A5                        ", 0xF441, 0x1B, 0xFF, 0xF5, 0xE5, 0xFB },
-  { "STA $47 = 1B                    ", 0xF443, 0xA5, 0xFF, 0xF5, 0xE5, 0xFB },
-  { "JSR $FB1D                       ", 0xF445, 0xA5, 0xFF, 0xF5, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB1D, 0xA5, 0xFF, 0xF5, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB1F, 0xA5, 0xFF, 0xF5, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB20, 0xA5, 0xFF, 0xF5, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB22, 0xB3, 0xFF, 0xF5, 0xE4, 0xF9 },
-  { "SRE $48,X @ 47 = A5             ", 0xF448, 0xB3, 0xFF, 0xF5, 0xE4, 0xFB },
-  { "NOP                             ", 0xF44A, 0xE1, 0xFF, 0xF5, 0xE5, 0xFB },
-  { "NOP                             ", 0xF44B, 0xE1, 0xFF, 0xF5, 0xE5, 0xFB },
-  { "NOP                             ", 0xF44C, 0xE1, 0xFF, 0xF5, 0xE5, 0xFB },
-  { "NOP                             ", 0xF44D, 0xE1, 0xFF, 0xF5, 0xE5, 0xFB },
-  { "JSR $FB23                       ", 0xF44E, 0xE1, 0xFF, 0xF5, 0xE5, 0xFB },
-  { "BVC $FB75                       ", 0xFB23, 0xE1, 0xFF, 0xF5, 0xE5, 0xF9 },
-  { "BCC $FB75                       ", 0xFB25, 0xE1, 0xFF, 0xF5, 0xE5, 0xF9 },
-  { "BPL $FB75                       ", 0xFB27, 0xE1, 0xFF, 0xF5, 0xE5, 0xF9 },
-  { "CMP #$E1                        ", 0xFB29, 0xE1, 0xFF, 0xF5, 0xE5, 0xF9 },
-  { "BNE $FB75                       ", 0xFB2B, 0xE1, 0xFF, 0xF5, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB2D, 0xE1, 0xFF, 0xF5, 0x67, 0xF9 },
-  { "LDA $47 = 52                    ", 0xF451, 0xE1, 0xFF, 0xF5, 0x67, 0xFB },
-  { "CMP #$52                        ", 0xF453, 0x52, 0xFF, 0xF5, 0x65, 0xFB },
-  { "BEQ $F459                       ", 0xF455, 0x52, 0xFF, 0xF5, 0x67, 0xFB },
-  { "INY                             ", 0xF459, 0x52, 0xFF, 0xF5, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF45A, 0x52, 0xFF, 0xF6, 0xE5, 0xFB },
-  { "STA $47 = 52                    ", 0xF45C, 0x29, 0xFF, 0xF6, 0x65, 0xFB },
-  { "JSR $FB2E                       ", 0xF45E, 0x29, 0xFF, 0xF6, 0x65, 0xFB },
-  { "CLV                             ", 0xFB2E, 0x29, 0xFF, 0xF6, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB2F, 0x29, 0xFF, 0xF6, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB30, 0x29, 0xFF, 0xF6, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB32, 0x42, 0xFF, 0xF6, 0x24, 0xF9 },
-  { "SRE $48,X @ 47 = 29             ", 0xF461, 0x42, 0xFF, 0xF6, 0x24, 0xFB },
-  { "NOP                             ", 0xF463, 0x56, 0xFF, 0xF6, 0x25, 0xFB },
-  { "NOP                             ", 0xF464, 0x56, 0xFF, 0xF6, 0x25, 0xFB },
-  { "NOP                             ", 0xF465, 0x56, 0xFF, 0xF6, 0x25, 0xFB },
-  { "NOP                             ", 0xF466, 0x56, 0xFF, 0xF6, 0x25, 0xFB },
-  { "JSR $FB33                       ", 0xF467, 0x56, 0xFF, 0xF6, 0x25, 0xFB },
-  { "BVS $FB75                       ", 0xFB33, 0x56, 0xFF, 0xF6, 0x25, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB35, 0x56, 0xFF, 0xF6, 0x25, 0xF9 },
-  { "BMI $FB75                       ", 0xFB37, 0x56, 0xFF, 0xF6, 0x25, 0xF9 },
-  { "BCC $FB75                       ", 0xFB39, 0x56, 0xFF, 0xF6, 0x25, 0xF9 },
-  { "CMP #$56                        ", 0xFB3B, 0x56, 0xFF, 0xF6, 0x25, 0xF9 },
-  { "BNE $FB75                       ", 0xFB3D, 0x56, 0xFF, 0xF6, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB3F, 0x56, 0xFF, 0xF6, 0x27, 0xF9 },
-  { "LDA $47 = 14                    ", 0xF46A, 0x56, 0xFF, 0xF6, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF46C, 0x14, 0xFF, 0xF6, 0x25, 0xFB },
-  { "BEQ $F472                       ", 0xF46E, 0x14, 0xFF, 0xF6, 0x27, 0xFB },
-  { "INY                             ", 0xF472, 0x14, 0xFF, 0xF6, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF473, 0x14, 0xFF, 0xF7, 0xA5, 0xFB },
-  { "STA $47 = 14                    ", 0xF475, 0x37, 0xFF, 0xF7, 0x25, 0xFB },
-  { "JSR $FB40                       ", 0xF477, 0x37, 0xFF, 0xF7, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB40, 0x37, 0xFF, 0xF7, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB42, 0x37, 0xFF, 0xF7, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB43, 0x37, 0xFF, 0xF7, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB45, 0x75, 0xFF, 0xF7, 0x65, 0xF9 },
-  { "SRE $48,X @ 47 = 37             ", 0xF47A, 0x75, 0xFF, 0xF7, 0x65, 0xFB },
-  { "NOP                             ", 0xF47C, 0x6E, 0xFF, 0xF7, 0x65, 0xFB },
-  { "NOP                             ", 0xF47D, 0x6E, 0xFF, 0xF7, 0x65, 0xFB },
-  { "NOP                             ", 0xF47E, 0x6E, 0xFF, 0xF7, 0x65, 0xFB },
-  { "NOP                             ", 0xF47F, 0x6E, 0xFF, 0xF7, 0x65, 0xFB },
-  { "JSR $FB46                       ", 0xF480, 0x6E, 0xFF, 0xF7, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB46, 0x6E, 0xFF, 0xF7, 0x65, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB48, 0x6E, 0xFF, 0xF7, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB4A, 0x6E, 0xFF, 0xF7, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB4C, 0x6E, 0xFF, 0xF7, 0x65, 0xF9 },
-  { "CMP #$6E                        ", 0xFB4E, 0x6E, 0xFF, 0xF7, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB50, 0x6E, 0xFF, 0xF7, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB52, 0x6E, 0xFF, 0xF7, 0x67, 0xF9 },
-  { "LDA $47 = 1B                    ", 0xF483, 0x6E, 0xFF, 0xF7, 0x67, 0xFB },
-  { "CMP #$1B                        ", 0xF485, 0x1B, 0xFF, 0xF7, 0x65, 0xFB },
-  { "BEQ $F48B                       ", 0xF487, 0x1B, 0xFF, 0xF7, 0x67, 0xFB },
-  { "LDA #$A5                        ", 0xF48B, 0x1B, 0xFF, 0xF7, 0x67, 0xFB },
-  { "STA $0647 = 1B                  ", 0xF48D, 0xA5, 0xFF, 0xF7, 0xE5, 0xFB },
-  { "LDY #$FF                        ", 0xF490, 0xA5, 0xFF, 0xF7, 0xE5, 0xFB },
-  { "JSR $FB1D                       ", 0xF492, 0xA5, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB1D, 0xA5, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB1F, 0xA5, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB20, 0xA5, 0xFF, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB22, 0xB3, 0xFF, 0xFF, 0xE4, 0xF9 },
-  { "SRE $0548,Y @ 0647 = A5         ", 0xF495, 0xB3, 0xFF, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xF498, 0xE1, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "NOP                             ", 0xF499, 0xE1, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "PHP                             ", 0xF49A, 0xE1, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "PHA                             ", 0xF49B, 0xE1, 0xFF, 0xFF, 0xE5, 0xFA },
-  { "LDY #$F8                        ", 0xF49C, 0xE1, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "PLA                             ", 0xF49E, 0xE1, 0xFF, 0xF8, 0xE5, 0xF9 },
-  { "PLP                             ", 0xF49F, 0xE1, 0xFF, 0xF8, 0xE5, 0xFA },
-  { "JSR $FB23                       ", 0xF4A0, 0xE1, 0xFF, 0xF8, 0xE5, 0xFB },
-  { "BVC $FB75                       ", 0xFB23, 0xE1, 0xFF, 0xF8, 0xE5, 0xF9 },
-  { "BCC $FB75                       ", 0xFB25, 0xE1, 0xFF, 0xF8, 0xE5, 0xF9 },
-  { "BPL $FB75                       ", 0xFB27, 0xE1, 0xFF, 0xF8, 0xE5, 0xF9 },
-  { "CMP #$E1                        ", 0xFB29, 0xE1, 0xFF, 0xF8, 0xE5, 0xF9 },
-  { "BNE $FB75                       ", 0xFB2B, 0xE1, 0xFF, 0xF8, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB2D, 0xE1, 0xFF, 0xF8, 0x67, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF4A3, 0xE1, 0xFF, 0xF8, 0x67, 0xFB },
-  { "CMP #$52                        ", 0xF4A6, 0x52, 0xFF, 0xF8, 0x65, 0xFB },
-  { "BEQ $F4AC                       ", 0xF4A8, 0x52, 0xFF, 0xF8, 0x67, 0xFB },
-  { "LDY #$FF                        ", 0xF4AC, 0x52, 0xFF, 0xF8, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF4AE, 0x52, 0xFF, 0xFF, 0xE5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF4B0, 0x29, 0xFF, 0xFF, 0x65, 0xFB },
-  { "JSR $FB2E                       ", 0xF4B3, 0x29, 0xFF, 0xFF, 0x65, 0xFB },
-  { "CLV                             ", 0xFB2E, 0x29, 0xFF, 0xFF, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB2F, 0x29, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB30, 0x29, 0xFF, 0xFF, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB32, 0x42, 0xFF, 0xFF, 0x24, 0xF9 },
-  { "SRE $0548,Y @ 0647 = 29         ", 0xF4B6, 0x42, 0xFF, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xF4B9, 0x56, 0xFF, 0xFF, 0x25, 0xFB },
-  { "NOP                             ", 0xF4BA, 0x56, 0xFF, 0xFF, 0x25, 0xFB },
-  { "PHP                             ", 0xF4BB, 0x56, 0xFF, 0xFF, 0x25, 0xFB },
-  { "PHA                             ", 0xF4BC, 0x56, 0xFF, 0xFF, 0x25, 0xFA },
-  { "LDY #$F9                        ", 0xF4BD, 0x56, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "PLA                             ", 0xF4BF, 0x56, 0xFF, 0xF9, 0xA5, 0xF9 },
-  { "PLP                             ", 0xF4C0, 0x56, 0xFF, 0xF9, 0x25, 0xFA },
-  { "JSR $FB33                       ", 0xF4C1, 0x56, 0xFF, 0xF9, 0x25, 0xFB },
-  { "BVS $FB75                       ", 0xFB33, 0x56, 0xFF, 0xF9, 0x25, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB35, 0x56, 0xFF, 0xF9, 0x25, 0xF9 },
-  { "BMI $FB75                       ", 0xFB37, 0x56, 0xFF, 0xF9, 0x25, 0xF9 },
-  { "BCC $FB75                       ", 0xFB39, 0x56, 0xFF, 0xF9, 0x25, 0xF9 },
-  { "CMP #$56                        ", 0xFB3B, 0x56, 0xFF, 0xF9, 0x25, 0xF9 },
-  { "BNE $FB75                       ", 0xFB3D, 0x56, 0xFF, 0xF9, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB3F, 0x56, 0xFF, 0xF9, 0x27, 0xF9 },
-  { "LDA $0647 = 14                  ", 0xF4C4, 0x56, 0xFF, 0xF9, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF4C7, 0x14, 0xFF, 0xF9, 0x25, 0xFB },
-  { "BEQ $F4CD                       ", 0xF4C9, 0x14, 0xFF, 0xF9, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xF4CD, 0x14, 0xFF, 0xF9, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF4CF, 0x14, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 14                  ", 0xF4D1, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "JSR $FB40                       ", 0xF4D4, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB40, 0x37, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB42, 0x37, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB43, 0x37, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB45, 0x75, 0xFF, 0xFF, 0x65, 0xF9 },
-  { "SRE $0548,Y @ 0647 = 37         ", 0xF4D7, 0x75, 0xFF, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xF4DA, 0x6E, 0xFF, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xF4DB, 0x6E, 0xFF, 0xFF, 0x65, 0xFB },
-  { "PHP                             ", 0xF4DC, 0x6E, 0xFF, 0xFF, 0x65, 0xFB },
-  { "PHA                             ", 0xF4DD, 0x6E, 0xFF, 0xFF, 0x65, 0xFA },
-  { "LDY #$FA                        ", 0xF4DE, 0x6E, 0xFF, 0xFF, 0x65, 0xF9 },
-  { "PLA                             ", 0xF4E0, 0x6E, 0xFF, 0xFA, 0xE5, 0xF9 },
-  { "PLP                             ", 0xF4E1, 0x6E, 0xFF, 0xFA, 0x65, 0xFA },
-  { "JSR $FB46                       ", 0xF4E2, 0x6E, 0xFF, 0xFA, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB46, 0x6E, 0xFF, 0xFA, 0x65, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB48, 0x6E, 0xFF, 0xFA, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB4A, 0x6E, 0xFF, 0xFA, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB4C, 0x6E, 0xFF, 0xFA, 0x65, 0xF9 },
-  { "CMP #$6E                        ", 0xFB4E, 0x6E, 0xFF, 0xFA, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB50, 0x6E, 0xFF, 0xFA, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB52, 0x6E, 0xFF, 0xFA, 0x67, 0xF9 },
-  { "LDA $0647 = 1B                  ", 0xF4E5, 0x6E, 0xFF, 0xFA, 0x67, 0xFB },
-  { "CMP #$1B                        ", 0xF4E8, 0x1B, 0xFF, 0xFA, 0x65, 0xFB },
-  { "BEQ $F4EE                       ", 0xF4EA, 0x1B, 0xFF, 0xFA, 0x67, 0xFB },
-  { "LDY #$FB                        ", 0xF4EE, 0x1B, 0xFF, 0xFA, 0x67, 0xFB },
-  { "LDX #$FF                        ", 0xF4F0, 0x1B, 0xFF, 0xFB, 0xE5, 0xFB },
-  { "LDA #$A5                        ", 0xF4F2, 0x1B, 0xFF, 0xFB, 0xE5, 0xFB },
-  { "STA $0647 = 1B                  ", 0xF4F4, 0xA5, 0xFF, 0xFB, 0xE5, 0xFB },
-  { "JSR $FB1D                       ", 0xF4F7, 0xA5, 0xFF, 0xFB, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB1D, 0xA5, 0xFF, 0xFB, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFB1F, 0xA5, 0xFF, 0xFB, 0xE5, 0xF9 },
-  { "LDA #$B3                        ", 0xFB20, 0xA5, 0xFF, 0xFB, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFB22, 0xB3, 0xFF, 0xFB, 0xE4, 0xF9 },
-  { "SRE $0548,X @ 0647 = A5         ", 0xF4FA, 0xB3, 0xFF, 0xFB, 0xE4, 0xFB },
-  { "NOP                             ", 0xF4FD, 0xE1, 0xFF, 0xFB, 0xE5, 0xFB },
-  { "NOP                             ", 0xF4FE, 0xE1, 0xFF, 0xFB, 0xE5, 0xFB },
-  { "NOP                             ", 0xF4FF, 0xE1, 0xFF, 0xFB, 0xE5, 0xFB },
-  { "NOP                             ", 0xF500, 0xE1, 0xFF, 0xFB, 0xE5, 0xFB },
-  { "JSR $FB23                       ", 0xF501, 0xE1, 0xFF, 0xFB, 0xE5, 0xFB },
-  { "BVC $FB75                       ", 0xFB23, 0xE1, 0xFF, 0xFB, 0xE5, 0xF9 },
-  { "BCC $FB75                       ", 0xFB25, 0xE1, 0xFF, 0xFB, 0xE5, 0xF9 },
-  { "BPL $FB75                       ", 0xFB27, 0xE1, 0xFF, 0xFB, 0xE5, 0xF9 },
-  { "CMP #$E1                        ", 0xFB29, 0xE1, 0xFF, 0xFB, 0xE5, 0xF9 },
-  { "BNE $FB75                       ", 0xFB2B, 0xE1, 0xFF, 0xFB, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB2D, 0xE1, 0xFF, 0xFB, 0x67, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF504, 0xE1, 0xFF, 0xFB, 0x67, 0xFB },
-  { "CMP #$52                        ", 0xF507, 0x52, 0xFF, 0xFB, 0x65, 0xFB },
-  { "BEQ $F50D                       ", 0xF509, 0x52, 0xFF, 0xFB, 0x67, 0xFB },
-  { "INY                             ", 0xF50D, 0x52, 0xFF, 0xFB, 0x67, 0xFB },
-  { "LDA #$29                        ", 0xF50E, 0x52, 0xFF, 0xFC, 0xE5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF510, 0x29, 0xFF, 0xFC, 0x65, 0xFB },
-  { "JSR $FB2E                       ", 0xF513, 0x29, 0xFF, 0xFC, 0x65, 0xFB },
-  { "CLV                             ", 0xFB2E, 0x29, 0xFF, 0xFC, 0x65, 0xF9 },
-  { "CLC                             ", 0xFB2F, 0x29, 0xFF, 0xFC, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFB30, 0x29, 0xFF, 0xFC, 0x24, 0xF9 },
-  { "RTS                             ", 0xFB32, 0x42, 0xFF, 0xFC, 0x24, 0xF9 },
-  { "SRE $0548,X @ 0647 = 29         ", 0xF516, 0x42, 0xFF, 0xFC, 0x24, 0xFB },
-  { "NOP                             ", 0xF519, 0x56, 0xFF, 0xFC, 0x25, 0xFB },
-  { "NOP                             ", 0xF51A, 0x56, 0xFF, 0xFC, 0x25, 0xFB },
-  { "NOP                             ", 0xF51B, 0x56, 0xFF, 0xFC, 0x25, 0xFB },
-  { "NOP                             ", 0xF51C, 0x56, 0xFF, 0xFC, 0x25, 0xFB },
-  { "JSR $FB33                       ", 0xF51D, 0x56, 0xFF, 0xFC, 0x25, 0xFB },
-  { "BVS $FB75                       ", 0xFB33, 0x56, 0xFF, 0xFC, 0x25, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB35, 0x56, 0xFF, 0xFC, 0x25, 0xF9 },
-  { "BMI $FB75                       ", 0xFB37, 0x56, 0xFF, 0xFC, 0x25, 0xF9 },
-  { "BCC $FB75                       ", 0xFB39, 0x56, 0xFF, 0xFC, 0x25, 0xF9 },
-  { "CMP #$56                        ", 0xFB3B, 0x56, 0xFF, 0xFC, 0x25, 0xF9 },
-  { "BNE $FB75                       ", 0xFB3D, 0x56, 0xFF, 0xFC, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB3F, 0x56, 0xFF, 0xFC, 0x27, 0xF9 },
-  { "LDA $0647 = 14                  ", 0xF520, 0x56, 0xFF, 0xFC, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF523, 0x14, 0xFF, 0xFC, 0x25, 0xFB },
-  { "BEQ $F529                       ", 0xF525, 0x14, 0xFF, 0xFC, 0x27, 0xFB },
-  { "INY                             ", 0xF529, 0x14, 0xFF, 0xFC, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF52A, 0x14, 0xFF, 0xFD, 0xA5, 0xFB },
-  { "STA $0647 = 14                  ", 0xF52C, 0x37, 0xFF, 0xFD, 0x25, 0xFB },
-  { "JSR $FB40                       ", 0xF52F, 0x37, 0xFF, 0xFD, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB40, 0x37, 0xFF, 0xFD, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB42, 0x37, 0xFF, 0xFD, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB43, 0x37, 0xFF, 0xFD, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB45, 0x75, 0xFF, 0xFD, 0x65, 0xF9 },
-  { "SRE $0548,X @ 0647 = 37         ", 0xF532, 0x75, 0xFF, 0xFD, 0x65, 0xFB },
-  { "NOP                             ", 0xF535, 0x6E, 0xFF, 0xFD, 0x65, 0xFB },
-  { "NOP                             ", 0xF536, 0x6E, 0xFF, 0xFD, 0x65, 0xFB },
-  { "NOP                             ", 0xF537, 0x6E, 0xFF, 0xFD, 0x65, 0xFB },
-  { "NOP                             ", 0xF538, 0x6E, 0xFF, 0xFD, 0x65, 0xFB },
-  { "JSR $FB46                       ", 0xF539, 0x6E, 0xFF, 0xFD, 0x65, 0xFB },
-  { "BVC $FB75                       ", 0xFB46, 0x6E, 0xFF, 0xFD, 0x65, 0xF9 },
-  { "BEQ $FB75                       ", 0xFB48, 0x6E, 0xFF, 0xFD, 0x65, 0xF9 },
-  { "BMI $FB75                       ", 0xFB4A, 0x6E, 0xFF, 0xFD, 0x65, 0xF9 },
-  { "BCC $FB75                       ", 0xFB4C, 0x6E, 0xFF, 0xFD, 0x65, 0xF9 },
-  { "CMP #$6E                        ", 0xFB4E, 0x6E, 0xFF, 0xFD, 0x65, 0xF9 },
-  { "BNE $FB75                       ", 0xFB50, 0x6E, 0xFF, 0xFD, 0x67, 0xF9 },
-  { "RTS                             ", 0xFB52, 0x6E, 0xFF, 0xFD, 0x67, 0xF9 },
-  { "LDA $0647 = 1B                  ", 0xF53C, 0x6E, 0xFF, 0xFD, 0x67, 0xFB },
-  { "CMP #$1B                        ", 0xF53F, 0x1B, 0xFF, 0xFD, 0x65, 0xFB },
-  { "BEQ $F545                       ", 0xF541, 0x1B, 0xFF, 0xFD, 0x67, 0xFB },
-  { "RTS                             ", 0xF545, 0x1B, 0xFF, 0xFD, 0x67, 0xFB },
-  { "LDA $00 = 00                    ", 0xC64A, 0x1B, 0xFF, 0xFD, 0x67, 0xFD },
-  { "STA $11 = 00                    ", 0xC64C, 0x00, 0xFF, 0xFD, 0x67, 0xFD },
-  { "LDA #$00                        ", 0xC64E, 0x00, 0xFF, 0xFD, 0x67, 0xFD },
-  { "STA $00 = 00                    ", 0xC650, 0x00, 0xFF, 0xFD, 0x67, 0xFD },
-  { "JSR $F546                       ", 0xC652, 0x00, 0xFF, 0xFD, 0x67, 0xFD },
-  { "LDA #$FF                        ", 0xF546, 0x00, 0xFF, 0xFD, 0x67, 0xFB },
-  { "STA $01 = FF                    ", 0xF548, 0xFF, 0xFF, 0xFD, 0xE5, 0xFB },
-  { "LDY #$01                        ", 0xF54A, 0xFF, 0xFF, 0xFD, 0xE5, 0xFB },
-  { "LDX #$02                        ", 0xF54C, 0xFF, 0xFF, 0x01, 0x65, 0xFB },
-  { "LDA #$47                        ", 0xF54E, 0xFF, 0x02, 0x01, 0x65, 0xFB },
-  { "STA $47 = 1B                    ", 0xF550, 0x47, 0x02, 0x01, 0x65, 0xFB },
-  { "LDA #$06                        ", 0xF552, 0x47, 0x02, 0x01, 0x65, 0xFB },
-  { "STA $48 = 06                    ", 0xF554, 0x06, 0x02, 0x01, 0x65, 0xFB },
-  { "LDA #$A5                        ", 0xF556, 0x06, 0x02, 0x01, 0x65, 0xFB },
-  { "STA $0647 = 1B                  ", 0xF558, 0xA5, 0x02, 0x01, 0xE5, 0xFB },
-  { "JSR $FAE9                       ", 0xF55B, 0xA5, 0x02, 0x01, 0xE5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAE9, 0xA5, 0x02, 0x01, 0xE5, 0xF9 },
-  { "CLC                             ", 0xFAEB, 0xA5, 0x02, 0x01, 0xE5, 0xF9 },
-  { "LDA #$B2                        ", 0xFAEC, 0xA5, 0x02, 0x01, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAEE, 0xB2, 0x02, 0x01, 0xE4, 0xF9 },
-  { "RRA ($45,X) @ 47 = 0647 = A5    ", 0xF55E, 0xB2, 0x02, 0x01, 0xE4, 0xFB },
-  { "NOP                             ", 0xF560, 0x05, 0x02, 0x01, 0x25, 0xFB },
-  { "NOP                             ", 0xF561, 0x05, 0x02, 0x01, 0x25, 0xFB },
-  { "NOP                             ", 0xF562, 0x05, 0x02, 0x01, 0x25, 0xFB },
-  { "NOP                             ", 0xF563, 0x05, 0x02, 0x01, 0x25, 0xFB },
-  { "JSR $FAEF                       ", 0xF564, 0x05, 0x02, 0x01, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFAEF, 0x05, 0x02, 0x01, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFAF1, 0x05, 0x02, 0x01, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFAF3, 0x05, 0x02, 0x01, 0x25, 0xF9 },
-  { "CMP #$05                        ", 0xFAF5, 0x05, 0x02, 0x01, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFAF7, 0x05, 0x02, 0x01, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAF9, 0x05, 0x02, 0x01, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF567, 0x05, 0x02, 0x01, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF56A, 0x52, 0x02, 0x01, 0x25, 0xFB },
-  { "BEQ $F570                       ", 0xF56C, 0x52, 0x02, 0x01, 0x27, 0xFB },
-  { "INY                             ", 0xF570, 0x52, 0x02, 0x01, 0x27, 0xFB },
-  { "LDA #$29                        ", 0xF571, 0x52, 0x02, 0x02, 0x25, 0xFB },
-  { "STA $0647 = 52                  ", 0xF573, 0x29, 0x02, 0x02, 0x25, 0xFB },
-  { "JSR $FAFA                       ", 0xF576, 0x29, 0x02, 0x02, 0x25, 0xFB },
-  { "CLV                             ", 0xFAFA, 0x29, 0x02, 0x02, 0x25, 0xF9 },
-  { "CLC                             ", 0xFAFB, 0x29, 0x02, 0x02, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFAFC, 0x29, 0x02, 0x02, 0x24, 0xF9 },
-  { "RTS                             ", 0xFAFE, 0x42, 0x02, 0x02, 0x24, 0xF9 },
-  { "RRA ($45,X) @ 47 = 0647 = 29    ", 0xF579, 0x42, 0x02, 0x02, 0x24, 0xFB },
-  { "NOP                             ", 0xF57B, 0x57, 0x02, 0x02, 0x24, 0xFB },
-  { "NOP                             ", 0xF57C, 0x57, 0x02, 0x02, 0x24, 0xFB },
-  { "NOP                             ", 0xF57D, 0x57, 0x02, 0x02, 0x24, 0xFB },
-  { "NOP                             ", 0xF57E, 0x57, 0x02, 0x02, 0x24, 0xFB },
-  { "JSR $FAFF                       ", 0xF57F, 0x57, 0x02, 0x02, 0x24, 0xFB },
-  { "BVS $FB1B                       ", 0xFAFF, 0x57, 0x02, 0x02, 0x24, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB01, 0x57, 0x02, 0x02, 0x24, 0xF9 },
-  { "BCS $FB1B                       ", 0xFB03, 0x57, 0x02, 0x02, 0x24, 0xF9 },
-  { "CMP #$57                        ", 0xFB05, 0x57, 0x02, 0x02, 0x24, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB07, 0x57, 0x02, 0x02, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB09, 0x57, 0x02, 0x02, 0x27, 0xF9 },
-  { "LDA $0647 = 14                  ", 0xF582, 0x57, 0x02, 0x02, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF585, 0x14, 0x02, 0x02, 0x25, 0xFB },
-  { "BEQ $F58B                       ", 0xF587, 0x14, 0x02, 0x02, 0x27, 0xFB },
-  { "INY                             ", 0xF58B, 0x14, 0x02, 0x02, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF58C, 0x14, 0x02, 0x03, 0x25, 0xFB },
-  { "STA $0647 = 14                  ", 0xF58E, 0x37, 0x02, 0x03, 0x25, 0xFB },
-  { "JSR $FB0A                       ", 0xF591, 0x37, 0x02, 0x03, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB0A, 0x37, 0x02, 0x03, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB0C, 0x37, 0x02, 0x03, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB0D, 0x37, 0x02, 0x03, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB0F, 0x75, 0x02, 0x03, 0x65, 0xF9 },
-  { "RRA ($45,X) @ 47 = 0647 = 37    ", 0xF594, 0x75, 0x02, 0x03, 0x65, 0xFB },
-  { "NOP                             ", 0xF596, 0x11, 0x02, 0x03, 0x25, 0xFB },
-  { "NOP                             ", 0xF597, 0x11, 0x02, 0x03, 0x25, 0xFB },
-  { "NOP                             ", 0xF598, 0x11, 0x02, 0x03, 0x25, 0xFB },
-  { "NOP                             ", 0xF599, 0x11, 0x02, 0x03, 0x25, 0xFB },
-  { "JSR $FB10                       ", 0xF59A, 0x11, 0x02, 0x03, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFB10, 0x11, 0x02, 0x03, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB12, 0x11, 0x02, 0x03, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFB14, 0x11, 0x02, 0x03, 0x25, 0xF9 },
-  { "CMP #$11                        ", 0xFB16, 0x11, 0x02, 0x03, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB18, 0x11, 0x02, 0x03, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB1A, 0x11, 0x02, 0x03, 0x27, 0xF9 },
-  { "LDA $0647 = 9B                  ", 0xF59D, 0x11, 0x02, 0x03, 0x27, 0xFB },
-  { "CMP #$9B                        ", 0xF5A0, 0x9B, 0x02, 0x03, 0xA5, 0xFB },
-  { "BEQ $F5A6                       ", 0xF5A2, 0x9B, 0x02, 0x03, 0x27, 0xFB },
-  { "INY                             ", 0xF5A6, 0x9B, 0x02, 0x03, 0x27, 0xFB },
-  { "LDA #$A5                        ", 0xF5A7, 0x9B, 0x02, 0x04, 0x25, 0xFB },
-  { "STA $47 = 47                    ", 0xF5A9, 0xA5, 0x02, 0x04, 0xA5, 0xFB },
-  { "JSR $FAE9                       ", 0xF5AB, 0xA5, 0x02, 0x04, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAE9, 0xA5, 0x02, 0x04, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAEB, 0xA5, 0x02, 0x04, 0xE5, 0xF9 },
-  { "LDA #$B2                        ", 0xFAEC, 0xA5, 0x02, 0x04, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAEE, 0xB2, 0x02, 0x04, 0xE4, 0xF9 },
-  { "RRA $47 = A5                    ", 0xF5AE, 0xB2, 0x02, 0x04, 0xE4, 0xFB },
-  { "NOP                             ", 0xF5B0, 0x05, 0x02, 0x04, 0x25, 0xFB },
-  { "NOP                             ", 0xF5B1, 0x05, 0x02, 0x04, 0x25, 0xFB },
-  { "NOP                             ", 0xF5B2, 0x05, 0x02, 0x04, 0x25, 0xFB },
-  { "NOP                             ", 0xF5B3, 0x05, 0x02, 0x04, 0x25, 0xFB },
-  { "JSR $FAEF                       ", 0xF5B4, 0x05, 0x02, 0x04, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFAEF, 0x05, 0x02, 0x04, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFAF1, 0x05, 0x02, 0x04, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFAF3, 0x05, 0x02, 0x04, 0x25, 0xF9 },
-  { "CMP #$05                        ", 0xFAF5, 0x05, 0x02, 0x04, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFAF7, 0x05, 0x02, 0x04, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAF9, 0x05, 0x02, 0x04, 0x27, 0xF9 },
-  { "LDA $47 = 52                    ", 0xF5B7, 0x05, 0x02, 0x04, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF5B9, 0x52, 0x02, 0x04, 0x25, 0xFB },
-  { "BEQ $F5BF                       ", 0xF5BB, 0x52, 0x02, 0x04, 0x27, 0xFB },
-  { "INY                             ", 0xF5BF, 0x52, 0x02, 0x04, 0x27, 0xFB },
-  { "LDA #$29                        ", 0xF5C0, 0x52, 0x02, 0x05, 0x25, 0xFB },
-  { "STA $47 = 52                    ", 0xF5C2, 0x29, 0x02, 0x05, 0x25, 0xFB },
-  { "JSR $FAFA                       ", 0xF5C4, 0x29, 0x02, 0x05, 0x25, 0xFB },
-  { "CLV                             ", 0xFAFA, 0x29, 0x02, 0x05, 0x25, 0xF9 },
-  { "CLC                             ", 0xFAFB, 0x29, 0x02, 0x05, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFAFC, 0x29, 0x02, 0x05, 0x24, 0xF9 },
-  { "RTS                             ", 0xFAFE, 0x42, 0x02, 0x05, 0x24, 0xF9 },
-  { "RRA $47 = 29                    ", 0xF5C7, 0x42, 0x02, 0x05, 0x24, 0xFB },
-  { "NOP                             ", 0xF5C9, 0x57, 0x02, 0x05, 0x24, 0xFB },
-  { "NOP                             ", 0xF5CA, 0x57, 0x02, 0x05, 0x24, 0xFB },
-  { "NOP                             ", 0xF5CB, 0x57, 0x02, 0x05, 0x24, 0xFB },
-  { "NOP                             ", 0xF5CC, 0x57, 0x02, 0x05, 0x24, 0xFB },
-  { "JSR $FAFF                       ", 0xF5CD, 0x57, 0x02, 0x05, 0x24, 0xFB },
-  { "BVS $FB1B                       ", 0xFAFF, 0x57, 0x02, 0x05, 0x24, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB01, 0x57, 0x02, 0x05, 0x24, 0xF9 },
-  { "BCS $FB1B                       ", 0xFB03, 0x57, 0x02, 0x05, 0x24, 0xF9 },
-  { "CMP #$57                        ", 0xFB05, 0x57, 0x02, 0x05, 0x24, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB07, 0x57, 0x02, 0x05, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB09, 0x57, 0x02, 0x05, 0x27, 0xF9 },
-  { "LDA $47 = 14                    ", 0xF5D0, 0x57, 0x02, 0x05, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF5D2, 0x14, 0x02, 0x05, 0x25, 0xFB },
-  { "BEQ $F5D8                       ", 0xF5D4, 0x14, 0x02, 0x05, 0x27, 0xFB },
-  { "INY                             ", 0xF5D8, 0x14, 0x02, 0x05, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF5D9, 0x14, 0x02, 0x06, 0x25, 0xFB },
-  { "STA $47 = 14                    ", 0xF5DB, 0x37, 0x02, 0x06, 0x25, 0xFB },
-  { "JSR $FB0A                       ", 0xF5DD, 0x37, 0x02, 0x06, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB0A, 0x37, 0x02, 0x06, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB0C, 0x37, 0x02, 0x06, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB0D, 0x37, 0x02, 0x06, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB0F, 0x75, 0x02, 0x06, 0x65, 0xF9 },
-  { "RRA $47 = 37                    ", 0xF5E0, 0x75, 0x02, 0x06, 0x65, 0xFB },
-  { "NOP                             ", 0xF5E2, 0x11, 0x02, 0x06, 0x25, 0xFB },
-  { "NOP                             ", 0xF5E3, 0x11, 0x02, 0x06, 0x25, 0xFB },
-  { "NOP                             ", 0xF5E4, 0x11, 0x02, 0x06, 0x25, 0xFB },
-  { "NOP                             ", 0xF5E5, 0x11, 0x02, 0x06, 0x25, 0xFB },
-  { "JSR $FB10                       ", 0xF5E6, 0x11, 0x02, 0x06, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFB10, 0x11, 0x02, 0x06, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB12, 0x11, 0x02, 0x06, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFB14, 0x11, 0x02, 0x06, 0x25, 0xF9 },
-  { "CMP #$11                        ", 0xFB16, 0x11, 0x02, 0x06, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB18, 0x11, 0x02, 0x06, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB1A, 0x11, 0x02, 0x06, 0x27, 0xF9 },
-  { "LDA $47 = 9B                    ", 0xF5E9, 0x11, 0x02, 0x06, 0x27, 0xFB },
-  { "CMP #$9B                        ", 0xF5EB, 0x9B, 0x02, 0x06, 0xA5, 0xFB },
-  { "BEQ $F5F1                       ", 0xF5ED, 0x9B, 0x02, 0x06, 0x27, 0xFB },
-  { "INY                             ", 0xF5F1, 0x9B, 0x02, 0x06, 0x27, 0xFB },
-  { "LDA #$A5                        ", 0xF5F2, 0x9B, 0x02, 0x07, 0x25, 0xFB },
-  { "STA $0647 = 9B                  ", 0xF5F4, 0xA5, 0x02, 0x07, 0xA5, 0xFB },
-  { "JSR $FAE9                       ", 0xF5F7, 0xA5, 0x02, 0x07, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAE9, 0xA5, 0x02, 0x07, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAEB, 0xA5, 0x02, 0x07, 0xE5, 0xF9 },
-  { "LDA #$B2                        ", 0xFAEC, 0xA5, 0x02, 0x07, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAEE, 0xB2, 0x02, 0x07, 0xE4, 0xF9 },
-  { "RRA $0647 = A5                  ", 0xF5FA, 0xB2, 0x02, 0x07, 0xE4, 0xFB },
-  { "NOP                             ", 0xF5FD, 0x05, 0x02, 0x07, 0x25, 0xFB },
-  { "NOP                             ", 0xF5FE, 0x05, 0x02, 0x07, 0x25, 0xFB },
-  { "NOP                             ", 0xF5FF, 0x05, 0x02, 0x07, 0x25, 0xFB },
-  { "NOP                             ", 0xF600, 0x05, 0x02, 0x07, 0x25, 0xFB },
-  { "JSR $FAEF                       ", 0xF601, 0x05, 0x02, 0x07, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFAEF, 0x05, 0x02, 0x07, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFAF1, 0x05, 0x02, 0x07, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFAF3, 0x05, 0x02, 0x07, 0x25, 0xF9 },
-  { "CMP #$05                        ", 0xFAF5, 0x05, 0x02, 0x07, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFAF7, 0x05, 0x02, 0x07, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAF9, 0x05, 0x02, 0x07, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF604, 0x05, 0x02, 0x07, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF607, 0x52, 0x02, 0x07, 0x25, 0xFB },
-  { "BEQ $F60D                       ", 0xF609, 0x52, 0x02, 0x07, 0x27, 0xFB },
-  { "INY                             ", 0xF60D, 0x52, 0x02, 0x07, 0x27, 0xFB },
-  { "LDA #$29                        ", 0xF60E, 0x52, 0x02, 0x08, 0x25, 0xFB },
-  { "STA $0647 = 52                  ", 0xF610, 0x29, 0x02, 0x08, 0x25, 0xFB },
-  { "JSR $FAFA                       ", 0xF613, 0x29, 0x02, 0x08, 0x25, 0xFB },
-  { "CLV                             ", 0xFAFA, 0x29, 0x02, 0x08, 0x25, 0xF9 },
-  { "CLC                             ", 0xFAFB, 0x29, 0x02, 0x08, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFAFC, 0x29, 0x02, 0x08, 0x24, 0xF9 },
-  { "RTS                             ", 0xFAFE, 0x42, 0x02, 0x08, 0x24, 0xF9 },
-  { "RRA $0647 = 29                  ", 0xF616, 0x42, 0x02, 0x08, 0x24, 0xFB },
-  { "NOP                             ", 0xF619, 0x57, 0x02, 0x08, 0x24, 0xFB },
-  { "NOP                             ", 0xF61A, 0x57, 0x02, 0x08, 0x24, 0xFB },
-  { "NOP                             ", 0xF61B, 0x57, 0x02, 0x08, 0x24, 0xFB },
-  { "NOP                             ", 0xF61C, 0x57, 0x02, 0x08, 0x24, 0xFB },
-  { "JSR $FAFF                       ", 0xF61D, 0x57, 0x02, 0x08, 0x24, 0xFB },
-  { "BVS $FB1B                       ", 0xFAFF, 0x57, 0x02, 0x08, 0x24, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB01, 0x57, 0x02, 0x08, 0x24, 0xF9 },
-  { "BCS $FB1B                       ", 0xFB03, 0x57, 0x02, 0x08, 0x24, 0xF9 },
-  { "CMP #$57                        ", 0xFB05, 0x57, 0x02, 0x08, 0x24, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB07, 0x57, 0x02, 0x08, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB09, 0x57, 0x02, 0x08, 0x27, 0xF9 },
-  { "LDA $0647 = 14                  ", 0xF620, 0x57, 0x02, 0x08, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF623, 0x14, 0x02, 0x08, 0x25, 0xFB },
-  { "BEQ $F629                       ", 0xF625, 0x14, 0x02, 0x08, 0x27, 0xFB },
-  { "INY                             ", 0xF629, 0x14, 0x02, 0x08, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF62A, 0x14, 0x02, 0x09, 0x25, 0xFB },
-  { "STA $0647 = 14                  ", 0xF62C, 0x37, 0x02, 0x09, 0x25, 0xFB },
-  { "JSR $FB0A                       ", 0xF62F, 0x37, 0x02, 0x09, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB0A, 0x37, 0x02, 0x09, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB0C, 0x37, 0x02, 0x09, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB0D, 0x37, 0x02, 0x09, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB0F, 0x75, 0x02, 0x09, 0x65, 0xF9 },
-  { "RRA $0647 = 37                  ", 0xF632, 0x75, 0x02, 0x09, 0x65, 0xFB },
-  { "NOP                             ", 0xF635, 0x11, 0x02, 0x09, 0x25, 0xFB },
-  { "NOP                             ", 0xF636, 0x11, 0x02, 0x09, 0x25, 0xFB },
-  { "NOP                             ", 0xF637, 0x11, 0x02, 0x09, 0x25, 0xFB },
-  { "NOP                             ", 0xF638, 0x11, 0x02, 0x09, 0x25, 0xFB },
-  { "JSR $FB10                       ", 0xF639, 0x11, 0x02, 0x09, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFB10, 0x11, 0x02, 0x09, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB12, 0x11, 0x02, 0x09, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFB14, 0x11, 0x02, 0x09, 0x25, 0xF9 },
-  { "CMP #$11                        ", 0xFB16, 0x11, 0x02, 0x09, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB18, 0x11, 0x02, 0x09, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB1A, 0x11, 0x02, 0x09, 0x27, 0xF9 },
-  { "LDA $0647 = 9B                  ", 0xF63C, 0x11, 0x02, 0x09, 0x27, 0xFB },
-  { "CMP #$9B                        ", 0xF63F, 0x9B, 0x02, 0x09, 0xA5, 0xFB },
-  { "BEQ $F645                       ", 0xF641, 0x9B, 0x02, 0x09, 0x27, 0xFB },
-  { "LDA #$A5                        ", 0xF645, 0x9B, 0x02, 0x09, 0x27, 0xFB },
-  { "STA $0647 = 9B                  ", 0xF647, 0xA5, 0x02, 0x09, 0xA5, 0xFB },
-  { "LDA #$48                        ", 0xF64A, 0xA5, 0x02, 0x09, 0xA5, 0xFB },
-  { "STA $45 = 48                    ", 0xF64C, 0x48, 0x02, 0x09, 0x25, 0xFB },
-  { "LDA #$05                        ", 0xF64E, 0x48, 0x02, 0x09, 0x25, 0xFB },
-  { "STA $46 = 05                    ", 0xF650, 0x05, 0x02, 0x09, 0x25, 0xFB },
-  { "LDY #$FF                        ", 0xF652, 0x05, 0x02, 0x09, 0x25, 0xFB },
-  { "JSR $FAE9                       ", 0xF654, 0x05, 0x02, 0xFF, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAE9, 0x05, 0x02, 0xFF, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAEB, 0x05, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$B2                        ", 0xFAEC, 0x05, 0x02, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAEE, 0xB2, 0x02, 0xFF, 0xE4, 0xF9 },
-  { "RRA ($45),Y = 0548 @ 0647 = A5  ", 0xF657, 0xB2, 0x02, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xF659, 0x05, 0x02, 0xFF, 0x25, 0xFB },
-  { "NOP                             ", 0xF65A, 0x05, 0x02, 0xFF, 0x25, 0xFB },
-  { "PHP                             ", 0xF65B, 0x05, 0x02, 0xFF, 0x25, 0xFB },
-  { "PHA                             ", 0xF65C, 0x05, 0x02, 0xFF, 0x25, 0xFA },
-  { "LDY #$0A                        ", 0xF65D, 0x05, 0x02, 0xFF, 0x25, 0xF9 },
-  { "PLA                             ", 0xF65F, 0x05, 0x02, 0x0A, 0x25, 0xF9 },
-  { "PLP                             ", 0xF660, 0x05, 0x02, 0x0A, 0x25, 0xFA },
-  { "JSR $FAEF                       ", 0xF661, 0x05, 0x02, 0x0A, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFAEF, 0x05, 0x02, 0x0A, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFAF1, 0x05, 0x02, 0x0A, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFAF3, 0x05, 0x02, 0x0A, 0x25, 0xF9 },
-  { "CMP #$05                        ", 0xFAF5, 0x05, 0x02, 0x0A, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFAF7, 0x05, 0x02, 0x0A, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAF9, 0x05, 0x02, 0x0A, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF664, 0x05, 0x02, 0x0A, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF667, 0x52, 0x02, 0x0A, 0x25, 0xFB },
-  { "BEQ $F66D                       ", 0xF669, 0x52, 0x02, 0x0A, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xF66D, 0x52, 0x02, 0x0A, 0x27, 0xFB },
-  { "LDA #$29                        ", 0xF66F, 0x52, 0x02, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF671, 0x29, 0x02, 0xFF, 0x25, 0xFB },
-  { "JSR $FAFA                       ", 0xF674, 0x29, 0x02, 0xFF, 0x25, 0xFB },
-  { "CLV                             ", 0xFAFA, 0x29, 0x02, 0xFF, 0x25, 0xF9 },
-  { "CLC                             ", 0xFAFB, 0x29, 0x02, 0xFF, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFAFC, 0x29, 0x02, 0xFF, 0x24, 0xF9 },
-  { "RTS                             ", 0xFAFE, 0x42, 0x02, 0xFF, 0x24, 0xF9 },
-  { "RRA ($45),Y = 0548 @ 0647 = 29  ", 0xF677, 0x42, 0x02, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xF679, 0x57, 0x02, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xF67A, 0x57, 0x02, 0xFF, 0x24, 0xFB },
-  { "PHP                             ", 0xF67B, 0x57, 0x02, 0xFF, 0x24, 0xFB },
-  { "PHA                             ", 0xF67C, 0x57, 0x02, 0xFF, 0x24, 0xFA },
-  { "LDY #$0B                        ", 0xF67D, 0x57, 0x02, 0xFF, 0x24, 0xF9 },
-  { "PLA                             ", 0xF67F, 0x57, 0x02, 0x0B, 0x24, 0xF9 },
-  { "PLP                             ", 0xF680, 0x57, 0x02, 0x0B, 0x24, 0xFA },
-  { "JSR $FAFF                       ", 0xF681, 0x57, 0x02, 0x0B, 0x24, 0xFB },
-  { "BVS $FB1B                       ", 0xFAFF, 0x57, 0x02, 0x0B, 0x24, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB01, 0x57, 0x02, 0x0B, 0x24, 0xF9 },
-  { "BCS $FB1B                       ", 0xFB03, 0x57, 0x02, 0x0B, 0x24, 0xF9 },
-  { "CMP #$57                        ", 0xFB05, 0x57, 0x02, 0x0B, 0x24, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB07, 0x57, 0x02, 0x0B, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB09, 0x57, 0x02, 0x0B, 0x27, 0xF9 },
-  { "LDA $0647 = 14                  ", 0xF684, 0x57, 0x02, 0x0B, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF687, 0x14, 0x02, 0x0B, 0x25, 0xFB },
-  { "BEQ $F68D                       ", 0xF689, 0x14, 0x02, 0x0B, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xF68D, 0x14, 0x02, 0x0B, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF68F, 0x14, 0x02, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 14                  ", 0xF691, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "JSR $FB0A                       ", 0xF694, 0x37, 0x02, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB0A, 0x37, 0x02, 0xFF, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB0C, 0x37, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB0D, 0x37, 0x02, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB0F, 0x75, 0x02, 0xFF, 0x65, 0xF9 },
-  { "RRA ($45),Y = 0548 @ 0647 = 37  ", 0xF697, 0x75, 0x02, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xF699, 0x11, 0x02, 0xFF, 0x25, 0xFB },
-  { "NOP                             ", 0xF69A, 0x11, 0x02, 0xFF, 0x25, 0xFB },
-  { "PHP                             ", 0xF69B, 0x11, 0x02, 0xFF, 0x25, 0xFB },
-  { "PHA                             ", 0xF69C, 0x11, 0x02, 0xFF, 0x25, 0xFA },
-  { "LDY #$0C                        ", 0xF69D, 0x11, 0x02, 0xFF, 0x25, 0xF9 },
-  { "PLA                             ", 0xF69F, 0x11, 0x02, 0x0C, 0x25, 0xF9 },
-  { "PLP                             ", 0xF6A0, 0x11, 0x02, 0x0C, 0x25, 0xFA },
-  { "JSR $FB10                       ", 0xF6A1, 0x11, 0x02, 0x0C, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFB10, 0x11, 0x02, 0x0C, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB12, 0x11, 0x02, 0x0C, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFB14, 0x11, 0x02, 0x0C, 0x25, 0xF9 },
-  { "CMP #$11                        ", 0xFB16, 0x11, 0x02, 0x0C, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB18, 0x11, 0x02, 0x0C, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB1A, 0x11, 0x02, 0x0C, 0x27, 0xF9 },
-  { "LDA $0647 = 9B                  ", 0xF6A4, 0x11, 0x02, 0x0C, 0x27, 0xFB },
-  { "CMP #$9B                        ", 0xF6A7, 0x9B, 0x02, 0x0C, 0xA5, 0xFB },
-  { "BEQ $F6AD                       ", 0xF6A9, 0x9B, 0x02, 0x0C, 0x27, 0xFB },
-  { "LDY #$0D                        ", 0xF6AD, 0x9B, 0x02, 0x0C, 0x27, 0xFB },
-  { "LDX #$FF                        ", 0xF6AF, 0x9B, 0x02, 0x0D, 0x25, 0xFB },
-  { "LDA #$A5                        ", 0xF6B1, 0x9B, 0xFF, 0x0D, 0xA5, 0xFB },
-  { "STA $47 = 9B                    ", 0xF6B3, 0xA5, 0xFF, 0x0D, 0xA5, 0xFB },
-  { "JSR $FAE9                       ", 0xF6B5, 0xA5, 0xFF, 0x0D, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAE9, 0xA5, 0xFF, 0x0D, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAEB, 0xA5, 0xFF, 0x0D, 0xE5, 0xF9 },
-  { "LDA #$B2                        ", 0xFAEC, 0xA5, 0xFF, 0x0D, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAEE, 0xB2, 0xFF, 0x0D, 0xE4, 0xF9 },
-  { "RRA $48,X @ 47 = A5             ", 0xF6B8, 0xB2, 0xFF, 0x0D, 0xE4, 0xFB },
-  { "NOP                             ", 0xF6BA, 0x05, 0xFF, 0x0D, 0x25, 0xFB },
-  { "NOP                             ", 0xF6BB, 0x05, 0xFF, 0x0D, 0x25, 0xFB },
-  { "NOP                             ", 0xF6BC, 0x05, 0xFF, 0x0D, 0x25, 0xFB },
-  { "NOP                             ", 0xF6BD, 0x05, 0xFF, 0x0D, 0x25, 0xFB },
-  { "JSR $FAEF                       ", 0xF6BE, 0x05, 0xFF, 0x0D, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFAEF, 0x05, 0xFF, 0x0D, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFAF1, 0x05, 0xFF, 0x0D, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFAF3, 0x05, 0xFF, 0x0D, 0x25, 0xF9 },
-  { "CMP #$05                        ", 0xFAF5, 0x05, 0xFF, 0x0D, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFAF7, 0x05, 0xFF, 0x0D, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAF9, 0x05, 0xFF, 0x0D, 0x27, 0xF9 },
-  { "LDA $47 = 52                    ", 0xF6C1, 0x05, 0xFF, 0x0D, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF6C3, 0x52, 0xFF, 0x0D, 0x25, 0xFB },
-  { "BEQ $F6C9                       ", 0xF6C5, 0x52, 0xFF, 0x0D, 0x27, 0xFB },
-  { "INY                             ", 0xF6C9, 0x52, 0xFF, 0x0D, 0x27, 0xFB },
-  { "LDA #$29                        ", 0xF6CA, 0x52, 0xFF, 0x0E, 0x25, 0xFB },
-  { "STA $47 = 52                    ", 0xF6CC, 0x29, 0xFF, 0x0E, 0x25, 0xFB },
-  { "JSR $FAFA                       ", 0xF6CE, 0x29, 0xFF, 0x0E, 0x25, 0xFB },
-  { "CLV                             ", 0xFAFA, 0x29, 0xFF, 0x0E, 0x25, 0xF9 },
-  { "CLC                             ", 0xFAFB, 0x29, 0xFF, 0x0E, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFAFC, 0x29, 0xFF, 0x0E, 0x24, 0xF9 },
-  { "RTS                             ", 0xFAFE, 0x42, 0xFF, 0x0E, 0x24, 0xF9 },
-  { "RRA $48,X @ 47 = 29             ", 0xF6D1, 0x42, 0xFF, 0x0E, 0x24, 0xFB },
-  { "NOP                             ", 0xF6D3, 0x57, 0xFF, 0x0E, 0x24, 0xFB },
-  { "NOP                             ", 0xF6D4, 0x57, 0xFF, 0x0E, 0x24, 0xFB },
-  { "NOP                             ", 0xF6D5, 0x57, 0xFF, 0x0E, 0x24, 0xFB },
-  { "NOP                             ", 0xF6D6, 0x57, 0xFF, 0x0E, 0x24, 0xFB },
-  { "JSR $FAFF                       ", 0xF6D7, 0x57, 0xFF, 0x0E, 0x24, 0xFB },
-  { "BVS $FB1B                       ", 0xFAFF, 0x57, 0xFF, 0x0E, 0x24, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB01, 0x57, 0xFF, 0x0E, 0x24, 0xF9 },
-  { "BCS $FB1B                       ", 0xFB03, 0x57, 0xFF, 0x0E, 0x24, 0xF9 },
-  { "CMP #$57                        ", 0xFB05, 0x57, 0xFF, 0x0E, 0x24, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB07, 0x57, 0xFF, 0x0E, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB09, 0x57, 0xFF, 0x0E, 0x27, 0xF9 },
-  { "LDA $47 = 14                    ", 0xF6DA, 0x57, 0xFF, 0x0E, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF6DC, 0x14, 0xFF, 0x0E, 0x25, 0xFB },
-  { "BEQ $F6E2                       ", 0xF6DE, 0x14, 0xFF, 0x0E, 0x27, 0xFB },
-  { "INY                             ", 0xF6E2, 0x14, 0xFF, 0x0E, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF6E3, 0x14, 0xFF, 0x0F, 0x25, 0xFB },
-  { "STA $47 = 14                    ", 0xF6E5, 0x37, 0xFF, 0x0F, 0x25, 0xFB },
-  { "JSR $FB0A                       ", 0xF6E7, 0x37, 0xFF, 0x0F, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB0A, 0x37, 0xFF, 0x0F, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB0C, 0x37, 0xFF, 0x0F, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB0D, 0x37, 0xFF, 0x0F, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB0F, 0x75, 0xFF, 0x0F, 0x65, 0xF9 },
-  { "RRA $48,X @ 47 = 37             ", 0xF6EA, 0x75, 0xFF, 0x0F, 0x65, 0xFB },
-  { "NOP                             ", 0xF6EC, 0x11, 0xFF, 0x0F, 0x25, 0xFB },
-  { "NOP                             ", 0xF6ED, 0x11, 0xFF, 0x0F, 0x25, 0xFB },
-  { "NOP                             ", 0xF6EE, 0x11, 0xFF, 0x0F, 0x25, 0xFB },
-  { "NOP                             ", 0xF6EF, 0x11, 0xFF, 0x0F, 0x25, 0xFB },
-  { "JSR $FB10                       ", 0xF6F0, 0x11, 0xFF, 0x0F, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFB10, 0x11, 0xFF, 0x0F, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB12, 0x11, 0xFF, 0x0F, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFB14, 0x11, 0xFF, 0x0F, 0x25, 0xF9 },
-  { "CMP #$11                        ", 0xFB16, 0x11, 0xFF, 0x0F, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB18, 0x11, 0xFF, 0x0F, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB1A, 0x11, 0xFF, 0x0F, 0x27, 0xF9 },
-  { "LDA $47 = 9B                    ", 0xF6F3, 0x11, 0xFF, 0x0F, 0x27, 0xFB },
-  { "CMP #$9B                        ", 0xF6F5, 0x9B, 0xFF, 0x0F, 0xA5, 0xFB },
-  { "BEQ $F6FB                       ", 0xF6F7, 0x9B, 0xFF, 0x0F, 0x27, 0xFB },
-  { "LDA #$A5                        ", 0xF6FB, 0x9B, 0xFF, 0x0F, 0x27, 0xFB },
-  { "STA $0647 = 9B                  ", 0xF6FD, 0xA5, 0xFF, 0x0F, 0xA5, 0xFB },
-  { "LDY #$FF                        ", 0xF700, 0xA5, 0xFF, 0x0F, 0xA5, 0xFB },
-  { "JSR $FAE9                       ", 0xF702, 0xA5, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAE9, 0xA5, 0xFF, 0xFF, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAEB, 0xA5, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$B2                        ", 0xFAEC, 0xA5, 0xFF, 0xFF, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAEE, 0xB2, 0xFF, 0xFF, 0xE4, 0xF9 },
-  { "RRA $0548,Y @ 0647 = A5         ", 0xF705, 0xB2, 0xFF, 0xFF, 0xE4, 0xFB },
-  { "NOP                             ", 0xF708, 0x05, 0xFF, 0xFF, 0x25, 0xFB },
-  { "NOP                             ", 0xF709, 0x05, 0xFF, 0xFF, 0x25, 0xFB },
-  { "PHP                             ", 0xF70A, 0x05, 0xFF, 0xFF, 0x25, 0xFB },
-  { "PHA                             ", 0xF70B, 0x05, 0xFF, 0xFF, 0x25, 0xFA },
-  { "LDY #$10                        ", 0xF70C, 0x05, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "PLA                             ", 0xF70E, 0x05, 0xFF, 0x10, 0x25, 0xF9 },
-  { "PLP                             ", 0xF70F, 0x05, 0xFF, 0x10, 0x25, 0xFA },
-  { "JSR $FAEF                       ", 0xF710, 0x05, 0xFF, 0x10, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFAEF, 0x05, 0xFF, 0x10, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFAF1, 0x05, 0xFF, 0x10, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFAF3, 0x05, 0xFF, 0x10, 0x25, 0xF9 },
-  { "CMP #$05                        ", 0xFAF5, 0x05, 0xFF, 0x10, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFAF7, 0x05, 0xFF, 0x10, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAF9, 0x05, 0xFF, 0x10, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF713, 0x05, 0xFF, 0x10, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF716, 0x52, 0xFF, 0x10, 0x25, 0xFB },
-  { "BEQ $F71C                       ", 0xF718, 0x52, 0xFF, 0x10, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xF71C, 0x52, 0xFF, 0x10, 0x27, 0xFB },
-  { "LDA #$29                        ", 0xF71E, 0x52, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 52                  ", 0xF720, 0x29, 0xFF, 0xFF, 0x25, 0xFB },
-  { "JSR $FAFA                       ", 0xF723, 0x29, 0xFF, 0xFF, 0x25, 0xFB },
-  { "CLV                             ", 0xFAFA, 0x29, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "CLC                             ", 0xFAFB, 0x29, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFAFC, 0x29, 0xFF, 0xFF, 0x24, 0xF9 },
-  { "RTS                             ", 0xFAFE, 0x42, 0xFF, 0xFF, 0x24, 0xF9 },
-  { "RRA $0548,Y @ 0647 = 29         ", 0xF726, 0x42, 0xFF, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xF729, 0x57, 0xFF, 0xFF, 0x24, 0xFB },
-  { "NOP                             ", 0xF72A, 0x57, 0xFF, 0xFF, 0x24, 0xFB },
-  { "PHP                             ", 0xF72B, 0x57, 0xFF, 0xFF, 0x24, 0xFB },
-  { "PHA                             ", 0xF72C, 0x57, 0xFF, 0xFF, 0x24, 0xFA },
-  { "LDY #$11                        ", 0xF72D, 0x57, 0xFF, 0xFF, 0x24, 0xF9 },
-  { "PLA                             ", 0xF72F, 0x57, 0xFF, 0x11, 0x24, 0xF9 },
-  { "PLP                             ", 0xF730, 0x57, 0xFF, 0x11, 0x24, 0xFA },
-  { "JSR $FAFF                       ", 0xF731, 0x57, 0xFF, 0x11, 0x24, 0xFB },
-  { "BVS $FB1B                       ", 0xFAFF, 0x57, 0xFF, 0x11, 0x24, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB01, 0x57, 0xFF, 0x11, 0x24, 0xF9 },
-  { "BCS $FB1B                       ", 0xFB03, 0x57, 0xFF, 0x11, 0x24, 0xF9 },
-  { "CMP #$57                        ", 0xFB05, 0x57, 0xFF, 0x11, 0x24, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB07, 0x57, 0xFF, 0x11, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB09, 0x57, 0xFF, 0x11, 0x27, 0xF9 },
-  { "LDA $0647 = 14                  ", 0xF734, 0x57, 0xFF, 0x11, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF737, 0x14, 0xFF, 0x11, 0x25, 0xFB },
-  { "BEQ $F73D                       ", 0xF739, 0x14, 0xFF, 0x11, 0x27, 0xFB },
-  { "LDY #$FF                        ", 0xF73D, 0x14, 0xFF, 0x11, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF73F, 0x14, 0xFF, 0xFF, 0xA5, 0xFB },
-  { "STA $0647 = 14                  ", 0xF741, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "JSR $FB0A                       ", 0xF744, 0x37, 0xFF, 0xFF, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB0A, 0x37, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB0C, 0x37, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB0D, 0x37, 0xFF, 0xFF, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB0F, 0x75, 0xFF, 0xFF, 0x65, 0xF9 },
-  { "RRA $0548,Y @ 0647 = 37         ", 0xF747, 0x75, 0xFF, 0xFF, 0x65, 0xFB },
-  { "NOP                             ", 0xF74A, 0x11, 0xFF, 0xFF, 0x25, 0xFB },
-  { "NOP                             ", 0xF74B, 0x11, 0xFF, 0xFF, 0x25, 0xFB },
-  { "PHP                             ", 0xF74C, 0x11, 0xFF, 0xFF, 0x25, 0xFB },
-  { "PHA                             ", 0xF74D, 0x11, 0xFF, 0xFF, 0x25, 0xFA },
-  { "LDY #$12                        ", 0xF74E, 0x11, 0xFF, 0xFF, 0x25, 0xF9 },
-  { "PLA                             ", 0xF750, 0x11, 0xFF, 0x12, 0x25, 0xF9 },
-  { "PLP                             ", 0xF751, 0x11, 0xFF, 0x12, 0x25, 0xFA },
-  { "JSR $FB10                       ", 0xF752, 0x11, 0xFF, 0x12, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFB10, 0x11, 0xFF, 0x12, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB12, 0x11, 0xFF, 0x12, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFB14, 0x11, 0xFF, 0x12, 0x25, 0xF9 },
-  { "CMP #$11                        ", 0xFB16, 0x11, 0xFF, 0x12, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB18, 0x11, 0xFF, 0x12, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB1A, 0x11, 0xFF, 0x12, 0x27, 0xF9 },
-  { "LDA $0647 = 9B                  ", 0xF755, 0x11, 0xFF, 0x12, 0x27, 0xFB },
-  { "CMP #$9B                        ", 0xF758, 0x9B, 0xFF, 0x12, 0xA5, 0xFB },
-  { "BEQ $F75E                       ", 0xF75A, 0x9B, 0xFF, 0x12, 0x27, 0xFB },
-  { "LDY #$13                        ", 0xF75E, 0x9B, 0xFF, 0x12, 0x27, 0xFB },
-  { "LDX #$FF                        ", 0xF760, 0x9B, 0xFF, 0x13, 0x25, 0xFB },
-  { "LDA #$A5                        ", 0xF762, 0x9B, 0xFF, 0x13, 0xA5, 0xFB },
-  { "STA $0647 = 9B                  ", 0xF764, 0xA5, 0xFF, 0x13, 0xA5, 0xFB },
-  { "JSR $FAE9                       ", 0xF767, 0xA5, 0xFF, 0x13, 0xA5, 0xFB },
-  { "BIT $01 = FF                    ", 0xFAE9, 0xA5, 0xFF, 0x13, 0xA5, 0xF9 },
-  { "CLC                             ", 0xFAEB, 0xA5, 0xFF, 0x13, 0xE5, 0xF9 },
-  { "LDA #$B2                        ", 0xFAEC, 0xA5, 0xFF, 0x13, 0xE4, 0xF9 },
-  { "RTS                             ", 0xFAEE, 0xB2, 0xFF, 0x13, 0xE4, 0xF9 },
-  { "RRA $0548,X @ 0647 = A5         ", 0xF76A, 0xB2, 0xFF, 0x13, 0xE4, 0xFB },
-  { "NOP                             ", 0xF76D, 0x05, 0xFF, 0x13, 0x25, 0xFB },
-  { "NOP                             ", 0xF76E, 0x05, 0xFF, 0x13, 0x25, 0xFB },
-  { "NOP                             ", 0xF76F, 0x05, 0xFF, 0x13, 0x25, 0xFB },
-  { "NOP                             ", 0xF770, 0x05, 0xFF, 0x13, 0x25, 0xFB },
-  { "JSR $FAEF                       ", 0xF771, 0x05, 0xFF, 0x13, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFAEF, 0x05, 0xFF, 0x13, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFAF1, 0x05, 0xFF, 0x13, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFAF3, 0x05, 0xFF, 0x13, 0x25, 0xF9 },
-  { "CMP #$05                        ", 0xFAF5, 0x05, 0xFF, 0x13, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFAF7, 0x05, 0xFF, 0x13, 0x27, 0xF9 },
-  { "RTS                             ", 0xFAF9, 0x05, 0xFF, 0x13, 0x27, 0xF9 },
-  { "LDA $0647 = 52                  ", 0xF774, 0x05, 0xFF, 0x13, 0x27, 0xFB },
-  { "CMP #$52                        ", 0xF777, 0x52, 0xFF, 0x13, 0x25, 0xFB },
-  { "BEQ $F77D                       ", 0xF779, 0x52, 0xFF, 0x13, 0x27, 0xFB },
-  { "INY                             ", 0xF77D, 0x52, 0xFF, 0x13, 0x27, 0xFB },
-  { "LDA #$29                        ", 0xF77E, 0x52, 0xFF, 0x14, 0x25, 0xFB },
-  { "STA $0647 = 52                  ", 0xF780, 0x29, 0xFF, 0x14, 0x25, 0xFB },
-  { "JSR $FAFA                       ", 0xF783, 0x29, 0xFF, 0x14, 0x25, 0xFB },
-  { "CLV                             ", 0xFAFA, 0x29, 0xFF, 0x14, 0x25, 0xF9 },
-  { "CLC                             ", 0xFAFB, 0x29, 0xFF, 0x14, 0x25, 0xF9 },
-  { "LDA #$42                        ", 0xFAFC, 0x29, 0xFF, 0x14, 0x24, 0xF9 },
-  { "RTS                             ", 0xFAFE, 0x42, 0xFF, 0x14, 0x24, 0xF9 },
-  { "RRA $0548,X @ 0647 = 29         ", 0xF786, 0x42, 0xFF, 0x14, 0x24, 0xFB },
-  { "NOP                             ", 0xF789, 0x57, 0xFF, 0x14, 0x24, 0xFB },
-  { "NOP                             ", 0xF78A, 0x57, 0xFF, 0x14, 0x24, 0xFB },
-  { "NOP                             ", 0xF78B, 0x57, 0xFF, 0x14, 0x24, 0xFB },
-  { "NOP                             ", 0xF78C, 0x57, 0xFF, 0x14, 0x24, 0xFB },
-  { "JSR $FAFF                       ", 0xF78D, 0x57, 0xFF, 0x14, 0x24, 0xFB },
-  { "BVS $FB1B                       ", 0xFAFF, 0x57, 0xFF, 0x14, 0x24, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB01, 0x57, 0xFF, 0x14, 0x24, 0xF9 },
-  { "BCS $FB1B                       ", 0xFB03, 0x57, 0xFF, 0x14, 0x24, 0xF9 },
-  { "CMP #$57                        ", 0xFB05, 0x57, 0xFF, 0x14, 0x24, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB07, 0x57, 0xFF, 0x14, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB09, 0x57, 0xFF, 0x14, 0x27, 0xF9 },
-  { "LDA $0647 = 14                  ", 0xF790, 0x57, 0xFF, 0x14, 0x27, 0xFB },
-  { "CMP #$14                        ", 0xF793, 0x14, 0xFF, 0x14, 0x25, 0xFB },
-  { "BEQ $F799                       ", 0xF795, 0x14, 0xFF, 0x14, 0x27, 0xFB },
-  { "INY                             ", 0xF799, 0x14, 0xFF, 0x14, 0x27, 0xFB },
-  { "LDA #$37                        ", 0xF79A, 0x14, 0xFF, 0x15, 0x25, 0xFB },
-  { "STA $0647 = 14                  ", 0xF79C, 0x37, 0xFF, 0x15, 0x25, 0xFB },
-  { "JSR $FB0A                       ", 0xF79F, 0x37, 0xFF, 0x15, 0x25, 0xFB },
-  { "BIT $01 = FF                    ", 0xFB0A, 0x37, 0xFF, 0x15, 0x25, 0xF9 },
-  { "SEC                             ", 0xFB0C, 0x37, 0xFF, 0x15, 0xE5, 0xF9 },
-  { "LDA #$75                        ", 0xFB0D, 0x37, 0xFF, 0x15, 0xE5, 0xF9 },
-  { "RTS                             ", 0xFB0F, 0x75, 0xFF, 0x15, 0x65, 0xF9 },
-  { "RRA $0548,X @ 0647 = 37         ", 0xF7A2, 0x75, 0xFF, 0x15, 0x65, 0xFB },
-  { "NOP                             ", 0xF7A5, 0x11, 0xFF, 0x15, 0x25, 0xFB },
-  { "NOP                             ", 0xF7A6, 0x11, 0xFF, 0x15, 0x25, 0xFB },
-  { "NOP                             ", 0xF7A7, 0x11, 0xFF, 0x15, 0x25, 0xFB },
-  { "NOP                             ", 0xF7A8, 0x11, 0xFF, 0x15, 0x25, 0xFB },
-  { "JSR $FB10                       ", 0xF7A9, 0x11, 0xFF, 0x15, 0x25, 0xFB },
-  { "BVS $FB1B                       ", 0xFB10, 0x11, 0xFF, 0x15, 0x25, 0xF9 },
-  { "BMI $FB1B                       ", 0xFB12, 0x11, 0xFF, 0x15, 0x25, 0xF9 },
-  { "BCC $FB1B                       ", 0xFB14, 0x11, 0xFF, 0x15, 0x25, 0xF9 },
-  { "CMP #$11                        ", 0xFB16, 0x11, 0xFF, 0x15, 0x25, 0xF9 },
-  { "BNE $FB1B                       ", 0xFB18, 0x11, 0xFF, 0x15, 0x27, 0xF9 },
-  { "RTS                             ", 0xFB1A, 0x11, 0xFF, 0x15, 0x27, 0xF9 },
-  { "LDA $0647 = 9B                  ", 0xF7AC, 0x11, 0xFF, 0x15, 0x27, 0xFB },
-  { "CMP #$9B                        ", 0xF7AF, 0x9B, 0xFF, 0x15, 0xA5, 0xFB },
-  { "BEQ $F7B5                       ", 0xF7B1, 0x9B, 0xFF, 0x15, 0x27, 0xFB },
-  { "RTS                             ", 0xF7B5, 0x9B, 0xFF, 0x15, 0x27, 0xFB },
-  { "LDA $00 = 00                    ", 0xC655, 0x9B, 0xFF, 0x15, 0x27, 0xFD },
-  { "ORA $10 = 00                    ", 0xC657, 0x00, 0xFF, 0x15, 0x27, 0xFD },
-  { "ORA $11 = 00                    ", 0xC659, 0x00, 0xFF, 0x15, 0x27, 0xFD },
-  { "BEQ $C66B                       ", 0xC65B, 0x00, 0xFF, 0x15, 0x27, 0xFD },
-  { "JSR $C689                       ", 0xC66B, 0x00, 0xFF, 0x15, 0x27, 0xFD },
-  { "LDA #$02                        ", 0xC689, 0x00, 0xFF, 0x15, 0x27, 0xFB },
-  { "STA $4015 = FF                  ", 0xC68B, 0x02, 0xFF, 0x15, 0x25, 0xFB },
-  { "LDA #$3F                        ", 0xC68E, 0x02, 0xFF, 0x15, 0x25, 0xFB },
-  { "STA $4004 = FF                  ", 0xC690, 0x3F, 0xFF, 0x15, 0x25, 0xFB },
-  { "LDA #$9A                        ", 0xC693, 0x3F, 0xFF, 0x15, 0x25, 0xFB },
-  { "STA $4005 = FF                  ", 0xC695, 0x9A, 0xFF, 0x15, 0xA5, 0xFB },
-  { "LDA #$FF                        ", 0xC698, 0x9A, 0xFF, 0x15, 0xA5, 0xFB },
-  { "STA $4006 = FF                  ", 0xC69A, 0xFF, 0xFF, 0x15, 0xA5, 0xFB },
-  { "LDA #$00                        ", 0xC69D, 0xFF, 0xFF, 0x15, 0xA5, 0xFB },
-  { "STA $4007 = FF                  ", 0xC69F, 0x00, 0xFF, 0x15, 0x27, 0xFB },
-  { "RTS                             ", 0xC6A2, 0x00, 0xFF, 0x15, 0x27, 0xFB },
-  { "RTS                             ", 0xC66E, 0x00, 0xFF, 0x15, 0x27, 0xFD },
-};
@@ -0,0 +1,154 @@
+#pragma once
+/*
+    parallel.h -- run independent test cases on a pool of worker threads
+
+    Do this:
+        #define PARALLEL_IMPL
+    before including this file in *one* C file to create the implementation.
+
+    Usage:
+
+        static void run_case(int item_index, int worker_index, void* user_data) {
+            // run test case item_index with the emulator instance owned
+            // by worker_index, and store the result in a per-item slot
+        }
+        ...
+        int num_workers = par_num_workers(requested);
+        // ...allocate one emulator instance per worker...
+        par_for(num_items, num_workers, run_case, user_data);
+
+    Items are handed out to workers in ascending order through an atomic
+    counter, so that slow items don't stall a whole batch. A worker only
+    ever runs one item at a time, so per-worker state needs no locking.
+    Results should be written into per-item slots and printed after
+    par_for() returns, this keeps the output in a deterministic order
+    independent of the number of threads.
+
+    With num_workers == 1 the items run on the calling thread.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#define PAR_MAX_WORKERS (64)
+
+typedef void (*par_func_t)(int item_index, int worker_index, void* user_data);
+
+// number of logical CPU cores
+int par_num_cores(void);
+// clamp the requested number of workers, 0 means one worker per core
+int par_num_workers(int requested);
+// call func once for each item in [0, num_items), spread over num_workers threads
+void par_for(int num_items, int num_workers, par_func_t func, void* user_data);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#if defined(PARALLEL_IMPL)
+#include <assert.h>
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+typedef struct {
+    volatile long next_item;
+    int num_items;
+    par_func_t func;
+    void* user_data;
+} _par_job_t;
+
+typedef struct {
+    _par_job_t* job;
+    int worker_index;
+} _par_worker_t;
+
+static int _par_fetch_item(_par_job_t* job) {
+    #if defined(_WIN32)
+    return (int)InterlockedIncrement(&job->next_item) - 1;
+    #else
+    return (int)__atomic_fetch_add(&job->next_item, 1, __ATOMIC_RELAXED);
+    #endif
+}
+
+static void _par_work(_par_worker_t* worker) {
+    _par_job_t* job = worker->job;
+    int item;
+    while ((item = _par_fetch_item(job)) < job->num_items) {
+        job->func(item, worker->worker_index, job->user_data);
+    }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI _par_thread_func(LPVOID arg) {
+    _par_work((_par_worker_t*)arg);
+    return 0;
+}
+#else
+static void* _par_thread_func(void* arg) {
+    _par_work((_par_worker_t*)arg);
+    return 0;
+}
+#endif
+
+int par_num_cores(void) {
+    #if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const int num = (int)info.dwNumberOfProcessors;
+    #else
+    const int num = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+    return (num > 0) ? num : 1;
+}
+
+int par_num_workers(int requested) {
+    int num = (requested > 0) ? requested : par_num_cores();
+    return (num > PAR_MAX_WORKERS) ? PAR_MAX_WORKERS : num;
+}
+
+void par_for(int num_items, int num_workers, par_func_t func, void* user_data) {
+    assert(func && (num_workers > 0) && (num_workers <= PAR_MAX_WORKERS));
+    _par_job_t job = {
+        .next_item = 0,
+        .num_items = num_items,
+        .func = func,
+        .user_data = user_data,
+    };
+    _par_worker_t workers[PAR_MAX_WORKERS];
+    for (int i = 0; i < num_workers; i++) {
+        workers[i] = (_par_worker_t){ .job = &job, .worker_index = i };
+    }
+    // the calling thread is worker 0
+    #if defined(_WIN32)
+    HANDLE threads[PAR_MAX_WORKERS];
+    for (int i = 1; i < num_workers; i++) {
+        threads[i] = CreateThread(NULL, 0, _par_thread_func, &workers[i], 0, NULL);
+        assert(threads[i]);
+    }
+    _par_work(&workers[0]);
+    for (int i = 1; i < num_workers; i++) {
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+    }
+    #else
+    pthread_t threads[PAR_MAX_WORKERS];
+    for (int i = 1; i < num_workers; i++) {
+        int res = pthread_create(&threads[i], 0, _par_thread_func, &workers[i]);
+        assert(0 == res); (void)res;
+    }
+    _par_work(&workers[0]);
+    for (int i = 1; i < num_workers; i++) {
+        pthread_join(threads[i], 0);
+    }
+    #endif
+}
+#endif // PARALLEL_IMPL
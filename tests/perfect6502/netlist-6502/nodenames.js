@@ -0,0 +1,198 @@
+// Copyright (c) 2010 Greg James, Brian Silverman, Barry Silverman
+//
+// The following is provided under terms of the Creative Commons
+// Attribution-NonCommercial-ShareAlike 3.0 Unported license:
+// http://creativecommons.org/licenses/by-nc-sa/3.0/
+//
+// Specify the original author as Greg James and the following URL
+// for original source material:  www.visual6502.org
+//
+// MOS 6502 node names
+
+var nodenames ={
+D1x1: 827,
+a0: 737,
+a1: 1234,
+a2: 978,
+a3: 162,
+a4: 727,
+a5: 858,
+a6: 1136,
+a7: 1653,
+ab0: 268,
+ab1: 451,
+ab2: 1340,
+ab3: 211,
+ab4: 435,
+ab5: 736,
+ab6: 887,
+ab7: 1493,
+ab8: 230,
+ab9: 148,
+ab10: 1443,
+ab11: 399,
+ab12: 1237,
+ab13: 349,
+ab14: 672,
+ab15: 195,
+adh0: 407,
+adh1: 52,
+adh2: 1651,
+adh3: 315,
+adh4: 1160,
+adh5: 483,
+adh6: 13,
+adh7: 1539,
+adl0: 413,
+adl1: 1282,
+adl2: 1242,
+adl3: 684,
+adl4: 1437,
+adl5: 1630,
+adl6: 121,
+adl7: 1299,
+alu0: 394,
+alu1: 697,
+alu2: 276,
+alu3: 495,
+alu4: 1490,
+alu5: 893,
+alu6: 68,
+alu7: 1123,
+cclk: 943,
+clearIR: 1077,
+clk0: 1171,
+clk1out: 1163,
+clk2out: 421,
+clock1: 156,
+clock2: 1536,
+cp1: 710,
+db0: 1005,
+db1: 82,
+db2: 945,
+db3: 650,
+db4: 1393,
+db5: 175,
+db6: 1591,
+db7: 1349,
+dor0: 222,
+dor1: 527,
+dor2: 1288,
+dor3: 823,
+dor4: 873,
+dor5: 1266,
+dor6: 1418,
+dor7: 158,
+fetch: 879,
+h1x1: 1042,
+idb0: 1108,
+idb1: 991,
+idb2: 1473,
+idb3: 1302,
+idb4: 892,
+idb5: 1503,
+idb6: 833,
+idb7: 493,
+idl0: 116,
+idl1: 576,
+idl2: 1485,
+idl3: 1284,
+idl4: 1516,
+idl5: 498,
+idl6: 1537,
+idl7: 529,
+irq: 103,
+nmi: 1297,
+notRdy0: 248,
+notir0: 194,
+notir1: 702,
+notir2: 1182,
+notir3: 1125,
+notir4: 26,
+notir5: 1394,
+notir6: 895,
+notir7: 1320,
+nots0: 418,
+nots1: 1064,
+nots2: 752,
+nots3: 828,
+nots4: 1603,
+nots5: 601,
+nots6: 1029,
+nots7: 181,
+p0: 687,
+p1: 1444,
+p2: 1421,
+p3: 439,
+p4: 1119,
+p5: 0,
+p6: 77,
+p7: 1370,
+pch0: 1670,
+pch1: 292,
+pch2: 502,
+pch3: 584,
+pch4: 948,
+pch5: 49,
+pch6: 1551,
+pch7: 205,
+pcl0: 1139,
+pcl1: 1022,
+pcl2: 655,
+pcl3: 1359,
+pcl4: 900,
+pcl5: 622,
+pcl6: 377,
+pcl7: 1611,
+pd0: 758,
+pd1: 361,
+pd2: 955,
+pd3: 894,
+pd4: 369,
+pd5: 829,
+pd6: 1669,
+pd7: 1690,
+rdy: 89,
+res: 159,
+rw: 1156,
+s0: 1403,
+s1: 183,
+s2: 81,
+s3: 1532,
+s4: 1702,
+s5: 1098,
+s6: 1212,
+s7: 1435,
+sb0: 54,
+sb1: 1150,
+sb2: 1287,
+sb3: 1188,
+sb4: 1405,
+sb5: 166,
+sb6: 1336,
+sb7: 1001,
+so: 1672,
+sync_: 539,
+t2: 971,
+t3: 1567,
+t4: 690,
+t5: 909,
+vcc: 657,
+vss: 558,
+x0: 1216,
+x1: 98,
+x2: 1,
+x3: 1648,
+x4: 85,
+x5: 589,
+x6: 448,
+x7: 777,
+y0: 64,
+y1: 1148,
+y2: 573,
+y3: 305,
+y4: 989,
+y5: 615,
+y6: 115,
+y7: 843,
+}
@@ -0,0 +1,3523 @@
+// Copyright (c) 2010 Greg James, Brian Silverman, Barry Silverman
+//
+// The following is provided under terms of the Creative Commons
+// Attribution-NonCommercial-ShareAlike 3.0 Unported license:
+// http://creativecommons.org/licenses/by-nc-sa/3.0/
+//
+// Specify the original author as Greg James and the following URL
+// for original source material:  www.visual6502.org
+//
+// MOS 6502 transistors, the geometry has been removed
+
+var transdefs = [
+['t1',357,558,217,false],
+['t2',1608,657,349,false],
+['t3',412,558,1146,false],
+['t4',558,558,943,false],
+['t5',826,230,657,false],
+['t6',82,558,1319,false],
+['t7',821,289,1514,false],
+['t8',558,558,1171,false],
+['t9',945,558,1199,false],
+['t10',710,524,1548,false],
+['t11',190,558,220,false],
+['t12',38,1247,657,false],
+['t13',1248,189,558,false],
+['t14',1248,558,155,false],
+['t15',943,558,346,false],
+['t16',1140,148,657,false],
+['t17',1540,508,558,false],
+['t18',710,32,1082,false],
+['t19',710,1451,212,false],
+['t20',1247,558,534,false],
+['t21',943,1162,272,false],
+['t22',943,983,418,false],
+['t23',248,1615,468,false],
+['t24',248,472,395,false],
+['t25',710,1495,348,false],
+['t26',1096,1100,558,false],
+['t27',1096,558,1660,false],
+['t28',1096,855,657,false],
+['t29',1503,558,744,false],
+['t30',44,1616,558,false],
+['t31',78,651,375,false],
+['t32',78,558,65,false],
+['t33',710,928,1378,false],
+['t34',710,1309,74,false],
+['t35',943,518,115,false],
+['t36',32,558,31,false],
+['t37',943,1405,657,false],
+['t38',943,973,1603,false],
+['t39',347,510,558,false],
+['t40',710,1667,883,false],
+['t41',706,1456,558,false],
+['t42',1174,307,558,false],
+['t43',1622,558,409,false],
+['t44',192,25,558,false],
+['t45',1490,558,606,false],
+['t46',943,1148,767,false],
+['t47',549,1150,1248,false],
+['t48',549,1287,1332,false],
+['t49',549,1680,1188,false],
+['t50',549,1142,1405,false],
+['t51',353,794,558,false],
+['t52',353,794,558,false],
+['t53',593,558,1700,false],
+['t54',549,1167,54,false],
+['t55',600,613,1362,false],
+['t56',549,530,166,false],
+['t57',549,1627,1336,false],
+['t58',948,558,1400,false],
+['t59',264,1092,480,false],
+['t60',1582,632,558,false],
+['t61',584,558,923,false],
+['t62',1003,274,136,false],
+['t63',1003,860,558,false],
+['t64',943,1347,1527,false],
+['t65',68,558,331,false],
+['t66',558,945,558,false],
+['t67',1457,1644,1495,false],
+['t68',1485,1066,558,false],
+['t69',1485,558,1066,false],
+['t70',1485,1066,558,false],
+['t71',1077,558,1622,false],
+['t72',1077,667,558,false],
+['t73',325,115,1336,false],
+['t74',710,920,785,false],
+['t75',1318,748,558,false],
+['t76',362,304,657,false],
+['t77',127,421,657,false],
+['t78',325,989,1405,false],
+['t79',53,558,790,false],
+['t80',763,558,1068,false],
+['t81',1088,558,147,false],
+['t82',1088,558,1463,false],
+['t83',1042,1370,493,false],
+['t84',1042,1473,1421,false],
+['t85',943,513,443,false],
+['t86',943,1673,1646,false],
+['t87',943,490,1516,false],
+['t88',311,856,558,false],
+['t89',311,835,558,false],
+['t90',783,558,1158,false],
+['t91',783,558,1704,false],
+['t92',783,558,1253,false],
+['t93',381,230,558,false],
+['t94',381,230,558,false],
+['t95',381,230,558,false],
+['t96',381,558,230,false],
+['t97',381,230,558,false],
+['t98',381,558,230,false],
+['t99',381,230,558,false],
+['t100',152,558,1343,false],
+['t101',555,371,558,false],
+['t102',810,558,207,false],
+['t103',819,501,558,false],
+['t104',1148,1138,558,false],
+['t105',963,657,672,false],
+['t106',967,202,558,false],
+['t107',1691,972,558,false],
+['t108',1342,1563,558,false],
+['t109',786,844,558,false],
+['t110',422,657,1296,false],
+['t111',422,1346,558,false],
+['t112',422,359,558,false],
+['t113',984,1680,558,false],
+['t114',1410,558,365,false],
+['t115',403,558,1145,false],
+['t116',527,746,558,false],
+['t117',1610,972,1372,false],
+['t118',710,653,1497,false],
+['t119',429,489,558,false],
+['t120',467,558,10,false],
+['t121',460,692,558,false],
+['t122',536,558,1647,false],
+['t123',917,1358,558,false],
+['t124',821,429,514,false],
+['t125',744,558,1268,false],
+['t126',710,430,1570,false],
+['t127',943,1179,393,false],
+['t128',1700,998,1188,false],
+['t129',1700,1389,1287,false],
+['t130',1369,558,1462,false],
+['t131',1369,657,438,false],
+['t132',925,558,816,false],
+['t133',1700,721,1001,false],
+['t134',1700,618,1336,false],
+['t135',818,1043,558,false],
+['t136',818,657,414,false],
+['t137',1700,3,1405,false],
+['t138',270,1426,558,false],
+['t139',1678,477,1559,false],
+['t140',1678,558,1632,false],
+['t141',710,1590,1083,false],
+['t142',589,558,1017,false],
+['t143',710,1424,1066,false],
+['t144',1420,1455,558,false],
+['t145',1420,397,558,false],
+['t146',493,789,558,false],
+['t147',640,884,558,false],
+['t148',1108,558,624,false],
+['t149',154,558,75,false],
+['t150',154,657,129,false],
+['t151',787,558,605,false],
+['t152',1247,558,325,false],
+['t153',1582,604,558,false],
+['t154',1670,1010,558,false],
+['t155',798,82,657,false],
+['t156',798,82,657,false],
+['t157',453,1264,558,false],
+['t158',28,567,558,false],
+['t159',121,558,1548,false],
+['t160',285,1225,558,false],
+['t161',1134,558,70,false],
+['t162',706,1366,558,false],
+['t163',272,952,558,false],
+['t164',715,426,558,false],
+['t165',715,914,558,false],
+['t166',761,711,739,false],
+['t167',1296,657,399,false],
+['t168',1453,657,373,false],
+['t169',1312,558,264,false],
+['t170',646,558,812,false],
+['t171',943,1513,210,false],
+['t172',379,1500,1706,false],
+['t173',379,558,1345,false],
+['t174',813,1101,1508,false],
+['t175',4,558,11,false],
+['t176',819,1380,558,false],
+['t177',714,214,657,false],
+['t178',43,818,558,false],
+['t179',1520,558,1107,false],
+['t180',1002,558,1130,false],
+['t181',943,779,805,false],
+['t182',710,1141,101,false],
+['t183',943,408,1308,false],
+['t184',1581,1480,379,false],
+['t185',347,558,191,false],
+['t186',1537,1116,558,false],
+['t187',1537,558,1116,false],
+['t188',1537,1116,558,false],
+['t189',1624,169,558,false],
+['t190',408,938,558,false],
+['t191',1576,1125,558,false],
+['t192',943,1609,1394,false],
+['t193',205,453,558,false],
+['t194',309,558,368,false],
+['t195',1544,405,1172,false],
+['t196',1720,558,373,false],
+['t197',1720,657,612,false],
+['t198',1088,1076,657,false],
+['t199',646,558,773,false],
+['t200',982,558,1141,false],
+['t201',1135,558,1203,false],
+['t202',1135,558,1629,false],
+['t203',1258,558,813,false],
+['t204',248,558,720,false],
+['t205',1045,558,1371,false],
+['t206',999,558,1237,false],
+['t207',999,1237,558,false],
+['t208',999,558,1237,false],
+['t209',999,558,1237,false],
+['t210',999,1237,558,false],
+['t211',999,558,1237,false],
+['t212',999,1237,558,false],
+['t213',943,561,29,false],
+['t214',867,558,876,false],
+['t215',1173,558,1717,false],
+['t216',1146,206,558,false],
+['t217',76,558,1106,false],
+['t218',241,558,1033,false],
+['t219',241,657,1015,false],
+['t220',995,975,886,false],
+['t221',201,558,1371,false],
+['t222',273,558,272,false],
+['t223',846,307,558,false],
+['t224',879,1183,541,false],
+['t225',827,558,380,false],
+['t226',1061,558,124,false],
+['t227',654,332,1403,false],
+['t228',943,1108,657,false],
+['t229',621,558,355,false],
+['t230',1035,558,251,false],
+['t231',1606,188,558,false],
+['t232',41,407,719,false],
+['t233',41,52,87,false],
+['t234',41,1651,1424,false],
+['t235',41,315,1661,false],
+['t236',41,1160,1095,false],
+['t237',41,483,1387,false],
+['t238',41,13,1014,false],
+['t239',41,1539,1147,false],
+['t240',370,558,689,false],
+['t241',805,558,1534,false],
+['t242',943,326,1136,false],
+['t243',943,1117,170,false],
+['t244',710,797,873,false],
+['t245',1382,558,1087,false],
+['t246',960,1178,558,false],
+['t247',977,1628,316,false],
+['t248',977,558,143,false],
+['t249',874,1098,166,false],
+['t250',874,1212,1336,false],
+['t251',874,1532,1188,false],
+['t252',874,1405,1702,false],
+['t253',874,183,1150,false],
+['t254',874,81,1287,false],
+['t255',781,802,558,false],
+['t256',1525,558,406,false],
+['t257',1525,558,555,false],
+['t258',647,427,558,false],
+['t259',1372,1425,558,false],
+['t260',943,242,1648,false],
+['t261',710,931,1674,false],
+['t262',710,1526,1450,false],
+['t263',1273,638,558,false],
+['t264',512,558,154,false],
+['t265',1247,874,558,false],
+['t266',1427,558,1448,false],
+['t267',223,558,1357,false],
+['t268',1219,558,1002,false],
+['t269',1042,1108,687,false],
+['t270',943,604,1477,false],
+['t271',206,367,1082,false],
+['t272',265,818,558,false],
+['t273',1575,558,971,false],
+['t274',105,371,406,false],
+['t275',105,558,555,false],
+['t276',631,558,1323,false],
+['t277',631,657,283,false],
+['t278',544,267,558,false],
+['t279',1482,616,558,false],
+['t280',943,657,1437,false],
+['t281',101,558,1364,false],
+['t282',985,558,844,false],
+['t283',1262,558,1151,false],
+['t284',654,618,1212,false],
+['t285',654,280,1098,false],
+['t286',654,3,1702,false],
+['t287',654,998,1532,false],
+['t288',654,1389,81,false],
+['t289',654,694,183,false],
+['t290',315,558,883,false],
+['t291',1307,558,178,false],
+['t292',281,558,347,false],
+['t293',781,553,558,false],
+['t294',1413,558,1235,false],
+['t295',764,558,1649,false],
+['t296',1212,558,1187,false],
+['t297',710,719,1597,false],
+['t298',1410,558,1605,false],
+['t299',279,455,558,false],
+['t300',943,407,657,false],
+['t301',730,1724,558,false],
+['t302',612,558,175,false],
+['t303',612,558,175,false],
+['t304',612,558,175,false],
+['t305',612,558,175,false],
+['t306',612,175,558,false],
+['t307',612,175,558,false],
+['t308',612,558,175,false],
+['t309',445,558,317,false],
+['t310',445,558,417,false],
+['t311',445,558,417,false],
+['t312',710,127,558,false],
+['t313',445,539,558,false],
+['t314',445,558,539,false],
+['t315',445,539,558,false],
+['t316',445,558,539,false],
+['t317',445,558,539,false],
+['t318',768,287,558,false],
+['t319',1382,1215,558,false],
+['t320',1220,558,547,false],
+['t321',1220,817,558,false],
+['t322',1015,1637,1242,false],
+['t323',1015,1282,872,false],
+['t324',1015,413,401,false],
+['t325',784,558,1464,false],
+['t326',67,558,501,false],
+['t327',1699,558,913,false],
+['t328',447,261,558,false],
+['t329',425,388,558,false],
+['t330',801,564,54,false],
+['t331',347,335,558,false],
+['t332',1602,558,1596,false],
+['t333',182,442,558,false],
+['t334',746,657,798,false],
+['t335',943,261,729,false],
+['t336',710,959,323,false],
+['t337',710,1183,1605,false],
+['t338',1595,1181,793,false],
+['t339',1227,488,558,false],
+['t340',0,182,558,false],
+['t341',1452,861,558,false],
+['t342',575,558,1000,false],
+['t343',1708,558,1055,false],
+['t344',1305,558,921,false],
+['t345',525,800,558,false],
+['t346',525,1331,657,false],
+['t347',1130,80,558,false],
+['t348',1381,558,980,false],
+['t349',328,1133,558,false],
+['t350',328,558,194,false],
+['t351',66,451,558,false],
+['t352',66,451,558,false],
+['t353',66,451,558,false],
+['t354',66,451,558,false],
+['t355',943,558,48,false],
+['t356',943,558,741,false],
+['t357',1341,600,558,false],
+['t358',712,558,300,false],
+['t359',1108,558,1224,false],
+['t360',335,1303,1397,false],
+['t361',253,279,558,false],
+['t362',253,1692,558,false],
+['t363',1129,657,943,false],
+['t364',1333,906,558,false],
+['t365',558,82,558,false],
+['t366',1081,558,605,false],
+['t367',1530,558,1198,false],
+['t368',424,657,248,false],
+['t369',614,558,1178,false],
+['t370',198,248,558,false],
+['t371',198,424,558,false],
+['t372',335,1717,1604,false],
+['t373',437,413,977,false],
+['t374',926,558,1054,false],
+['t375',1700,694,1150,false],
+['t376',869,558,349,false],
+['t377',869,558,349,false],
+['t378',869,349,558,false],
+['t379',869,558,349,false],
+['t380',869,349,558,false],
+['t381',869,349,558,false],
+['t382',869,349,558,false],
+['t383',1076,657,1393,false],
+['t384',1076,657,1393,false],
+['t385',1611,558,641,false],
+['t386',1700,280,166,false],
+['t387',244,558,544,false],
+['t388',1144,757,939,false],
+['t389',248,1456,428,false],
+['t390',248,12,1091,false],
+['t391',248,558,16,false],
+['t392',82,213,558,false],
+['t393',170,558,686,false],
+['t394',601,558,280,false],
+['t395',943,1654,162,false],
+['t396',821,705,1062,false],
+['t397',521,6,558,false],
+['t398',317,657,417,false],
+['t399',203,558,52,false],
+['t400',353,558,1076,false],
+['t401',353,558,1076,false],
+['t402',353,558,1463,false],
+['t403',710,1553,845,false],
+['t404',1109,1358,558,false],
+['t405',650,558,1281,false],
+['t406',427,558,500,false],
+['t407',427,112,1314,false],
+['t408',943,878,462,false],
+['t409',330,807,558,false],
+['t410',1258,558,1716,false],
+['t411',48,584,315,false],
+['t412',48,502,1651,false],
+['t413',48,49,483,false],
+['t414',48,948,1160,false],
+['t415',48,205,1539,false],
+['t416',48,1551,13,false],
+['t417',943,1336,657,false],
+['t418',943,1187,1029,false],
+['t419',1503,558,1383,false],
+['t420',821,1667,92,false],
+['t421',943,1090,1683,false],
+['t422',762,558,1018,false],
+['t423',135,421,558,false],
+['t424',135,421,558,false],
+['t425',135,558,421,false],
+['t426',135,421,558,false],
+['t427',943,1160,657,false],
+['t428',943,1630,657,false],
+['t429',440,366,1012,false],
+['t430',668,1143,558,false],
+['t431',1162,21,558,false],
+['t432',943,474,15,false],
+['t433',1263,1169,54,false],
+['t434',962,558,1035,false],
+['t435',1523,963,558,false],
+['t436',1523,635,657,false],
+['t437',1260,1413,558,false],
+['t438',1260,657,1235,false],
+['t439',220,558,130,false],
+['t440',220,639,657,false],
+['t441',400,558,102,false],
+['t442',400,657,1696,false],
+['t443',834,558,1696,false],
+['t444',834,558,400,false],
+['t445',777,1561,558,false],
+['t446',604,656,558,false],
+['t447',1545,1443,657,false],
+['t448',1246,558,1012,false],
+['t449',1334,558,949,false],
+['t450',1334,558,1406,false],
+['t451',859,977,1108,false],
+['t452',710,402,187,false],
+['t453',358,558,1129,false],
+['t454',358,558,1129,false],
+['t455',943,1717,1113,false],
+['t456',1263,871,1001,false],
+['t457',943,657,52,false],
+['t458',943,568,498,false],
+['t459',1250,138,558,false],
+['t460',1250,990,558,false],
+['t461',1250,1041,657,false],
+['t462',1011,558,1214,false],
+['t463',1655,558,182,false],
+['t464',1136,1356,558,false],
+['t465',378,909,558,false],
+['t466',35,71,558,false],
+['t467',35,654,657,false],
+['t468',554,1180,558,false],
+['t469',554,558,964,false],
+['t470',787,1304,558,false],
+['t471',967,1347,558,false],
+['t472',967,558,104,false],
+['t473',710,571,343,false],
+['t474',943,207,1061,false],
+['t475',980,473,1004,false],
+['t476',89,558,958,false],
+['t477',963,657,672,false],
+['t478',1240,863,558,false],
+['t479',943,164,333,false],
+['t480',174,558,1197,false],
+['t481',781,558,1170,false],
+['t482',670,1417,657,false],
+['t483',994,558,1443,false],
+['t484',994,1443,558,false],
+['t485',994,558,1443,false],
+['t486',994,558,1443,false],
+['t487',994,1443,558,false],
+['t488',994,558,1443,false],
+['t489',994,1443,558,false],
+['t490',1439,558,518,false],
+['t491',654,1435,721,false],
+['t492',13,558,880,false],
+['t493',670,747,558,false],
+['t494',1472,1480,558,false],
+['t495',1587,1294,558,false],
+['t496',1587,558,1083,false],
+['t497',1628,1285,942,false],
+['t498',506,558,877,false],
+['t499',824,1278,1642,false],
+['t500',59,722,1084,false],
+['t501',1396,1347,558,false],
+['t502',1676,558,634,false],
+['t503',1676,86,657,false],
+['t504',943,194,310,false],
+['t505',118,1092,558,false],
+['t506',1176,558,572,false],
+['t507',1336,61,558,false],
+['t508',1100,268,558,false],
+['t509',1100,268,558,false],
+['t510',1100,268,558,false],
+['t511',712,558,383,false],
+['t512',1337,1560,558,false],
+['t513',1603,558,3,false],
+['t514',443,1422,754,false],
+['t515',443,558,755,false],
+['t516',943,496,601,false],
+['t517',1223,225,558,false],
+['t518',1223,657,859,false],
+['t519',337,895,558,false],
+['t520',1225,558,1222,false],
+['t521',710,87,870,false],
+['t522',1015,684,1414,false],
+['t523',1015,1437,606,false],
+['t524',943,844,459,false],
+['t525',175,568,558,false],
+['t526',1517,916,558,false],
+['t527',1015,765,1299,false],
+['t528',1015,1630,314,false],
+['t529',1015,121,331,false],
+['t530',293,1402,57,false],
+['t531',293,207,356,false],
+['t532',293,810,558,false],
+['t533',335,734,1106,false],
+['t534',807,330,558,false],
+['t535',990,1041,558,false],
+['t536',990,138,657,false],
+['t537',1357,558,1575,false],
+['t538',1097,558,1475,false],
+['t539',59,740,1691,false],
+['t540',787,51,29,false],
+['t541',1635,558,203,false],
+['t542',710,1641,237,false],
+['t543',710,724,409,false],
+['t544',1662,1426,845,false],
+['t545',267,558,80,false],
+['t546',206,387,916,false],
+['t547',59,649,1071,false],
+['t548',505,22,1572,false],
+['t549',505,558,193,false],
+['t550',943,1071,495,false],
+['t551',1109,1130,558,false],
+['t552',1417,1163,558,false],
+['t553',1417,558,1163,false],
+['t554',1417,1163,558,false],
+['t555',1417,558,1163,false],
+['t556',1417,1163,558,false],
+['t557',943,718,116,false],
+['t558',1236,165,558,false],
+['t559',8,1584,345,false],
+['t560',1634,558,37,false],
+['t561',1634,558,224,false],
+['t562',10,176,558,false],
+['t563',55,628,558,false],
+['t564',1614,299,1616,false],
+['t565',925,558,335,false],
+['t566',664,558,1697,false],
+['t567',1465,558,1134,false],
+['t568',1459,122,558,false],
+['t569',1459,1030,558,false],
+['t570',772,558,1305,false],
+['t571',772,657,921,false],
+['t572',1098,558,496,false],
+['t573',1079,481,558,false],
+['t574',943,534,558,false],
+['t575',459,625,558,false],
+['t576',43,830,558,false],
+['t577',558,103,558,false],
+['t578',755,566,580,false],
+['t579',1634,520,657,false],
+['t580',732,558,17,false],
+['t581',732,558,1536,false],
+['t582',710,248,1679,false],
+['t583',710,223,1215,false],
+['t584',748,1327,558,false],
+['t585',1078,558,511,false],
+['t586',863,1108,719,false],
+['t587',863,991,87,false],
+['t588',863,1473,1424,false],
+['t589',863,1302,1661,false],
+['t590',863,892,1095,false],
+['t591',863,1503,1387,false],
+['t592',863,833,1014,false],
+['t593',863,493,1147,false],
+['t594',1374,1368,558,false],
+['t595',322,657,1493,false],
+['t596',322,1493,657,false],
+['t597',322,1493,657,false],
+['t598',322,1493,657,false],
+['t599',1536,558,1233,false],
+['t600',1536,558,286,false],
+['t601',1536,558,382,false],
+['t602',1536,558,1173,false],
+['t603',1536,558,1543,false],
+['t604',1536,558,76,false],
+['t605',1536,1658,558,false],
+['t606',1536,245,558,false],
+['t607',1536,985,558,false],
+['t608',1536,558,682,false],
+['t609',1536,558,665,false],
+['t610',1536,558,271,false],
+['t611',1536,558,552,false],
+['t612',1536,1623,558,false],
+['t613',1536,403,558,false],
+['t614',1536,1273,558,false],
+['t615',1536,558,1337,false],
+['t616',1536,558,1355,false],
+['t617',1536,558,787,false],
+['t618',1536,558,575,false],
+['t619',1536,558,257,false],
+['t620',1536,179,558,false],
+['t621',1536,131,558,false],
+['t622',1536,1420,558,false],
+['t623',1536,558,1342,false],
+['t624',1536,558,4,false],
+['t625',1536,558,1396,false],
+['t626',1536,558,167,false],
+['t627',1536,558,303,false],
+['t628',1536,1504,558,false],
+['t629',1536,1721,558,false],
+['t630',1536,1074,558,false],
+['t631',1536,558,1478,false],
+['t632',1536,558,594,false],
+['t633',1536,558,1292,false],
+['t634',1536,558,1114,false],
+['t635',1536,558,1476,false],
+['t636',1536,1226,558,false],
+['t637',1536,1419,558,false],
+['t638',943,573,1491,false],
+['t639',236,558,272,false],
+['t640',587,558,299,false],
+['t641',337,1466,558,false],
+['t642',337,1601,558,false],
+['t643',337,558,1173,false],
+['t644',337,558,1562,false],
+['t645',337,558,1543,false],
+['t646',337,558,1540,false],
+['t647',337,558,245,false],
+['t648',337,985,558,false],
+['t649',337,682,558,false],
+['t650',337,665,558,false],
+['t651',337,558,286,false],
+['t652',337,558,271,false],
+['t653',337,558,370,false],
+['t654',337,558,403,false],
+['t655',337,558,804,false],
+['t656',337,712,558,false],
+['t657',337,546,558,false],
+['t658',337,776,558,false],
+['t659',337,558,257,false],
+['t660',337,558,179,false],
+['t661',337,558,1420,false],
+['t662',337,558,4,false],
+['t663',337,167,558,false],
+['t664',337,303,558,false],
+['t665',337,1504,558,false],
+['t666',337,487,558,false],
+['t667',337,558,579,false],
+['t668',337,558,145,false],
+['t669',337,558,259,false],
+['t670',337,558,517,false],
+['t671',337,352,558,false],
+['t672',337,750,558,false],
+['t673',337,528,558,false],
+['t674',337,691,558,false],
+['t675',337,558,1646,false],
+['t676',337,558,1114,false],
+['t677',337,558,1476,false],
+['t678',337,558,1226,false],
+['t679',337,1665,558,false],
+['t680',337,840,558,false],
+['t681',337,1164,558,false],
+['t682',943,473,848,false],
+['t683',943,614,389,false],
+['t684',1359,558,249,false],
+['t685',943,960,1081,false],
+['t686',248,1154,558,false],
+['t687',248,180,558,false],
+['t688',1202,558,1367,false],
+['t689',1202,558,57,false],
+['t690',307,558,620,false],
+['t691',784,558,256,false],
+['t692',1551,558,278,false],
+['t693',567,171,558,false],
+['t694',567,1026,558,false],
+['t695',567,657,322,false],
+['t696',551,558,8,false],
+['t697',943,1620,1125,false],
+['t698',558,1297,558,false],
+['t699',832,1275,558,false],
+['t700',491,437,558,false],
+['t701',1502,642,558,false],
+['t702',1502,951,558,false],
+['t703',1502,1152,657,false],
+['t704',892,744,558,false],
+['t705',79,911,696,false],
+['t706',943,277,893,false],
+['t707',412,1257,558,false],
+['t708',1714,1189,262,false],
+['t709',1241,177,558,false],
+['t710',833,558,351,false],
+['t711',43,558,1541,false],
+['t712',1529,558,91,false],
+['t713',167,558,11,false],
+['t714',710,854,1395,false],
+['t715',1126,1290,558,false],
+['t716',699,1556,986,false],
+['t717',699,867,558,false],
+['t718',1057,1649,558,false],
+['t719',1070,558,1538,false],
+['t720',1070,1334,558,false],
+['t721',1070,558,200,false],
+['t722',1112,382,558,false],
+['t723',1112,1233,558,false],
+['t724',1112,84,558,false],
+['t725',1112,1543,558,false],
+['t726',1112,76,558,false],
+['t727',1112,1658,558,false],
+['t728',1112,786,558,false],
+['t729',1112,1664,558,false],
+['t730',1112,1482,558,false],
+['t731',1112,286,558,false],
+['t732',1112,271,558,false],
+['t733',1112,370,558,false],
+['t734',1112,552,558,false],
+['t735',1112,1612,558,false],
+['t736',1112,1487,558,false],
+['t737',1112,784,558,false],
+['t738',1112,764,558,false],
+['t739',1112,1057,558,false],
+['t740',1112,1582,558,false],
+['t741',1112,1031,558,false],
+['t742',1112,804,558,false],
+['t743',1112,1311,558,false],
+['t744',1112,1428,558,false],
+['t745',1112,1520,558,false],
+['t746',1112,1259,558,false],
+['t747',1112,857,558,false],
+['t748',1112,712,558,false],
+['t749',1112,1337,558,false],
+['t750',1112,1381,558,false],
+['t751',1112,776,558,false],
+['t752',1112,157,558,false],
+['t753',1112,1324,558,false],
+['t754',1112,179,558,false],
+['t755',1112,131,558,false],
+['t756',1112,4,558,false],
+['t757',1112,1396,558,false],
+['t758',1112,167,558,false],
+['t759',1112,303,558,false],
+['t760',1112,1086,558,false],
+['t761',1112,1074,558,false],
+['t762',1112,487,558,false],
+['t763',1112,579,558,false],
+['t764',1112,0,558,false],
+['t765',1112,1478,558,false],
+['t766',1112,594,558,false],
+['t767',1112,1210,558,false],
+['t768',1112,1557,558,false],
+['t769',1112,259,558,false],
+['t770',1112,1052,558,false],
+['t771',1112,791,558,false],
+['t772',1112,352,558,false],
+['t773',1112,750,558,false],
+['t774',1112,932,558,false],
+['t775',1112,1589,558,false],
+['t776',1112,446,558,false],
+['t777',1112,528,558,false],
+['t778',1112,309,558,false],
+['t779',1112,1430,558,false],
+['t780',1112,1646,558,false],
+['t781',1112,1476,558,false],
+['t782',1112,1226,558,false],
+['t783',1112,1569,558,false],
+['t784',1112,950,558,false],
+['t785',1112,1665,558,false],
+['t786',1112,1710,558,false],
+['t787',1112,1050,558,false],
+['t788',1112,607,558,false],
+['t789',1112,219,558,false],
+['t790',1300,1384,558,false],
+['t791',710,416,1016,false],
+['t792',276,558,1637,false],
+['t793',1544,586,1330,false],
+['t794',1544,586,1330,false],
+['t795',943,1607,318,false],
+['t796',1328,558,1466,false],
+['t797',1328,271,558,false],
+['t798',1328,370,558,false],
+['t799',1328,558,552,false],
+['t800',1328,558,1612,false],
+['t801',1328,558,1487,false],
+['t802',1328,558,784,false],
+['t803',1328,558,244,false],
+['t804',1328,558,1623,false],
+['t805',1328,764,558,false],
+['t806',1328,403,558,false],
+['t807',1328,558,1582,false],
+['t808',1328,558,1031,false],
+['t809',1328,558,804,false],
+['t810',1328,558,1311,false],
+['t811',1328,558,1520,false],
+['t812',1328,558,857,false],
+['t813',1328,712,558,false],
+['t814',1328,558,1381,false],
+['t815',1328,558,546,false],
+['t816',1328,558,776,false],
+['t817',1328,558,157,false],
+['t818',1328,558,1243,false],
+['t819',1328,558,1324,false],
+['t820',1328,131,558,false],
+['t821',1328,1396,558,false],
+['t822',1328,558,303,false],
+['t823',1328,558,1504,false],
+['t824',1328,558,1086,false],
+['t825',1328,558,1074,false],
+['t826',1328,558,1246,false],
+['t827',1328,558,487,false],
+['t828',1328,579,558,false],
+['t829',1328,0,558,false],
+['t830',1328,558,1478,false],
+['t831',1328,558,594,false],
+['t832',1328,558,1557,false],
+['t833',1328,558,259,false],
+['t834',1328,558,1052,false],
+['t835',1328,558,791,false],
+['t836',1328,352,558,false],
+['t837',1328,750,558,false],
+['t838',1328,558,932,false],
+['t839',1328,558,1589,false],
+['t840',1328,558,446,false],
+['t841',1328,558,528,false],
+['t842',1328,558,309,false],
+['t843',1328,558,1430,false],
+['t844',1328,691,558,false],
+['t845',1328,1292,558,false],
+['t846',1328,558,1646,false],
+['t847',1328,558,1114,false],
+['t848',1328,558,1476,false],
+['t849',1328,558,1226,false],
+['t850',1328,558,1569,false],
+['t851',1328,558,1665,false],
+['t852',1328,1050,558,false],
+['t853',1328,558,1174,false],
+['t854',1063,558,1310,false],
+['t855',963,672,657,false],
+['t856',840,558,846,false],
+['t857',1131,558,187,false],
+['t858',243,566,802,false],
+['t859',216,516,558,false],
+['t860',216,1610,558,false],
+['t861',1299,558,1046,false],
+['t862',1107,389,558,false],
+['t863',639,416,107,false],
+['t864',1007,558,1334,false],
+['t865',1673,558,754,false],
+['t866',639,1636,707,false],
+['t867',573,1484,558,false],
+['t868',1241,558,1013,false],
+['t869',1241,558,1217,false],
+['t870',291,558,1157,false],
+['t871',291,657,1564,false],
+['t872',1524,1225,558,false],
+['t873',1721,558,10,false],
+['t874',278,558,1488,false],
+['t875',462,558,1278,false],
+['t876',599,725,558,false],
+['t877',692,441,558,false],
+['t878',692,325,657,false],
+['t879',1259,558,300,false],
+['t880',760,1350,558,false],
+['t881',1473,558,458,false],
+['t882',820,27,558,false],
+['t883',383,917,558,false],
+['t884',622,558,386,false],
+['t885',248,1649,558,false],
+['t886',16,472,1366,false],
+['t887',899,558,850,false],
+['t888',353,558,147,false],
+['t889',353,558,147,false],
+['t890',1385,558,347,false],
+['t891',710,1132,1087,false],
+['t892',248,1180,558,false],
+['t893',943,1373,188,false],
+['t894',817,486,558,false],
+['t895',997,657,963,false],
+['t896',997,1523,558,false],
+['t897',997,635,558,false],
+['t898',225,859,558,false],
+['t899',640,136,558,false],
+['t900',640,860,558,false],
+['t901',155,1021,558,false],
+['t902',155,425,558,false],
+['t903',440,558,1555,false],
+['t904',432,1686,558,false],
+['t905',432,1097,558,false],
+['t906',635,558,672,false],
+['t907',635,672,558,false],
+['t908',635,558,672,false],
+['t909',635,672,558,false],
+['t910',635,558,672,false],
+['t911',635,672,558,false],
+['t912',635,672,558,false],
+['t913',43,558,1534,false],
+['t914',967,1330,558,false],
+['t915',181,721,558,false],
+['t916',943,1225,683,false],
+['t917',726,558,630,false],
+['t918',1195,558,1191,false],
+['t919',1195,1254,657,false],
+['t920',771,1055,558,false],
+['t921',221,251,558,false],
+['t922',221,558,251,false],
+['t923',248,558,372,false],
+['t924',248,1365,1085,false],
+['t925',943,359,92,false],
+['t926',710,626,756,false],
+['t927',710,457,823,false],
+['t928',255,558,741,false],
+['t929',1140,148,657,false],
+['t930',1288,1634,558,false],
+['t931',383,558,1040,false],
+['t932',383,1040,558,false],
+['t933',1637,558,699,false],
+['t934',270,1445,1495,false],
+['t935',1593,558,1552,false],
+['t936',1593,362,657,false],
+['t937',1666,1525,957,false],
+['t938',1666,250,953,false],
+['t939',1666,701,740,false],
+['t940',1666,884,1071,false],
+['t941',1666,308,296,false],
+['t942',1666,1469,277,false],
+['t943',1666,1459,722,false],
+['t944',1666,304,177,false],
+['t945',341,558,256,false],
+['t946',16,1558,428,false],
+['t947',691,252,591,false],
+['t948',558,558,1672,false],
+['t949',439,1053,558,false],
+['t950',156,558,786,false],
+['t951',156,558,1664,false],
+['t952',156,558,1482,false],
+['t953',156,558,1243,false],
+['t954',156,558,822,false],
+['t955',156,1324,558,false],
+['t956',156,558,1646,false],
+['t957',156,1155,558,false],
+['t958',156,558,301,false],
+['t959',156,558,950,false],
+['t960',156,558,1665,false],
+['t961',156,558,1710,false],
+['t962',943,1302,657,false],
+['t963',943,1694,1,false],
+['t964',874,54,1403,false],
+['t965',1120,558,137,false],
+['t966',558,1171,558,false],
+['t967',833,744,558,false],
+['t968',368,218,558,false],
+['t969',623,319,1707,false],
+['t970',623,388,558,false],
+['t971',1578,1368,558,false],
+['t972',1027,558,476,false],
+['t973',1589,368,558,false],
+['t974',1589,104,558,false],
+['t975',153,558,1096,false],
+['t976',440,1352,558,false],
+['t977',440,104,558,false],
+['t978',440,812,558,false],
+['t979',1585,558,962,false],
+['t980',1398,1489,558,false],
+['t981',258,1103,1106,false],
+['t982',979,1347,558,false],
+['t983',370,558,1464,false],
+['t984',955,558,1671,false],
+['t985',1343,911,558,false],
+['t986',790,558,434,false],
+['t987',1054,558,70,false],
+['t988',1543,558,1106,false],
+['t989',1150,320,558,false],
+['t990',283,1108,488,false],
+['t991',775,657,1608,false],
+['t992',775,1423,558,false],
+['t993',775,869,558,false],
+['t994',283,1473,481,false],
+['t995',1164,340,558,false],
+['t996',248,558,1382,false],
+['t997',575,673,1053,false],
+['t998',879,703,927,false],
+['t999',415,931,558,false],
+['t1000',88,1375,558,false],
+['t1001',1110,771,558,false],
+['t1002',1506,965,1388,false],
+['t1003',1506,295,558,false],
+['t1004',353,558,7,false],
+['t1005',353,558,7,false],
+['t1006',353,558,466,false],
+['t1007',73,920,558,false],
+['t1008',65,651,558,false],
+['t1009',710,248,902,false],
+['t1010',1384,1182,558,false],
+['t1011',943,1675,895,false],
+['t1012',25,674,558,false],
+['t1013',943,1588,829,false],
+['t1014',943,894,1281,false],
+['t1015',943,369,1075,false],
+['t1016',943,929,1234,false],
+['t1017',688,558,1223,false],
+['t1018',943,1638,1537,false],
+['t1019',110,701,716,false],
+['t1020',510,1716,558,false],
+['t1021',1113,161,558,false],
+['t1022',861,1382,558,false],
+['t1023',1247,558,1068,false],
+['t1024',471,1591,1591,false],
+['t1025',471,558,1591,false],
+['t1026',471,558,1591,false],
+['t1027',471,558,1591,false],
+['t1028',471,558,1591,false],
+['t1029',471,558,1591,false],
+['t1030',471,558,1591,false],
+['t1031',471,558,1591,false],
+['t1032',471,1591,558,false],
+['t1033',353,558,1325,false],
+['t1034',353,558,1325,false],
+['t1035',353,558,769,false],
+['t1036',358,1467,657,false],
+['t1037',710,463,1094,false],
+['t1038',879,1590,1620,false],
+['t1039',645,558,1368,false],
+['t1040',248,558,1275,false],
+['t1041',52,558,1267,false],
+['t1042',710,494,514,false],
+['t1043',954,279,558,false],
+['t1044',954,367,558,false],
+['t1045',236,558,1427,false],
+['t1046',271,558,1464,false],
+['t1047',114,558,1496,false],
+['t1048',943,1251,843,false],
+['t1049',1437,558,1519,false],
+['t1050',710,262,1447,false],
+['t1051',522,558,1196,false],
+['t1052',639,246,153,false],
+['t1053',691,558,790,false],
+['t1054',1182,1601,558,false],
+['t1055',1182,258,558,false],
+['t1056',1182,665,558,false],
+['t1057',1182,764,558,false],
+['t1058',1182,1057,558,false],
+['t1059',1182,1381,558,false],
+['t1060',1182,303,558,false],
+['t1061',1182,285,558,false],
+['t1062',1182,594,558,false],
+['t1063',1182,1052,558,false],
+['t1064',1182,1589,558,false],
+['t1065',1182,309,558,false],
+['t1066',1182,1646,558,false],
+['t1067',1182,904,558,false],
+['t1068',1182,1476,558,false],
+['t1069',1182,950,558,false],
+['t1070',1182,558,607,false],
+['t1071',1182,219,558,false],
+['t1072',943,558,984,false],
+['t1073',943,558,549,false],
+['t1074',943,558,437,false],
+['t1075',943,558,859,false],
+['t1076',943,558,1068,false],
+['t1077',943,558,654,false],
+['t1078',943,874,558,false],
+['t1079',984,558,1167,false],
+['t1080',710,851,792,false],
+['t1081',984,558,1248,false],
+['t1082',984,558,1142,false],
+['t1083',984,558,1627,false],
+['t1084',984,558,530,false],
+['t1085',1052,558,510,false],
+['t1086',1052,558,134,false],
+['t1087',1165,105,558,false],
+['t1088',1165,558,942,false],
+['t1089',37,945,945,false],
+['t1090',37,945,558,false],
+['t1091',37,945,558,false],
+['t1092',37,945,558,false],
+['t1093',37,945,558,false],
+['t1094',37,558,945,false],
+['t1095',37,945,558,false],
+['t1096',37,945,558,false],
+['t1097',37,558,945,false],
+['t1098',8,36,558,false],
+['t1099',8,150,558,false],
+['t1100',570,1030,333,false],
+['t1101',1258,591,558,false],
+['t1102',943,684,657,false],
+['t1103',1259,558,1649,false],
+['t1104',943,1724,448,false],
+['t1105',685,558,1598,false],
+['t1106',1238,558,1060,false],
+['t1107',921,371,957,false],
+['t1108',921,965,250,false],
+['t1109',921,22,740,false],
+['t1110',921,274,1071,false],
+['t1111',921,651,296,false],
+['t1112',921,486,277,false],
+['t1113',921,722,1197,false],
+['t1114',921,304,532,false],
+['t1115',710,1376,1288,false],
+['t1116',1569,558,327,false],
+['t1117',988,640,558,false],
+['t1118',943,34,828,false],
+['t1119',943,657,1188,false],
+['t1120',151,558,2,false],
+['t1121',1326,72,558,false],
+['t1122',710,1339,597,false],
+['t1123',402,558,834,false],
+['t1124',485,436,558,false],
+['t1125',361,809,558,false],
+['t1126',943,442,509,false],
+['t1127',1025,558,564,false],
+['t1128',1320,558,1601,false],
+['t1129',1320,558,382,false],
+['t1130',1320,558,1173,false],
+['t1131',1320,558,1233,false],
+['t1132',1320,1562,558,false],
+['t1133',1320,558,1543,false],
+['t1134',1320,558,76,false],
+['t1135',1320,558,1658,false],
+['t1136',1320,558,1540,false],
+['t1137',1320,558,245,false],
+['t1138',1320,558,985,false],
+['t1139',1320,558,786,false],
+['t1140',1320,1664,558,false],
+['t1141',1320,558,682,false],
+['t1142',1320,558,1482,false],
+['t1143',1320,558,665,false],
+['t1144',1320,558,286,false],
+['t1145',1320,558,324,false],
+['t1146',1320,558,1337,false],
+['t1147',1320,558,1355,false],
+['t1148',1320,558,787,false],
+['t1149',1320,558,257,false],
+['t1150',1320,558,179,false],
+['t1151',1320,558,1420,false],
+['t1152',1320,558,4,false],
+['t1153',1320,558,167,false],
+['t1154',1320,558,145,false],
+['t1155',1320,558,517,false],
+['t1156',1320,558,301,false],
+['t1157',1320,558,950,false],
+['t1158',1320,1710,558,false],
+['t1159',1320,1419,558,false],
+['t1160',1320,558,1164,false],
+['t1161',1068,977,624,false],
+['t1162',236,558,79,false],
+['t1163',1023,1003,558,false],
+['t1164',1023,1425,924,false],
+['t1165',1068,1645,478,false],
+['t1166',1068,704,458,false],
+['t1167',811,753,558,false],
+['t1168',811,753,558,false],
+['t1169',519,558,127,false],
+['t1170',519,135,657,false],
+['t1171',1360,1575,558,false],
+['t1172',1155,558,252,false],
+['t1173',1628,1348,558,false],
+['t1174',16,1703,468,false],
+['t1175',1074,366,558,false],
+['t1176',1063,308,1583,false],
+['t1177',1513,558,234,false],
+['t1178',946,558,384,false],
+['t1179',1653,558,128,false],
+['t1180',773,275,558,false],
+['t1181',376,66,558,false],
+['t1182',376,558,842,false],
+['t1183',376,1479,657,false],
+['t1184',943,98,1709,false],
+['t1185',686,558,1282,false],
+['t1186',710,562,645,false],
+['t1187',467,1705,558,false],
+['t1188',1392,297,346,false],
+['t1189',1392,558,284,false],
+['t1190',526,558,1227,false],
+['t1191',552,558,1464,false],
+['t1192',1425,558,78,false],
+['t1193',1425,1310,142,false],
+['t1194',117,558,1617,false],
+['t1195',92,422,558,false],
+['t1196',991,558,744,false],
+['t1197',1294,851,558,false],
+['t1198',943,197,944,false],
+['t1199',1658,558,1106,false],
+['t1200',710,1684,1418,false],
+['t1201',516,388,558,false],
+['t1202',1221,1566,558,false],
+['t1203',812,558,1044,false],
+['t1204',943,1352,1131,false],
+['t1205',1355,558,1560,false],
+['t1206',710,1375,95,false],
+['t1207',710,1089,1529,false],
+['t1208',844,454,946,false],
+['t1209',129,331,1336,false],
+['t1210',129,314,166,false],
+['t1211',129,1405,606,false],
+['t1212',129,1414,1188,false],
+['t1213',352,1391,558,false],
+['t1214',352,1352,558,false],
+['t1215',943,820,1657,false],
+['t1216',553,511,845,false],
+['t1217',1272,558,608,false],
+['t1218',413,558,123,false],
+['t1219',1142,558,185,false],
+['t1220',1142,558,404,false],
+['t1221',43,21,558,false],
+['t1222',1449,558,944,false],
+['t1223',1675,337,558,false],
+['t1224',16,363,1091,false],
+['t1225',1233,558,1717,false],
+['t1226',384,885,558,false],
+['t1227',384,550,558,false],
+['t1228',943,176,598,false],
+['t1229',943,1592,1653,false],
+['t1230',943,558,891,false],
+['t1231',702,558,1562,false],
+['t1232',702,1543,558,false],
+['t1233',702,76,558,false],
+['t1234',702,1540,558,false],
+['t1235',702,245,558,false],
+['t1236',702,985,558,false],
+['t1237',702,786,558,false],
+['t1238',702,682,558,false],
+['t1239',702,244,558,false],
+['t1240',702,324,558,false],
+['t1241',702,558,1466,false],
+['t1242',702,546,558,false],
+['t1243',702,1324,558,false],
+['t1244',702,179,558,false],
+['t1245',702,1396,558,false],
+['t1246',702,167,558,false],
+['t1247',702,1074,558,false],
+['t1248',702,1246,558,false],
+['t1249',702,53,558,false],
+['t1250',702,691,558,false],
+['t1251',702,1665,558,false],
+['t1252',248,558,191,false],
+['t1253',778,558,1275,false],
+['t1254',31,687,558,false],
+['t1255',444,657,42,false],
+['t1256',1228,1196,558,false],
+['t1257',1140,148,657,false],
+['t1258',943,67,1036,false],
+['t1259',1632,1236,558,false],
+['t1260',1632,1220,558,false],
+['t1261',163,1498,558,false],
+['t1262',163,903,558,false],
+['t1263',1620,1576,558,false],
+['t1264',943,1011,862,false],
+['t1265',710,1687,222,false],
+['t1266',710,299,1625,false],
+['t1267',943,1008,169,false],
+['t1268',1321,1714,558,false],
+['t1269',1244,1103,558,false],
+['t1270',1433,620,558,false],
+['t1271',710,254,1353,false],
+['t1272',943,340,1283,false],
+['t1273',681,433,1023,false],
+['t1274',1446,430,206,false],
+['t1275',1010,311,558,false],
+['t1276',1010,1334,558,false],
+['t1277',1047,558,534,false],
+['t1278',796,35,558,false],
+['t1279',1262,1407,933,false],
+['t1280',943,296,1490,false],
+['t1281',667,558,928,false],
+['t1282',284,891,1032,false],
+['t1283',292,1070,558,false],
+['t1284',26,60,558,false],
+['t1285',26,1512,558,false],
+['t1286',26,1173,558,false],
+['t1287',26,258,558,false],
+['t1288',26,245,558,false],
+['t1289',26,682,558,false],
+['t1290',26,492,558,false],
+['t1291',26,1204,558,false],
+['t1292',26,558,58,false],
+['t1293',26,342,558,false],
+['t1294',26,257,558,false],
+['t1295',26,354,558,false],
+['t1296',26,1168,558,false],
+['t1297',26,1721,558,false],
+['t1298',26,1239,558,false],
+['t1299',26,558,461,false],
+['t1300',26,447,558,false],
+['t1301',26,660,558,false],
+['t1302',26,1292,558,false],
+['t1303',26,1114,558,false],
+['t1304',26,904,558,false],
+['t1305',26,558,1419,false],
+['t1306',26,281,558,false],
+['t1307',26,1164,558,false],
+['t1308',1651,558,168,false],
+['t1309',437,1242,704,false],
+['t1310',943,889,1104,false],
+['t1311',991,1474,558,false],
+['t1312',1247,48,558,false],
+['t1313',1247,1331,558,false],
+['t1314',456,1039,558,false],
+['t1315',647,939,558,false],
+['t1316',943,825,138,false],
+['t1317',1036,717,558,false],
+['t1318',1672,558,1650,false],
+['t1319',509,1270,558,false],
+['t1320',653,558,390,false],
+['t1321',179,558,1455,false],
+['t1322',862,1365,558,false],
+['t1323',866,657,9,false],
+['t1324',1055,1560,558,false],
+['t1325',1038,269,558,false],
+['t1326',1622,558,1019,false],
+['t1327',1622,1294,558,false],
+['t1328',1484,558,1491,false],
+['t1329',882,558,1374,false],
+['t1330',725,306,558,false],
+['t1331',1448,1619,558,false],
+['t1332',943,831,858,false],
+['t1333',1511,1598,262,false],
+['t1334',1042,1444,991,false],
+['t1335',172,1633,558,false],
+['t1336',172,210,657,false],
+['t1337',1357,678,558,false],
+['t1338',1302,558,1600,false],
+['t1339',1186,98,1150,false],
+['t1340',1533,558,964,false],
+['t1341',331,149,558,false],
+['t1342',984,558,1522,false],
+['t1343',1715,558,1399,false],
+['t1344',1715,558,1399,false],
+['t1345',1715,1105,657,false],
+['t1346',677,726,558,false],
+['t1347',989,565,558,false],
+['t1348',1022,558,329,false],
+['t1349',689,558,1465,false],
+['t1350',943,396,796,false],
+['t1351',943,153,1100,false],
+['t1352',1442,793,558,false],
+['t1353',1380,558,109,false],
+['t1354',967,558,405,false],
+['t1355',1693,1312,558,false],
+['t1356',1601,1604,558,false],
+['t1357',1601,558,1397,false],
+['t1358',1247,558,1698,false],
+['t1359',558,558,175,false],
+['t1360',269,1030,333,false],
+['t1361',603,1721,558,false],
+['t1362',235,1483,336,false],
+['t1363',235,558,1084,false],
+['t1364',149,970,558,false],
+['t1365',149,558,762,false],
+['t1366',892,558,478,false],
+['t1367',295,965,558,false],
+['t1368',791,273,558,false],
+['t1369',791,677,558,false],
+['t1370',116,1597,558,false],
+['t1371',116,558,1597,false],
+['t1372',116,1597,558,false],
+['t1373',1683,558,966,false],
+['t1374',441,325,558,false],
+['t1375',1109,558,1649,false],
+['t1376',627,558,318,false],
+['t1377',538,330,881,false],
+['t1378',43,558,1223,false],
+['t1379',282,874,558,false],
+['t1380',33,558,1301,false],
+['t1381',853,1517,558,false],
+['t1382',425,1388,558,false],
+['t1383',425,295,558,false],
+['t1384',876,1584,558,false],
+['t1385',283,1458,833,false],
+['t1386',1356,326,558,false],
+['t1387',1318,637,558,false],
+['t1388',1691,516,558,false],
+['t1389',394,558,401,false],
+['t1390',1415,558,471,false],
+['t1391',1415,558,466,false],
+['t1392',710,1290,698,false],
+['t1393',943,111,955,false],
+['t1394',943,62,1690,false],
+['t1395',943,374,1669,false],
+['t1396',675,888,558,false],
+['t1397',675,888,558,false],
+['t1398',697,558,872,false],
+['t1399',1239,636,558,false],
+['t1400',792,732,106,false],
+['t1401',1005,558,93,false],
+['t1402',978,419,558,false],
+['t1403',1328,558,1320,false],
+['t1404',1304,558,1688,false],
+['t1405',828,558,998,false],
+['t1406',248,1145,558,false],
+['t1407',248,604,558,false],
+['t1408',710,533,599,false],
+['t1409',1064,558,694,false],
+['t1410',321,558,849,false],
+['t1411',321,657,247,false],
+['t1412',1228,384,558,false],
+['t1413',1228,384,558,false],
+['t1414',1377,385,558,false],
+['t1415',1177,558,1614,false],
+['t1416',857,558,300,false],
+['t1417',353,558,520,false],
+['t1418',353,558,520,false],
+['t1419',353,558,224,false],
+['t1420',194,60,558,false],
+['t1421',194,1512,558,false],
+['t1422',194,84,558,false],
+['t1423',194,558,1623,false],
+['t1424',194,558,403,false],
+['t1425',194,558,1428,false],
+['t1426',194,558,492,false],
+['t1427',194,558,1204,false],
+['t1428',194,1259,558,false],
+['t1429',194,558,342,false],
+['t1430',194,558,1355,false],
+['t1431',194,558,787,false],
+['t1432',194,558,575,false],
+['t1433',194,1243,558,false],
+['t1434',194,822,558,false],
+['t1435',194,1420,558,false],
+['t1436',194,558,1342,false],
+['t1437',194,558,1504,false],
+['t1438',194,1168,558,false],
+['t1439',194,145,558,false],
+['t1440',194,1524,558,false],
+['t1441',194,1210,558,false],
+['t1442',194,461,558,false],
+['t1443',194,558,1155,false],
+['t1444',194,558,301,false],
+['t1445',194,558,1385,false],
+['t1446',558,558,650,false],
+['t1447',759,558,944,false],
+['t1448',879,1300,343,false],
+['t1449',1006,558,664,false],
+['t1450',710,675,330,false],
+['t1451',353,612,558,false],
+['t1452',353,612,558,false],
+['t1453',943,14,294,false],
+['t1454',943,586,832,false],
+['t1455',1567,558,60,false],
+['t1456',1567,558,1487,false],
+['t1457',1567,558,1031,false],
+['t1458',1567,1428,558,false],
+['t1459',1567,558,58,false],
+['t1460',1567,558,342,false],
+['t1461',1567,1381,558,false],
+['t1462',1567,558,579,false],
+['t1463',1567,558,120,false],
+['t1464',1567,558,677,false],
+['t1465',1567,558,447,false],
+['t1466',1567,558,660,false],
+['t1467',1567,558,1430,false],
+['t1468',1567,904,558,false],
+['t1469',1567,558,607,false],
+['t1470',1682,613,150,false],
+['t1471',91,558,1256,false],
+['t1472',91,657,574,false],
+['t1473',339,558,543,false],
+['t1474',595,239,558,false],
+['t1475',595,992,558,false],
+['t1476',1247,558,859,false],
+['t1477',943,676,907,false],
+['t1478',17,657,1536,false],
+['t1479',17,558,646,false],
+['t1480',1114,558,889,false],
+['t1481',1226,327,558,false],
+['t1482',1564,684,1661,false],
+['t1483',1564,1437,1095,false],
+['t1484',1564,1282,87,false],
+['t1485',1564,1242,1424,false],
+['t1486',1564,413,719,false],
+['t1487',320,1322,558,false],
+['t1488',320,735,558,false],
+['t1489',353,558,471,false],
+['t1490',353,558,471,false],
+['t1491',354,558,595,false],
+['t1492',444,643,558,false],
+['t1493',444,1613,558,false],
+['t1494',943,1431,1134,false],
+['t1495',1478,558,256,false],
+['t1496',1313,924,558,false],
+['t1497',1105,558,710,false],
+['t1498',1105,558,710,false],
+['t1499',1105,710,558,false],
+['t1500',1105,558,710,false],
+['t1501',1105,710,558,false],
+['t1502',1488,558,545,false],
+['t1503',1488,558,1547,false],
+['t1504',45,558,815,false],
+['t1505',647,558,570,false],
+['t1506',801,1491,1287,false],
+['t1507',470,467,558,false],
+['t1508',943,146,737,false],
+['t1509',801,1188,1531,false],
+['t1510',885,513,558,false],
+['t1511',353,558,37,false],
+['t1512',353,558,37,false],
+['t1513',96,350,313,false],
+['t1514',96,649,558,false],
+['t1515',288,558,798,false],
+['t1516',288,657,794,false],
+['t1517',1429,826,657,false],
+['t1518',43,625,558,false],
+['t1519',1532,558,34,false],
+['t1520',751,558,652,false],
+['t1521',1677,558,475,false],
+['t1522',1677,657,999,false],
+['t1523',943,865,958,false],
+['t1524',1186,1405,85,false],
+['t1525',1186,1648,1188,false],
+['t1526',1186,1,1287,false],
+['t1527',582,558,1067,false],
+['t1528',582,821,657,false],
+['t1529',1186,1336,448,false],
+['t1530',1186,589,166,false],
+['t1531',1629,558,263,false],
+['t1532',707,558,1502,false],
+['t1533',71,558,654,false],
+['t1534',1186,777,1001,false],
+['t1535',858,1719,558,false],
+['t1536',60,1717,558,false],
+['t1537',520,657,945,false],
+['t1538',520,657,945,false],
+['t1539',1104,253,558,false],
+['t1540',1552,362,558,false],
+['t1541',892,797,558,false],
+['t1542',644,678,558,false],
+['t1543',975,854,558,false],
+['t1544',1084,558,803,false],
+['t1545',1084,1314,558,false],
+['t1546',1205,1454,1494,false],
+['t1547',1205,260,558,false],
+['t1548',943,1689,982,false],
+['t1549',943,1001,657,false],
+['t1550',943,522,88,false],
+['t1551',1386,484,914,false],
+['t1552',31,307,558,false],
+['t1553',1287,1580,558,false],
+['t1554',1287,1580,558,false],
+['t1555',86,435,558,false],
+['t1556',86,558,435,false],
+['t1557',86,558,435,false],
+['t1558',86,558,435,false],
+['t1559',710,1624,248,false],
+['t1560',286,616,558,false],
+['t1561',803,482,558,false],
+['t1562',210,558,736,false],
+['t1563',210,558,736,false],
+['t1564',210,558,736,false],
+['t1565',210,558,736,false],
+['t1566',294,959,558,false],
+['t1567',128,558,1592,false],
+['t1568',353,558,42,false],
+['t1569',353,558,42,false],
+['t1570',353,558,1613,false],
+['t1571',910,558,1165,false],
+['t1572',943,658,989,false],
+['t1573',673,1304,558,false],
+['t1574',15,39,558,false],
+['t1575',710,1514,880,false],
+['t1576',708,549,558,false],
+['t1577',943,305,1531,false],
+['t1578',480,202,629,false],
+['t1579',710,472,1606,false],
+['t1580',943,44,90,false],
+['t1581',683,558,229,false],
+['t1582',1154,1380,558,false],
+['t1583',904,558,347,false],
+['t1584',943,559,608,false],
+['t1585',353,558,373,false],
+['t1586',353,558,373,false],
+['t1587',353,558,1720,false],
+['t1588',943,54,657,false],
+['t1589',943,722,68,false],
+['t1590',409,558,302,false],
+['t1591',362,841,957,false],
+['t1592',362,250,681,false],
+['t1593',362,350,740,false],
+['t1594',362,1071,1063,false],
+['t1595',362,296,477,false],
+['t1596',362,277,336,false],
+['t1597',362,722,1318,false],
+['t1598',943,469,875,false],
+['t1599',1664,844,558,false],
+['t1600',325,573,1287,false],
+['t1601',613,1656,450,false],
+['t1602',613,558,1159,false],
+['t1603',943,657,493,false],
+['t1604',943,1481,1452,false],
+['t1605',943,560,808,false],
+['t1606',572,1517,558,false],
+['t1607',693,1348,1525,false],
+['t1608',139,169,558,false],
+['t1609',334,558,1421,false],
+['t1610',353,643,558,false],
+['t1611',353,643,558,false],
+['t1612',248,46,558,false],
+['t1613',1137,558,1185,false],
+['t1614',560,558,412,false],
+['t1615',860,274,558,false],
+['t1616',943,436,85,false],
+['t1617',943,896,1284,false],
+['t1618',1716,558,180,false],
+['t1619',1349,588,558,false],
+['t1620',1045,558,1370,false],
+['t1621',943,1321,132,false],
+['t1622',943,1254,1307,false],
+['t1623',550,1347,558,false],
+['t1624',790,1137,816,false],
+['t1625',943,250,697,false],
+['t1626',639,825,864,false],
+['t1627',175,558,1588,false],
+['t1628',747,558,1417,false],
+['t1629',1460,558,1309,false],
+['t1630',1174,201,558,false],
+['t1631',353,558,798,false],
+['t1632',353,558,798,false],
+['t1633',353,558,288,false],
+['t1634',943,558,525,false],
+['t1635',943,558,628,false],
+['t1636',1111,1470,558,false],
+['t1637',1111,558,1614,false],
+['t1638',1680,313,558,false],
+['t1639',1680,649,558,false],
+['t1640',956,984,558,false],
+['t1641',1521,558,242,false],
+['t1642',325,1148,1150,false],
+['t1643',440,137,504,false],
+['t1644',1382,1649,558,false],
+['t1645',1382,300,558,false],
+['t1646',90,1433,558,false],
+['t1647',120,558,256,false],
+['t1648',1645,1063,185,false],
+['t1649',1645,404,558,false],
+['t1650',1258,558,1352,false],
+['t1651',987,558,1169,false],
+['t1652',95,558,531,false],
+['t1653',943,31,1051,false],
+['t1654',710,1368,1149,false],
+['t1655',1453,612,558,false],
+['t1656',1453,1720,558,false],
+['t1657',126,558,113,false],
+['t1658',750,1391,558,false],
+['t1659',640,558,1610,false],
+['t1660',1217,558,532,false],
+['t1661',43,476,558,false],
+['t1662',453,558,1213,false],
+['t1663',1371,620,558,false],
+['t1664',439,51,558,false],
+['t1665',1553,558,334,false],
+['t1666',1002,558,605,false],
+['t1667',1002,558,605,false],
+['t1668',1477,1541,558,false],
+['t1669',1428,558,1107,false],
+['t1670',1428,558,604,false],
+['t1671',558,558,89,false],
+['t1672',646,558,272,false],
+['t1673',1174,558,1293,false],
+['t1674',131,558,1455,false],
+['t1675',800,1331,558,false],
+['t1676',1247,558,741,false],
+['t1677',1564,121,1014,false],
+['t1678',1564,1630,1387,false],
+['t1679',943,1037,266,false],
+['t1680',42,657,650,false],
+['t1681',42,657,650,false],
+['t1682',1702,558,973,false],
+['t1683',1471,558,1119,false],
+['t1684',943,1586,621,false],
+['t1685',710,577,1046,false],
+['t1686',476,558,956,false],
+['t1687',476,984,657,false],
+['t1688',1562,1244,558,false],
+['t1689',1562,1351,558,false],
+['t1690',1503,961,558,false],
+['t1691',710,1093,226,false],
+['t1692',245,1358,558,false],
+['t1693',671,14,558,false],
+['t1694',1124,558,1662,false],
+['t1695',1269,558,1401,false],
+['t1696',1269,558,1249,false],
+['t1697',821,668,1451,false],
+['t1698',226,1593,558,false],
+['t1699',543,196,558,false],
+['t1700',543,657,1468,false],
+['t1701',1708,558,236,false],
+['t1702',475,1237,657,false],
+['t1703',1350,827,558,false],
+['t1704',710,827,1472,false],
+['t1705',710,1275,1581,false],
+['t1706',1626,558,1133,false],
+['t1707',1626,558,702,false],
+['t1708',821,1128,1353,false],
+['t1709',1086,558,1037,false],
+['t1710',1399,558,1105,false],
+['t1711',319,558,972,false],
+['t1712',936,558,425,false],
+['t1713',1325,657,1005,false],
+['t1714',1325,1005,657,false],
+['t1715',43,558,611,false],
+['t1716',245,558,1106,false],
+['t1717',710,50,1350,false],
+['t1718',600,36,558,false],
+['t1719',1721,558,1048,false],
+['t1720',710,1636,935,false],
+['t1721',1394,503,558,false],
+['t1722',1468,1630,280,false],
+['t1723',1468,1437,3,false],
+['t1724',1468,684,998,false],
+['t1725',1468,1242,1389,false],
+['t1726',1408,1004,558,false],
+['t1727',1662,553,558,false],
+['t1728',1468,721,1299,false],
+['t1729',862,1347,558,false],
+['t1730',107,558,376,false],
+['t1731',236,182,1151,false],
+['t1732',124,558,141,false],
+['t1733',710,1528,1215,false],
+['t1734',710,1161,109,false],
+['t1735',1401,626,1198,false],
+['t1736',529,558,391,false],
+['t1737',529,558,391,false],
+['t1738',529,558,391,false],
+['t1739',770,558,19,false],
+['t1740',943,1150,657,false],
+['t1741',943,182,265,false],
+['t1742',943,897,1211,false],
+['t1743',446,368,558,false],
+['t1744',1165,558,1354,false],
+['t1745',1214,558,879,false],
+['t1746',966,1635,558,false],
+['t1747',966,657,203,false],
+['t1748',559,770,558,false],
+['t1749',1596,1271,558,false],
+['t1750',1596,657,140,false],
+['t1751',943,657,1242,false],
+['t1752',943,1402,114,false],
+['t1753',710,1014,1116,false],
+['t1754',1600,1546,1495,false],
+['t1755',31,1044,558,false],
+['t1756',905,558,979,false],
+['t1757',1533,156,558,false],
+['t1758',373,657,175,false],
+['t1759',373,657,175,false],
+['t1760',1175,558,267,false],
+['t1761',943,1473,657,false],
+['t1762',597,882,558,false],
+['t1763',761,1056,558,false],
+['t1764',78,695,619,false],
+['t1765',78,558,1179,false],
+['t1766',943,674,745,false],
+['t1767',943,1130,512,false],
+['t1768',943,1102,1099,false],
+['t1769',1241,269,558,false],
+['t1770',353,558,298,false],
+['t1771',353,558,298,false],
+['t1772',353,558,23,false],
+['t1773',600,1279,558,false],
+['t1774',161,558,969,false],
+['t1775',161,657,801,false],
+['t1776',641,715,558,false],
+['t1777',641,1704,558,false],
+['t1778',1247,558,654,false],
+['t1779',804,558,604,false],
+['t1780',325,615,166,false],
+['t1781',1577,558,1042,false],
+['t1782',1043,558,414,false],
+['t1783',325,843,1001,false],
+['t1784',1218,1257,558,false],
+['t1785',894,1587,558,false],
+['t1786',1393,558,490,false],
+['t1787',344,1073,557,false],
+['t1788',826,657,230,false],
+['t1789',344,20,585,false],
+['t1790',344,558,1316,false],
+['t1791',943,73,934,false],
+['t1792',248,1465,558,false],
+['t1793',1501,1349,558,false],
+['t1794',1501,1349,558,false],
+['t1795',1501,558,1349,false],
+['t1796',1501,1349,558,false],
+['t1797',943,1049,160,false],
+['t1798',477,647,558,false],
+['t1799',1149,558,264,false],
+['t1800',1565,558,1218,false],
+['t1801',1565,558,1218,false],
+['t1802',710,248,1276,false],
+['t1803',943,1713,501,false],
+['t1804',971,1512,558,false],
+['t1805',971,258,558,false],
+['t1806',971,84,558,false],
+['t1807',971,788,558,false],
+['t1808',971,1057,558,false],
+['t1809',971,204,558,false],
+['t1810',971,1582,558,false],
+['t1811',971,1204,558,false],
+['t1812',971,712,558,false],
+['t1813',971,157,558,false],
+['t1814',971,1086,558,false],
+['t1815',971,487,558,false],
+['t1816',971,1239,558,false],
+['t1817',971,285,558,false],
+['t1818',971,1524,558,false],
+['t1819',971,273,558,false],
+['t1820',971,750,558,false],
+['t1821',971,932,558,false],
+['t1822',971,309,558,false],
+['t1823',971,219,558,false],
+['t1824',710,1360,1091,false],
+['t1825',84,558,1106,false],
+['t1826',1679,558,1262,false],
+['t1827',943,1438,504,false],
+['t1828',943,1228,1574,false],
+['t1829',843,558,1640,false],
+['t1830',943,119,702,false],
+['t1831',328,1006,558,false],
+['t1832',879,237,119,false],
+['t1833',879,724,310,false],
+['t1834',710,248,1272,false],
+['t1835',503,558,270,false],
+['t1836',833,1684,558,false],
+['t1837',0,558,256,false],
+['t1838',335,508,1303,false],
+['t1839',1669,1460,558,false],
+['t1840',704,681,452,false],
+['t1841',704,1691,558,false],
+['t1842',534,54,737,false],
+['t1843',534,1009,1234,false],
+['t1844',534,978,450,false],
+['t1845',534,1475,162,false],
+['t1846',534,1405,727,false],
+['t1847',534,263,858,false],
+['t1848',534,679,1136,false],
+['t1849',534,1494,1653,false],
+['t1850',251,558,1028,false],
+['t1851',251,353,558,false],
+['t1852',251,353,558,false],
+['t1853',251,558,353,false],
+['t1854',251,558,353,false],
+['t1855',1708,19,558,false],
+['t1856',1060,54,1108,false],
+['t1857',1060,1150,991,false],
+['t1858',1060,1473,1287,false],
+['t1859',1060,1188,1302,false],
+['t1860',1060,892,1405,false],
+['t1861',1060,1503,166,false],
+['t1862',1060,833,1336,false],
+['t1863',1060,1001,493,false],
+['t1864',943,1065,1124,false],
+['t1865',1571,1144,558,false],
+['t1866',1194,558,439,false],
+['t1867',848,558,1178,false],
+['t1868',943,824,398,false],
+['t1869',1465,728,558,false],
+['t1870',388,972,1372,false],
+['t1871',825,558,1250,false],
+['t1872',943,558,742,false],
+['t1873',616,558,454,false],
+['t1874',1419,558,774,false],
+['t1875',390,1258,558,false],
+['t1876',1418,1415,558,false],
+['t1877',1564,1147,1299,false],
+['t1878',620,558,922,false],
+['t1879',620,1115,558,false],
+['t1880',1295,558,1238,false],
+['t1881',1295,657,1060,false],
+['t1882',943,1209,663,false],
+['t1883',710,1181,69,false],
+['t1884',943,28,171,false],
+['t1885',1247,437,558,false],
+['t1886',1710,252,558,false],
+['t1887',799,1339,558,false],
+['t1888',643,558,650,false],
+['t1889',643,558,650,false],
+['t1890',643,558,650,false],
+['t1891',643,650,558,false],
+['t1892',643,650,558,false],
+['t1893',643,558,650,false],
+['t1894',643,558,650,false],
+['t1895',102,657,1156,false],
+['t1896',102,657,1156,false],
+['t1897',102,657,1156,false],
+['t1898',102,657,1156,false],
+['t1899',102,657,1156,false],
+['t1900',102,657,1156,false],
+['t1901',102,657,1156,false],
+['t1902',1314,558,592,false],
+['t1903',1314,1327,1617,false],
+['t1904',1083,302,558,false],
+['t1905',1083,1019,558,false],
+['t1906',1200,558,648,false],
+['t1907',1435,548,558,false],
+['t1908',1020,1277,558,false],
+['t1909',1436,1723,558,false],
+['t1910',1436,558,1614,false],
+['t1911',1184,1631,903,false],
+['t1912',943,1651,657,false],
+['t1913',372,1085,1172,false],
+['t1914',248,912,1290,false],
+['t1915',273,558,773,false],
+['t1916',964,558,17,false],
+['t1917',964,558,1536,false],
+['t1918',663,558,535,false],
+['t1919',470,1286,558,false],
+['t1920',127,135,558,false],
+['t1921',872,558,901,false],
+['t1922',1245,299,1723,false],
+['t1923',1152,1340,657,false],
+['t1924',1152,1340,657,false],
+['t1925',1152,657,1340,false],
+['t1926',1152,657,1340,false],
+['t1927',1152,1340,657,false],
+['t1928',1560,1081,558,false],
+['t1929',1609,1329,558,false],
+['t1930',1450,1499,558,false],
+['t1931',926,558,1712,false],
+['t1932',1170,661,566,false],
+['t1933',943,1326,1073,false],
+['t1934',466,558,7,false],
+['t1935',466,657,471,false],
+['t1936',1258,384,558,false],
+['t1937',193,22,558,false],
+['t1938',289,997,558,false],
+['t1939',943,1358,521,false],
+['t1940',318,558,1444,false],
+['t1941',1545,1443,657,false],
+['t1942',710,644,428,false],
+['t1943',1171,558,519,false],
+['t1944',1574,1089,558,false],
+['t1945',776,558,1219,false],
+['t1946',305,184,558,false],
+['t1947',1411,1079,558,false],
+['t1948',849,558,247,false],
+['t1949',862,1211,558,false],
+['t1950',94,558,1024,false],
+['t1951',933,558,877,false],
+['t1952',523,1657,1406,false],
+['t1953',523,875,1659,false],
+['t1954',523,558,743,false],
+['t1955',1646,558,513,false],
+['t1956',1230,708,558,false],
+['t1957',1230,657,549,false],
+['t1958',59,304,1398,false],
+['t1959',59,143,957,false],
+['t1960',947,558,1654,false],
+['t1961',377,558,232,false],
+['t1962',1468,413,332,false],
+['t1963',758,1622,558,false],
+['t1964',81,558,1190,false],
+['t1965',943,1300,1182,false],
+['t1966',270,922,1544,false],
+['t1967',270,1115,558,false],
+['t1968',1691,558,110,false],
+['t1969',1691,558,1023,false],
+['t1970',868,723,558,false],
+['t1971',746,794,558,false],
+['t1972',746,288,558,false],
+['t1973',546,1681,558,false],
+['t1974',43,1270,558,false],
+['t1975',1247,898,558,false],
+['t1976',119,558,1626,false],
+['t1977',500,1390,1197,false],
+['t1978',500,558,174,false],
+['t1979',188,690,558,false],
+['t1980',1303,782,1040,false],
+['t1981',1160,212,558,false],
+['t1982',449,558,819,false],
+['t1983',1302,457,558,false],
+['t1984',1033,558,1015,false],
+['t1985',414,1611,1299,false],
+['t1986',325,305,1188,false],
+['t1987',943,11,55,false],
+['t1988',1274,558,1069,false],
+['t1989',710,913,1274,false],
+['t1990',1311,558,604,false],
+['t1991',23,558,298,false],
+['t1992',23,657,1501,false],
+['t1993',968,1093,558,false],
+['t1994',943,1705,1020,false],
+['t1995',199,558,781,false],
+['t1996',199,558,1422,false],
+['t1997',334,558,118,false],
+['t1998',700,619,558,false],
+['t1999',157,558,1090,false],
+['t2000',1129,558,1467,false],
+['t2001',1633,657,736,false],
+['t2002',1633,657,736,false],
+['t2003',1633,657,736,false],
+['t2004',1633,657,736,false],
+['t2005',1633,657,736,false],
+['t2006',901,1556,558,false],
+['t2007',901,867,558,false],
+['t2008',647,1220,558,false],
+['t2009',1067,821,558,false],
+['t2010',943,541,1320,false],
+['t2011',710,1409,916,false],
+['t2012',666,558,862,false],
+['t2013',1323,283,558,false],
+['t2014',535,558,1206,false],
+['t2015',1185,1215,558,false],
+['t2016',201,1433,558,false],
+['t2017',493,1200,558,false],
+['t2018',493,558,744,false],
+['t2019',636,558,967,false],
+['t2020',855,268,657,false],
+['t2021',855,268,657,false],
+['t2022',855,268,657,false],
+['t2023',855,268,657,false],
+['t2024',855,268,657,false],
+['t2025',248,558,1343,false],
+['t2026',646,202,558,false],
+['t2027',943,558,881,false],
+['t2028',1056,1080,739,false],
+['t2029',943,1539,657,false],
+['t2030',878,631,558,false],
+['t2031',916,558,1185,false],
+['t2032',967,558,272,false],
+['t2033',943,80,1333,false],
+['t2034',1671,571,558,false],
+['t2035',1671,558,302,false],
+['t2036',1671,1019,558,false],
+['t2037',1671,558,1294,false],
+['t2038',1516,1306,558,false],
+['t2039',1516,558,1306,false],
+['t2040',1516,1306,558,false],
+['t2041',196,558,1468,false],
+['t2042',271,558,1058,false],
+['t2043',710,1039,24,false],
+['t2044',857,558,1649,false],
+['t2045',857,558,1377,false],
+['t2046',943,1101,190,false],
+['t2047',164,412,558,false],
+['t2048',943,993,20,false],
+['t2049',0,726,558,false],
+['t2050',1455,1412,558,false],
+['t2051',1346,558,1296,false],
+['t2052',1346,359,657,false],
+['t2053',1324,558,1455,false],
+['t2054',214,765,1001,false],
+['t2055',847,558,104,false],
+['t2056',1243,558,1455,false],
+['t2057',676,558,148,false],
+['t2058',676,148,558,false],
+['t2059',676,558,148,false],
+['t2060',676,148,558,false],
+['t2061',676,558,148,false],
+['t2062',676,558,148,false],
+['t2063',676,558,148,false],
+['t2064',748,558,1241,false],
+['t2065',1296,399,657,false],
+['t2066',785,558,267,false],
+['t2067',1028,353,657,false],
+['t2068',1159,558,450,false],
+['t2069',1431,1578,558,false],
+['t2070',238,1215,558,false],
+['t2071',969,801,558,false],
+['t2072',232,558,585,false],
+['t2073',232,1704,558,false],
+['t2074',232,558,1316,false],
+['t2075',943,1177,1069,false],
+['t2076',1429,1315,558,false],
+['t2077',1429,381,558,false],
+['t2078',943,1442,1045,false],
+['t2079',1481,558,1134,false],
+['t2080',943,728,357,false],
+['t2081',781,558,160,false],
+['t2082',1481,558,912,false],
+['t2083',943,1652,385,false],
+['t2084',558,1005,558,false],
+['t2085',646,470,558,false],
+['t2086',943,1194,99,false],
+['t2087',727,556,558,false],
+['t2088',932,368,558,false],
+['t2089',932,558,1352,false],
+['t2090',1121,291,558,false],
+['t2091',981,558,733,false],
+['t2092',943,107,66,false],
+['t2093',1143,475,657,false],
+['t2094',1143,558,1677,false],
+['t2095',1143,558,999,false],
+['t2096',943,957,394,false],
+['t2097',1285,1506,558,false],
+['t2098',1285,1510,1122,false],
+['t2099',1447,558,1175,false],
+['t2100',1327,808,558,false],
+['t2101',959,1154,558,false],
+['t2102',171,558,1493,false],
+['t2103',171,558,1493,false],
+['t2104',171,558,1493,false],
+['t2105',171,558,1493,false],
+['t2106',345,1475,1686,false],
+['t2107',345,558,1097,false],
+['t2108',1138,558,767,false],
+['t2109',710,1387,240,false],
+['t2110',815,558,1193,false],
+['t2111',1292,558,1065,false],
+['t2112',829,667,558,false],
+['t2113',98,1434,558,false],
+['t2114',1505,830,558,false],
+['t2115',757,1030,558,false],
+['t2116',710,1718,671,false],
+['t2117',192,1130,558,false],
+['t2118',1024,558,1069,false],
+['t2119',943,1231,1176,false],
+['t2120',1062,1429,558,false],
+['t2121',1171,558,358,false],
+['t2122',1222,558,1090,false],
+['t2123',382,558,1717,false],
+['t2124',1186,1216,54,false],
+['t2125',336,1459,482,false],
+['t2126',558,159,558,false],
+['t2127',1579,558,221,false],
+['t2128',1042,1119,892,false],
+['t2129',1591,374,558,false],
+['t2130',1042,439,1302,false],
+['t2131',1042,77,833,false],
+['t2132',507,279,558,false],
+['t2133',507,186,1082,false],
+['t2134',710,961,1266,false],
+['t2135',200,558,1486,false],
+['t2136',200,293,1367,false],
+['t2137',200,558,57,false],
+['t2138',353,1501,558,false],
+['t2139',353,1501,558,false],
+['t2140',943,952,1509,false],
+['t2141',222,97,558,false],
+['t2142',938,1245,558,false],
+['t2143',99,558,1644,false],
+['t2144',108,1666,558,false],
+['t2145',850,1446,558,false],
+['t2146',850,430,558,false],
+['t2147',943,1169,1216,false],
+['t2148',943,588,529,false],
+['t2149',943,483,657,false],
+['t2150',943,121,657,false],
+['t2151',67,558,14,false],
+['t2152',1032,558,297,false],
+['t2153',1534,558,763,false],
+['t2154',1534,1068,657,false],
+['t2155',69,1045,558,false],
+['t2156',36,1009,1322,false],
+['t2157',36,558,735,false],
+['t2158',417,657,539,false],
+['t2159',417,539,657,false],
+['t2160',417,539,657,false],
+['t2161',417,657,539,false],
+['t2162',417,657,539,false],
+['t2163',417,657,539,false],
+['t2164',417,539,657,false],
+['t2165',967,1211,558,false],
+['t2166',967,1211,558,false],
+['t2167',1286,1211,558,false],
+['t2168',690,558,1612,false],
+['t2169',690,558,804,false],
+['t2170',690,1311,558,false],
+['t2171',690,492,558,false],
+['t2172',690,1259,558,false],
+['t2173',690,558,354,false],
+['t2174',690,558,341,false],
+['t2175',690,558,461,false],
+['t2176',690,558,352,false],
+['t2177',690,558,1589,false],
+['t2178',690,1569,558,false],
+['t2179',690,281,558,false],
+['t2180',1399,657,710,false],
+['t2181',398,321,558,false],
+['t2182',43,692,558,false],
+['t2183',1293,620,558,false],
+['t2184',936,1122,558,false],
+['t2185',348,1194,558,false],
+['t2186',350,988,558,false],
+['t2187',743,558,875,false],
+['t2188',743,545,609,false],
+['t2189',743,558,1547,false],
+['t2190',890,558,1694,false],
+['t2191',140,1539,1001,false],
+['t2192',140,1336,13,false],
+['t2193',325,64,54,false],
+['t2194',140,407,54,false],
+['t2195',710,38,558,false],
+['t2196',710,558,1247,false],
+['t2197',1252,882,558,false],
+['t2198',140,1160,1405,false],
+['t2199',140,315,1188,false],
+['t2200',140,1651,1287,false],
+['t2201',761,233,970,false],
+['t2202',761,558,762,false],
+['t2203',1201,558,1372,false],
+['t2204',840,558,1293,false],
+['t2205',115,1439,558,false],
+['t2206',97,558,1072,false],
+['t2207',97,558,769,false],
+['t2208',755,558,1170,false],
+['t2209',834,657,102,false],
+['t2210',75,129,558,false],
+['t2211',142,1571,558,false],
+['t2212',142,427,165,false],
+['t2213',574,1628,957,false],
+['t2214',574,841,250,false],
+['t2215',574,681,740,false],
+['t2216',574,350,1071,false],
+['t2217',574,1063,296,false],
+['t2218',574,277,477,false],
+['t2219',574,336,722,false],
+['t2220',574,304,1318,false],
+['t2221',233,1205,569,false],
+['t2222',943,1282,657,false],
+['t2223',1191,657,887,false],
+['t2224',1191,657,887,false],
+['t2225',1191,657,887,false],
+['t2226',1191,657,887,false],
+['t2227',1499,558,709,false],
+['t2228',1499,657,1201,false],
+['t2229',1549,929,558,false],
+['t2230',943,414,558,false],
+['t2231',943,898,558,false],
+['t2232',31,558,132,false],
+['t2233',918,1583,558,false],
+['t2234',336,558,112,false],
+['t2235',756,1110,558,false],
+['t2236',1331,146,1108,false],
+['t2237',1331,929,991,false],
+['t2238',1331,1618,1473,false],
+['t2239',1331,1654,1302,false],
+['t2240',1331,892,1344,false],
+['t2241',1331,831,1503,false],
+['t2242',1331,326,833,false],
+['t2243',1331,1592,493,false],
+['t2244',369,540,558,false],
+['t2245',1345,1542,1685,false],
+['t2246',1345,1568,558,false],
+['t2247',1649,795,558,false],
+['t2248',710,1180,1533,false],
+['t2249',1403,558,983,false],
+['t2250',1268,558,580,false],
+['t2251',287,657,1545,false],
+['t2252',287,558,1034,false],
+['t2253',287,558,994,false],
+['t2254',219,558,347,false],
+['t2255',140,1150,52,false],
+['t2256',984,558,1332,false],
+['t2257',610,558,582,false],
+['t2258',801,1251,1001,false],
+['t2259',1139,937,558,false],
+['t2260',943,1500,526,false],
+['t2261',801,658,1405,false],
+['t2262',47,603,558,false],
+['t2263',801,518,1336,false],
+['t2264',801,733,166,false],
+['t2265',49,499,558,false],
+['t2266',579,558,824,false],
+['t2267',862,558,445,false],
+['t2268',729,558,1185,false],
+['t2269',710,738,1519,false],
+['t2270',1540,558,734,false],
+['t2271',943,1503,657,false],
+['t2272',50,558,629,false],
+['t2273',943,440,151,false],
+['t2274',660,1716,558,false],
+['t2275',660,1708,558,false],
+['t2276',594,558,256,false],
+['t2277',39,558,208,false],
+['t2278',558,558,1349,false],
+['t2279',943,927,26,false],
+['t2280',628,1335,558,false],
+['t2281',628,657,1698,false],
+['t2282',943,616,460,false],
+['t2283',895,558,1233,false],
+['t2284',895,558,76,false],
+['t2285',895,1658,558,false],
+['t2286',895,558,786,false],
+['t2287',895,558,1664,false],
+['t2288',895,558,1612,false],
+['t2289',895,558,784,false],
+['t2290',895,244,558,false],
+['t2291',895,1623,558,false],
+['t2292',895,558,764,false],
+['t2293',895,1311,558,false],
+['t2294',895,324,558,false],
+['t2295',895,857,558,false],
+['t2296',895,558,1337,false],
+['t2297',895,1355,558,false],
+['t2298',895,787,558,false],
+['t2299',895,558,575,false],
+['t2300',895,558,1381,false],
+['t2301',895,822,558,false],
+['t2302',895,131,558,false],
+['t2303',895,558,1086,false],
+['t2304',895,558,1074,false],
+['t2305',895,558,1246,false],
+['t2306',895,0,558,false],
+['t2307',895,558,594,false],
+['t2308',895,558,1052,false],
+['t2309',895,558,1589,false],
+['t2310',895,558,446,false],
+['t2311',895,309,558,false],
+['t2312',895,53,558,false],
+['t2313',895,1292,558,false],
+['t2314',895,558,1155,false],
+['t2315',895,558,1569,false],
+['t2316',895,558,301,false],
+['t2317',895,558,950,false],
+['t2318',895,558,1710,false],
+['t2319',895,1419,558,false],
+['t2320',681,558,716,false],
+['t2321',283,72,1503,false],
+['t2322',143,693,558,false],
+['t2323',143,1285,558,false],
+['t2324',1031,558,604,false],
+['t2325',943,1455,1505,false],
+['t2326',1566,1240,558,false],
+['t2327',1566,657,863,false],
+['t2328',710,1507,864,false],
+['t2329',1133,996,558,false],
+['t2330',1704,856,919,false],
+['t2331',1704,835,558,false],
+['t2332',581,838,558,false],
+['t2333',397,11,1563,false],
+['t2334',1557,134,558,false],
+['t2335',283,892,208,false],
+['t2336',862,1130,558,false],
+['t2337',943,657,315,false],
+['t2338',943,133,558,false],
+['t2339',943,161,558,false],
+['t2340',418,558,332,false],
+['t2341',943,740,276,false],
+['t2342',1466,558,1000,false],
+['t2343',1257,753,558,false],
+['t2344',1257,711,558,false],
+['t2345',1257,558,569,false],
+['t2346',24,440,558,false],
+['t2347',64,1025,558,false],
+['t2348',58,558,1107,false],
+['t2349',943,795,360,false],
+['t2350',739,679,1554,false],
+['t2351',739,558,479,false],
+['t2352',943,868,1631,false],
+['t2353',0,558,272,false],
+['t2354',298,657,1349,false],
+['t2355',298,657,1349,false],
+['t2356',298,657,1349,false],
+['t2357',298,657,1349,false],
+['t2358',659,558,195,false],
+['t2359',659,195,558,false],
+['t2360',659,195,558,false],
+['t2361',659,195,558,false],
+['t2362',659,558,195,false],
+['t2363',659,195,558,false],
+['t2364',1698,54,146,false],
+['t2365',1698,1150,929,false],
+['t2366',1698,1618,1287,false],
+['t2367',1698,1188,1654,false],
+['t2368',1698,1405,1344,false],
+['t2369',1698,166,831,false],
+['t2370',1698,326,1336,false],
+['t2371',1698,1592,1001,false],
+['t2372',1468,1282,694,false],
+['t2373',943,707,642,false],
+['t2374',780,1722,558,false],
+['t2375',379,558,1704,false],
+['t2376',1125,1512,558,false],
+['t2377',1125,558,382,false],
+['t2378',1125,1173,558,false],
+['t2379',1125,1543,558,false],
+['t2380',1125,76,558,false],
+['t2381',1125,245,558,false],
+['t2382',1125,786,558,false],
+['t2383',1125,1664,558,false],
+['t2384',1125,682,558,false],
+['t2385',1125,1482,558,false],
+['t2386',1125,552,558,false],
+['t2387',1125,1487,558,false],
+['t2388',1125,764,558,false],
+['t2389',1125,1057,558,false],
+['t2390',1125,58,558,false],
+['t2391',1125,1520,558,false],
+['t2392',1125,1381,558,false],
+['t2393',1125,257,558,false],
+['t2394',1125,1324,558,false],
+['t2395',1125,179,558,false],
+['t2396',1125,558,131,false],
+['t2397',1125,4,558,false],
+['t2398',1125,1396,558,false],
+['t2399',1125,167,558,false],
+['t2400',1125,354,558,false],
+['t2401',1125,1086,558,false],
+['t2402',1125,1074,558,false],
+['t2403',1125,558,273,false],
+['t2404',1125,594,558,false],
+['t2405',1125,677,558,false],
+['t2406',1125,447,558,false],
+['t2407',1125,1052,558,false],
+['t2408',1125,558,791,false],
+['t2409',1125,750,558,false],
+['t2410',1125,932,558,false],
+['t2411',1125,1589,558,false],
+['t2412',1125,309,558,false],
+['t2413',1125,1430,558,false],
+['t2414',1125,1292,558,false],
+['t2415',1125,1114,558,false],
+['t2416',1125,1226,558,false],
+['t2417',1125,1006,558,false],
+['t2418',1125,1164,558,false],
+['t2419',1125,950,558,false],
+['t2420',1125,281,558,false],
+['t2421',1125,1665,558,false],
+['t2422',1125,607,558,false],
+['t2423',1125,1419,558,false],
+['t2424',1125,1050,558,false],
+['t2425',1255,59,558,false],
+['t2426',781,1546,558,false],
+['t2427',781,558,1457,false],
+['t2428',897,558,1369,false],
+['t2429',46,1508,558,false],
+['t2430',530,558,1559,false],
+['t2431',530,558,1632,false],
+['t2432',434,558,510,false],
+['t2433',1247,414,558,false],
+['t2434',630,152,558,false],
+['t2435',701,558,1572,false],
+['t2436',701,558,193,false],
+['t2437',335,1352,558,false],
+['t2438',1696,558,1156,false],
+['t2439',1696,1156,558,false],
+['t2440',1696,1156,558,false],
+['t2441',1696,558,1156,false],
+['t2442',1696,1156,558,false],
+['t2443',229,407,558,false],
+['t2444',192,506,558,false],
+['t2445',517,925,558,false],
+['t2446',934,139,558,false],
+['t2447',943,1064,1711,false],
+['t2448',1545,657,1443,false],
+['t2449',754,648,1181,false],
+['t2450',754,1595,558,false],
+['t2451',48,292,52,false],
+['t2452',710,590,1178,false],
+['t2453',1128,558,775,false],
+['t2454',48,1670,407,false],
+['t2455',713,617,558,false],
+['t2456',713,676,558,false],
+['t2457',943,751,1192,false],
+['t2458',489,657,1639,false],
+['t2459',489,558,1153,false],
+['t2460',489,659,558,false],
+['t2461',1018,558,100,false],
+['t2462',1220,1469,558,false],
+['t2463',231,558,778,false],
+['t2464',1430,558,368,false],
+['t2465',877,911,558,false],
+['t2466',877,911,558,false],
+['t2467',300,558,847,false],
+['t2468',133,558,602,false],
+['t2469',133,657,1263,false],
+['t2470',709,1201,558,false],
+['t2471',1216,987,558,false],
+['t2472',318,558,1293,false],
+['t2473',1393,558,1075,false],
+['t2474',1704,558,1007,false],
+['t2475',236,176,558,false],
+['t2476',741,1551,652,false],
+['t2477',741,205,1206,false],
+['t2478',741,948,27,false],
+['t2479',741,49,1301,false],
+['t2480',741,502,1496,false],
+['t2481',741,584,141,false],
+['t2482',741,1670,1722,false],
+['t2483',741,292,209,false],
+['t2484',943,515,1411,false],
+['t2485',665,616,558,false],
+['t2486',203,558,315,false],
+['t2487',203,558,1651,false],
+['t2488',203,558,483,false],
+['t2489',203,558,1160,false],
+['t2490',1228,550,558,false],
+['t2491',203,558,1539,false],
+['t2492',203,558,13,false],
+['t2493',360,1230,558,false],
+['t2494',204,1118,558,false],
+['t2495',1289,632,1058,false],
+['t2496',197,558,198,false],
+['t2497',197,558,198,false],
+['t2498',888,558,1092,false],
+['t2499',879,1675,74,false],
+['t2500',879,1609,1378,false],
+['t2501',270,1692,1082,false],
+['t2502',407,1668,558,false],
+['t2503',487,558,824,false],
+['t2504',1068,1432,583,false],
+['t2505',1068,96,1621,false],
+['t2506',182,1619,558,false],
+['t2507',943,126,1486,false],
+['t2508',788,152,558,false],
+['t2509',974,558,1492,false],
+['t2510',1357,378,558,false],
+['t2511',1161,732,558,false],
+['t2512',1302,558,1621,false],
+['t2513',646,558,182,false],
+['t2514',607,558,347,false],
+['t2515',710,1267,1298,false],
+['t2516',1613,558,42,false],
+['t2517',1613,657,643,false],
+['t2518',901,558,1682,false],
+['t2519',901,558,1362,false],
+['t2520',943,940,378,false],
+['t2521',248,558,187,false],
+['t2522',248,558,1718,false],
+['t2523',1623,558,837,false],
+['t2524',747,1163,657,false],
+['t2525',358,558,1715,false],
+['t2526',438,1437,208,false],
+['t2527',438,72,1630,false],
+['t2528',438,121,1458,false],
+['t2529',438,1647,1299,false],
+['t2530',438,413,488,false],
+['t2531',438,976,1282,false],
+['t2532',438,1242,481,false],
+['t2533',438,723,684,false],
+['t2534',854,975,558,false],
+['t2535',1345,558,1500,false],
+['t2536',943,635,289,false],
+['t2537',1404,558,133,false],
+['t2538',1193,558,1242,false],
+['t2539',833,558,1416,false],
+['t2540',1276,930,558,false],
+['t2541',1276,930,558,false],
+['t2542',1400,558,83,false],
+['t2543',1509,611,558,false],
+['t2544',684,558,1507,false],
+['t2545',839,43,657,false],
+['t2546',943,484,536,false],
+['t2547',43,6,558,false],
+['t2548',1235,1539,1206,false],
+['t2549',1235,13,652,false],
+['t2550',1235,483,1301,false],
+['t2551',1235,1160,27,false],
+['t2552',1235,315,141,false],
+['t2553',1235,1651,1496,false],
+['t2554',1235,52,209,false],
+['t2555',1235,407,1722,false],
+['t2556',1440,605,779,false],
+['t2557',1201,558,700,false],
+['t2558',943,1062,381,false],
+['t2559',710,1129,558,false],
+['t2560',1642,558,1352,false],
+['t2561',1041,211,657,false],
+['t2562',1041,657,211,false],
+['t2563',1041,657,211,false],
+['t2564',1041,657,211,false],
+['t2565',1041,211,657,false],
+['t2566',178,1254,558,false],
+['t2567',178,1195,558,false],
+['t2568',178,657,1191,false],
+['t2569',389,300,558,false],
+['t2570',1541,558,491,false],
+['t2571',1541,437,657,false],
+['t2572',943,558,431,false],
+['t2573',1639,657,195,false],
+['t2574',475,1237,657,false],
+['t2575',353,558,1072,false],
+['t2576',353,558,1072,false],
+['t2577',1008,1189,558,false],
+['t2578',1008,558,1511,false],
+['t2579',410,344,814,false],
+['t2580',410,557,558,false],
+['t2581',308,558,375,false],
+['t2582',308,558,65,false],
+['t2583',943,706,678,false],
+['t2584',561,558,533,false],
+['t2585',410,558,474,false],
+['t2586',1423,558,1608,false],
+['t2587',1423,869,657,false],
+['t2588',710,168,836,false],
+['t2589',1297,1392,558,false],
+['t2590',943,1699,1024,false],
+['t2591',364,558,1232,false],
+['t2592',710,468,18,false],
+['t2593',59,404,296,false],
+['t2594',389,1649,558,false],
+['t2595',1487,558,1464,false],
+['t2596',59,1632,277,false],
+['t2597',18,558,378,false],
+['t2598',1570,1480,379,false],
+['t2599',943,833,657,false],
+['t2600',440,1681,905,false],
+['t2601',943,213,576,false],
+['t2602',943,862,537,false],
+['t2603',710,789,158,false],
+['t2604',1166,1685,558,false],
+['t2605',1166,1568,558,false],
+['t2606',1660,558,855,false],
+['t2607',1660,1100,657,false],
+['t2608',1134,558,1712,false],
+['t2609',1050,1006,558,false],
+['t2610',779,656,1594,false],
+['t2611',297,558,1032,false],
+['t2612',556,558,1344,false],
+['t2613',1689,558,1196,false],
+['t2614',1315,558,826,false],
+['t2615',1265,1202,558,false],
+['t2616',1265,1334,558,false],
+['t2617',943,733,615,false],
+['t2618',1639,657,195,false],
+['t2619',158,63,558,false],
+['t2620',1373,558,1703,false],
+['t2621',1373,558,395,false],
+['t2622',1153,558,1639,false],
+['t2623',1153,659,657,false],
+['t2624',314,761,558,false],
+['t2625',781,558,1550,false],
+['t2626',943,967,1269,false],
+['t2627',1459,558,1390,false],
+['t2628',1459,558,174,false],
+['t2629',1396,558,11,false],
+['t2630',943,199,327,false],
+['t2631',943,252,338,false],
+['t2632',710,187,1579,false],
+['t2633',710,627,566,false],
+['t2634',1247,1186,558,false],
+['t2635',943,306,581,false],
+['t2636',1157,1564,558,false],
+['t2637',562,558,1374,false],
+['t2638',1266,1453,558,false],
+['t2639',1639,195,657,false],
+['t2640',1473,744,558,false],
+['t2641',893,558,314,false],
+['t2642',1473,558,1573,false],
+['t2643',625,662,558,false],
+['t2644',625,657,1186,false],
+['t2645',646,558,1172,false],
+['t2646',1284,558,464,false],
+['t2647',1284,558,464,false],
+['t2648',1284,558,464,false],
+['t2649',1122,558,505,false],
+['t2650',1122,558,433,false],
+['t2651',609,558,1213,false],
+['t2652',97,1325,657,false],
+['t2653',604,558,385,false],
+['t2654',1145,522,558,false],
+['t2655',737,558,5,false],
+['t2656',1512,558,1717,false],
+['t2657',943,554,17,false],
+['t2658',940,558,1615,false],
+['t2659',359,399,558,false],
+['t2660',359,399,558,false],
+['t2661',359,558,399,false],
+['t2662',359,399,558,false],
+['t2663',359,558,399,false],
+['t2664',359,399,558,false],
+['t2665',359,399,558,false],
+['t2666',790,191,558,false],
+['t2667',1204,1107,558,false],
+['t2668',1591,558,1638,false],
+['t2669',821,768,836,false],
+['t2670',206,558,465,false],
+['t2671',528,558,368,false],
+['t2672',1167,316,558,false],
+['t2673',1167,558,143,false],
+['t2674',217,696,558,false],
+['t2675',234,210,558,false],
+['t2676',234,172,558,false],
+['t2677',234,1633,657,false],
+['t2678',419,1618,558,false],
+['t2679',710,43,558,false],
+['t2680',710,558,1247,false],
+['t2681',710,1247,558,false],
+['t2682',162,558,947,false],
+['t2683',991,558,243,false],
+['t2684',859,1535,493,false],
+['t2685',859,235,833,false],
+['t2686',1576,60,558,false],
+['t2687',1576,84,558,false],
+['t2688',1576,271,558,false],
+['t2689',1576,370,558,false],
+['t2690',1576,1612,558,false],
+['t2691',1576,784,558,false],
+['t2692',1576,204,558,false],
+['t2693',1576,804,558,false],
+['t2694',1576,1311,558,false],
+['t2695',1576,1428,558,false],
+['t2696',1576,492,558,false],
+['t2697',1576,1204,558,false],
+['t2698',1576,1259,558,false],
+['t2699',1576,342,558,false],
+['t2700',1576,857,558,false],
+['t2701',1576,712,558,false],
+['t2702',1576,776,558,false],
+['t2703',1576,1168,558,false],
+['t2704',1576,1721,558,false],
+['t2705',1576,487,558,false],
+['t2706',1576,579,558,false],
+['t2707',1576,1239,558,false],
+['t2708',1576,285,558,false],
+['t2709',1576,1524,558,false],
+['t2710',1576,0,558,false],
+['t2711',1576,1478,558,false],
+['t2712',1576,1210,558,false],
+['t2713',1576,461,558,false],
+['t2714',1576,660,558,false],
+['t2715',1576,1557,558,false],
+['t2716',1576,259,558,false],
+['t2717',1576,352,558,false],
+['t2718',1576,446,558,false],
+['t2719',1576,528,558,false],
+['t2720',1576,904,558,false],
+['t2721',1576,1569,558,false],
+['t2722',1576,1710,558,false],
+['t2723',1576,219,558,false],
+['t2724',1576,1385,558,false],
+['t2725',710,1147,391,false],
+['t2726',859,1432,991,false],
+['t2727',859,96,1302,false],
+['t2728',859,1473,704,false],
+['t2729',859,1678,1503,false],
+['t2730',859,1645,892,false],
+['t2731',558,806,558,false],
+['t2732',943,589,578,false],
+['t2733',682,1586,558,false],
+['t2734',943,768,994,false],
+['t2735',1316,1386,426,false],
+['t2736',1316,914,558,false],
+['t2737',943,657,413,false],
+['t2738',943,1229,780,false],
+['t2739',1441,41,558,false],
+['t2740',1535,1318,1695,false],
+['t2741',1535,558,1398,false],
+['t2742',1316,558,20,false],
+['t2743',853,558,387,false],
+['t2744',519,670,558,false],
+['t2745',519,558,670,false],
+['t2746',283,723,1302,false],
+['t2747',283,976,991,false],
+['t2748',283,493,1647,false],
+['t2749',698,558,1481,false],
+['t2750',846,1371,558,false],
+['t2751',1201,333,558,false],
+['t2752',21,228,558,false],
+['t2753',21,657,48,false],
+['t2754',943,1530,1110,false],
+['t2755',1123,765,558,false],
+['t2756',1607,661,558,false],
+['t2757',1652,1178,558,false],
+['t2758',943,1121,1225,false],
+['t2759',1247,549,558,false],
+['t2760',655,783,558,false],
+['t2761',540,227,558,false],
+['t2762',602,1263,558,false],
+['t2763',710,1661,464,false],
+['t2764',611,255,558,false],
+['t2765',611,741,657,false],
+['t2766',248,917,558,false],
+['t2767',954,558,513,false],
+['t2768',1026,558,322,false],
+['t2769',1026,171,657,false],
+['t2770',1051,455,1082,false],
+['t2771',1200,626,1249,false],
+['t2772',943,456,191,false],
+['t2773',822,558,1455,false],
+['t2774',404,918,558,false],
+['t2775',404,142,558,false],
+['t2776',943,558,1331,false],
+['t2777',943,558,1698,false],
+['t2778',842,558,1479,false],
+['t2779',842,657,66,false],
+['t2780',713,657,1140,false],
+['t2781',1409,1231,558,false],
+['t2782',1228,11,558,false],
+['t2783',166,1135,558,false],
+['t2784',1522,1695,558,false],
+['t2785',1522,558,1398,false],
+['t2786',943,364,86,false],
+['t2787',70,1117,558,false],
+['t2788',1211,10,558,false],
+['t2789',637,558,1308,false],
+['t2790',1608,349,657,false],
+['t2791',1599,807,431,false],
+['t2792',1335,558,1698,false],
+['t2793',1665,252,558,false],
+['t2794',1247,558,1263,false],
+['t2795',1314,1308,1489,false],
+['t2796',1314,637,558,false],
+['t2797',596,558,819,false],
+['t2798',565,558,658,false],
+['t2799',1068,1678,1383,false],
+['t2800',1068,235,351,false],
+['t2801',1068,1535,423,false],
+['t2802',1605,1294,558,false],
+['t2803',927,1112,558,false],
+['t2804',958,1449,558,false],
+['t2805',943,871,777,false],
+['t2806',919,1229,835,false],
+['t2807',919,1486,1538,false],
+['t2808',919,558,200,false],
+['t2809',1211,1655,558,false],
+['t2810',1077,558,809,false],
+['t2811',1077,558,1410,false],
+['t2812',710,705,1668,false],
+['t2813',273,1211,558,false],
+['t2814',1492,558,1445,false],
+['t2815',1492,558,1457,false],
+['t2816',266,558,525,false],
+['t2817',1357,558,188,false],
+['t2818',710,246,123,false],
+['t2819',1415,7,657,false],
+['t2820',217,558,413,false],
+['t2821',440,558,813,false],
+['t2822',335,558,1280,false],
+['t2823',1234,1549,558,false],
+['t2824',302,851,558,false],
+['t2825',710,1650,94,false],
+['t2826',943,1602,506,false],
+['t2827',770,558,853,false],
+['t2828',249,163,558,false],
+['t2829',249,1704,558,false],
+['t2830',1,890,558,false],
+['t2831',1329,558,1601,false],
+['t2832',1329,558,382,false],
+['t2833',1329,558,1173,false],
+['t2834',1329,558,1233,false],
+['t2835',1329,558,1543,false],
+['t2836',1329,558,76,false],
+['t2837',1329,558,1540,false],
+['t2838',1329,245,558,false],
+['t2839',1329,558,786,false],
+['t2840',1329,558,1482,false],
+['t2841',1329,558,370,false],
+['t2842',1329,558,552,false],
+['t2843',1329,558,784,false],
+['t2844',1329,558,1623,false],
+['t2845',1329,558,403,false],
+['t2846',1329,1311,558,false],
+['t2847',1329,558,1355,false],
+['t2848',1329,558,257,false],
+['t2849',1329,558,179,false],
+['t2850',1329,558,1086,false],
+['t2851',1329,558,487,false],
+['t2852',1329,558,145,false],
+['t2853',1329,558,1478,false],
+['t2854',1329,1557,558,false],
+['t2855',1329,558,517,false],
+['t2856',1329,558,352,false],
+['t2857',1329,558,750,false],
+['t2858',1329,558,932,false],
+['t2859',1329,558,309,false],
+['t2860',1329,558,1569,false],
+['t2861',1329,558,301,false],
+['t2862',199,558,941,false],
+['t2863',256,25,558,false],
+['t2864',943,633,1059,false],
+['t2865',943,1575,40,false],
+['t2866',61,1554,558,false],
+['t2867',61,558,479,false],
+['t2868',85,485,558,false],
+['t2869',479,679,558,false],
+['t2870',873,1088,558,false],
+['t2871',259,558,134,false],
+['t2872',823,444,558,false],
+['t2873',840,1433,558,false],
+['t2874',1315,657,381,false],
+['t2875',83,949,523,false],
+['t2876',83,558,1406,false],
+['t2877',1220,570,558,false],
+['t2878',943,799,264,false],
+['t2879',943,1693,264,false],
+['t2880',992,46,558,false],
+['t2881',301,558,252,false],
+['t2882',745,558,241,false],
+['t2883',771,558,1446,false],
+['t2884',771,430,465,false],
+['t2885',1184,474,766,false],
+['t2886',1184,558,410,false],
+['t2887',1077,1671,558,false],
+['t2888',1077,558,1460,false],
+['t2889',838,811,558,false],
+['t2890',1112,558,26,false],
+['t2891',113,558,209,false],
+['t2892',710,187,759,false],
+['t2893',1108,1687,558,false],
+['t2894',943,558,1035,false],
+['t2895',541,558,1328,false],
+['t2896',129,872,1150,false],
+['t2897',1283,587,558,false],
+['t2898',129,401,54,false],
+['t2899',902,558,1109,false],
+['t2900',902,558,1109,false],
+['t2901',902,558,1289,false],
+['t2902',830,1047,558,false],
+['t2903',830,534,657,false],
+['t2904',1643,558,766,false],
+['t2905',1643,1704,558,false],
+['t2906',1643,558,410,false],
+['t2907',1077,558,1587,false],
+['t2908',1077,558,540,false],
+['t2909',1044,1408,1000,false],
+['t2910',943,1379,215,false],
+['t2911',986,1279,345,false],
+['t2912',247,1722,1108,false],
+['t2913',247,991,209,false],
+['t2914',247,1473,1496,false],
+['t2915',247,141,1302,false],
+['t2916',247,27,892,false],
+['t2917',247,1301,1503,false],
+['t2918',247,833,652,false],
+['t2919',247,493,1206,false],
+['t2920',943,1128,869,false],
+['t2921',1674,772,558,false],
+['t2922',909,446,558,false],
+['t2923',909,528,558,false],
+['t2924',909,0,558,false],
+['t2925',909,1210,558,false],
+['t2926',909,1385,558,false],
+['t2927',909,370,558,false],
+['t2928',909,784,558,false],
+['t2929',909,776,558,false],
+['t2930',909,1168,558,false],
+['t2931',943,104,1221,false],
+['t2932',943,558,1186,false],
+['t2933',943,1263,558,false],
+['t2934',943,558,325,false],
+['t2935',943,558,801,false],
+['t2936',710,47,420,false],
+['t2937',937,558,1706,false],
+['t2938',937,558,1704,false],
+['t2939',937,558,1345,false],
+['t2940',1132,717,558,false],
+['t2941',710,666,1380,false],
+['t2942',1382,334,558,false],
+['t2943',617,676,657,false],
+['t2944',710,1474,527,false],
+['t2945',630,1705,558,false],
+['t2946',1518,898,558,false],
+['t2947',996,1710,558,false],
+['t2948',996,558,1601,false],
+['t2949',996,558,382,false],
+['t2950',996,558,1173,false],
+['t2951',996,1233,558,false],
+['t2952',996,1658,558,false],
+['t2953',996,1664,558,false],
+['t2954',996,1482,558,false],
+['t2955',996,665,558,false],
+['t2956',996,558,286,false],
+['t2957',996,558,271,false],
+['t2958',996,558,370,false],
+['t2959',996,552,558,false],
+['t2960',996,1612,558,false],
+['t2961',996,1487,558,false],
+['t2962',996,784,558,false],
+['t2963',996,764,558,false],
+['t2964',996,558,1582,false],
+['t2965',996,558,1031,false],
+['t2966',996,558,804,false],
+['t2967',996,1311,558,false],
+['t2968',996,1520,558,false],
+['t2969',996,857,558,false],
+['t2970',996,712,558,false],
+['t2971',996,1337,558,false],
+['t2972',996,558,1381,false],
+['t2973',996,558,776,false],
+['t2974',996,558,157,false],
+['t2975',996,257,558,false],
+['t2976',996,131,558,false],
+['t2977',996,4,558,false],
+['t2978',996,303,558,false],
+['t2979',996,1721,558,false],
+['t2980',996,558,1086,false],
+['t2981',996,558,487,false],
+['t2982',996,558,579,false],
+['t2983',996,1239,558,false],
+['t2984',996,0,558,false],
+['t2985',996,1478,558,false],
+['t2986',996,594,558,false],
+['t2987',996,660,558,false],
+['t2988',996,558,1557,false],
+['t2989',996,558,259,false],
+['t2990',996,558,1052,false],
+['t2991',996,791,558,false],
+['t2992',996,352,558,false],
+['t2993',996,750,558,false],
+['t2994',996,932,558,false],
+['t2995',996,1589,558,false],
+['t2996',996,558,446,false],
+['t2997',996,558,528,false],
+['t2998',996,558,309,false],
+['t2999',996,1430,558,false],
+['t3000',996,1292,558,false],
+['t3001',996,1646,558,false],
+['t3002',996,1114,558,false],
+['t3003',996,1476,558,false],
+['t3004',996,558,1226,false],
+['t3005',996,558,1569,false],
+['t3006',996,558,950,false],
+['t3007',996,1050,558,false],
+['t3008',996,1419,558,false],
+['t3009',996,1164,558,false],
+['t3010',312,995,558,false],
+['t3011',312,854,742,false],
+['t3012',988,1425,558,false],
+['t3013',710,1291,1382,false],
+['t3014',717,558,926,false],
+['t3015',717,558,1087,false],
+['t3016',1034,558,1545,false],
+['t3017',1034,994,657,false],
+['t3018',1690,558,1410,false],
+['t3019',1302,558,744,false],
+['t3020',40,1558,558,false],
+['t3021',40,558,12,false],
+['t3022',1282,558,1016,false],
+['t3023',393,551,558,false],
+['t3024',943,596,1085,false],
+['t3025',943,1175,685,false],
+['t3026',1291,1312,558,false],
+['t3027',592,1013,532,false],
+['t3028',592,558,1217,false],
+['t3029',1021,1510,558,false],
+['t3030',809,365,558,false],
+['t3031',90,558,77,false],
+['t3032',852,1454,558,false],
+['t3033',852,260,558,false],
+['t3034',324,1107,1555,false],
+['t3035',769,558,1325,false],
+['t3036',769,657,1072,false],
+['t3037',900,558,1643,false],
+['t3038',147,1393,1393,false],
+['t3039',147,1393,558,false],
+['t3040',147,1393,558,false],
+['t3041',147,558,1393,false],
+['t3042',147,558,1393,false],
+['t3043',147,558,1393,false],
+['t3044',147,558,1393,false],
+['t3045',147,558,1393,false],
+['t3046',147,558,1393,false],
+['t3047',1473,1376,558,false],
+['t3048',365,558,125,false],
+['t3049',537,363,558,false],
+['t3050',993,731,558,false],
+['t3051',753,263,1203,false],
+['t3052',753,558,1629,false],
+['t3053',926,827,558,false],
+['t3054',943,632,339,false],
+['t3055',1364,558,108,false],
+['t3056',1364,657,1666,false],
+['t3057',425,558,953,false],
+['t3058',1467,943,558,false],
+['t3059',1467,943,558,false],
+['t3060',1467,943,558,false],
+['t3061',1467,558,943,false],
+['t3062',56,558,720,false],
+['t3063',260,558,1494,false],
+['t3064',735,1009,558,false],
+['t3065',1242,935,558,false],
+['t3066',5,558,146,false],
+['t3067',1462,438,558,false],
+['t3068',1115,1544,558,false],
+['t3069',1394,558,1658,false],
+['t3070',1394,558,985,false],
+['t3071',1394,558,1664,false],
+['t3072',1394,558,682,false],
+['t3073',1394,558,665,false],
+['t3074',1394,558,286,false],
+['t3075',1394,558,271,false],
+['t3076',1394,558,1612,false],
+['t3077',1394,558,1487,false],
+['t3078',1394,558,244,false],
+['t3079',1394,558,1520,false],
+['t3080',1394,558,324,false],
+['t3081',1394,558,712,false],
+['t3082',1394,558,787,false],
+['t3083',1394,558,575,false],
+['t3084',1394,558,1466,false],
+['t3085',1394,558,776,false],
+['t3086',1394,558,822,false],
+['t3087',1394,558,131,false],
+['t3088',1394,558,1420,false],
+['t3089',1394,558,4,false],
+['t3090',1394,558,167,false],
+['t3091',1394,558,303,false],
+['t3092',1394,558,1504,false],
+['t3093',1394,558,579,false],
+['t3094',1394,558,0,false],
+['t3095',1394,558,259,false],
+['t3096',1394,558,528,false],
+['t3097',1394,558,1430,false],
+['t3098',1394,558,1646,false],
+['t3099',1394,558,1155,false],
+['t3100',1394,558,1476,false],
+['t3101',1394,558,1226,false],
+['t3102',1394,558,1164,false],
+['t3103',1438,1497,558,false],
+['t3104',1254,887,558,false],
+['t3105',1254,558,887,false],
+['t3106',1254,558,887,false],
+['t3107',1254,558,887,false],
+['t3108',540,302,558,false],
+['t3109',540,558,365,false],
+['t3110',540,1294,558,false],
+['t3111',236,558,506,false],
+['t3112',1580,1656,558,false],
+['t3113',1580,1159,558,false],
+['t3114',1573,845,1550,false],
+['t3115',430,959,558,false],
+['t3116',1263,578,166,false],
+['t3117',1263,1724,1336,false],
+['t3118',1256,558,574,false],
+['t3119',1263,1694,1287,false],
+['t3120',1263,242,1188,false],
+['t3121',1263,436,1405,false],
+['t3122',224,558,520,false],
+['t3123',224,657,37,false],
+['t3124',1719,558,831,false],
+['t3125',1144,558,570,false],
+['t3126',1329,1394,558,false],
+['t3127',248,558,879,false],
+['t3128',1599,558,538,false],
+['t3129',1296,657,399,false],
+['t3130',103,558,1599,false],
+['t3131',943,1391,1577,false],
+['t3132',531,558,1255,false],
+['t3133',531,657,59,false],
+['t3134',63,657,298,false],
+['t3135',943,668,999,false],
+['t3136',821,1298,907,false],
+['t3137',943,1106,1404,false],
+['t3138',498,558,240,false],
+['t3139',498,558,240,false],
+['t3140',498,558,240,false],
+['t3141',1612,558,1464,false],
+['t3142',712,558,1649,false],
+['t3143',801,767,1150,false],
+['t3144',1432,841,189,false],
+['t3145',1432,558,155,false],
+['t3146',662,1186,558,false],
+['t3147',469,558,33,false],
+['t3148',1232,86,558,false],
+['t3149',1232,558,1676,false],
+['t3150',1232,634,657,false],
+['t3151',1434,558,1709,false],
+['t3152',752,558,1389,false],
+['t3153',681,558,216,false],
+['t3154',130,639,558,false],
+['t3155',275,104,558,false],
+['t3156',1019,1515,851,false],
+['t3157',1019,231,558,false],
+['t3158',731,1458,558,false],
+['t3159',248,558,1120,false],
+['t3160',248,1039,2,false],
+['t3161',342,558,300,false],
+['t3162',1398,117,558,false],
+['t3163',1398,558,1241,false],
+['t3164',617,558,1140,false],
+['t3165',1527,1295,558,false],
+['t3166',125,1515,558,false],
+['t3167',1625,558,90,false],
+['t3168',1476,1379,558,false],
+['t3169',1697,275,558,false],
+['t3170',1168,558,595,false],
+['t3171',143,623,558,false],
+['t3172',782,1347,558,false],
+['t3173',366,934,558,false],
+['t3174',898,622,72,false],
+['t3175',898,900,208,false],
+['t3176',898,1611,1647,false],
+['t3177',898,377,1458,false],
+['t3178',898,1022,976,false],
+['t3179',898,1139,488,false],
+['t3180',898,1359,723,false],
+['t3181',898,655,481,false],
+['t3182',140,483,166,false],
+['t3183',1468,618,121,false],
+['t3184',483,558,254,false],
+['t3185',336,558,1038,false],
+['t3186',1542,515,1158,false],
+['t3187',1542,558,1253,false],
+['t3188',1247,984,558,false],
+['t3189',576,558,870,false],
+['t3190',576,558,870,false],
+['t3191',576,558,870,false],
+['t3192',1253,558,515,false],
+['t3193',934,558,160,false],
+['t3194',837,1689,558,false],
+['t3195',590,558,910,false],
+['t3196',1700,332,54,false],
+['t3197',493,558,423,false],
+['t3198',943,974,774,false],
+['t3199',943,934,968,false],
+['t3200',943,1196,415,false],
+['t3201',943,680,1688,false],
+['t3202',1528,106,558,false],
+['t3203',303,558,669,false],
+['t3204',437,121,235,false],
+['t3205',437,1299,1535,false],
+['t3206',1608,349,657,false],
+['t3207',437,1282,1432,false],
+['t3208',437,1437,1645,false],
+['t3209',437,1678,1630,false],
+['t3210',943,1126,1465,false],
+['t3211',437,684,96,false],
+['t3212',943,19,899,false],
+['t3213',725,558,1179,false],
+['t3214',930,1286,558,false],
+['t3215',1005,558,718,false],
+['t3216',558,1591,558,false],
+['t3217',943,1618,978,false],
+['t3218',945,558,111,false],
+['t3219',943,304,1123,false],
+['t3220',650,896,558,false],
+['t3221',1002,1211,558,false],
+['t3222',1416,1470,299,false],
+['t3223',952,152,558,false],
+['t3224',862,558,272,false],
+['t3225',258,1717,1351,false],
+['t3226',1263,1709,1150,false],
+['t3227',669,1228,558,false],
+['t3228',558,1393,558,false],
+['t3229',943,1374,1252,false],
+['t3230',1627,1483,558,false],
+['t3231',1627,558,1084,false],
+['t3232',936,1707,558,false],
+['t3233',936,388,558,false],
+['t3234',943,727,1344,false],
+['t3235',502,558,1265,false],
+['t3236',1640,558,1251,false],
+['t3237',865,558,420,false],
+['t3238',1032,645,558,false],
+['t3239',1384,60,558,false],
+['t3240',1384,1512,558,false],
+['t3241',1384,382,558,false],
+['t3242',1384,1173,558,false],
+['t3243',1384,84,558,false],
+['t3244',1384,1543,558,false],
+['t3245',1384,76,558,false],
+['t3246',1384,245,558,false],
+['t3247',1384,786,558,false],
+['t3248',1384,1664,558,false],
+['t3249',1384,682,558,false],
+['t3250',1384,1482,558,false],
+['t3251',1384,271,558,false],
+['t3252',1384,370,558,false],
+['t3253',1384,552,558,false],
+['t3254',1384,1612,558,false],
+['t3255',1384,1487,558,false],
+['t3256',1384,784,558,false],
+['t3257',1384,1582,558,false],
+['t3258',1384,804,558,false],
+['t3259',1384,1311,558,false],
+['t3260',1384,1428,558,false],
+['t3261',1384,492,558,false],
+['t3262',1384,1204,558,false],
+['t3263',1384,1520,558,false],
+['t3264',1384,1259,558,false],
+['t3265',1384,342,558,false],
+['t3266',1384,857,558,false],
+['t3267',1384,712,558,false],
+['t3268',1384,776,558,false],
+['t3269',1384,157,558,false],
+['t3270',1384,257,558,false],
+['t3271',1384,1324,558,false],
+['t3272',1384,179,558,false],
+['t3273',1384,131,558,false],
+['t3274',1384,4,558,false],
+['t3275',1384,1396,558,false],
+['t3276',1384,167,558,false],
+['t3277',1384,1168,558,false],
+['t3278',1384,1721,558,false],
+['t3279',1384,1086,558,false],
+['t3280',1384,1074,558,false],
+['t3281',1384,487,558,false],
+['t3282',1384,579,558,false],
+['t3283',1384,1239,558,false],
+['t3284',1384,1524,558,false],
+['t3285',1384,0,558,false],
+['t3286',1384,1478,558,false],
+['t3287',1384,1210,558,false],
+['t3288',1384,461,558,false],
+['t3289',1384,660,558,false],
+['t3290',1384,1557,558,false],
+['t3291',1384,259,558,false],
+['t3292',1384,791,558,false],
+['t3293',1384,352,558,false],
+['t3294',1384,750,558,false],
+['t3295',1384,932,558,false],
+['t3296',1384,446,558,false],
+['t3297',1384,528,558,false],
+['t3298',1384,1430,558,false],
+['t3299',1384,1292,558,false],
+['t3300',1384,1114,558,false],
+['t3301',1384,1226,558,false],
+['t3302',1384,1569,558,false],
+['t3303',1384,1665,558,false],
+['t3304',1384,1050,558,false],
+['t3305',1384,1419,558,false],
+['t3306',1384,1385,558,false],
+['t3307',1384,1164,558,false],
+['t3308',1384,1006,558,false],
+['t3309',943,1712,45,false],
+['t3310',1561,558,871,false],
+['t3311',1210,726,558,false],
+['t3312',1210,558,256,false],
+['t3313',1463,558,1076,false],
+['t3314',1463,657,147,false],
+['t3315',183,558,1711,false],
+['t3316',257,558,1455,false],
+['t3317',943,64,564,false],
+['t3318',943,659,429,false],
+['t3319',1213,1209,558,false],
+['t3320',228,558,48,false],
+['t3321',1224,558,186,false],
+['t3322',495,558,1414,false],
+['t3323',1277,558,1441,false],
+['t3324',1277,657,41,false],
+['t3325',248,558,781,false],
+['t3326',248,558,781,false],
+['t3327',134,930,558,false],
+['t3328',134,467,558,false],
+['t3329',943,449,67,false],
+['t3330',811,1080,558,false],
+['t3331',811,1205,100,false],
+['t3332',943,991,657,false],
+['t3333',809,558,1641,false],
+['t3334',609,1192,1547,false],
+['t3335',609,1209,1264,false],
+['t3336',1412,558,384,false],
+['t3337',1349,62,558,false],
+['t3338',710,1338,720,false],
+['t3339',1464,558,1109,false],
+['t3340',710,227,703,false],
+['t3341',943,166,657,false],
+['t3342',943,548,181,false],
+['t3343',710,1095,1306,false],
+['t3344',710,558,43,false],
+['t3345',710,558,839,false],
+['t3346',1049,558,507,false],
+['t3347',338,558,954,false],
+['t3348',549,1001,1522,false],
+['t3349',615,981,558,false],
+['t3350',598,1260,558,false],
+['t3351',310,558,328,false],
+['t3352',1539,494,558,false],
+['t3353',943,13,657,false],
+['t3354',943,657,1299,false],
+['t3355',180,501,558,false],
+['t3356',1102,976,558,false],
+['t3357',1048,239,192,false],
+['t3358',184,558,1531,false],
+['t3359',943,1199,1485,false],
+['t3360',943,824,56,false],
+['t3361',943,886,558,false],
+['t3362',639,524,1307,false],
+['t3363',639,577,28,false],
+['t3364',639,738,364,false],
+['t3365',639,463,1513,false],
+['t3366',1630,1094,558,false],
+['t3367',264,558,1712,false],
+['t3368',461,261,558,false],
+['t3369',461,726,558,false],
+['t3370',879,380,1077,false],
+['t3371',1713,238,558,false],
+['t3372',1628,623,1354,false],
+['t3373',907,558,713,false],
+['t3374',414,1022,1282,false],
+['t3375',414,413,1139,false],
+['t3376',414,1359,684,false],
+['t3377',414,1242,655,false],
+['t3378',414,622,1630,false],
+['t3379',414,1437,900,false],
+['t3380',414,121,377,false],
+['t3381',248,558,1185,false],
+['t3382',1108,558,744,false],
+['t3383',1271,140,558,false],
+['t3384',159,558,312,false],
+['t3385',129,1637,1287,false],
+['t3386',499,558,1659,false],
+['t3387',499,558,743,false],
+['t3388',950,252,558,false],
+['t3389',1029,558,618,false],
+['t3390',943,1341,695,false],
+['t3391',475,1237,657,false],
+['t3392',874,1435,1001,false],
+['t3393',642,1340,558,false],
+['t3394',642,1340,558,false],
+['t3395',642,1340,558,false],
+['t3396',642,1340,558,false],
+['t3397',1002,152,558,false],
+['t3398',572,558,1407,false],
+['t3399',943,1078,334,false],
+['t3400',1479,451,657,false],
+['t3401',1479,451,657,false],
+['t3402',1479,451,657,false],
+['t3403',1479,657,451,false],
+['t3404',1479,451,657,false],
+['t3405',1648,558,1521,false],
+['t3406',323,14,558,false],
+['t3407',355,558,593,false],
+['t3408',355,657,1700,false],
+['t3409',392,814,558,false],
+['t3410',392,557,558,false],
+['t3411',794,82,558,false],
+['t3412',794,82,558,false],
+['t3413',794,558,82,false],
+['t3414',794,558,82,false],
+['t3415',794,82,558,false],
+['t3416',794,82,558,false],
+['t3417',794,82,558,false],
+['t3418',943,1155,1436,false],
+['t3419',943,696,610,false],
+['t3420',1146,811,558,false],
+['t3421',248,1440,558,false],
+['t3422',841,558,936,false],
+['t3423',63,1501,558,false],
+['t3424',63,23,558,false],
+['t3425',1247,801,558,false],
+['t3426',43,1230,558,false],
+['t3427',122,570,558,false],
+['t3428',649,1313,558,false],
+['t3429',649,640,558,false],
+['t3430',1332,452,558,false],
+['t3431',1332,1691,558,false],
+['t3432',934,1196,558,false],
+['t3433',943,558,1585,false],
+['t3434',1270,558,1518,false],
+['t3435',1270,898,657,false],
+['t3436',1188,432,558,false],
+['t3437',1188,432,558,false],
+['t3438',906,558,714,false],
+['t3439',906,558,214,false],
+['t3440',1017,558,578,false],
+['t3441',1338,462,558,false],
+['t3442',1382,1350,558,false],
+['t3443',7,657,1591,false],
+['t3444',7,657,1591,false],
+['t3445',7,657,1591,false],
+['t3446',680,558,1526,false],
+['t3447',943,629,760,false],
+['t3448',967,558,1427,false],
+['t3449',1001,852,558,false],
+['t3450',1001,852,558,false],
+['t3451',138,211,558,false],
+['t3452',138,211,558,false],
+['t3453',138,211,558,false],
+['t3454',138,211,558,false],
+['t3455',943,1649,1027,false],
+['t3456',926,558,187,false],
+['t3457',638,1118,604,false],
+['t3458',1358,396,558,false],
+['t3459',634,657,435,false],
+['t3460',634,657,435,false],
+['t3461',634,657,435,false],
+['t3462',634,657,435,false],
+['t3463',634,435,657,false],
+['t3464',1542,1099,1568,false],
+['t3465',1253,1184,1498,false],
+['t3466',1253,903,558,false],
+['t3467',827,558,1471,false],
+['t3468',386,392,558,false],
+['t3469',386,1704,558,false],
+['t3470',943,700,1565,false],
+['t3471',329,1166,558,false],
+['t3472',329,1704,558,false],
+['t3473',492,1107,558,false],
+['t3474',1072,1005,558,false],
+['t3475',1072,558,1005,false],
+['t3476',1072,1005,558,false],
+['t3477',1072,558,1005,false],
+['t3478',1072,1005,558,false],
+['t3479',1072,558,1005,false],
+['t3480',1072,1005,558,false],
+['t3481',1072,558,1005,false],
+['t3482',1571,486,547,false],
+['t3483',1571,817,558,false],
+['t3484',826,230,657,false],
+['t3485',218,558,1716,false],
+['t3486',943,1594,688,false],
+['t3487',1395,558,67,false],
+['t3488',1395,67,558,false],
+['t3489',215,941,1111,false],
+['t3490',59,155,250,false],
+['t3491',1504,558,669,false],
+['t3492',6,558,282,false],
+['t3493',6,874,657,false],
+['t3494',145,1280,1037,false],
+['t3495',43,35,558,false],
+['t3496',991,558,583,false],
+['t3497',448,730,558,false],
+['t3498',678,558,1567,false],
+['t3499',943,361,1319,false],
+['t3500',943,758,93,false],
+['t3501',951,1152,558,false],
+['t3502',951,642,657,false],
+['t3503',943,1287,657,false],
+['t3504',943,1190,752,false],
+['t3505',943,892,657,false],
+['t3506',1258,1130,558,false],
+['t3507',1619,558,586,false],
+['t3508',923,356,558,false],
+['t3509',923,1334,558,false],
+['t3510',923,810,558,false],
+]
@@ -0,0 +1,287 @@
+/*
+ * Runtime netlist loader, see netlist_load.h
+ *
+ * The files are JavaScript array and object literals, e.g.:
+ *
+ *	segdefs.js:	[ 4,'+',1,5391,8260,5391,8216,...],
+ *	transdefs.js:	['t1',1646,13,663,[560,721,2656,2730,1],[...],false],
+ *	nodenames.js:	vss: 1,
+ *
+ * Only the node numbers, the pullup flag of the segments, and the
+ * gate/c1/c2 of the transistors are used, the geometry is skipped.
+ * netlist_sim doesn't model weak transistors, so a transistor with
+ * the trailing weak flag set to true is rejected.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "types.h"
+#include "netlist_load.h"
+
+/************************************************************
+ *
+ * Parsing Helpers
+ *
+ ************************************************************/
+
+static char *
+readFile(const char *dir, const char *name)
+{
+	char path[1024];
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+	FILE *fp = fopen(path, "rb");
+	if (!fp) {
+		fprintf(stderr, "netlist: failed to open '%s'\n", path);
+		return NULL;
+	}
+	fseek(fp, 0, SEEK_END);
+	long size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	char *buf = malloc((size_t)size + 1);
+	if (fread(buf, 1, (size_t)size, fp) != (size_t)size) {
+		fprintf(stderr, "netlist: failed to read '%s'\n", path);
+		free(buf);
+		fclose(fp);
+		return NULL;
+	}
+	buf[size] = 0;
+	fclose(fp);
+	return buf;
+}
+
+static const char *
+skipSpace(const char *p)
+{
+	while (*p && isspace((unsigned char)*p))
+		p++;
+	return p;
+}
+
+/* parse a non-negative number followed by a comma, returns NULL on mismatch */
+static const char *
+parseNumber(const char *p, int *value)
+{
+	p = skipSpace(p);
+	if (!isdigit((unsigned char)*p))
+		return NULL;
+	char *end;
+	*value = (int)strtol(p, &end, 10);
+	p = skipSpace(end);
+	return (*p == ',') ? p + 1 : NULL;
+}
+
+/* skip a quoted string, returns NULL if p doesn't point to one */
+static const char *
+skipString(const char *p, char *first_char)
+{
+	p = skipSpace(p);
+	if ((*p != '\'') && (*p != '"'))
+		return NULL;
+	char quote = *p++;
+	*first_char = *p;
+	while (*p && (*p != quote))
+		p++;
+	return *p ? p + 1 : NULL;
+}
+
+static void
+growNodes(netlist_t *netlist, int node)
+{
+	if (node >= netlist->nodes) {
+		netlist->node_is_pullup = realloc(netlist->node_is_pullup, (node + 1) * sizeof(BOOL));
+		for (int i = netlist->nodes; i <= node; i++)
+			netlist->node_is_pullup[i] = NO;
+		netlist->nodes = node + 1;
+	}
+}
+
+/************************************************************
+ *
+ * File Parsers
+ *
+ ************************************************************/
+
+/* [ node,'+',layer,x,y,... ] */
+static BOOL
+parseSegdefs(netlist_t *netlist, const char *src)
+{
+	for (const char *p = strchr(src, '['); p; p = strchr(p + 1, '[')) {
+		int node;
+		char pullup;
+		const char *q = parseNumber(p + 1, &node);
+		if (!q || !(q = skipString(q, &pullup)))
+			continue;
+		if (node >= 0xFFFF) {
+			fprintf(stderr, "netlist: node number %d too big\n", node);
+			return NO;
+		}
+		growNodes(netlist, node);
+		if (pullup == '+')
+			netlist->node_is_pullup[node] = YES;
+	}
+	return netlist->nodes > 0;
+}
+
+/* [ 'name',gate,c1,c2,[geometry],...,weak ] */
+static BOOL
+parseTransdefs(netlist_t *netlist, const char *src)
+{
+	int capacity = 0;
+	int count = 0;
+	for (const char *p = strchr(src, '['); p; p = strchr(p + 1, '[')) {
+		char first;
+		int gate, c1, c2;
+		const char *q = skipString(p + 1, &first);
+		if (!q)
+			continue;
+		q = skipSpace(q);
+		if ((*q != ',') || !(q = parseNumber(q + 1, &gate)) || !(q = parseNumber(q, &c1)) || !(q = parseNumber(q, &c2)))
+			continue;
+		/* skip the geometry to the end of the entry, the last value is the weak flag */
+		const char *weak = q;
+		for (int depth = 1; *q && (depth > 0); q++) {
+			if (*q == '[')
+				depth++;
+			else if (*q == ']')
+				depth--;
+			else if ((*q == ',') && (depth == 1))
+				weak = q + 1;
+		}
+		if (0 == strncmp(skipSpace(weak), "true", 4)) {
+			fprintf(stderr, "netlist: transistor %d is weak, weak transistors aren't supported\n", count + 1);
+			return NO;
+		}
+		p = q - 1;
+		if ((gate >= 0xFFFF) || (c1 >= 0xFFFF) || (c2 >= 0xFFFF) || (count == 0xFFFF)) {
+			fprintf(stderr, "netlist: too many nodes or transistors\n");
+			return NO;
+		}
+		if (count == capacity) {
+			capacity = capacity ? capacity * 2 : 1024;
+			netlist->transdefs = realloc(netlist->transdefs, capacity * sizeof(netlist_transdefs));
+		}
+		netlist->transdefs[count].gate = gate;
+		netlist->transdefs[count].c1 = c1;
+		netlist->transdefs[count].c2 = c2;
+		count++;
+		growNodes(netlist, gate);
+		growNodes(netlist, c1);
+		growNodes(netlist, c2);
+	}
+	netlist->transistors = (nodenum_t)count;
+	return count > 0;
+}
+
+/* name: node, */
+static BOOL
+parseNodenames(netlist_t *netlist, const char *src)
+{
+	int capacity = 0;
+	const char *p = strchr(src, '{');
+	p = p ? p + 1 : src;
+	while (*p) {
+		p = skipSpace(p);
+		if ((p[0] == '/') && (p[1] == '/')) {
+			/* skip comment line */
+			while (*p && (*p != '\n'))
+				p++;
+			continue;
+		}
+		if ((*p == '\'') || (*p == '"'))
+			p++;
+		const char *name = p;
+		while (isalnum((unsigned char)*p) || (*p == '_') || (*p == '#'))
+			p++;
+		size_t len = (size_t)(p - name);
+		if ((*p == '\'') || (*p == '"'))
+			p++;
+		p = skipSpace(p);
+		int node;
+		if ((len > 0) && (*p == ':') && isdigit((unsigned char)*skipSpace(p + 1))) {
+			node = (int)strtol(skipSpace(p + 1), (char **)&p, 10);
+			if (node >= 0xFFFF) {
+				fprintf(stderr, "netlist: node number %d too big\n", node);
+				return NO;
+			}
+			if (netlist->num_names == capacity) {
+				capacity = capacity ? capacity * 2 : 256;
+				netlist->names = realloc(netlist->names, capacity * sizeof(char *));
+				netlist->name_nodes = realloc(netlist->name_nodes, capacity * sizeof(nodenum_t));
+			}
+			char *str = malloc(len + 1);
+			memcpy(str, name, len);
+			str[len] = 0;
+			netlist->names[netlist->num_names] = str;
+			netlist->name_nodes[netlist->num_names] = (nodenum_t)node;
+			netlist->num_names++;
+			growNodes(netlist, node);
+		}
+		/* continue after the next separator */
+		while (*p && (*p != ',') && (*p != '\n'))
+			p++;
+		if (*p)
+			p++;
+	}
+	return netlist->num_names > 0;
+}
+
+/************************************************************
+ *
+ * Interface
+ *
+ ************************************************************/
+
+netlist_t *
+loadNetlist(const char *dir)
+{
+	netlist_t *netlist = calloc(1, sizeof(netlist_t));
+	static const char *files[3] = { "segdefs.js", "transdefs.js", "nodenames.js" };
+	for (int i = 0; i < 3; i++) {
+		char *src = readFile(dir, files[i]);
+		if (!src) {
+			destroyNetlist(netlist);
+			return NULL;
+		}
+		BOOL ok;
+		switch (i) {
+			case 0: ok = parseSegdefs(netlist, src); break;
+			case 1: ok = parseTransdefs(netlist, src); break;
+			default: ok = parseNodenames(netlist, src); break;
+		}
+		free(src);
+		if (!ok) {
+			fprintf(stderr, "netlist: no valid data in '%s/%s'\n", dir, files[i]);
+			destroyNetlist(netlist);
+			return NULL;
+		}
+	}
+	if ((findNode(netlist, "vss") < 0) || (findNode(netlist, "vcc") < 0)) {
+		fprintf(stderr, "netlist: vss or vcc node not found in '%s/nodenames.js'\n", dir);
+		destroyNetlist(netlist);
+		return NULL;
+	}
+	return netlist;
+}
+
+void
+destroyNetlist(netlist_t *netlist)
+{
+	for (int i = 0; i < netlist->num_names; i++)
+		free(netlist->names[i]);
+	free(netlist->names);
+	free(netlist->name_nodes);
+	free(netlist->node_is_pullup);
+	free(netlist->transdefs);
+	free(netlist);
+}
+
+int
+findNode(netlist_t *netlist, const char *name)
+{
+	for (int i = 0; i < netlist->num_names; i++)
+		if (0 == strcmp(netlist->names[i], name))
+			return netlist->name_nodes[i];
+	return -1;
+}
@@ -0,0 +1,30 @@
+/*
+ * Load a netlist at runtime from the files of the visual6502.org
+ * JavaScript simulations (segdefs.js, transdefs.js and nodenames.js),
+ * e.g. the 6502 netlist in netlist-6502/ used by perfect6502.c
+ *
+ * Usage:
+ *
+ *	netlist_t *nl = loadNetlist("path/to/chip-z80");
+ *	void *state = setupNodesAndTransistors(nl->transdefs, nl->node_is_pullup,
+ *		nl->nodes, nl->transistors, findNode(nl, "vss"), findNode(nl, "vcc"));
+ *	...
+ *	destroyNodesAndTransistors(state);
+ *	destroyNetlist(nl);
+ */
+
+typedef struct {
+	nodenum_t nodes;
+	nodenum_t transistors;
+	BOOL *node_is_pullup;
+	netlist_transdefs *transdefs;
+	int num_names;
+	char **names;
+	nodenum_t *name_nodes;
+} netlist_t;
+
+/* returns NULL and prints the reason on error */
+netlist_t *loadNetlist(const char *dir);
+void destroyNetlist(netlist_t *netlist);
+/* returns -1 if there's no node with that name */
+int findNode(netlist_t *netlist, const char *name);
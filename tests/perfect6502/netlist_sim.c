@@ -42,7 +42,7 @@ typedef uint16_t count_t;
  *
  ************************************************************/
 
-#if 0 /* faster on 64 bit CPUs */
+#if defined(_WIN64) || defined(__LP64__) || defined(__x86_64__) || defined(__aarch64__) /* faster on 64 bit CPUs */
 typedef unsigned long long bitmap_t;
 #define BITMAP_SHIFT 6
 #define BITMAP_MASK 63
@@ -70,14 +70,23 @@ typedef struct {
 	bitmap_t *nodes_pullup;
 	bitmap_t *nodes_pulldown;
 	bitmap_t *nodes_value;
-	nodenum_t **nodes_gates;
-	nodenum_t **nodes_c1c2s;
 	count_t *nodes_gatecount;
 	count_t *nodes_c1c2count;
 	nodenum_t *nodes_dependants;
 	nodenum_t *nodes_left_dependants;
-	nodenum_t **nodes_dependant;
-	nodenum_t **nodes_left_dependant;
+
+	/*
+	 * the per-node lists are packed back to back into flat arrays,
+	 * the list of node n starts at index nodes_gates_start[n] etc.
+	 */
+	unsigned int *nodes_gates_start;
+	transnum_t *nodes_gates;
+	unsigned int *nodes_c1c2s_start;
+	transnum_t *nodes_c1c2s;
+	nodenum_t *nodes_c1c2s_other;	/* node on the other side of the transistor in nodes_c1c2s */
+	unsigned int *nodes_dependant_start;
+	nodenum_t *nodes_dependant;
+	nodenum_t *nodes_left_dependant;	/* shares the nodes_gates_start offsets */
 
 	/* everything that describes a transistor */
 	nodenum_t *transistors_gate;
@@ -107,6 +116,22 @@ typedef struct {
 		contains_vcc,
 		contains_vss
 	} group_contains_value;
+
+	/*
+	 * group cache: each flood gets a new stamp, the nodes remember the
+	 * node the flood started from and the stamp, and the start node
+	 * remembers the stamp of its latest flood; a toggled transistor or
+	 * a changed pullup invalidates the stamp of the affected groups
+	 */
+	nodenum_t *nodes_group_start;
+	unsigned int *nodes_group_stamp;
+	unsigned int *group_stamp;
+	unsigned int stamp;
+
+	netlist_stats_t stats;
+
+	/* owned by the chip-specific code, e.g. the memory attached to the bus */
+	void *user_data;
 } state_t;
 
 /************************************************************
@@ -127,12 +152,6 @@ typedef struct {
 
 #define WORDS_FOR_BITS(a) (a / (sizeof(bitmap_t) * 8) + 1)
 
-static inline void
-bitmap_clear(bitmap_t *bitmap, count_t count)
-{
-	memset(bitmap, 0, WORDS_FOR_BITS(count)*sizeof(bitmap_t));
-}
-
 static inline void
 set_bitmap(bitmap_t *bitmap, int index, BOOL state)
 {
@@ -142,6 +161,17 @@ set_bitmap(bitmap_t *bitmap, int index, BOOL state)
 		bitmap[index>>BITMAP_SHIFT] &= ~(ONE << (index & BITMAP_MASK));
 }
 
+/*
+ * only clear the bits of the listed indices, this is much cheaper
+ * than clearing the whole bitmap, since lists are usually short
+ */
+static inline void
+bitmap_clear_list(bitmap_t *bitmap, const nodenum_t *list, count_t count)
+{
+	for (count_t i = 0; i < count; i++)
+		bitmap[list[i]>>BITMAP_SHIFT] &= ~(ONE << (list[i] & BITMAP_MASK));
+}
+
 static inline BOOL
 get_bitmap(bitmap_t *bitmap, int index)
 {
@@ -239,11 +269,23 @@ lists_switch(state_t *state)
 	state->listout = tmp;
 }
 
+/*
+ * the bitmap tracks the nodes added to the output list, after
+ * lists_switch() these are the nodes in the input list
+ */
 static inline void
 listout_clear(state_t *state)
 {
+	bitmap_clear_list(state->listout_bitmap, state->listin.list, state->listin.count);
+	state->listout.count = 0;
+}
+
+/* drop all collected nodes, without switching lists */
+static inline void
+listout_discard(state_t *state)
+{
+	bitmap_clear_list(state->listout_bitmap, state->listout.list, state->listout.count);
 	state->listout.count = 0;
-	bitmap_clear(state->listout_bitmap, state->nodes);
 }
 
 static inline void
@@ -272,8 +314,8 @@ listout_add(state_t *state, nodenum_t i)
 static inline void
 group_clear(state_t *state)
 {
+	bitmap_clear_list(state->groupbitmap, state->group, state->groupcount);
 	state->groupcount = 0;
-	bitmap_clear(state->groupbitmap, state->nodes);
 }
 
 static inline void
@@ -307,6 +349,20 @@ group_count(state_t *state)
  *
  ************************************************************/
 
+static inline void
+invalidateGroupOf(state_t *state, nodenum_t n)
+{
+	state->group_stamp[state->nodes_group_start[n]] = 0;
+}
+
+/* the group of the node is unchanged since it was last flooded */
+static inline BOOL
+isGroupCached(state_t *state, nodenum_t n)
+{
+	unsigned int stamp = state->nodes_group_stamp[n];
+	return stamp && (state->group_stamp[state->nodes_group_start[n]] == stamp);
+}
+
 static inline void
 addNodeToGroup(state_t *state, nodenum_t n)
 {
@@ -339,19 +395,6 @@ addNodeToGroup(state_t *state, nodenum_t n)
 	if (state->group_contains_value < contains_hi && get_nodes_value(state, n)) {
 		state->group_contains_value = contains_hi;
 	}
-
-	/* revisit all transistors that control this node */
-	for (count_t t = 0; t < state->nodes_c1c2count[n]; t++) {
-		transnum_t tn = state->nodes_c1c2s[n][t];
-		/* if the transistor connects c1 and c2... */
-		if (get_transistors_on(state, tn)) {
-			/* if original node was connected to c1, continue with c2 */
-			if (state->transistors_c1[tn] == n)
-				addNodeToGroup(state, state->transistors_c2[tn]);
-			else
-				addNodeToGroup(state, state->transistors_c1[tn]);
-		}
-	}
 }
 
 static inline void
@@ -361,7 +404,35 @@ addAllNodesToGroup(state_t *state, nodenum_t node)
 
 	state->group_contains_value = contains_nothing;
 
+	if (++state->stamp == 0) {
+		/* wrapped around, forget all cached groups */
+		memset(state->nodes_group_stamp, 0, state->nodes * sizeof(*state->nodes_group_stamp));
+		memset(state->group_stamp, 0, state->nodes * sizeof(*state->group_stamp));
+		state->stamp = 1;
+	}
+
+	/*
+	 * flood through all turned-on transistors, the group array
+	 * doubles as the work queue, so no recursion is needed
+	 */
 	addNodeToGroup(state, node);
+	for (count_t i = 0; i < group_count(state); i++) {
+		nodenum_t n = group_get(state, i);
+		state->nodes_group_start[n] = node;
+		state->nodes_group_stamp[n] = state->stamp;
+
+		/* revisit all transistors that control this node */
+		const unsigned int start = state->nodes_c1c2s_start[n];
+		for (count_t t = 0; t < state->nodes_c1c2count[n]; t++) {
+			transnum_t tn = state->nodes_c1c2s[start + t];
+			/* if the transistor connects c1 and c2, continue with the other side */
+			if (get_transistors_on(state, tn))
+				addNodeToGroup(state, state->nodes_c1c2s_other[start + t]);
+		}
+	}
+	state->group_stamp[node] = state->stamp;
+	state->stats.nodes_visited += group_count(state);
+	state->stats.groups_rebuilt++;
 }
 
 static inline BOOL
@@ -402,18 +473,23 @@ recalcNode(state_t *state, nodenum_t node)
 		nodenum_t nn = group_get(state, i);
 		if (get_nodes_value(state, nn) != newv) {
 			set_nodes_value(state, nn, newv);
+			const unsigned int start = state->nodes_gates_start[nn];
 			for (count_t t = 0; t < state->nodes_gatecount[nn]; t++) {
-				transnum_t tn = state->nodes_gates[nn][t];
+				transnum_t tn = state->nodes_gates[start + t];
 				set_transistors_on(state, tn, newv);
+				/* this connects or separates the groups on both sides */
+				invalidateGroupOf(state, state->transistors_c1[tn]);
+				invalidateGroupOf(state, state->transistors_c2[tn]);
 			}
 
 			if (newv) {
 				for (count_t g = 0; g < state->nodes_left_dependants[nn]; g++) {
-					listout_add(state, state->nodes_left_dependant[nn][g]);
+					listout_add(state, state->nodes_left_dependant[start + g]);
 				}
 			} else {
+				const unsigned int dstart = state->nodes_dependant_start[nn];
 				for (count_t g = 0; g < state->nodes_dependants[nn]; g++) {
-					listout_add(state, state->nodes_dependant[nn][g]);
+					listout_add(state, state->nodes_dependant[dstart + g]);
 				}
 			}
 		}
@@ -443,12 +519,22 @@ recalcNodeList(state_t *state)
 		 * all transistors controlled by this path, collecting
 		 * all nodes that changed because of it for the next run
 		 */
+		state->stats.iterations++;
 		for (count_t i = 0; i < listin_count(state); i++) {
 			nodenum_t n = listin_get(state, i);
+			/*
+			 * nothing changed in the group since it was last flooded
+			 * (e.g. from another node in the list), so recalculating
+			 * it would result in the same value
+			 */
+			if (isGroupCached(state, n)) {
+				state->stats.groups_cached++;
+				continue;
+			}
 			recalcNode(state, n);
 		}
 	}
-	listout_clear(state);
+	listout_discard(state);
 }
 
 /************************************************************
@@ -460,21 +546,23 @@ recalcNodeList(state_t *state)
 static inline void
 add_nodes_dependant(state_t *state, nodenum_t a, nodenum_t b)
 {
+	nodenum_t *list = &state->nodes_dependant[state->nodes_dependant_start[a]];
 	for (count_t g = 0; g < state->nodes_dependants[a]; g++)
-	if (state->nodes_dependant[a][g] == b)
+	if (list[g] == b)
 	return;
 
-	state->nodes_dependant[a][state->nodes_dependants[a]++] = b;
+	list[state->nodes_dependants[a]++] = b;
 }
 
 static inline void
 add_nodes_left_dependant(state_t *state, nodenum_t a, nodenum_t b)
 {
+	nodenum_t *list = &state->nodes_left_dependant[state->nodes_gates_start[a]];
 	for (count_t g = 0; g < state->nodes_left_dependants[a]; g++)
-	if (state->nodes_left_dependant[a][g] == b)
+	if (list[g] == b)
 	return;
 
-	state->nodes_left_dependant[a][state->nodes_left_dependants[a]++] = b;
+	list[state->nodes_left_dependants[a]++] = b;
 }
 
 state_t *
@@ -486,29 +574,19 @@ setupNodesAndTransistors(netlist_transdefs *transdefs, BOOL *node_is_pullup, nod
 	state->transistors = transistors;
 	state->vss = vss;
 	state->vcc = vcc;
+	state->user_data = NULL;
+	state->stamp = 0;
+	memset(&state->stats, 0, sizeof(state->stats));
 	state->nodes_pullup = calloc(WORDS_FOR_BITS(state->nodes), sizeof(*state->nodes_pullup));
 	state->nodes_pulldown = calloc(WORDS_FOR_BITS(state->nodes), sizeof(*state->nodes_pulldown));
 	state->nodes_value = calloc(WORDS_FOR_BITS(state->nodes), sizeof(*state->nodes_value));
-	state->nodes_gates = malloc(state->nodes * sizeof(*state->nodes_gates));
-	for (count_t i = 0; i < state->nodes; i++) {
-		state->nodes_gates[i] = calloc(state->nodes, sizeof(**state->nodes_gates));
-	}
-	state->nodes_c1c2s = malloc(state->nodes * sizeof(*state->nodes_c1c2s));
-	for (count_t i = 0; i < state->nodes; i++) {
-		state->nodes_c1c2s[i] = calloc(2 * state->nodes, sizeof(**state->nodes_c1c2s));
-	}
 	state->nodes_gatecount = calloc(state->nodes, sizeof(*state->nodes_gatecount));
 	state->nodes_c1c2count = calloc(state->nodes, sizeof(*state->nodes_c1c2count));
 	state->nodes_dependants = calloc(state->nodes, sizeof(*state->nodes_dependants));
 	state->nodes_left_dependants = calloc(state->nodes, sizeof(*state->nodes_left_dependants));
-	state->nodes_dependant = malloc(state->nodes * sizeof(*state->nodes_dependant));
-	for (count_t i = 0; i < state->nodes; i++) {
-		state->nodes_dependant[i] = calloc(state->nodes, sizeof(**state->nodes_dependant));
-	}
-	state->nodes_left_dependant = malloc(state->nodes * sizeof(*state->nodes_left_dependant));
-	for (count_t i = 0; i < state->nodes; i++) {
-		state->nodes_left_dependant[i] = calloc(state->nodes, sizeof(**state->nodes_left_dependant));
-	}
+	state->nodes_gates_start = calloc(state->nodes + 1, sizeof(*state->nodes_gates_start));
+	state->nodes_c1c2s_start = calloc(state->nodes + 1, sizeof(*state->nodes_c1c2s_start));
+	state->nodes_dependant_start = calloc(state->nodes + 1, sizeof(*state->nodes_dependant_start));
 	state->transistors_gate = calloc(state->transistors, sizeof(*state->transistors_gate));
 	state->transistors_c1 = calloc(state->transistors, sizeof(*state->transistors_c1));
 	state->transistors_c2 = calloc(state->transistors, sizeof(*state->transistors_c2));
@@ -517,7 +595,11 @@ setupNodesAndTransistors(netlist_transdefs *transdefs, BOOL *node_is_pullup, nod
 	state->list2 = calloc(state->nodes, sizeof(*state->list2));
 	state->listout_bitmap = calloc(WORDS_FOR_BITS(state->nodes), sizeof(*state->listout_bitmap));
 	state->group = malloc(state->nodes * sizeof(*state->group));
+	state->groupcount = 0;
 	state->groupbitmap = calloc(WORDS_FOR_BITS(state->nodes), sizeof(*state->groupbitmap));
+	state->nodes_group_start = calloc(state->nodes, sizeof(*state->nodes_group_start));
+	state->nodes_group_stamp = calloc(state->nodes, sizeof(*state->nodes_group_stamp));
+	state->group_stamp = calloc(state->nodes, sizeof(*state->group_stamp));
 	state->listin.list = state->list1;
         state->listin.count = 0;
 	state->listout.list = state->list2;
@@ -556,21 +638,45 @@ setupNodesAndTransistors(netlist_transdefs *transdefs, BOOL *node_is_pullup, nod
 	}
 	state->transistors = j;
 
+	/* count the per-node list sizes, and compute the list offsets */
+	for (i = 0; i < state->transistors; i++) {
+		state->nodes_gatecount[state->transistors_gate[i]]++;
+		state->nodes_c1c2count[state->transistors_c1[i]]++;
+		state->nodes_c1c2count[state->transistors_c2[i]]++;
+	}
+	for (i = 0; i < state->nodes; i++) {
+		state->nodes_gates_start[i + 1] = state->nodes_gates_start[i] + state->nodes_gatecount[i];
+		state->nodes_c1c2s_start[i + 1] = state->nodes_c1c2s_start[i] + state->nodes_c1c2count[i];
+		/* each gated transistor adds at most 2 dependants */
+		state->nodes_dependant_start[i + 1] = state->nodes_dependant_start[i] + 2 * state->nodes_gatecount[i];
+		state->nodes_gatecount[i] = 0;
+		state->nodes_c1c2count[i] = 0;
+	}
+	state->nodes_gates = calloc(state->nodes_gates_start[state->nodes] + 1, sizeof(*state->nodes_gates));
+	state->nodes_c1c2s = calloc(state->nodes_c1c2s_start[state->nodes] + 1, sizeof(*state->nodes_c1c2s));
+	state->nodes_c1c2s_other = calloc(state->nodes_c1c2s_start[state->nodes] + 1, sizeof(*state->nodes_c1c2s_other));
+	state->nodes_dependant = calloc(state->nodes_dependant_start[state->nodes] + 1, sizeof(*state->nodes_dependant));
+	state->nodes_left_dependant = calloc(state->nodes_gates_start[state->nodes] + 1, sizeof(*state->nodes_left_dependant));
+
 	/* cross reference transistors in nodes data structures */
 	for (i = 0; i < state->transistors; i++) {
 		nodenum_t gate = state->transistors_gate[i];
 		nodenum_t c1 = state->transistors_c1[i];
 		nodenum_t c2 = state->transistors_c2[i];
-		state->nodes_gates[gate][state->nodes_gatecount[gate]++] = i;
-		state->nodes_c1c2s[c1][state->nodes_c1c2count[c1]++] = i;
-		state->nodes_c1c2s[c2][state->nodes_c1c2count[c2]++] = i;
+		state->nodes_gates[state->nodes_gates_start[gate] + state->nodes_gatecount[gate]++] = i;
+		unsigned int c1_index = state->nodes_c1c2s_start[c1] + state->nodes_c1c2count[c1]++;
+		state->nodes_c1c2s[c1_index] = i;
+		state->nodes_c1c2s_other[c1_index] = c2;
+		unsigned int c2_index = state->nodes_c1c2s_start[c2] + state->nodes_c1c2count[c2]++;
+		state->nodes_c1c2s[c2_index] = i;
+		state->nodes_c1c2s_other[c2_index] = c1;
 	}
 
 	for (i = 0; i < state->nodes; i++) {
 		state->nodes_dependants[i] = 0;
 		state->nodes_left_dependants[i] = 0;
 		for (count_t g = 0; g < state->nodes_gatecount[i]; g++) {
-			transnum_t t = state->nodes_gates[i][g];
+			transnum_t t = state->nodes_gates[state->nodes_gates_start[i] + g];
 			nodenum_t c1 = state->transistors_c1[t];
 			if (c1 != vss && c1 != vcc) {
 				add_nodes_dependant(state, i, c1);
@@ -606,25 +712,17 @@ destroyNodesAndTransistors(state_t *state)
     free(state->nodes_pullup);
     free(state->nodes_pulldown);
     free(state->nodes_value);
-    for (count_t i = 0; i < state->nodes; i++) {
-        free(state->nodes_gates[i]);
-    }
-    free(state->nodes_gates);
-    for (count_t i = 0; i < state->nodes; i++) {
-        free(state->nodes_c1c2s[i]);
-    }
-    free(state->nodes_c1c2s);
     free(state->nodes_gatecount);
     free(state->nodes_c1c2count);
     free(state->nodes_dependants);
     free(state->nodes_left_dependants);
-    for (count_t i = 0; i < state->nodes; i++) {
-        free(state->nodes_dependant[i]);
-    }
+    free(state->nodes_gates_start);
+    free(state->nodes_gates);
+    free(state->nodes_c1c2s_start);
+    free(state->nodes_c1c2s);
+    free(state->nodes_c1c2s_other);
+    free(state->nodes_dependant_start);
     free(state->nodes_dependant);
-    for (count_t i = 0; i < state->nodes; i++) {
-        free(state->nodes_left_dependant[i]);
-    }
     free(state->nodes_left_dependant);
     free(state->transistors_gate);
     free(state->transistors_c1);
@@ -635,6 +733,9 @@ destroyNodesAndTransistors(state_t *state)
     free(state->listout_bitmap);
     free(state->group);
     free(state->groupbitmap);
+    free(state->nodes_group_start);
+    free(state->nodes_group_stamp);
+    free(state->group_stamp);
     free(state);
 }
 
@@ -658,6 +759,7 @@ setNode(state_t *state, nodenum_t nn, BOOL s)
 {
         set_nodes_pullup(state, nn, s);
         set_nodes_pulldown(state, nn, !s);
+        invalidateGroupOf(state, nn);
         listout_add(state, nn);
 
         recalcNodeList(state);
@@ -669,6 +771,30 @@ isNodeHigh(state_t *state, nodenum_t nn)
 	return get_nodes_value(state, nn);
 }
 
+void
+setUserData(state_t *state, void *user_data)
+{
+	state->user_data = user_data;
+}
+
+void *
+getUserData(state_t *state)
+{
+	return state->user_data;
+}
+
+void
+getStats(state_t *state, netlist_stats_t *stats)
+{
+	*stats = state->stats;
+}
+
+void
+resetStats(state_t *state)
+{
+	memset(&state->stats, 0, sizeof(state->stats));
+}
+
 /************************************************************
  *
  * Interfacing and Extracting State
@@ -6,6 +6,10 @@ state_t *setupNodesAndTransistors(netlist_transdefs *transdefs, BOOL *node_is_pu
 void destroyNodesAndTransistors(state_t *state);
 void setNode(state_t *state, nodenum_t nn, BOOL s);
 BOOL isNodeHigh(state_t *state, nodenum_t nn);
+void setUserData(state_t *state, void *user_data);
+void *getUserData(state_t *state);
+void getStats(state_t *state, netlist_stats_t *stats);
+void resetStats(state_t *state);
 unsigned int readNodes(state_t *state, int count, nodenum_t *nodelist);
 void writeNodes(state_t *state, int count, nodenum_t *nodelist, int v);
 
@@ -21,10 +21,72 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include "types.h"
 #include "netlist_sim.h"
-/* nodes & transistors */
-#include "netlist_6502.h"
+/* nodes & transistors are loaded at runtime, see loadChipNetlist() */
+#include "netlist_load.h"
+
+/************************************************************
+ *
+ * Netlist
+ *
+ ************************************************************/
+
+/* the loaded netlist and the node numbers looked up by name */
+static struct {
+	netlist_t *netlist;
+	nodenum_t ab[16], db[8], a[8], x[8], y[8], p[8], notir[8], s[8], pcl[8], pch[8];
+	nodenum_t rw, clk0, res, rdy, so, irq, nmi, sync_, vss, vcc;
+} nl;
+
+static BOOL
+lookupNode(const char *name, nodenum_t *node)
+{
+	int n = findNode(nl.netlist, name);
+	if (n < 0) {
+		fprintf(stderr, "perfect6502: node '%s' not found in netlist\n", name);
+		return NO;
+	}
+	*node = (nodenum_t)n;
+	return YES;
+}
+
+static BOOL
+lookupBus(const char *prefix, int count, nodenum_t *nodes)
+{
+	for (int i = 0; i < count; i++) {
+		char name[16];
+		snprintf(name, sizeof(name), "%s%d", prefix, i);
+		if (!lookupNode(name, &nodes[i]))
+			return NO;
+	}
+	return YES;
+}
+
+BOOL
+loadChipNetlist(const char *dir)
+{
+	if (nl.netlist)
+		return YES;
+	nl.netlist = loadNetlist(dir);
+	if (!nl.netlist)
+		return NO;
+	BOOL ok =
+		lookupBus("ab", 16, nl.ab) && lookupBus("db", 8, nl.db) &&
+		lookupBus("a", 8, nl.a) && lookupBus("x", 8, nl.x) && lookupBus("y", 8, nl.y) &&
+		lookupBus("p", 8, nl.p) && lookupBus("notir", 8, nl.notir) && lookupBus("s", 8, nl.s) &&
+		lookupBus("pcl", 8, nl.pcl) && lookupBus("pch", 8, nl.pch) &&
+		lookupNode("rw", &nl.rw) && lookupNode("clk0", &nl.clk0) && lookupNode("res", &nl.res) &&
+		lookupNode("rdy", &nl.rdy) && lookupNode("so", &nl.so) && lookupNode("irq", &nl.irq) &&
+		lookupNode("nmi", &nl.nmi) && lookupNode("sync_", &nl.sync_) &&
+		lookupNode("vss", &nl.vss) && lookupNode("vcc", &nl.vcc);
+	if (!ok) {
+		destroyNetlist(nl.netlist);
+		nl.netlist = NULL;
+	}
+	return ok;
+}
 
 /************************************************************
  *
@@ -35,73 +97,73 @@
 uint16_t
 readAddressBus(void *state)
 {
-	return readNodes(state, 16, (nodenum_t[]){ ab0, ab1, ab2, ab3, ab4, ab5, ab6, ab7, ab8, ab9, ab10, ab11, ab12, ab13, ab14, ab15 });
+	return readNodes(state, 16, nl.ab);
 }
 
 uint8_t
 readDataBus(void *state)
 {
-	return readNodes(state, 8, (nodenum_t[]){ db0, db1, db2, db3, db4, db5, db6, db7 });
+	return readNodes(state, 8, nl.db);
 }
 
 void
 writeDataBus(void *state, uint8_t d)
 {
-	writeNodes(state, 8, (nodenum_t[]){ db0, db1, db2, db3, db4, db5, db6, db7 }, d);
+	writeNodes(state, 8, nl.db, d);
 }
 
 BOOL
 readRW(void *state)
 {
-	return isNodeHigh(state, rw);
+	return isNodeHigh(state, nl.rw);
 }
 
 uint8_t
 readA(void *state)
 {
-	return readNodes(state, 8, (nodenum_t[]){ a0,a1,a2,a3,a4,a5,a6,a7 });
+	return readNodes(state, 8, nl.a);
 }
 
 uint8_t
 readX(void *state)
 {
-	return readNodes(state, 8, (nodenum_t[]){ x0,x1,x2,x3,x4,x5,x6,x7 });
+	return readNodes(state, 8, nl.x);
 }
 
 uint8_t
 readY(void *state)
 {
-	return readNodes(state, 8, (nodenum_t[]){ y0,y1,y2,y3,y4,y5,y6,y7 });
+	return readNodes(state, 8, nl.y);
 }
 
 uint8_t
 readP(void *state)
 {
-	return readNodes(state, 8, (nodenum_t[]){ p0,p1,p2,p3,p4,p5,p6,p7 });
+	return readNodes(state, 8, nl.p);
 }
 
 uint8_t
 readIR(void *state)
 {
-	return readNodes(state, 8, (nodenum_t[]){ notir0,notir1,notir2,notir3,notir4,notir5,notir6,notir7 }) ^ 0xFF;
+	return readNodes(state, 8, nl.notir) ^ 0xFF;
 }
 
 uint8_t
 readSP(void *state)
 {
-	return readNodes(state, 8, (nodenum_t[]){ s0,s1,s2,s3,s4,s5,s6,s7 });
+	return readNodes(state, 8, nl.s);
 }
 
 uint8_t
 readPCL(void *state)
 {
-	return readNodes(state, 8, (nodenum_t[]){ pcl0,pcl1,pcl2,pcl3,pcl4,pcl5,pcl6,pcl7 });
+	return readNodes(state, 8, nl.pcl);
 }
 
 uint8_t
 readPCH(void *state)
 {
-	return readNodes(state, 8, (nodenum_t[]){ pch0,pch1,pch2,pch3,pch4,pch5,pch6,pch7 });
+	return readNodes(state, 8, nl.pch);
 }
 
 uint16_t
@@ -116,27 +178,44 @@ readPC(void *state)
  *
  ************************************************************/
 
+/* memory used by initAndResetChip() */
 uint8_t memory[65536];
 
+/*
+ * per-instance state, attached to the netlist state as user data,
+ * so that any number of chips can run side by side
+ */
+typedef struct {
+	uint8_t *memory;
+	unsigned int cycle;
+} chip_t;
+
+static inline chip_t *
+getChip(void *state)
+{
+	return getUserData(state);
+}
+
 static uint8_t
-mRead(uint16_t a)
+mRead(chip_t *chip, uint16_t a)
 {
-	return memory[a];
+	return chip->memory[a];
 }
 
 static void
-mWrite(uint16_t a, uint8_t d)
+mWrite(chip_t *chip, uint16_t a, uint8_t d)
 {
-	memory[a] = d;
+	chip->memory[a] = d;
 }
 
 static inline void
 handleMemory(void *state)
 {
-	if (isNodeHigh(state, rw))
-		writeDataBus(state, mRead(readAddressBus(state)));
+	chip_t *chip = getChip(state);
+	if (isNodeHigh(state, nl.rw))
+		writeDataBus(state, mRead(chip, readAddressBus(state)));
 	else
-		mWrite(readAddressBus(state), readDataBus(state));
+		mWrite(chip, readAddressBus(state), readDataBus(state));
 }
 
 /************************************************************
@@ -145,43 +224,52 @@ handleMemory(void *state)
  *
  ************************************************************/
 
-static unsigned int cycle;
-
 void
 step(void *state)
 {
-	BOOL clk = isNodeHigh(state, clk0);
+	BOOL clk = isNodeHigh(state, nl.clk0);
 
 	/* invert clock */
-	setNode(state, clk0, !clk);
+	setNode(state, nl.clk0, !clk);
 	recalcNodeList(state);
 
 	/* handle memory reads and writes */
 	if (!clk)
 		handleMemory(state);
 
-	cycle++;
+	getChip(state)->cycle++;
+}
+
+unsigned int
+readCycle(void *state)
+{
+	return getChip(state)->cycle;
 }
 
 void *
-initAndResetChip()
+initAndResetChipWithMemory(uint8_t *mem)
 {
+	if (!nl.netlist) {
+		fprintf(stderr, "perfect6502: call loadChipNetlist() first\n");
+		return NULL;
+	}
 	/* set up data structures for efficient emulation */
-	nodenum_t nodes = sizeof(netlist_6502_node_is_pullup)/sizeof(*netlist_6502_node_is_pullup);
-	nodenum_t transistors = sizeof(netlist_6502_transdefs)/sizeof(*netlist_6502_transdefs);
-	void *state = setupNodesAndTransistors(netlist_6502_transdefs,
-										   netlist_6502_node_is_pullup,
-										   nodes,
-										   transistors,
-										   vss,
-										   vcc);
-
-	setNode(state, res, 0);
-	setNode(state, clk0, 1);
-	setNode(state, rdy, 1);
-	setNode(state, so, 0);
-	setNode(state, irq, 1);
-	setNode(state, nmi, 1);
+	void *state = setupNodesAndTransistors(nl.netlist->transdefs,
+										   nl.netlist->node_is_pullup,
+										   nl.netlist->nodes,
+										   nl.netlist->transistors,
+										   nl.vss,
+										   nl.vcc);
+	chip_t *chip = calloc(1, sizeof(chip_t));
+	chip->memory = mem;
+	setUserData(state, chip);
+
+	setNode(state, nl.res, 0);
+	setNode(state, nl.clk0, 1);
+	setNode(state, nl.rdy, 1);
+	setNode(state, nl.so, 0);
+	setNode(state, nl.irq, 1);
+	setNode(state, nl.nmi, 1);
 
 	stabilizeChip(state);
 
@@ -190,17 +278,24 @@ initAndResetChip()
 		step(state);
 
 	/* release RESET */
-	setNode(state, res, 1);
+	setNode(state, nl.res, 1);
 	recalcNodeList(state);
 
-	cycle = 0;
+	chip->cycle = 0;
 
 	return state;
 }
 
+void *
+initAndResetChip()
+{
+	return initAndResetChipWithMemory(memory);
+}
+
 void
 destroyChip(void *state)
 {
+    free(getChip(state));
     destroyNodesAndTransistors(state);
 }
 
@@ -213,16 +308,16 @@ destroyChip(void *state)
 void
 chipStatus(void *state)
 {
-	BOOL clk = isNodeHigh(state, clk0);
+	BOOL clk = isNodeHigh(state, nl.clk0);
 	uint16_t a = readAddressBus(state);
 	uint8_t d = readDataBus(state);
-	BOOL r_w = isNodeHigh(state, rw);
-	BOOL sync_p = isNodeHigh(state, sync_);
-	BOOL irq_p = isNodeHigh(state, irq);
-	BOOL nmi_p = isNodeHigh(state, nmi);
+	BOOL r_w = isNodeHigh(state, nl.rw);
+	BOOL sync_p = isNodeHigh(state, nl.sync_);
+	BOOL irq_p = isNodeHigh(state, nl.irq);
+	BOOL nmi_p = isNodeHigh(state, nl.nmi);
 
 	printf("halfcyc:%d phi0:%d AB:%04X D:%02X RnW:%d SYN:%d IRQ:%d NMI:%d PC:%04X A:%02X X:%02X Y:%02X SP:%02X P:%02X IR:%02X",
-		   cycle,
+		   readCycle(state),
 		   clk,
 		   a,
 		   d,
@@ -240,7 +335,7 @@ chipStatus(void *state)
 
 	if (clk) {
 		if (r_w)
-		printf(" R$%04X=$%02X", a, memory[a]);
+		printf(" R$%04X=$%02X", a, getChip(state)->memory[a]);
 		else
 		printf(" W$%04X=$%02X", a, d);
 	}
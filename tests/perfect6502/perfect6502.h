@@ -2,7 +2,12 @@
 #define state_t void
 #endif
 
+/* load the netlist files (segdefs.js, transdefs.js, nodenames.js) from a
+   directory, e.g. tests/perfect6502/netlist-6502, this must be called once
+   before creating chips, returns 0 and prints the reason on error */
+extern int loadChipNetlist(const char *dir);
 extern state_t *initAndResetChip();
+extern state_t *initAndResetChipWithMemory(unsigned char *memory);
 extern void destroyChip(state_t *state);
 extern void step(state_t *state);
 extern void chipStatus(state_t *state);
@@ -17,7 +22,9 @@ extern unsigned short readAddressBus(state_t *state);
 extern void writeDataBus(state_t *state, unsigned char);
 extern unsigned char readDataBus(state_t *state);
 extern unsigned char readIR(state_t *state);
+extern unsigned int readCycle(state_t *state);
 
+/* memory of the chip created by initAndResetChip(), use
+   initAndResetChipWithMemory() to run several chips side by side */
 extern unsigned char memory[65536];
-extern unsigned int cycle;
 extern unsigned int transistors;
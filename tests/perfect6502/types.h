@@ -16,6 +16,14 @@ typedef struct {
 	int c2;
 } netlist_transdefs;
 
+/* counters since setup or the last resetStats() */
+typedef struct {
+	unsigned long long nodes_visited;	/* nodes added to groups */
+	unsigned long long groups_rebuilt;	/* group floods */
+	unsigned long long groups_cached;	/* floods skipped because the group was unchanged */
+	unsigned long long iterations;		/* iterations of the recalc loop */
+} netlist_stats_t;
+
 #define YES 1
 #define NO 0
 
@@ -0,0 +1,301 @@
+#pragma once
+/*
+    testvec.h -- memory-mapped binary test vector files
+
+    Do this:
+        #define TESTVEC_IMPL
+    before including this file in *one* C file to create the implementation.
+
+    Test vectors (e.g. the FUSE Z80 tests) are converted by the fibs jobs
+    in fibs-scripts/ into binary files instead of C initializers, so that
+    the test programs compile quickly and new vectors don't require
+    recompiling. The files are mapped into memory and used in place.
+
+    File layout (all values little endian):
+
+        testvec_header_t            32 bytes
+        records                     num_records * record_size bytes at records_offset
+        variable size data          strings and arrays, referenced by
+                                    file offsets from the records,
+                                    each item starts 4-byte aligned
+
+    The record structs are defined by the tests using them, and must
+    match the layout written by the fibs job exactly (only fixed size
+    types, naturally aligned). testvec_records() checks the file kind
+    and record size.
+
+    Files are mapped copy-on-write, so tests may patch the data in place
+    (this is also how raw binary files like ROM dumps can be used).
+
+    Test data paths are relative to the tests directory, testvec_path()
+    resolves them (first match wins):
+
+        - relative to the directory set with testvec_set_dir(), the
+          tests pass their dir=... command line arg to it
+        - relative to the working directory, if the file or directory
+          exists there
+        - relative to the directory of the source file (__FILE__), which
+          only works when the source tree is still at the path it was
+          compiled from
+
+    Usage:
+
+        testvec_file_t file;
+        testvec_set_dir(sargs_value("dir"));    // optional, "" is ignored
+        char path[TESTVEC_MAX_PATH];
+        testvec_path(path, sizeof(path), __FILE__, "fuse/fuse-input.bin");
+        if (testvec_map(&file, path)) {
+            uint32_t num;
+            const my_record_t* recs = testvec_records(&file, TESTVEC_FOURCC('F','U','S','E'), sizeof(my_record_t), &num);
+            ...
+            const char* desc = testvec_at(&file, recs[0].desc_offset);
+            ...
+            testvec_unmap(&file);
+        }
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#define TESTVEC_MAX_PATH (1024)
+#define TESTVEC_VERSION (1)
+#define TESTVEC_FOURCC(a,b,c,d) ((uint32_t)(a)|((uint32_t)(b)<<8)|((uint32_t)(c)<<16)|((uint32_t)(d)<<24))
+#define TESTVEC_MAGIC TESTVEC_FOURCC('C','H','T','V')
+
+typedef struct {
+    uint32_t magic;             // TESTVEC_MAGIC
+    uint32_t version;           // TESTVEC_VERSION
+    uint32_t kind;              // FOURCC of the record type
+    uint32_t num_records;
+    uint32_t record_size;
+    uint32_t records_offset;
+    uint32_t file_size;
+    uint32_t reserved;
+} testvec_header_t;
+
+typedef struct {
+    uint8_t* ptr;
+    size_t size;
+    #if defined(_WIN32)
+    void* file_handle;
+    void* mapping_handle;
+    #endif
+} testvec_file_t;
+
+// callback for testvec_scan_dir()
+typedef void (*testvec_dir_func_t)(const char* dir, const char* name, void* user_data);
+
+// map a file into memory (copy-on-write), prints an error and returns false on failure
+bool testvec_map(testvec_file_t* file, const char* path);
+// unmap a mapped file
+void testvec_unmap(testvec_file_t* file);
+// validate the header and return a pointer to the first record, or 0 on error
+const void* testvec_records(const testvec_file_t* file, uint32_t kind, uint32_t record_size, uint32_t* out_num_records);
+// pointer to a file offset, or 0 if out of range
+const void* testvec_at(const testvec_file_t* file, uint32_t offset);
+// set the test data directory used by testvec_path(), 0 or "" to unset
+void testvec_set_dir(const char* dir);
+// build the path of a test data file or directory (see above), pass __FILE__ as src_file
+void testvec_path(char* buf, size_t buf_size, const char* src_file, const char* rel_path);
+// call func for each regular file in a directory (not recursive)
+bool testvec_scan_dir(const char* dir, testvec_dir_func_t func, void* user_data);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#if defined(TESTVEC_IMPL)
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#endif
+
+bool testvec_map(testvec_file_t* file, const char* path) {
+    assert(file && path);
+    memset(file, 0, sizeof(testvec_file_t));
+    #if defined(_WIN32)
+    HANDLE fh = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fh == INVALID_HANDLE_VALUE) {
+        fprintf(stderr, "testvec: failed to open '%s'\n", path);
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fh, &size) || (size.QuadPart == 0)) {
+        fprintf(stderr, "testvec: '%s' is empty\n", path);
+        CloseHandle(fh);
+        return false;
+    }
+    HANDLE mh = CreateFileMappingA(fh, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    void* ptr = mh ? MapViewOfFile(mh, FILE_MAP_COPY, 0, 0, 0) : NULL;
+    if (!ptr) {
+        fprintf(stderr, "testvec: failed to map '%s'\n", path);
+        if (mh) {
+            CloseHandle(mh);
+        }
+        CloseHandle(fh);
+        return false;
+    }
+    file->ptr = (uint8_t*)ptr;
+    file->size = (size_t)size.QuadPart;
+    file->file_handle = fh;
+    file->mapping_handle = mh;
+    #else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "testvec: failed to open '%s'\n", path);
+        return false;
+    }
+    struct stat st;
+    if ((fstat(fd, &st) != 0) || (st.st_size == 0)) {
+        fprintf(stderr, "testvec: '%s' is empty\n", path);
+        close(fd);
+        return false;
+    }
+    void* ptr = mmap(NULL, (size_t)st.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after closing the file
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        fprintf(stderr, "testvec: failed to map '%s'\n", path);
+        return false;
+    }
+    file->ptr = (uint8_t*)ptr;
+    file->size = (size_t)st.st_size;
+    #endif
+    return true;
+}
+
+void testvec_unmap(testvec_file_t* file) {
+    assert(file);
+    if (file->ptr) {
+        #if defined(_WIN32)
+        UnmapViewOfFile(file->ptr);
+        CloseHandle(file->mapping_handle);
+        CloseHandle(file->file_handle);
+        #else
+        munmap(file->ptr, file->size);
+        #endif
+    }
+    memset(file, 0, sizeof(testvec_file_t));
+}
+
+const void* testvec_records(const testvec_file_t* file, uint32_t kind, uint32_t record_size, uint32_t* out_num_records) {
+    assert(file && out_num_records);
+    *out_num_records = 0;
+    if (file->size < sizeof(testvec_header_t)) {
+        fprintf(stderr, "testvec: file too small\n");
+        return 0;
+    }
+    testvec_header_t hdr;
+    memcpy(&hdr, file->ptr, sizeof(hdr));
+    if ((hdr.magic != TESTVEC_MAGIC) || (hdr.version != TESTVEC_VERSION)) {
+        fprintf(stderr, "testvec: not a test vector file, or wrong version\n");
+        return 0;
+    }
+    if ((hdr.kind != kind) || (hdr.record_size != record_size)) {
+        fprintf(stderr, "testvec: unexpected record type or size (%u, expected %u)\n", hdr.record_size, record_size);
+        return 0;
+    }
+    if ((hdr.file_size != file->size) ||
+        ((uint64_t)hdr.records_offset + (uint64_t)hdr.num_records * hdr.record_size > file->size) ||
+        ((hdr.records_offset & 3) != 0))
+    {
+        fprintf(stderr, "testvec: truncated or corrupt file\n");
+        return 0;
+    }
+    *out_num_records = hdr.num_records;
+    return file->ptr + hdr.records_offset;
+}
+
+const void* testvec_at(const testvec_file_t* file, uint32_t offset) {
+    assert(file);
+    return (offset < file->size) ? (file->ptr + offset) : 0;
+}
+
+static char testvec_dir[TESTVEC_MAX_PATH];
+
+void testvec_set_dir(const char* dir) {
+    snprintf(testvec_dir, sizeof(testvec_dir), "%s", dir ? dir : "");
+}
+
+static bool testvec_exists(const char* path) {
+    #if defined(_WIN32)
+    return GetFileAttributesA(path) != INVALID_FILE_ATTRIBUTES;
+    #else
+    struct stat st;
+    return 0 == stat(path, &st);
+    #endif
+}
+
+void testvec_path(char* buf, size_t buf_size, const char* src_file, const char* rel_path) {
+    assert(buf && (buf_size > 0) && src_file && rel_path);
+    if (testvec_dir[0]) {
+        snprintf(buf, buf_size, "%s/%s", testvec_dir, rel_path);
+        return;
+    }
+    if (testvec_exists(rel_path)) {
+        snprintf(buf, buf_size, "%s", rel_path);
+        return;
+    }
+    const char* slash = strrchr(src_file, '/');
+    const char* backslash = strrchr(src_file, '\\');
+    if (backslash > slash) {
+        slash = backslash;
+    }
+    if (slash) {
+        snprintf(buf, buf_size, "%.*s/%s", (int)(slash - src_file), src_file, rel_path);
+    } else {
+        snprintf(buf, buf_size, "%s", rel_path);
+    }
+}
+
+bool testvec_scan_dir(const char* dir, testvec_dir_func_t func, void* user_data) {
+    assert(dir && func);
+    #if defined(_WIN32)
+    char pattern[TESTVEC_MAX_PATH];
+    snprintf(pattern, sizeof(pattern), "%s\\*", dir);
+    WIN32_FIND_DATAA fd;
+    HANDLE h = FindFirstFileA(pattern, &fd);
+    if (h == INVALID_HANDLE_VALUE) {
+        fprintf(stderr, "testvec: failed to open directory '%s'\n", dir);
+        return false;
+    }
+    do {
+        if (0 == (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+            func(dir, fd.cFileName, user_data);
+        }
+    } while (FindNextFileA(h, &fd));
+    FindClose(h);
+    #else
+    DIR* d = opendir(dir);
+    if (!d) {
+        fprintf(stderr, "testvec: failed to open directory '%s'\n", dir);
+        return false;
+    }
+    struct dirent* ent;
+    while ((ent = readdir(d))) {
+        char path[TESTVEC_MAX_PATH];
+        snprintf(path, sizeof(path), "%s/%s", dir, ent->d_name);
+        struct stat st;
+        if ((0 == stat(path, &st)) && S_ISREG(st.st_mode)) {
+            func(dir, ent->d_name, user_data);
+        }
+    }
+    closedir(d);
+    #endif
+    return true;
+}
+#endif // TESTVEC_IMPL
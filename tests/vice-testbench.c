@@ -0,0 +1,452 @@
+//------------------------------------------------------------------------------
+//  vice-testbench.c
+//
+//  Headless batch runner for the VICE test programs in tests/vice-tests.
+//
+//  All .prg files below the test directory are loaded one after another
+//  into a freshly booted C64 or VIC-20 (programs in a VIC20 directory, or
+//  with 'vic20' in their path, run on the VIC-20) and run unthrottled
+//  until they report a result, or the timeout is reached.
+//
+//  Results are detected like in the VICE testbench:
+//
+//  - a write to the debug cartridge register ($D7FF on the C64, $910F
+//    on the VIC-20) ends the test, 0 means passed, anything else failed
+//  - otherwise, when the border colour is set to green (passed) or
+//    red/light red (failed) and then doesn't change for one emulated
+//    second, this is taken as the result
+//
+//  Tests which don't report a result before the timeout (usually
+//  because they need to be checked visually) are listed as 'no result'
+//  and don't count as failures unless the 'strict' arg is given.
+//
+//  Usage (run from the project root, all args are optional):
+//
+//  vice-testbench dir=tests/vice-tests filter=viavarious timeout=30 strict
+//
+//  dir:        root directory of the test programs
+//  filter:     only run tests with this substring in their path
+//  timeout:    emulated seconds until a test is given up
+//  strict:     tests without result count as failures
+//
+//  Exits with an error if any test failed.
+//------------------------------------------------------------------------------
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include "sokol_args.h"
+#define CHIPS_IMPL
+#include "chips/chips_common.h"
+#include "chips/m6502.h"
+#include "chips/m6522.h"
+#include "chips/m6526.h"
+#include "chips/m6569.h"
+#include "chips/m6581.h"
+#include "chips/m6561.h"
+#include "chips/beeper.h"
+#include "chips/kbd.h"
+#include "chips/mem.h"
+#include "chips/clk.h"
+#include "systems/c1530.h"
+#include "systems/c1541.h"
+#include "systems/c64.h"
+#include "systems/vic20.h"
+#include "c64-roms.h"
+#include "vic20-roms.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+#define MAX_TESTS (1024)
+#define MAX_PATH_SIZE (512)
+#define MAX_PRG_SIZE (64 * 1024)
+#define BOOT_USEC (3 * 1000000)
+#define SLICE_USEC (20000)
+#define BORDER_SETTLE_USEC (1000000)
+
+#define C64_DEBUGCART_ADDR (0xD7FF)
+#define VIC20_DEBUGCART_ADDR (0x910F)
+
+// C64 and VIC-20 colour indices
+#define COLOR_RED (2)
+#define COLOR_GREEN (5)
+#define COLOR_LIGHTRED (10)
+
+typedef enum {
+    MACHINE_C64,
+    MACHINE_VIC20,
+} machine_t;
+
+typedef enum {
+    RESULT_NONE,
+    RESULT_PASSED,
+    RESULT_FAILED,
+    RESULT_SKIPPED,
+} result_t;
+
+typedef struct {
+    result_t result;
+    bool by_debugcart;
+    uint8_t value;          // debugcart value or border colour
+    double emu_sec;
+    double host_sec;
+} test_result_t;
+
+typedef struct {
+    machine_t machine;
+    bool stopped;
+    // debug cartridge register writes
+    bool debugcart_written;
+    uint8_t debugcart_value;
+    // border colour writes
+    bool border_written;
+    uint8_t border_color;
+    uint64_t border_tick;
+    uint64_t tick;
+} monitor_t;
+
+static struct {
+    int num_tests;
+    char paths[MAX_TESTS][MAX_PATH_SIZE];
+    uint8_t prg[MAX_PRG_SIZE];
+    monitor_t mon;
+    c64_t c64;
+    c64_t c64_booted;
+    vic20_t vic20;
+    vic20_t vic20_booted;
+    vic20_memory_config_t vic20_mem_config;
+    bool c64_valid;
+    bool vic20_valid;
+} state;
+
+static void dummy_audio_callback(const float* samples, int num_samples, void* user_data) {
+    (void)samples;
+    (void)num_samples;
+    (void)user_data;
+}
+
+// called after each CPU tick, watches writes to the debug cartridge and border colour registers
+static void debug_callback(void* user_data, uint64_t pins) {
+    monitor_t* mon = (monitor_t*) user_data;
+    mon->tick++;
+    if (pins & M6502_RW) {
+        return;
+    }
+    const uint16_t addr = M6502_GET_ADDR(pins);
+    const uint8_t data = M6502_GET_DATA(pins);
+    if (mon->machine == MACHINE_C64) {
+        if (addr == C64_DEBUGCART_ADDR) {
+            mon->debugcart_written = true;
+            mon->debugcart_value = data;
+            mon->stopped = true;
+        } else if ((addr & 0xFC3F) == 0xD020) {
+            // VIC-II registers are mirrored every 64 bytes
+            mon->border_written = true;
+            mon->border_color = data & 0x0F;
+            mon->border_tick = mon->tick;
+        }
+    } else {
+        if (addr == VIC20_DEBUGCART_ADDR) {
+            mon->debugcart_written = true;
+            mon->debugcart_value = data;
+            mon->stopped = true;
+        } else if (addr == 0x900F) {
+            mon->border_written = true;
+            mon->border_color = data & 0x07;
+            mon->border_tick = mon->tick;
+        }
+    }
+}
+
+static chips_debug_t debug_desc(void) {
+    return (chips_debug_t){
+        .callback = { .func = debug_callback, .user_data = &state.mon },
+        .stopped = &state.mon.stopped,
+    };
+}
+
+static void boot_c64(void) {
+    if (state.c64_valid) {
+        c64_load_snapshot(&state.c64, C64_SNAPSHOT_VERSION, &state.c64_booted);
+        return;
+    }
+    c64_init(&state.c64, &(c64_desc_t){
+        .audio.callback.func = dummy_audio_callback,
+        .roms = {
+            .chars = { .ptr=dump_c64_char_bin, .size=sizeof(dump_c64_char_bin) },
+            .basic = { .ptr=dump_c64_basic_bin, .size=sizeof(dump_c64_basic_bin) },
+            .kernal = { .ptr=dump_c64_kernalv3_bin, .size=sizeof(dump_c64_kernalv3_bin) }
+        },
+        .debug = debug_desc(),
+    });
+    c64_exec(&state.c64, BOOT_USEC);
+    // all following tests start from this snapshot instead of booting again
+    c64_save_snapshot(&state.c64, &state.c64_booted);
+    state.c64_valid = true;
+}
+
+static void boot_vic20(vic20_memory_config_t mem_config) {
+    if (state.vic20_valid && (state.vic20_mem_config == mem_config)) {
+        vic20_load_snapshot(&state.vic20, VIC20_SNAPSHOT_VERSION, &state.vic20_booted);
+        return;
+    }
+    if (state.vic20_valid) {
+        vic20_discard(&state.vic20);
+    }
+    vic20_init(&state.vic20, &(vic20_desc_t){
+        .mem_config = mem_config,
+        .audio.callback.func = dummy_audio_callback,
+        .roms = {
+            .chars = { .ptr=dump_vic20_characters_901460_03_bin, .size=sizeof(dump_vic20_characters_901460_03_bin) },
+            .basic = { .ptr=dump_vic20_basic_901486_01_bin, .size=sizeof(dump_vic20_basic_901486_01_bin) },
+            .kernal = { .ptr=dump_vic20_kernal_901486_07_bin, .size=sizeof(dump_vic20_kernal_901486_07_bin) },
+        },
+        .debug = debug_desc(),
+    });
+    vic20_exec(&state.vic20, BOOT_USEC);
+    vic20_save_snapshot(&state.vic20, &state.vic20_booted);
+    state.vic20_mem_config = mem_config;
+    state.vic20_valid = true;
+}
+
+// the VIC-20 BASIC start address depends on the RAM expansion
+static bool vic20_mem_config_for_prg(uint16_t load_addr, vic20_memory_config_t* out_mem_config) {
+    switch (load_addr) {
+        case 0x1001: *out_mem_config = VIC20_MEMCONFIG_STANDARD; return true;
+        case 0x0401: *out_mem_config = VIC20_MEMCONFIG_MAX; return true;
+        case 0x1201: *out_mem_config = VIC20_MEMCONFIG_32K; return true;
+        default: return false;
+    }
+}
+
+// put 'RUN' into the KERNAL keyboard buffer, same location on the C64 and VIC-20
+static void put_run_command(mem_t* mem) {
+    static const char cmd[] = "RUN\r";
+    for (uint16_t i = 0; i < (sizeof(cmd) - 1); i++) {
+        mem_wr(mem, 0x0277 + i, (uint8_t)cmd[i]);
+    }
+    mem_wr(mem, 0x00C6, (uint8_t)(sizeof(cmd) - 1));
+}
+
+static uint32_t exec(machine_t machine, uint32_t micro_seconds) {
+    if (machine == MACHINE_C64) {
+        return c64_exec(&state.c64, micro_seconds);
+    } else {
+        return vic20_exec(&state.vic20, micro_seconds);
+    }
+}
+
+static bool is_border_result(uint8_t color) {
+    return (color == COLOR_GREEN) || (color == COLOR_RED) || (color == COLOR_LIGHTRED);
+}
+
+static test_result_t run_test(const char* path, machine_t machine, double timeout_sec) {
+    test_result_t res = { .result = RESULT_SKIPPED };
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        return res;
+    }
+    const size_t size = fread(state.prg, 1, sizeof(state.prg), fp);
+    fclose(fp);
+    if (size < 3) {
+        return res;
+    }
+    const uint16_t load_addr = (uint16_t)(state.prg[0] | (state.prg[1] << 8));
+    const chips_range_t prg = { .ptr = state.prg, .size = size };
+
+    const uint64_t start = stm_now();
+    state.mon = (monitor_t){ .machine = machine };
+    uint32_t freq;
+    if (machine == MACHINE_C64) {
+        // only BASIC programs can be started with RUN
+        if (load_addr != 0x0801) {
+            return res;
+        }
+        boot_c64();
+        if (!c64_quickload(&state.c64, prg)) {
+            return res;
+        }
+        c64_basic_run(&state.c64);
+        freq = C64_FREQUENCY;
+    } else {
+        vic20_memory_config_t mem_config;
+        if (!vic20_mem_config_for_prg(load_addr, &mem_config)) {
+            return res;
+        }
+        boot_vic20(mem_config);
+        if (!vic20_quickload(&state.vic20, prg)) {
+            return res;
+        }
+        put_run_command(&state.vic20.mem_cpu);
+        freq = VIC20_FREQUENCY;
+    }
+    // ignore the border colour written during boot
+    state.mon = (monitor_t){ .machine = machine };
+
+    const uint64_t timeout_ticks = (uint64_t)(timeout_sec * freq);
+    const uint64_t settle_ticks = ((uint64_t)freq * BORDER_SETTLE_USEC) / 1000000;
+    res.result = RESULT_NONE;
+    while (state.mon.tick < timeout_ticks) {
+        exec(machine, SLICE_USEC);
+        if (state.mon.debugcart_written) {
+            res.by_debugcart = true;
+            res.value = state.mon.debugcart_value;
+            res.result = (0 == res.value) ? RESULT_PASSED : RESULT_FAILED;
+            break;
+        }
+        if (state.mon.border_written && is_border_result(state.mon.border_color) && ((state.mon.tick - state.mon.border_tick) >= settle_ticks)) {
+            res.value = state.mon.border_color;
+            res.result = (COLOR_GREEN == res.value) ? RESULT_PASSED : RESULT_FAILED;
+            break;
+        }
+    }
+    res.emu_sec = (double)state.mon.tick / freq;
+    res.host_sec = stm_sec(stm_since(start));
+    return res;
+}
+
+static bool has_ext(const char* path, const char* ext) {
+    const size_t path_len = strlen(path);
+    const size_t ext_len = strlen(ext);
+    return (path_len > ext_len) && (0 == strcmp(path + path_len - ext_len, ext));
+}
+
+static void add_test(const char* path) {
+    if (state.num_tests >= MAX_TESTS) {
+        fprintf(stderr, "too many tests, ignoring '%s'\n", path);
+        return;
+    }
+    snprintf(state.paths[state.num_tests++], MAX_PATH_SIZE, "%s", path);
+}
+
+// recursively find all .prg files, skipping the 'dumps' directories (reference data)
+static void scan_dir(const char* dir) {
+    #if defined(_WIN32)
+    char pattern[MAX_PATH_SIZE];
+    snprintf(pattern, sizeof(pattern), "%s/*", dir);
+    WIN32_FIND_DATAA data;
+    HANDLE h = FindFirstFileA(pattern, &data);
+    if (h == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    do {
+        const char* name = data.cFileName;
+        const bool is_dir = 0 != (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY);
+    #else
+    DIR* d = opendir(dir);
+    if (!d) {
+        return;
+    }
+    struct dirent* ent;
+    while ((ent = readdir(d)) != 0) {
+        const char* name = ent->d_name;
+    #endif
+        if ((name[0] == '.') || (0 == strcmp(name, "dumps"))) {
+            continue;
+        }
+        char path[MAX_PATH_SIZE];
+        snprintf(path, sizeof(path), "%s/%s", dir, name);
+        #if !defined(_WIN32)
+        struct stat st;
+        const bool is_dir = (0 == stat(path, &st)) && S_ISDIR(st.st_mode);
+        #endif
+        if (is_dir) {
+            scan_dir(path);
+        } else if (has_ext(name, ".prg")) {
+            add_test(path);
+        }
+    #if defined(_WIN32)
+    } while (FindNextFileA(h, &data));
+    FindClose(h);
+    #else
+    }
+    closedir(d);
+    #endif
+}
+
+static int cmp_path(const void* a, const void* b) {
+    return strcmp((const char*)a, (const char*)b);
+}
+
+static machine_t machine_for_path(const char* path) {
+    return (strstr(path, "VIC20") || strstr(path, "vic20")) ? MACHINE_VIC20 : MACHINE_C64;
+}
+
+static int run(void) {
+    const char* dir = sargs_value_def("dir", "tests/vice-tests");
+    const double timeout_sec = atof(sargs_value_def("timeout", "30"));
+    const bool strict = sargs_exists("strict");
+    if (timeout_sec <= 0.0) {
+        fprintf(stderr, "invalid args (timeout > 0)\n");
+        return 10;
+    }
+    scan_dir(dir);
+    if (0 == state.num_tests) {
+        fprintf(stderr, "no test programs found in '%s'\n", dir);
+        return 10;
+    }
+    qsort(state.paths, (size_t)state.num_tests, MAX_PATH_SIZE, cmp_path);
+
+    int num_run = 0, num_passed = 0, num_failed = 0, num_none = 0, num_skipped = 0;
+    double total_emu_sec = 0.0, total_host_sec = 0.0;
+    const size_t dir_len = strlen(dir);
+    for (int i = 0; i < state.num_tests; i++) {
+        const char* path = state.paths[i];
+        if (sargs_exists("filter") && !strstr(path, sargs_value("filter"))) {
+            continue;
+        }
+        const char* name = (0 == strncmp(path, dir, dir_len)) ? path + dir_len + 1 : path;
+        const machine_t machine = machine_for_path(name);
+        const test_result_t res = run_test(path, machine, timeout_sec);
+        const char* machine_name = (machine == MACHINE_C64) ? "c64" : "vic20";
+        if (res.result == RESULT_SKIPPED) {
+            num_skipped++;
+            printf("SKIP  %-5s %s (not a BASIC program)\n", machine_name, name);
+            continue;
+        }
+        num_run++;
+        total_emu_sec += res.emu_sec;
+        total_host_sec += res.host_sec;
+        const char* label;
+        switch (res.result) {
+            case RESULT_PASSED: label = "PASS"; num_passed++; break;
+            case RESULT_FAILED: label = "FAIL"; num_failed++; break;
+            default:            label = "NONE"; num_none++; break;
+        }
+        printf("%s  %-5s %-48s %7.2f emu sec %7.3f host sec", label, machine_name, name, res.emu_sec, res.host_sec);
+        if (res.result == RESULT_NONE) {
+            printf("  (timeout)\n");
+        } else if (res.by_debugcart) {
+            printf("  (debugcart $%02X)\n", res.value);
+        } else {
+            printf("  (border colour %d)\n", res.value);
+        }
+        fflush(stdout);
+    }
+    printf("== %d tests run: %d passed, %d failed, %d no result%s, %d skipped\n",
+        num_run, num_passed, num_failed, num_none, strict ? " (counted as failed)" : "", num_skipped);
+    printf("== %.2f emulated secs in %.2f host secs\n", total_emu_sec, total_host_sec);
+    const int num_errors = num_failed + (strict ? num_none : 0);
+    return (num_errors > 0) ? 10 : 0;
+}
+
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    stm_setup();
+    int res = run();
+    if (state.c64_valid) {
+        c64_discard(&state.c64);
+    }
+    if (state.vic20_valid) {
+        vic20_discard(&state.vic20);
+    }
+    sargs_shutdown();
+    return res;
+}
@@ -8,12 +8,35 @@
 //  undocumented XF and YF flag bits, maybe the two tests are based
 //  on different Z80 revisions. This test ignores the XF and YF flags
 //  for instructions where ZEXALL and FUSE disagree.
+//
+//  The test cases run in parallel with one memory buffer per worker
+//  thread, the error messages are collected per test case and printed
+//  in the original order.
+//
+//  Usage (all args are optional):
+//
+//  z80-fuse threads=4
+//
+//  threads:    number of worker threads, default is one per CPU core
+//  dir:        directory with the test data, see testvec_path() in testvec.h
 //------------------------------------------------------------------------------
 #define CHIPS_IMPL
 #include "chips/z80.h"
+#define SOKOL_IMPL
+#include "sokol_args.h"
+#define PARALLEL_IMPL
+#include "parallel.h"
+#define TESTVEC_IMPL
+#include "testvec.h"
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+// the test vectors are converted by the 'fuse' job in fibs-scripts/fuse.ts
+// into binary files (see testvec.h), the structs must match the file layout
 
 // CPU state
 typedef struct {
@@ -22,14 +45,15 @@ typedef struct {
     uint16_t ix, iy, sp, pc;
     uint8_t i, r, iff1, iff2, im;
     uint8_t halted;
-    int ticks;
+    uint16_t pad;
+    int32_t ticks;
 } fuse_state_t;
 
 // memory chunk
 #define FUSE_MAX_BYTES (32)
 typedef struct {
-    int num_bytes;
     uint16_t addr;
+    uint16_t num_bytes;
     uint8_t bytes[FUSE_MAX_BYTES];
 } fuse_mem_t;
 
@@ -43,27 +67,55 @@ typedef enum {
 } fuse_eventtype_t;
 
 typedef struct {
-    int tick;
-    fuse_eventtype_t type;
+    int32_t tick;
     uint16_t addr;
+    uint8_t type;   // fuse_eventtype_t
     uint8_t data;
 } fuse_event_t;
 
-// a complete test (used for input, output, expected)
-#define FUSE_MAX_EVENTS (128)
-#define FUSE_MAX_MEMCHUNKS (8)
+// a complete test (used for input and expected), the description,
+// events and memory chunks are stored at file offsets after the records
 typedef struct {
-    const char* desc;
-    uint8_t num_events;
-    uint8_t num_chunks;
+    uint32_t desc_offset;
+    uint32_t events_offset;
+    uint32_t chunks_offset;
+    uint16_t num_events;
+    uint16_t num_chunks;
     fuse_state_t state;
-    fuse_event_t events[FUSE_MAX_EVENTS];
-    fuse_mem_t chunks[FUSE_MAX_MEMCHUNKS];
 } fuse_test_t;
 
-#include "fuse/fuse.h"
+// a mapped test vector file
+typedef struct {
+    testvec_file_t file;
+    const fuse_test_t* tests;
+    uint32_t num_tests;
+} fuse_file_t;
+
+// error messages of a test case
+#define OUTPUT_SIZE (1024)
+typedef struct {
+    bool ok;
+    int out_pos;
+    char output[OUTPUT_SIZE];
+} fuse_result_t;
 
-static uint8_t mem[1<<16];
+static struct {
+    fuse_file_t input;
+    fuse_file_t expected;
+    uint8_t mem[PAR_MAX_WORKERS][1<<16];
+    fuse_result_t* results;
+} state;
+
+static void out_printf(fuse_result_t* res, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    const int remaining = OUTPUT_SIZE - res->out_pos;
+    const int len = vsnprintf(&res->output[res->out_pos], (size_t)remaining, fmt, args);
+    va_end(args);
+    if (len > 0) {
+        res->out_pos += (len < remaining) ? len : (remaining - 1);
+    }
+}
 
 /* don't test the XF/YF flags in the indirect BIT test instructions,
     since FUSE handles those wrong
@@ -91,7 +143,42 @@ static bool test_xfyf(const char* name) {
     return true;
 }
 
-static uint64_t tick(z80_t* cpu, uint64_t pins) {
+static bool load_file(fuse_file_t* f, const char* rel_path) {
+    char path[TESTVEC_MAX_PATH];
+    testvec_path(path, sizeof(path), __FILE__, rel_path);
+    if (!testvec_map(&f->file, path)) {
+        return false;
+    }
+    f->tests = testvec_records(&f->file, TESTVEC_FOURCC('F','U','S','E'), sizeof(fuse_test_t), &f->num_tests);
+    if (!f->tests) {
+        fprintf(stderr, "invalid test vector file '%s'\n", path);
+        return false;
+    }
+    // validate the file offsets once, so that the tests can use them unchecked
+    for (uint32_t i = 0; i < f->num_tests; i++) {
+        const fuse_test_t* t = &f->tests[i];
+        const uint64_t events_end = (uint64_t)t->events_offset + t->num_events * sizeof(fuse_event_t);
+        const uint64_t chunks_end = (uint64_t)t->chunks_offset + t->num_chunks * sizeof(fuse_mem_t);
+        if ((t->desc_offset >= f->file.size) || (events_end > f->file.size) || (chunks_end > f->file.size) ||
+            ((t->events_offset & 3) != 0) || ((t->chunks_offset & 3) != 0) ||
+            (0 == memchr(f->file.ptr + t->desc_offset, 0, f->file.size - t->desc_offset)))
+        {
+            fprintf(stderr, "corrupt test vector file '%s' (test %u)\n", path, i);
+            return false;
+        }
+    }
+    return true;
+}
+
+static const char* test_desc(const fuse_file_t* f, const fuse_test_t* t) {
+    return (const char*)(f->file.ptr + t->desc_offset);
+}
+
+static const fuse_mem_t* test_chunks(const fuse_file_t* f, const fuse_test_t* t) {
+    return (const fuse_mem_t*)(f->file.ptr + t->chunks_offset);
+}
+
+static uint64_t tick(z80_t* cpu, uint8_t* mem, uint64_t pins) {
     pins = z80_tick(cpu, pins);
     if (pins & Z80_MREQ) {
         uint16_t addr = Z80_GET_ADDR(pins);
@@ -111,7 +198,10 @@ static uint64_t tick(z80_t* cpu, uint64_t pins) {
     return pins;
 }
 
-static bool run_test(fuse_test_t* inp, fuse_test_t* exp) {
+static bool run_test(const fuse_test_t* inp, const fuse_test_t* exp, uint8_t* mem, fuse_result_t* res) {
+    const char* desc = test_desc(&state.input, inp);
+    const fuse_mem_t* inp_chunks = test_chunks(&state.input, inp);
+    const fuse_mem_t* exp_chunks = test_chunks(&state.expected, exp);
 
     // prepare CPU and memory with test input data (same initial state as coretest.c in FUSE
     for (int i = 0; i < 0x10000; i += 4) {
@@ -138,111 +228,111 @@ static bool run_test(fuse_test_t* inp, fuse_test_t* exp) {
     cpu.iff2 = 0 != inp->state.iff2;
     cpu.im = inp->state.im;
     for (int i = 0; i < inp->num_chunks; i++) {
-        uint16_t addr = inp->chunks[i].addr;
-        int num_bytes = inp->chunks[i].num_bytes;
+        uint16_t addr = inp_chunks[i].addr;
+        int num_bytes = inp_chunks[i].num_bytes;
         for (int bi = 0; bi < num_bytes; bi++) {
-            mem[addr++ & 0xFFFF] = inp->chunks[i].bytes[bi];
+            mem[addr++ & 0xFFFF] = inp_chunks[i].bytes[bi];
         }
     }
 
     // run CPU for at least N ticks or instruction completion
     uint64_t pins = z80_prefetch(&cpu, cpu.pc);
-    pins = tick(&cpu, pins);
+    pins = tick(&cpu, mem, pins);
     int num_ticks = 0;
     do {
-       pins = tick(&cpu, pins);
+       pins = tick(&cpu, mem, pins);
        num_ticks++;
     } while ((num_ticks < (inp->state.ticks)) || !z80_opdone(&cpu));
 
     // compare result against expected state
     bool ok = true;
     uint16_t af_mask = 0xFFFF;
-    if (!test_xfyf(inp->desc)) {
+    if (!test_xfyf(desc)) {
         af_mask &= ~(Z80_XF|Z80_YF);
     }
     if (num_ticks != exp->state.ticks) {
-        printf("\n  %s: TICKS: %d (expected %d)", inp->desc, num_ticks, exp->state.ticks);
+        out_printf(res, "\n  %s: TICKS: %d (expected %d)", desc, num_ticks, exp->state.ticks);
         ok = false;
     }
     if ((exp->state.af & af_mask) != (cpu.af & af_mask)) {
-        printf("\n  %s: AF: 0x%04X (expected 0x%04X)", inp->desc, cpu.af&af_mask, exp->state.af&af_mask);
+        out_printf(res, "\n  %s: AF: 0x%04X (expected 0x%04X)", desc, cpu.af&af_mask, exp->state.af&af_mask);
         ok = false;
     }
     if (exp->state.bc != cpu.bc) {
-        printf("\n  %s: BC: 0x%04X (expected 0x%04X)", inp->desc, cpu.bc, exp->state.bc);
+        out_printf(res, "\n  %s: BC: 0x%04X (expected 0x%04X)", desc, cpu.bc, exp->state.bc);
         ok = false;
     }
     if (exp->state.de != cpu.de) {
-        printf("\n  %s: DE: 0x%04X (expected 0x%04X)", inp->desc, cpu.de, exp->state.de);
+        out_printf(res, "\n  %s: DE: 0x%04X (expected 0x%04X)", desc, cpu.de, exp->state.de);
         ok = false;
     }
     if (exp->state.hl != cpu.hl) {
-        printf("\n  %s: HL: 0x%04X (expected 0x%04X)", inp->desc, cpu.hl, exp->state.hl);
+        out_printf(res, "\n  %s: HL: 0x%04X (expected 0x%04X)", desc, cpu.hl, exp->state.hl);
         ok = false;
     }
     if (exp->state.af_ != cpu.af2) {
-        printf("\n  %s: AF': 0x%04X (expected 0x%04X)", inp->desc, cpu.af2, exp->state.af_);
+        out_printf(res, "\n  %s: AF': 0x%04X (expected 0x%04X)", desc, cpu.af2, exp->state.af_);
         ok = false;
     }
     if (exp->state.bc_ != cpu.bc2) {
-        printf("\n  %s: BC': 0x%04X (expected 0x%04X)", inp->desc, cpu.bc2, exp->state.bc_);
+        out_printf(res, "\n  %s: BC': 0x%04X (expected 0x%04X)", desc, cpu.bc2, exp->state.bc_);
         ok = false;
     }
     if (exp->state.de_ != cpu.de2) {
-        printf("\n  %s: DE': 0x%04X (expected 0x%04X)", inp->desc, cpu.de2, exp->state.de_);
+        out_printf(res, "\n  %s: DE': 0x%04X (expected 0x%04X)", desc, cpu.de2, exp->state.de_);
         ok = false;
     }
     if (exp->state.hl_ != cpu.hl2) {
-        printf("\n  %s: HL': 0x%04X (expected 0x%04X)", inp->desc, cpu.hl2, exp->state.hl_);
+        out_printf(res, "\n  %s: HL': 0x%04X (expected 0x%04X)", desc, cpu.hl2, exp->state.hl_);
         ok = false;
     }
     if (exp->state.ix != cpu.ix) {
-        printf("\n  %s: IX: 0x%04X (expected 0x%04X)", inp->desc, cpu.ix, exp->state.ix);
+        out_printf(res, "\n  %s: IX: 0x%04X (expected 0x%04X)", desc, cpu.ix, exp->state.ix);
         ok = false;
     }
     if (exp->state.iy != cpu.iy) {
-        printf("\n  %s: IY: 0x%04X (expected 0x%04X)", inp->desc, cpu.iy, exp->state.iy);
+        out_printf(res, "\n  %s: IY: 0x%04X (expected 0x%04X)", desc, cpu.iy, exp->state.iy);
         ok = false;
     }
     if (exp->state.sp != cpu.sp) {
-        printf("\n  %s: SP: 0x%04X (expected 0x%04X)", inp->desc, cpu.sp, exp->state.sp);
+        out_printf(res, "\n  %s: SP: 0x%04X (expected 0x%04X)", desc, cpu.sp, exp->state.sp);
         ok = false;
     }
     if (exp->state.pc != (cpu.pc-1)) {
-        printf("\n  %s: PC: 0x%04X (expected 0x%04X)", inp->desc, cpu.pc, exp->state.pc);
+        out_printf(res, "\n  %s: PC: 0x%04X (expected 0x%04X)", desc, cpu.pc, exp->state.pc);
         ok = false;
     }
     if (exp->state.i != cpu.i) {
-        printf("\n  %s: I: 0x%02X (expected 0x%02X)", inp->desc, cpu.i, exp->state.i);
+        out_printf(res, "\n  %s: I: 0x%02X (expected 0x%02X)", desc, cpu.i, exp->state.i);
         ok = false;
     }
     if (exp->state.r != cpu.r) {
-        printf("\n  %s: R: 0x%02X (expected 0x%02X)", inp->desc, cpu.r, exp->state.r);
+        out_printf(res, "\n  %s: R: 0x%02X (expected 0x%02X)", desc, cpu.r, exp->state.r);
         ok = false;
     }
     if (exp->state.iff1 != cpu.iff1) {
-        printf("\n  %s: IFF1: %s (expected %s)", inp->desc, cpu.iff1?"true":"false", exp->state.iff1?"true":"false");
+        out_printf(res, "\n  %s: IFF1: %s (expected %s)", desc, cpu.iff1?"true":"false", exp->state.iff1?"true":"false");
         ok = false;
     }
     if (exp->state.iff2 != cpu.iff2) {
-        printf("\n  %s: IFF2: %s (expected %s)", inp->desc, cpu.iff2?"true":"false", exp->state.iff2?"true":"false");
+        out_printf(res, "\n  %s: IFF2: %s (expected %s)", desc, cpu.iff2?"true":"false", exp->state.iff2?"true":"false");
         ok = false;
     }
     if (exp->state.im != cpu.im) {
-        printf("\n  %s: IM: 0x%02X (expected 0x%02X)", inp->desc, cpu.im, exp->state.im);
+        out_printf(res, "\n  %s: IM: 0x%02X (expected 0x%02X)", desc, cpu.im, exp->state.im);
         ok = false;
     }
     if ((0 != exp->state.halted) != (0 != (pins & Z80_HALT))) {
-        printf("\n  %s: HALT: %s (expected %s)", inp->desc, (pins&Z80_HALT)?"true":"false", exp->state.halted?"true":"false");
+        out_printf(res, "\n  %s: HALT: %s (expected %s)", desc, (pins&Z80_HALT)?"true":"false", exp->state.halted?"true":"false");
         ok = false;
     }
     // check memory content
     for (int i = 0; i < exp->num_chunks; i++) {
-        fuse_mem_t* chunk = &(exp->chunks[i]);
+        const fuse_mem_t* chunk = &exp_chunks[i];
         uint16_t addr = chunk->addr;
         for (int bi = 0; bi < chunk->num_bytes; bi++) {
             if (chunk->bytes[bi] != mem[(addr+bi) & 0xFFFF]) {
-                printf("\n  %s: BYTE AT 0x%04X IS 0x%02X (expected 0x%02X)", inp->desc,
+                out_printf(res, "\n  %s: BYTE AT 0x%04X IS 0x%02X (expected 0x%02X)", desc,
                     (addr+bi) & 0xFFFF,
                     mem[(addr+bi) & 0xFFFF],
                     chunk->bytes[bi]);
@@ -253,15 +343,38 @@ static bool run_test(fuse_test_t* inp, fuse_test_t* exp) {
     return ok;
 }
 
-int main() {
-    assert(fuse_expected_num == fuse_input_num);
+static void run_case(int item_index, int worker_index, void* user_data) {
+    (void)user_data;
+    fuse_result_t* res = &state.results[item_index];
+    res->ok = run_test(&state.input.tests[item_index], &state.expected.tests[item_index], state.mem[worker_index], res);
+}
+
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    testvec_set_dir(sargs_value("dir"));
+    const int num_workers = par_num_workers(atoi(sargs_value_def("threads", "0")));
     printf("FUSE Z80 TEST\n");
+    if (!load_file(&state.input, "fuse/fuse-input.bin") || !load_file(&state.expected, "fuse/fuse-expected.bin")) {
+        return 10;
+    }
+    if (state.input.num_tests != state.expected.num_tests) {
+        fprintf(stderr, "number of input and expected tests doesn't match!\n");
+        return 10;
+    }
+    const int num_tests = (int)state.input.num_tests;
+    state.results = calloc((size_t)num_tests, sizeof(fuse_result_t));
+    par_for(num_tests, num_workers, run_case, 0);
     int num_failed = 0;
-    for (int i = 0; i < fuse_input_num; i++) {
-        if (!run_test(&fuse_input[i], &fuse_expected[i])) {
+    for (int i = 0; i < num_tests; i++) {
+        printf("%s", state.results[i].output);
+        if (!state.results[i].ok) {
             num_failed++;
         }
     }
+    free(state.results);
+    testvec_unmap(&state.input.file);
+    testvec_unmap(&state.expected.file);
+    sargs_shutdown();
     printf("\n");
     if (0 == num_failed) {
         printf("All tests succeeded.\n");
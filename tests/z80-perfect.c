@@ -0,0 +1,391 @@
+//------------------------------------------------------------------------------
+//  z80-perfect.c
+//
+//  Test the cycle-stepped z80 emulator against a transistor-level Z80
+//  simulation, using the netlist simulator from perfect6502 with the
+//  Z80 netlist of the visual6502.org project loaded at runtime.
+//
+//  The netlist isn't part of this repository, the netlist arg must point
+//  to a directory with the segdefs.js, transdefs.js and nodenames.js files
+//  of the visual6502.org Z80 simulation (chip-z80).
+//
+//  Both CPUs run a random instruction stream (the whole 64 KB memory is
+//  filled with random bytes), after a prelude which loads random values
+//  into all registers. The netlist is stepped in half-cycles, and its
+//  pins are sampled after each half-cycle. Since z80_tick() only
+//  asserts the control pins for a single tick per machine cycle, while
+//  the real CPU holds them for several half-cycles, the pins are compared
+//  per bus transaction: each time the control pins form an opcode fetch,
+//  memory read/write, IO read/write, refresh or interrupt acknowledge,
+//  the transaction type, address and data bus are recorded and must be
+//  identical in both CPUs, and the number of clock cycles between opcode
+//  fetches must match (this checks the instruction timing without a
+//  manually written cycle table like in z80-timing.c).
+//
+//  Usage:
+//
+//  z80-perfect netlist=path/to/chip-z80 [seed=1] [ticks=2000] [log=false]
+//
+//  netlist:    directory with the visual6502.org Z80 netlist files
+//  seed:       random seed for the memory content and register values
+//  ticks:      number of clock cycles to run
+//  log:        print all recorded bus transactions
+//------------------------------------------------------------------------------
+#include "perfect6502/types.h"
+#include "perfect6502/netlist_sim.h"
+#include "perfect6502/netlist_load.h"
+#define CHIPS_IMPL
+#include "chips/z80.h"
+#define SOKOL_IMPL
+#include "sokol_time.h"
+#include "sokol_args.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define MEM_SIZE (1<<16)
+#define FUZZ_ADDR (0x0100)
+#define IO_INPUT (0xFF)
+
+// the control pin combinations which start a bus transaction
+static const uint64_t transaction_types[] = {
+    Z80_M1|Z80_MREQ|Z80_RD,     // opcode fetch
+    Z80_MREQ|Z80_RD,            // memory read
+    Z80_MREQ|Z80_WR,            // memory write
+    Z80_IORQ|Z80_RD,            // IO read
+    Z80_IORQ|Z80_WR,            // IO write
+    Z80_MREQ|Z80_RFSH,          // refresh
+    Z80_M1|Z80_IORQ,            // interrupt acknowledge
+};
+#define CTRL_MASK (Z80_M1|Z80_MREQ|Z80_IORQ|Z80_RD|Z80_WR|Z80_RFSH)
+
+typedef struct {
+    uint32_t tick;
+    uint64_t ctrl;
+    uint16_t addr;
+    uint8_t data;
+} transaction_t;
+
+typedef struct {
+    int num;
+    int cap;
+    transaction_t* items;
+} trace_t;
+
+// the netlist's pin nodes
+typedef struct {
+    int clk, reset, intr, nmi, busrq, wait;
+    int m1, mreq, iorq, rd, wr, rfsh;
+    nodenum_t ab[16];
+    nodenum_t db[8];
+} pin_nodes_t;
+
+static struct {
+    uint32_t seed;
+    uint32_t num_ticks;
+    bool log;
+    uint8_t mem[MEM_SIZE];
+    uint8_t netlist_mem[MEM_SIZE];
+    pin_nodes_t pins;
+    trace_t z80_trace;
+    trace_t netlist_trace;
+} state;
+
+static uint32_t xorshift32(uint32_t* x) {
+    *x ^= *x << 13;
+    *x ^= *x >> 17;
+    *x ^= *x << 5;
+    return *x;
+}
+
+static void trace_add(trace_t* trace, uint32_t tick, uint64_t ctrl, uint16_t addr, uint8_t data) {
+    if (trace->num == trace->cap) {
+        trace->cap = trace->cap ? trace->cap * 2 : 1024;
+        trace->items = realloc(trace->items, (size_t)trace->cap * sizeof(transaction_t));
+    }
+    trace->items[trace->num++] = (transaction_t){ .tick = tick, .ctrl = ctrl, .addr = addr, .data = data };
+}
+
+static bool is_transaction(uint64_t ctrl) {
+    for (size_t i = 0; i < sizeof(transaction_types) / sizeof(transaction_types[0]); i++) {
+        if (ctrl == transaction_types[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static const char* transaction_name(uint64_t ctrl) {
+    switch (ctrl) {
+        case Z80_M1|Z80_MREQ|Z80_RD:    return "FETCH";
+        case Z80_MREQ|Z80_RD:           return "MREAD";
+        case Z80_MREQ|Z80_WR:           return "MWRITE";
+        case Z80_IORQ|Z80_RD:           return "IOREAD";
+        case Z80_IORQ|Z80_WR:           return "IOWRITE";
+        case Z80_MREQ|Z80_RFSH:         return "RFSH";
+        case Z80_M1|Z80_IORQ:           return "INTACK";
+        default:                        return "???";
+    }
+}
+
+// fill memory with random bytes, and put the register-loading prelude at the reset address
+static void init_memory(uint32_t seed) {
+    uint32_t rng = seed * 2654435761U + 1;
+    if (0 == rng) {
+        rng = 1;
+    }
+    for (int i = 0; i < MEM_SIZE; i++) {
+        state.mem[i] = (uint8_t)xorshift32(&rng);
+    }
+    uint8_t r[24];
+    for (size_t i = 0; i < sizeof(r); i++) {
+        r[i] = (uint8_t)xorshift32(&rng);
+    }
+    const uint8_t prelude[] = {
+        0x31, r[0], r[1],           // LD SP,nn
+        0x21, r[2], r[3],           // LD HL,nn
+        0xE5,                       // PUSH HL
+        0xF1,                       // POP AF
+        0x08,                       // EX AF,AF'
+        0x3E, r[4],                 // LD A,n
+        0xED, 0x47,                 // LD I,A
+        0x21, r[5], r[6],           // LD HL,nn
+        0xE5,                       // PUSH HL
+        0xF1,                       // POP AF
+        0x01, r[7], r[8],           // LD BC,nn
+        0x11, r[9], r[10],          // LD DE,nn
+        0x21, r[11], r[12],         // LD HL,nn
+        0xD9,                       // EXX
+        0x01, r[13], r[14],         // LD BC,nn
+        0x11, r[15], r[16],         // LD DE,nn
+        0x21, r[17], r[18],         // LD HL,nn
+        0xD9,                       // EXX
+        0xDD, 0x21, r[19], r[20],   // LD IX,nn
+        0xFD, 0x21, r[21], r[22],   // LD IY,nn
+        0xC3, FUZZ_ADDR & 0xFF, FUZZ_ADDR >> 8, // JP nn
+    };
+    memcpy(state.mem, prelude, sizeof(prelude));
+    memcpy(state.netlist_mem, state.mem, sizeof(state.mem));
+}
+
+// run the z80 emulator and record its bus transactions
+static void run_z80(void) {
+    z80_t cpu;
+    z80_init(&cpu);
+    uint64_t pins = z80_prefetch(&cpu, 0x0000);
+    for (uint32_t tick = 0; tick < state.num_ticks; tick++) {
+        pins = z80_tick(&cpu, pins);
+        const uint16_t addr = Z80_GET_ADDR(pins);
+        if (pins & Z80_MREQ) {
+            if (pins & Z80_RD) {
+                Z80_SET_DATA(pins, state.mem[addr]);
+            } else if (pins & Z80_WR) {
+                state.mem[addr] = Z80_GET_DATA(pins);
+            }
+        } else if (pins & Z80_IORQ) {
+            if (pins & Z80_RD) {
+                Z80_SET_DATA(pins, IO_INPUT);
+            }
+        }
+        const uint64_t ctrl = pins & CTRL_MASK;
+        if (is_transaction(ctrl)) {
+            // the refresh address and the data of reads and writes are valid in this tick
+            trace_add(&state.z80_trace, tick, ctrl, addr, (ctrl == (Z80_MREQ|Z80_RFSH)) ? 0 : Z80_GET_DATA(pins));
+        }
+    }
+}
+
+static bool find_pin(netlist_t* nl, const char* name, int* node) {
+    *node = findNode(nl, name);
+    if (*node < 0) {
+        fprintf(stderr, "node '%s' not found in netlist\n", name);
+        return false;
+    }
+    return true;
+}
+
+static bool find_pins(netlist_t* nl) {
+    pin_nodes_t* p = &state.pins;
+    bool ok = find_pin(nl, "clk", &p->clk) &&
+        find_pin(nl, "_reset", &p->reset) &&
+        find_pin(nl, "_int", &p->intr) &&
+        find_pin(nl, "_nmi", &p->nmi) &&
+        find_pin(nl, "_busrq", &p->busrq) &&
+        find_pin(nl, "_wait", &p->wait) &&
+        find_pin(nl, "_m1", &p->m1) &&
+        find_pin(nl, "_mreq", &p->mreq) &&
+        find_pin(nl, "_iorq", &p->iorq) &&
+        find_pin(nl, "_rd", &p->rd) &&
+        find_pin(nl, "_wr", &p->wr) &&
+        find_pin(nl, "_rfsh", &p->rfsh);
+    for (int i = 0; ok && (i < 16); i++) {
+        char name[8];
+        int node;
+        snprintf(name, sizeof(name), "ab%d", i);
+        ok = find_pin(nl, name, &node);
+        p->ab[i] = (nodenum_t)node;
+    }
+    for (int i = 0; ok && (i < 8); i++) {
+        char name[8];
+        int node;
+        snprintf(name, sizeof(name), "db%d", i);
+        ok = find_pin(nl, name, &node);
+        p->db[i] = (nodenum_t)node;
+    }
+    return ok;
+}
+
+// the netlist's control pins (which are active-low) in z80.h pin mask format
+static uint64_t netlist_ctrl(void* sim) {
+    pin_nodes_t* p = &state.pins;
+    uint64_t ctrl = 0;
+    if (!isNodeHigh(sim, p->m1))   { ctrl |= Z80_M1; }
+    if (!isNodeHigh(sim, p->mreq)) { ctrl |= Z80_MREQ; }
+    if (!isNodeHigh(sim, p->iorq)) { ctrl |= Z80_IORQ; }
+    if (!isNodeHigh(sim, p->rd))   { ctrl |= Z80_RD; }
+    if (!isNodeHigh(sim, p->wr))   { ctrl |= Z80_WR; }
+    if (!isNodeHigh(sim, p->rfsh)) { ctrl |= Z80_RFSH; }
+    return ctrl;
+}
+
+// do one clock half-cycle, then serve memory and IO requests
+static uint64_t netlist_half_step(void* sim, bool clk) {
+    pin_nodes_t* p = &state.pins;
+    setNode(sim, (nodenum_t)p->clk, clk);
+    const uint64_t ctrl = netlist_ctrl(sim);
+    const uint16_t addr = (uint16_t)readNodes(sim, 16, p->ab);
+    if ((ctrl & Z80_MREQ) && (ctrl & Z80_RD)) {
+        writeNodes(sim, 8, p->db, state.netlist_mem[addr]);
+    } else if ((ctrl & Z80_IORQ) && (ctrl & Z80_RD)) {
+        writeNodes(sim, 8, p->db, IO_INPUT);
+    } else if ((ctrl & Z80_MREQ) && (ctrl & Z80_WR)) {
+        state.netlist_mem[addr] = (uint8_t)readNodes(sim, 8, p->db);
+    }
+    return ctrl;
+}
+
+// run the netlist simulation and record its bus transactions
+static bool run_netlist(const char* dir) {
+    netlist_t* nl = loadNetlist(dir);
+    if (!nl) {
+        return false;
+    }
+    if (!find_pins(nl)) {
+        destroyNetlist(nl);
+        return false;
+    }
+    printf("netlist: %d nodes, %d transistors\n", nl->nodes, nl->transistors);
+    void* sim = setupNodesAndTransistors(nl->transdefs, nl->node_is_pullup, nl->nodes, nl->transistors,
+        (nodenum_t)findNode(nl, "vss"), (nodenum_t)findNode(nl, "vcc"));
+    pin_nodes_t* p = &state.pins;
+    setNode(sim, (nodenum_t)p->reset, 0);
+    setNode(sim, (nodenum_t)p->clk, 1);
+    setNode(sim, (nodenum_t)p->intr, 1);
+    setNode(sim, (nodenum_t)p->nmi, 1);
+    setNode(sim, (nodenum_t)p->busrq, 1);
+    setNode(sim, (nodenum_t)p->wait, 1);
+    stabilizeChip(sim);
+
+    // hold RESET for 8 clock cycles
+    for (int i = 0; i < 8; i++) {
+        netlist_half_step(sim, false);
+        netlist_half_step(sim, true);
+    }
+    setNode(sim, (nodenum_t)p->reset, 1);
+
+    // record transactions starting with the first opcode fetch
+    bool started = false;
+    uint64_t prev_ctrl = 0;
+    uint32_t start_tick = 0;
+    for (uint32_t half = 0; half < (state.num_ticks + 8) * 2; half++) {
+        const bool clk = (half & 1) != 0;
+        const uint64_t ctrl = netlist_half_step(sim, clk);
+        if ((ctrl != prev_ctrl) && is_transaction(ctrl)) {
+            if (!started && (ctrl == (Z80_M1|Z80_MREQ|Z80_RD))) {
+                started = true;
+                start_tick = half / 2;
+            }
+            if (started) {
+                const uint16_t addr = (uint16_t)readNodes(sim, 16, p->ab);
+                const uint8_t data = (ctrl == (Z80_MREQ|Z80_RFSH)) ? 0 : (uint8_t)readNodes(sim, 8, p->db);
+                trace_add(&state.netlist_trace, half / 2 - start_tick, ctrl, addr, data);
+            }
+        }
+        prev_ctrl = ctrl;
+    }
+    destroyNodesAndTransistors(sim);
+    destroyNetlist(nl);
+    return true;
+}
+
+static void print_transaction(const char* prefix, const transaction_t* t) {
+    printf("%s tick:%6"PRIu32" %-8s addr:%04X data:%02X\n", prefix, t->tick, transaction_name(t->ctrl), t->addr, t->data);
+}
+
+// compare the recorded transactions, and the number of ticks between opcode fetches
+static bool compare_traces(void) {
+    const trace_t* a = &state.z80_trace;
+    const trace_t* b = &state.netlist_trace;
+    // the last transactions may be incomplete, since the emulators are out of phase
+    const int num = ((a->num < b->num) ? a->num : b->num) - 1;
+    if (num <= 0) {
+        printf("no bus transactions recorded\n");
+        return false;
+    }
+    int prev_fetch = -1;
+    for (int i = 0; i < num; i++) {
+        const transaction_t* ta = &a->items[i];
+        const transaction_t* tb = &b->items[i];
+        if (state.log) {
+            print_transaction("z80:    ", ta);
+            print_transaction("netlist:", tb);
+        }
+        bool ok = (ta->ctrl == tb->ctrl) && (ta->addr == tb->addr) && (ta->data == tb->data);
+        if (ok && (ta->ctrl == (Z80_M1|Z80_MREQ|Z80_RD))) {
+            if (prev_fetch >= 0) {
+                const uint32_t ticks_a = ta->tick - a->items[prev_fetch].tick;
+                const uint32_t ticks_b = tb->tick - b->items[prev_fetch].tick;
+                ok = (ticks_a == ticks_b);
+            }
+            prev_fetch = i;
+        }
+        if (!ok) {
+            printf("MISMATCH at transaction %d:\n", i);
+            if (prev_fetch >= 0) {
+                print_transaction("  z80 last fetch:    ", &a->items[prev_fetch]);
+                print_transaction("  netlist last fetch:", &b->items[prev_fetch]);
+            }
+            print_transaction("  z80:               ", ta);
+            print_transaction("  netlist:           ", tb);
+            return false;
+        }
+    }
+    printf("%d bus transactions identical\n", num);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    stm_setup();
+    if (!sargs_exists("netlist")) {
+        fprintf(stderr, "usage: z80-perfect netlist=path/to/chip-z80 [seed=1] [ticks=2000] [log=false]\n");
+        return 10;
+    }
+    state.seed = (uint32_t)strtoul(sargs_value_def("seed", "1"), 0, 10);
+    state.num_ticks = (uint32_t)strtoul(sargs_value_def("ticks", "2000"), 0, 10);
+    state.log = sargs_boolean("log");
+    init_memory(state.seed);
+
+    run_z80();
+    uint64_t start_time = stm_now();
+    if (!run_netlist(sargs_value("netlist"))) {
+        return 10;
+    }
+    printf("netlist simulation: %"PRIu32" ticks in %.3f secs\n", state.num_ticks, stm_sec(stm_since(start_time)));
+    bool success = compare_traces();
+    free(state.z80_trace.items);
+    free(state.netlist_trace.items);
+    sargs_shutdown();
+    return success ? 0 : 10;
+}
@@ -3,110 +3,220 @@
 //
 //  Runs Frank Cringle's zexdoc and zexall test through the Z80 emu. Provide
 //  a minimal CP/M environment to make these work.
+//
+//  ZEXALL is split into its sub-tests (the entries of the program's test
+//  table), which run in parallel with one Z80 instance per worker thread.
+//  The output of each sub-test is printed in the original order.
+//
+//  Usage (all args are optional):
+//
+//  z80-zex threads=4
+//
+//  threads:    number of worker threads, default is one per CPU core
+//  dir:        directory with the test data, see testvec_path() in testvec.h
 //------------------------------------------------------------------------------
 #define CHIPS_IMPL
 #include "chips/z80.h"
 #define SOKOL_IMPL
 #include "sokol_time.h"
-#include "roms/zex-dump.h"
+#include "sokol_args.h"
+#define PARALLEL_IMPL
+#include "parallel.h"
+#define TESTVEC_IMPL
+#include "testvec.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <inttypes.h> // PRIu64
 
 #define MEM_SIZE (1<<16)
 #define MEM_MASK (MEM_SIZE-1)
-#define OUTPUT_SIZE (1<<16)
+#define OUTPUT_SIZE (1<<12)
+#define MAX_SUBTESTS (128)
 
-static struct {
+typedef struct {
     z80_t cpu;
     uint8_t mem[MEM_SIZE];
+} worker_t;
+
+typedef struct {
+    uint64_t ticks;
+    double dur;
+    int num_calls;
+    int first_call_end;     // end of the banner in output
+    int last_call_start;    // start of the 'Tests complete' message in output
     int out_pos;
     char output[OUTPUT_SIZE];
+} subtest_t;
+
+static struct {
+    const uint8_t* prog;
+    size_t prog_num_bytes;
+    uint16_t table_addr;
+    int num_subtests;
+    uint16_t subtests[MAX_SUBTESTS];
+    subtest_t results[MAX_SUBTESTS];
+    worker_t workers[PAR_MAX_WORKERS];
 } state;
 
-static void put_char(char c) {
-    if (state.out_pos < OUTPUT_SIZE) {
-        state.output[state.out_pos++] = c;
+static void put_char(subtest_t* res, char c) {
+    if (res->out_pos < (OUTPUT_SIZE - 1)) {
+        res->output[res->out_pos++] = c;
     }
-    putchar(c);
 }
 
-static uint64_t tick(uint64_t pins) {
-    pins = z80_tick(&state.cpu, pins);
+static uint64_t tick(worker_t* w, uint64_t pins) {
+    pins = z80_tick(&w->cpu, pins);
     if (pins & Z80_MREQ) {
         if (pins & Z80_RD) {
-            Z80_SET_DATA(pins, state.mem[Z80_GET_ADDR(pins)]);
+            Z80_SET_DATA(pins, w->mem[Z80_GET_ADDR(pins)]);
         } else if (pins & Z80_WR) {
-            state.mem[Z80_GET_ADDR(pins)] = Z80_GET_DATA(pins);
+            w->mem[Z80_GET_ADDR(pins)] = Z80_GET_DATA(pins);
         }
     }
     return pins;
 }
 
 // emulate character and string output CP/M system calls
-static bool cpm_bdos(void) {
+static bool cpm_bdos(worker_t* w, subtest_t* res) {
     bool retval = true;
-    if (2 == state.cpu.c) {
+    res->last_call_start = res->out_pos;
+    if (2 == w->cpu.c) {
         // output character in register E
-        put_char(state.cpu.e);
-    } else if (9 == state.cpu.c) {
+        put_char(res, w->cpu.e);
+    } else if (9 == w->cpu.c) {
         // output $-terminated string pointed to by register DE
         uint8_t c;
-        uint16_t addr = state.cpu.de;
-        while ((c = state.mem[addr++ & MEM_MASK]) != '$') {
-            put_char(c);
+        uint16_t addr = w->cpu.de;
+        while ((c = w->mem[addr++ & MEM_MASK]) != '$') {
+            put_char(res, c);
         }
     } else {
-        printf("Unhandled CP/M system call: %d\n", state.cpu.c);
+        printf("Unhandled CP/M system call: %d\n", w->cpu.c);
         retval = false;
     }
+    if (0 == res->num_calls++) {
+        res->first_call_end = res->out_pos;
+    }
     // emulate a RET
-    uint8_t z = state.mem[state.cpu.sp++];
-    uint8_t w = state.mem[state.cpu.sp++];
-    state.cpu.wz = (w<<8) | z;
-    state.cpu.pc = state.cpu.wz;
+    uint8_t l = w->mem[w->cpu.sp++];
+    uint8_t h = w->mem[w->cpu.sp++];
+    w->cpu.wz = (h<<8) | l;
+    w->cpu.pc = w->cpu.wz;
     return retval;
 }
 
-static bool run_test(const char* name, uint8_t* prog, size_t prog_num_bytes) {
+// find the test table, the program starts with 'ld hl,tests; loop: ld a,(hl); inc hl; or (hl)'
+static bool find_subtests(void) {
+    for (size_t i = 0; (i + 6) <= state.prog_num_bytes; i++) {
+        const uint8_t* p = &state.prog[i];
+        if ((p[0] == 0x21) && (p[3] == 0x7E) && (p[4] == 0x23) && (p[5] == 0xB6)) {
+            state.table_addr = (uint16_t)(p[1] | (p[2] << 8));
+            break;
+        }
+    }
+    if (state.table_addr < 0x0100) {
+        return false;
+    }
+    size_t offset = state.table_addr - 0x0100;
+    while ((offset + 2) <= state.prog_num_bytes) {
+        const uint16_t entry = (uint16_t)(state.prog[offset] | (state.prog[offset + 1] << 8));
+        if ((0 == entry) || (state.num_subtests == MAX_SUBTESTS)) {
+            break;
+        }
+        state.subtests[state.num_subtests++] = entry;
+        offset += 2;
+    }
+    return state.num_subtests > 0;
+}
+
+// run a single sub-test by patching the test table to only contain that entry
+static void run_subtest(int item_index, int worker_index, void* user_data) {
+    (void)user_data;
+    worker_t* w = &state.workers[worker_index];
+    subtest_t* res = &state.results[item_index];
     bool running = true;
-    uint64_t ticks = 0;
 
-    memset(state.output, 0, sizeof(state.output));
-    memset(state.mem, 0, sizeof(state.mem));
-    memcpy(&state.mem[0x0100], prog, prog_num_bytes);
-    uint64_t pins = z80_init(&state.cpu);
-    state.cpu.sp = 0xF000;
-    z80_prefetch(&state.cpu, 0x0100);
+    memset(w->mem, 0, sizeof(w->mem));
+    memcpy(&w->mem[0x0100], state.prog, state.prog_num_bytes);
+    const uint16_t entry = state.subtests[item_index];
+    w->mem[state.table_addr + 0] = (uint8_t)entry;
+    w->mem[state.table_addr + 1] = (uint8_t)(entry >> 8);
+    w->mem[state.table_addr + 2] = 0;
+    w->mem[state.table_addr + 3] = 0;
+    uint64_t pins = z80_init(&w->cpu);
+    w->cpu.sp = 0xF000;
+    z80_prefetch(&w->cpu, 0x0100);
     uint64_t start_time = stm_now();
     while (running) {
-        pins = tick(pins);
-        ticks++;
+        pins = tick(w, pins);
+        res->ticks++;
         // check for BDOS call
-        if (state.cpu.pc == 5) {
-            running = cpm_bdos();
-        } else if (state.cpu.pc == 0) {
+        if (w->cpu.pc == 5) {
+            running = cpm_bdos(w, res);
+        } else if (w->cpu.pc == 0) {
             running = false;
         }
     }
-    double dur = stm_sec(stm_since(start_time));
-    printf("\n%s: %"PRIu64" cycles in %.3fsecs (%.2f MHz)\n", name, ticks, dur, (ticks/dur)/1000000.0);
+    res->dur = stm_sec(stm_since(start_time));
+}
 
-    /* check if an error occurred */
-    if (state.out_pos > 0) {
-        state.output[state.out_pos-1] = 0;
-        if (strstr((const char*)state.output, "ERROR")) {
-            return false;
-        } else {
-            printf("\n\n ALL %s TESTS PASSED!\n", name);
+static bool run_test(const char* name, const uint8_t* prog, size_t prog_num_bytes, int num_workers) {
+    state.prog = prog;
+    state.prog_num_bytes = prog_num_bytes;
+    if (!find_subtests()) {
+        printf("%s: test table not found!\n", name);
+        return false;
+    }
+    printf("%s: running %d tests on %d threads\n", name, state.num_subtests, num_workers);
+    uint64_t start_time = stm_now();
+    par_for(state.num_subtests, num_workers, run_subtest, 0);
+    double wall_dur = stm_sec(stm_since(start_time));
+
+    // print the results in test table order (with the banner and final message
+    // only once, so that the output looks like a sequential run), and check if
+    // an error occurred
+    bool success = true;
+    uint64_t ticks = 0;
+    double dur = 0.0;
+    for (int i = 0; i < state.num_subtests; i++) {
+        const subtest_t* res = &state.results[i];
+        ticks += res->ticks;
+        dur += res->dur;
+        const int start = (i > 0) ? res->first_call_end : 0;
+        const int end = (i < (state.num_subtests - 1)) ? res->last_call_start : res->out_pos;
+        if (end > start) {
+            fwrite(&res->output[start], 1, (size_t)(end - start), stdout);
+        }
+        if (strstr(res->output, "ERROR")) {
+            success = false;
         }
     }
-    return true;
+    printf("\n%s: %"PRIu64" cycles in %.3fsecs (%.2f MHz per thread), %.3fsecs wall clock\n",
+        name, ticks, dur, (ticks/dur)/1000000.0, wall_dur);
+    if (success) {
+        printf("\n\n ALL %s TESTS PASSED!\n", name);
+    }
+    return success;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    testvec_set_dir(sargs_value("dir"));
     stm_setup();
-    if (!run_test("ZEXALL", dump_zexall_com, sizeof(dump_zexall_com))) {
+    const int num_workers = par_num_workers(atoi(sargs_value_def("threads", "0")));
+    // the program is mapped from the roms directory instead of being compiled in
+    char path[TESTVEC_MAX_PATH];
+    testvec_path(path, sizeof(path), __FILE__, "roms/zexall.com");
+    testvec_file_t prog;
+    if (!testvec_map(&prog, path)) {
+        return 10;
+    }
+    if (prog.size > (MEM_SIZE - 0x0100)) {
+        printf("%s: program too big!\n", path);
         return 10;
     }
-    return 0;
+    bool success = run_test("ZEXALL", prog.ptr, prog.size, num_workers);
+    testvec_unmap(&prog);
+    sargs_shutdown();
+    return success ? 0 : 10;
 }